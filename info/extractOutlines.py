@@ -1,5 +1,5 @@
 import xml.etree.ElementTree as ET
-import re, sys, math
+import re, sys, math, struct
 from typing import List, Dict
 
 
@@ -87,6 +87,133 @@ def process_path_new(s : str) -> List[Node]:
     return nodes
 
 
+# The outline pack holds the same outlines in a file that can be loaded at run time, see src/OutlinePack.h. All
+# numbers are little endian:
+#   header: 'TOSS', uint32 version, uint32 count
+#   index:  count entries of uint32 name offset, data offset, data size and node count, offsets from the file start
+#   names:  NUL terminated labels
+#   data:   each node is a varint of zigzag(dx) << 3 | action followed by a varint of zigzag(dy), the deltas being from
+#           the previous node of the outline (or 0, 0). There's no X node, an outline ends with its data.
+PACK_VERSION = 1
+PACK_ACTIONS = {'M': 0, 'L': 1, 'A': 2, 'B': 3, 'C': 4}
+
+
+def zigzag(v : int) -> int:
+    return v << 1 if v >= 0 else ((-v) << 1) - 1
+
+
+def varint(v : int) -> bytes:
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return bytes(out)
+
+
+def encode_outline(nodes : List[Node]) -> bytes:
+    out = bytearray()
+    lastX = 0
+    lastY = 0
+    for node in nodes:
+        if node.action == 'X':
+            break
+        out += varint((zigzag(node.x - lastX) << 3) | PACK_ACTIONS[node.action])
+        out += varint(zigzag(node.y - lastY))
+        lastX = node.x
+        lastY = node.y
+    return bytes(out)
+
+
+def write_pack(file_name : str, keys : List[str], outlines : Dict[str, List[Node]]):
+    names = bytearray()
+    data = bytearray()
+    index = bytearray()
+    header_size = 12 + 16 * len(keys)
+    name_offsets = []
+    for k in keys:
+        name_offsets.append(len(names))
+        names += k.encode('utf-8') + b'\0'
+    data_start = header_size + len(names)
+    for i, k in enumerate(keys):
+        encoded = encode_outline(outlines[k])
+        node_count = sum(1 for node in outlines[k] if node.action != 'X')
+        index += struct.pack('<IIII', header_size + name_offsets[i], data_start + len(data), len(encoded), node_count)
+        data += encoded
+    with open(file_name, 'wb') as pack:
+        pack.write(struct.pack('<4sII', b'TOSS', PACK_VERSION, len(keys)))
+        pack.write(index)
+        pack.write(names)
+        pack.write(data)
+
+
+# The built in outlines are also flattened here, once, into the edges Path would build from them at run time. Curves
+# are split exactly as Path::curveTo does, whose test only compares lengths so gives the same edges at any scale.
+# Edges run top to bottom and each outline's edges are sorted by their top, so all that's left at run time is to scale
+# them to the screen. Co-ordinates are fixed point in 1/SEGMENT_SCALE outline units, whole units alone being just coarse
+# enough to move the odd edge across a sample.
+SEGMENT_SCALE = 64
+
+
+class Edge:
+    def __init__(self, start, end):
+        self.start = start
+        self.end = end
+
+
+def flatten_outline(nodes : List[Node]) -> List[Edge]:
+    edges : List[Edge] = []
+    last = (0.0, 0.0)
+
+    def line_to(p):
+        nonlocal last
+        if p[1] > last[1] or (p[1] == last[1] and p[0] != last[0]):
+            edges.append(Edge(last, p))
+        elif p[1] != last[1]:
+            edges.append(Edge(p, last))
+        last = p
+
+    def mid(p, q):
+        return (p[0] * 0.5 + q[0] * 0.5, p[1] * 0.5 + q[1] * 0.5)
+
+    def dist(p, q):
+        return math.sqrt((q[0] - p[0]) * (q[0] - p[0]) + (q[1] - p[1]) * (q[1] - p[1]))
+
+    def curve_to(b, c, d):
+        if dist(last, b) + dist(b, c) + dist(c, d) > 1.0001 * dist(last, d):
+            a1 = mid(last, b)
+            b1 = mid(b, c)
+            c1 = mid(c, d)
+            a2 = mid(a1, b1)
+            b2 = mid(b1, c1)
+            a3 = mid(a2, b2)
+            curve_to(a1, a2, a3)
+            curve_to(b2, c1, d)
+        else:
+            line_to(d)
+
+    pos = 0
+    while nodes[pos].action != 'X':
+        node = nodes[pos]
+        if node.action == 'M':
+            last = (float(node.x), float(node.y))
+            pos += 1
+        elif node.action == 'L':
+            line_to((float(node.x), float(node.y)))
+            pos += 1
+        else:
+            curve_to(*[(float(n.x), float(n.y)) for n in nodes[pos:pos + 3]])
+            pos += 3
+
+    def fixed(p):
+        return (int(round(SEGMENT_SCALE * p[0])), int(round(SEGMENT_SCALE * p[1])))
+
+    rounded = [Edge(fixed(e.start), fixed(e.end)) for e in edges]
+    rounded = [e for e in rounded if e.start != e.end]
+    rounded.sort(key=lambda e: e.start[1])
+    return rounded
+
+
 svg = ET.parse('outlines.svg')
 
 all_outlines :Dict[str, List[Node]] = {}
@@ -106,10 +233,18 @@ with open('../src/Outlines.h', 'w') as header:
     header.write("\n#include <cstddef>\n")
     header.write("\nnamespace Outlines {\n")
     header.write("\nstruct Node {\n    int x;\n    int y;\n    char action;\n};\n\n")
+    header.write("// A flattened edge of an outline running from x0, y0 down to x1, y1, in 1/SEGMENT_SCALE outline units.\n")
+    header.write("struct Segment {\n    int x0;\n    int y0;\n    int x1;\n    int y1;\n};\n\n")
+    header.write("constexpr int SEGMENT_SCALE = {};\n\n".format(SEGMENT_SCALE))
     for i, k in enumerate(all_keys):
         header.write("constexpr size_t {} = {};\n".format(k.upper(), i))
     header.write("constexpr size_t COUNT = {};\n".format(len(all_keys)))
     header.write("extern const Node* ALL_OUTLINES[COUNT];\n")
+    header.write("// The inkscape labels of the outlines, as used in an outline pack.\n")
+    header.write("extern const char* const NAMES[COUNT];\n")
+    header.write("// Each outline flattened into the edges Path builds from it, sorted by y0. Defined in OutlineSegments.cpp.\n")
+    header.write("extern const Segment* const ALL_SEGMENTS[COUNT];\n")
+    header.write("extern const size_t SEGMENT_COUNTS[COUNT];\n")
     header.write("\n}  // namespace Outlines\n\n")
     header.write("#endif  // OUTLINES_H_\n")
     
@@ -120,6 +255,8 @@ with open('../src/Outlines.cpp', 'w') as cpp:
 
     cpp.write("namespace Outlines {\n")
 
+    # Building with NO_BUILTIN_OUTLINES leaves the nodes out, they then have to come from an outline pack.
+    cpp.write("\n#ifndef NO_BUILTIN_OUTLINES\n")
     for k in all_keys:
         outline = all_outlines[k]
         cpp.write("\nconst Node OUTLINE_{}[] = {{".format(k.upper()))
@@ -133,6 +270,43 @@ with open('../src/Outlines.cpp', 'w') as cpp:
     for k in all_keys:
         cpp.write("\n    OUTLINE_{},".format(k.upper()))
     cpp.write("\n};\n")
+    cpp.write("#else\n")
+    cpp.write("\nconst Node* ALL_OUTLINES[{}] = {{}};\n".format(len(all_keys)))
+    cpp.write("\n#endif  // NO_BUILTIN_OUTLINES\n")
+
+    cpp.write("\nconst char* const NAMES[{}] = {{".format(len(all_keys)))
+    for k in all_keys:
+        cpp.write("\n    \"{}\",".format(k))
+    cpp.write("\n};\n")
     cpp.write("\n}  // namespace Outlines\n")
 
+with open('../src/OutlineSegments.cpp', 'w') as cpp:
+    cpp.write("// This file was automatically generated by the extractOutlines.py script. Do not edit this file by hand.\n\n")
+    cpp.write("#include \"Outlines.h\"\n\n")
+    cpp.write("namespace Outlines {\n")
+
+    cpp.write("\n#ifndef NO_BUILTIN_OUTLINES\n")
+    all_segments = {k: flatten_outline(all_outlines[k]) for k in all_keys}
+    for k in all_keys:
+        cpp.write("\nconst Segment SEGMENTS_{}[] = {{".format(k.upper()))
+        for i, edge in enumerate(all_segments[k]):
+            if i % 3 == 0:
+                cpp.write('\n    ')
+            cpp.write("{{{:8},{:8},{:8},{:8}}}, ".format(edge.start[0], edge.start[1], edge.end[0], edge.end[1]))
+        cpp.write("\n};\n")
+
+    cpp.write("\nconst Segment* const ALL_SEGMENTS[{}] = {{".format(len(all_keys)))
+    for k in all_keys:
+        cpp.write("\n    SEGMENTS_{},".format(k.upper()))
+    cpp.write("\n};\n")
+    cpp.write("\nconst size_t SEGMENT_COUNTS[{}] = {{".format(len(all_keys)))
+    for k in all_keys:
+        cpp.write("\n    {},".format(len(all_segments[k])))
+    cpp.write("\n};\n")
+    cpp.write("#else\n")
+    cpp.write("\nconst Segment* const ALL_SEGMENTS[{}] = {{}};\n".format(len(all_keys)))
+    cpp.write("const size_t SEGMENT_COUNTS[{}] = {{}};\n".format(len(all_keys)))
+    cpp.write("\n#endif  // NO_BUILTIN_OUTLINES\n")
+    cpp.write("\n}  // namespace Outlines\n")
 
+write_pack('../resources/outlines.pack', all_keys, all_outlines)
@@ -0,0 +1,345 @@
+#include <SDL.h>
+#include <algorithm>
+#include <ctime>
+
+#include "Board.h"
+#include "GameSounds.h"
+#include "LcdElement.h"
+
+namespace {
+    const uint32_t gameDelays[] = {
+        393, 336, 254, 243, 231, 226, 214, 203, 192, 180, 169, 157, 146, 134,
+            124, 112, 100, 89
+    };
+
+    // Where the outer ball and the arms are, elapsed milliseconds into time mode.
+    Uint32 getTimeModeBallPosition(Uint32 elapsed) {
+        return (11 + elapsed / 1000) % 22;
+    }
+
+    uint32_t getTimeModeArmPosition(Uint32 elapsed) {
+        Uint32 gamePos = getTimeModeBallPosition(elapsed);
+        if (gamePos < 2 || gamePos > 19)
+            return 2;
+        else if (gamePos >= 9 && gamePos <= 12)
+            return 0;
+        else
+            return 1;
+    }
+}
+
+void Board::layout(int width, int height, size_t count, const OutlinePack* outlinePack,
+    std::vector<SDL_Rect>& viewports) {
+    const int boards = static_cast<int>(count);
+    int columns = 1;
+    double bestScale = 0.0;
+    for (int c = 1; c <= boards; ++c) {
+        const int r = (boards + c - 1) / c;
+        if (width / c == 0 || height / r == 0)
+            break;
+        Bounds bounds;
+        bounds.computeBounds(width / c, height / r, outlinePack);
+        if (1.0 / bounds.pathUnitsPerPixel > bestScale) {
+            bestScale = 1.0 / bounds.pathUnitsPerPixel;
+            columns = c;
+        }
+    }
+
+    // The grid is centred, any pixels left over are split either side.
+    const int rows = (boards + columns - 1) / columns;
+    const int cellWidth = width / columns;
+    const int cellHeight = height / rows;
+    const int left = (width - columns * cellWidth) / 2;
+    const int top = (height - rows * cellHeight) / 2;
+    viewports.clear();
+    for (int i = 0; i < boards; ++i) {
+        SDL_Rect viewport = { left + (i % columns) * cellWidth, top + (i / columns) * cellHeight, cellWidth,
+            cellHeight };
+        viewports.push_back(viewport);
+    }
+}
+
+// Time mode is shown when the program starts and shows everything apart from the inner and middle balls and the
+// crashed juggler.
+bool Board::isShownInTimeMode(size_t outlineID) {
+    if (outlineID >= Outlines::INNER0 && outlineID <= Outlines::INNER8)
+        return false;
+    if (outlineID >= Outlines::MID0 && outlineID <= Outlines::MID9)
+        return false;
+    return outlineID != Outlines::LEFT_CRUSH && outlineID != Outlines::LEFT_SPLAT &&
+        outlineID != Outlines::RIGHT_CRUSH && outlineID != Outlines::RIGHT_SPLAT;
+}
+
+DisplayState Board::getDisplayState(Uint32 now, std::time_t time) const {
+    DisplayState state;
+    if (currentMode == Mode::TIME) {
+        Uint32 currentTicks = now - timeModeStartedTick;
+        Uint32 gamePos = getTimeModeBallPosition(currentTicks);
+
+        auto localTime = std::localtime(&time);
+        int hour = (localTime->tm_hour % 12);
+        if (hour == 0)
+            hour = 12;
+
+        state = DisplayState::forPose(getTimeModeArmPosition(currentTicks));
+        state |= DisplayState::forOuterBall(gamePos);
+        state |= DisplayState::forScore(hour * 100 + localTime->tm_min);
+    } else if (currentMode != Mode::ACL) {
+        state = DisplayState::forPose(armPosition);
+        if (crashedLeft) {
+            state.set(Outlines::LEFT_SPLAT);
+            state.set(Outlines::LEFT_CRUSH);
+        }
+        if (crashedRight) {
+            state.set(Outlines::RIGHT_SPLAT);
+            state.set(Outlines::RIGHT_CRUSH);
+        }
+        state |= DisplayState::forOuterBall(outerBallPos);
+        state |= DisplayState::forMidBall(midBallPos);
+        state |= DisplayState::forInnerBall(innerBallPos);
+        state |= DisplayState::forScore(score);
+    }
+    return state;
+}
+
+
+bool Board::moveBall(int& currentPosition, int maxPosition, bool& willDropFlag, int catchRightPosition) {
+    currentPosition = (currentPosition + 1) % maxPosition;
+    if (currentPosition == maxPosition / 2) {
+        willDropFlag = armPosition != (2 - catchRightPosition);
+        if (!willDropFlag)
+            catches++;
+    }
+    else if (currentPosition == 0) {
+        willDropFlag = armPosition != catchRightPosition;
+        if (!willDropFlag)
+            catches++;
+    }
+    else if (gamePosition > 3)
+    {
+        if (currentPosition == 1 || currentPosition == (maxPosition / 2) + 1) {
+            if (willDropFlag) {
+                crashedRight = currentPosition == 1;
+                crashedLeft = currentPosition != 1;
+                currentPosition = -1;
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+Uint32 Board::move(GameSounds* sounds) {
+    int ballIndex;
+    if (currentMode == Mode::GAME_A)
+        ballIndex = 1 + gamePosition % 2;
+    else
+        ballIndex = gamePosition % 3;
+
+    bool playCatch = catches > 0;
+
+    switch (ballIndex) {
+        case 0:
+            if (moveBall(innerBallPos, 14, willDropInner, 0) && sounds != nullptr)
+                sounds->playInnerBeep();
+            break;
+        case 1:
+            if (moveBall(midBallPos, 18, willDropMid, 1) && sounds != nullptr)
+                sounds->playMidBeep();
+            break;
+        case 2:
+            if (moveBall(outerBallPos, 22, willDropOuter, 2) && sounds != nullptr)
+                sounds->playOuterBeep();
+            break;
+    }
+
+    if (isShowingCrashed()) {
+        if (sounds != nullptr)
+            sounds->playDropBeep();
+    }
+    else if (playCatch) {
+        score += currentMode == Mode::GAME_A ? 1 : 10;
+        score %= 10000;
+        if (sounds != nullptr)
+            sounds->playCatchBeep();
+        catches--;
+    }
+    gamePosition++;
+
+    Uint32 nextDelay = 0;
+    if (!isShowingCrashed()) {
+        if (currentMode == Mode::GAME_A)
+        {
+            if (score < 5)
+                nextDelay = gameDelays[0];
+            else if (score < 10)
+                nextDelay = gameDelays[1];
+            else if (score < 20)
+                nextDelay = gameDelays[3];
+            else {
+                int hundreds = score / 100;
+                int  tens = (score / 10) % 10;
+                size_t index = std::min(17, 2 + tens + (hundreds >= 4 ? 12 : hundreds * 2));
+                nextDelay = gameDelays[index];
+            }
+        }
+        else {
+            int thousands = score / 1000;
+            int hundreds = (score / 100) % 10;
+            int index = std::min(17, 2 + hundreds + (thousands >= 4 ? 12 : thousands * 2));
+            nextDelay = gameDelays[index];
+        }
+    }
+    else {
+        if (currentMode == Mode::GAME_A)
+            gameAHiScore = std::max(gameAHiScore, score);
+        else
+            gameBHiScore = std::max(gameBHiScore, score);
+    }
+
+    return nextDelay;
+}
+
+Uint32 Board::update(Uint32 now, GameSounds* sounds) {
+    while (isMoving && SDL_TICKS_PASSED(now, moveTick)) {
+        Uint32 delay = move(sounds);
+        if (delay == 0)
+            isMoving = false;
+        moveTick += delay;
+    }
+    return isMoving ? moveTick - now : 0;
+}
+
+void Board::resetGameState(Uint32 now) {
+    if (currentMode == Mode::TIME)
+        armPosition = getTimeModeArmPosition(now - timeModeStartedTick);
+    score = 0;
+    catches = 0;
+    outerBallPos = 11;
+    midBallPos = 0;
+    innerBallPos = 7;
+    gamePosition = 0;
+    willDropInner = false;
+    willDropMid = false;
+    willDropOuter = false;
+    crashedLeft = false;
+    crashedRight = false;
+}
+
+
+void Board::startGameA(Uint32 now) {
+    if (!isRunningGame()) {
+        resetGameState(now);
+        currentMode = Mode::GAME_A;
+        innerBallPos = -1;
+        startMoving(now);
+
+    }
+}
+
+void Board::startGameAHiScore(Uint32 now) {
+    if (!isRunningGame()) {
+        resetGameState(now);
+        currentMode = Mode::GAME_A_HI_SCORE;
+        innerBallPos = -1;
+        score = gameAHiScore;
+    }
+}
+
+void Board::startGameB(Uint32 now) {
+    if (!isRunningGame()) {
+        resetGameState(now);
+        currentMode = Mode::GAME_B;
+        startMoving(now);
+    }
+}
+
+void Board::startGameBHiScore(Uint32 now) {
+    if (!isRunningGame()) {
+        resetGameState(now);
+        currentMode = Mode::GAME_B_HI_SCORE;
+        score = gameBHiScore;
+    }
+}
+
+void Board::startTimeMode(Uint32 now) {
+    if (isShowingCrashed()) {
+        gamePosition = 0;
+        crashedLeft = false;
+        crashedRight = false;
+        timeModeStartedTick = now;
+        currentMode = Mode::TIME;
+    }
+}
+
+void Board::setArmPosition(uint32_t newArmPosition) {
+    if (newArmPosition != armPosition && newArmPosition >= 0 && newArmPosition <= 2) {
+        armPosition = newArmPosition;
+        if (willDropMid && armPosition == 1) {
+            willDropMid = false;
+            catches++;
+        }
+        if (willDropOuter && ((armPosition == 2 && outerBallPos == 0) || (armPosition == 0 && outerBallPos == 11))) {
+            willDropOuter = false;
+            catches++;
+        }
+        if (willDropInner && ((armPosition == 0 && innerBallPos == 0) || (armPosition == 2 && innerBallPos == 7))) {
+            willDropInner = false;
+            catches++;
+        }
+    }
+}
+
+int Board::getSavingArmPosition() const {
+    // As setArmPosition catches them.
+    if (!isRunningGame())
+        return -1;
+    if (willDropMid)
+        return 1;
+    if (willDropOuter && (outerBallPos == 0 || outerBallPos == 11))
+        return outerBallPos == 0 ? 2 : 0;
+    if (willDropInner && (innerBallPos == 0 || innerBallPos == 7))
+        return innerBallPos == 0 ? 0 : 2;
+    return -1;
+}
+
+void Board::moveArmsRight() {
+    if (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B)
+        setArmPosition(armPosition + 1);
+}
+
+void Board::moveArmsLeft() {
+    if (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B)
+        setArmPosition(armPosition - 1);
+}
+
+void Board::save(Uint32 baseTick, uint32_t* values) const {
+    const uint32_t saved[SAVED_VALUES] = {
+        static_cast<uint32_t>(currentMode), score, gamePosition, static_cast<uint32_t>(outerBallPos),
+        static_cast<uint32_t>(midBallPos), static_cast<uint32_t>(innerBallPos), armPosition, willDropOuter,
+        willDropMid, willDropInner, crashedLeft, crashedRight, catches, gameAHiScore, gameBHiScore,
+        timeModeStartedTick - baseTick, isMoving, moveTick - baseTick
+    };
+    std::copy(saved, saved + SAVED_VALUES, values);
+}
+
+void Board::load(Uint32 baseTick, const uint32_t* values) {
+    currentMode = static_cast<Mode>(std::min(values[0], static_cast<uint32_t>(Mode::ACL)));
+    score = values[1];
+    gamePosition = values[2];
+    outerBallPos = static_cast<int>(values[3]);
+    midBallPos = static_cast<int>(values[4]);
+    innerBallPos = static_cast<int>(values[5]);
+    armPosition = std::min(values[6], 2u);
+    willDropOuter = values[7] != 0;
+    willDropMid = values[8] != 0;
+    willDropInner = values[9] != 0;
+    crashedLeft = values[10] != 0;
+    crashedRight = values[11] != 0;
+    catches = values[12];
+    gameAHiScore = values[13];
+    gameBHiScore = values[14];
+    timeModeStartedTick = baseTick + values[15];
+    isMoving = values[16] != 0;
+    moveTick = baseTick + values[17];
+}
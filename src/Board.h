@@ -0,0 +1,123 @@
+#ifndef BOARD_H_
+#define BOARD_H_
+
+#include <SDL.h>
+#include <ctime>
+#include <vector>
+
+#include "DisplayState.h"
+
+class GameSounds;
+class OutlinePack;
+
+// The rules of one Toss Up game: its mode, score, balls and juggler. Drawing, input and timing are left to GameState,
+// which can host several boards side by side.
+class Board {
+public:
+    enum class Mode {
+        GAME_A, GAME_A_HI_SCORE, GAME_B, GAME_B_HI_SCORE, TIME, ACL
+    };
+
+protected:
+    Mode currentMode = Mode::TIME;
+
+    uint32_t score = 0;
+
+    // Display the juggler figure such that the arms/legs are as follows
+    // armPos == 0 - right arm in inner track, left arm in outer track, .
+    // armPos == 1 - both arms in the mid track.
+    // armPos == 2 - right arm in outer track, left arm in inner track, .
+    uint32_t gamePosition = 0;
+    int outerBallPos = -1;
+    int midBallPos = -1;
+    int innerBallPos = -1;
+    uint32_t armPosition = 0;
+    bool willDropOuter = false;
+    bool willDropMid = false;
+    bool willDropInner = false;
+    bool crashedLeft = false;
+    bool crashedRight = false;
+    uint32_t catches = 0;
+    uint32_t gameAHiScore = 0;
+    uint32_t gameBHiScore = 0;
+    uint32_t timeModeStartedTick = SDL_GetTicks();
+
+    // When the balls next move, while a game is being played. Each move is timed from when the last was due rather
+    // than when it happened, so the moves only depend on the ticks the keys were pressed at.
+    bool isMoving = false;
+    Uint32 moveTick = 0;
+
+    // Clear the balls and score for a new game. Leaving time mode the arms stay where they were last shown.
+    void resetGameState(Uint32 now);
+    void setArmPosition(uint32_t armPosition);
+    bool moveBall(int& currentPosition, int maxPosition, bool& willDropFlag, int catchRightPosition);
+
+    // Move the next ball, returning the delay until the next move or 0 if the game is over.
+    Uint32 move(GameSounds* sounds);
+
+    void startMoving(Uint32 now) {
+        isMoving = true;
+        moveTick = now + 1;
+    }
+
+    bool isRunningGame() const {
+        return !crashedLeft && !crashedRight && (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B);
+    }
+
+    bool isShowingCrashed() const {
+        return (crashedLeft || crashedRight) && (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B);
+    }
+
+public:
+    // Lay out count boards in a grid filling a width by height screen, with as many columns as make the boards
+    // biggest. Each viewport is the part of the screen a board is drawn in, they're all the same size.
+    static void layout(int width, int height, size_t count, const OutlinePack* outlinePack,
+        std::vector<SDL_Rect>& viewports);
+
+    // True if the element is lit at some point in time mode, which is what's shown when the program starts.
+    static bool isShownInTimeMode(size_t outlineID);
+
+    bool isInTimeMode() const {
+        return currentMode == Mode::TIME;
+    }
+
+    Mode getMode() const {
+        return currentMode;
+    }
+
+    uint32_t getScore() const {
+        return score;
+    }
+
+    uint32_t getArmPosition() const {
+        return armPosition;
+    }
+
+    // Where the arms have to be to save a ball that's about to be dropped, or -1 if none is.
+    int getSavingArmPosition() const;
+
+    // The elements lit by the current mode at the tick now. Time mode shows the time of day in time.
+    DisplayState getDisplayState(Uint32 now, std::time_t time) const;
+
+    // Make every move of the balls due by now, sounding the beeps if sounds is given. Returns how long until they're
+    // next due, or 0 if no game is being played.
+    Uint32 update(Uint32 now, GameSounds* sounds);
+
+    void startGameA(Uint32 now);
+    void startGameAHiScore(Uint32 now);
+    void startGameB(Uint32 now);
+    void startGameBHiScore(Uint32 now);
+    void startTimeMode(Uint32 now);
+    void moveArmsLeft();
+    void moveArmsRight();
+
+    // How many values save writes.
+    static constexpr size_t SAVED_VALUES = 18;
+
+    // Write everything that decides how the board plays on to values, with its ticks relative to baseTick, so load
+    // can put it back as it was.
+    void save(Uint32 baseTick, uint32_t* values) const;
+    void load(Uint32 baseTick, const uint32_t* values);
+};
+
+#endif  // BOARD_H_
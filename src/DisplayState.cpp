@@ -0,0 +1,127 @@
+#include <cstring>
+
+#include "DisplayState.h"
+#include "Outlines.h"
+
+namespace {
+    // see https://en.wikipedia.org/wiki/Seven-segment_display
+    const uint8_t digitToSegments[] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F };
+
+    constexpr int OUTER_POSITIONS = 22;
+    constexpr int MID_POSITIONS = 18;
+    constexpr int INNER_POSITIONS = 14;
+
+    struct Tables {
+        DisplayState scores[10000];
+        DisplayState poses[3];
+        DisplayState outerBalls[OUTER_POSITIONS];
+        DisplayState midBalls[MID_POSITIONS];
+        DisplayState innerBalls[INNER_POSITIONS];
+        DisplayState empty;
+
+        static void addDigit(DisplayState& state, size_t outlineID, uint32_t digit) {
+            for (uint8_t mask = digitToSegments[digit % 10]; mask != 0; mask >>= 1, ++outlineID) {
+                if ((mask & 1) != 0)
+                    state.set(outlineID);
+            }
+        }
+
+        // Balls go up one side of the track and back down the other so each element is lit at two positions.
+        static void addTrack(DisplayState* balls, int positions, size_t firstID) {
+            for (int i = 0; i < positions; ++i)
+                balls[i].set(firstID + (i <= positions / 2 ? i : positions - i));
+        }
+
+        Tables() {
+            for (uint32_t score = 0; score < 10000; ++score) {
+                addDigit(scores[score], Outlines::UNIT_A, score);
+                if (score >= 10)
+                    addDigit(scores[score], Outlines::TENS_A, score / 10);
+                if (score >= 100)
+                    addDigit(scores[score], Outlines::HUND_A, score / 100);
+                if (score >= 1000)
+                    addDigit(scores[score], Outlines::THOU_A, score / 1000);
+            }
+
+            const size_t limbs[3][4] = {
+                { Outlines::LEFT_LEG_DOWN, Outlines::RIGHT_LEG_UP, Outlines::LEFT_ARM_OUTER, Outlines::RIGHT_ARM_INNER },
+                { Outlines::LEFT_LEG_DOWN, Outlines::RIGHT_LEG_DOWN, Outlines::LEFT_ARM_MID, Outlines::RIGHT_ARM_MID },
+                { Outlines::LEFT_LEG_UP, Outlines::RIGHT_LEG_DOWN, Outlines::LEFT_ARM_INNER, Outlines::RIGHT_ARM_OUTER },
+            };
+            for (int pose = 0; pose < 3; ++pose) {
+                poses[pose].set(Outlines::FRAME);
+                poses[pose].set(Outlines::BODY);
+                poses[pose].set(Outlines::LEFT_ARM);
+                poses[pose].set(Outlines::RIGHT_ARM);
+                for (size_t limb : limbs[pose]) poses[pose].set(limb);
+            }
+
+            addTrack(outerBalls, OUTER_POSITIONS, Outlines::OUTER0);
+            addTrack(midBalls, MID_POSITIONS, Outlines::MID0);
+            addTrack(innerBalls, INNER_POSITIONS, Outlines::INNER0);
+        }
+    };
+
+    const Tables& tables() {
+        static const Tables instance;
+        return instance;
+    }
+}
+
+const DisplayState& DisplayState::forScore(uint32_t score) {
+    return tables().scores[score % 10000];
+}
+
+const DisplayState& DisplayState::forPose(uint32_t armPosition) {
+    return tables().poses[armPosition % 3];
+}
+
+const DisplayState& DisplayState::forOuterBall(int position) {
+    return position >= 0 && position < OUTER_POSITIONS ? tables().outerBalls[position] : tables().empty;
+}
+
+const DisplayState& DisplayState::forMidBall(int position) {
+    return position >= 0 && position < MID_POSITIONS ? tables().midBalls[position] : tables().empty;
+}
+
+const DisplayState& DisplayState::forInnerBall(int position) {
+    return position >= 0 && position < INNER_POSITIONS ? tables().innerBalls[position] : tables().empty;
+}
+
+void DisplayState::toHex(char* text) const {
+    static const char digits[] = "0123456789ABCDEF";
+    for (size_t i = 0; i < HEX_DIGITS; ++i) {
+        size_t bit = (HEX_DIGITS - 1 - i) * 4;
+        text[i] = digits[(bits[bit / 64] >> (bit % 64)) & 0xF];
+    }
+    text[HEX_DIGITS] = '\0';
+}
+
+bool DisplayState::fromHex(const char* text) {
+    DisplayState parsed;
+    const size_t length = std::strlen(text);
+    if (length == 0)
+        return false;
+    for (size_t i = 0; i < length; ++i) {
+        const char c = text[length - 1 - i];
+        uint64_t digit;
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            digit = c - 'A' + 10;
+        else
+            return false;
+
+        for (size_t bit = i * 4; digit != 0; digit >>= 1, ++bit) {
+            if ((digit & 1) == 0)
+                continue;
+            if (bit >= Outlines::COUNT)
+                return false;
+            parsed.set(bit);
+        }
+    }
+    *this = parsed;
+    return true;
+}
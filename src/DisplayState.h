@@ -0,0 +1,115 @@
+#ifndef DISPLAYSTATE_H_
+#define DISPLAYSTATE_H_
+
+#include <cstddef>
+#include <cstdint>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "Outlines.h"
+
+// Which of the LCD elements are lit, one bit per outline ID. Everything shown on screen is described by one of these
+// so comparing two frames is just a couple of XORs. The common combinations come from precomputed tables.
+struct DisplayState {
+    static constexpr size_t WORDS = (Outlines::COUNT + 63) / 64;
+
+    uint64_t bits[WORDS] = {};
+
+    void set(size_t outlineID) {
+        bits[outlineID / 64] |= uint64_t(1) << (outlineID % 64);
+    }
+
+    void clear(size_t outlineID) {
+        bits[outlineID / 64] &= ~(uint64_t(1) << (outlineID % 64));
+    }
+
+    bool isSet(size_t outlineID) const {
+        return (bits[outlineID / 64] & (uint64_t(1) << (outlineID % 64))) != 0;
+    }
+
+    bool isEmpty() const {
+        for (auto word : bits) {
+            if (word != 0)
+                return false;
+        }
+        return true;
+    }
+
+    // True if every element lit in other is lit here too.
+    bool contains(const DisplayState& other) const {
+        for (size_t i = 0; i < WORDS; ++i) {
+            if ((bits[i] & other.bits[i]) != other.bits[i])
+                return false;
+        }
+        return true;
+    }
+
+    DisplayState& operator|=(const DisplayState& other) {
+        for (size_t i = 0; i < WORDS; ++i) bits[i] |= other.bits[i];
+        return *this;
+    }
+
+    // The elements that differ between two states.
+    DisplayState operator^(const DisplayState& other) const {
+        DisplayState result;
+        for (size_t i = 0; i < WORDS; ++i) result.bits[i] = bits[i] ^ other.bits[i];
+        return result;
+    }
+
+    bool operator==(const DisplayState& other) const {
+        return (*this ^ other).isEmpty();
+    }
+
+    bool operator!=(const DisplayState& other) const {
+        return !(*this == other);
+    }
+
+    // Call f with the ID of each lit element in ascending order.
+    template <typename F>
+    void forEach(F f) const {
+        for (size_t i = 0; i < WORDS; ++i) {
+            uint64_t word = bits[i];
+            while (word != 0) {
+                f(i * 64 + lowestBit(word));
+                word &= word - 1;
+            }
+        }
+    }
+
+    // The lit elements as a hex number, outline ID 0 being the lowest bit. text must have room for HEX_DIGITS plus
+    // the terminator.
+    static constexpr size_t HEX_DIGITS = (Outlines::COUNT + 3) / 4;
+    void toHex(char* text) const;
+
+    // Parse a hex number written by toHex, leading zeros can be left off. Returns false if text isn't a hex number or
+    // lights an element that doesn't exist.
+    bool fromHex(const char* text);
+
+    // The four digit score with leading zeros blanked, score is taken modulo 10000.
+    static const DisplayState& forScore(uint32_t score);
+
+    // The frame and the juggler with the arms and legs in one of the three positions, see GameState::armPosition.
+    static const DisplayState& forPose(uint32_t armPosition);
+
+    // A ball at the given position along its track. Positions count up and back down the track so the outer track
+    // has 22 positions, the middle 18 and the inner 14. Anything else is an empty state.
+    static const DisplayState& forOuterBall(int position);
+    static const DisplayState& forMidBall(int position);
+    static const DisplayState& forInnerBall(int position);
+
+protected:
+    static size_t lowestBit(uint64_t word) {
+#ifdef _MSC_VER
+        unsigned long index;
+        if (_BitScanForward(&index, static_cast<unsigned long>(word)))
+            return index;
+        _BitScanForward(&index, static_cast<unsigned long>(word >> 32));
+        return index + 32;
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+};
+
+#endif  // DISPLAYSTATE_H_
@@ -0,0 +1,73 @@
+#include <SDL.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+#include "DistanceField.h"
+#include "Path.h"
+
+namespace {
+    double distanceToEdge(const Point& p, const Path::Edge& edge) {
+        double dx = edge.end.x - edge.start.x;
+        double dy = edge.end.y - edge.start.y;
+        double t = ((p.x - edge.start.x) * dx + (p.y - edge.start.y) * dy) / (dx * dx + dy * dy);
+        t = std::min(1.0, std::max(0.0, t));
+        double ex = edge.start.x + t * dx - p.x;
+        double ey = edge.start.y + t * dy - p.y;
+        return std::sqrt(ex * ex + ey * ey);
+    }
+}
+
+void DistanceField::create(size_t outlineID, const OutlinePack* outlinePack) {
+    fieldBounds.computeBounds(RESOLUTION, RESOLUTION, outlinePack);
+    Path p;
+    fieldBounds.outlineToPath(outlineID, p);
+
+    leftBound = fieldBounds.pixelXToPath(p.leftBound);
+    rightBound = fieldBounds.pixelXToPath(p.rightBound);
+    topBound = fieldBounds.pixelYToPath(p.topBound);
+    bottomBound = fieldBounds.pixelYToPath(p.bottomBound);
+
+    left = static_cast<int>(std::floor(p.leftBound)) - SPREAD;
+    top = static_cast<int>(std::floor(p.topBound)) - SPREAD;
+    width = static_cast<int>(std::ceil(p.rightBound)) + SPREAD - left;
+    height = static_cast<int>(std::ceil(p.bottomBound)) + SPREAD - top;
+    distances.assign(static_cast<size_t>(width) * height, static_cast<float>(SPREAD));
+
+    // Only texels within SPREAD of an edge can be nearer than the clamped distance so each edge just visits those.
+    for (const Path::Edge& edge : p.getEdges()) {
+        int x0 = std::max(0, static_cast<int>(std::floor(std::min(edge.start.x, edge.end.x))) - SPREAD - left);
+        int x1 = std::min(width - 1, static_cast<int>(std::ceil(std::max(edge.start.x, edge.end.x))) + SPREAD - left);
+        int y0 = std::max(0, static_cast<int>(std::floor(edge.start.y)) - SPREAD - top);
+        int y1 = std::min(height - 1, static_cast<int>(std::ceil(edge.end.y)) + SPREAD - top);
+        for (int y = y0; y <= y1; ++y) {
+            float* row = &distances[static_cast<size_t>(y) * width];
+            for (int x = x0; x <= x1; ++x) {
+                float d = static_cast<float>(distanceToEdge(Point(left + x + 0.5, top + y + 0.5), edge));
+                row[x] = std::min(row[x], d);
+            }
+        }
+    }
+
+    // Then make the texels inside the outline negative. scanLine samples at the right of each texel so shift by half
+    // a texel to sample the centres.
+    auto inside = std::make_unique<uint16_t[]>(width);
+    for (int y = 0; y < height; ++y) {
+        std::fill(inside.get(), inside.get() + width, 0);
+        p.scanLine(top + y + 0.5, left - 0.5, 1, width, 1, inside.get());
+        float* row = &distances[static_cast<size_t>(y) * width];
+        for (int x = 0; x < width; ++x) {
+            if (inside[x] != 0)
+                row[x] = -row[x];
+        }
+    }
+}
+
+DistanceField::Sample DistanceField::sample(double texel, int size) {
+    // Texel centres are at +0.5 and anything beyond the grid takes the value of the nearest texel.
+    double position = std::min(size - 1.0, std::max(0.0, texel - 0.5));
+    Sample s;
+    s.index = std::min(size - 2, static_cast<int>(position));
+    s.weight = static_cast<float>(position - s.index);
+    return s;
+}
@@ -0,0 +1,71 @@
+#ifndef DISTANCEFIELD_H_
+#define DISTANCEFIELD_H_
+
+#include <SDL.h>
+#include <vector>
+
+#include "LcdElement.h"
+
+// The signed distance from the centre of each texel of a grid to the nearest edge of an outline, negative inside the
+// outline. The field is computed once at a modest resolution and can then produce anti-aliased images of the element
+// at any size far quicker than rasterising the outline again.
+class DistanceField {
+protected:
+    // Maps path units to texels, the grid itself starts at texel (left, top).
+    Bounds fieldBounds;
+    int left = 0;
+    int top = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<float> distances;
+
+public:
+    // The frame is RESOLUTION texels across.
+    static constexpr int RESOLUTION = 1024;
+
+    // Distances are only exact up to SPREAD texels from an edge, further away they are clamped.
+    static constexpr int SPREAD = 4;
+
+    // Bounds of the outline in path units.
+    double leftBound;
+    double topBound;
+    double rightBound;
+    double bottomBound;
+
+    bool isCreated() const {
+        return !distances.empty();
+    }
+
+    void create(size_t outlineID, const OutlinePack* outlinePack = nullptr);
+
+    // Where a coordinate falls in the grid, the texel before it and the weight given to the texel after it.
+    struct Sample {
+        int index;
+        float weight;
+    };
+
+    Sample sampleX(double pathX) const {
+        return sample(fieldBounds.pathXToPixel(pathX) - left, width);
+    }
+
+    Sample sampleY(double pathY) const {
+        return sample(fieldBounds.pathYToPixel(pathY) - top, height);
+    }
+
+    // The signed distance in texels, bilinearly interpolated between the texels around the sample point.
+    float distanceAt(Sample x, Sample y) const {
+        const float* row = &distances[static_cast<size_t>(y.index) * width + x.index];
+        float upper = row[0] + (row[1] - row[0]) * x.weight;
+        float lower = row[width] + (row[width + 1] - row[width]) * x.weight;
+        return upper + (lower - upper) * y.weight;
+    }
+
+    double getPathUnitsPerTexel() const {
+        return fieldBounds.pathUnitsPerPixel;
+    }
+
+protected:
+    static Sample sample(double texel, int size);
+};
+
+#endif  // DISTANCEFIELD_H_
@@ -0,0 +1,110 @@
+#include <SDL.h>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include "FrameWriter.h"
+
+FrameWriter::~FrameWriter() {
+    close();
+}
+
+bool FrameWriter::open(const char* path) {
+    close();
+    this->path = path;
+    frameCount = 0;
+    // The path isn't used as a format, anything else in it with a % is taken literally.
+    const size_t number = this->path.find("%d");
+    isPerFrame = number != std::string::npos;
+    if (isPerFrame) {
+        prefix = this->path.substr(0, number);
+        suffix = this->path.substr(number + 2);
+    }
+    isPpm = isPerFrame || (this->path.size() >= 4 && this->path.compare(this->path.size() - 4, 4, ".ppm") == 0);
+    if (isPerFrame)
+        return true;
+
+    if (this->path == "-") {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        file = stdout;
+    } else {
+        file = std::fopen(path, "wb");
+        if (file == nullptr) {
+            SDL_Log("Could not create %s: %s", path, std::strerror(errno));
+            return false;
+        }
+    }
+    return true;
+}
+
+void FrameWriter::close() {
+    if (file != nullptr && file != stdout)
+        std::fclose(file);
+    else if (file == stdout)
+        std::fflush(stdout);
+    file = nullptr;
+}
+
+bool FrameWriter::write(const Framebuffer& framebuffer) {
+    if (!isPerFrame) {
+        if (file == nullptr || !writeFrame(file, framebuffer)) {
+            SDL_Log("Could not write frame %d to %s.", frameCount, path.c_str());
+            return false;
+        }
+        ++frameCount;
+        return true;
+    }
+
+    const std::string fileName = prefix + std::to_string(frameCount) + suffix;
+    FILE* out = std::fopen(fileName.c_str(), "wb");
+    if (out == nullptr) {
+        SDL_Log("Could not create %s: %s", fileName.c_str(), std::strerror(errno));
+        return false;
+    }
+    bool ok = writeFrame(out, framebuffer);
+    ok = std::fclose(out) == 0 && ok;
+    if (!ok) {
+        SDL_Log("Could not write %s.", fileName.c_str());
+        return false;
+    }
+    ++frameCount;
+    return true;
+}
+
+bool FrameWriter::writeFrame(FILE* out, const Framebuffer& framebuffer) {
+    if (isPpm && std::fprintf(out, "P6\n%d %d\n255\n", framebuffer.width, framebuffer.height) < 0)
+        return false;
+
+    row.resize(framebuffer.width * 3);
+    for (int y = 0; y < framebuffer.height; ++y) {
+        const uint8_t* line = framebuffer.pixels + y * framebuffer.pitch;
+        uint8_t* rgb = row.data();
+        for (int x = 0; x < framebuffer.width; ++x, rgb += 3) {
+            if (framebuffer.format == SDL_PIXELFORMAT_RGB565) {
+                uint16_t pixel;
+                std::memcpy(&pixel, line + x * 2, 2);
+                rgb[0] = static_cast<uint8_t>(((pixel >> 11) << 3) | (pixel >> 13));
+                rgb[1] = static_cast<uint8_t>((((pixel >> 5) & 0x3F) << 2) | ((pixel >> 9) & 0x03));
+                rgb[2] = static_cast<uint8_t>(((pixel & 0x1F) << 3) | ((pixel >> 2) & 0x07));
+                continue;
+            }
+
+            uint32_t pixel;
+            std::memcpy(&pixel, line + x * 4, 4);
+            if (framebuffer.format == SDL_PIXELFORMAT_ABGR8888 || framebuffer.format == SDL_PIXELFORMAT_BGR888)
+                pixel = ((pixel & 0xFF) << 16) | (pixel & 0xFF00) | ((pixel >> 16) & 0xFF);
+            rgb[0] = static_cast<uint8_t>(pixel >> 16);
+            rgb[1] = static_cast<uint8_t>(pixel >> 8);
+            rgb[2] = static_cast<uint8_t>(pixel);
+        }
+        if (std::fwrite(row.data(), 1, row.size(), out) != row.size())
+            return false;
+    }
+    return true;
+}
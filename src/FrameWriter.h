@@ -0,0 +1,43 @@
+#ifndef FRAMEWRITER_H_
+#define FRAMEWRITER_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "SoftwareScreen.h"
+
+// Saves rendered frames so they can be compared or encoded without a display. The path decides the format:
+//  - containing %d, each frame is a binary PPM file numbered from 0, the number replacing the first %d;
+//  - ending in .ppm, every frame is appended to that one file, which netpbm tools read as a sequence of images;
+//  - anything else gets raw 8 bit RGB, what encoders take with e.g. ffmpeg -f rawvideo -pix_fmt rgb24. Use - for
+//    stdout.
+class FrameWriter {
+protected:
+    std::string path;
+    FILE* file = nullptr;
+    bool isPerFrame = false;
+    // Either side of the %d when isPerFrame.
+    std::string prefix;
+    std::string suffix;
+    bool isPpm = false;
+    int frameCount = 0;
+    std::vector<uint8_t> row;
+
+    bool writeFrame(FILE* out, const Framebuffer& framebuffer);
+
+public:
+    ~FrameWriter();
+
+    bool open(const char* path);
+    void close();
+
+    // Write the framebuffer as the next frame. Returns false, having logged why, if it couldn't be written.
+    bool write(const Framebuffer& framebuffer);
+
+    int getFrameCount() const {
+        return frameCount;
+    }
+};
+
+#endif  // FRAMEWRITER_H_
@@ -1,19 +1,18 @@
 #ifndef GAMESOUNDS_H_
 #define GAMESOUNDS_H_
 
+#include <cstdio>
+
 
 class GameSounds {
 private:
     struct WavBuffer {
         Uint8* buffer = nullptr;
         Uint32 length = 0;
+        SDL_AudioSpec spec;
 
         bool loadWav(const char* fileName);
 
-        void play(SDL_AudioDeviceID id) {
-            SDL_QueueAudio(id, buffer, length);
-        }
-
         ~WavBuffer() {
             if (buffer != nullptr)
                 SDL_FreeWAV(buffer);
@@ -27,31 +26,65 @@ private:
     WavBuffer dropBuffer;
     SDL_AudioDeviceID audioDeviceID = 0;
 
+    // Set instead of an audio device when the beeps are written to a WAV file. Like the device's queue, each beep
+    // starts once the one before has finished, but never before the sample its tick falls on.
+    FILE* wavFile = nullptr;
+    Uint32 wavTick = 0;
+    uint64_t wavSamples = 0;
+
+    bool loadBuffers();
+    void writeSilence(uint64_t samples);
+
+    void play(const WavBuffer& wav) {
+        if (wavFile != nullptr)
+            writeWav(wav);
+        else
+            SDL_QueueAudio(audioDeviceID, wav.buffer, wav.length);
+    }
+
+    void writeWav(const WavBuffer& wav);
+
 public:
+    // A WAV file's sizes are 32 bit, which at 44.1kHz 16 bit mono holds a little over 13.5 hours.
+    static constexpr int MAX_WAV_SECONDS = 13 * 60 * 60;
+
     GameSounds() = default;
 
     ~GameSounds();
 
     bool init();
 
+    // Write the beeps to the WAV file path rather than playing them, tick 0 being its first sample. Returns false,
+    // having logged why, if the file can't be written.
+    bool openWav(const char* path);
+
+    // The tick the beeps played next are due at, when writing a WAV file.
+    void setTick(Uint32 tick) {
+        wavTick = tick;
+    }
+
+    // Pad the WAV file with silence to endTick and finish it. Returns false, having logged why, if it couldn't be
+    // written.
+    bool closeWav(Uint32 endTick);
+
     void playInnerBeep() {
-        innerBuffer.play(audioDeviceID);
+        play(innerBuffer);
     }
 
     void playMidBeep() {
-        midBuffer.play(audioDeviceID);
+        play(midBuffer);
     }
 
     void playOuterBeep() {
-        outerBuffer.play(audioDeviceID);
+        play(outerBuffer);
     }
 
     void playDropBeep() {
-        dropBuffer.play(audioDeviceID);
+        play(dropBuffer);
     }
 
     void playCatchBeep() {
-        catchBuffer.play(audioDeviceID);
+        play(catchBuffer);
     }
 };
 
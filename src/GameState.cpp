@@ -1,25 +1,19 @@
 #include <SDL.h>
 #include <algorithm>
-#include <ctime>
 
+#include "DisplayState.h"
 #include "GameState.h"
 #include "LcdElement.h"
 #include "GameSounds.h"
 
 namespace {
-    // see https://en.wikipedia.org/wiki/Seven-segment_display
-    const uint8_t digitToSegments[] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F };
-
-    const uint32_t gameDelays[] = {
-        393, 336, 254, 243, 231, 226, 214, 203, 192, 180, 169, 157, 146, 134,
-            124, 112, 100, 89
-    };
+    // How often the timer looks for boards whose balls are due to move when none are due sooner, so a game started
+    // while the timer is waiting doesn't wait long for its first move.
+    const Uint32 SCHEDULER_INTERVAL = 10;
 }
 
-GameState::GameState() {
-    willDropInner = false;
-    willDropMid = false;
-    willDropOuter = false;
+GameState::GameState() :
+    boards(1) {
     mutex = SDL_CreateMutex();
     timerID = 0;
     gpioTimerID = 0;
@@ -33,245 +27,237 @@ GameState::~GameState() {
     SDL_DestroyMutex(mutex);
 }
 
-void GameState::renderDigit(SDL_Renderer* renderer, size_t outlineID, size_t digit) {
-    uint8_t mask = digitToSegments[digit % 10];
-    while (mask != 0) {
-        if ((mask & 1) != 0)
-            textures[outlineID].render(renderer);
-        mask >>= 1;
-        outlineID++;
+size_t GameState::getPriorityOrder(size_t* order) {
+    bool isVisible[Outlines::COUNT];
+    for (size_t i = 0; i < Outlines::COUNT; ++i)
+        isVisible[i] = !boards[focusedBoard].isInTimeMode() || Board::isShownInTimeMode(i);
+
+    size_t count = 0;
+    for (size_t i = 0; i < Outlines::COUNT; ++i) {
+        if (isVisible[i])
+            order[count++] = i;
+    }
+    size_t visibleCount = count;
+    for (size_t i = 0; i < Outlines::COUNT; ++i) {
+        if (!isVisible[i])
+            order[count++] = i;
     }
+    return visibleCount;
 }
 
- void GameState::createTextures(SDL_Renderer* renderer, int screenW, int screenH, int subSamples) {
-    Worker worker;
-    worker.game = this;
-    worker.elementParameters.bounds.computeBounds(screenW, screenH);
-    worker.elementParameters.onColour = onColour;
-    worker.elementParameters.offColour = offColour;
-
-    worker.elementParameters.subSamples = subSamples;
-    worker.renderer = renderer;
-    SDL_AtomicSet(&worker.textureIndex, 0);
-    SDL_Thread* threads[8];
-    size_t numberOfThreads = std::min(SDL_GetCPUCount(), 8);
-    SDL_Log("Using %d  threads.", numberOfThreads);
-    for (size_t i = 0; i < numberOfThreads; ++i) threads[i] = SDL_CreateThread(Worker::start, "textures", &worker);
-    for (size_t i = 0; i < numberOfThreads; ++i) SDL_WaitThread(threads[i], nullptr);
-    for (size_t i = 0; i < Outlines::COUNT; ++i) textures[i].createTexture(renderer);
-    textures[Outlines::FRAME].setBlendMode(SDL_BLENDMODE_NONE);
-    gameSounds.init();
-
-#ifdef HAS_WIRING_PI
-    rpiGpio.init();
-    gpioTimerID = SDL_AddTimer(1, staticGpioTimerCallback, this);
-#endif
+ElementParameters GameState::getElementParameters(int width, int height, size_t boardCount) {
+    // The images are for one board's share of the screen.
+    std::vector<SDL_Rect> cells;
+    Board::layout(width, height, boardCount, outlinePack, cells);
+    ElementParameters elementParameters;
+    elementParameters.bounds.computeBounds(cells[0].w, cells[0].h, outlinePack);
+    elementParameters.onColour = onColour;
+    elementParameters.offColour = offColour;
+    elementParameters.subSamples = subSamples;
+    elementParameters.sparseSamples = sparseSamples;
+    elementParameters.useDistanceFields = useDistanceFields;
+    elementParameters.skin = skin;
+    if (screen != nullptr && screen->usesElementImages()) {
+        elementParameters.pixelFormat = screen->choosePixelFormat(false);
+        elementParameters.opaquePixelFormat = screen->choosePixelFormat(true);
+    }
+    return elementParameters;
 }
 
-void GameState::renderFrameAndJuggler(SDL_Renderer* renderer) {
-    SDL_SetRenderDrawColor(renderer, onColour & 0xFF, (onColour >> 8) & 0xFF, (onColour >> 16) & 0xFF,
-        SDL_ALPHA_OPAQUE);
-    SDL_RenderClear(renderer);
-
-    textures[Outlines::FRAME].renderWithInset(renderer, 1);
-    textures[Outlines::BODY].render(renderer);
-    textures[Outlines::LEFT_ARM].render(renderer);
-    textures[Outlines::RIGHT_ARM].render(renderer);
-    switch (armPosition % 3) {
-    case 0:
-        textures[Outlines::LEFT_LEG_DOWN].render(renderer);
-        textures[Outlines::RIGHT_LEG_UP].render(renderer);
-        textures[Outlines::LEFT_ARM_OUTER].render(renderer);
-        textures[Outlines::RIGHT_ARM_INNER].render(renderer);
-        break;
-    case 1:
-        textures[Outlines::LEFT_LEG_DOWN].render(renderer);
-        textures[Outlines::RIGHT_LEG_DOWN].render(renderer);
-        textures[Outlines::LEFT_ARM_MID].render(renderer);
-        textures[Outlines::RIGHT_ARM_MID].render(renderer);
-        break;
-    case 2:
-        textures[Outlines::LEFT_LEG_UP].render(renderer);
-        textures[Outlines::RIGHT_LEG_DOWN].render(renderer);
-        textures[Outlines::LEFT_ARM_INNER].render(renderer);
-        textures[Outlines::RIGHT_ARM_OUTER].render(renderer);
-        break;
+void GameState::createTextures(Screen& screen, int screenW, int screenH, int subSamples, bool progressive) {
+    this->screen = &screen;
+    this->subSamples = subSamples;
+    screenWidth = imageWidth = screenW;
+    screenHeight = imageHeight = screenH;
+    Board::layout(imageWidth, imageHeight, boards.size(), outlinePack, viewports);
+    ElementParameters elementParameters = getElementParameters(screenW, screenH, boards.size());
+
+    if (!screen.usesElementImages()) {
+        // The screen rasterises the outlines as it draws, so there's nothing to build and nothing to refine.
+        screen.setElementParameters(elementParameters);
+    } else {
+        startTextures(textureBuilder, screen, elementParameters, progressive);
+        elementsChanged = true;
     }
+    startTimers();
+}
 
-    if (crashedLeft) {
-        textures[Outlines::LEFT_SPLAT].render(renderer);
-        textures[Outlines::LEFT_CRUSH].render(renderer);
+void GameState::startTextures(TextureBuilder& textureBuilder, Screen& screen, ElementParameters elementParameters,
+    bool progressive) {
+    elementParameters.subSamples = progressive ? 1 : subSamples;
+    SDL_Log("Using %s textures (%s for the frame).", SDL_GetPixelFormatName(elementParameters.pixelFormat),
+        SDL_GetPixelFormatName(elementParameters.opaquePixelFormat));
+
+    size_t order[Outlines::COUNT];
+    size_t visibleCount = getPriorityOrder(order);
+
+    // Only wait for what the current mode shows, the rest are rasterised in the background and run() uploads them
+    // between frames.
+    textureBuilder.start(elementParameters, order);
+    textureBuilder.waitFor(screen, visibleCount);
+
+    if (progressive && subSamples > 1) {
+        // Replace the low quality textures in the same order, any elements not rasterised yet go straight to full
+        // quality.
+        elementParameters.subSamples = subSamples;
+        textureBuilder.start(elementParameters, order);
     }
+}
 
-    if (crashedRight) {
-        textures[Outlines::RIGHT_SPLAT].render(renderer);
-        textures[Outlines::RIGHT_CRUSH].render(renderer);
+bool GameState::createOutputs(const std::vector<SDL_Rect>& placements, Uint32 windowFlags,
+    const Output::ScreenFactory& createScreen, bool split, int subSamples, bool progressive) {
+    this->subSamples = subSamples;
+    if (split && boards.size() < placements.size())
+        boards.resize(placements.size());
+
+    for (size_t i = 0; i < placements.size(); ++i) {
+        std::vector<size_t> shown;
+        for (size_t board = split ? i : 0; board < boards.size(); board += split ? placements.size() : 1)
+            shown.push_back(board);
+        outputs.push_back(std::make_unique<Output>(placements[i], windowFlags, shown, outlinePack));
+        Output& output = *outputs.back();
+        if (!output.start(createScreen, getElementParameters(output.getWidth(), output.getHeight(), shown.size()),
+                skin))
+            return false;
     }
 
-}
-
-void GameState::renderScore(SDL_Renderer* renderer, uint32_t score) {
-    renderDigit(renderer, Outlines::UNIT_A, score);
-    if (score >= 10) {
-        renderDigit(renderer, Outlines::TENS_A, score / 10);
-        if (score >= 100) {
-            renderDigit(renderer, Outlines::HUND_A, score / 100);
-            if (score >= 1000) {
-                renderDigit(renderer, Outlines::THOU_A, score / 1000);
-            }
+    // Rasterising is the slow part, so it's only done once for each size and format of image.
+    for (auto& output : outputs) {
+        if (!output->usesElementImages())
+            continue;
+        ElementParameters elementParameters =
+            getElementParameters(output->getWidth(), output->getHeight(), output->getBoardCount());
+        elementParameters.pixelFormat = output->choosePixelFormat(false);
+        elementParameters.opaquePixelFormat = output->choosePixelFormat(true);
+        bool isAdded = false;
+        for (auto& group : outputGroups) {
+            isAdded = group->add(output.get(), elementParameters);
+            if (isAdded)
+                break;
         }
+        if (!isAdded)
+            outputGroups.push_back(std::make_unique<OutputGroup>(output.get(), elementParameters));
     }
-}
+    SDL_Log("Drawing on %d windows with %d sets of images.", static_cast<int>(outputs.size()),
+        static_cast<int>(outputGroups.size()));
 
-void GameState::renderTime(SDL_Renderer* renderer) {
-    Uint32 currentTicks = SDL_GetTicks() - timeModeStartedTick;
-    Uint32 gamePos = ((11 + currentTicks / 1000) % 22);
-    if (gamePos < 2 || gamePos > 19)
-        armPosition = 2;
-    else if (gamePos >= 9 && gamePos <= 12)
-        armPosition = 0;
-    else
-        armPosition = 1;
-
-    renderFrameAndJuggler(renderer);
-
-    int ballPos = gamePos;
-    if (ballPos >= 12)
-        ballPos = 22 - ballPos;
-    textures[Outlines::OUTER0 + ballPos].render(renderer);
-
-    std::time_t currentTime;
-    std::time(&currentTime);
-    auto localTime = std::localtime(&currentTime);
-    int hour = (localTime->tm_hour % 12);
-    if (hour == 0)
-        hour = 12;
-    renderScore(renderer, hour * 100 + localTime->tm_min);
+    for (auto& group : outputGroups) {
+        startTextures(group->textureBuilder, *group, group->elementParameters, progressive);
+        group->elementsChanged = true;
+    }
+    startTimers();
+    return true;
 }
 
-
-void GameState::renderGameA(SDL_Renderer* renderer) {
-    renderFrameAndJuggler(renderer);
-    if (outerBallPos >= 0 && outerBallPos < 12)
-        textures[Outlines::OUTER0 + outerBallPos].render(renderer);
-    else if (outerBallPos >= 12 && outerBallPos < 22)
-        textures[Outlines::OUTER0 + 22 - outerBallPos].render(renderer);
-
-    if (midBallPos >= 0 && midBallPos < 10)
-        textures[Outlines::MID0 + midBallPos].render(renderer);
-    else if (midBallPos >= 10 && midBallPos < 18)
-        textures[Outlines::MID0 + 18 - midBallPos].render(renderer);
-
-    if (innerBallPos >= 0 && innerBallPos < 8)
-        textures[Outlines::INNER0 + innerBallPos].render(renderer);
-    else if (innerBallPos >= 8  && innerBallPos < 14)
-        textures[Outlines::INNER0 + 14 - innerBallPos].render(renderer);
-
-    renderScore(renderer, score);
+void GameState::setReplay(const InputLog* replay, double speed) {
+    this->replay = replay;
+    isReplaying = true;
+    replaySpeed = speed;
+    replayTick = 0;
+    boards.resize(replay->getBoardCount());
+    for (size_t i = 0; i < boards.size(); ++i) boards[i].load(0, &replay->boardValues[i * Board::SAVED_VALUES]);
+    focusedBoard = replay->focusedBoard;
 }
 
+void GameState::startTimers() {
+    gameSounds.init();
+    if (isReplaying) {
+        // The replay moves the balls itself, on its own clock.
+        startReplay();
+    } else {
+        timerID = SDL_AddTimer(1, staticTimerCallback, this);
+    }
 
-void GameState::renderGameB(SDL_Renderer* renderer) {
-    renderGameA(renderer);
+#ifdef HAS_WIRING_PI
+    rpiGpio.init();
+    gpioTimerID = SDL_AddTimer(1, staticGpioTimerCallback, this);
+#endif
 }
 
-
-bool GameState::moveBall(int& currentPosition, int maxPosition, bool& willDropFlag, int catchRightPosition) {
-    currentPosition = (currentPosition + 1) % maxPosition;
-    if (currentPosition == maxPosition / 2) {
-        willDropFlag = armPosition != (2 - catchRightPosition);
-        if (!willDropFlag)
-            catches++;
-    }
-    else if (currentPosition == 0) {
-        willDropFlag = armPosition != catchRightPosition;
-        if (!willDropFlag)
-            catches++;
-    }
-    else if (gamePosition > 3)
-    {
-        if (currentPosition == 1 || currentPosition == (maxPosition / 2) + 1) {
-            if (willDropFlag) {
-                crashedRight = currentPosition == 1;
-                crashedLeft = currentPosition != 1;
-                currentPosition = -1;
-                return false;
-            }
-        }
+void GameState::resize(int width, int height) {
+    if (width == screenWidth && height == screenHeight)
+        return;
+    screenWidth = width;
+    screenHeight = height;
+    if (!screen->usesElementImages()) {
+        // Only the outlines have to be flattened again, which is quick.
+        imageWidth = width;
+        imageHeight = height;
+        Board::layout(imageWidth, imageHeight, boards.size(), outlinePack, viewports);
+        screen->resize(width, height, width, height);
+        screen->setElementParameters(getElementParameters(width, height, boards.size()));
+    } else {
+        screen->resize(width, height, imageWidth, imageHeight);
     }
-    return true;
 }
 
+void GameState::updateImageSize() {
+    if (buildWidth != 0 && textureBuilder.isRasterised()) {
+        // The next upload replaces every image.
+        imageWidth = buildWidth;
+        imageHeight = buildHeight;
+        buildWidth = 0;
+        buildHeight = 0;
+        Board::layout(imageWidth, imageHeight, boards.size(), outlinePack, viewports);
+        screen->resize(screenWidth, screenHeight, imageWidth, imageHeight);
+    }
 
- 
-Uint32 GameState::timerCallback() {
-    SDL_LockMutex(mutex);
-    int ballIndex;
-    if (currentMode == Mode::GAME_A)
-        ballIndex = 1 + gamePosition % 2;
-    else
-        ballIndex = gamePosition % 3;
-
-    bool playCatch = catches > 0;
-
-    switch (ballIndex) {
-        case 0:
-            if (moveBall(innerBallPos, 14, willDropInner, 0))
-                gameSounds.playInnerBeep();
-            break;
-        case 1:
-            if (moveBall(midBallPos, 18, willDropMid, 1))
-                gameSounds.playMidBeep();
-            break;
-        case 2:
-            if (moveBall(outerBallPos, 22, willDropOuter, 2))
-                gameSounds.playOuterBeep();
-            break;
+    // Cancelling a build would wait for the elements being rasterised, so any build in progress is left to finish
+    // first. The images for the screen's size at that point are rasterised at full quality.
+    if (buildWidth == 0 && (screenWidth != imageWidth || screenHeight != imageHeight) && textureBuilder.isComplete()) {
+        size_t order[Outlines::COUNT];
+        getPriorityOrder(order);
+        buildWidth = screenWidth;
+        buildHeight = screenHeight;
+        SDL_Log("Rasterising the elements for %dx%d.", buildWidth, buildHeight);
+        textureBuilder.start(getElementParameters(buildWidth, buildHeight, boards.size()), order, true);
     }
+}
 
-    if (isShowingCrashed())
-        gameSounds.playDropBeep();
-    else if (playCatch) {
-        score += currentMode == Mode::GAME_A ? 1 : 10;
-        score %= 10000;
-        gameSounds.playCatchBeep();
-        catches--;
+int GameState::boardAt(Uint32 windowID, int x, int y) {
+    for (auto& output : outputs) {
+        if (SDL_GetWindowID(output->getWindow()) == windowID && output->boardAt(x, y) >= 0)
+            return output->boardAt(x, y);
+    }
+    if (!outputs.empty())
+        return -1;
+
+    // The viewports are for the images' size of screen, which is stretched to the actual size.
+    const SDL_Point point = { x * imageWidth / screenWidth, y * imageHeight / screenHeight };
+    for (size_t i = 0; i < viewports.size(); ++i) {
+        if (SDL_PointInRect(&point, &viewports[i]))
+            return static_cast<int>(i);
     }
-    gamePosition++;
+    return -1;
+}
 
+Uint32 GameState::updateBoards(Uint32 now) {
+    // A replay faster than real time would only queue up the beeps, unless they're going to a file.
+    const bool hasSound = isWritingSounds || !isReplaying || replaySpeed == 1.0;
+    if (isWritingSounds)
+        gameSounds.setTick(now);
     Uint32 nextDelay = 0;
-    if (!isShowingCrashed()) {
-        if (currentMode == Mode::GAME_A)
-        {
-            if (score < 5)
-                nextDelay = gameDelays[0];
-            else if (score < 10)
-                nextDelay = gameDelays[1];
-            else if (score < 20)
-                nextDelay = gameDelays[3];
-            else {
-                int hundreds = score / 100;
-                int  tens = (score / 10) % 10;
-                size_t index = std::min(17, 2 + tens + (hundreds >= 4 ? 12 : hundreds * 2));
-                nextDelay = gameDelays[index];
-            }
-        }
-        else {
-            int thousands = score / 1000;
-            int hundreds = (score / 100) % 10;
-            int index = std::min(17, 2 + hundreds + (thousands >= 4 ? 12 : thousands * 2));
-            nextDelay = gameDelays[index];
-        }
-    }
-    else {
-        if (currentMode == Mode::GAME_A)
-            gameAHiScore = std::max(gameAHiScore, score);
-        else
-            gameBHiScore = std::max(gameBHiScore, score);
+    for (size_t i = 0; i < boards.size(); ++i) {
+        Uint32 delay = boards[i].update(now, hasSound && i == focusedBoard ? &gameSounds : nullptr);
+        if (delay != 0)
+            nextDelay = nextDelay == 0 ? delay : std::min(nextDelay, delay);
     }
+    return nextDelay;
+}
 
+void GameState::getStates(std::vector<DisplayState>& states) {
+    const Uint32 now = getTicks();
+    const std::time_t time = getTime();
+    states.resize(boards.size());
+    for (size_t i = 0; i < boards.size(); ++i) states[i] = boards[i].getDisplayState(now, time);
+}
+
+Uint32 GameState::timerCallback() {
+    SDL_LockMutex(mutex);
+    Uint32 delay = updateBoards(SDL_GetTicks());
+    publishStates();
     SDL_UnlockMutex(mutex);
-    return nextDelay;
+    return delay == 0 ? SCHEDULER_INTERVAL : std::min(SCHEDULER_INTERVAL, delay);
 }
 
 Uint32 GameState::staticTimerCallback(Uint32 interval, void* param) {
@@ -283,153 +269,308 @@ Uint32 GameState::staticGpioTimerCallback(Uint32 interval, void* param) {
     return 1;
 }
 
-void GameState::resetGameState() {
-    score = 0;
-    catches = 0;
-    outerBallPos = 11;
-    midBallPos = 0;
-    innerBallPos = 7;
-    gamePosition = 0;
-    willDropInner = false;
-    willDropMid = false;
-    willDropOuter = false;
-    crashedLeft = false;
-    crashedRight = false;
-}
+bool GameState::handleInput(const SDL_Event& event) {
+    if (isReplaying) {
+        // Only quitting is left to the player, anything else would change what's replayed.
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_x)
+            quitting = true;
+        return event.type == SDL_KEYDOWN || event.type == SDL_KEYUP || event.type == SDL_MOUSEBUTTONDOWN;
+    }
 
+    if (event.type == SDL_KEYDOWN) {
+        switch (event.key.keysym.sym) {
+        case SDLK_x:
+            perform(InputLog::Action::QUIT);
+            break;
+        case SDLK_q:
+            perform(InputLog::Action::MOVE_ARMS_LEFT);
+            break;
+        case SDLK_p:
+            perform(InputLog::Action::MOVE_ARMS_RIGHT);
+            break;
+        case SDLK_a:
+            perform(InputLog::Action::START_GAME_A_HI_SCORE);
+            break;
+        case SDLK_b:
+            perform(InputLog::Action::START_GAME_B_HI_SCORE);
+            break;
+        case SDLK_t:
+            perform(InputLog::Action::START_TIME_MODE);
+            break;
+        case SDLK_TAB:
+            // Shift+Tab goes back a board.
+            if ((event.key.keysym.mod & KMOD_SHIFT) != 0)
+                perform(InputLog::Action::FOCUS_BOARD, (focusedBoard + boards.size() - 1) % boards.size());
+            else
+                perform(InputLog::Action::FOCUS_BOARD, (focusedBoard + 1) % boards.size());
+            break;
+        }
+    }
+    else if (event.type == SDL_KEYUP) {
+        switch (event.key.keysym.sym) {
+        case SDLK_a:
+            perform(InputLog::Action::START_GAME_A);
+            break;
+        case SDLK_b:
+            perform(InputLog::Action::START_GAME_B);
+            break;
+        }
+    }
+    else if (event.type == SDL_MOUSEBUTTONDOWN) {
+        const int board = boardAt(event.button.windowID, event.button.x, event.button.y);
+        if (board >= 0 && static_cast<size_t>(board) != focusedBoard)
+            perform(InputLog::Action::FOCUS_BOARD, board);
+    }
+    else {
+        return false;
+    }
+    return true;
+}
 
-void GameState::startGameA() {
-    if (!isRunningGame()) {
-        resetGameState();
-        currentMode = Mode::GAME_A;
-        innerBallPos = -1;
-        timerID = SDL_AddTimer(1, staticTimerCallback, this);
+void GameState::perform(InputLog::Action action, uint32_t board) {
+    // The moves due are made first, as they are when replaying, so the timer being late doesn't change the game.
+    const Uint32 now = getTicks();
+    updateBoards(now);
+    recording.record(now, action, board);
 
+    Board& focused = boards[focusedBoard];
+    switch (action) {
+    case InputLog::Action::MOVE_ARMS_LEFT:
+        focused.moveArmsLeft();
+        break;
+    case InputLog::Action::MOVE_ARMS_RIGHT:
+        focused.moveArmsRight();
+        break;
+    case InputLog::Action::START_GAME_A_HI_SCORE:
+        focused.startGameAHiScore(now);
+        break;
+    case InputLog::Action::START_GAME_A:
+        focused.startGameA(now);
+        break;
+    case InputLog::Action::START_GAME_B_HI_SCORE:
+        focused.startGameBHiScore(now);
+        break;
+    case InputLog::Action::START_GAME_B:
+        focused.startGameB(now);
+        break;
+    case InputLog::Action::START_TIME_MODE:
+        focused.startTimeMode(now);
+        break;
+    case InputLog::Action::FOCUS_BOARD:
+        focusedBoard = board;
+        break;
+    case InputLog::Action::QUIT:
+        quitting = true;
+        break;
     }
+    publishStates();
 }
 
-void GameState::startGameAHiScore() {
-    if (!isRunningGame()) {
-        resetGameState();
-        currentMode = Mode::GAME_A_HI_SCORE;
-        innerBallPos = -1;
-        score = gameAHiScore;
-    }
+void GameState::startReplay() {
+    replayStartedTick = SDL_GetTicks();
+    const Uint32 delay = updateBoards(replayTick);
+    isReplayMoving = delay != 0;
+    replayMoveTick = replayTick + delay;
 }
 
-void GameState::startGameB() {
-    if (!isRunningGame()) {
-        resetGameState();
-        currentMode = Mode::GAME_B;
-        timerID = SDL_AddTimer(1, staticTimerCallback, this);
+void GameState::advanceReplay() {
+    const Uint32 target = replaySpeed > 0.0 ?
+        static_cast<Uint32>((SDL_GetTicks() - replayStartedTick) * replaySpeed) : UINT32_MAX;
+    bool hasStepped = false;
+    while (!quitting && !(replaySpeed == 0.0 && hasStepped)) {
+        // A recording cut short ends with its last input.
+        if (replayNext == replay->events.size()) {
+            quitting = true;
+            break;
+        }
+
+        // Step to whichever comes first, the next move or the next input. Performing an input makes the moves due
+        // before it.
+        Uint32 next = replay->events[replayNext].tick;
+        if (isReplayMoving)
+            next = std::min(next, replayMoveTick);
+        if (next > target)
+            break;
+        replayTick = next;
+        while (replayNext < replay->events.size() && replay->events[replayNext].tick == replayTick) {
+            perform(replay->events[replayNext].action, replay->events[replayNext].board);
+            ++replayNext;
+        }
+        const Uint32 delay = updateBoards(replayTick);
+        isReplayMoving = delay != 0;
+        replayMoveTick = replayTick + delay;
+        if (isAutoplaying)
+            autoplay();
+        publishStates();
+        hasStepped = true;
     }
-}
 
-void GameState::startGameBHiScore() {
-    if (!isRunningGame()) {
-        resetGameState();
-        currentMode = Mode::GAME_B_HI_SCORE;
-        score = gameBHiScore;
+    if (quitting) {
+        SDL_Log("Replayed %.1fs of play in %.1fs, drawing %d frames.", replayTick / 1000.0,
+            (SDL_GetTicks() - replayStartedTick) / 1000.0, framesDrawn);
+    } else if (replaySpeed > 0.0) {
+        replayTick = target;
     }
 }
 
-void GameState::startTimeMode() {
-    if (isShowingCrashed()) {
-        gamePosition = 0;
-        crashedLeft = false;
-        crashedRight = false;
-        timeModeStartedTick = SDL_GetTicks();
-        currentMode = Mode::TIME;
+void GameState::autoplay() {
+    const Board& board = boards[focusedBoard];
+    const int target = board.getSavingArmPosition();
+    while (target >= 0 && board.getArmPosition() != static_cast<uint32_t>(target)) {
+        perform(board.getArmPosition() < static_cast<uint32_t>(target) ? InputLog::Action::MOVE_ARMS_RIGHT :
+            InputLog::Action::MOVE_ARMS_LEFT);
     }
 }
 
-void GameState::setArmPosition(uint32_t newArmPosition) {
-    if (newArmPosition != armPosition && newArmPosition >= 0 && newArmPosition <= 2) {
-        armPosition = newArmPosition;
-        if (willDropMid && armPosition == 1) {
-            willDropMid = false;
-            catches++;
-        }
-        if (willDropOuter && ((armPosition == 2 && outerBallPos == 0) || (armPosition == 0 && outerBallPos == 11))) {
-            willDropOuter = false;
-            catches++;
-        }
-        if (willDropInner && ((armPosition == 0 && innerBallPos == 0) || (armPosition == 2 && innerBallPos == 7))) {
-            willDropInner = false;
-            catches++;
+bool GameState::writeSounds(const char* path) {
+    if (!gameSounds.openWav(path))
+        return false;
+    isWritingSounds = true;
+    replaySpeed = 0.0;
+    SDL_LockMutex(mutex);
+    startReplay();
+    while (!quitting) advanceReplay();
+    SDL_UnlockMutex(mutex);
+    return gameSounds.closeWav(replayTick);
+}
+
+bool GameState::drawReplay(const std::function<bool(const std::vector<DisplayState>& states)>& drawFrame) {
+    replaySpeed = 0.0;
+    SDL_LockMutex(mutex);
+    startReplay();
+    getStates(states);
+    bool ok = drawFrame(states);
+    lastStates = states;
+    ++framesDrawn;
+    while (ok && !quitting) {
+        advanceReplay();
+        // Reaching the end is a step with nothing new to draw, unless the last input changed something too.
+        getStates(states);
+        if (!quitting || states != lastStates) {
+            ok = drawFrame(states);
+            lastStates = states;
+            ++framesDrawn;
         }
     }
+    SDL_UnlockMutex(mutex);
+    return ok;
 }
 
-void GameState::moveArmsRight() {
-    if (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B)
-        setArmPosition(armPosition + 1);
+void GameState::publishStates() {
+    if (publisher == nullptr)
+        return;
+    getStates(publisherStates);
+    publisher->publish(boards, publisherStates, focusedBoard);
 }
 
-void GameState::moveArmsLeft() {
-    if (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B)
-        setArmPosition(armPosition - 1);
-}
+void GameState::run() {
+    if (!outputs.empty()) {
+        runOutputs();
+        return;
+    }
 
-void GameState::run(SDL_Renderer* renderer) {
     while (true) {
 
         SDL_Event event;
         SDL_LockMutex(mutex);
-        while (SDL_PollEvent(&event) != 0) {
-            if (event.type == SDL_KEYDOWN) {
-                switch (event.key.keysym.sym) {
-                case SDLK_x:
-                    SDL_UnlockMutex(mutex);
-                    return;
-                case SDLK_q:
-                    moveArmsLeft();
-                    break;
-                case SDLK_p:
-                    moveArmsRight();
-                    break;
-                case SDLK_a:
-                    startGameAHiScore();
-                    break;
-                case SDLK_b:
-                    startGameBHiScore();
-                    break;
-                case SDLK_t:
-                    startTimeMode();
-                    break;
-                }
-            }
-            else if (event.type == SDL_KEYUP) {
-                switch (event.key.keysym.sym) {
-                case SDLK_a:
-                    startGameA();
-                    break;
-                case SDLK_b:
-                    startGameB();
-                    break;
-                }
-            }
+        while (!quitting && SDL_PollEvent(&event) != 0) {
+            if (handleInput(event))
+                continue;
+            if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+                resize(event.window.data1, event.window.data2);
+            if (screen->handleEvent(event))
+                needsRedraw = true;
+        }
+        if (quitting) {
+            SDL_UnlockMutex(mutex);
+            return;
         }
 
-        switch (currentMode) {
-        case Mode::TIME:
-            renderTime(renderer);
-            break;
-        case Mode::GAME_A:
-        case Mode::GAME_A_HI_SCORE:
-            renderGameA(renderer);
-            break;
-        case Mode::GAME_B:
-        case Mode::GAME_B_HI_SCORE:
-            renderGameB(renderer);
-            break;
-        default:
-            break;
+        // A lost device takes the images with it, they're rasterised again for the size they were. Any build for a
+        // new size is abandoned, it's started again once these are ready.
+        if (screen->wereElementImagesLost()) {
+            size_t order[Outlines::COUNT];
+            getPriorityOrder(order);
+            buildWidth = 0;
+            buildHeight = 0;
+            SDL_Log("The element images were lost, rasterising them again.");
+            textureBuilder.start(getElementParameters(imageWidth, imageHeight, boards.size()), order);
+        }
+
+        updateImageSize();
+        if (textureBuilder.upload(*screen)) {
+            elementsChanged = true;
+            needsRedraw = true;
+        }
+        if (elementsChanged && textureBuilder.isComplete()) {
+            screen->elementsComplete();
+            elementsChanged = false;
+        }
+
+        if (isReplaying)
+            advanceReplay();
 
+        // Nothing needs drawing unless an element has changed, a texture has been replaced or the window needs
+        // repainting.
+        getStates(states);
+        if (states == lastStates && !needsRedraw) {
+            SDL_UnlockMutex(mutex);
+            SDL_Delay(1);
+            continue;
         }
+        if (boards.size() == 1)
+            screen->render(states[0]);
+        else
+            screen->renderBoards(states.data(), viewports.data(), states.size());
+        lastStates = states;
+        needsRedraw = false;
+        ++framesDrawn;
+
         SDL_UnlockMutex(mutex);
-        SDL_RenderPresent(renderer);
+        screen->present();
         SDL_Delay(0);
     }
 }
 
+void GameState::runOutputs() {
+    while (true) {
+        SDL_Event event;
+        SDL_LockMutex(mutex);
+        while (!quitting && SDL_PollEvent(&event) != 0) {
+            if (handleInput(event) || event.type != SDL_WINDOWEVENT)
+                continue;
+            for (auto& output : outputs) {
+                if (SDL_GetWindowID(output->getWindow()) == event.window.windowID)
+                    output->requestRedraw();
+            }
+        }
+        if (quitting) {
+            SDL_UnlockMutex(mutex);
+            break;
+        }
+
+        for (auto& group : outputGroups) {
+            if (group->textureBuilder.upload(*group))
+                group->elementsChanged = true;
+            if (group->elementsChanged && group->textureBuilder.isComplete()) {
+                group->elementsComplete();
+                group->elementsChanged = false;
+            }
+        }
+
+        if (isReplaying)
+            advanceReplay();
+        getStates(states);
+        if (states != lastStates) {
+            lastStates = states;
+            ++framesDrawn;
+        }
+        SDL_UnlockMutex(mutex);
+
+        // Publishing never waits for an output, however slow its display is to present.
+        for (auto& output : outputs) output->publish(states);
+        SDL_Delay(1);
+    }
+
+    for (auto& output : outputs) output->stop();
+}
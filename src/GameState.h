@@ -1,116 +1,237 @@
 #ifndef GAMESTATE_H_
 #define GAMESTATE_H_
-#include "LcdElement.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Board.h"
+#include "DisplayState.h"
 #include "GameSounds.h"
+#include "InputLog.h"
+#include "Output.h"
 #include "RpiGpio.h"
+#include "Screen.h"
+#include "StatePublisher.h"
+#include "TextureBuilder.h"
 
 class GameState {
 protected:
 
-    enum class Mode {
-        GAME_A, GAME_A_HI_SCORE, GAME_B, GAME_B_HI_SCORE, TIME, ACL
-    };
-
-    Mode currentMode = Mode::TIME;
-
-    uint32_t score = 0;
-
-    // Display the juggler figure such that the arms/legs are as follows
-    // armPos == 0 - right arm in inner track, left arm in outer track, .
-    // armPos == 1 - both arms in the mid track.
-    // armPos == 2 - right arm in outer track, left arm in inner track, .
-    uint32_t gamePosition = 0;
-    int outerBallPos = -1;
-    int midBallPos = -1;
-    int innerBallPos = -1;
-    uint32_t armPosition = 0;
-    bool willDropOuter;
-    bool willDropMid;
-    bool willDropInner;
-    bool crashedLeft = false;
-    bool crashedRight = false;
-    uint32_t catches;
-    uint32_t gameAHiScore = 0;
-    uint32_t gameBHiScore = 0;
-    uint32_t timeModeStartedTick = SDL_GetTicks();
+    // Every board is drawn from the same element images, and one timer moves the balls of all of them.
+    std::vector<Board> boards;
+    // The board the keys control. Only it makes any sound.
+    size_t focusedBoard = 0;
+
     SDL_mutex* mutex;
     SDL_TimerID timerID;
     SDL_TimerID gpioTimerID;
 
-    LcdElementTexture textures[Outlines::COUNT];
+    Screen* screen = nullptr;
+    TextureBuilder textureBuilder;
+    bool elementsChanged = false;
+
+    // What each board shows now and what was drawn last time, the screen is only redrawn when they differ or
+    // needsRedraw is set.
+    std::vector<DisplayState> states;
+    std::vector<DisplayState> lastStates;
+    bool needsRedraw = true;
+    // Where each board is drawn, in the pixels of the element images' screen size.
+    std::vector<SDL_Rect> viewports;
+    bool quitting = false;
+
+    // Set instead of screen when drawing on several windows, each from its own thread.
+    std::vector<std::unique_ptr<Output>> outputs;
+    std::vector<std::unique_ptr<OutputGroup>> outputGroups;
+
     GameSounds gameSounds;
     RpiGpio rpiGpio;
 
+    // Other processes' copy of the boards, and the states last given to it. Only used with the mutex held.
+    StatePublisher* publisher = nullptr;
+    std::vector<DisplayState> publisherStates;
+
+    // Every input acted on is written to recording if it's open. When replaying, the inputs come from replay instead
+    // of the player, at the ticks they were recorded at on a clock that runs replaySpeed times real time.
+    InputLog recording;
+    const InputLog* replay = nullptr;
+    bool isReplaying = false;
+    // 0 steps through the replay as fast as it can be drawn, a move or an input each frame.
+    double replaySpeed = 1.0;
+    // Milliseconds into the replay, which is what the boards' ticks count while replaying.
+    Uint32 replayTick = 0;
+    Uint32 replayStartedTick = 0;
+    size_t replayNext = 0;
+    // When the balls next move, if a game is being played.
+    bool isReplayMoving = false;
+    Uint32 replayMoveTick = 0;
+    int framesDrawn = 0;
+    // Moves the focused board's arms to catch every ball.
+    bool isAutoplaying = false;
+    // The beeps are written to a WAV file at the ticks they're due rather than played.
+    bool isWritingSounds = false;
+
     uint32_t offColour = 0x708080;
     uint32_t onColour = 0x424242;
+    bool sparseSamples = false;
+    bool useDistanceFields = false;
+    const OutlinePack* outlinePack = nullptr;
+    Skin* skin = nullptr;
+    int subSamples = 1;
 
-    struct Worker {
-        GameState* game;
-        ElementParameters elementParameters;
-        SDL_Renderer* renderer;
-        SDL_atomic_t textureIndex;
-
-        static int start(void* data) {
-            return reinterpret_cast<Worker*>(data)->run();
-        }
-
-        int run() {
-            for (;;) {
-                int i = SDL_AtomicAdd(&textureIndex, 1);
-                if (i >= Outlines::COUNT)
-                    return 0;
-                game->textures[i].createSurface(i, elementParameters);
-            }
-        }
-    };
-
-   
-
-    void renderDigit(SDL_Renderer* renderer, size_t outlineID, size_t digit);
-
-
-    void renderScore(SDL_Renderer* renderer, uint32_t score);
-    void renderTime(SDL_Renderer* renderer);
-    void renderGameA(SDL_Renderer* renderer);
-    void renderGameB(SDL_Renderer* renderer);
-    void startGameA();
-    void startGameAHiScore();
-    void startGameB();
-    void startGameBHiScore();
-    void startTimeMode();
-    void moveArmsLeft();
-    void moveArmsRight();
-    void setArmPosition(uint32_t armPosition);
-    void resetGameState();
-    Uint32 timerCallback();
-    static Uint32 staticTimerCallback(Uint32 interval, void* param);
-    static Uint32 staticGpioTimerCallback(Uint32 interval, void* param);
-    bool moveBall(int& currentPosition, int maxPosition, bool& willDropFlag, int catchRightPosition);
+    // The size of the screen and the size the element images were rasterised for. They differ after the screen is
+    // resized, until images for the new size have been rasterised in the background and swapped in.
+    int screenWidth = 0;
+    int screenHeight = 0;
+    int imageWidth = 0;
+    int imageHeight = 0;
+    // The size of the images being rasterised in the background, 0 if none are.
+    int buildWidth = 0;
+    int buildHeight = 0;
+
+
+    // Fill order with every outline ID, those visible in the focused board's mode first. Returns how many are visible.
+    size_t getPriorityOrder(size_t* order);
+
+    // The element parameters for boardCount boards sharing a width by height screen.
+    ElementParameters getElementParameters(int width, int height, size_t boardCount);
+
+    // Rasterise the images, returning once those visible in the current mode are ready, as createTextures describes.
+    void startTextures(TextureBuilder& textureBuilder, Screen& screen, ElementParameters elementParameters,
+        bool progressive);
 
-    bool isRunningGame() {
-        return !crashedLeft && !crashedRight && (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B);
+    // Start the sounds and the timers that move the balls and read the GPIO pins.
+    void startTimers();
+
+    // Act on a key or click. Returns false if the event is something else.
+    bool handleInput(const SDL_Event& event);
+
+    // Act on an input, as the player made it or as it was recorded.
+    void perform(InputLog::Action action, uint32_t board = 0);
+
+    // The tick the boards are at: SDL's ticks when playing, the replay's when replaying.
+    Uint32 getTicks() const {
+        return isReplaying ? replayTick : SDL_GetTicks();
     }
 
-    bool isShowingCrashed() {
-        return (crashedLeft || crashedRight) && (currentMode == Mode::GAME_A || currentMode == Mode::GAME_B);
+    // The time of day time mode shows, when replaying that of the recording.
+    std::time_t getTime() const {
+        return isReplaying ? replay->startTime + replayTick / 1000 : std::time(nullptr);
     }
 
+    // Make every move of the balls due by now. Returns how long until the next is due, 0 if no game is being played.
+    Uint32 updateBoards(Uint32 now);
+
+    // What each board shows now.
+    void getStates(std::vector<DisplayState>& states);
+
+    // Start the replay's clock, making the moves due as it starts.
+    void startReplay();
+
+    // Move the replay on to where it should be by now, making the moves and inputs due on the way.
+    void advanceReplay();
+
+    // Move the focused board's arms to save a ball that's about to be dropped.
+    void autoplay();
+
+    // The screen is now width by height, it carries on showing the old images stretched.
+    void resize(int width, int height);
+
+    // Start rasterising images for a new size of screen once nothing else is being rasterised, and swap them in
+    // once they're all ready.
+    void updateImageSize();
+
+    // The index of the board under the given point of the window, -1 if there isn't one.
+    int boardAt(Uint32 windowID, int x, int y);
+
+    // Run the game while the outputs draw it.
+    void runOutputs();
+
+    // Give the publisher the boards as they are now, with the mutex held.
+    void publishStates();
+
+    Uint32 timerCallback();
+    static Uint32 staticTimerCallback(Uint32 interval, void* param);
+    static Uint32 staticGpioTimerCallback(Uint32 interval, void* param);
+
 
 public:
 
     GameState();
     ~GameState();
 
+    // Play count games side by side, each with a share of the screen. Must be called before createTextures.
+    void setBoardCount(size_t count) {
+        boards.resize(count);
+    }
+
     void setGameColours(uint32_t onColour, uint32_t offColour) {
         this->onColour = onColour;
         this->offColour = offColour;
     }
 
-    void createTextures(SDL_Renderer* renderer, int screenW, int screenH, int subSamples);
+    void setSparseSamples(bool sparseSamples) {
+        this->sparseSamples = sparseSamples;
+    }
+
+    void setUseDistanceFields(bool useDistanceFields) {
+        this->useDistanceFields = useDistanceFields;
+    }
+
+    // Draw these outlines instead of the built in ones, must outlive the game state.
+    void setOutlinePack(const OutlinePack* outlinePack) {
+        this->outlinePack = outlinePack;
+    }
+
+    // Publish the boards after every move and key press, must outlive the game state.
+    void setPublisher(StatePublisher* publisher) {
+        this->publisher = publisher;
+    }
+
+    // Record every input to path so the session can be replayed, after setBoardCount. Returns false, having logged
+    // why, if it can't be written.
+    bool recordInputs(const char* path) {
+        return recording.create(path, SDL_GetTicks(), boards, focusedBoard);
+    }
+
+    // Replay the recorded inputs rather than taking them from the player, at speed times real time or with speed 0 as
+    // fast as the frames can be drawn. The boards are put back as they were recorded, replacing setBoardCount's. The
+    // recording must outlive the game state.
+    void setReplay(const InputLog* replay, double speed);
+
+    // While replaying, move the arms to catch every ball in the focused board as the inputs' machine did, so a game
+    // can run for hours without a player.
+    void setAutoplay(bool isAutoplaying) {
+        this->isAutoplaying = isAutoplaying;
+    }
+
+    // Run the replay as fast as it goes without drawing it, writing the beeps of the focused board to the WAV file
+    // path at the samples their ticks fall on, instead of run. Returns false, having logged why, if the file can't
+    // be written.
+    bool writeSounds(const char* path);
+
+    // Run the replay as fast as it goes without a window, a move or an input at a time, instead of run. drawFrame is
+    // given what the boards show as the replay starts and after each step. Returns false as soon as drawFrame does.
+    bool drawReplay(const std::function<bool(const std::vector<DisplayState>& states)>& drawFrame);
+
+    // Draw this photo in place of the frame, must outlive the game state. It's scaled again if the screen is resized.
+    void setSkin(Skin* skin) {
+        this->skin = skin;
+    }
+
+    // Rasterise the element textures, returning once those visible in the current mode are ready. In progressive mode
+    // the textures are first rasterised with a single sample per pixel so the game can start straight away; the full
+    // quality textures replace them as they become available.
+    void createTextures(Screen& screen, int screenW, int screenH, int subSamples, bool progressive);
 
-    void renderFrameAndJuggler(SDL_Renderer* renderer);
+    // Draw the game in a window at each of the placements instead, each window made and drawn by its own thread,
+    // returning once the visible images are ready. With split set the boards are dealt out between the windows, the
+    // first to the first window and so on, otherwise every window shows every board. Windows whose images would be
+    // the same size share them. Returns false if a window or its screen can't be made.
+    bool createOutputs(const std::vector<SDL_Rect>& placements, Uint32 windowFlags,
+        const Output::ScreenFactory& createScreen, bool split, int subSamples, bool progressive);
 
-    void run(SDL_Renderer* renderer);
+    // Play the game on the screen given to createTextures, or the outputs, until the player quits.
+    void run();
 };
 
 
@@ -0,0 +1,421 @@
+#include <SDL.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "GlesScreen.h"
+
+namespace {
+    const char* vertexShaderSource = R"(
+        attribute vec2 position;
+        attribute vec2 texCoord;
+        attribute float opaque;
+        uniform vec2 scale;
+        varying vec2 fragmentTexCoord;
+        varying float fragmentOpaque;
+
+        void main() {
+            fragmentTexCoord = texCoord;
+            fragmentOpaque = opaque;
+            gl_Position = vec4(position * scale + vec2(-1.0, 1.0), 0.0, 1.0);
+        }
+    )";
+
+    // The atlas can be 4096 texels across so ask for high precision texture coordinates where there is any.
+    const char* fragmentShaderSource = R"(
+        #ifdef GL_FRAGMENT_PRECISION_HIGH
+        precision highp float;
+        #else
+        precision mediump float;
+        #endif
+        uniform sampler2D atlas;
+        varying vec2 fragmentTexCoord;
+        varying float fragmentOpaque;
+
+        void main() {
+            vec4 texel = texture2D(atlas, fragmentTexCoord);
+            gl_FragColor = vec4(texel.rgb, max(texel.a, fragmentOpaque));
+        }
+    )";
+
+    enum Attribute { ATTRIBUTE_POSITION, ATTRIBUTE_TEX_COORD, ATTRIBUTE_OPAQUE };
+}
+
+GlesScreen::GlesScreen(SDL_Window* window, uint32_t clearColour) : window(window), clearColour(clearColour) {
+}
+
+GlesScreen::~GlesScreen() {
+    if (context == nullptr)
+        return;
+    for (auto& page : pages) gl.glDeleteTextures(1, &page.texture);
+    if (vertexBuffer != 0)
+        gl.glDeleteBuffers(1, &vertexBuffer);
+    if (indexBuffer != 0)
+        gl.glDeleteBuffers(1, &indexBuffer);
+    if (program != 0)
+        gl.glDeleteProgram(program);
+    SDL_GL_DeleteContext(context);
+}
+
+bool GlesScreen::loadFunctions() {
+#define GLES_LOAD_FUNCTION(ret, name, params)                                           \
+    gl.name = reinterpret_cast<ret(GL_APIENTRY*) params>(SDL_GL_GetProcAddress(#name)); \
+    if (gl.name == nullptr) {                                                           \
+        SDL_Log("OpenGL ES function %s is missing.", #name);                            \
+        return false;                                                                   \
+    }
+    GLES_FUNCTIONS(GLES_LOAD_FUNCTION)
+#undef GLES_LOAD_FUNCTION
+    return true;
+}
+
+GLuint GlesScreen::compileShader(GLenum type, const char* source) {
+    GLuint shader = gl.glCreateShader(type);
+    gl.glShaderSource(shader, 1, &source, nullptr);
+    gl.glCompileShader(shader);
+    GLint status;
+    gl.glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE) {
+        char log[1024];
+        gl.glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        SDL_Log("Shader compilation failed: %s", log);
+        gl.glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+bool GlesScreen::init() {
+    context = SDL_GL_CreateContext(window);
+    if (context == nullptr) {
+        SDL_Log("Could not create an OpenGL ES context: %s", SDL_GetError());
+        return false;
+    }
+    // Same as the SDL renderer, don't wait for vsync.
+    SDL_GL_SetSwapInterval(0);
+    if (!loadFunctions())
+        return false;
+
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentShaderSource);
+    if (vertexShader == 0 || fragmentShader == 0)
+        return false;
+    program = gl.glCreateProgram();
+    gl.glAttachShader(program, vertexShader);
+    gl.glAttachShader(program, fragmentShader);
+    gl.glBindAttribLocation(program, ATTRIBUTE_POSITION, "position");
+    gl.glBindAttribLocation(program, ATTRIBUTE_TEX_COORD, "texCoord");
+    gl.glBindAttribLocation(program, ATTRIBUTE_OPAQUE, "opaque");
+    gl.glLinkProgram(program);
+    gl.glDeleteShader(vertexShader);
+    gl.glDeleteShader(fragmentShader);
+    GLint status;
+    gl.glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE) {
+        char log[1024];
+        gl.glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+        SDL_Log("Shader linking failed: %s", log);
+        return false;
+    }
+    gl.glUseProgram(program);
+    scaleLocation = gl.glGetUniformLocation(program, "scale");
+    gl.glUniform1i(gl.glGetUniformLocation(program, "atlas"), 0);
+
+    // There's only the one vertex layout so the buffers stay bound.
+    gl.glGenBuffers(1, &vertexBuffer);
+    gl.glGenBuffers(1, &indexBuffer);
+    gl.glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    gl.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    gl.glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+    gl.glEnableVertexAttribArray(ATTRIBUTE_TEX_COORD);
+    gl.glEnableVertexAttribArray(ATTRIBUTE_OPAQUE);
+    gl.glVertexAttribPointer(ATTRIBUTE_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+        reinterpret_cast<const void*>(offsetof(Vertex, x)));
+    gl.glVertexAttribPointer(ATTRIBUTE_TEX_COORD, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+        reinterpret_cast<const void*>(offsetof(Vertex, u)));
+    gl.glVertexAttribPointer(ATTRIBUTE_OPAQUE, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+        reinterpret_cast<const void*>(offsetof(Vertex, opaque)));
+
+    gl.glEnable(GL_BLEND);
+    gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    // A page as wide as the screen and half as tall again, each rounded up to a power of two, holds the frame with
+    // room below for every other element and for refined images to move into. So there's normally just the one page
+    // and a frame is a single draw call. Only if the driver's largest texture is too small is another page started.
+    GLint maxTextureSize = 0;
+    gl.glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    int w, h;
+    SDL_GL_GetDrawableSize(window, &w, &h);
+    pageWidth = 64;
+    while (pageWidth < w && pageWidth * 2 <= maxTextureSize) pageWidth *= 2;
+    pageHeight = 64;
+    while (pageHeight < h + h / 2 && pageHeight * 2 <= maxTextureSize) pageHeight *= 2;
+    SDL_Log("Using OpenGL ES with %dx%d atlas pages.", pageWidth, pageHeight);
+    return true;
+}
+
+Uint32 GlesScreen::choosePixelFormat(bool isOpaque) {
+    // GL_RGBA with GL_UNSIGNED_BYTE is what SDL calls RGBA32 whatever the byte order, anything else is converted as
+    // it's uploaded. The frame needs its alpha too, the fragment shader ignores it when drawing.
+    const Uint32 format = SDL_PIXELFORMAT_RGBA32;
+    return LcdElementTexture::choosePixelFormat(&format, 1, false);
+}
+
+bool GlesScreen::allocate(int w, int h, size_t& page, SDL_Rect& rect) {
+    if (w > pageWidth || h > pageHeight)
+        return false;
+
+    // The smallest free space it fits in, with what's left to the right and below given back again.
+    size_t bestPage = 0;
+    size_t best = 0;
+    long bestArea = -1;
+    for (size_t p = 0; p < pages.size(); ++p) {
+        for (size_t i = 0; i < pages[p].freeRects.size(); ++i) {
+            const SDL_Rect& free = pages[p].freeRects[i];
+            const long area = static_cast<long>(free.w) * free.h;
+            if (free.w >= w && free.h >= h && (bestArea < 0 || area < bestArea)) {
+                bestPage = p;
+                best = i;
+                bestArea = area;
+            }
+        }
+    }
+    if (bestArea >= 0) {
+        std::vector<SDL_Rect>& freeRects = pages[bestPage].freeRects;
+        const SDL_Rect free = freeRects[best];
+        freeRects[best] = freeRects.back();
+        freeRects.pop_back();
+        page = bestPage;
+        rect.x = free.x;
+        rect.y = free.y;
+        rect.w = w;
+        rect.h = h;
+        if (free.w > w)
+            freeRects.push_back({ free.x + w, free.y, free.w - w, h });
+        if (free.h > h)
+            freeRects.push_back({ free.x, free.y + h, free.w, free.h - h });
+        return true;
+    }
+
+    for (page = 0; page <= pages.size(); ++page) {
+        if (page == pages.size()) {
+            Page newPage;
+            gl.glGenTextures(1, &newPage.texture);
+            gl.glBindTexture(GL_TEXTURE_2D, newPage.texture);
+            gl.glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pageWidth, pageHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            // Elements are drawn at their natural size so there's no need to filter.
+            gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            pages.push_back(newPage);
+            frameVertices.resize(pages.size());
+            pageVertices.resize(pages.size());
+        }
+
+        Page& p = pages[page];
+        int x = p.shelfX;
+        int y = p.shelfY;
+        int shelfHeight = p.shelfHeight;
+        if (x + w > pageWidth) {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (y + h <= pageHeight) {
+            p.shelfX = x + w;
+            p.shelfY = y;
+            p.shelfHeight = std::max(shelfHeight, h);
+            rect.x = x;
+            rect.y = y;
+            rect.w = w;
+            rect.h = h;
+            return true;
+        }
+    }
+    return false;
+}
+
+void GlesScreen::release(size_t page, const SDL_Rect& rect) {
+    pages[page].freeRects.push_back(rect);
+}
+
+void GlesScreen::setElementImage(size_t outlineID, const ElementImage& image) {
+    // The frame is opaque so is never trimmed, and like RendererScreen its outermost pixels are left showing the
+    // clear colour.
+    const bool isFrame = outlineID == Outlines::FRAME;
+    std::vector<SDL_Rect> rects;
+    LcdElementTexture::splitImage(image, pageWidth, pageHeight, !isFrame, rects);
+    SDL_Rect inset;
+    inset.x = 1;
+    inset.y = 1;
+    inset.w = image.dest.w - 2;
+    inset.h = image.dest.h - 2;
+
+    // Where a part still fits in its slot from before it keeps it, refining an image only changes the size of its
+    // trimmed parts by a few pixels. The slots that aren't kept are given back.
+    std::vector<Part>& oldParts = parts[outlineID];
+    std::vector<Part> newParts;
+    for (SDL_Rect rect : rects) {
+        if (isFrame && !SDL_IntersectRect(&inset, &rect, &rect))
+            continue;
+        Part part;
+        size_t i = newParts.size();
+        if (i < oldParts.size() && oldParts[i].slot.w >= rect.w && oldParts[i].slot.h >= rect.h) {
+            part.page = oldParts[i].page;
+            part.slot = oldParts[i].slot;
+            oldParts[i].slot.w = 0;
+        } else if (!allocate(rect.w, rect.h, part.page, part.slot)) {
+            SDL_Log("No room in the atlas for element %d.", static_cast<int>(outlineID));
+            continue;
+        }
+
+        const int bytesPerRow = rect.w * 4;
+        const uint8_t* pixels = image.pixels.get() + rect.y * image.pitch + rect.x * 4;
+        if (image.format != SDL_PIXELFORMAT_RGBA32) {
+            // On a big endian machine the images aren't in the order GL_RGBA takes the bytes.
+            uploadBuffer.resize(static_cast<size_t>(bytesPerRow) * rect.h);
+            SDL_ConvertPixels(rect.w, rect.h, image.format, pixels, image.pitch, SDL_PIXELFORMAT_RGBA32,
+                uploadBuffer.data(), bytesPerRow);
+            pixels = uploadBuffer.data();
+        } else if (bytesPerRow != image.pitch) {
+            // OpenGL ES 2 has no GL_UNPACK_ROW_LENGTH so the rows have to be packed together first.
+            uploadBuffer.resize(static_cast<size_t>(bytesPerRow) * rect.h);
+            for (int y = 0; y < rect.h; ++y)
+                std::memcpy(&uploadBuffer[static_cast<size_t>(y) * bytesPerRow], pixels + y * image.pitch, bytesPerRow);
+            pixels = uploadBuffer.data();
+        }
+        gl.glBindTexture(GL_TEXTURE_2D, pages[part.page].texture);
+        gl.glTexSubImage2D(GL_TEXTURE_2D, 0, part.slot.x, part.slot.y, rect.w, rect.h, GL_RGBA, GL_UNSIGNED_BYTE,
+            pixels);
+
+        const GLfloat x0 = static_cast<GLfloat>(image.dest.x + rect.x);
+        const GLfloat y0 = static_cast<GLfloat>(image.dest.y + rect.y);
+        const GLfloat x1 = x0 + rect.w;
+        const GLfloat y1 = y0 + rect.h;
+        const GLfloat u0 = static_cast<GLfloat>(part.slot.x) / pageWidth;
+        const GLfloat v0 = static_cast<GLfloat>(part.slot.y) / pageHeight;
+        const GLfloat u1 = static_cast<GLfloat>(part.slot.x + rect.w) / pageWidth;
+        const GLfloat v1 = static_cast<GLfloat>(part.slot.y + rect.h) / pageHeight;
+        const GLfloat opaque = isFrame ? 1.0f : 0.0f;
+        part.vertices[0] = { x0, y0, u0, v0, opaque };
+        part.vertices[1] = { x1, y0, u1, v0, opaque };
+        part.vertices[2] = { x1, y1, u1, v1, opaque };
+        part.vertices[3] = { x0, y1, u0, v1, opaque };
+        newParts.push_back(part);
+    }
+    for (const Part& part : oldParts) {
+        if (part.slot.w > 0)
+            release(part.page, part.slot);
+    }
+    oldParts.swap(newParts);
+}
+
+void GlesScreen::resize(int width, int height, int imageWidth, int imageHeight) {
+    // Images for a new size are about to replace all the old ones, so the atlas starts again rather than filling up.
+    if (this->imageWidth != 0 && (imageWidth != this->imageWidth || imageHeight != this->imageHeight)) {
+        for (Page& page : pages) {
+            page.shelfX = page.shelfY = page.shelfHeight = 0;
+            page.freeRects.clear();
+        }
+        for (auto& elementParts : parts) elementParts.clear();
+    }
+    this->imageWidth = imageWidth;
+    this->imageHeight = imageHeight;
+}
+
+void GlesScreen::draw(size_t page, const std::vector<Vertex>& vertices) {
+    const size_t quads = vertices.size() / 4;
+    if (quads > indexBufferQuads) {
+        std::vector<GLushort> indices(quads * 6);
+        for (size_t i = 0; i < quads; ++i) {
+            GLushort first = static_cast<GLushort>(i * 4);
+            GLushort* quad = &indices[i * 6];
+            quad[0] = first;
+            quad[1] = first + 1;
+            quad[2] = first + 2;
+            quad[3] = first;
+            quad[4] = first + 2;
+            quad[5] = first + 3;
+        }
+        gl.glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(), GL_STATIC_DRAW);
+        indexBufferQuads = quads;
+    }
+
+    gl.glBindTexture(GL_TEXTURE_2D, pages[page].texture);
+    gl.glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STREAM_DRAW);
+    gl.glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(quads * 6), GL_UNSIGNED_SHORT, nullptr);
+}
+
+void GlesScreen::clear() {
+    gl.glClearColor((clearColour & 0xFF) / 255.0f, ((clearColour >> 8) & 0xFF) / 255.0f,
+        ((clearColour >> 16) & 0xFF) / 255.0f, 1.0f);
+    gl.glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void GlesScreen::render(const DisplayState& state) {
+    int w, h;
+    SDL_GL_GetDrawableSize(window, &w, &h);
+    gl.glViewport(0, 0, w, h);
+    // Stretch the images to the drawable if they're for another size.
+    if (imageWidth != 0)
+        gl.glUniform2f(scaleLocation, 2.0f / imageWidth, -2.0f / imageHeight);
+    else
+        gl.glUniform2f(scaleLocation, 2.0f / w, -2.0f / h);
+    clear();
+    drawElements(state);
+}
+
+void GlesScreen::renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) {
+    int w, h;
+    SDL_GL_GetDrawableSize(window, &w, &h);
+    gl.glViewport(0, 0, w, h);
+    clear();
+
+    // The viewports are in image pixels, they're stretched to the drawable as a whole. GL's origin is bottom left.
+    const float scaleX = imageWidth != 0 ? static_cast<float>(w) / imageWidth : 1.0f;
+    const float scaleY = imageHeight != 0 ? static_cast<float>(h) / imageHeight : 1.0f;
+    for (size_t i = 0; i < count; ++i) {
+        const SDL_Rect& viewport = viewports[i];
+        const int x0 = static_cast<int>(viewport.x * scaleX);
+        const int x1 = static_cast<int>((viewport.x + viewport.w) * scaleX);
+        const int y0 = static_cast<int>(viewport.y * scaleY);
+        const int y1 = static_cast<int>((viewport.y + viewport.h) * scaleY);
+        gl.glViewport(x0, h - y1, x1 - x0, y1 - y0);
+        gl.glUniform2f(scaleLocation, 2.0f / viewport.w, -2.0f / viewport.h);
+        drawElements(states[i]);
+    }
+}
+
+void GlesScreen::drawElements(const DisplayState& state) {
+    for (auto& vertices : frameVertices) vertices.clear();
+    for (auto& vertices : pageVertices) vertices.clear();
+    state.forEach([this](size_t outlineID) {
+        for (const Part& part : parts[outlineID]) {
+            auto& vertices = outlineID == Outlines::FRAME ? frameVertices[part.page] : pageVertices[part.page];
+            vertices.insert(vertices.end(), part.vertices, part.vertices + 4);
+        }
+    });
+
+    // The frame has to be drawn before anything else. It normally fits on a single page, in which case the other
+    // elements on that page can go in the same draw call.
+    size_t framePages = std::count_if(frameVertices.begin(), frameVertices.end(),
+        [](const std::vector<Vertex>& vertices) { return !vertices.empty(); });
+    for (size_t page = 0; page < pages.size(); ++page) {
+        if (frameVertices[page].empty())
+            continue;
+        if (framePages == 1) {
+            frameVertices[page].insert(frameVertices[page].end(), pageVertices[page].begin(), pageVertices[page].end());
+            pageVertices[page].clear();
+        }
+        draw(page, frameVertices[page]);
+    }
+    for (size_t page = 0; page < pages.size(); ++page) {
+        if (!pageVertices[page].empty())
+            draw(page, pageVertices[page]);
+    }
+}
+
+void GlesScreen::present() {
+    SDL_GL_SwapWindow(window);
+}
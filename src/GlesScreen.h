@@ -0,0 +1,138 @@
+#ifndef GLESSCREEN_H_
+#define GLESSCREEN_H_
+
+#include <SDL.h>
+#include <SDL_opengles2.h>
+#include <vector>
+
+#include "Screen.h"
+
+// The OpenGL ES 2 functions used by GlesScreen, loaded at run time with SDL_GL_GetProcAddress.
+#define GLES_FUNCTIONS(F)                                                                                      \
+    F(void, glAttachShader, (GLuint program, GLuint shader))                                                   \
+    F(void, glBindAttribLocation, (GLuint program, GLuint index, const GLchar* name))                          \
+    F(void, glBindBuffer, (GLenum target, GLuint buffer))                                                      \
+    F(void, glBindTexture, (GLenum target, GLuint texture))                                                    \
+    F(void, glBlendFunc, (GLenum sfactor, GLenum dfactor))                                                     \
+    F(void, glBufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage))                    \
+    F(void, glClear, (GLbitfield mask))                                                                        \
+    F(void, glClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha))                           \
+    F(void, glCompileShader, (GLuint shader))                                                                  \
+    F(GLuint, glCreateProgram, (void))                                                                         \
+    F(GLuint, glCreateShader, (GLenum type))                                                                   \
+    F(void, glDeleteBuffers, (GLsizei n, const GLuint* buffers))                                               \
+    F(void, glDeleteProgram, (GLuint program))                                                                 \
+    F(void, glDeleteShader, (GLuint shader))                                                                   \
+    F(void, glDeleteTextures, (GLsizei n, const GLuint* textures))                                             \
+    F(void, glDrawElements, (GLenum mode, GLsizei count, GLenum type, const void* indices))                   \
+    F(void, glEnable, (GLenum cap))                                                                            \
+    F(void, glEnableVertexAttribArray, (GLuint index))                                                         \
+    F(void, glGenBuffers, (GLsizei n, GLuint* buffers))                                                        \
+    F(void, glGenTextures, (GLsizei n, GLuint* textures))                                                      \
+    F(void, glGetIntegerv, (GLenum pname, GLint* data))                                                        \
+    F(void, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog))          \
+    F(void, glGetProgramiv, (GLuint program, GLenum pname, GLint* params))                                     \
+    F(void, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog))            \
+    F(void, glGetShaderiv, (GLuint shader, GLenum pname, GLint* params))                                       \
+    F(GLint, glGetUniformLocation, (GLuint program, const GLchar* name))                                       \
+    F(void, glLinkProgram, (GLuint program))                                                                   \
+    F(void, glPixelStorei, (GLenum pname, GLint param))                                                        \
+    F(void, glShaderSource, (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length))  \
+    F(void, glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,    \
+        GLint border, GLenum format, GLenum type, const void* pixels))                                         \
+    F(void, glTexParameteri, (GLenum target, GLenum pname, GLint param))                                       \
+    F(void, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width,         \
+        GLsizei height, GLenum format, GLenum type, const void* pixels))                                       \
+    F(void, glUniform1i, (GLint location, GLint v0))                                                           \
+    F(void, glUniform2f, (GLint location, GLfloat v0, GLfloat v1))                                             \
+    F(void, glUseProgram, (GLuint program))                                                                    \
+    F(void, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, \
+        const void* pointer))                                                                                  \
+    F(void, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height))
+
+// Draws the game with OpenGL ES 2 rather than an SDL renderer. The element images are packed into an atlas page big
+// enough for all of them and the lit elements are drawn as one list of quads, so a frame is a single draw call however
+// many elements are lit. If the driver's textures are too small for that, further pages are used, at a draw call
+// each. The frame is drawn first with its alpha forced to opaque.
+class GlesScreen : public Screen {
+protected:
+    struct Functions {
+#define GLES_DECLARE_FUNCTION(ret, name, params) ret(GL_APIENTRY* name) params;
+        GLES_FUNCTIONS(GLES_DECLARE_FUNCTION)
+#undef GLES_DECLARE_FUNCTION
+    };
+
+    struct Vertex {
+        GLfloat x;
+        GLfloat y;
+        GLfloat u;
+        GLfloat v;
+        GLfloat opaque;
+    };
+
+    // Images are packed onto shelves, a new shelf is started below the tallest image when a row is full. Space given
+    // back by images that have been replaced is used first.
+    struct Page {
+        GLuint texture = 0;
+        int shelfX = 0;
+        int shelfY = 0;
+        int shelfHeight = 0;
+        std::vector<SDL_Rect> freeRects;
+    };
+
+    // Part of an element, each is a quad drawn from the top left of its slot in one page.
+    struct Part {
+        size_t page;
+        SDL_Rect slot;
+        Vertex vertices[4];
+    };
+
+    SDL_Window* window;
+    uint32_t clearColour;
+    SDL_GLContext context = nullptr;
+    Functions gl;
+    GLuint program = 0;
+    GLint scaleLocation = -1;
+    GLuint vertexBuffer = 0;
+    GLuint indexBuffer = 0;
+    size_t indexBufferQuads = 0;
+    int pageWidth = 0;
+    int pageHeight = 0;
+    std::vector<Page> pages;
+    std::vector<Part> parts[Outlines::COUNT];
+    // The size of drawable the element images are for, 0 until resize is called.
+    int imageWidth = 0;
+    int imageHeight = 0;
+
+    // Reused each frame, the vertices for each page with the frame's kept separate so they can go first.
+    std::vector<std::vector<Vertex>> frameVertices;
+    std::vector<std::vector<Vertex>> pageVertices;
+    std::vector<uint8_t> uploadBuffer;
+
+    bool loadFunctions();
+    GLuint compileShader(GLenum type, const char* source);
+    bool allocate(int w, int h, size_t& page, SDL_Rect& rect);
+    void release(size_t page, const SDL_Rect& rect);
+    void draw(size_t page, const std::vector<Vertex>& vertices);
+    void clear();
+    // Draw the lit elements into the current viewport, the frame first.
+    void drawElements(const DisplayState& state);
+
+public:
+    // The colour shows around the edge of the frame.
+    GlesScreen(SDL_Window* window, uint32_t clearColour);
+    ~GlesScreen() override;
+
+    // Create the context and shaders. The window must have been created with SDL_WINDOW_OPENGL. Returns false if
+    // OpenGL ES 2 isn't available.
+    bool init();
+
+    Uint32 choosePixelFormat(bool isOpaque) override;
+    void setElementImage(size_t outlineID, const ElementImage& image) override;
+    void resize(int width, int height, int imageWidth, int imageHeight) override;
+    void render(const DisplayState& state) override;
+    void renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) override;
+    void present() override;
+};
+
+#endif  // GLESSCREEN_H_
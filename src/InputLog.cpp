@@ -0,0 +1,132 @@
+#include <cerrno>
+#include <cstring>
+
+#include "InputLog.h"
+
+namespace {
+    const char MAGIC[4] = { 'T', 'U', 'P', 'I' };
+    const int VERSION = 1;
+
+    // Numbers are stored 7 bits a byte, lowest first, the top bit set on every byte but the last.
+    bool readNumber(FILE* file, uint64_t& number) {
+        number = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const int byte = std::fgetc(file);
+            if (byte == EOF)
+                return false;
+            number |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool readNumber(FILE* file, uint32_t& number) {
+        uint64_t value;
+        if (!readNumber(file, value) || value > UINT32_MAX)
+            return false;
+        number = static_cast<uint32_t>(value);
+        return true;
+    }
+}
+
+InputLog::~InputLog() {
+    close();
+}
+
+void InputLog::writeNumber(uint64_t number) {
+    while (number >= 0x80) {
+        std::fputc(static_cast<int>(number & 0x7F) | 0x80, file);
+        number >>= 7;
+    }
+    std::fputc(static_cast<int>(number), file);
+}
+
+bool InputLog::create(const char* path, Uint32 now, const std::vector<Board>& boards, size_t focusedBoard) {
+    close();
+    file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        SDL_Log("Could not create %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    startTick = now;
+    lastTick = now;
+
+    std::fwrite(MAGIC, 1, sizeof(MAGIC), file);
+    writeNumber(VERSION);
+    writeNumber(static_cast<uint64_t>(std::time(nullptr)));
+    writeNumber(boards.size());
+    writeNumber(Board::SAVED_VALUES);
+    writeNumber(focusedBoard);
+    uint32_t values[Board::SAVED_VALUES];
+    for (const Board& board : boards) {
+        board.save(now, values);
+        for (uint32_t value : values) writeNumber(value);
+    }
+    std::fflush(file);
+    SDL_Log("Recording the inputs to %s.", path);
+    return true;
+}
+
+void InputLog::record(Uint32 now, Action action, uint32_t board) {
+    if (file == nullptr)
+        return;
+    writeNumber(now - lastTick);
+    writeNumber(static_cast<uint64_t>(action));
+    if (action == Action::FOCUS_BOARD)
+        writeNumber(board);
+    lastTick = now;
+    std::fflush(file);
+}
+
+void InputLog::close() {
+    if (file != nullptr)
+        std::fclose(file);
+    file = nullptr;
+}
+
+bool InputLog::load(const char* path) {
+    FILE* in = std::fopen(path, "rb");
+    if (in == nullptr) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    char magic[sizeof(MAGIC)];
+    uint32_t version = 0;
+    uint64_t time = 0;
+    uint32_t boardCount = 0;
+    uint32_t valueCount = 0;
+    bool ok = std::fread(magic, 1, sizeof(magic), in) == sizeof(magic) &&
+        std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0 && readNumber(in, version) && version == VERSION &&
+        readNumber(in, time) && readNumber(in, boardCount) && readNumber(in, valueCount) &&
+        readNumber(in, focusedBoard) && boardCount >= 1 && boardCount <= 256 && valueCount == Board::SAVED_VALUES &&
+        focusedBoard < boardCount;
+    startTime = static_cast<std::time_t>(time);
+    boardValues.resize(ok ? boardCount * valueCount : 0);
+    for (size_t i = 0; ok && i < boardValues.size(); ++i) ok = readNumber(in, boardValues[i]);
+    if (!ok) {
+        SDL_Log("%s isn't a recording of this version's inputs.", path);
+        std::fclose(in);
+        return false;
+    }
+
+    // A recording cut short by a crash ends with the last whole input.
+    events.clear();
+    Event event;
+    event.tick = 0;
+    uint32_t delta;
+    uint32_t action;
+    while (readNumber(in, delta) && readNumber(in, action) && action <= static_cast<uint32_t>(Action::QUIT)) {
+        event.tick += delta;
+        event.action = static_cast<Action>(action);
+        event.board = 0;
+        if (event.action == Action::FOCUS_BOARD && (!readNumber(in, event.board) || event.board >= boardCount))
+            break;
+        events.push_back(event);
+    }
+    std::fclose(in);
+    SDL_Log("Replaying %d inputs over %.1fs from %s.", static_cast<int>(events.size()),
+        events.empty() ? 0.0 : events.back().tick / 1000.0, path);
+    return true;
+}
@@ -0,0 +1,73 @@
+#ifndef INPUTLOG_H_
+#define INPUTLOG_H_
+
+#include <SDL.h>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+#include "Board.h"
+
+// A session's inputs as the game acted on them, so the session can be played again exactly. The file starts with
+// the boards as they were when recording started, followed by one entry per input: the ticks since the last input
+// and the action, each a variable length number, so a key press usually takes two bytes. Keys from the GPIO pins
+// arrive as key events, so they're recorded along with the keyboard's.
+class InputLog {
+public:
+    enum class Action : uint8_t {
+        MOVE_ARMS_LEFT, MOVE_ARMS_RIGHT, START_GAME_A_HI_SCORE, START_GAME_A, START_GAME_B_HI_SCORE, START_GAME_B,
+        START_TIME_MODE, FOCUS_BOARD, QUIT
+    };
+
+    struct Event {
+        // Milliseconds since recording started.
+        Uint32 tick;
+        Action action;
+        // The board focused, for FOCUS_BOARD.
+        uint32_t board;
+    };
+
+    // The time of day when recording started, shown in time mode.
+    std::time_t startTime = 0;
+    uint32_t focusedBoard = 0;
+    // Board::SAVED_VALUES for each board, with ticks relative to the start of recording.
+    std::vector<uint32_t> boardValues;
+    std::vector<Event> events;
+
+protected:
+    FILE* file = nullptr;
+    Uint32 startTick = 0;
+    Uint32 lastTick = 0;
+
+    void writeNumber(uint64_t number);
+
+public:
+    InputLog() = default;
+    InputLog(const InputLog&) = delete;
+    InputLog& operator=(const InputLog&) = delete;
+    ~InputLog();
+
+    // Start recording to path with the boards as they are at the tick now. Returns false, having logged why, if it
+    // can't be written.
+    bool create(const char* path, Uint32 now, const std::vector<Board>& boards, size_t focusedBoard);
+
+    bool isRecording() const {
+        return file != nullptr;
+    }
+
+    // Append an input acted on at the tick now. Each is flushed so a crash loses nothing.
+    void record(Uint32 now, Action action, uint32_t board = 0);
+
+    void close();
+
+    // Read a recording into startTime, focusedBoard, boardValues and events. Returns false, having logged why, if it
+    // isn't one.
+    bool load(const char* path);
+
+    size_t getBoardCount() const {
+        return boardValues.size() / Board::SAVED_VALUES;
+    }
+};
+
+#endif  // INPUTLOG_H_
@@ -1,25 +1,209 @@
 #include <SDL.h>
 #include <algorithm>
-#include <memory>
 #include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
 
+#include "DistanceField.h"
 #include "Path.h"
 #include "LcdElement.h"
+#include "OutlinePack.h"
 #include "Outlines.h"
+#include "Skin.h"
 
 namespace o = Outlines;
 
+namespace {
+    // Pixel writers for the texture formats the elements can be rasterised in. Each takes the blended colour as
+    // 0xBBGGRR and whether the pixel is inside the outline (the only pixels that aren't transparent).
+    struct Abgr8888Writer {
+        using Pixel = uint32_t;
+        static Pixel write(uint32_t bgr, bool isInside) {
+            return isInside ? 0xFF000000 | bgr : bgr;
+        }
+    };
+
+    struct Argb8888Writer {
+        using Pixel = uint32_t;
+        static Pixel write(uint32_t bgr, bool isInside) {
+            uint32_t rgb = ((bgr & 0xFF) << 16) | (bgr & 0xFF00) | ((bgr >> 16) & 0xFF);
+            return isInside ? 0xFF000000 | rgb : rgb;
+        }
+    };
+
+    // No alpha channel so only suitable for elements drawn without blending.
+    struct Rgb565Writer {
+        using Pixel = uint16_t;
+        static Pixel write(uint32_t bgr, bool) {
+            return static_cast<Pixel>(((bgr & 0xF8) << 8) | ((bgr & 0xFC00) >> 5) | ((bgr & 0xF80000) >> 19));
+        }
+    };
+
+    int greatestCommonDivisor(int a, int b) {
+        return b == 0 ? a : greatestCommonDivisor(b, a % b);
+    }
+
+    // Write the pixels of the image from the coverage of each row, coverage being a count out of samples. fillRow(y, row)
+    // adds the coverage of the pixels in row y.
+    template <typename Writer, typename FillRow>
+    void writePixels(const ElementParameters& elementParameters, uint32_t samples, ElementImage& image, FillRow fillRow) {
+        using Pixel = typename Writer::Pixel;
 
-void Bounds::computeBounds(int width, int height) {
+        // There are only samples + 1 possible colours so blend them up front rather than for every pixel.
+        std::vector<Pixel> colours(samples + 1);
+        for (uint32_t i = 0; i <= samples; ++i) {
+            uint32_t blend1 = (0x100 * i) / samples;
+            uint32_t blend2 = 0x100 - blend1;
+            uint32_t cbr = ((elementParameters.onColour & 0xFF00FF) * blend1 +
+                (elementParameters.offColour & 0xFF00FF) * blend2) >>
+                8;
+            uint32_t cg = ((elementParameters.onColour & 0xFF00) * blend1 +
+                (elementParameters.offColour & 0xFF00) * blend2) >>
+                8;
+            colours[i] = Writer::write((cbr & 0xFF00FF) | (cg & 0xFF00), i != 0);
+        }
+
+        const SDL_Rect& dest = image.dest;
+        auto row = std::make_unique<uint16_t[]>(dest.w);
+        for (int y = 0; y < dest.h; ++y) {
+            std::fill(row.get(), row.get() + dest.w, 0);
+            fillRow(y, row.get());
+            auto line = reinterpret_cast<Pixel*>(image.pixels.get() + (y * image.pitch));
+            for (int x = 0; x < dest.w; ++x) line[x] = colours[row[x]];
+        }
+    }
+
+    template <typename FillRow>
+    void writeImage(const ElementParameters& elementParameters, uint32_t samples, ElementImage& image, FillRow fillRow) {
+        switch (image.format) {
+        case SDL_PIXELFORMAT_ARGB8888:
+        case SDL_PIXELFORMAT_RGB888:
+            writePixels<Argb8888Writer>(elementParameters, samples, image, fillRow);
+            break;
+        case SDL_PIXELFORMAT_RGB565:
+            writePixels<Rgb565Writer>(elementParameters, samples, image, fillRow);
+            break;
+        default:
+            writePixels<Abgr8888Writer>(elementParameters, samples, image, fillRow);
+            break;
+        }
+    }
+
+    // Blended tiles are split into at most this many bands, each trimmed to the pixels that are drawn.
+    constexpr int MAX_BANDS = 4;
+
+    bool hasAlpha(Uint32 format) {
+        return format == SDL_PIXELFORMAT_ABGR8888 || format == SDL_PIXELFORMAT_ARGB8888;
+    }
+
+    // The smallest rect within area holding every pixel with any alpha. Returns false if the area is transparent.
+    bool trimTransparent(const ElementImage& image, const SDL_Rect& area, SDL_Rect& trimmed) {
+        int left = area.x + area.w;
+        int right = area.x;
+        int top = area.y + area.h;
+        int bottom = area.y;
+        for (int y = area.y; y < area.y + area.h; ++y) {
+            auto line = reinterpret_cast<const uint32_t*>(image.pixels.get() + y * image.pitch);
+            int x0 = area.x;
+            while (x0 < area.x + area.w && (line[x0] & 0xFF000000) == 0) ++x0;
+            if (x0 == area.x + area.w)
+                continue;
+            int x1 = area.x + area.w;
+            while ((line[x1 - 1] & 0xFF000000) == 0) --x1;
+            left = std::min(left, x0);
+            right = std::max(right, x1);
+            top = std::min(top, y);
+            bottom = y + 1;
+        }
+        if (top >= bottom)
+            return false;
+        trimmed.x = left;
+        trimmed.y = top;
+        trimmed.w = right - left;
+        trimmed.h = bottom - top;
+        return true;
+    }
+
+    // Most elements only cover a fraction of their bounding box (think of the arms and the diagonal digit segments)
+    // so the area is cut into horizontal bands that are each trimmed to what is drawn. Neighbouring bands are merged
+    // back together when that doesn't cost any extra pixels as every band is another texture and draw call.
+    void addTrimmedBands(const ElementImage& image, const SDL_Rect& area, std::vector<SDL_Rect>& rects) {
+        const size_t first = rects.size();
+        for (int band = 0; band < MAX_BANDS; ++band) {
+            SDL_Rect bandArea = area;
+            bandArea.y = area.y + area.h * band / MAX_BANDS;
+            bandArea.h = area.y + area.h * (band + 1) / MAX_BANDS - bandArea.y;
+            SDL_Rect trimmed;
+            if (bandArea.h == 0 || !trimTransparent(image, bandArea, trimmed))
+                continue;
+            if (rects.size() > first) {
+                SDL_Rect& previous = rects.back();
+                SDL_Rect merged;
+                SDL_UnionRect(&previous, &trimmed, &merged);
+                if (merged.w * merged.h <= previous.w * previous.h + trimmed.w * trimmed.h) {
+                    previous = merged;
+                    continue;
+                }
+            }
+            rects.push_back(trimmed);
+        }
+    }
+
+    void allocateImage(int outlineID, const ElementParameters& elementParameters, ElementImage& image) {
+        image.format = outlineID == Outlines::FRAME ? elementParameters.opaquePixelFormat : elementParameters.pixelFormat;
+        image.pitch = image.dest.w * SDL_BYTESPERPIXEL(image.format);
+        image.pixels = std::make_unique<uint8_t[]>(image.pitch * image.dest.h);
+    }
+
+    template <typename Writer>
+    void writeSkin(const Skin& skin, ElementImage& image) {
+        using Pixel = typename Writer::Pixel;
+        const uint32_t* in = skin.getPixels();
+        for (int y = 0; y < image.dest.h; ++y) {
+            auto line = reinterpret_cast<Pixel*>(image.pixels.get() + (y * image.pitch));
+            for (int x = 0; x < image.dest.w; ++x) line[x] = Writer::write(*in++, true);
+        }
+    }
+
+    bool isSupportedFormat(Uint32 format, bool isOpaque) {
+        switch (format) {
+        case SDL_PIXELFORMAT_ABGR8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            return true;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_RGB565:
+            return isOpaque;
+        default:
+            return false;
+        }
+    }
+}
+
+
+template <typename F>
+void Bounds::forEachNode(size_t outlineID, F f) const {
+    if (outlinePack != nullptr) {
+        outlinePack->forEachNode(outlineID, f);
+        return;
+    }
+    for (auto node = Outlines::ALL_OUTLINES[outlineID]; node != nullptr && node->action != 'X'; ++node) f(*node);
+}
+
+void Bounds::computeBounds(int width, int height, const OutlinePack* outlinePack) {
+    this->outlinePack = outlinePack;
+    this->width = width;
+    this->height = height;
     xMin = yMin = std::numeric_limits<int>::max();
     xMax = yMax = std::numeric_limits<int>::min();
 
-    for (auto node = o::ALL_OUTLINES[o::FRAME]; node->action != 'X'; ++node) {
-        xMin = std::min(xMin, node->x);
-        xMax = std::max(xMax, node->x);
-        yMin = std::min(xMin, node->y);
-        yMax = std::max(yMax, node->y);
-    }
+    forEachNode(o::FRAME, [this](const Outlines::Node& node) {
+        xMin = std::min(xMin, node.x);
+        xMax = std::max(xMax, node.x);
+        yMin = std::min(xMin, node.y);
+        yMax = std::max(yMax, node.y);
+    });
 
     double sx = (static_cast<double>(xMax) - xMin) / width;
     double sy = (static_cast<double>(yMax) - yMin) / height;
@@ -29,77 +213,268 @@ void Bounds::computeBounds(int width, int height) {
     yo = (static_cast<double>(yMin) + yMax - pathUnitsPerPixel * height) / 2.0;
 }
 
-void LcdElementTexture::createSurface(int outlineID, const ElementParameters& elementParameters) {
-    if (surface != nullptr)
-        SDL_FreeSurface(surface);
-
-    Path p;
-
-    auto node = Outlines::ALL_OUTLINES[outlineID];
-    const Bounds& bounds = elementParameters.bounds;
-
-    while (node->action != 'X') {
-        if (node->action == 'M') {
-            p.moveTo(bounds.outlineToPixel(*node));
-            ++node;
-        }
-        else if (node->action == 'L') {
-            p.lineTo(bounds.outlineToPixel(*node));
-            ++node;
-        }
-        else if (node->action == 'A') {
-            p.curveTo(bounds.outlineToPixel(node[0]), bounds.outlineToPixel(node[1]),
-                bounds.outlineToPixel(node[2]));
-            node += 3;
+void Bounds::outlineToPath(size_t outlineID, Path& p) const {
+    // Scaling keeps the edges in order so end() won't sort them.
+    if (outlinePack == nullptr && Outlines::ALL_SEGMENTS[outlineID] != nullptr) {
+        constexpr double scale = 1.0 / Outlines::SEGMENT_SCALE;
+        const Outlines::Segment* segments = Outlines::ALL_SEGMENTS[outlineID];
+        const size_t count = Outlines::SEGMENT_COUNTS[outlineID];
+        p.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const Outlines::Segment& s = segments[i];
+            p.addEdge(outlineToPixel(s.x0 * scale, s.y0 * scale), outlineToPixel(s.x1 * scale, s.y1 * scale));
         }
+        p.end();
+        return;
     }
 
+    // A curve is the three nodes A, B and C, the nodes are only seen one at a time so keep the first two.
+    Outlines::Node curve[2];
+    forEachNode(outlineID, [&](const Outlines::Node& node) {
+        switch (node.action) {
+        case 'M':
+            p.moveTo(outlineToPixel(node));
+            break;
+        case 'L':
+            p.lineTo(outlineToPixel(node));
+            break;
+        case 'A':
+            curve[0] = node;
+            break;
+        case 'B':
+            curve[1] = node;
+            break;
+        case 'C':
+            p.curveTo(outlineToPixel(curve[0]), outlineToPixel(curve[1]), outlineToPixel(node));
+            break;
+        }
+    });
+
     p.end();
+}
+
+void LcdElementTexture::createImage(int outlineID, const ElementParameters& elementParameters, ElementImage& image) {
+    Path p;
+    elementParameters.bounds.outlineToPath(outlineID, p);
 
+    SDL_Rect& dest = image.dest;
     dest.x = static_cast<int>(std::floor(p.leftBound));
     dest.w = static_cast<int>(std::ceil(p.rightBound)) - dest.x;
     dest.y = static_cast<int>(std::floor(p.topBound));
     dest.h = static_cast<int>(std::ceil(p.bottomBound)) - dest.y;
+    allocateImage(outlineID, elementParameters, image);
 
-    surface = SDL_CreateRGBSurfaceWithFormat(0, dest.w, dest.h, 32, SDL_PIXELFORMAT_RGBA32);
-    SDL_LockSurface(surface);
-    auto row = std::make_unique<uint8_t[]>(dest.w);
-    const uint32_t sub2 = elementParameters.subSamples * elementParameters.subSamples;
-    for (size_t y = 0; y < dest.h; ++y) {
-        memset(row.get(), 0, dest.w);
-        for (size_t subY = 0; subY < elementParameters.subSamples; ++subY) {
-            double pathY = dest.y + y + static_cast<double>(subY) / elementParameters.subSamples;
-            p.scanLine(pathY, dest.x, 1, dest.w, elementParameters.subSamples, row.get());
-        }
-        int* line = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(surface->pixels) + (y * surface->pitch));
+    const int subSamples = elementParameters.subSamples;
+    if (!elementParameters.sparseSamples) {
+        writeImage(elementParameters, subSamples * subSamples, image, [&](int y, uint16_t* row) {
+            for (int subY = 0; subY < subSamples; ++subY) {
+                double pathY = dest.y + y + static_cast<double>(subY) / subSamples;
+                p.scanLine(pathY, dest.x, 1, dest.w, subSamples, row);
+            }
+        });
+        return;
+    }
+
+    // The sparse pattern puts each sample on its own row and column of a subSamples by subSamples grid (n-rooks).
+    // Stepping the column by a number coprime with subSamples spreads the samples evenly over the pixel. Note
+    // scanLine samples at the right hand side of each pixel, hence the offset of one pixel.
+    int step = static_cast<int>(std::sqrt(subSamples) + 0.5);
+    while (step > 1 && greatestCommonDivisor(step, subSamples) != 1) ++step;
+    std::vector<double> sparseX(subSamples);
+    for (int i = 0; i < subSamples; ++i)
+        sparseX[i] = dest.x - 1 + ((i * step) % subSamples + 0.5) / subSamples;
+
+    writeImage(elementParameters, subSamples, image, [&](int y, uint16_t* row) {
+        for (int subY = 0; subY < subSamples; ++subY) {
+            double pathY = dest.y + y + (subY + 0.5) / subSamples;
+            p.scanLine(pathY, sparseX[subY], 1, dest.w, 1, row);
+        }
+    });
+}
+
+void LcdElementTexture::createImage(const DistanceField& field, int outlineID, const ElementParameters& elementParameters,
+    ElementImage& image) {
+    const Bounds& bounds = elementParameters.bounds;
+    SDL_Rect& dest = image.dest;
+    dest.x = static_cast<int>(std::floor(bounds.pathXToPixel(field.leftBound)));
+    dest.w = static_cast<int>(std::ceil(bounds.pathXToPixel(field.rightBound))) - dest.x;
+    dest.y = static_cast<int>(std::floor(bounds.pathYToPixel(field.topBound)));
+    dest.h = static_cast<int>(std::ceil(bounds.pathYToPixel(field.bottomBound))) - dest.y;
+    allocateImage(outlineID, elementParameters, image);
+
+    // Coverage is approximated from the distance to the edge at the centre of each pixel, falling from fully covered
+    // half a pixel inside the outline to uncovered half a pixel outside. The grid position of each column is the same
+    // for every row so is only worked out once.
+    const uint32_t levels = 255;
+    const float pixelsPerTexel = static_cast<float>(field.getPathUnitsPerTexel() / bounds.pathUnitsPerPixel);
+    std::vector<DistanceField::Sample> columns(dest.w);
+    for (int x = 0; x < dest.w; ++x) columns[x] = field.sampleX(bounds.pixelXToPath(dest.x + x + 0.5));
+
+    writeImage(elementParameters, levels, image, [&](int y, uint16_t* row) {
+        DistanceField::Sample sampleY = field.sampleY(bounds.pixelYToPath(dest.y + y + 0.5));
         for (int x = 0; x < dest.w; ++x) {
-            uint32_t blend1 = (0x100 * row[x]) / sub2;
-            uint32_t blend2 = 0x100 - blend1;
-            uint32_t cbr = ((elementParameters.onColour & 0xFF00FF) * blend1 +
-                (elementParameters.offColour & 0xFF00FF) * blend2) >>
-                8;
-            uint32_t cg = ((elementParameters.onColour & 0xFF00) * blend1 +
-                (elementParameters.offColour & 0xFF00) * blend2) >>
-                8;
-            uint32_t value = (cbr & 0xFF00FF) | (cg & 0xFF00);
+            float coverage = 0.5f - field.distanceAt(columns[x], sampleY) * pixelsPerTexel;
+            row[x] = static_cast<uint16_t>(std::min(1.0f, std::max(0.0f, coverage)) * levels + 0.5f);
+        }
+    });
+}
 
-            if (row[x] == 0)
-                line[x] = value;
+void LcdElementTexture::createImage(const Skin& skin, const ElementParameters& elementParameters, ElementImage& image) {
+    image.dest = skin.getDest();
+    allocateImage(Outlines::FRAME, elementParameters, image);
+    switch (image.format) {
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_RGB888:
+        writeSkin<Argb8888Writer>(skin, image);
+        break;
+    case SDL_PIXELFORMAT_RGB565:
+        writeSkin<Rgb565Writer>(skin, image);
+        break;
+    default:
+        writeSkin<Abgr8888Writer>(skin, image);
+        break;
+    }
+}
+
+Uint32 LcdElementTexture::choosePixelFormat(SDL_Renderer* renderer, bool isOpaque) {
+    // The renderer lists its texture formats in order of preference, pick the first one we can write directly so
+    // the texture doesn't need converting when it is uploaded.
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(renderer, &info) != 0)
+        return SDL_PIXELFORMAT_ABGR8888;
+    return choosePixelFormat(info.texture_formats, info.num_texture_formats, isOpaque);
+}
+
+Uint32 LcdElementTexture::choosePixelFormat(const Uint32* formats, size_t count, bool isOpaque) {
+    for (size_t i = 0; i < count; ++i) {
+        if (isSupportedFormat(formats[i], isOpaque))
+            return formats[i];
+    }
+    return SDL_PIXELFORMAT_ABGR8888;
+}
+
+void LcdElementTexture::destroyTiles() {
+    for (auto& tile : tiles) {
+        if (tile.texture != nullptr)
+            SDL_DestroyTexture(tile.texture);
+    }
+    tiles.clear();
+}
+
+void LcdElementTexture::splitImage(const ElementImage& image, int maxWidth, int maxHeight, bool trim,
+    std::vector<SDL_Rect>& rects) {
+    // Split evenly rather than leaving a thin strip at the right or bottom.
+    trim = trim && hasAlpha(image.format);
+    const int columns = (image.dest.w + maxWidth - 1) / std::max(1, maxWidth);
+    const int rows = (image.dest.h + maxHeight - 1) / std::max(1, maxHeight);
+    rects.clear();
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            SDL_Rect cell;
+            cell.x = image.dest.w * column / columns;
+            cell.y = image.dest.h * row / rows;
+            cell.w = image.dest.w * (column + 1) / columns - cell.x;
+            cell.h = image.dest.h * (row + 1) / rows - cell.y;
+            if (trim)
+                addTrimmedBands(image, cell, rects);
             else
-                line[x] = 0xFF000000 | value;
+                rects.push_back(cell);
+        }
+    }
+}
+
+void LcdElementTexture::createTexture(SDL_Renderer* renderer, const ElementImage& image) {
+    if (image.dest.w != dest.w || image.dest.h != dest.h || image.format != format) {
+        SDL_RendererInfo info;
+        maxTileWidth = image.dest.w;
+        maxTileHeight = image.dest.h;
+        if (SDL_GetRendererInfo(renderer, &info) == 0) {
+            if (info.max_texture_width > 0)
+                maxTileWidth = std::min(maxTileWidth, info.max_texture_width);
+            if (info.max_texture_height > 0)
+                maxTileHeight = std::min(maxTileHeight, info.max_texture_height);
         }
     }
-    SDL_UnlockSurface(surface);
+
+    // Refining an image can change which parts are transparent so the trimming is redone on every upload.
+    std::vector<SDL_Rect> rects;
+    splitImage(image, maxTileWidth, maxTileHeight, blendMode != SDL_BLENDMODE_NONE, rects);
+
+    // Keep the existing textures wherever the tile size hasn't changed.
+    const bool sameFormat = image.format == format;
+    for (size_t i = rects.size(); i < tiles.size(); ++i) {
+        if (tiles[i].texture != nullptr)
+            SDL_DestroyTexture(tiles[i].texture);
+    }
+    tiles.resize(rects.size());
+    dest = image.dest;
+    format = image.format;
+
+    for (size_t i = 0; i < rects.size(); ++i) {
+        Tile& tile = tiles[i];
+        if (tile.texture != nullptr && (!sameFormat || tile.rect.w != rects[i].w || tile.rect.h != rects[i].h)) {
+            SDL_DestroyTexture(tile.texture);
+            tile.texture = nullptr;
+        }
+        tile.rect = rects[i];
+
+        if (tile.texture == nullptr) {
+            tile.texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STATIC, tile.rect.w, tile.rect.h);
+            if (tile.texture == nullptr) {
+                SDL_Log("Texture creation failed: %s", SDL_GetError());
+                continue;
+            }
+            SDL_SetTextureBlendMode(tile.texture, blendMode);
+        }
+        const uint8_t* pixels =
+            image.pixels.get() + tile.rect.y * image.pitch + tile.rect.x * SDL_BYTESPERPIXEL(format);
+        if (SDL_UpdateTexture(tile.texture, nullptr, pixels, image.pitch) != 0)
+            SDL_Log("Texture update failed: %s", SDL_GetError());
+    }
+    ready = true;
+}
+
+void LcdElementTexture::setBlendMode(SDL_BlendMode blendMode) {
+    this->blendMode = blendMode;
+    for (auto& tile : tiles) {
+        if (tile.texture != nullptr)
+            SDL_SetTextureBlendMode(tile.texture, blendMode);
+    }
 }
 
-void LcdElementTexture::createTexture(SDL_Renderer* renderer) {
-    if (texture != nullptr)
-        SDL_DestroyTexture(texture);
-    texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (texture == nullptr) {
-        SDL_Log("Texture creation failed: %s", SDL_GetError());
+void LcdElementTexture::render(SDL_Renderer* renderer) {
+    for (auto& tile : tiles) {
+        if (tile.texture == nullptr)
+            continue;
+        SDL_Rect d;
+        d.x = dest.x + tile.rect.x;
+        d.y = dest.y + tile.rect.y;
+        d.w = tile.rect.w;
+        d.h = tile.rect.h;
+        SDL_RenderCopy(renderer, tile.texture, nullptr, &d);
     }
-    SDL_FreeSurface(surface);
-    surface = nullptr;
 }
 
+void LcdElementTexture::renderWithInset(SDL_Renderer* renderer, int inset) {
+    SDL_Rect clip;
+    clip.x = inset;
+    clip.y = inset;
+    clip.w = dest.w - inset * 2;
+    clip.h = dest.h - inset * 2;
+    for (auto& tile : tiles) {
+        SDL_Rect r;
+        if (tile.texture == nullptr || !SDL_IntersectRect(&clip, &tile.rect, &r))
+            continue;
+        SDL_Rect s;
+        s.x = r.x - tile.rect.x;
+        s.y = r.y - tile.rect.y;
+        s.w = r.w;
+        s.h = r.h;
+        SDL_Rect d;
+        d.x = dest.x + r.x;
+        d.y = dest.y + r.y;
+        d.w = r.w;
+        d.h = r.h;
+        SDL_RenderCopy(renderer, tile.texture, &s, &d);
+    }
+}
@@ -1,18 +1,36 @@
 #ifndef LCDELEMENT_H_
 #define LCDELEMENT_H_
 
+#include <memory>
+#include <vector>
+
 #include "Outlines.h"
 #include "Path.h"
 
+class OutlinePack;
+class Skin;
+
 class Bounds {
 private:
     int xMin, xMax, yMin, yMax;
+    const OutlinePack* outlinePack = nullptr;
+
+    template <typename F>
+    void forEachNode(size_t outlineID, F f) const;
 
 public:
     double pathUnitsPerPixel;
     double xo, yo;
+    // The size of the screen the frame was fitted to.
+    int width = 0;
+    int height = 0;
 
-    void computeBounds(int width, int height);
+    // Fit the frame to the screen. The outlines come from outlinePack if given, otherwise they're the built in ones.
+    void computeBounds(int width, int height, const OutlinePack* outlinePack = nullptr);
+
+    const OutlinePack* getOutlinePack() const {
+        return outlinePack;
+    }
 
     double pixelXToPath(double x) const {
         return x * pathUnitsPerPixel + xo;
@@ -30,57 +48,115 @@ public:
         return (y - yo) / pathUnitsPerPixel;
     }
 
+    Point outlineToPixel(double x, double y) const {
+        return Point{ (x - xo) / pathUnitsPerPixel, (y - yo) / pathUnitsPerPixel };
+    }
+
     Point outlineToPixel(const Outlines::Node& node) const {
-        return Point{ (node.x - xo) / pathUnitsPerPixel, (node.y - yo) / pathUnitsPerPixel };
+        return outlineToPixel(node.x, node.y);
     }
+
+    // Flatten the outline into p in pixel coordinates and end() it, ready for scanning. The built in outlines were
+    // flattened by extractOutlines.py so are just scaled, those from a pack are flattened here.
+    void outlineToPath(size_t outlineID, Path& p) const;
 };
 
 struct ElementParameters {
+    // Pixels are sampled on a subSamples by subSamples grid (up to 64) or, if sparseSamples is set, with subSamples
+    // samples spread so that no two share a row or column (up to 4096).
     int subSamples;
+    bool sparseSamples = false;
+    // Build the images from distance fields of the outlines rather than rasterising them.
+    bool useDistanceFields = false;
     Bounds bounds;
     uint32_t onColour;
     uint32_t offColour;
+    // Texture format for elements drawn with blending and for the frame, which is drawn without.
+    Uint32 pixelFormat = SDL_PIXELFORMAT_ABGR8888;
+    Uint32 opaquePixelFormat = SDL_PIXELFORMAT_ABGR8888;
+    // If set the frame's image is this photo rather than its outline, it must outlive the parameters. TextureBuilder
+    // scales it again if it was made for a different size of screen.
+    Skin* skin = nullptr;
+};
+
+class DistanceField;
+
+// The rasterised pixels of an element in the layout expected by SDL_UpdateTexture.
+struct ElementImage {
+    SDL_Rect dest;
+    Uint32 format = SDL_PIXELFORMAT_ABGR8888;
+    int pitch = 0;
+    std::unique_ptr<uint8_t[]> pixels;
 };
 
 class LcdElementTexture {
 protected:
-    SDL_Texture* texture = nullptr;
-    SDL_Surface* surface = nullptr;
-    SDL_Rect dest;
+    // Elements bigger than the renderer's maximum texture size are split into a grid of tiles. Blended tiles are
+    // further cut down to just the parts that have any alpha so transparent areas take no texture memory or fill.
+    struct Tile {
+        SDL_Texture* texture = nullptr;
+        SDL_Rect rect;  // relative to dest
+    };
+
+    std::vector<Tile> tiles;
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    Uint32 format = SDL_PIXELFORMAT_UNKNOWN;
+    SDL_Rect dest = {0, 0, 0, 0};
+    int maxTileWidth = 0;
+    int maxTileHeight = 0;
+    bool ready = false;
+
+    void destroyTiles();
 
 public:
     ~LcdElementTexture() {
-        if (texture != nullptr)
-            SDL_DestroyTexture(texture);
-        if (surface != nullptr)
-            SDL_FreeSurface(surface);
+        destroyTiles();
     }
 
-    void createSurface(int outlineID, const ElementParameters& elementParameters);
-    
-    void createTexture(SDL_Renderer* renderer);
-    
-    void setBlendMode(SDL_BlendMode blendMode) {
-        SDL_SetTextureBlendMode(texture, blendMode);
-    }
+    // Rasterise the outline into image. This doesn't touch the renderer so is safe to call from any thread.
+    static void createImage(int outlineID, const ElementParameters& elementParameters, ElementImage& image);
+
+    // As above but the edges are reconstructed from the distance field of the outline rather than rasterising it,
+    // which is much quicker. The subSamples parameter is ignored.
+    static void createImage(const DistanceField& field, int outlineID, const ElementParameters& elementParameters,
+        ElementImage& image);
+
+    // The frame's image when elementParameters has a skin, the skin's photo covering the whole screen.
+    static void createImage(const Skin& skin, const ElementParameters& elementParameters, ElementImage& image);
+
+    // The preferred texture format of the renderer that createImage can write. RGB565 and other formats without alpha
+    // are only considered for opaque elements.
+    static Uint32 choosePixelFormat(SDL_Renderer* renderer, bool isOpaque);
+
+    // The first of count formats, in order of preference, that createImage can write, or ABGR8888 if there isn't one.
+    static Uint32 choosePixelFormat(const Uint32* formats, size_t count, bool isOpaque);
 
-    void render(SDL_Renderer* renderer) {
-        SDL_RenderCopy(renderer, texture, nullptr, &dest);
+    // Split the image into rects no bigger than maxWidth by maxHeight, relative to its dest. If trim is set the
+    // transparent parts are left out.
+    static void splitImage(const ElementImage& image, int maxWidth, int maxHeight, bool trim,
+        std::vector<SDL_Rect>& rects);
+
+    // Upload the image, replacing the current textures (if any). The existing textures are reused when the image is
+    // the same size.
+    void createTexture(SDL_Renderer* renderer, const ElementImage& image);
+
+    // Drop the textures without drawing anything until the next createTexture, for when the renderer's device has
+    // been lost along with them.
+    void destroyTexture() {
+        destroyTiles();
+        ready = false;
     }
 
-    void renderWithInset(SDL_Renderer* renderer, int inset) {
-        SDL_Rect s;
-        s.x = inset;
-        s.y = inset;
-        s.w = dest.w - inset * 2;
-        s.h = dest.h - inset * 2;
-        SDL_Rect d;
-        d.x = dest.x + inset;
-        d.y = dest.y + inset;
-        d.w = s.w;
-        d.h = s.h;
-        SDL_RenderCopy(renderer, texture, &s, &d);
+    // Elements are rasterised in the background so may not have been uploaded yet, in which case they aren't drawn.
+    bool isReady() const {
+        return ready;
     }
+
+    void setBlendMode(SDL_BlendMode blendMode);
+
+    void render(SDL_Renderer* renderer);
+
+    void renderWithInset(SDL_Renderer* renderer, int inset);
 };
 
 #endif  // LCDELEMENT_H_
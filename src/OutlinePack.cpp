@@ -0,0 +1,257 @@
+#include <SDL.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "OutlinePack.h"
+#include "SvgOutlines.h"
+
+namespace {
+    void appendUint32(std::vector<uint8_t>& out, uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<uint8_t>(value >> shift));
+    }
+
+    void appendVarint(std::vector<uint8_t>& out, uint32_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    uint32_t zigzag(int32_t value) {
+        return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    }
+
+    int actionCode(char action) {
+        return action == 'M' ? 0 : action == 'L' ? 1 : action - 'A' + 2;
+    }
+}
+
+OutlinePack::~OutlinePack() {
+    unmap();
+}
+
+void OutlinePack::unmap() {
+#ifdef _WIN32
+    if (data != nullptr && encoded.empty())
+        UnmapViewOfFile(data);
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+    if (file != nullptr)
+        CloseHandle(file);
+    mapping = nullptr;
+    file = nullptr;
+#else
+    if (data != nullptr && encoded.empty())
+        munmap(const_cast<uint8_t*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+    encoded.clear();
+    for (Entry& entry : entries) entry = Entry();
+}
+
+bool OutlinePack::open(const char* path) {
+    unmap();
+    const size_t length = std::strlen(path);
+    if (length >= 4 && SDL_strcasecmp(path + length - 4, ".svg") == 0)
+        return openSvg(path);
+
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        SDL_Log("Could not open %s: error %lu", path, GetLastError());
+        return false;
+    }
+    file = fileHandle;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        SDL_Log("%s is empty or its size can't be read.", path);
+        unmap();
+        return false;
+    }
+    mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        SDL_Log("Could not map %s: error %lu", path, GetLastError());
+        unmap();
+        return false;
+    }
+    data = static_cast<const uint8_t*>(view);
+    size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size == 0) {
+        SDL_Log("%s is empty or its size can't be read.", path);
+        close(fd);
+        return false;
+    }
+    // The mapping stays valid once the file is closed.
+    void* view = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        SDL_Log("Could not map %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    data = static_cast<const uint8_t*>(view);
+    size = static_cast<size_t>(status.st_size);
+#endif
+
+    if (!validate(path)) {
+        unmap();
+        return false;
+    }
+    return true;
+}
+
+bool OutlinePack::openSvg(const char* path) {
+    FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    std::vector<char> text;
+    char buffer[16384];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) text.insert(text.end(), buffer, buffer + read);
+    std::fclose(file);
+    text.push_back('\0');
+
+    SvgOutlines svg;
+    if (!svg.parse(text.data(), path))
+        return false;
+
+    // Encode it just as extractOutlines.py writes a pack, then it's read like any other. The names come first so that
+    // the data's offset is known.
+    const std::vector<SvgOutlines::Outline>& outlines = svg.getOutlines();
+    const size_t headerSize = 12 + 16 * outlines.size();
+    std::vector<uint8_t> names;
+    for (const SvgOutlines::Outline& outline : outlines) {
+        names.insert(names.end(), outline.label.begin(), outline.label.end());
+        names.push_back('\0');
+    }
+    const size_t dataStart = headerSize + names.size();
+
+    std::vector<uint8_t> index;
+    std::vector<uint8_t> nodes;
+    size_t nameOffset = headerSize;
+    for (const SvgOutlines::Outline& outline : outlines) {
+        const size_t nodesStart = nodes.size();
+        int lastX = 0;
+        int lastY = 0;
+        for (const Outlines::Node* node = svg.getNodes(outline); node->action != 'X'; ++node) {
+            appendVarint(nodes, zigzag(node->x - lastX) << 3 | actionCode(node->action));
+            appendVarint(nodes, zigzag(node->y - lastY));
+            lastX = node->x;
+            lastY = node->y;
+        }
+        appendUint32(index, static_cast<uint32_t>(nameOffset));
+        appendUint32(index, static_cast<uint32_t>(dataStart + nodesStart));
+        appendUint32(index, static_cast<uint32_t>(nodes.size() - nodesStart));
+        appendUint32(index, static_cast<uint32_t>(outline.nodeCount - 1));
+        nameOffset += outline.label.size() + 1;
+    }
+
+    encoded.reserve(headerSize + names.size() + nodes.size());
+    encoded.insert(encoded.end(), { 'T', 'O', 'S', 'S' });
+    appendUint32(encoded, VERSION);
+    appendUint32(encoded, static_cast<uint32_t>(outlines.size()));
+    encoded.insert(encoded.end(), index.begin(), index.end());
+    encoded.insert(encoded.end(), names.begin(), names.end());
+    encoded.insert(encoded.end(), nodes.begin(), nodes.end());
+    data = encoded.data();
+    size = encoded.size();
+
+    if (!validate(path)) {
+        unmap();
+        return false;
+    }
+    return true;
+}
+
+bool OutlinePack::validate(const char* path) {
+    if (size < 12 || std::memcmp(data, "TOSS", 4) != 0) {
+        SDL_Log("%s is not an outline pack.", path);
+        return false;
+    }
+    const uint32_t version = readUint32(data + 4);
+    const uint32_t count = readUint32(data + 8);
+    if (version != VERSION) {
+        SDL_Log("%s is version %u of the outline pack format, expected %u.", path, version, VERSION);
+        return false;
+    }
+    if (count > (size - 12) / 16) {
+        SDL_Log("%s is truncated.", path);
+        return false;
+    }
+
+    // Outlines are matched up by name so a pack can be written in any order and hold extra outlines.
+    bool found[Outlines::COUNT] = {};
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint8_t* index = data + 12 + i * 16;
+        const uint32_t nameOffset = readUint32(index);
+        const uint32_t dataOffset = readUint32(index + 4);
+        const uint32_t dataSize = readUint32(index + 8);
+        const uint32_t nodeCount = readUint32(index + 12);
+        if (nameOffset >= size || memchr(data + nameOffset, '\0', size - nameOffset) == nullptr ||
+            dataOffset > size || dataSize > size - dataOffset) {
+            SDL_Log("Outline %u of %s is outside the file.", i, path);
+            return false;
+        }
+
+        const char* name = reinterpret_cast<const char*>(data + nameOffset);
+        for (size_t outlineID = 0; outlineID < Outlines::COUNT; ++outlineID) {
+            if (std::strcmp(name, Outlines::NAMES[outlineID]) != 0)
+                continue;
+
+            // Decode it all now so that forEachNode can't fail later. Curves are three nodes A, B then C.
+            Entry entry;
+            entry.data = data + dataOffset;
+            entry.size = dataSize;
+            uint32_t nodes = 0;
+            char expected = 'M';
+            bool isOrdered = true;
+            bool isDecoded = decode(entry, [&](const Outlines::Node& node) {
+                if (expected == 'B' || expected == 'C')
+                    isOrdered = isOrdered && node.action == expected;
+                else if (nodes == 0)
+                    isOrdered = isOrdered && node.action == 'M';
+                else
+                    isOrdered = isOrdered && node.action != 'B' && node.action != 'C';
+                expected = node.action == 'A' ? 'B' : node.action == 'B' ? 'C' : 'M';
+                ++nodes;
+            });
+            if (!isDecoded || !isOrdered || nodes != nodeCount || expected != 'M') {
+                SDL_Log("Outline %s in %s is not valid.", name, path);
+                return false;
+            }
+            entries[outlineID] = entry;
+            found[outlineID] = true;
+        }
+    }
+
+    for (size_t outlineID = 0; outlineID < Outlines::COUNT; ++outlineID) {
+        if (!found[outlineID]) {
+            SDL_Log("%s has no outline for %s.", path, Outlines::NAMES[outlineID]);
+            return false;
+        }
+    }
+    return true;
+}
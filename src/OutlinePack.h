@@ -0,0 +1,95 @@
+#ifndef OUTLINEPACK_H_
+#define OUTLINEPACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Outlines.h"
+
+// Outlines loaded at run time from a pack written by info/extractOutlines.py, so a different skin doesn't need a
+// rebuild. The file is memory mapped and each outline's nodes are decoded as they are read, nothing is copied. See
+// extractOutlines.py for the format. An Inkscape SVG can be opened in place of a pack, it's read with SvgOutlines and
+// encoded in memory.
+class OutlinePack {
+protected:
+    static constexpr uint32_t VERSION = 1;
+
+    struct Entry {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    Entry entries[Outlines::COUNT];
+    // The pack encoded from an SVG, data points into this rather than a mapping when it isn't empty.
+    std::vector<uint8_t> encoded;
+
+#ifdef _WIN32
+    void* file = nullptr;
+    void* mapping = nullptr;
+#endif
+
+    static uint32_t readUint32(const uint8_t* p) {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    static int32_t unzigzag(uint32_t value) {
+        return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+    }
+
+    // Read a varint, returns false if it runs past end or is too long.
+    static bool readVarint(const uint8_t*& p, const uint8_t* end, uint32_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 35 && p < end; shift += 7) {
+            uint8_t byte = *p++;
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    // Decode one outline calling f with each node, stopping early and returning false if the data isn't valid.
+    template <typename F>
+    static bool decode(const Entry& entry, F f) {
+        static const char actions[] = { 'M', 'L', 'A', 'B', 'C' };
+        const uint8_t* p = entry.data;
+        const uint8_t* end = entry.data + entry.size;
+        Outlines::Node node = { 0, 0, 'M' };
+        while (p < end) {
+            uint32_t xAndAction;
+            uint32_t y;
+            if (!readVarint(p, end, xAndAction) || !readVarint(p, end, y) || (xAndAction & 7) >= sizeof(actions))
+                return false;
+            node.x += unzigzag(xAndAction >> 3);
+            node.y += unzigzag(y);
+            node.action = actions[xAndAction & 7];
+            f(node);
+        }
+        return true;
+    }
+
+    bool openSvg(const char* path);
+    bool validate(const char* path);
+    void unmap();
+
+public:
+    OutlinePack() = default;
+    OutlinePack(const OutlinePack&) = delete;
+    OutlinePack& operator=(const OutlinePack&) = delete;
+    ~OutlinePack();
+
+    // Map the pack, or read the SVG if path ends .svg, and check it has a valid outline for each of the names in
+    // Outlines::NAMES.
+    bool open(const char* path);
+
+    // Call f with each node of the outline in order, the same nodes as Outlines::ALL_OUTLINES less the final X.
+    template <typename F>
+    void forEachNode(size_t outlineID, F f) const {
+        decode(entries[outlineID], f);
+    }
+};
+
+#endif  // OUTLINEPACK_H_
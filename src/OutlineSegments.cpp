@@ -0,0 +1,6928 @@
+// This file was automatically generated by the extractOutlines.py script. Do not edit this file by hand.
+
+#include "Outlines.h"
+
+namespace Outlines {
+
+#ifndef NO_BUILTIN_OUTLINES
+
+const Segment SEGMENTS_BODY[] = {
+    {272829824,200959424,272901306,200959708}, {272829824,200959424,272758347,200960934}, {272901306,200959708,272972345,200961789}, 
+    {272758347,200960934,272687334,200964210}, {272972345,200961789,273042934,200965645}, {272687334,200964210,272616792,200969228}, 
+    {273042934,200965645,273113066,200971254}, {272616792,200969228,272546728,200975967}, {273113066,200971254,273182734,200978594}, 
+    {272546728,200975967,272477150,200984407}, {273182734,200978594,273251931,200987643}, {272477150,200984407,272408062,200994525}, 
+    {273251931,200987643,273320650,200998379}, {272408062,200994525,272339472,201006301}, {273320650,200998379,273388884,201010782}, 
+    {272339472,201006301,272271387,201019712}, {273388884,201010782,273456627,201024829}, {272271387,201019712,272203814,201034737}, 
+    {273456627,201024829,273523871,201040498}, {272203814,201034737,272136758,201051354}, {273523871,201040498,273590610,201057767}, 
+    {272136758,201051354,272070227,201069543}, {273590610,201057767,273656837,201076615}, {272070227,201069543,272004228,201089281}, 
+    {273656837,201076615,273722544,201097020}, {272004228,201089281,271938767,201110547}, {273722544,201097020,273787725,201118960}, 
+    {271938767,201110547,271873850,201133319}, {273787725,201118960,273852373,201142414}, {271873850,201133319,271809485,201157576}, 
+    {273852373,201142414,273916481,201167359}, {271809485,201157576,271745679,201183297}, {273916481,201167359,273980042,201193774}, 
+    {271745679,201183297,271682437,201210460}, {273980042,201193774,274043049,201221637}, {271682437,201210460,271619766,201239043}, 
+    {274043049,201221637,274105496,201250927}, {271619766,201239043,271557674,201269026}, {274105496,201250927,274167375,201281621}, 
+    {271557674,201269026,271496167,201300385}, {274167375,201281621,274228679,201313697}, {271496167,201300385,271435251,201333101}, 
+    {274228679,201313697,274289402,201347135}, {271435251,201333101,271374934,201367151}, {274289402,201347135,274349536,201381912}, 
+    {271374934,201367151,271315222,201402513}, {274349536,201381912,274409075,201418006}, {271315222,201402513,271256121,201439168}, 
+    {274409075,201418006,274468012,201455396}, {271256121,201439168,271197639,201477092}, {274468012,201455396,274526340,201494059}, 
+    {271197639,201477092,271139781,201516264}, {274526340,201494059,274584052,201533975}, {271139781,201516264,271082556,201556663}, 
+    {274584052,201533975,274641141,201575121}, {271082556,201556663,271025968,201598268}, {274641141,201575121,274697600,201617476}, 
+    {271025968,201598268,270970026,201641057}, {274697600,201617476,274753422,201661017}, {270970026,201641057,270914736,201685007}, 
+    {274753422,201661017,274808600,201705723}, {270914736,201685007,270860104,201730099}, {274808600,201705723,274863128,201751573}, 
+    {270860104,201730099,270806137,201776310}, {274863128,201751573,274916998,201798544}, {270806137,201776310,270752842,201823619}, 
+    {274916998,201798544,274970204,201846614}, {270752842,201823619,270700225,201872004}, {274970204,201846614,275074595,201945967}, 
+    {270700225,201872004,270597055,201971917}, {275074595,201945967,275176245,202049458}, {270597055,201971917,270496678,202075877}, 
+    {275176245,202049458,275275100,202156911}, {270496678,202075877,270399149,202183712}, {275275100,202156911,275371103,202268153}, 
+    {270399149,202183712,270304522,202295250}, {275371103,202268153,275464199,202383010}, {270304522,202295250,270212849,202410318}, 
+    {275464199,202383010,275554334,202501307}, {270212849,202410318,270124184,202528746}, {275554334,202501307,275641451,202622870}, 
+    {270124184,202528746,270038581,202650360}, {275641451,202622870,275725496,202747526}, {270038581,202650360,269956093,202774988}, 
+    {275725496,202747526,275806413,202875099}, {269956093,202774988,269876773,202902460}, {275806413,202875099,275884147,203005416}, 
+    {269876773,202902460,269800676,203032601}, {275884147,203005416,275958643,203138302}, {269800676,203032601,269727854,203165241}, 
+    {275958643,203138302,276029845,203273583}, {269727854,203165241,269658361,203300208}, {276029845,203273583,276097698,203411085}, 
+    {269658361,203300208,269592251,203437328}, {276097698,203411085,276162147,203550634}, {269592251,203437328,269529577,203576431}, 
+    {276162147,203550634,276223136,203692056}, {269529577,203576431,269470392,203717344}, {276223136,203692056,276280610,203835176}, 
+    {269470392,203717344,269414750,203859895}, {276280610,203835176,276334515,203979820}, {269414750,203859895,269362705,204003912}, 
+    {276334515,203979820,276384793,204125814}, {269362705,204003912,269314309,204149222}, {276384793,204125814,276431391,204272983}, 
+    {269314309,204149222,269269617,204295655}, {276431391,204272983,276474253,204421154}, {269269617,204295655,269228682,204443037}, 
+    {276474253,204421154,276513323,204570153}, {269228682,204443037,269191557,204591196}, {276513323,204570153,276548547,204719804}, 
+    {269191557,204591196,269158296,204739962}, {276548547,204719804,276579869,204869935}, {269158296,204739962,269128952,204889160}, 
+    {276579869,204869935,276607234,205020370}, {269128952,204889160,269103579,205038620}, {276607234,205020370,276630585,205170935}, 
+    {269103579,205038620,269082230,205188170}, {276630585,205170935,276649870,205321457}, {269082230,205188170,269064960,205337636}, 
+    {276649870,205321457,276665030,205471760}, {269064960,205337636,269051820,205486848}, {276665030,205471760,276676013,205621672}, 
+    {269051820,205486848,269042865,205635633}, {276676013,205621672,276682761,205771017}, {269042865,205635633,269038148,205783819}, 
+    {276682761,205771017,276685221,205919621}, {269038148,205783819,269037723,205931234}, {276685221,205919621,276683336,206067311}, 
+    {269037723,205931234,269041643,206077706}, {276683336,206067311,276677051,206213912}, {269041643,206077706,269049962,206223063}, 
+    {276677051,206213912,276666312,206359249}, {269049962,206223063,269062732,206367132}, {276666312,206359249,276651062,206503149}, 
+    {269062732,206367132,269080009,206509742}, {276651062,206503149,276631247,206645437}, {269080009,206509742,269101844,206650720}, 
+    {276631247,206645437,276606810,206785940}, {269101844,206650720,269114488,206720544}, {269114488,206720544,269128292,206789895}, 
+    {276606810,206785940,276592842,206855467}, {269128292,206789895,269143263,206858753}, {276592842,206855467,276577698,206924482}, 
+    {269143263,206858753,269159406,206927095}, {276577698,206924482,276561371,206992964}, {269159406,206927095,269176730,206994900}, 
+    {276561371,206992964,276543854,207060890}, {269176730,206994900,269195240,207062147}, {276543854,207060890,276525140,207128240}, 
+    {269195240,207062147,269214943,207128813}, {276525140,207128240,276505223,207194990}, {269214943,207128813,269235846,207194879}, 
+    {269235846,207194879,269257956,207260321}, {276505223,207194990,276484095,207261120}, {269257956,207260321,269281279,207325119}, 
+    {276484095,207261120,276461750,207326607}, {269281279,207325119,269305823,207389251}, {276461750,207326607,276438181,207391430}, 
+    {269305823,207389251,269331592,207452695}, {276438181,207391430,276413380,207455567}, {269331592,207452695,269358596,207515431}, 
+    {276413380,207455567,276387341,207518996}, {269358596,207515431,269386839,207577436}, {276387341,207518996,276360057,207581696}, 
+    {269386839,207577436,269416329,207638689}, {276360057,207581696,276331521,207643644}, {269416329,207638689,269447072,207699168}, 
+    {276331521,207643644,276301726,207704819}, {269447072,207699168,269479076,207758853}, {276301726,207704819,276270665,207765200}, 
+    {269479076,207758853,269512346,207817721}, {276270665,207765200,276238332,207824763}, {269512346,207817721,269546889,207875750}, 
+    {276238332,207824763,276204718,207883488}, {269546889,207875750,269582713,207932921}, {276204718,207883488,276169819,207941354}, 
+    {269582713,207932921,269619824,207989210}, {276169819,207941354,276133626,207998337}, {269619824,207989210,269658228,208044596}, 
+    {276133626,207998337,276096132,208054416}, {269658228,208044596,269697933,208099059}, {276096132,208054416,276057331,208109570}, 
+    {269697933,208099059,269738944,208152576}, {276057331,208109570,276017216,208163776}, {269738944,208152576,269748408,208164962}, 
+    {276017216,208163776,276012576,208170002}, {269748408,208164962,269757579,208177660}, {276012576,208170002,276008061,208176296}, 
+    {276008061,208176296,276003669,208182655}, {269757579,208177660,269766459,208190655}, {276003669,208182655,275999400,208189078}, 
+    {275999400,208189078,275995254,208195564}, {269766459,208190655,269775044,208203934}, {275995254,208195564,275991230,208202110}, 
+    {275991230,208202110,275987326,208208715}, {269775044,208203934,269783336,208217480}, {275987326,208208715,275983543,208215378}, 
+    {275983543,208215378,275976335,208228868}, {269783336,208217480,269791331,208231281}, {275976335,208228868,275969599,208242569}, 
+    {269791331,208231281,269799030,208245320}, {275969599,208242569,275963331,208256465}, {269799030,208245320,269806432,208259585}, 
+    {275963331,208256465,275957524,208270545}, {269806432,208259585,269813534,208274059}, {275957524,208270545,275952173,208284794}, 
+    {269813534,208274059,269820338,208288729}, {275952173,208284794,275947272,208299200}, {269820338,208288729,269826841,208303580}, 
+    {275947272,208299200,275942815,208313749}, {269826841,208303580,269833042,208318597}, {275942815,208313749,275938797,208328428}, 
+    {269833042,208318597,269838941,208333766}, {275938797,208328428,275935213,208343224}, {269838941,208333766,269844536,208349072}, 
+    {275935213,208343224,275932056,208358123}, {269844536,208349072,269849827,208364501}, {275932056,208358123,275929321,208373112}, 
+    {269849827,208364501,269854812,208380038}, {275929321,208373112,275927003,208388178}, {269854812,208380038,269859491,208395668}, 
+    {275927003,208388178,275925095,208403308}, {269859491,208395668,269863862,208411378}, {275925095,208403308,275923592,208418488}, 
+    {269863862,208411378,269867925,208427152}, {275923592,208418488,275922489,208433705}, {269867925,208427152,269871679,208442975}, 
+    {275922489,208433705,275921780,208448946}, {269871679,208442975,269875122,208458834}, {275921780,208448946,275921458,208464197}, 
+    {269875122,208458834,269878253,208474714}, {275921458,208464197,275921519,208479446}, {269878253,208474714,269881073,208490599}, 
+    {275921519,208479446,275921957,208494679}, {269881073,208490599,269883578,208506476}, {275921957,208494679,275922767,208509882}, 
+    {269883578,208506476,269885770,208522330}, {275922767,208509882,275923941,208525043}, {269885770,208522330,269887646,208538147}, 
+    {275923941,208525043,275925476,208540148}, {269887646,208538147,269889206,208553911}, {275925476,208540148,275927365,208555184}, 
+    {269889206,208553911,269890448,208569609}, {275927365,208555184,275929603,208570138}, {269890448,208569609,269891372,208585225}, 
+    {275929603,208570138,275932184,208584996}, {275932184,208584996,275935102,208599745}, {269891372,208585225,269891977,208600745}, 
+    {275935102,208599745,275938352,208614372}, {269891977,208600745,269892261,208616155}, {275938352,208614372,275941928,208628864}, 
+    {269892261,208616155,269892224,208631440}, {275941928,208628864,275945825,208643207}, {269892224,208631440,269891865,208646585}, 
+    {275945825,208643207,275950036,208657388}, {269891865,208646585,269891182,208661576}, {275950036,208657388,275954557,208671394}, 
+    {269891182,208661576,269890175,208676399}, {275954557,208671394,275959381,208685211}, {269890175,208676399,269888843,208691038}, 
+    {275959381,208685211,275964503,208698826}, {269888843,208691038,269887184,208705479}, {275964503,208698826,275969917,208712227}, 
+    {269887184,208705479,269885199,208719708}, {275969917,208712227,275975618,208725399}, {269885199,208719708,269882885,208733710}, 
+    {275975618,208725399,275981600,208738330}, {269882885,208733710,269880242,208747470}, {275981600,208738330,275987858,208751006}, 
+    {269880242,208747470,269877268,208760974}, {275987858,208751006,275994385,208763413}, {269877268,208760974,269873963,208774207}, 
+    {275994385,208763413,276001176,208775539}, {269873963,208774207,269870326,208787155}, {276001176,208775539,276008226,208787371}, 
+    {269870326,208787155,269866356,208799803}, {276008226,208787371,276015529,208798895}, {276015529,208798895,276023078,208810097}, 
+    {269866356,208799803,269862052,208812137}, {276023078,208810097,276030870,208820966}, {269862052,208812137,269857413,208824142}, 
+    {276030870,208820966,276038897,208831486}, {269857413,208824142,269854967,208830016}, {269854967,208830016,269852437,208835803}, 
+    {276038897,208831486,276047155,208841645}, {269852437,208835803,269849823,208841500}, {269849823,208841500,269847124,208847106}, 
+    {276047155,208841645,276055637,208851431}, {269847124,208847106,269844341,208852619}, {276055637,208851431,276064338,208860828}, 
+    {269844341,208852619,269841473,208858036}, {269841473,208858036,269838520,208863357}, {276064338,208860828,276073252,208869825}, 
+    {269838520,208863357,269835483,208868579}, {269835483,208868579,269832360,208873701}, {276073252,208869825,276077788,208874169}, 
+    {269832360,208873701,269829153,208878721}, {276077788,208874169,276082375,208878408}, {276082375,208878408,276087012,208882540}, 
+    {269829153,208878721,269825860,208883636}, {276087012,208882540,276091699,208886563}, {269825860,208883636,269822481,208888445}, 
+    {276091699,208886563,276096435,208890477}, {269822481,208888445,269819017,208893147}, {276096435,208890477,276101220,208894278}, 
+    {269819017,208893147,269815468,208897739}, {276101220,208894278,276106052,208897966}, {269815468,208897739,269811832,208902220}, 
+    {276106052,208897966,276110931,208901539}, {276110931,208901539,276115857,208904995}, {269811832,208902220,269808111,208906588}, 
+    {276115857,208904995,276120828,208908333}, {269808111,208906588,269804304,208910840}, {276120828,208908333,276125844,208911551}, 
+    {269804304,208910840,269800410,208914976}, {276125844,208911551,276130904,208914647}, {276130904,208914647,276136008,208917619}, 
+    {269800410,208914976,269796431,208918993}, {276136008,208917619,276141154,208920466}, {269796431,208918993,269792364,208922889}, 
+    {276141154,208920466,276146343,208923187}, {269792364,208922889,269788212,208926663}, {276146343,208923187,276151573,208925779}, 
+    {276151573,208925779,276156843,208928241}, {269788212,208926663,269783973,208930313}, {276156843,208928241,276162154,208930572}, 
+    {269783973,208930313,269779647,208933838}, {276162154,208930572,276167503,208932769}, {276167503,208932769,276172892,208934831}, 
+    {269779647,208933838,269775234,208937234}, {276172892,208934831,276178318,208936757}, {276178318,208936757,276183781,208938544}, 
+    {269775234,208937234,269770734,208940501}, {276183781,208938544,276189281,208940191}, {276189281,208940191,276194816,208941696}, 
+    {269770734,208940501,269766147,208943636}, {276194816,208941696,276511460,209028810}, {269766147,208943636,269761472,208946638}, 
+    {269761472,208946638,269756711,208949505}, {269756711,208949505,269751861,208952235}, {269751861,208952235,269746924,208954826}, 
+    {269746924,208954826,269741900,208957277}, {269741900,208957277,269736787,208959586}, {269736787,208959586,269731587,208961750}, 
+    {269731587,208961750,269726298,208963769}, {269726298,208963769,269720921,208965639}, {269720921,208965639,269715456,208967360}, 
+    {269715456,208967360,269411202,209062603}, {276511460,209028810,276828982,209126709}, {269411202,209062603,269101835,209167866}, 
+    {276828982,209126709,277146772,209234938}, {269101835,209167866,268788287,209282739}, {277146772,209234938,277464221,209353044}, 
+    {268788287,209282739,268471492,209406814}, {277464221,209353044,277780720,209480571}, {268471492,209406814,268152383,209539681}, 
+    {277780720,209480571,278095659,209617064}, {268152383,209539681,267831893,209680930}, {278095659,209617064,278408428,209762070}, 
+    {267831893,209680930,267510954,209830152}, {278408428,209762070,278718419,209915134}, {267510954,209830152,267190500,209986936}, 
+    {278718419,209915134,279025021,210075801}, {267190500,209986936,266871464,210150874}, {279025021,210075801,279327626,210243617}, 
+    {266871464,210150874,266554779,210321556}, {279327626,210243617,279625624,210418127}, {266554779,210321556,266241378,210498572}, 
+    {279625624,210418127,279918405,210598877}, {266241378,210498572,265932194,210681514}, {279918405,210598877,280205360,210785412}, 
+    {265932194,210681514,265628159,210869970}, {280205360,210785412,280485880,210977278}, {265628159,210869970,265330208,211063532}, 
+    {280485880,210977278,280759355,211174020}, {265330208,211063532,265039274,211261791}, {280759355,211174020,281025176,211375184}, 
+    {265039274,211261791,264756288,211464336}, {281025176,211375184,281282733,211580315}, {264756288,211464336,264482185,211670758}, 
+    {268065052,211492023,268043645,211492331}, {268065052,211492023,268086335,211492434}, {268043645,211492331,268022118,211493349}, 
+    {268086335,211492434,268096928,211492912}, {268096928,211492912,268107487,211493574}, {268022118,211493349,268000479,211495069}, 
+    {268107487,211493574,268118013,211494419}, {268118013,211494419,268128503,211495451}, {268000479,211495069,267978732,211497481}, 
+    {268128503,211495451,268138959,211496668}, {268138959,211496668,268149377,211498073}, {267978732,211497481,267956883,211500577}, 
+    {268149377,211498073,268159759,211499667}, {268159759,211499667,268170104,211501451}, {267956883,211500577,267934939,211504347}, 
+    {268170104,211501451,268180410,211503425}, {268180410,211503425,268190677,211505592}, {267934939,211504347,267912905,211508784}, 
+    {268190677,211505592,268200904,211507952}, {268200904,211507952,268211090,211510506}, {267912905,211508784,267890786,211513877}, 
+    {268211090,211510506,268221235,211513256}, {268221235,211513256,268231338,211516202}, {267890786,211513877,267868589,211519618}, 
+    {268231338,211516202,268241399,211519346}, {268241399,211519346,268251416,211522688}, {267868589,211519618,267846319,211525999}, 
+    {268251416,211522688,268261389,211526231}, {267846319,211525999,267823983,211533009}, {268261389,211526231,268271316,211529974}, 
+    {268271316,211529974,268281199,211533919}, {267823983,211533009,267801585,211540641}, {268281199,211533919,268291035,211538068}, 
+    {268291035,211538068,268300824,211542421}, {267801585,211540641,267779131,211548885}, {268300824,211542421,268310565,211546980}, 
+    {268310565,211546980,268320258,211551744}, {267779131,211548885,267756629,211557733}, {268320258,211551744,268329901,211556717}, 
+    {268329901,211556717,268339495,211561898}, {267756629,211557733,267734082,211567175}, {268339495,211561898,268349038,211567290}, 
+    {267734082,211567175,267711497,211577203}, {268349038,211567290,268358529,211572892}, {268358529,211572892,268367968,211578706}, 
+    {267711497,211577203,267688880,211587808}, {268367968,211578706,268377355,211584734}, {281282733,211580315,281531417,211788958}, 
+    {268377355,211584734,268386688,211590976}, {267688880,211587808,267666236,211598980}, {268386688,211590976,268389796,211593167}, 
+    {268389796,211593167,268392851,211595465}, {268392851,211595465,268395854,211597867}, {268395854,211597867,268398804,211600374}, 
+    {267666236,211598980,267643572,211610711}, {268398804,211600374,268401703,211602984}, {268401703,211602984,268404550,211605697}, 
+    {268404550,211605697,268407348,211608512}, {268407348,211608512,268410095,211611429}, {267643572,211610711,267620893,211622992}, 
+    {268410095,211611429,268412793,211614445}, {268412793,211614445,268415442,211617561}, {268415442,211617561,268418044,211620777}, 
+    {268418044,211620777,268420597,211624090}, {267620893,211622992,267598204,211635815}, {268420597,211624090,268423103,211627500}, 
+    {268423103,211627500,268425563,211631007}, {268425563,211631007,268427977,211634610}, {268427977,211634610,268430345,211638307}, 
+    {267598204,211635815,267575512,211649169}, {268430345,211638307,268432669,211642099}, {268432669,211642099,268434948,211645984}, 
+    {268434948,211645984,268437183,211649962}, {267575512,211649169,267530141,211677439}, {268437183,211649962,268439375,211654032}, 
+    {268439375,211654032,268443632,211662443}, {268443632,211662443,268447723,211671212}, {264482185,211670758,264217897,211880648}, 
+    {268447723,211671212,268451651,211680333}, {267530141,211677439,267484826,211707731}, {268451651,211680333,268455423,211689799}, 
+    {268455423,211689799,268459041,211699605}, {268459041,211699605,268462511,211709743}, {267484826,211707731,267439612,211739973}, 
+    {268462511,211709743,268465837,211720208}, {268465837,211720208,268469023,211730993}, {268469023,211730993,268472074,211742092}, 
+    {267439612,211739973,267394547,211774094}, {268472074,211742092,268474994,211753499}, {268474994,211753499,268480460,211777212}, 
+    {267394547,211774094,267349675,211810024}, {268480460,211777212,268485457,211802081}, {281531417,211788958,281770618,212000660}, 
+    {268485457,211802081,268490019,211828056}, {267349675,211810024,267305044,211847690}, {268490019,211828056,268494182,211855088}, 
+    {267305044,211847690,267260700,211887021}, {268494182,211855088,268501453,211912120}, {277933496,211876808,277946917,211877085}, 
+    {277933496,211876808,277920111,211876866}, {277920111,211876866,277906765,211877258}, {277946917,211877085,277960374,211877697}, 
+    {277906765,211877258,277893460,211877985}, {277960374,211877697,277973864,211878644}, {277893460,211877985,277880197,211879046}, 
+    {277973864,211878644,277987385,211879926}, {277880197,211879046,277866979,211880442}, {277987385,211879926,278000935,211881543}, 
+    {277866979,211880442,277853807,211882172}, {264217897,211880648,263964357,212093596}, {278000935,211881543,278014514,211883495}, 
+    {277853807,211882172,277840683,211884237}, {278014514,211883495,278028118,211885782}, {277840683,211884237,277827610,211886635}, 
+    {278028118,211885782,278041745,211888404}, {277827610,211886635,277814588,211889368}, {267260700,211887021,267216689,211927947}, 
+    {278041745,211888404,278055395,211891361}, {277814588,211889368,277801620,211892436}, {278055395,211891361,278069065,211894654}, 
+    {277801620,211892436,277788708,211895837}, {278069065,211894654,278082753,211898282}, {277788708,211895837,277775853,211899572}, 
+    {278082753,211898282,278096457,211902245}, {277775853,211899572,277763058,211903642}, {278096457,211902245,278110176,211906544}, 
+    {277763058,211903642,277750324,211908045}, {278110176,211906544,278123907,211911178}, {277750324,211908045,277737653,211912782}, 
+    {278123907,211911178,278137649,211916149}, {268501453,211912120,268507555,211972777}, {277737653,211912782,277725047,211917852}, 
+    {278137649,211916149,278151400,211921454}, {277725047,211917852,277712508,211923257}, {278151400,211921454,278165158,211927096}, 
+    {277712508,211923257,277700038,211928995}, {278165158,211927096,278178921,211933073}, {267216689,211927947,267173056,211970395}, 
+    {277700038,211928995,277687638,211935067}, {278178921,211933073,278192687,211939386}, {277687638,211935067,277675311,211941472}, 
+    {278192687,211939386,278206455,211946036}, {277675311,211941472,277663059,211948211}, {278206455,211946036,278220222,211953021}, 
+    {277663059,211948211,277650882,211955283}, {278220222,211953021,278233986,211960342}, {277650882,211955283,277638784,211962688}, 
+    {278233986,211960342,278247747,211967999}, {277638784,211962688,277635595,211964743}, {277635595,211964743,277632439,211966883}, 
+    {277632439,211966883,277629316,211969107}, {278247747,211967999,278261501,211975993}, {277629316,211969107,277626225,211971415}, 
+    {267173056,211970395,267129849,212014295}, {277626225,211971415,277623167,211973806}, {268507555,211972777,268512771,212036658}, 
+    {277623167,211973806,277620141,211976280}, {278261501,211975993,278275247,211984323}, {277620141,211976280,277617147,211978836}, 
+    {277617147,211978836,277614183,211981472}, {277614183,211981472,277611250,211984190}, {277611250,211984190,277608347,211986988}, 
+    {278275247,211984323,278288983,211992989}, {277608347,211986988,277605475,211989865}, {277605475,211989865,277602631,211992821}, 
+    {277602631,211992821,277599817,211995855}, {278288983,211992989,278302708,212001992}, {277599817,211995855,277597032,211998967}, 
+    {277597032,211998967,277591545,212005422}, {281770618,212000660,281999728,212214965}, {278302708,212001992,278330114,212021006}, 
+    {277591545,212005422,277586169,212012180}, {277586169,212012180,277580899,212019236}, {267129849,212014295,267087113,212059576}, 
+    {277580899,212019236,277575734,212026585}, {278330114,212021006,278357451,212041367}, {277575734,212026585,277570669,212034224}, 
+    {277570669,212034224,277565701,212042146}, {268512771,212036658,268521682,212172493}, {278357451,212041367,278384703,212063075}, 
+    {277565701,212042146,277560828,212050347}, {277560828,212050347,277556046,212058822}, {277556046,212058822,277551352,212067567}, 
+    {267087113,212059576,267044895,212106165}, {278384703,212063075,278411856,212086130}, {277551352,212067567,277546742,212076576}, 
+    {277546742,212076576,277542215,212085844}, {277542215,212085844,277533392,212105139}, {278411856,212086130,278438895,212110533}, 
+    {263964357,212093596,263722498,212309192}, {277533392,212105139,277524858,212125413}, {267044895,212106165,267003240,212153992}, 
+    {278438895,212110533,278465804,212136284}, {277524858,212125413,277516587,212146627}, {278465804,212136284,278492568,212163384}, 
+    {277516587,212146627,277508555,212168743}, {267003240,212153992,266962195,212202986}, {278492568,212163384,278519173,212191834}, 
+    {277508555,212168743,277500737,212191721}, {268521682,212172493,268541368,212465248}, {277500737,212191721,277485637,212240107}, 
+    {278519173,212191834,278545604,212221633}, {266962195,212202986,266921807,212253074}, {281999728,212214965,282218136,212431419}, 
+    {278545604,212221633,278571845,212252783}, {277485637,212240107,277471087,212291474}, {278571845,212252783,278597882,212285284}, 
+    {266921807,212253074,266882121,212304187}, {278597882,212285284,278623699,212319136}, {277471087,212291474,277456884,212345510}, 
+    {266882121,212304187,266843184,212356253}, {263722498,212309192,263493255,212527028}, {278623699,212319136,278649282,212354340}, 
+    {277456884,212345510,277428714,212460340}, {278649282,212354340,278674616,212390897}, {266843184,212356253,266805041,212409199}, 
+    {278674616,212390897,278699686,212428806}, {266805041,212409199,266767739,212462956}, {278699686,212428806,278724476,212468069}, 
+    {282218136,212431419,282425233,212649567}, {277428714,212460340,277367656,212708296}, {266767739,212462956,266731325,212517452}, 
+    {268541368,212465248,268548334,212540495}, {278724476,212468069,278748972,212508686}, {278748972,212508686,278773159,212550658}, 
+    {266731325,212517452,266695844,212572615}, {263493255,212527028,263383655,212636657}, {268548334,212540495,268556685,212615764}, 
+    {278773159,212550658,278797021,212593984}, {266695844,212572615,266661342,212628375}, {278797021,212593984,278820545,212638666}, 
+    {268556685,212615764,268566705,212690657}, {266661342,212628375,266627866,212684660}, {263383655,212636657,263277558,212746693}, 
+    {278820545,212638666,278843714,212684705}, {271123443,212642310,271118179,212642352}, {271123443,212642310,271128688,212642417}, 
+    {271118179,212642352,271112893,212642542}, {271128688,212642417,271133913,212642674}, {271112893,212642542,271107588,212642878}, 
+    {271133913,212642674,271139117,212643084}, {271107588,212642878,271102261,212643359}, {271139117,212643084,271144302,212643647}, 
+    {271102261,212643359,271096914,212643982}, {271144302,212643647,271149468,212644366}, {271096914,212643982,271091546,212644747}, 
+    {271149468,212644366,271154614,212645242}, {271091546,212644747,271086156,212645653}, {271154614,212645242,271159740,212646276}, 
+    {271086156,212645653,271080745,212646696}, {271159740,212646276,271164848,212647469}, {271080745,212646696,271075313,212647877}, 
+    {271164848,212647469,271169936,212648824}, {271075313,212647877,271069859,212649193}, {271169936,212648824,271175006,212650342}, 
+    {271069859,212649193,271064384,212650643}, {282425233,212649567,282620410,212868956}, {271175006,212650342,271180057,212652025}, 
+    {271064384,212650643,271058886,212652226}, {271180057,212652025,271185090,212653873}, {271058886,212652226,271053367,212653939}, 
+    {271185090,212653873,271190104,212655889}, {271053367,212653939,271047825,212655781}, {271047825,212655781,271042261,212657752}, 
+    {271190104,212655889,271195100,212658073}, {271042261,212657752,271036674,212659849}, {271195100,212658073,271200078,212660429}, 
+    {271036674,212659849,271031064,212662070}, {271200078,212660429,271205039,212662956}, {271031064,212662070,271025432,212664415}, 
+    {271205039,212662956,271209981,212665657}, {271025432,212664415,271014098,212669468}, {271209981,212665657,271214906,212668533}, 
+    {271214906,212668533,271219814,212671585}, {271014098,212669468,271002671,212674995}, {271219814,212671585,271224704,212674816}, 
+    {271224704,212674816,271230028,212678519}, {271002671,212674995,270991149,212680986}, {271230028,212678519,271235306,212682349}, 
+    {270991149,212680986,270979531,212687426}, {271235306,212682349,271240537,212686305}, {266627866,212684660,266595462,212741398}, 
+    {278843714,212684705,278866513,212732099}, {271240537,212686305,271245722,212690386}, {270979531,212687426,270967816,212694304}, 
+    {271245722,212690386,271250860,212694592}, {268566705,212690657,268578679,212764771}, {270967816,212694304,270956003,212701608}, 
+    {271250860,212694592,271255951,212698921}, {271255951,212698921,271260996,212703373}, {270956003,212701608,270944090,212709326}, 
+    {271260996,212703373,271265994,212707947}, {271265994,212707947,271270946,212712642}, {277367656,212708296,277350231,212772277}, 
+    {270944090,212709326,270932076,212717446}, {271270946,212712642,271275852,212717458}, {270932076,212717446,270919960,212725954}, 
+    {271275852,212717458,271285523,212727447}, {270919960,212725954,270895417,212744090}, {271285523,212727447,271295008,212737910}, 
+    {278866513,212732099,278888929,212780851}, {271295008,212737910,271304306,212748838}, {266595462,212741398,266564177,212798519}, 
+    {270895417,212744090,270870451,212763637}, {263277558,212746693,263175082,212857083}, {271304306,212748838,271313419,212760227}, 
+    {274554108,212753991,274559565,212754041}, {274554108,212753991,274548682,212754093}, {274559565,212754041,274565053,212754243}, 
+    {274548682,212754093,274543289,212754350}, {274565053,212754243,274570573,212754595}, {274543289,212754350,274537926,212754763}, 
+    {274570573,212754595,274576125,212755096}, {274537926,212754763,274532595,212755334}, {274576125,212755096,274581708,212755743}, 
+    {274532595,212755334,274527295,212756064}, {274581708,212755743,274587323,212756535}, {274527295,212756064,274522027,212756955}, 
+    {274587323,212756535,274592970,212757471}, {274522027,212756955,274516789,212758009}, {274592970,212757471,274598649,212758549}, 
+    {274516789,212758009,274511583,212759227}, {274598649,212758549,274604359,212759768}, {274511583,212759227,274506408,212760610}, 
+    {274604359,212759768,274610102,212761125}, {271313419,212760227,271322345,212772070}, {274506408,212760610,274501264,212762160}, 
+    {274610102,212761125,274615876,212762620}, {274501264,212762160,274496151,212763879}, {274615876,212762620,274621683,212764251}, 
+    {270870451,212763637,270845051,212784497}, {274496151,212763879,274491069,212765768}, {274621683,212764251,274627521,212766016}, 
+    {268578679,212764771,268585487,212801412}, {274491069,212765768,274486017,212767829}, {274627521,212766016,274633392,212767913}, 
+    {274486017,212767829,274480997,212770064}, {274633392,212767913,274639295,212769942}, {274639295,212769942,274645230,212772100}, 
+    {274480997,212770064,274476007,212772473}, {271322345,212772070,271331086,212784360}, {274645230,212772100,274657198,212776799}, 
+    {277350231,212772277,277331537,212836430}, {274476007,212772473,274471049,212775059}, {274471049,212775059,274466121,212777823}, 
+    {274657198,212776799,274669295,212781997}, {274466121,212777823,274461223,212780767}, {274461223,212780767,274456356,212783892}, 
+    {278888929,212780851,278932548,212882428}, {274669295,212781997,274681522,212787682}, {274456356,212783892,274451520,212787200}, 
+    {271331086,212784360,271339640,212797093}, {270845051,212784497,270819208,212806572}, {274451520,212787200,274446267,212790983}, 
+    {274681522,212787682,274693879,212793842}, {274446267,212790983,274441075,212794881}, {274693879,212793842,274706367,212800463}, 
+    {274441075,212794881,274435945,212798894}, {271339640,212797093,271348009,212810260}, {266564177,212798519,266534055,212855951}, 
+    {274435945,212798894,274430875,212803022}, {274706367,212800463,274718986,212807533}, {268585487,212801412,268592889,212837708}, 
+    {274430875,212803022,274425867,212807263}, {270819208,212806572,270766151,212853978}, {274425867,212807263,274420919,212811617}, 
+    {274718986,212807533,274731736,212815040}, {271348009,212810260,271356191,212823857}, {274420919,212811617,274416032,212816083}, 
+    {274731736,212815040,274744619,212822971}, {274416032,212816083,274411206,212820660}, {274411206,212820660,274406440,212825349}, 
+    {274744619,212822971,274770781,212840056}, {271356191,212823857,271364187,212837876}, {274406440,212825349,274401735,212830147}, 
+    {274401735,212830147,274397090,212835055}, {274397090,212835055,274392505,212840072}, {277331537,212836430,277311373,212900445}, 
+    {268592889,212837708,268600922,212873609}, {271364187,212837876,271371997,212852313}, {274770781,212840056,274797476,212858688}, 
+    {274392505,212840072,274383515,212850429}, {274383515,212850429,274374765,212861212}, {271371997,212852313,271379622,212867159}, 
+    {270766151,212853978,270654276,212959080}, {266534055,212855951,266505144,212913623}, {263175082,212857083,263076342,212967777}, 
+    {274797476,212858688,274824706,212878765}, {274374765,212861212,274366253,212872416}, {271379622,212867159,271387060,212882410}, 
+    {282620410,212868956,282713338,212978973}, {274366253,212872416,274357979,212884036}, {268600922,212873609,268609621,212909066}, 
+    {274824706,212878765,274852475,212900188}, {271387060,212882410,271394312,212898060}, {278932548,212882428,278974450,212989439}, 
+    {274357979,212884036,274349941,212896065}, {274349941,212896065,274342138,212908499}, {271394312,212898060,271401378,212914101}, 
+    {274852475,212900188,274880786,212922857}, {277311373,212900445,277289537,212964007}, {274342138,212908499,274334571,212921331}, 
+    {268609621,212909066,268619021,212944029}, {266505144,212913623,266477490,212971463}, {271401378,212914101,271408258,212930527}, 
+    {274334571,212921331,274327237,212934556}, {274880786,212922857,274939046,212971530}, {271408258,212930527,271414953,212947333}, 
+    {274327237,212934556,274320136,212948169}, {268619021,212944029,268629158,212978446}, {271414953,212947333,271427784,212982059}, 
+    {274320136,212948169,274313268,212962164}, {270654276,212959080,270534186,213072697}, {274313268,212962164,274306630,212976535}, 
+    {277289537,212964007,277265827,213026807}, {263076342,212967777,262981456,213078724}, {266477490,212971463,266451139,213029401}, 
+    {274939046,212971530,275062208,213079411}, {274306630,212976535,274300223,212991277}, {268629158,212978446,268640066,213012269}, 
+    {282713338,212978973,282803057,213089130}, {271427784,212982059,271439871,213018228}, {278974450,212989439,279014516,213101888}, 
+    {274300223,212991277,274294044,213006385}, {274294044,213006385,274288095,213021852}, {268640066,213012269,268651783,213045448}, 
+    {271439871,213018228,271451214,213055790}, {274288095,213021852,274282372,213037673}, {277265827,213026807,277253206,213057823}, 
+    {266451139,213029401,266426137,213087365}, {274282372,213037673,274276876,213053843}, {268651783,213045448,268664343,213077932}, 
+    {274276876,213053843,274271606,213070356}, {271451214,213055790,271461814,213094697}, {277253206,213057823,277240040,213088531}, 
+    {274271606,213070356,274266560,213087206}, {270534186,213072697,270470860,213130747}, {268664343,213077932,268677781,213109671}, 
+    {262981456,213078724,262890540,213189872}, {275062208,213079411,275194395,213195992}, {274266560,213087206,274257139,213121897}, 
+    {266426137,213087365,266402530,213145284}, {277240040,213088531,277226305,213118892}, {282803057,213089130,282889491,213199370}, 
+    {271461814,213094697,271471671,213134897}, {279014516,213101888,279052626,213219780}, {268677781,213109671,268684841,213125246}, 
+    {277226305,213118892,277211976,213148868}, {274257139,213121897,274248606,213157870}, {268684841,213125246,268692133,213140615}, 
+    {270470860,213130747,270405240,213188584}, {271471671,213134897,271480784,213176342}, {268692133,213140615,268699664,213155774}, 
+    {266402530,213145284,266380365,213203086}, {277211976,213148868,277197026,213178418}, {268699664,213155774,268707436,213170715}, 
+    {274248606,213157870,274240954,213195082}, {268707436,213170715,268715454,213185432}, {271480784,213176342,271489155,213218982}, 
+    {277197026,213178418,277181431,213207505}, {268715454,213185432,268723723,213199920}, {270405240,213188584,270337246,213245426}, 
+    {262890540,213189872,262803711,213301170}, {274240954,213195082,274234174,213233488}, {275194395,213195992,275263935,213255540}, 
+    {282889491,213199370,282972565,213309635}, {268723723,213199920,268732247,213214171}, {266380365,213203086,266359688,213260701}, 
+    {277181431,213207505,277165165,213236089}, {268732247,213214171,268741031,213228180}, {271489155,213218982,271496782,213262766}, 
+    {279052626,213219780,279088659,213343119}, {268741031,213228180,268750078,213241940}, {274234174,213233488,274228260,213273043}, 
+    {277165165,213236089,277148204,213264131}, {268750078,213241940,268759394,213255445}, {270337246,213245426,270302334,213273230}, 
+    {268759394,213255445,268768983,213268689}, {275263935,213255540,275335808,213314856}, {266359688,213260701,266340544,213318056}, 
+    {271496782,213262766,271503666,213307646}, {277148204,213264131,277130522,213291592}, {268768983,213268689,268778850,213281665}, 
+    {274228260,213273043,274223205,213313703}, {270302334,213273230,270266798,213300493}, {268778850,213281665,268788998,213294368}, 
+    {277130522,213291592,277112093,213318433}, {268788998,213294368,268799432,213306790}, {270266798,213300493,270230629,213327117}, 
+    {262803711,213301170,262721084,213412568}, {268799432,213306790,268810157,213318927}, {271503666,213307646,271509807,213353572}, 
+    {282972565,213309635,283052201,213419870}, {274223205,213313703,274219001,213355424}, {275335808,213314856,275410038,213373139}, 
+    {266340544,213318056,266322981,213375082}, {277112093,213318433,277092893,213344616}, {268810157,213318927,268821177,213330771}, 
+    {270230629,213327117,270193817,213353005}, {268821177,213330771,268832497,213342316}, {268832497,213342316,268844120,213353556}, 
+    {279088659,213343119,279122497,213471909}, {277092893,213344616,277072896,213370100}, {270193817,213353005,270156351,213378058}, 
+    {268844120,213353556,268856052,213364485}, {271509807,213353572,271515206,213400494}, {274219001,213355424,274215641,213398160}, 
+    {268856052,213364485,268868297,213375097}, {277072896,213370100,277062591,213382569}, {275410038,213373139,275486650,213429587}, 
+    {266322981,213375082,266307043,213431705}, {268868297,213375097,268880859,213385384}, {270156351,213378058,270118221,213402179}, 
+    {277062591,213382569,277052077,213394848}, {268880859,213385384,268893743,213395342}, {277052077,213394848,277041352,213406934}, 
+    {268893743,213395342,268906952,213404964}, {274215641,213398160,274213118,213441867}, {271515206,213400494,271523775,213497127}, 
+    {270118221,213402179,270079418,213425271}, {268906952,213404964,268920493,213414242}, {277041352,213406934,277030411,213418820}, 
+    {262721084,213412568,262642778,213524013}, {268920493,213414242,268934368,213423173}, {277030411,213418820,277019253,213430503}, 
+    {283052201,213419870,283128324,213530016}, {268934368,213423173,268948583,213431748}, {270079418,213425271,270039931,213447236}, 
+    {275486650,213429587,275525858,213456872}, {277019253,213430503,277007873,213441977}, {266307043,213431705,266292779,213487856}, 
+    {268948583,213431748,268963141,213439962}, {268963141,213439962,268978048,213447808}, {274213118,213441867,274211423,213486502}, 
+    {277007873,213441977,276996268,213453238}, {270039931,213447236,269999751,213467977}, {268978048,213447808,269006689,213461984}, 
+    {276996268,213453238,276984436,213464280}, {275525858,213456872,275565670,213483397}, {269006689,213461984,269035103,213475328}, 
+    {276984436,213464280,276972374,213475099}, {269999751,213467977,269958867,213487395}, {279122497,213471909,279154018,213606153}, 
+    {276972374,213475099,276960077,213485691}, {269035103,213475328,269063291,213487855}, {275565670,213483397,275606091,213509063}, 
+    {276960077,213485691,276947543,213496049}, {274211423,213486502,274210551,213532018}, {269958867,213487395,269938158,213496578}, 
+    {269063291,213487855,269091254,213499575}, {266292779,213487856,266280233,213543463}, {276947543,213496049,276934770,213506169}, 
+    {269938158,213496578,269917270,213505394}, {271523775,213497127,271529374,213597147}, {269091254,213499575,269118994,213510501}, 
+    {269917270,213505394,269896201,213513830}, {276934770,213506169,276921752,213516047}, {275606091,213509063,275647124,213533768}, 
+    {269118994,213510501,269146512,213520644}, {269896201,213513830,269874949,213521875}, {276921752,213516047,276908489,213525677}, 
+    {269146512,213520644,269173809,213530019}, {269874949,213521875,269853514,213529516}, {262642778,213524013,262568908,213635454}, 
+    {276908489,213525677,276894975,213535054}, {269853514,213529516,269831895,213536741}, {283128324,213530016,283200858,213640019}, 
+    {269173809,213530019,269200886,213538635}, {274210551,213532018,274210493,213578372}, {275647124,213533768,275688771,213557413}, 
+    {276894975,213535054,276881209,213544174}, {269831895,213536741,269810089,213543538}, {269200886,213538635,269227745,213546507}, 
+    {266280233,213543463,266269452,213598454}, {269810089,213543538,269788097,213549895}, {276881209,213544174,276867186,213553032}, 
+    {269227745,213546507,269254386,213553645}, {269788097,213549895,269765916,213555799}, {276867186,213553032,276852905,213561623}, 
+    {269254386,213553645,269280812,213560062}, {269765916,213555799,269743546,213561239}, {275688771,213557413,275731035,213579897}, 
+    {269280812,213560062,269307023,213565771}, {269743546,213561239,269720984,213566201}, {276852905,213561623,276838361,213569942}, 
+    {269307023,213565771,269333021,213570783}, {269720984,213566201,269698231,213570674}, {276838361,213569942,276823552,213577984}, 
+    {269698231,213570674,269675284,213574646}, {269333021,213570783,269358807,213575110}, {269675284,213574646,269652142,213578105}, 
+    {269358807,213575110,269384382,213578766}, {276823552,213577984,276795138,213592619}, {269652142,213578105,269628805,213581038}, 
+    {274210493,213578372,274212792,213673415}, {269384382,213578766,269409747,213581761}, {275731035,213579897,275773921,213601121}, 
+    {269628805,213581038,269605270,213583433}, {269409747,213581761,269434903,213584109}, {269605270,213583433,269581537,213585277}, 
+    {269434903,213584109,269459853,213585822}, {269581537,213585277,269557605,213586560}, {269459853,213585822,269484597,213586911}, 
+    {269557605,213586560,269533471,213587267}, {269484597,213586911,269509136,213587388}, {269533471,213587267,269509136,213587388}, 
+    {276795138,213592619,276766897,213606399}, {271529374,213597147,271532004,213700158}, {266269452,213598454,266260482,213652759}, 
+    {275773921,213601121,275817431,213620983}, {279154018,213606153,279183104,213745856}, {276766897,213606399,276738827,213619338}, 
+    {276738827,213619338,276710929,213631448}, {275817431,213620983,275861568,213639384}, {276710929,213631448,276683201,213642742}, 
+    {262568908,213635454,262499592,213746842}, {275861568,213639384,275883873,213648005}, {283200858,213640019,283269726,213749820}, 
+    {276683201,213642742,276655645,213653231}, {275883873,213648005,275906335,213656223}, {266260482,213652759,266253369,213706306}, 
+    {276655645,213653231,276628259,213662930}, {275906335,213656223,275928956,213664025}, {276628259,213662930,276601042,213671849}, 
+    {275928956,213664025,275951736,213671400}, {275951736,213671400,275974675,213678334}, {276601042,213671849,276573995,213680001}, 
+    {274212792,213673415,274218262,213771274}, {275974675,213678334,275997774,213684815}, {276573995,213680001,276547117,213687400}, 
+    {275997774,213684815,276021033,213690830}, {276547117,213687400,276520408,213694058}, {276021033,213690830,276044452,213696367}, 
+    {276520408,213694058,276493867,213699987}, {276044452,213696367,276068031,213701414}, {276493867,213699987,276467493,213705199}, 
+    {271532004,213700158,271531666,213805762}, {276068031,213701414,276091772,213705957}, {276467493,213705199,276441288,213709708}, 
+    {276091772,213705957,276115675,213709985}, {266253369,213706306,266248160,213759023}, {276441288,213709708,276415249,213713525}, 
+    {276115675,213709985,276139739,213713484}, {276139739,213713484,276163966,213716443}, {276415249,213713525,276389377,213716664}, 
+    {276163966,213716443,276188355,213718848}, {276389377,213716664,276363672,213719137}, {276188355,213718848,276212908,213720687}, 
+    {276363672,213719137,276338132,213720956}, {276212908,213720687,276237624,213721948}, {276338132,213720956,276312758,213722134}, 
+    {276237624,213721948,276262504,213722618}, {276312758,213722134,276287549,213722684}, {276262504,213722618,276287549,213722684}, 
+    {279183104,213745856,279208235,213885301}, {262499592,213746842,262434945,213858123}, {283269726,213749820,283334852,213859362}, 
+    {266248160,213759023,266246284,213785049}, {274218262,213771274,274226844,213871593}, {266246284,213785049,266244901,213810840}, 
+    {285424234,213802087,285464832,213803136}, {285424234,213802087,285384893,213802217}, {285384893,213802217,285346786,213803498}, 
+    {285464832,213803136,285475862,213803698}, {285346786,213803498,285309891,213805902}, {285475862,213803698,285486863,213804506}, 
+    {285486863,213804506,285497836,213805559}, {285497836,213805559,285508780,213806855}, {271531666,213805762,271528360,213913560}, 
+    {285309891,213805902,285274183,213809402}, {285508780,213806855,285519695,213808393}, {285519695,213808393,285530582,213810172}, 
+    {285274183,213809402,285239639,213813971}, {285530582,213810172,285541439,213812191}, {266244901,213810840,266244017,213836389}, 
+    {285541439,213812191,285552268,213814449}, {285239639,213813971,285222796,213816648}, {285552268,213814449,285563067,213816944}, 
+    {285222796,213816648,285206236,213819582}, {285563067,213816944,285573836,213819675}, {285206236,213819582,285189955,213822769}, 
+    {285573836,213819675,285584576,213822640}, {285584576,213822640,285595286,213825839}, {285189955,213822769,285173950,213826206}, 
+    {285595286,213825839,285605967,213829271}, {285173950,213826206,285158219,213829890}, {285605967,213829271,285616617,213832934}, 
+    {285158219,213829890,285142758,213833818}, {285616617,213832934,285627237,213836827}, {285142758,213833818,285127565,213837985}, 
+    {266244017,213836389,266243637,213861686}, {285627237,213836827,285637826,213840948}, {285127565,213837985,285112637,213842388}, 
+    {285637826,213840948,285648386,213845297}, {285112637,213842388,285097971,213847025}, {285648386,213845297,285658914,213849872}, 
+    {285097971,213847025,285083564,213851891}, {285658914,213849872,285669412,213854672}, {285083564,213851891,285069412,213856983}, 
+    {285669412,213854672,285679879,213859696}, {285069412,213856983,285055514,213862298}, {262434945,213858123,262375085,213969247}, 
+    {283334852,213859362,283396160,213968590}, {285679879,213859696,285690315,213864943}, {266243637,213861686,266243769,213886722}, 
+    {285055514,213862298,285041866,213867832}, {285690315,213864943,285700720,213870411}, {285041866,213867832,285028465,213873582}, 
+    {285700720,213870411,285711093,213876099}, {274226844,213871593,274238480,213974016}, {285028465,213873582,285015308,213879544}, 
+    {285711093,213876099,285721435,213882005}, {285015308,213879544,285002393,213885716}, {285721435,213882005,285742024,213894471}, 
+    {279208235,213885301,279228138,214019213}, {285002393,213885716,284989716,213892093}, {266243769,213886722,266244416,213911488}, 
+    {284989716,213892093,284977275,213898672}, {285742024,213894471,285762485,213907797}, {284977275,213898672,284965066,213905450}, 
+    {284965066,213905450,284953087,213912423}, {285762485,213907797,285782818,213921974}, {266244416,213911488,266259263,214190671}, 
+    {284953087,213912423,284941335,213919588}, {271528360,213913560,271522087,214023156}, {284941335,213919588,284929806,213926942}, 
+    {285782818,213921974,285803021,213936992}, {284929806,213926942,284918499,213934480}, {284918499,213934480,284907410,213942201}, 
+    {285803021,213936992,285823093,213952841}, {284907410,213942201,284896535,213950099}, {260466165,213946783,260503422,213947486}, 
+    {260466165,213946783,260427351,213947275}, {260427351,213947275,260386944,213948992}, {260503422,213947486,260539160,213949354}, 
+    {260386944,213948992,260375922,213949744}, {260539160,213949354,260556471,213950715}, {260375922,213949744,260364933,213950740}, 
+    {284896535,213950099,284885873,213958173}, {260556471,213950715,260573416,213952356}, {260364933,213950740,260353977,213951981}, 
+    {260353977,213951981,260343053,213953465}, {260573416,213952356,260590001,213954274}, {285823093,213952841,285843032,213969512}, 
+    {260343053,213953465,260332162,213955191}, {260590001,213954274,260606229,213956464}, {260332162,213955191,260321304,213957156}, 
+    {260606229,213956464,260622105,213958922}, {260321304,213957156,260310479,213959361}, {284885873,213958173,284875420,213966417}, 
+    {260622105,213958922,260637635,213961646}, {260310479,213959361,260299687,213961804}, {260637635,213961646,260652823,213964630}, 
+    {260299687,213961804,260288929,213964484}, {260288929,213964484,260278204,213967399}, {260652823,213964630,260667673,213967872}, 
+    {284875420,213966417,284865174,213974830}, {260278204,213967399,260267513,213970548}, {260667673,213967872,260682190,213971367}, 
+    {283396160,213968590,283453573,214077446}, {262375085,213969247,262346986,214024735}, {285843032,213969512,285862839,213986994}, 
+    {260267513,213970548,260256855,213973930}, {260682190,213971367,260696379,213975112}, {260256855,213973930,260246231,213977544}, 
+    {274238480,213974016,274253111,214078186}, {284865174,213974830,284855131,213983407}, {260696379,213975112,260710245,213979103}, 
+    {260246231,213977544,260235641,213981389}, {260710245,213979103,260723792,213983336}, {260235641,213981389,260225085,213985463}, 
+    {260723792,213983336,260737025,213987808}, {284855131,213983407,284845288,213992145}, {260225085,213985463,260214563,213989765}, 
+    {285862839,213986994,285882511,214005278}, {260737025,213987808,260749949,213992515}, {260214563,213989765,260204076,213994294}, 
+    {284845288,213992145,284835643,214001041}, {260749949,213992515,260762568,213997452}, {260204076,213994294,260193623,213999048}, 
+    {260762568,213997452,260774887,214002617}, {260193623,213999048,260183204,214004027}, {284835643,214001041,284826192,214010091}, 
+    {260774887,214002617,260786911,214008004}, {260183204,214004027,260172820,214009229}, {285882511,214005278,285902047,214024354}, 
+    {260786911,214008004,260798645,214013612}, {260172820,214009229,260162471,214014653}, {284826192,214010091,284816934,214019292}, 
+    {260798645,214013612,260810092,214019435}, {260162471,214014653,260152157,214020298}, {279228138,214019213,279242937,214147759}, 
+    {284816934,214019292,284807864,214028641}, {260810092,214019435,260821259,214025471}, {260152157,214020298,260141878,214026162}, 
+    {271522087,214023156,271512848,214134152}, {285902047,214024354,285921447,214044213}, {262346986,214024735,262320128,214080164}, 
+    {260821259,214025471,260832149,214031715}, {260141878,214026162,260131634,214032244}, {284807864,214028641,284798980,214038133}, 
+    {260832149,214031715,260842767,214038163}, {260131634,214032244,260111252,214045059}, {284798980,214038133,284790279,214047766}, 
+    {260842767,214038163,260853118,214044812}, {285921447,214044213,285940709,214064843}, {260853118,214044812,260863207,214051658}, 
+    {260111252,214045059,260091012,214058732}, {284790279,214047766,284773414,214067440}, {260863207,214051658,260873038,214058697}, 
+    {260873038,214058697,260882616,214065926}, {260091012,214058732,260070915,214073253}, {285940709,214064843,285959832,214086236}, 
+    {260882616,214065926,260891946,214073341}, {284773414,214067440,284757245,214087635}, {260070915,214073253,260050962,214088613}, 
+    {260891946,214073341,260901032,214080937}, {283453573,214077446,283507017,214185874}, {274253111,214078186,274270678,214183748}, 
+    {262320128,214080164,262294524,214135528}, {260901032,214080937,260909880,214088711}, {285959832,214086236,285978814,214108382}, 
+    {284757245,214087635,284741751,214108324}, {260050962,214088613,260031153,214104801}, {260909880,214088711,260918493,214096660}, 
+    {260918493,214096660,260926876,214104780}, {260926876,214104780,260935035,214113066}, {260031153,214104801,260011491,214121809}, 
+    {284741751,214108324,284726906,214129479}, {285978814,214108382,285997656,214131271}, {260935035,214113066,260942974,214121516}, 
+    {260942974,214121516,260950697,214130124}, {260011491,214121809,259991976,214139625}, {284726906,214129479,284712688,214151073}, 
+    {260950697,214130124,260958210,214138889}, {285997656,214131271,286016355,214154893}, {271512848,214134152,271500644,214246151}, 
+    {262294524,214135528,262270190,214190820}, {260958210,214138889,260965516,214147805}, {259991976,214139625,259972609,214158241}, 
+    {279242937,214147759,279248461,214210071}, {260965516,214147805,260972621,214156869}, {284712688,214151073,284699073,214173079}, 
+    {286016355,214154893,286034911,214179238}, {260972621,214156869,260979530,214166077}, {259972609,214158241,259953390,214177646}, 
+    {260979530,214166077,260986246,214175426}, {284699073,214173079,284686038,214195469}, {260986246,214175426,260992776,214184911}, 
+    {259953390,214177646,259934322,214197831}, {286034911,214179238,286071587,214230058}, {274270678,214183748,274291124,214290345}, 
+    {260992776,214184911,260999122,214194530}, {283507017,214185874,283556413,214293816}, {266259263,214190671,266269876,214322460}, 
+    {262270190,214190820,262247140,214246036}, {260999122,214194530,261005291,214204277}, {284686038,214195469,284673560,214218216}, 
+    {259934322,214197831,259915404,214218785}, {261005291,214204277,261011287,214214150}, {279248461,214210071,279252755,214271103}, 
+    {261011287,214214150,261017114,214224144}, {284673560,214218216,284661615,214241292}, {259915404,214218785,259896638,214240499}, 
+    {261017114,214224144,261028282,214244483}, {286071587,214230058,286107675,214283653}, {259896638,214240499,259878025,214262964}, 
+    {284661615,214241292,284650180,214264671}, {261028282,214244483,261038832,214265263}, {262247140,214246036,262225389,214301167}, 
+    {271500644,214246151,271485476,214358754}, {259878025,214262964,259859565,214286168}, {284650180,214264671,284639231,214288324}, 
+    {261038832,214265263,261048802,214286454}, {279252755,214271103,279255834,214330876}, {286107675,214283653,286143166,214339945}, 
+    {259859565,214286168,259841261,214310103}, {261048802,214286454,261058230,214308026}, {284639231,214288324,284628745,214312225}, 
+    {274291124,214290345,274314389,214397620}, {283556413,214293816,283601687,214401216}, {262225389,214301167,262204951,214356207}, 
+    {261058230,214308026,261067153,214329949}, {259841261,214310103,259823112,214334758}, {284628745,214312225,284618699,214336345}, 
+    {266269876,214322460,266282657,214449212}, {261067153,214329949,261075608,214352192}, {279255834,214330876,279257714,214389411}, 
+    {259823112,214334758,259787285,214386190}, {284618699,214336345,284609070,214360658}, {286143166,214339945,286178052,214398854}, 
+    {261075608,214352192,261083634,214374726}, {262204951,214356207,262185841,214411151}, {271485476,214358754,271467344,214471565}, 
+    {284609070,214360658,284590966,214409753}, {261083634,214374726,261091267,214397520}, {259787285,214386190,259752092,214440387}, 
+    {279257714,214389411,279258410,214446729}, {261091267,214397520,261105507,214443768}, {274314389,214397620,274340415,214505218}, 
+    {286178052,214398854,286212322,214460302}, {283601687,214401216,283642762,214508016}, {284590966,214409753,284574248,214459289}, 
+    {262185841,214411151,262168073,214465992}, {259752092,214440387,259717542,214497269}, {261105507,214443768,261118629,214490695}, 
+    {279258410,214446729,279257938,214502849}, {266282657,214449212,266297637,214571051}, {284574248,214459289,284558727,214509048}, 
+    {286212322,214460302,286245968,214524211}, {262168073,214465992,262151662,214520723}, {271467344,214471565,271446249,214584186}, 
+    {261118629,214490695,261130933,214538061}, {259717542,214497269,259683641,214556757}, {279257938,214502849,279256313,214557793}, 
+    {274340415,214505218,274369143,214612782}, {283642762,214508016,283679562,214614161}, {284558727,214509048,284530533,214608357}, 
+    {262151662,214520723,262136623,214575338}, {286245968,214524211,286278980,214590502}, {261130933,214538061,261154290,214633141}, 
+    {259683641,214556757,259650399,214618773}, {279256313,214557793,279253550,214611582}, {266297637,214571051,266314848,214688101}, 
+    {262136623,214575338,262122970,214629830}, {271446249,214584186,271422191,214696219}, {286278980,214590502,286311350,214659097}, 
+    {284530533,214608357,284480295,214800009}, {279253550,214611582,279249666,214664235}, {274369143,214612782,274400516,214719956}, 
+    {283679562,214614161,283696335,214666970}, {259650399,214618773,259617822,214683239}, {262122970,214629830,262110717,214684194}, 
+    {261154290,214633141,261177981,214727078}, {286311350,214659097,286343068,214729916}, {279249666,214664235,279244674,214715775}, 
+    {283696335,214666970,283712011,214719593}, {259617822,214683239,259585919,214750075}, {262110717,214684194,262099880,214738422}, 
+    {266314848,214688101,266334321,214800487}, {271422191,214696219,271395173,214807267}, {279244674,214715775,279238591,214766221}, 
+    {283712011,214719593,283726580,214772024}, {274400516,214719956,274434474,214826384}, {261177981,214727078,261190703,214773015}, 
+    {286343068,214729916,286374126,214802882}, {262099880,214738422,262090473,214792509}, {259585919,214750075,259554697,214819202}, 
+    {279238591,214766221,279231432,214815594}, {283726580,214772024,283740032,214824256}, {261190703,214773015,261204410,214817942}, 
+    {262090473,214792509,262082510,214846448}, {284480295,214800009,284455261,214888846}, {266334321,214800487,266356086,214908333}, 
+    {286374126,214802882,286434222,214954937}, {271395173,214807267,271365194,214916932}, {279231432,214815594,279223212,214863915}, 
+    {261204410,214817942,261211726,214839952}, {259554697,214819202,259524164,214890543}, {283740032,214824256,283746066,214847038}, 
+    {274434474,214826384,274470959,214931709}, {261211726,214839952,261219402,214861619}, {262082510,214846448,262076006,214900232}, 
+    {283746066,214847038,283749288,214858058}, {283749288,214858058,283752643,214868834}, {261219402,214861619,261227474,214882913}, 
+    {279223212,214863915,279213948,214911205}, {283752643,214868834,283756128,214879368}, {283756128,214879368,283759743,214889662}, 
+    {261227474,214882913,261235980,214903804}, {284455261,214888846,284442110,214930751}, {283759743,214889662,283763483,214899717}, 
+    {259524164,214890543,259494328,214964018}, {283763483,214899717,283767346,214909536}, {262076006,214900232,262070976,214953856}, 
+    {261235980,214903804,261244958,214924262}, {266356086,214908333,266380175,215011762}, {283767346,214909536,283771331,214919121}, 
+    {279213948,214911205,279203653,214957483}, {271365194,214916932,271332255,215024817}, {283771331,214919121,283775435,214928473}, 
+    {261244958,214924262,261254445,214944256}, {283775435,214928473,283779656,214937596}, {284442110,214930751,284428288,214970688}, 
+    {274470959,214931709,274509912,215035576}, {283779656,214937596,283783990,214946490}, {261254445,214944256,261264478,214963757}, 
+    {283783990,214946490,283788437,214955158}, {262070976,214953856,262068696,214962103}, {286434222,214954937,286491566,215114635}, 
+    {283788437,214955158,283792993,214963602}, {279203653,214957483,279192344,215002772}, {262068696,214962103,262066295,214970218}, 
+    {283792993,214963602,283797656,214971824}, {261264478,214963757,261269711,214973312}, {259494328,214964018,259436778,215117056}, 
+    {262066295,214970218,262063773,214978202}, {284428288,214970688,284427569,214972600}, {283797656,214971824,283802423,214979826}, 
+    {284427569,214972600,284426810,214974514}, {261269711,214973312,261275096,214982733}, {284426810,214974514,284426011,214976430}, 
+    {284426011,214976430,284425171,214978347}, {262063773,214978202,262061133,214986055}, {284425171,214978347,284423374,214982185}, 
+    {283802423,214979826,283807293,214987611}, {284423374,214982185,284421420,214986025}, {261275096,214982733,261280635,214992016}, 
+    {284421420,214986025,284419312,214989866}, {262061133,214986055,262058376,214993778}, {283807293,214987611,283812263,214995179}, 
+    {284419312,214989866,284417053,214993706}, {261280635,214992016,261286335,215001156}, {284417053,214993706,284414644,214997542}, 
+    {262058376,214993778,262055503,215001370}, {283812263,214995179,283817330,215002533}, {284414644,214997542,284412089,215001373}, 
+    {261286335,215001156,261292200,215010151}, {262055503,215001370,262052517,215008831}, {284412089,215001373,284409389,215005197}, 
+    {283817330,215002533,283822493,215009675}, {279192344,215002772,279180036,215047091}, {284409389,215005197,284406547,215009011}, 
+    {262052517,215008831,262049419,215016164}, {284406547,215009011,284403565,215012814}, {283822493,215009675,283827749,215016607}, 
+    {261292200,215010151,261298234,215018995}, {266380175,215011762,266406620,215110900}, {284403565,215012814,284400446,215016603}, 
+    {262049419,215016164,262046209,215023367}, {284400446,215016603,284397192,215020377}, {283827749,215016607,283833094,215023332}, 
+    {261298234,215018995,261304442,215027686}, {284397192,215020377,284393806,215024133}, {283833094,215023332,283838528,215029850}, 
+    {262046209,215023367,262042891,215030440}, {284393806,215024133,284390289,215027870}, {271332255,215024817,271296358,215130524}, 
+    {261304442,215027686,261310830,215036220}, {284390289,215027870,284386645,215031586}, {283838528,215029850,283844048,215036165}, 
+    {262042891,215030440,262039465,215037385}, {284386645,215031586,284382875,215035277}, {284382875,215035277,284378982,215038943}, 
+    {274509912,215035576,274551276,215137628}, {283844048,215036165,283849651,215042278}, {261310830,215036220,261317401,215044592}, 
+    {262039465,215037385,262035933,215044202}, {284378982,215038943,284374968,215042582}, {283849651,215042278,283855335,215048191}, 
+    {284374968,215042582,284370836,215046190}, {262035933,215044202,262032297,215050891}, {261317401,215044592,261324160,215052800}, 
+    {284370836,215046190,284366587,215049767}, {279180036,215047091,279166744,215090462}, {283855335,215048191,283861098,215053906}, 
+    {284366587,215049767,284362226,215053311}, {262032297,215050891,262028557,215057452}, {261324160,215052800,261334674,215064336}, 
+    {284362226,215053311,284353171,215060288}, {283861098,215053906,283866936,215059426}, {262028557,215057452,262024717,215063886}, 
+    {283866936,215059426,283872849,215064752}, {284353171,215060288,284343690,215067106}, {262024717,215063886,262020776,215070192}, 
+    {261334674,215064336,261345483,215075511}, {283872849,215064752,283878833,215069886}, {284343690,215067106,284333802,215073749}, 
+    {283878833,215069886,283884886,215074831}, {262020776,215070192,262016738,215076372}, {284333802,215073749,284323527,215080200}, 
+    {283884886,215074831,283891006,215079588}, {261345483,215075511,261356574,215086324}, {262016738,215076372,262012603,215082426}, 
+    {283891006,215079588,283897190,215084159}, {284323527,215080200,284312882,215086444}, {262012603,215082426,262008372,215088354}, 
+    {283897190,215084159,283903436,215088547}, {261356574,215086324,261367936,215096771}, {284312882,215086444,284301887,215092464}, 
+    {262008372,215088354,262004049,215094155}, {283903436,215088547,283909742,215092754}, {279166744,215090462,279152484,215132904}, 
+    {284301887,215092464,284290562,215098243}, {283909742,215092754,283916105,215096780}, {262004049,215094155,261999633,215099832}, 
+    {261367936,215096771,261379556,215106850}, {283916105,215096780,283922523,215100630}, {284290562,215098243,284278924,215103766}, 
+    {261999633,215099832,261995127,215105383}, {283922523,215100630,283928993,215104303}, {284278924,215103766,284266993,215109016}, 
+    {283928993,215104303,283935514,215107804}, {261995127,215105383,261990532,215110810}, {261379556,215106850,261391420,215116558}, 
+    {283935514,215107804,283942082,215111133}, {284266993,215109016,284254788,215113978}, {261990532,215110810,261985850,215116113}, 
+    {266406620,215110900,266420736,215158897}, {283942082,215111133,283948696,215114292}, {284254788,215113978,284242328,215118635}, 
+    {283948696,215114292,283955352,215117284}, {286491566,215114635,286546084,215281345}, {261985850,215116113,261981082,215121291}, 
+    {261391420,215116558,261403517,215125892}, {259436778,215117056,259382109,215277686}, {283955352,215117284,283962050,215120111}, 
+    {284242328,215118635,284229632,215122970}, {283962050,215120111,283968785,215122774}, {261981082,215121291,261976230,215126346}, 
+    {283968785,215122774,283975556,215125277}, {284229632,215122970,284216718,215126968}, {283975556,215125277,283982361,215127619}, 
+    {261403517,215125892,261415835,215134851}, {261976230,215126346,261971295,215131277}, {284216718,215126968,284203607,215130613}, 
+    {283982361,215127619,283989197,215129805}, {283989197,215129805,283996062,215131836}, {271296358,215130524,271257502,215233656}, 
+    {284203607,215130613,284190316,215133888}, {261971295,215131277,261966280,215136085}, {283996062,215131836,284002953,215133713}, 
+    {279152484,215132904,279137272,215174439}, {284002953,215133713,284009868,215135439}, {284190316,215133888,284176865,215136777}, 
+    {261415835,215134851,261428360,215143430}, {284009868,215135439,284016805,215137016}, {261966280,215136085,261961185,215140771}, 
+    {284176865,215136777,284163273,215139263}, {284016805,215137016,284023761,215138445}, {274551276,215137628,274594990,215237508}, 
+    {284023761,215138445,284030734,215139730}, {284163273,215139263,284149559,215141332}, {284030734,215139730,284037721,215140872}, 
+    {261961185,215140771,261956012,215145334}, {284037721,215140872,284044721,215141872}, {284149559,215141332,284135741,215142965}, 
+    {284044721,215141872,284051730,215142734}, {284051730,215142734,284058747,215143458}, {284135741,215142965,284121839,215144148}, 
+    {261428360,215143430,261441080,215151628}, {284058747,215143458,284065769,215144048}, {284065769,215144048,284072793,215144504}, 
+    {284121839,215144148,284107872,215144864}, {284072793,215144504,284079818,215144830}, {284079818,215144830,284086840,215145027}, 
+    {284107872,215144864,284100870,215145042}, {284086840,215145027,284093859,215145097}, {284100870,215145042,284093859,215145097}, 
+    {261956012,215145334,261950763,215149775}, {261950763,215149775,261945439,215154095}, {261441080,215151628,261453982,215159441}, 
+    {261945439,215154095,261940042,215158293}, {261940042,215158293,261934573,215162370}, {266420736,215158897,266435451,215205869}, 
+    {261453982,215159441,261467055,215166868}, {261934573,215162370,261929035,215166327}, {261929035,215166327,261923427,215170163}, 
+    {261467055,215166868,261480285,215173905}, {261923427,215170163,261917753,215173879}, {261917753,215173879,261912014,215177475}, 
+    {261480285,215173905,261493661,215180550}, {279137272,215174439,279121121,215215087}, {261912014,215177475,261906210,215180952}, 
+    {261493661,215180550,261507169,215186800}, {261906210,215180952,261900345,215184310}, {261900345,215184310,261894419,215187549}, 
+    {261507169,215186800,261520797,215192653}, {261894419,215187549,261888434,215190670}, {261888434,215190670,261882391,215193673}, 
+    {261520797,215192653,261534533,215198105}, {261882391,215193673,261876292,215196558}, {261876292,215196558,261870139,215199326}, 
+    {261534533,215198105,261548363,215203155}, {261870139,215199326,261863933,215201976}, {261863933,215201976,261857675,215204510}, 
+    {261548363,215203155,261562277,215207799}, {261857675,215204510,261851368,215206928}, {266435451,215205869,266450772,215251829}, 
+    {261851368,215206928,261845013,215209230}, {261562277,215207799,261576260,215212035}, {261845013,215209230,261838611,215211416}, 
+    {261838611,215211416,261832164,215213486}, {261576260,215212035,261590301,215215860}, {261832164,215213486,261825674,215215442}, 
+    {279121121,215215087,279104049,215254870}, {261825674,215215442,261819142,215217282}, {261590301,215215860,261604386,215219271}, 
+    {261819142,215217282,261812569,215219009}, {261812569,215219009,261805958,215220621}, {261604386,215219271,261618505,215222266}, 
+    {261805958,215220621,261799309,215222120}, {261799309,215222120,261785906,215224778}, {261618505,215222266,261632643,215224843}, 
+    {261785906,215224778,261772374,215226984}, {261632643,215224843,261646789,215226998}, {261772374,215226984,261758723,215228743}, 
+    {261646789,215226998,261660929,215228729}, {261660929,215228729,261675053,215230032}, {261758723,215228743,261744968,215230056}, 
+    {261675053,215230032,261689146,215230907}, {261744968,215230056,261731120,215230926}, {261689146,215230907,261703196,215231349}, 
+    {261731120,215230926,261717192,215231356}, {261703196,215231349,261717192,215231356}, {271257502,215233656,271236965,215284132}, 
+    {274594990,215237508,274640998,215334861}, {266450772,215251829,266466700,215296794}, {279104049,215254870,279086070,215293806}, 
+    {259382109,215277686,259330384,215445280}, {286546084,215281345,286597704,215454440}, {271236965,215284132,271215688,215333815}, 
+    {279086070,215293806,279067200,215331919}, {266466700,215296794,266483241,215340779}, {279067200,215331919,279047454,215369227}, 
+    {271215688,215333815,271193673,215382656}, {274640998,215334861,274689240,215429330}, {266483241,215340779,266500398,215383799}, 
+    {279047454,215369227,279026848,215405752}, {271193673,215382656,271170918,215430604}, {266500398,215383799,266518175,215425870}, 
+    {279026848,215405752,279005397,215441514}, {266518175,215425870,266536576,215467008}, {274689240,215429330,274739657,215520559}, 
+    {271170918,215430604,271147425,215477610}, {279005397,215441514,278983115,215476535}, {259330384,215445280,259281664,215619208}, 
+    {286597704,215454440,286646353,215633291}, {266536576,215467008,266555604,215507228}, {278983115,215476535,278960020,215510834}, 
+    {271147425,215477610,271123193,215523625}, {266555604,215507228,266575265,215546546}, {278960020,215510834,278936126,215544433}, 
+    {274739657,215520559,274765664,215564847}, {271123193,215523625,271098222,215568598}, {278936126,215544433,278911448,215577352}, 
+    {266575265,215546546,266595561,215584977}, {274765664,215564847,274792192,215608192}, {271098222,215568598,271072512,215612480}, 
+    {278911448,215577352,278886002,215609611}, {266595561,215584977,266616496,215622536}, {274792192,215608192,274827630,215663275}, 
+    {278886002,215609611,278859804,215641232}, {271072512,215612480,271037861,215668154}, {259281664,215619208,259236013,215798840}, 
+    {266616496,215622536,266638075,215659239}, {286646353,215633291,286691957,215817268}, {278859804,215641232,278832868,215672235}, 
+    {266638075,215659239,266660301,215695102}, {274827630,215663275,274864059,215716704}, {271037861,215668154,271001950,215722194}, 
+    {278832868,215672235,278805210,215702641}, {266660301,215695102,266683178,215730141}, {278805210,215702641,278776846,215732471}, 
+    {274864059,215716704,274901452,215768489}, {271001950,215722194,270964812,215774614}, {266683178,215730141,266706711,215764369}, 
+    {278776846,215732471,278747790,215761745}, {278747790,215761745,278718059,215790484}, {266706711,215764369,266730902,215797804}, 
+    {274901452,215768489,274939784,215818644}, {270964812,215774614,270926478,215825427}, {278718059,215790484,278687668,215818708}, 
+    {266730902,215797804,266755757,215830461}, {259236013,215798840,259193492,215983545}, {286691957,215817268,286734444,216005744}, 
+    {274939784,215818644,274979031,215867180}, {278687668,215818708,278656632,215846438}, {270926478,215825427,270886981,215874648}, 
+    {266755757,215830461,266781278,215862355}, {278656632,215846438,278624966,215873696}, {266781278,215862355,266807470,215893501}, 
+    {274979031,215867180,275019166,215914108}, {278624966,215873696,278592686,215900501}, {270886981,215874648,270846353,215922289}, 
+    {266807470,215893501,266834336,215923916}, {278592686,215900501,278526345,215952837}, {275019166,215914108,275060166,215959440}, 
+    {270846353,215922289,270804625,215968366}, {266834336,215923916,266861881,215953614}, {278526345,215952837,278457733,216003611}, 
+    {266861881,215953614,266890109,215982612}, {275060166,215959440,275102004,216003187}, {270804625,215968366,270761829,216012891}, 
+    {266890109,215982612,266919022,216010924}, {259193492,215983545,259154164,216172696}, {275102004,216003187,275144656,216045362}, 
+    {278457733,216003611,278386972,216052990}, {286734444,216005744,286773741,216198089}, {266919022,216010924,266948626,216038567}, 
+    {270761829,216012891,270717998,216055879}, {266948626,216038567,266978924,216065555}, {275144656,216045362,275188095,216085976}, 
+    {278386972,216052990,278314185,216101138}, {270717998,216055879,270673163,216097343}, {266978924,216065555,267009920,216091905}, 
+    {275188095,216085976,275232298,216125041}, {267009920,216091905,267041618,216117631}, {270673163,216097343,270627356,216137297}, 
+    {278314185,216101138,278239496,216148221}, {267041618,216117631,267074022,216142750}, {275232298,216125041,275277238,216162568}, 
+    {270627356,216137297,270580609,216175756}, {267074022,216142750,267107135,216167276}, {278239496,216148221,278163029,216194405}, 
+    {275277238,216162568,275322891,216198569}, {267107135,216167276,267140962,216191226}, {259154164,216172696,259118092,216365661}, 
+    {270580609,216175756,270532955,216212732}, {267140962,216191226,267175506,216214615}, {278163029,216194405,278005248,216284736}, 
+    {286773741,216198089,286809775,216393675}, {275322891,216198569,275369232,216233056}, {270532955,216212732,270484424,216248240}, 
+    {267175506,216214615,267210772,216237457}, {275369232,216233056,275416234,216266041}, {267210772,216237457,267246763,216259770}, 
+    {270484424,216248240,270435050,216282294}, {267246763,216259770,267283484,216281568}, {275416234,216266041,275463873,216297534}, 
+    {267283484,216281568,267320937,216302867}, {270435050,216282294,270384864,216314907}, {278005248,216284736,277956695,216311077}, 
+    {275463873,216297534,275512124,216327548}, {267320937,216302867,267359128,216323683}, {277956695,216311077,277907568,216336487}, 
+    {270384864,216314907,270333898,216346093}, {267359128,216323683,267398059,216344030}, {275512124,216327548,275560961,216356095}, 
+    {277907568,216336487,277857893,216360955}, {267398059,216344030,267478160,216383382}, {270333898,216346093,270282184,216375866}, 
+    {275560961,216356095,275610360,216383186}, {277857893,216360955,277807695,216384469}, {259118092,216365661,259085337,216561812}, 
+    {270282184,216375866,270229753,216404241}, {275610360,216383186,275660294,216408832}, {267478160,216383382,267561271,216421048}, 
+    {277807695,216384469,277756999,216407017}, {286809775,216393675,286842473,216591873}, {270229753,216404241,270176639,216431229}, 
+    {277756999,216407017,277705830,216428589}, {275660294,216408832,275710739,216433046}, {267561271,216421048,267647424,216457152}, 
+    {277705830,216428589,277654213,216449171}, {270176639,216431229,270122872,216456847}, {275710739,216433046,275761670,216455839}, 
+    {277654213,216449171,277602175,216468753}, {275761670,216455839,275813061,216477223}, {270122872,216456847,270068485,216481106}, 
+    {267647424,216457152,267699003,216477429}, {277602175,216468753,277549739,216487322}, {275813061,216477223,275864887,216497210}, 
+    {267699003,216477429,267751303,216496929}, {270068485,216481106,270013510,216504022}, {277549739,216487322,277496932,216504868}, 
+    {267751303,216496929,267857943,216533544}, {275864887,216497210,275917124,216515810}, {270013510,216504022,269957979,216525608}, 
+    {277496932,216504868,277443778,216521378}, {275917124,216515810,275969744,216533037}, {277443778,216521378,277390302,216536841}, 
+    {269957979,216525608,269901923,216545877}, {275969744,216533037,276022725,216548901}, {267857943,216533544,267967086,216566884}, 
+    {277390302,216536841,277336531,216551245}, {269901923,216545877,269845375,216564844}, {276022725,216548901,276076039,216563414}, 
+    {277336531,216551245,277282488,216564578}, {259085337,216561812,259055963,216760519}, {276076039,216563414,276129663,216576588}, 
+    {277282488,216564578,277228200,216576829}, {269845375,216564844,269788367,216582523}, {267967086,216566884,268078479,216596840}, 
+    {276129663,216576588,276183570,216588435}, {277228200,216576829,277173691,216587986}, {269788367,216582523,269730930,216598927}, 
+    {277173691,216587986,277118987,216598037}, {276183570,216588435,276237737,216598965}, {286842473,216591873,286871762,216792055}, 
+    {268078479,216596840,268191865,216623301}, {277118987,216598037,277064113,216606971}, {269730930,216598927,269673096,216614070}, 
+    {276237737,216598965,276292136,216608192}, {277064113,216606971,277009094,216614776}, {276292136,216608192,276346744,216616126}, 
+    {269673096,216614070,269614898,216627966}, {277009094,216614776,276953955,216621441}, {276346744,216616126,276401534,216622780}, 
+    {276953955,216621441,276898722,216626953}, {276401534,216622780,276456483,216628164}, {268191865,216623301,268306988,216646157}, 
+    {276898722,216626953,276843419,216631301}, {269614898,216627966,269556367,216640629}, {276456483,216628164,276511563,216632291}, 
+    {276843419,216631301,276788073,216634473}, {276511563,216632291,276566752,216635172}, {276788073,216634473,276732708,216636458}, 
+    {276566752,216635172,276622022,216636819}, {276732708,216636458,276677349,216637244}, {276622022,216636819,276677349,216637244}, 
+    {269556367,216640629,269497536,216652072}, {268306988,216646157,268423593,216665296}, {269497536,216652072,269438436,216662310}, 
+    {269438436,216662310,269379099,216671356}, {268423593,216665296,268541424,216680609}, {269379099,216671356,269319558,216679224}, 
+    {269319558,216679224,269259843,216685928}, {268541424,216680609,268660226,216691984}, {269259843,216685928,269199988,216691482}, 
+    {269199988,216691482,269140024,216695899}, {268660226,216691984,268779742,216699311}, {269140024,216695899,269079983,216699194}, 
+    {269079983,216699194,269019897,216701379}, {268779742,216699311,268839689,216701422}, {269019897,216701379,268959798,216702470}, 
+    {268839689,216701422,268899718,216702480}, {268959798,216702470,268899718,216702480}, {259055963,216760519,259030031,216961152}, 
+    {286871762,216792055,286897569,216993591}, {259030031,216961152,259007604,217163081}, {286897569,216993591,286919821,217195853}, 
+    {259007604,217163081,258988745,217365677}, {286919821,217195853,286938445,217398212}, {258988745,217365677,258973515,217568310}, 
+    {286938445,217398212,286953369,217600040}, {258973515,217568310,258961977,217770351}, {286953369,217600040,286964518,217800707}, 
+    {258961977,217770351,258954194,217971170}, {286964518,217800707,286971821,217999586}, {258954194,217971170,258950228,218170137}, 
+    {286971821,217999586,286975204,218196047}, {258950228,218170137,258950142,218366623}, {286975204,218196047,286974595,218389461}, 
+    {258950142,218366623,258953997,218559998}, {286974595,218389461,286969920,218579200}, {258953997,218559998,258961856,218749632}, 
+    {286969920,218579200,286955993,218884126}, {258961856,218749632,259001982,219388193}, {286955993,218884126,286934448,219221356}, 
+    {286934448,219221356,286904756,219583705}, {259001982,219388193,259066423,220122462}, {286904756,219583705,286866385,219963989}, 
+    {286866385,219963989,286818804,220355024}, {259066423,220122462,259109822,220508301}, {286818804,220355024,286761483,220749625}, 
+    {259109822,220508301,259161774,220897444}, {286761483,220749625,286693891,221140609}, {259161774,220897444,259223102,221283016}, 
+    {286693891,221140609,286656077,221332500}, {259223102,221283016,259294632,221658144}, {286656077,221332500,286615496,221520792}, 
+    {286615496,221520792,286572082,221704588}, {259294632,221658144,259334480,221839643}, {286572082,221704588,286525768,221882989}, 
+    {259334480,221839643,259377187,222015953}, {286525768,221882989,286476488,222055097}, {259377187,222015953,259422857,222186214}, 
+    {286476488,222055097,286424176,222220016}, {259422857,222186214,259471593,222349568}, {284379888,222210956,284375199,222210962}, 
+    {284379888,222210956,284384567,222211052}, {284375199,222210962,284370501,222211070}, {284384567,222211052,284389235,222211250}, 
+    {284370501,222211070,284365792,222211282}, {284389235,222211250,284393892,222211549}, {284365792,222211282,284361074,222211597}, 
+    {284393892,222211549,284398539,222211948}, {284361074,222211597,284356348,222212017}, {284398539,222211948,284403173,222212446}, 
+    {284356348,222212017,284351612,222212543}, {284403173,222212446,284407796,222213044}, {284351612,222212543,284346869,222213173}, 
+    {284407796,222213044,284412406,222213740}, {284346869,222213173,284342117,222213911}, {284412406,222213740,284417004,222214534}, 
+    {284342117,222213911,284337358,222214755}, {284417004,222214534,284421589,222215425}, {284337358,222214755,284332591,222215706}, 
+    {284421589,222215425,284426161,222216412}, {284332591,222215706,284327818,222216766}, {284426161,222216412,284430720,222217496}, 
+    {284327818,222216766,284323037,222217934}, {284430720,222217496,284435265,222218675}, {284323037,222217934,284318251,222219212}, 
+    {284435265,222218675,284439796,222219949}, {284318251,222219212,284313458,222220600}, {284439796,222219949,284444312,222221317}, 
+    {286424176,222220016,286396862,222299498}, {284313458,222220600,284308659,222222099}, {284444312,222221317,284448813,222222778}, 
+    {284308659,222222099,284303855,222223708}, {284448813,222222778,284453300,222224332}, {284303855,222223708,284299046,222225430}, 
+    {284453300,222224332,284457771,222225979}, {284299046,222225430,284294233,222227263}, {284457771,222225979,284462226,222227718}, 
+    {284294233,222227263,284289414,222229210}, {284462226,222227718,284466666,222229547}, {284289414,222229210,284284592,222231270}, 
+    {284466666,222229547,284471088,222231467}, {284284592,222231270,284279766,222233445}, {284471088,222231467,284475495,222233477}, 
+    {284279766,222233445,284274936,222235734}, {284475495,222233477,284479884,222235577}, {261498747,222235106,261487782,222235420}, 
+    {261498747,222235106,261509697,222235141}, {261509697,222235141,261520628,222235524}, {261487782,222235420,261476806,222236082}, 
+    {261520628,222235524,261531537,222236258}, {284479884,222235577,284484256,222237765}, {284274936,222235734,284270104,222238139}, 
+    {261476806,222236082,261465822,222237090}, {261531537,222236258,261542419,222237342}, {261465822,222237090,261454834,222238444}, 
+    {261542419,222237342,261553270,222238779}, {284484256,222237765,284488610,222240041}, {284270104,222238139,284265268,222240660}, 
+    {261454834,222238444,261443847,222240142}, {261553270,222238779,261564088,222240568}, {284488610,222240041,284492947,222242404}, 
+    {261443847,222240142,261432864,222242185}, {261564088,222240568,261574868,222242711}, {284265268,222240660,284260430,222243298}, 
+    {261432864,222242185,261421888,222244570}, {284492947,222242404,284501564,222247392}, {261574868,222242711,261585606,222245208}, 
+    {284260430,222243298,284255590,222246053}, {261421888,222244570,261410925,222247298}, {261585606,222245208,261596298,222248060}, 
+    {284255590,222246053,284250747,222248925}, {261410925,222247298,261399976,222250367}, {284501564,222247392,284510106,222252721}, 
+    {261596298,222248060,261606941,222251269}, {284250747,222248925,284245904,222251916}, {261399976,222250367,261389047,222253777}, 
+    {261606941,222251269,261617531,222254835}, {284245904,222251916,284241059,222255027}, {284510106,222252721,284518570,222258389}, 
+    {261389047,222253777,261378141,222257526}, {261617531,222254835,261628064,222258758}, {284241059,222255027,284231366,222261607}, 
+    {261378141,222257526,261367262,222261614}, {284518570,222258389,284526952,222264389}, {261628064,222258758,261638536,222263041}, 
+    {284231366,222261607,284221673,222268670}, {261367262,222261614,261356413,222266040}, {261638536,222263041,261648943,222267683}, 
+    {284526952,222264389,284535251,222270718}, {261356413,222266040,261345599,222270803}, {261648943,222267683,261659282,222272686}, 
+    {284221673,222268670,284211981,222276223}, {284535251,222270718,284543464,222277370}, {261345599,222270803,261334823,222275901}, 
+    {261659282,222272686,261669549,222278050}, {261334823,222275901,261324089,222281335}, {284211981,222276223,284202293,222284268}, 
+    {284543464,222277370,284551589,222284340}, {261669549,222278050,261679740,222283777}, {261324089,222281335,261313401,222287104}, 
+    {261679740,222283777,261689851,222289866}, {284202293,222284268,284192612,222292812}, {284551589,222284340,284559622,222291623}, 
+    {261313401,222287104,261302763,222293206}, {261689851,222289866,261699879,222296320}, {284559622,222291623,284567562,222299215}, 
+    {284192612,222292812,284182940,222301859}, {261302763,222293206,261292178,222299640}, {261699879,222296320,261709819,222303139}, 
+    {284567562,222299215,284575405,222307111}, {286396862,222299498,286368765,222376845}, {261292178,222299640,261281651,222306406}, 
+    {284182940,222301859,284173280,222311413}, {261709819,222303139,261719667,222310324}, {261281651,222306406,261271185,222313503}, 
+    {284575405,222307111,284583150,222315305}, {261719667,222310324,261729421,222317875}, {284173280,222311413,284163635,222321481}, 
+    {261271185,222313503,261260783,222320930}, {284583150,222315305,284590793,222323794}, {261729421,222317875,261739076,222325794}, 
+    {261260783,222320930,261250451,222328686}, {284163635,222321481,284154006,222332066}, {284590793,222323794,284598331,222332572}, 
+    {261739076,222325794,261748628,222334081}, {261250451,222328686,261240191,222336770}, {284154006,222332066,284144397,222343174}, 
+    {284598331,222332572,284605764,222341634}, {261748628,222334081,261758073,222342738}, {261240191,222336770,261230007,222345182}, 
+    {284605764,222341634,284613087,222350975}, {261758073,222342738,261767409,222351765}, {284144397,222343174,284134810,222354809}, 
+    {261230007,222345182,261219904,222353920}, {259471593,222349568,259523497,222505155}, {284613087,222350975,284620298,222360591}, 
+    {261767409,222351765,261776630,222361163}, {261219904,222353920,261207133,222372582}, {284134810,222354809,284125248,222366976}, 
+    {284620298,222360591,284627395,222370477}, {261776630,222361163,261785733,222370932}, {284125248,222366976,283652122,222964294}, 
+    {284627395,222370477,284634375,222380627}, {261785733,222370932,261794714,222381075}, {261207133,222372582,261194777,222391730}, 
+    {286368765,222376845,286339876,222451946}, {284634375,222380627,284641235,222391038}, {261794714,222381075,261803570,222391591}, 
+    {284641235,222391038,284647974,222401704}, {261803570,222391591,261812297,222402482}, {261194777,222391730,261182817,222411336}, 
+    {284647974,222401704,284654587,222412619}, {261812297,222402482,261820890,222413749}, {261182817,222411336,261171230,222431377}, 
+    {284654587,222412619,284661074,222423781}, {261820890,222413749,261829346,222425391}, {284661074,222423781,284667430,222435182}, 
+    {261829346,222425391,261837662,222437411}, {261171230,222431377,261159993,222451826}, {284667430,222435182,284679744,222458688}, 
+    {261837662,222437411,261845833,222449809}, {261845833,222449809,261853855,222462586}, {261159993,222451826,261149086,222472658}, 
+    {286339876,222451946,286310188,222524688}, {284679744,222458688,284701689,222504340}, {261853855,222462586,261861726,222475743}, 
+    {261149086,222472658,261128171,222515367}, {261861726,222475743,261869440,222489280}, {261869440,222489280,262355259,223073550}, 
+    {284701689,222504340,284721478,222549158}, {259523497,222505155,259550670,222579768}, {261128171,222515367,261108312,222559299}, 
+    {286310188,222524688,286279693,222594959}, {284721478,222549158,284739357,222593104}, {261108312,222559299,261089332,222604249}, 
+    {259550670,222579768,259578673,222652116}, {284739357,222593104,284755572,222636136}, {286279693,222594959,286248381,222662647}, 
+    {261089332,222604249,261053317,222696381}, {284755572,222636136,284770371,222678218}, {259578673,222652116,259607520,222722093}, 
+    {286248381,222662647,286216244,222727639}, {284770371,222678218,284783999,222719308}, {261053317,222696381,260984170,222883834}, 
+    {284783999,222719308,284808733,222798359}, {259607520,222722093,259637224,222789591}, {286216244,222727639,286183275,222789823}, 
+    {259637224,222789591,259667797,222854504}, {286183275,222789823,286149465,222849087}, {284808733,222798359,284831747,222872976}, 
+    {286149465,222849087,286132242,222877589}, {259667797,222854504,259699253,222916722}, {284831747,222872976,284843225,222908523}, 
+    {286132242,222877589,286114805,222905318}, {260984170,222883834,260948246,222975874}, {286114805,222905318,286097154,222932262}, 
+    {284843225,222908523,284855013,222942844}, {259699253,222916722,259731604,222976139}, {286097154,222932262,286079288,222958405}, 
+    {284855013,222942844,284867358,222975900}, {286079288,222958405,286061205,222983734}, {283652122,222964294,283165305,223539917}, 
+    {260948246,222975874,260929336,223020753}, {284867358,222975900,284873817,222991940}, {259731604,222976139,259748119,223004764}, 
+    {286061205,222983734,286042905,223008235}, {284873817,222991940,284880507,223007650}, {259748119,223004764,259764863,223032649}, 
+    {284880507,223007650,284887459,223023024}, {286042905,223008235,286024386,223031894}, {260929336,223020753,260909560,223064600}, 
+    {284887459,223023024,284894705,223038057}, {286024386,223031894,286005647,223054696}, {259764863,223032649,259781837,223059779}, 
+    {284894705,223038057,284902275,223052744}, {284902275,223052744,284910200,223067080}, {286005647,223054696,285986688,223076628}, 
+    {259781837,223059779,259799043,223086142}, {260909560,223064600,260888745,223107208}, {284910200,223067080,284918511,223081061}, 
+    {262355259,223073550,262844683,223638293}, {285986688,223076628,285967508,223097675}, {284918511,223081061,284927238,223094681}, 
+    {259799043,223086142,259816482,223111724}, {284927238,223094681,284931768,223101354}, {285967508,223097675,285948104,223117824}, 
+    {284931768,223101354,284936413,223107935}, {260888745,223107208,260877892,223127984}, {284936413,223107935,284941178,223114424}, 
+    {259816482,223111724,259834157,223136512}, {284941178,223114424,284946067,223120820}, {285948104,223117824,285928477,223137061}, 
+    {284946067,223120820,284951082,223127121}, {284951082,223127121,284956229,223133329}, {260877892,223127984,260866715,223148373}, 
+    {284956229,223133329,284961511,223139441}, {259834157,223136512,259852068,223160492}, {285928477,223137061,285908625,223155371}, 
+    {284961511,223139441,284966931,223145457}, {284966931,223145457,284972495,223151378}, {260866715,223148373,260855190,223168349}, 
+    {284972495,223151378,284978205,223157201}, {285908625,223155371,285888547,223172741}, {284978205,223157201,284984065,223162927}, 
+    {259852068,223160492,259870217,223183651}, {284984065,223162927,284990080,223168555}, {260855190,223168349,260843296,223187889}, 
+    {284990080,223168555,284996252,223174084}, {285888547,223172741,285868242,223189156}, {284996252,223174084,285002587,223179514}, 
+    {285002587,223179514,285009088,223184844}, {259870217,223183651,259888607,223205976}, {285009088,223184844,285015758,223190073}, 
+    {260843296,223187889,260831012,223206964}, {285868242,223189156,285858004,223197001}, {285015758,223190073,285022602,223195201}, 
+    {285022602,223195201,285029623,223200227}, {285858004,223197001,285847710,223204603}, {285029623,223200227,285036825,223205151}, 
+    {285847710,223204603,285837358,223211958}, {285036825,223205151,285044213,223209972}, {259888607,223205976,259907238,223227452}, 
+    {260831012,223206964,260818315,223225551}, {285044213,223209972,285051789,223214689}, {285837358,223211958,285826948,223219066}, 
+    {285051789,223214689,285059558,223219302}, {285826948,223219066,285816481,223225926}, {285059558,223219302,285067524,223223810}, 
+    {285067524,223223810,285075691,223228213}, {260818315,223225551,260805183,223243622}, {285816481,223225926,285805957,223232534}, 
+    {259907238,223227452,259926112,223248067}, {285075691,223228213,285084062,223232510}, {285084062,223232510,285092641,223236700}, 
+    {285805957,223232534,285795374,223238889}, {285092641,223236700,285101432,223240782}, {285795374,223238889,285784734,223244990}, 
+    {285101432,223240782,285110439,223244757}, {260805183,223243622,260791595,223261154}, {285110439,223244757,285119666,223248623}, 
+    {285784734,223244990,285774036,223250835}, {259926112,223248067,259945230,223267808}, {285119666,223248623,285129116,223252380}, 
+    {285774036,223250835,285763280,223256422}, {285129116,223252380,285138794,223256027}, {285138794,223256027,285148704,223259564}, 
+    {285763280,223256422,285752465,223261750}, {285148704,223259564,285169232,223266305}, {260791595,223261154,260777529,223278119}, 
+    {285752465,223261750,285741592,223266815}, {285169232,223266305,285190732,223272596}, {285741592,223266815,285730660,223271618}, 
+    {259945230,223267808,259964596,223286660}, {285730660,223271618,285719670,223276156}, {285190732,223272596,285213234,223278433}, 
+    {285719670,223276156,285708621,223280427}, {260777529,223278119,260770310,223286382}, {285213234,223278433,285236770,223283812}, 
+    {285708621,223280427,285697513,223284429}, {285236770,223283812,285261370,223288728}, {285697513,223284429,285686346,223288162}, 
+    {260770310,223286382,260762963,223294493}, {259964596,223286660,259984209,223304611}, {285686346,223288162,285675120,223291622}, 
+    {285261370,223288728,285287065,223293175}, {285675120,223291622,285663835,223294809}, {285287065,223293175,285313886,223297148}, 
+    {260762963,223294493,260755485,223302450}, {285663835,223294809,285652490,223297720}, {285313886,223297148,285341863,223300643}, 
+    {285652490,223297720,285641086,223300354}, {285641086,223300354,285629621,223302709}, {285341863,223300643,285371028,223303655}, 
+    {260755485,223302450,260747875,223310250}, {285629621,223302709,285618098,223304784}, {285371028,223303655,285401411,223306179}, 
+    {259984209,223304611,260004071,223321646}, {285618098,223304784,285606514,223306575}, {285401411,223306179,285433043,223308210}, 
+    {285606514,223306575,285594870,223308083}, {285594870,223308083,285583165,223309305}, {285433043,223308210,285465956,223309743}, 
+    {285583165,223309305,285571401,223310238}, {285465956,223309743,285535744,223311296}, {285571401,223310238,285559576,223310883}, 
+    {260747875,223310250,260740129,223317888}, {285559576,223310883,285547690,223311236}, {285547690,223311236,285535744,223311296}, 
+    {260740129,223317888,260732244,223325363}, {260004071,223321646,260024185,223337753}, {260732244,223325363,260724217,223332671}, 
+    {260724217,223332671,260716047,223339808}, {260024185,223337753,260034337,223345454}, {260716047,223339808,260707730,223346772}, 
+    {260034337,223345454,260044552,223352918}, {260707730,223346772,260699263,223353559}, {260044552,223352918,260054831,223360144}, 
+    {260699263,223353559,260690644,223360166}, {260054831,223360144,260065173,223367128}, {260690644,223360166,260681870,223366590}, 
+    {260681870,223366590,260672938,223372828}, {260065173,223367128,260075579,223373871}, {260672938,223372828,260663846,223378876}, 
+    {260075579,223373871,260086050,223380369}, {260663846,223378876,260654591,223384731}, {260086050,223380369,260096585,223386622}, 
+    {260654591,223384731,260645170,223390390}, {260096585,223386622,260107185,223392628}, {260645170,223390390,260635580,223395850}, 
+    {260107185,223392628,260117849,223398385}, {260635580,223395850,260625819,223401108}, {260117849,223398385,260128579,223403891}, 
+    {260625819,223401108,260615884,223406160}, {260128579,223403891,260139373,223409145}, {260615884,223406160,260605772,223411003}, 
+    {260139373,223409145,260150234,223414145}, {260605772,223411003,260595480,223415634}, {260150234,223414145,260161159,223418889}, 
+    {260595480,223415634,260585006,223420050}, {260161159,223418889,260172151,223423377}, {260585006,223420050,260574347,223424248}, 
+    {260172151,223423377,260183208,223427605}, {260574347,223424248,260563501,223428224}, {260183208,223427605,260194332,223431572}, 
+    {260563501,223428224,260552464,223431975}, {260194332,223431572,260205522,223435277}, {260552464,223431975,260541234,223435498}, 
+    {260205522,223435277,260216779,223438718}, {260541234,223435498,260529808,223438790}, {260216779,223438718,260228103,223441894}, 
+    {260529808,223438790,260518183,223441847}, {260518183,223441847,260506357,223444667}, {260228103,223441894,260239494,223444802}, 
+    {260506357,223444667,260494327,223447246}, {260239494,223444802,260250951,223447441}, {260494327,223447246,260482090,223449581}, 
+    {260250951,223447441,260262477,223449809}, {260482090,223449581,260469644,223451668}, {260262477,223449809,260274070,223451905}, 
+    {260469644,223451668,260456985,223453506}, {260274070,223451905,260285731,223453727}, {260456985,223453506,260444112,223455089}, 
+    {260285731,223453727,260297459,223455273}, {260444112,223455089,260431020,223456416}, {260297459,223455273,260309256,223456542}, 
+    {260431020,223456416,260417709,223457482}, {260309256,223456542,260321122,223457531}, {260417709,223457482,260404174,223458285}, 
+    {260321122,223457531,260333056,223458240}, {260333056,223458240,260347748,223458801}, {260404174,223458285,260390413,223458822}, 
+    {260347748,223458801,260362203,223459083}, {260390413,223458822,260376423,223459089}, {260362203,223459083,260376423,223459089}, 
+    {283165305,223539917,282916502,223819251}, {262844683,223638293,263339846,224182115}, {282916502,223819251,282663962,224092750}, 
+    {282663962,224092750,282407581,224360278}, {263339846,224182115,263842885,224703623}, {282407581,224360278,282147254,224621698}, 
+    {282147254,224621698,281882877,224876873}, {263842885,224703623,264098025,224955573}, {281882877,224876873,281614346,225125666}, 
+    {264098025,224955573,264355934,225201421}, {281614346,225125666,281341555,225367940}, {264355934,225201421,264616879,225440994}, 
+    {281341555,225367940,281064400,225603558}, {264616879,225440994,264881127,225674116}, {281064400,225603558,280782776,225832384}, 
+    {264881127,225674116,265148945,225900613}, {280782776,225832384,280496579,226054280}, {265148945,225900613,265420600,226120312}, 
+    {280496579,226054280,280205705,226269110}, {265420600,226120312,265696359,226333038}, {280205705,226269110,279910048,226476736}, 
+    {265696359,226333038,265976488,226538616}, {279910048,226476736,279609504,226677022}, {265976488,226538616,266261255,226736873}, 
+    {279609504,226677022,279303969,226869831}, {266261255,226736873,266550926,226927633}, {279303969,226869831,278993337,227055026}, 
+    {266550926,226927633,266845768,227110724}, {278993337,227055026,278677504,227232470}, {266845768,227110724,267146048,227285969}, 
+    {278677504,227232470,278356366,227402026}, {267146048,227285969,267452033,227453196}, {278356366,227402026,278029818,227563557}, 
+    {267452033,227453196,267763990,227612230}, {278029818,227563557,277697756,227716927}, {267763990,227612230,268082186,227762896}, 
+    {277697756,227716927,277360074,227861998}, {268082186,227762896,268406887,227905021}, {277360074,227861998,277016668,227998634}, 
+    {268406887,227905021,268738361,228038430}, {277016668,227998634,276667434,228126697}, {268738361,228038430,269076873,228162948}, 
+    {276667434,228126697,276312267,228246051}, {269076873,228162948,269422692,228278401}, {276312267,228246051,275951063,228356559}, 
+    {269422692,228278401,269776084,228384616}, {275951063,228356559,275583716,228458084}, {269776084,228384616,270137316,228481418}, 
+    {275583716,228458084,275210122,228550489}, {270137316,228481418,270506655,228568632}, {275210122,228550489,274830177,228633638}, 
+    {270506655,228568632,270884367,228646084}, {274830177,228633638,274443776,228707392}, {270884367,228646084,271270720,228713600}, 
+    {274443776,228707392,274409024,231383680}, {271270720,228713600,271232384,231373184}, {271232384,231373184,271035881,231414710}, 
+    {274409024,231383680,274608874,231424911}, {271035881,231414710,270840842,231460756}, {274608874,231424911,274807107,231470701}, 
+    {270840842,231460756,270647317,231511265}, {274807107,231470701,275003671,231520991}, {270647317,231511265,270455358,231566176}, 
+    {275003671,231520991,275198517,231575724}, {270455358,231566176,270265016,231625431}, {275198517,231575724,275391596,231634839}, 
+    {270265016,231625431,270076343,231688972}, {275391596,231634839,275582858,231698277}, {270076343,231688972,269889389,231756740}, 
+    {275582858,231698277,275772252,231765980}, {269889389,231756740,269704208,231828675}, {275772252,231765980,275959730,231837888}, 
+    {269704208,231828675,269520849,231904719}, {275959730,231837888,276145241,231913943}, {269520849,231904719,269339364,231984813}, 
+    {276145241,231913943,276328736,231994085}, {269339364,231984813,269159805,232068898}, {276328736,231994085,276510166,232078255}, 
+    {269159805,232068898,268982223,232156916}, {276510166,232078255,276689479,232166395}, {268982223,232156916,268806669,232248808}, 
+    {276689479,232166395,276866627,232258445}, {268806669,232248808,268633196,232344514}, {276866627,232258445,277041559,232354346}, 
+    {268633196,232344514,268461853,232443977}, {277041559,232354346,277214227,232454040}, {268461853,232443977,268292693,232547137}, 
+    {277214227,232454040,277384580,232557466}, {268292693,232547137,268125767,232653935}, {277384580,232557466,277552568,232664567}, 
+    {268125767,232653935,267961126,232764313}, {277552568,232664567,277718143,232775282}, {267961126,232764313,267798823,232878212}, 
+    {277718143,232775282,277881253,232889554}, {267798823,232878212,267638907,232995573}, {277881253,232889554,278041850,233007323}, 
+    {267638907,232995573,267481431,233116337}, {278041850,233007323,278199883,233128529}, {267481431,233116337,267326446,233240446}, 
+    {278199883,233128529,278355303,233253115}, {267326446,233240446,267174003,233367840}, {278355303,233253115,278508060,233381020}, 
+    {267174003,233367840,267024154,233498461}, {278508060,233381020,278658104,233512187}, {267024154,233498461,266876950,233632250}, 
+    {278658104,233512187,278805386,233646555}, {266876950,233632250,266732443,233769148}, {278805386,233646555,278949856,233784066}, 
+    {266732443,233769148,266590683,233909096}, {278949856,233784066,279091463,233924661}, {266590683,233909096,266451723,234052036}, 
+    {279091463,233924661,279230159,234068280}, {266451723,234052036,266315614,234197909}, {279230159,234068280,279365894,234214865}, 
+    {266315614,234197909,266182407,234346656}, {279365894,234214865,279498618,234364357}, {266182407,234346656,266052153,234498218}, 
+    {279498618,234364357,279628280,234516696}, {266052153,234498218,265924904,234652536}, {279628280,234516696,279754832,234671824}, 
+    {265924904,234652536,265800711,234809552}, {279754832,234671824,279878224,234829681}, {265800711,234809552,265679627,234969206}, 
+    {279878224,234829681,279998405,234990209}, {265679627,234969206,265561701,235131440}, {279998405,234990209,280115326,235153349}, 
+    {265561701,235131440,265446986,235296196}, {280115326,235153349,280228938,235319041}, {265446986,235296196,265335532,235463414}, 
+    {280228938,235319041,280339191,235487226}, {265335532,235463414,265227392,235633035}, {280339191,235487226,280446034,235657845}, 
+    {265227392,235633035,265122617,235805000}, {280446034,235657845,280549418,235830840}, {265122617,235805000,265021257,235979252}, 
+    {280549418,235830840,280649294,236006151}, {265021257,235979252,264923365,236155731}, {280649294,236006151,280745611,236183720}, 
+    {264923365,236155731,264828992,236334378}, {280745611,236183720,280838321,236363486}, {264828992,236334378,264738189,236515134}, 
+    {280838321,236363486,280927372,236545392}, {264738189,236515134,264651008,236697941}, {280927372,236545392,281012716,236729378}, 
+    {264651008,236697941,264567500,236882740}, {281012716,236729378,281094302,236915385}, {264567500,236882740,264487716,237069472}, 
+    {281094302,236915385,281172082,237103354}, {264487716,237069472,264411708,237258078}, {281172082,237103354,281246004,237293226}, 
+    {264411708,237258078,264339527,237448499}, {281246004,237293226,281316020,237484942}, {264339527,237448499,264271225,237640677}, 
+    {281316020,237484942,281382080,237678443}, {264271225,237640677,264206853,237834553}, {281382080,237678443,281444133,237873670}, 
+    {264206853,237834553,264146462,238030067}, {281444133,237873670,281502131,238070564}, {264146462,238030067,264090104,238227162}, 
+    {281502131,238070564,281556023,238269065}, {264090104,238227162,264037830,238425778}, {281556023,238269065,281605759,238469116}, 
+    {264037830,238425778,263989692,238625857}, {281605759,238469116,281651291,238670656}, {263989692,238625857,263945740,238827339}, 
+    {281651291,238670656,281692568,238873627}, {263945740,238827339,263906027,239030166}, {281692568,238873627,281729540,239077970}, 
+    {263906027,239030166,263870604,239234280}, {281729540,239077970,281762158,239283625}, {263870604,239234280,263839522,239439620}, 
+    {281762158,239283625,281790372,239490534}, {263839522,239439620,263812833,239646130}, {281790372,239490534,281814132,239698638}, 
+    {263812833,239646130,263790587,239853748}, {281814132,239698638,281833388,239907877}, {263790587,239853748,263772837,240062418}, 
+    {281833388,239907877,281848092,240118192}, {263772837,240062418,263759633,240272080}, {281848092,240118192,281858192,240329525}, 
+    {263759633,240272080,263751028,240482675}, {281858192,240329525,281863639,240541817}, {263751028,240482675,263747072,240694144}, 
+    {281863639,240541817,281864384,240755008}, {263747072,240694144,263748171,240938308}, {281864384,240755008,281859555,240999158}, 
+    {263748171,240938308,263755171,241181007}, {281859555,240999158,281848848,241241802}, {263755171,241181007,263767999,241422163}, 
+    {281848848,241241802,281832337,241482865}, {263767999,241422163,263786585,241661702}, {281832337,241482865,281810093,241722271}, 
+    {263786585,241661702,263810857,241899548}, {281810093,241722271,281782189,241959945}, {263810857,241899548,263840743,242135625}, 
+    {281782189,241959945,281748698,242195813}, {263840743,242135625,263876172,242369858}, {281748698,242195813,281709693,242429798}, 
+    {263876172,242369858,263917073,242602170}, {281709693,242429798,281665246,242661826}, {263917073,242602170,263963373,242832486}, 
+    {281665246,242661826,281615430,242891821}, {263963373,242832486,264015002,243060730}, {281615430,242891821,281560318,243119708}, 
+    {264015002,243060730,264071887,243286826}, {281560318,243119708,281499982,243345411}, {264071887,243286826,264133958,243510699}, 
+    {281499982,243345411,281434495,243568857}, {264133958,243510699,264201143,243732273}, {281434495,243568857,281363930,243789968}, 
+    {264201143,243732273,264273370,243951472}, {281363930,243789968,281288359,244008671}, {264273370,243951472,264350568,244168221}, 
+    {281288359,244008671,281207855,244224890}, {264350568,244168221,264432665,244382443}, {281207855,244224890,281122490,244438549}, 
+    {264432665,244382443,264519590,244594063}, {281122490,244438549,281032338,244649574}, {264519590,244594063,264611271,244803006}, 
+    {281032338,244649574,280937470,244857888}, {264611271,244803006,264707637,245009194}, {280937470,244857888,280837960,245063418}, 
+    {264707637,245009194,264808616,245212554}, {280837960,245063418,280733880,245266087}, {264808616,245212554,264914137,245413008}, 
+    {280733880,245266087,280625304,245465821}, {264914137,245413008,265024128,245610482}, {280625304,245465821,280512302,245662544}, 
+    {265024128,245610482,265138518,245804900}, {280512302,245662544,280394949,245856180}, {265138518,245804900,265257235,245996185}, 
+    {280394949,245856180,280273317,246046656}, {265257235,245996185,265380208,246184262}, {280273317,246046656,280147478,246233895}, 
+    {265380208,246184262,265507364,246369055}, {280147478,246233895,280017505,246417822}, {265507364,246369055,265638634,246550489}, 
+    {280017505,246417822,279883472,246598362}, {265638634,246550489,265773944,246728488}, {279883472,246598362,279745449,246775440}, 
+    {265773944,246728488,265913225,246902976}, {279745449,246775440,279603511,246948980}, {265913225,246902976,266056403,247073877}, 
+    {279603511,246948980,279457730,247118908}, {266056403,247073877,266203408,247241115}, {279457730,247118908,279308178,247285148}, 
+    {266203408,247241115,266354168,247404616}, {279308178,247285148,279154928,247447624}, {266354168,247404616,266508612,247564303}, 
+    {279154928,247447624,278998053,247606262}, {266508612,247564303,266666667,247720100}, {278998053,247606262,278837625,247760986}, 
+    {266666667,247720100,266828264,247871931}, {278837625,247760986,278673718,247911722}, {266828264,247871931,266993329,248019722}, 
+    {278673718,247911722,278506403,248058393}, {266993329,248019722,267161792,248163396}, {278506403,248058393,278335754,248200925}, 
+    {267161792,248163396,267333580,248302877}, {278335754,248200925,278161843,248339242}, {267333580,248302877,267508624,248438090}, 
+    {278161843,248339242,277984742,248473269}, {267508624,248438090,267686850,248568958}, {277984742,248473269,277804525,248602931}, 
+    {267686850,248568958,267868188,248695407}, {277804525,248602931,277621264,248728153}, {267868188,248695407,268052566,248817361}, 
+    {277621264,248728153,277435032,248848859}, {268052566,248817361,268239912,248934743}, {277435032,248848859,277245901,248964974}, 
+    {268239912,248934743,268430155,249047478}, {277245901,248964974,277053944,249076424}, {268430155,249047478,268623224,249155490}, 
+    {277053944,249076424,276859234,249183132}, {268623224,249155490,268819046,249258704}, {276859234,249183132,276661843,249285023}, 
+    {268819046,249258704,269017551,249357043}, {276661843,249285023,276461844,249382022}, {269017551,249357043,269218667,249450433}, 
+    {276461844,249382022,276259310,249474055}, {269218667,249450433,269422322,249538797}, {276259310,249474055,276054313,249561045}, 
+    {269422322,249538797,269628445,249622059}, {276054313,249561045,275846926,249642918}, {269628445,249622059,269836965,249700144}, 
+    {275846926,249642918,275637222,249719598}, {269836965,249700144,270047809,249772977}, {275637222,249719598,275425273,249791010}, 
+    {270047809,249772977,270260907,249840480}, {275425273,249791010,275211152,249857079}, {270260907,249840480,270476186,249902579}, 
+    {275211152,249857079,274994932,249917729}, {270476186,249902579,270693576,249959198}, {274994932,249917729,274776685,249972886}, 
+    {270693576,249959198,270913004,250010261}, {274776685,249972886,274556484,250022473}, {270913004,250010261,271134400,250055693}, 
+    {274556484,250022473,274334401,250066417}, {271134400,250055693,271357692,250095417}, {274334401,250066417,274110510,250104641}, 
+    {271357692,250095417,271582808,250129357}, {274110510,250104641,273884883,250137070}, {271582808,250129357,271809676,250157439}, 
+    {273884883,250137070,273657592,250163630}, {271809676,250157439,272038226,250179587}, {273657592,250163630,273428710,250184244}, 
+    {272038226,250179587,272268386,250195724}, {273428710,250184244,273198311,250198838}, {272268386,250195724,272500084,250205775}, 
+    {273198311,250198838,272966466,250207336}, {272500084,250205775,272733248,250209664}, {272966466,250207336,272733248,250209664}, 
+};
+
+const Segment SEGMENTS_FRAME[] = {
+    {158421952,124070016,387817280,124070016}, {387817280,124070016,387817280,274831296}, {158421952,124070016,158421952,274831296}, 
+    {380177600,127131840,166061632,127131840}, {166061632,127131840,165943782,127133340}, {380177600,127131840,380295450,127133340}, 
+    {165943782,127133340,165826649,127137816}, {380295450,127133340,380412583,127137816}, {165826649,127137816,165710271,127145231}, 
+    {380412583,127137816,380528961,127145231}, {165710271,127145231,165594683,127155549}, {380528961,127145231,380644548,127155549}, 
+    {165594683,127155549,165479923,127168734}, {380644548,127155549,380759308,127168734}, {165479923,127168734,165366026,127184748}, 
+    {380759308,127168734,380873205,127184748}, {165366026,127184748,165253029,127203557}, {380873205,127184748,380986201,127203557}, 
+    {165253029,127203557,165140968,127225122}, {380986201,127203557,381098261,127225122}, {165140968,127225122,165029880,127249409}, 
+    {381098261,127225122,381209349,127249409}, {165029880,127249409,164919801,127276380}, {381209349,127249409,381319427,127276380}, 
+    {164919801,127276380,164810767,127305999}, {381319427,127276380,381428460,127305999}, {164810767,127305999,164702816,127338229}, 
+    {381428460,127305999,381536410,127338229}, {164702816,127338229,164595983,127373035}, {381536410,127338229,381643242,127373035}, 
+    {164595983,127373035,164490305,127410379}, {381643242,127373035,381748919,127410379}, {164490305,127410379,164385818,127450226}, 
+    {381748919,127410379,381853405,127450226}, {164385818,127450226,164282559,127492539}, {381853405,127450226,381956663,127492539}, 
+    {164282559,127492539,164180564,127537281}, {381956663,127492539,382058657,127537281}, {164180564,127537281,164079869,127584417}, 
+    {382058657,127537281,382159350,127584417}, {164079869,127584417,163980512,127633909}, {382159350,127584417,382258707,127633909}, 
+    {163980512,127633909,163882528,127685721}, {382258707,127633909,382356690,127685721}, {163882528,127685721,163785953,127739817}, 
+    {382356690,127685721,382453263,127739817}, {163785953,127739817,163690825,127796160}, {382453263,127739817,382548390,127796160}, 
+    {163690825,127796160,163597179,127854715}, {382548390,127796160,382642034,127854715}, {163597179,127854715,163505053,127915444}, 
+    {382642034,127854715,382734159,127915444}, {163505053,127915444,163414482,127978311}, {382734159,127915444,382824729,127978311}, 
+    {163414482,127978311,163325502,128043280}, {382824729,127978311,382913707,128043280}, {163325502,128043280,163238151,128110315}, 
+    {382913707,128043280,383001056,128110315}, {163238151,128110315,163152465,128179378}, {383001056,128110315,383086741,128179378}, 
+    {163152465,128179378,163068480,128250434}, {383086741,128179378,383170724,128250434}, {163068480,128250434,162986233,128323446}, 
+    {383170724,128250434,383252970,128323446}, {162986233,128323446,162905759,128398377}, {383252970,128323446,383333442,128398377}, 
+    {162905759,128398377,162827096,128475192}, {383333442,128398377,383412104,128475192}, {162827096,128475192,162750280,128553854}, 
+    {383412104,128475192,383488919,128553854}, {162750280,128553854,162675347,128634326}, {383488919,128553854,383563850,128634326}, 
+    {162675347,128634326,162602333,128716572}, {383563850,128634326,383636862,128716572}, {162602333,128716572,162531276,128800555}, 
+    {383636862,128716572,383707918,128800555}, {162531276,128800555,162462211,128886240}, {383707918,128800555,383776981,128886240}, 
+    {162462211,128886240,162395176,128973589}, {383776981,128886240,383844016,128973589}, {162395176,128973589,162330205,129062567}, 
+    {383844016,128973589,383908985,129062567}, {162330205,129062567,162267336,129153137}, {383908985,129062567,383971852,129153137}, 
+    {162267336,129153137,162206606,129245262}, {383971852,129153137,384032581,129245262}, {162206606,129245262,162148050,129338906}, 
+    {384032581,129245262,384091136,129338906}, {162148050,129338906,162091705,129434033}, {384091136,129338906,384147479,129434033}, 
+    {162091705,129434033,162037608,129530606}, {384147479,129434033,384201575,129530606}, {162037608,129530606,161985794,129628589}, 
+    {384201575,129530606,384253387,129628589}, {161985794,129628589,161936301,129727946}, {384253387,129628589,384302879,129727946}, 
+    {161936301,129727946,161889164,129828639}, {384302879,129727946,384350015,129828639}, {161889164,129828639,161844421,129930633}, 
+    {384350015,129828639,384394757,129930633}, {161844421,129930633,161802107,130033891}, {384394757,129930633,384437070,130033891}, 
+    {161802107,130033891,161762259,130138377}, {384437070,130033891,384476917,130138377}, {161762259,130138377,161724914,130244054}, 
+    {384476917,130138377,384514261,130244054}, {161724914,130244054,161690107,130350886}, {384514261,130244054,384549067,130350886}, 
+    {161690107,130350886,161657876,130458836}, {384549067,130350886,384581297,130458836}, {161657876,130458836,161628256,130567869}, 
+    {384581297,130458836,384610916,130567869}, {161628256,130567869,161601284,130677947}, {384610916,130567869,384637887,130677947}, 
+    {161601284,130677947,161576997,130789035}, {384637887,130677947,384662174,130789035}, {161576997,130789035,161555431,130901095}, 
+    {384662174,130789035,384683739,130901095}, {161555431,130901095,161536622,131014091}, {384683739,130901095,384702548,131014091}, 
+    {161536622,131014091,161520607,131127988}, {384702548,131014091,384718562,131127988}, {161520607,131127988,161507422,131242748}, 
+    {384718562,131127988,384731747,131242748}, {161507422,131242748,161497103,131358335}, {384731747,131242748,384742065,131358335}, 
+    {161497103,131358335,161489688,131474713}, {384742065,131358335,384749480,131474713}, {161489688,131474713,161485212,131591846}, 
+    {384749480,131474713,384753956,131591846}, {161485212,131591846,161483712,131709696}, {384753956,131591846,384755456,131709696}, 
+    {161483712,131709696,161483712,189512896}, {384755456,131709696,384755456,189674176}, {161483712,189512896,171085632,199114752}, 
+    {384755456,189674176,375153600,199276032}, {171085632,199114752,171085632,267191616}, {375153600,199276032,375198400,267191616}, 
+    {171085632,267191616,171087100,267309466}, {375198400,267191616,375196900,267309466}, {171087100,267309466,171091479,267426599}, 
+    {375196900,267309466,375192424,267426599}, {171091479,267426599,171098737,267542977}, {375192424,267426599,375185009,267542977}, 
+    {171098737,267542977,171108838,267658564}, {375185009,267542977,375174691,267658564}, {171108838,267658564,171121748,267773324}, 
+    {375174691,267658564,375161506,267773324}, {171121748,267773324,171137433,267887221}, {375161506,267773324,375145492,267887221}, 
+    {171137433,267887221,171155858,268000217}, {375145492,267887221,375126683,268000217}, {171155858,268000217,171176989,268112277}, 
+    {375126683,268000217,375105118,268112277}, {171176989,268112277,171200792,268223365}, {375105118,268112277,375080831,268223365}, 
+    {171200792,268223365,171227232,268333443}, {375080831,268223365,375053860,268333443}, {171227232,268333443,171256275,268442476}, 
+    {375053860,268333443,375024241,268442476}, {171256275,268442476,171287887,268550426}, {375024241,268442476,374992011,268550426}, 
+    {171287887,268550426,171322033,268657258}, {374992011,268550426,374957205,268657258}, {171322033,268657258,171358678,268762935}, 
+    {374957205,268657258,374919861,268762935}, {171358678,268762935,171397789,268867421}, {374919861,268762935,374880014,268867421}, 
+    {171397789,268867421,171439331,268970679}, {374880014,268867421,374837701,268970679}, {171439331,268970679,171483270,269072673}, 
+    {374837701,268970679,374792959,269072673}, {171483270,269072673,171529571,269173366}, {374792959,269072673,374745823,269173366}, 
+    {171529571,269173366,171578200,269272723}, {374745823,269173366,374696331,269272723}, {171578200,269272723,171629122,269370706}, 
+    {374696331,269272723,374644519,269370706}, {171629122,269370706,171682304,269467279}, {374644519,269370706,374590423,269467279}, 
+    {171682304,269467279,171737711,269562406}, {374590423,269467279,374534080,269562406}, {171737711,269562406,171795308,269656050}, 
+    {374534080,269562406,374475525,269656050}, {171795308,269656050,171855061,269748175}, {374475525,269656050,374414796,269748175}, 
+    {171855061,269748175,171916936,269838745}, {374414796,269748175,374351929,269838745}, {171916936,269838745,171980899,269927723}, 
+    {374351929,269838745,374286960,269927723}, {171980899,269927723,172046914,270015072}, {374286960,269927723,374219925,270015072}, 
+    {172046914,270015072,172114948,270100757}, {374219925,270015072,374150862,270100757}, {172114948,270100757,172184967,270184740}, 
+    {374150862,270100757,374079806,270184740}, {172184967,270184740,172256935,270266986}, {374079806,270184740,374006794,270266986}, 
+    {172256935,270266986,172330819,270347458}, {374006794,270266986,373931863,270347458}, {172330819,270347458,172406584,270426120}, 
+    {373931863,270347458,373855048,270426120}, {172406584,270426120,172484196,270502935}, {373855048,270426120,373776386,270502935}, 
+    {172484196,270502935,172563620,270577866}, {373776386,270502935,373695914,270577866}, {172563620,270577866,172644823,270650878}, 
+    {373695914,270577866,373613668,270650878}, {172644823,270650878,172727769,270721934}, {373613668,270650878,373529685,270721934}, 
+    {172727769,270721934,172812425,270790997}, {373529685,270721934,373444000,270790997}, {172812425,270790997,172898755,270858032}, 
+    {373444000,270790997,373356651,270858032}, {172898755,270858032,172986726,270923001}, {373356651,270858032,373267673,270923001}, 
+    {172986726,270923001,173076304,270985868}, {373267673,270923001,373177103,270985868}, {173076304,270985868,173167453,271046597}, 
+    {373177103,270985868,373084978,271046597}, {173167453,271046597,173260140,271105152}, {373084978,271046597,372991334,271105152}, 
+    {173260140,271105152,173354330,271161495}, {372991334,271105152,372896207,271161495}, {173354330,271161495,173449989,271215591}, 
+    {372896207,271161495,372799634,271215591}, {173449989,271215591,173547082,271267403}, {372799634,271215591,372701651,271267403}, 
+    {173547082,271267403,173645576,271316895}, {372701651,271267403,372602294,271316895}, {173645576,271316895,173745435,271364031}, 
+    {372602294,271316895,372501601,271364031}, {173745435,271364031,173846625,271408773}, {372501601,271364031,372399607,271408773}, 
+    {173846625,271408773,173949112,271451086}, {372399607,271408773,372296349,271451086}, {173949112,271451086,174052862,271490933}, 
+    {372296349,271451086,372191863,271490933}, {174052862,271490933,174157840,271528277}, {372191863,271490933,372086186,271528277}, 
+    {174157840,271528277,174264012,271563083}, {372086186,271528277,371979354,271563083}, {174264012,271563083,174371344,271595313}, 
+    {371979354,271563083,371871404,271595313}, {174371344,271595313,174479800,271624932}, {371871404,271595313,371762371,271624932}, 
+    {174479800,271624932,174589348,271651903}, {371762371,271624932,371652293,271651903}, {174589348,271651903,174699952,271676190}, 
+    {371652293,271651903,371541205,271676190}, {174699952,271676190,174811577,271697755}, {371541205,271676190,371429145,271697755}, 
+    {174811577,271697755,174924191,271716564}, {371429145,271697755,371316149,271716564}, {174924191,271716564,175037758,271732578}, 
+    {371316149,271716564,371202252,271732578}, {175037758,271732578,175152243,271745763}, {371202252,271732578,371087492,271745763}, 
+    {175152243,271745763,175267614,271756081}, {371087492,271745763,370971905,271756081}, {175267614,271756081,175383834,271763496}, 
+    {370971905,271756081,370855527,271763496}, {175383834,271763496,175500870,271767972}, {370855527,271763496,370738394,271767972}, 
+    {175500870,271767972,175618688,271769472}, {370738394,271767972,370620544,271769472}, {175618688,271769472,370620544,271769472}, 
+    {387817280,274831296,158421952,274831296}, 
+};
+
+const Segment SEGMENTS_HUND_A[] = {
+    {337442752,131403264,336664832,132093760}, {337442752,131403264,340996352,131403264}, {340996352,131403264,341544576,132058368}, 
+    {341544576,132058368,339811904,133510272}, {336664832,132093760,337884672,133510272}, {339811904,133510272,337884672,133510272}, 
+};
+
+const Segment SEGMENTS_HUND_B[] = {
+    {342300224,132944064,342813056,133590656}, {342300224,132944064,340566400,134520768}, {342813056,133590656,342256128,137638784}, 
+    {340566400,134520768,340119360,137772864}, {342256128,137638784,340999808,138772672}, {340119360,137772864,340999808,138772672}, 
+};
+
+const Segment SEGMENTS_HUND_C[] = {
+    {340847232,140504640,341725312,141492480}, {340847232,140504640,339595968,141678976}, {341725312,141492480,341066752,146168128}, 
+    {339595968,141678976,339047232,145399808}, {339047232,145399808,340320384,146892544}, {341066752,146168128,340320384,146892544}, 
+};
+
+const Segment SEGMENTS_HUND_D[] = {
+    {336259392,146124608,338081344,146131840}, {336259392,146124608,334525184,147670784}, {338081344,146131840,339398400,147663552}, 
+    {339398400,147663552,338747136,148256960}, {334525184,147670784,334993408,148242432}, {334993408,148242432,338747136,148256960}, 
+};
+
+const Segment SEGMENTS_HUND_E[] = {
+    {335161088,140459072,333854528,141585152}, {335161088,140459072,336042240,141493696}, {336042240,141493696,335464960,145206400}, 
+    {333854528,141585152,333216256,146149824}, {335464960,145206400,333702464,146758464}, {333216256,146149824,333702464,146758464}, 
+};
+
+const Segment SEGMENTS_HUND_F[] = {
+    {335756864,132896704,334988544,133568704}, {335756864,132896704,337001536,134359872}, {334988544,133568704,334393280,137730368}, 
+    {337001536,134359872,336557632,137589440}, {336557632,137589440,335269888,138727488}, {334393280,137730368,335269888,138727488}, 
+};
+
+const Segment SEGMENTS_HUND_G[] = {
+    {337341184,138519168,339177088,138524288}, {337341184,138519168,336042240,139637376}, {339177088,138524288,340083648,139606976}, 
+    {340083648,139606976,338837824,140672064}, {336042240,139637376,336862784,140672064}, {336862784,140672064,338837824,140672064}, 
+};
+
+const Segment SEGMENTS_INNER0[] = {
+    {300685952,208503552,300801182,208505010}, {300685952,208503552,300570722,208505010}, {300801182,208505010,300915694,208509361}, 
+    {300570722,208505010,300456210,208509361}, {300915694,208509361,301029451,208516570}, {300456210,208509361,300342453,208516570}, 
+    {301029451,208516570,301142419,208526602}, {300342453,208516570,300229485,208526602}, {301142419,208526602,301254564,208539421}, 
+    {300229485,208526602,300117340,208539421}, {301254564,208539421,301365849,208554994}, {300117340,208539421,300006055,208554994}, 
+    {301365849,208554994,301476240,208573283}, {300006055,208554994,299895664,208573283}, {301476240,208573283,301585702,208594256}, 
+    {299895664,208573283,299786202,208594256}, {301585702,208594256,301694199,208617876}, {299786202,208594256,299677705,208617876}, 
+    {301694199,208617876,301801697,208644108}, {299677705,208617876,299570207,208644108}, {301801697,208644108,301908161,208672917}, 
+    {299570207,208644108,299463743,208672917}, {301908161,208672917,302013555,208704269}, {299463743,208672917,299358349,208704269}, 
+    {302013555,208704269,302117844,208738128}, {299358349,208704269,299254060,208738128}, {302117844,208738128,302220994,208774459}, 
+    {299254060,208738128,299150910,208774459}, {302220994,208774459,302322969,208813228}, {299150910,208774459,299048935,208813228}, 
+    {302322969,208813228,302423734,208854398}, {299048935,208813228,298948170,208854398}, {302423734,208854398,302523254,208897935}, 
+    {298948170,208854398,298848650,208897935}, {302523254,208897935,302621495,208943804}, {298848650,208897935,298750409,208943804}, 
+    {302621495,208943804,302718420,208991970}, {298750409,208943804,298653484,208991970}, {302718420,208991970,302813996,209042398}, 
+    {298653484,208991970,298557908,209042398}, {302813996,209042398,302908186,209095053}, {298557908,209042398,298463718,209095053}, 
+    {302908186,209095053,303000956,209149899}, {298463718,209095053,298370948,209149899}, {303000956,209149899,303092271,209206901}, 
+    {298370948,209149899,298279633,209206901}, {303092271,209206901,303182095,209266025}, {298279633,209206901,298189809,209266025}, 
+    {303182095,209266025,303270394,209327236}, {298189809,209266025,298101510,209327236}, {303270394,209327236,303357133,209390498}, 
+    {298101510,209327236,298014771,209390498}, {303357133,209390498,303442276,209455776}, {298014771,209390498,297929628,209455776}, 
+    {303442276,209455776,303525789,209523035}, {297929628,209455776,297846115,209523035}, {303525789,209523035,303607636,209592241}, 
+    {297846115,209523035,297764268,209592241}, {303607636,209592241,303687782,209663358}, {297764268,209592241,297684122,209663358}, 
+    {303687782,209663358,303766192,209736350}, {297684122,209663358,297605712,209736350}, {303766192,209736350,303842832,209811184}, 
+    {297605712,209736350,297529072,209811184}, {303842832,209811184,303917666,209887824}, {297529072,209811184,297454238,209887824}, 
+    {303917666,209887824,303990658,209966234}, {297454238,209887824,297381246,209966234}, {303990658,209966234,304061775,210046380}, 
+    {297381246,209966234,297310129,210046380}, {304061775,210046380,304130981,210128227}, {297310129,210046380,297240923,210128227}, 
+    {304130981,210128227,304198240,210211740}, {297240923,210128227,297173664,210211740}, {304198240,210211740,304263518,210296883}, 
+    {297173664,210211740,297108386,210296883}, {304263518,210296883,304326780,210383622}, {297108386,210296883,297045124,210383622}, 
+    {304326780,210383622,304387991,210471921}, {297045124,210383622,296983913,210471921}, {304387991,210471921,304447115,210561745}, 
+    {296983913,210471921,296924789,210561745}, {304447115,210561745,304504117,210653060}, {296924789,210561745,296867787,210653060}, 
+    {304504117,210653060,304558963,210745830}, {296867787,210653060,296812941,210745830}, {304558963,210745830,304611618,210840020}, 
+    {296812941,210745830,296760286,210840020}, {304611618,210840020,304662046,210935596}, {296760286,210840020,296709858,210935596}, 
+    {304662046,210935596,304710212,211032521}, {296709858,210935596,296661692,211032521}, {304710212,211032521,304756081,211130762}, 
+    {296661692,211032521,296615823,211130762}, {304756081,211130762,304799618,211230282}, {296615823,211130762,296572286,211230282}, 
+    {304799618,211230282,304840788,211331047}, {296572286,211230282,296531116,211331047}, {304840788,211331047,304879557,211433022}, 
+    {296531116,211331047,296492347,211433022}, {304879557,211433022,304915888,211536172}, {296492347,211433022,296456016,211536172}, 
+    {304915888,211536172,304949747,211640461}, {296456016,211536172,296422157,211640461}, {304949747,211640461,304981099,211745855}, 
+    {296422157,211640461,296390805,211745855}, {304981099,211745855,305009908,211852319}, {296390805,211745855,296361996,211852319}, 
+    {305009908,211852319,305036140,211959817}, {296361996,211852319,296335764,211959817}, {305036140,211959817,305059760,212068314}, 
+    {296335764,211959817,296312144,212068314}, {305059760,212068314,305080733,212177776}, {296312144,212068314,296291171,212177776}, 
+    {305080733,212177776,305099022,212288167}, {296291171,212177776,296272882,212288167}, {305099022,212288167,305114595,212399452}, 
+    {296272882,212288167,296257309,212399452}, {305114595,212399452,305127414,212511597}, {296257309,212399452,296244490,212511597}, 
+    {305127414,212511597,305137446,212624565}, {296244490,212511597,296234458,212624565}, {305137446,212624565,305144655,212738322}, 
+    {296234458,212624565,296227249,212738322}, {305144655,212738322,305149006,212852834}, {296227249,212738322,296222898,212852834}, 
+    {305149006,212852834,305150464,212968064}, {296222898,212852834,296221440,212968064}, {305150464,212968064,305149006,213083294}, 
+    {296221440,212968064,296222898,213083294}, {305149006,213083294,305144655,213197806}, {296222898,213083294,296227249,213197806}, 
+    {305144655,213197806,305137446,213311563}, {296227249,213197806,296234458,213311563}, {305137446,213311563,305127414,213424531}, 
+    {296234458,213311563,296244490,213424531}, {305127414,213424531,305114595,213536676}, {296244490,213424531,296257309,213536676}, 
+    {305114595,213536676,305099022,213647961}, {296257309,213536676,296272882,213647961}, {305099022,213647961,305080733,213758352}, 
+    {296272882,213647961,296291171,213758352}, {305080733,213758352,305059760,213867814}, {296291171,213758352,296312144,213867814}, 
+    {305059760,213867814,305036140,213976311}, {296312144,213867814,296335764,213976311}, {305036140,213976311,305009908,214083809}, 
+    {296335764,213976311,296361996,214083809}, {305009908,214083809,304981099,214190273}, {296361996,214083809,296390805,214190273}, 
+    {304981099,214190273,304949747,214295667}, {296390805,214190273,296422157,214295667}, {304949747,214295667,304915888,214399956}, 
+    {296422157,214295667,296456016,214399956}, {304915888,214399956,304879557,214503106}, {296456016,214399956,296492347,214503106}, 
+    {304879557,214503106,304840788,214605081}, {296492347,214503106,296531116,214605081}, {304840788,214605081,304799618,214705846}, 
+    {296531116,214605081,296572286,214705846}, {304799618,214705846,304756081,214805366}, {296572286,214705846,296615823,214805366}, 
+    {304756081,214805366,304710212,214903607}, {296615823,214805366,296661692,214903607}, {304710212,214903607,304662046,215000532}, 
+    {296661692,214903607,296709858,215000532}, {304662046,215000532,304611618,215096108}, {296709858,215000532,296760286,215096108}, 
+    {304611618,215096108,304558963,215190298}, {296760286,215096108,296812941,215190298}, {304558963,215190298,304504117,215283068}, 
+    {296812941,215190298,296867787,215283068}, {304504117,215283068,304447115,215374383}, {296867787,215283068,296924789,215374383}, 
+    {304447115,215374383,304387991,215464207}, {296924789,215374383,296983913,215464207}, {304387991,215464207,304326780,215552506}, 
+    {296983913,215464207,297045124,215552506}, {304326780,215552506,304263518,215639245}, {297045124,215552506,297108386,215639245}, 
+    {304263518,215639245,304198240,215724388}, {297108386,215639245,297173664,215724388}, {304198240,215724388,304130981,215807901}, 
+    {297173664,215724388,297240923,215807901}, {304130981,215807901,304061775,215889748}, {297240923,215807901,297310129,215889748}, 
+    {304061775,215889748,303990658,215969894}, {297310129,215889748,297381246,215969894}, {303990658,215969894,303917666,216048304}, 
+    {297381246,215969894,297454238,216048304}, {303917666,216048304,303842832,216124944}, {297454238,216048304,297529072,216124944}, 
+    {303842832,216124944,303766192,216199778}, {297529072,216124944,297605712,216199778}, {303766192,216199778,303687782,216272770}, 
+    {297605712,216199778,297684122,216272770}, {303687782,216272770,303607636,216343887}, {297684122,216272770,297764268,216343887}, 
+    {303607636,216343887,303525789,216413093}, {297764268,216343887,297846115,216413093}, {303525789,216413093,303442276,216480352}, 
+    {297846115,216413093,297929628,216480352}, {303442276,216480352,303357133,216545630}, {297929628,216480352,298014771,216545630}, 
+    {303357133,216545630,303270394,216608892}, {298014771,216545630,298101510,216608892}, {303270394,216608892,303182095,216670103}, 
+    {298101510,216608892,298189809,216670103}, {303182095,216670103,303092271,216729227}, {298189809,216670103,298279633,216729227}, 
+    {303092271,216729227,303000956,216786229}, {298279633,216729227,298370948,216786229}, {303000956,216786229,302908186,216841075}, 
+    {298370948,216786229,298463718,216841075}, {302908186,216841075,302813996,216893730}, {298463718,216841075,298557908,216893730}, 
+    {302813996,216893730,302718420,216944158}, {298557908,216893730,298653484,216944158}, {302718420,216944158,302621495,216992324}, 
+    {298653484,216944158,298750409,216992324}, {302621495,216992324,302523254,217038193}, {298750409,216992324,298848650,217038193}, 
+    {302523254,217038193,302423734,217081730}, {298848650,217038193,298948170,217081730}, {302423734,217081730,302322969,217122900}, 
+    {298948170,217081730,299048935,217122900}, {302322969,217122900,302220994,217161669}, {299048935,217122900,299150910,217161669}, 
+    {302220994,217161669,302117844,217198000}, {299150910,217161669,299254060,217198000}, {302117844,217198000,302013555,217231859}, 
+    {299254060,217198000,299358349,217231859}, {302013555,217231859,301908161,217263211}, {299358349,217231859,299463743,217263211}, 
+    {301908161,217263211,301801697,217292020}, {299463743,217263211,299570207,217292020}, {301801697,217292020,301694199,217318252}, 
+    {299570207,217292020,299677705,217318252}, {301694199,217318252,301585702,217341872}, {299677705,217318252,299786202,217341872}, 
+    {301585702,217341872,301476240,217362845}, {299786202,217341872,299895664,217362845}, {301476240,217362845,301365849,217381134}, 
+    {299895664,217362845,300006055,217381134}, {301365849,217381134,301254564,217396707}, {300006055,217381134,300117340,217396707}, 
+    {301254564,217396707,301142419,217409526}, {300117340,217396707,300229485,217409526}, {301142419,217409526,301029451,217419558}, 
+    {300229485,217409526,300342453,217419558}, {301029451,217419558,300915694,217426767}, {300342453,217419558,300456210,217426767}, 
+    {300915694,217426767,300801182,217431118}, {300456210,217426767,300570722,217431118}, {300801182,217431118,300685952,217432576}, 
+    {300570722,217431118,300685952,217432576}, 
+};
+
+const Segment SEGMENTS_INNER1[] = {
+    {300113408,192549760,300228638,192551218}, {300113408,192549760,299998178,192551218}, {300228638,192551218,300343150,192555569}, 
+    {299998178,192551218,299883666,192555569}, {300343150,192555569,300456907,192562778}, {299883666,192555569,299769909,192562778}, 
+    {300456907,192562778,300569875,192572810}, {299769909,192562778,299656941,192572810}, {300569875,192572810,300682020,192585629}, 
+    {299656941,192572810,299544796,192585629}, {300682020,192585629,300793305,192601202}, {299544796,192585629,299433511,192601202}, 
+    {300793305,192601202,300903696,192619491}, {299433511,192601202,299323120,192619491}, {300903696,192619491,301013158,192640464}, 
+    {299323120,192619491,299213658,192640464}, {301013158,192640464,301121655,192664084}, {299213658,192640464,299105161,192664084}, 
+    {301121655,192664084,301229153,192690316}, {299105161,192664084,298997663,192690316}, {301229153,192690316,301335617,192719125}, 
+    {298997663,192690316,298891199,192719125}, {301335617,192719125,301441011,192750477}, {298891199,192719125,298785805,192750477}, 
+    {301441011,192750477,301545300,192784336}, {298785805,192750477,298681516,192784336}, {301545300,192784336,301648450,192820667}, 
+    {298681516,192784336,298578366,192820667}, {301648450,192820667,301750425,192859436}, {298578366,192820667,298476391,192859436}, 
+    {301750425,192859436,301851190,192900606}, {298476391,192859436,298375626,192900606}, {301851190,192900606,301950710,192944143}, 
+    {298375626,192900606,298276106,192944143}, {301950710,192944143,302048951,192990012}, {298276106,192944143,298177865,192990012}, 
+    {302048951,192990012,302145876,193038178}, {298177865,192990012,298080940,193038178}, {302145876,193038178,302241452,193088606}, 
+    {298080940,193038178,297985364,193088606}, {302241452,193088606,302335642,193141261}, {297985364,193088606,297891174,193141261}, 
+    {302335642,193141261,302428412,193196107}, {297891174,193141261,297798404,193196107}, {302428412,193196107,302519727,193253109}, 
+    {297798404,193196107,297707089,193253109}, {302519727,193253109,302609551,193312233}, {297707089,193253109,297617265,193312233}, 
+    {302609551,193312233,302697850,193373444}, {297617265,193312233,297528966,193373444}, {302697850,193373444,302784589,193436706}, 
+    {297528966,193373444,297442227,193436706}, {302784589,193436706,302869732,193501984}, {297442227,193436706,297357084,193501984}, 
+    {302869732,193501984,302953245,193569243}, {297357084,193501984,297273571,193569243}, {302953245,193569243,303035092,193638449}, 
+    {297273571,193569243,297191724,193638449}, {303035092,193638449,303115238,193709566}, {297191724,193638449,297111578,193709566}, 
+    {303115238,193709566,303193648,193782558}, {297111578,193709566,297033168,193782558}, {303193648,193782558,303270288,193857392}, 
+    {297033168,193782558,296956528,193857392}, {303270288,193857392,303345122,193934032}, {296956528,193857392,296881694,193934032}, 
+    {303345122,193934032,303418114,194012442}, {296881694,193934032,296808702,194012442}, {303418114,194012442,303489231,194092588}, 
+    {296808702,194012442,296737585,194092588}, {303489231,194092588,303558437,194174435}, {296737585,194092588,296668379,194174435}, 
+    {303558437,194174435,303625696,194257948}, {296668379,194174435,296601120,194257948}, {303625696,194257948,303690974,194343091}, 
+    {296601120,194257948,296535842,194343091}, {303690974,194343091,303754236,194429830}, {296535842,194343091,296472580,194429830}, 
+    {303754236,194429830,303815447,194518129}, {296472580,194429830,296411369,194518129}, {303815447,194518129,303874571,194607953}, 
+    {296411369,194518129,296352245,194607953}, {303874571,194607953,303931573,194699268}, {296352245,194607953,296295243,194699268}, 
+    {303931573,194699268,303986419,194792038}, {296295243,194699268,296240397,194792038}, {303986419,194792038,304039074,194886228}, 
+    {296240397,194792038,296187742,194886228}, {304039074,194886228,304089502,194981804}, {296187742,194886228,296137314,194981804}, 
+    {304089502,194981804,304137668,195078729}, {296137314,194981804,296089148,195078729}, {304137668,195078729,304183537,195176970}, 
+    {296089148,195078729,296043279,195176970}, {304183537,195176970,304227074,195276490}, {296043279,195176970,295999742,195276490}, 
+    {304227074,195276490,304268244,195377255}, {295999742,195276490,295958572,195377255}, {304268244,195377255,304307013,195479230}, 
+    {295958572,195377255,295919803,195479230}, {304307013,195479230,304343344,195582380}, {295919803,195479230,295883472,195582380}, 
+    {304343344,195582380,304377203,195686669}, {295883472,195582380,295849613,195686669}, {304377203,195686669,304408555,195792063}, 
+    {295849613,195686669,295818261,195792063}, {304408555,195792063,304437364,195898527}, {295818261,195792063,295789452,195898527}, 
+    {304437364,195898527,304463596,196006025}, {295789452,195898527,295763220,196006025}, {304463596,196006025,304487216,196114522}, 
+    {295763220,196006025,295739600,196114522}, {304487216,196114522,304508189,196223984}, {295739600,196114522,295718627,196223984}, 
+    {304508189,196223984,304526478,196334375}, {295718627,196223984,295700338,196334375}, {304526478,196334375,304542051,196445660}, 
+    {295700338,196334375,295684765,196445660}, {304542051,196445660,304554870,196557805}, {295684765,196445660,295671946,196557805}, 
+    {304554870,196557805,304564902,196670773}, {295671946,196557805,295661914,196670773}, {304564902,196670773,304572111,196784530}, 
+    {295661914,196670773,295654705,196784530}, {304572111,196784530,304576462,196899042}, {295654705,196784530,295650354,196899042}, 
+    {304576462,196899042,304577920,197014272}, {295650354,196899042,295648896,197014272}, {304577920,197014272,304576462,197129502}, 
+    {295648896,197014272,295650354,197129502}, {304576462,197129502,304572111,197244014}, {295650354,197129502,295654705,197244014}, 
+    {304572111,197244014,304564902,197357771}, {295654705,197244014,295661914,197357771}, {304564902,197357771,304554870,197470739}, 
+    {295661914,197357771,295671946,197470739}, {304554870,197470739,304542051,197582884}, {295671946,197470739,295684765,197582884}, 
+    {304542051,197582884,304526478,197694169}, {295684765,197582884,295700338,197694169}, {304526478,197694169,304508189,197804560}, 
+    {295700338,197694169,295718627,197804560}, {304508189,197804560,304487216,197914022}, {295718627,197804560,295739600,197914022}, 
+    {304487216,197914022,304463596,198022519}, {295739600,197914022,295763220,198022519}, {304463596,198022519,304437364,198130017}, 
+    {295763220,198022519,295789452,198130017}, {304437364,198130017,304408555,198236481}, {295789452,198130017,295818261,198236481}, 
+    {304408555,198236481,304377203,198341875}, {295818261,198236481,295849613,198341875}, {304377203,198341875,304343344,198446164}, 
+    {295849613,198341875,295883472,198446164}, {304343344,198446164,304307013,198549314}, {295883472,198446164,295919803,198549314}, 
+    {304307013,198549314,304268244,198651289}, {295919803,198549314,295958572,198651289}, {304268244,198651289,304227074,198752054}, 
+    {295958572,198651289,295999742,198752054}, {304227074,198752054,304183537,198851574}, {295999742,198752054,296043279,198851574}, 
+    {304183537,198851574,304137668,198949815}, {296043279,198851574,296089148,198949815}, {304137668,198949815,304089502,199046740}, 
+    {296089148,198949815,296137314,199046740}, {304089502,199046740,304039074,199142316}, {296137314,199046740,296187742,199142316}, 
+    {304039074,199142316,303986419,199236506}, {296187742,199142316,296240397,199236506}, {303986419,199236506,303931573,199329276}, 
+    {296240397,199236506,296295243,199329276}, {303931573,199329276,303874571,199420591}, {296295243,199329276,296352245,199420591}, 
+    {303874571,199420591,303815447,199510415}, {296352245,199420591,296411369,199510415}, {303815447,199510415,303754236,199598714}, 
+    {296411369,199510415,296472580,199598714}, {303754236,199598714,303690974,199685453}, {296472580,199598714,296535842,199685453}, 
+    {303690974,199685453,303625696,199770596}, {296535842,199685453,296601120,199770596}, {303625696,199770596,303558437,199854109}, 
+    {296601120,199770596,296668379,199854109}, {303558437,199854109,303489231,199935956}, {296668379,199854109,296737585,199935956}, 
+    {303489231,199935956,303418114,200016102}, {296737585,199935956,296808702,200016102}, {303418114,200016102,303345122,200094512}, 
+    {296808702,200016102,296881694,200094512}, {303345122,200094512,303270288,200171152}, {296881694,200094512,296956528,200171152}, 
+    {303270288,200171152,303193648,200245986}, {296956528,200171152,297033168,200245986}, {303193648,200245986,303115238,200318978}, 
+    {297033168,200245986,297111578,200318978}, {303115238,200318978,303035092,200390095}, {297111578,200318978,297191724,200390095}, 
+    {303035092,200390095,302953245,200459301}, {297191724,200390095,297273571,200459301}, {302953245,200459301,302869732,200526560}, 
+    {297273571,200459301,297357084,200526560}, {302869732,200526560,302784589,200591838}, {297357084,200526560,297442227,200591838}, 
+    {302784589,200591838,302697850,200655100}, {297442227,200591838,297528966,200655100}, {302697850,200655100,302609551,200716311}, 
+    {297528966,200655100,297617265,200716311}, {302609551,200716311,302519727,200775435}, {297617265,200716311,297707089,200775435}, 
+    {302519727,200775435,302428412,200832437}, {297707089,200775435,297798404,200832437}, {302428412,200832437,302335642,200887283}, 
+    {297798404,200832437,297891174,200887283}, {302335642,200887283,302241452,200939938}, {297891174,200887283,297985364,200939938}, 
+    {302241452,200939938,302145876,200990366}, {297985364,200939938,298080940,200990366}, {302145876,200990366,302048951,201038532}, 
+    {298080940,200990366,298177865,201038532}, {302048951,201038532,301950710,201084401}, {298177865,201038532,298276106,201084401}, 
+    {301950710,201084401,301851190,201127938}, {298276106,201084401,298375626,201127938}, {301851190,201127938,301750425,201169108}, 
+    {298375626,201127938,298476391,201169108}, {301750425,201169108,301648450,201207877}, {298476391,201169108,298578366,201207877}, 
+    {301648450,201207877,301545300,201244208}, {298578366,201207877,298681516,201244208}, {301545300,201244208,301441011,201278067}, 
+    {298681516,201244208,298785805,201278067}, {301441011,201278067,301335617,201309419}, {298785805,201278067,298891199,201309419}, 
+    {301335617,201309419,301229153,201338228}, {298891199,201309419,298997663,201338228}, {301229153,201338228,301121655,201364460}, 
+    {298997663,201338228,299105161,201364460}, {301121655,201364460,301013158,201388080}, {299105161,201364460,299213658,201388080}, 
+    {301013158,201388080,300903696,201409053}, {299213658,201388080,299323120,201409053}, {300903696,201409053,300793305,201427342}, 
+    {299323120,201409053,299433511,201427342}, {300793305,201427342,300682020,201442915}, {299433511,201427342,299544796,201442915}, 
+    {300682020,201442915,300569875,201455734}, {299544796,201442915,299656941,201455734}, {300569875,201455734,300456907,201465766}, 
+    {299656941,201455734,299769909,201465766}, {300456907,201465766,300343150,201472975}, {299769909,201465766,299883666,201472975}, 
+    {300343150,201472975,300228638,201477326}, {299883666,201472975,299998178,201477326}, {300228638,201477326,300113408,201478784}, 
+    {299998178,201477326,300113408,201478784}, 
+};
+
+const Segment SEGMENTS_INNER2[] = {
+    {294131392,177519616,294246622,177521074}, {294131392,177519616,294016162,177521074}, {294246622,177521074,294361134,177525425}, 
+    {294016162,177521074,293901650,177525425}, {294361134,177525425,294474891,177532634}, {293901650,177525425,293787893,177532634}, 
+    {294474891,177532634,294587859,177542666}, {293787893,177532634,293674925,177542666}, {294587859,177542666,294700004,177555485}, 
+    {293674925,177542666,293562780,177555485}, {294700004,177555485,294811289,177571058}, {293562780,177555485,293451495,177571058}, 
+    {294811289,177571058,294921680,177589347}, {293451495,177571058,293341104,177589347}, {294921680,177589347,295031142,177610320}, 
+    {293341104,177589347,293231642,177610320}, {295031142,177610320,295139639,177633940}, {293231642,177610320,293123145,177633940}, 
+    {295139639,177633940,295247137,177660172}, {293123145,177633940,293015647,177660172}, {295247137,177660172,295353601,177688981}, 
+    {293015647,177660172,292909183,177688981}, {295353601,177688981,295458995,177720333}, {292909183,177688981,292803789,177720333}, 
+    {295458995,177720333,295563284,177754192}, {292803789,177720333,292699500,177754192}, {295563284,177754192,295666434,177790523}, 
+    {292699500,177754192,292596350,177790523}, {295666434,177790523,295768409,177829292}, {292596350,177790523,292494375,177829292}, 
+    {295768409,177829292,295869174,177870462}, {292494375,177829292,292393610,177870462}, {295869174,177870462,295968694,177913999}, 
+    {292393610,177870462,292294090,177913999}, {295968694,177913999,296066935,177959868}, {292294090,177913999,292195849,177959868}, 
+    {296066935,177959868,296163860,178008034}, {292195849,177959868,292098924,178008034}, {296163860,178008034,296259436,178058462}, 
+    {292098924,178008034,292003348,178058462}, {296259436,178058462,296353626,178111117}, {292003348,178058462,291909158,178111117}, 
+    {296353626,178111117,296446396,178165963}, {291909158,178111117,291816388,178165963}, {296446396,178165963,296537711,178222965}, 
+    {291816388,178165963,291725073,178222965}, {296537711,178222965,296627535,178282089}, {291725073,178222965,291635249,178282089}, 
+    {296627535,178282089,296715834,178343300}, {291635249,178282089,291546950,178343300}, {296715834,178343300,296802573,178406562}, 
+    {291546950,178343300,291460211,178406562}, {296802573,178406562,296887716,178471840}, {291460211,178406562,291375068,178471840}, 
+    {296887716,178471840,296971229,178539099}, {291375068,178471840,291291555,178539099}, {296971229,178539099,297053076,178608305}, 
+    {291291555,178539099,291209708,178608305}, {297053076,178608305,297133222,178679422}, {291209708,178608305,291129562,178679422}, 
+    {297133222,178679422,297211632,178752414}, {291129562,178679422,291051152,178752414}, {297211632,178752414,297288272,178827248}, 
+    {291051152,178752414,290974512,178827248}, {297288272,178827248,297363106,178903888}, {290974512,178827248,290899678,178903888}, 
+    {297363106,178903888,297436098,178982298}, {290899678,178903888,290826686,178982298}, {297436098,178982298,297507215,179062444}, 
+    {290826686,178982298,290755569,179062444}, {297507215,179062444,297576421,179144291}, {290755569,179062444,290686363,179144291}, 
+    {297576421,179144291,297643680,179227804}, {290686363,179144291,290619104,179227804}, {297643680,179227804,297708958,179312947}, 
+    {290619104,179227804,290553826,179312947}, {297708958,179312947,297772220,179399686}, {290553826,179312947,290490564,179399686}, 
+    {297772220,179399686,297833431,179487985}, {290490564,179399686,290429353,179487985}, {297833431,179487985,297892555,179577809}, 
+    {290429353,179487985,290370229,179577809}, {297892555,179577809,297949557,179669124}, {290370229,179577809,290313227,179669124}, 
+    {297949557,179669124,298004403,179761894}, {290313227,179669124,290258381,179761894}, {298004403,179761894,298057058,179856084}, 
+    {290258381,179761894,290205726,179856084}, {298057058,179856084,298107486,179951660}, {290205726,179856084,290155298,179951660}, 
+    {298107486,179951660,298155652,180048585}, {290155298,179951660,290107132,180048585}, {298155652,180048585,298201521,180146826}, 
+    {290107132,180048585,290061263,180146826}, {298201521,180146826,298245058,180246346}, {290061263,180146826,290017726,180246346}, 
+    {298245058,180246346,298286228,180347111}, {290017726,180246346,289976556,180347111}, {298286228,180347111,298324997,180449086}, 
+    {289976556,180347111,289937787,180449086}, {298324997,180449086,298361328,180552236}, {289937787,180449086,289901456,180552236}, 
+    {298361328,180552236,298395187,180656525}, {289901456,180552236,289867597,180656525}, {298395187,180656525,298426539,180761919}, 
+    {289867597,180656525,289836245,180761919}, {298426539,180761919,298455348,180868383}, {289836245,180761919,289807436,180868383}, 
+    {298455348,180868383,298481580,180975881}, {289807436,180868383,289781204,180975881}, {298481580,180975881,298505200,181084378}, 
+    {289781204,180975881,289757584,181084378}, {298505200,181084378,298526173,181193840}, {289757584,181084378,289736611,181193840}, 
+    {298526173,181193840,298544462,181304231}, {289736611,181193840,289718322,181304231}, {298544462,181304231,298560035,181415516}, 
+    {289718322,181304231,289702749,181415516}, {298560035,181415516,298572854,181527661}, {289702749,181415516,289689930,181527661}, 
+    {298572854,181527661,298582886,181640629}, {289689930,181527661,289679898,181640629}, {298582886,181640629,298590095,181754386}, 
+    {289679898,181640629,289672689,181754386}, {298590095,181754386,298594446,181868898}, {289672689,181754386,289668338,181868898}, 
+    {298594446,181868898,298595904,181984128}, {289668338,181868898,289666880,181984128}, {298595904,181984128,298594446,182099358}, 
+    {289666880,181984128,289668338,182099358}, {298594446,182099358,298590095,182213870}, {289668338,182099358,289672689,182213870}, 
+    {298590095,182213870,298582886,182327627}, {289672689,182213870,289679898,182327627}, {298582886,182327627,298572854,182440595}, 
+    {289679898,182327627,289689930,182440595}, {298572854,182440595,298560035,182552740}, {289689930,182440595,289702749,182552740}, 
+    {298560035,182552740,298544462,182664025}, {289702749,182552740,289718322,182664025}, {298544462,182664025,298526173,182774416}, 
+    {289718322,182664025,289736611,182774416}, {298526173,182774416,298505200,182883878}, {289736611,182774416,289757584,182883878}, 
+    {298505200,182883878,298481580,182992375}, {289757584,182883878,289781204,182992375}, {298481580,182992375,298455348,183099873}, 
+    {289781204,182992375,289807436,183099873}, {298455348,183099873,298426539,183206337}, {289807436,183099873,289836245,183206337}, 
+    {298426539,183206337,298395187,183311731}, {289836245,183206337,289867597,183311731}, {298395187,183311731,298361328,183416020}, 
+    {289867597,183311731,289901456,183416020}, {298361328,183416020,298324997,183519170}, {289901456,183416020,289937787,183519170}, 
+    {298324997,183519170,298286228,183621145}, {289937787,183519170,289976556,183621145}, {298286228,183621145,298245058,183721910}, 
+    {289976556,183621145,290017726,183721910}, {298245058,183721910,298201521,183821430}, {290017726,183721910,290061263,183821430}, 
+    {298201521,183821430,298155652,183919671}, {290061263,183821430,290107132,183919671}, {298155652,183919671,298107486,184016596}, 
+    {290107132,183919671,290155298,184016596}, {298107486,184016596,298057058,184112172}, {290155298,184016596,290205726,184112172}, 
+    {298057058,184112172,298004403,184206362}, {290205726,184112172,290258381,184206362}, {298004403,184206362,297949557,184299132}, 
+    {290258381,184206362,290313227,184299132}, {297949557,184299132,297892555,184390447}, {290313227,184299132,290370229,184390447}, 
+    {297892555,184390447,297833431,184480271}, {290370229,184390447,290429353,184480271}, {297833431,184480271,297772220,184568570}, 
+    {290429353,184480271,290490564,184568570}, {297772220,184568570,297708958,184655309}, {290490564,184568570,290553826,184655309}, 
+    {297708958,184655309,297643680,184740452}, {290553826,184655309,290619104,184740452}, {297643680,184740452,297576421,184823965}, 
+    {290619104,184740452,290686363,184823965}, {297576421,184823965,297507215,184905812}, {290686363,184823965,290755569,184905812}, 
+    {297507215,184905812,297436098,184985958}, {290755569,184905812,290826686,184985958}, {297436098,184985958,297363106,185064368}, 
+    {290826686,184985958,290899678,185064368}, {297363106,185064368,297288272,185141008}, {290899678,185064368,290974512,185141008}, 
+    {297288272,185141008,297211632,185215842}, {290974512,185141008,291051152,185215842}, {297211632,185215842,297133222,185288834}, 
+    {291051152,185215842,291129562,185288834}, {297133222,185288834,297053076,185359951}, {291129562,185288834,291209708,185359951}, 
+    {297053076,185359951,296971229,185429157}, {291209708,185359951,291291555,185429157}, {296971229,185429157,296887716,185496416}, 
+    {291291555,185429157,291375068,185496416}, {296887716,185496416,296802573,185561694}, {291375068,185496416,291460211,185561694}, 
+    {296802573,185561694,296715834,185624956}, {291460211,185561694,291546950,185624956}, {296715834,185624956,296627535,185686167}, 
+    {291546950,185624956,291635249,185686167}, {296627535,185686167,296537711,185745291}, {291635249,185686167,291725073,185745291}, 
+    {296537711,185745291,296446396,185802293}, {291725073,185745291,291816388,185802293}, {296446396,185802293,296353626,185857139}, 
+    {291816388,185802293,291909158,185857139}, {296353626,185857139,296259436,185909794}, {291909158,185857139,292003348,185909794}, 
+    {296259436,185909794,296163860,185960222}, {292003348,185909794,292098924,185960222}, {296163860,185960222,296066935,186008388}, 
+    {292098924,185960222,292195849,186008388}, {296066935,186008388,295968694,186054257}, {292195849,186008388,292294090,186054257}, 
+    {295968694,186054257,295869174,186097794}, {292294090,186054257,292393610,186097794}, {295869174,186097794,295768409,186138964}, 
+    {292393610,186097794,292494375,186138964}, {295768409,186138964,295666434,186177733}, {292494375,186138964,292596350,186177733}, 
+    {295666434,186177733,295563284,186214064}, {292596350,186177733,292699500,186214064}, {295563284,186214064,295458995,186247923}, 
+    {292699500,186214064,292803789,186247923}, {295458995,186247923,295353601,186279275}, {292803789,186247923,292909183,186279275}, 
+    {295353601,186279275,295247137,186308084}, {292909183,186279275,293015647,186308084}, {295247137,186308084,295139639,186334316}, 
+    {293015647,186308084,293123145,186334316}, {295139639,186334316,295031142,186357936}, {293123145,186334316,293231642,186357936}, 
+    {295031142,186357936,294921680,186378909}, {293231642,186357936,293341104,186378909}, {294921680,186378909,294811289,186397198}, 
+    {293341104,186378909,293451495,186397198}, {294811289,186397198,294700004,186412771}, {293451495,186397198,293562780,186412771}, 
+    {294700004,186412771,294587859,186425590}, {293562780,186412771,293674925,186425590}, {294587859,186425590,294474891,186435622}, 
+    {293674925,186425590,293787893,186435622}, {294474891,186435622,294361134,186442831}, {293787893,186435622,293901650,186442831}, 
+    {294361134,186442831,294246622,186447182}, {293901650,186442831,294016162,186447182}, {294246622,186447182,294131392,186448640}, 
+    {294016162,186447182,294131392,186448640}, 
+};
+
+const Segment SEGMENTS_INNER3[] = {
+    {281023616,168259008,281138846,168260466}, {281023616,168259008,280908386,168260466}, {281138846,168260466,281253358,168264817}, 
+    {280908386,168260466,280793874,168264817}, {281253358,168264817,281367115,168272026}, {280793874,168264817,280680117,168272026}, 
+    {281367115,168272026,281480083,168282058}, {280680117,168272026,280567149,168282058}, {281480083,168282058,281592228,168294877}, 
+    {280567149,168282058,280455004,168294877}, {281592228,168294877,281703513,168310450}, {280455004,168294877,280343719,168310450}, 
+    {281703513,168310450,281813904,168328739}, {280343719,168310450,280233328,168328739}, {281813904,168328739,281923366,168349712}, 
+    {280233328,168328739,280123866,168349712}, {281923366,168349712,282031863,168373332}, {280123866,168349712,280015369,168373332}, 
+    {282031863,168373332,282139361,168399564}, {280015369,168373332,279907871,168399564}, {282139361,168399564,282245825,168428373}, 
+    {279907871,168399564,279801407,168428373}, {282245825,168428373,282351219,168459725}, {279801407,168428373,279696013,168459725}, 
+    {282351219,168459725,282455508,168493584}, {279696013,168459725,279591724,168493584}, {282455508,168493584,282558658,168529915}, 
+    {279591724,168493584,279488574,168529915}, {282558658,168529915,282660633,168568684}, {279488574,168529915,279386599,168568684}, 
+    {282660633,168568684,282761398,168609854}, {279386599,168568684,279285834,168609854}, {282761398,168609854,282860918,168653391}, 
+    {279285834,168609854,279186314,168653391}, {282860918,168653391,282959159,168699260}, {279186314,168653391,279088073,168699260}, 
+    {282959159,168699260,283056084,168747426}, {279088073,168699260,278991148,168747426}, {283056084,168747426,283151660,168797854}, 
+    {278991148,168747426,278895572,168797854}, {283151660,168797854,283245850,168850509}, {278895572,168797854,278801382,168850509}, 
+    {283245850,168850509,283338620,168905355}, {278801382,168850509,278708612,168905355}, {283338620,168905355,283429935,168962357}, 
+    {278708612,168905355,278617297,168962357}, {283429935,168962357,283519759,169021481}, {278617297,168962357,278527473,169021481}, 
+    {283519759,169021481,283608058,169082692}, {278527473,169021481,278439174,169082692}, {283608058,169082692,283694797,169145954}, 
+    {278439174,169082692,278352435,169145954}, {283694797,169145954,283779940,169211232}, {278352435,169145954,278267292,169211232}, 
+    {283779940,169211232,283863453,169278491}, {278267292,169211232,278183779,169278491}, {283863453,169278491,283945300,169347697}, 
+    {278183779,169278491,278101932,169347697}, {283945300,169347697,284025446,169418814}, {278101932,169347697,278021786,169418814}, 
+    {284025446,169418814,284103856,169491806}, {278021786,169418814,277943376,169491806}, {284103856,169491806,284180496,169566640}, 
+    {277943376,169491806,277866736,169566640}, {284180496,169566640,284255330,169643280}, {277866736,169566640,277791902,169643280}, 
+    {284255330,169643280,284328322,169721690}, {277791902,169643280,277718910,169721690}, {284328322,169721690,284399439,169801836}, 
+    {277718910,169721690,277647793,169801836}, {284399439,169801836,284468645,169883683}, {277647793,169801836,277578587,169883683}, 
+    {284468645,169883683,284535904,169967196}, {277578587,169883683,277511328,169967196}, {284535904,169967196,284601182,170052339}, 
+    {277511328,169967196,277446050,170052339}, {284601182,170052339,284664444,170139078}, {277446050,170052339,277382788,170139078}, 
+    {284664444,170139078,284725655,170227377}, {277382788,170139078,277321577,170227377}, {284725655,170227377,284784779,170317201}, 
+    {277321577,170227377,277262453,170317201}, {284784779,170317201,284841781,170408516}, {277262453,170317201,277205451,170408516}, 
+    {284841781,170408516,284896627,170501286}, {277205451,170408516,277150605,170501286}, {284896627,170501286,284949282,170595476}, 
+    {277150605,170501286,277097950,170595476}, {284949282,170595476,284999710,170691052}, {277097950,170595476,277047522,170691052}, 
+    {284999710,170691052,285047876,170787977}, {277047522,170691052,276999356,170787977}, {285047876,170787977,285093745,170886218}, 
+    {276999356,170787977,276953487,170886218}, {285093745,170886218,285137282,170985738}, {276953487,170886218,276909950,170985738}, 
+    {285137282,170985738,285178452,171086503}, {276909950,170985738,276868780,171086503}, {285178452,171086503,285217221,171188478}, 
+    {276868780,171086503,276830011,171188478}, {285217221,171188478,285253552,171291628}, {276830011,171188478,276793680,171291628}, 
+    {285253552,171291628,285287411,171395917}, {276793680,171291628,276759821,171395917}, {285287411,171395917,285318763,171501311}, 
+    {276759821,171395917,276728469,171501311}, {285318763,171501311,285347572,171607775}, {276728469,171501311,276699660,171607775}, 
+    {285347572,171607775,285373804,171715273}, {276699660,171607775,276673428,171715273}, {285373804,171715273,285397424,171823770}, 
+    {276673428,171715273,276649808,171823770}, {285397424,171823770,285418397,171933232}, {276649808,171823770,276628835,171933232}, 
+    {285418397,171933232,285436686,172043623}, {276628835,171933232,276610546,172043623}, {285436686,172043623,285452259,172154908}, 
+    {276610546,172043623,276594973,172154908}, {285452259,172154908,285465078,172267053}, {276594973,172154908,276582154,172267053}, 
+    {285465078,172267053,285475110,172380021}, {276582154,172267053,276572122,172380021}, {285475110,172380021,285482319,172493778}, 
+    {276572122,172380021,276564913,172493778}, {285482319,172493778,285486670,172608290}, {276564913,172493778,276560562,172608290}, 
+    {285486670,172608290,285488128,172723520}, {276560562,172608290,276559104,172723520}, {285488128,172723520,285486670,172838750}, 
+    {276559104,172723520,276560562,172838750}, {285486670,172838750,285482319,172953262}, {276560562,172838750,276564913,172953262}, 
+    {285482319,172953262,285475110,173067019}, {276564913,172953262,276572122,173067019}, {285475110,173067019,285465078,173179987}, 
+    {276572122,173067019,276582154,173179987}, {285465078,173179987,285452259,173292132}, {276582154,173179987,276594973,173292132}, 
+    {285452259,173292132,285436686,173403417}, {276594973,173292132,276610546,173403417}, {285436686,173403417,285418397,173513808}, 
+    {276610546,173403417,276628835,173513808}, {285418397,173513808,285397424,173623270}, {276628835,173513808,276649808,173623270}, 
+    {285397424,173623270,285373804,173731767}, {276649808,173623270,276673428,173731767}, {285373804,173731767,285347572,173839265}, 
+    {276673428,173731767,276699660,173839265}, {285347572,173839265,285318763,173945729}, {276699660,173839265,276728469,173945729}, 
+    {285318763,173945729,285287411,174051123}, {276728469,173945729,276759821,174051123}, {285287411,174051123,285253552,174155412}, 
+    {276759821,174051123,276793680,174155412}, {285253552,174155412,285217221,174258562}, {276793680,174155412,276830011,174258562}, 
+    {285217221,174258562,285178452,174360537}, {276830011,174258562,276868780,174360537}, {285178452,174360537,285137282,174461302}, 
+    {276868780,174360537,276909950,174461302}, {285137282,174461302,285093745,174560822}, {276909950,174461302,276953487,174560822}, 
+    {285093745,174560822,285047876,174659063}, {276953487,174560822,276999356,174659063}, {285047876,174659063,284999710,174755988}, 
+    {276999356,174659063,277047522,174755988}, {284999710,174755988,284949282,174851564}, {277047522,174755988,277097950,174851564}, 
+    {284949282,174851564,284896627,174945754}, {277097950,174851564,277150605,174945754}, {284896627,174945754,284841781,175038524}, 
+    {277150605,174945754,277205451,175038524}, {284841781,175038524,284784779,175129839}, {277205451,175038524,277262453,175129839}, 
+    {284784779,175129839,284725655,175219663}, {277262453,175129839,277321577,175219663}, {284725655,175219663,284664444,175307962}, 
+    {277321577,175219663,277382788,175307962}, {284664444,175307962,284601182,175394701}, {277382788,175307962,277446050,175394701}, 
+    {284601182,175394701,284535904,175479844}, {277446050,175394701,277511328,175479844}, {284535904,175479844,284468645,175563357}, 
+    {277511328,175479844,277578587,175563357}, {284468645,175563357,284399439,175645204}, {277578587,175563357,277647793,175645204}, 
+    {284399439,175645204,284328322,175725350}, {277647793,175645204,277718910,175725350}, {284328322,175725350,284255330,175803760}, 
+    {277718910,175725350,277791902,175803760}, {284255330,175803760,284180496,175880400}, {277791902,175803760,277866736,175880400}, 
+    {284180496,175880400,284103856,175955234}, {277866736,175880400,277943376,175955234}, {284103856,175955234,284025446,176028226}, 
+    {277943376,175955234,278021786,176028226}, {284025446,176028226,283945300,176099343}, {278021786,176028226,278101932,176099343}, 
+    {283945300,176099343,283863453,176168549}, {278101932,176099343,278183779,176168549}, {283863453,176168549,283779940,176235808}, 
+    {278183779,176168549,278267292,176235808}, {283779940,176235808,283694797,176301086}, {278267292,176235808,278352435,176301086}, 
+    {283694797,176301086,283608058,176364348}, {278352435,176301086,278439174,176364348}, {283608058,176364348,283519759,176425559}, 
+    {278439174,176364348,278527473,176425559}, {283519759,176425559,283429935,176484683}, {278527473,176425559,278617297,176484683}, 
+    {283429935,176484683,283338620,176541685}, {278617297,176484683,278708612,176541685}, {283338620,176541685,283245850,176596531}, 
+    {278708612,176541685,278801382,176596531}, {283245850,176596531,283151660,176649186}, {278801382,176596531,278895572,176649186}, 
+    {283151660,176649186,283056084,176699614}, {278895572,176649186,278991148,176699614}, {283056084,176699614,282959159,176747780}, 
+    {278991148,176699614,279088073,176747780}, {282959159,176747780,282860918,176793649}, {279088073,176747780,279186314,176793649}, 
+    {282860918,176793649,282761398,176837186}, {279186314,176793649,279285834,176837186}, {282761398,176837186,282660633,176878356}, 
+    {279285834,176837186,279386599,176878356}, {282660633,176878356,282558658,176917125}, {279386599,176878356,279488574,176917125}, 
+    {282558658,176917125,282455508,176953456}, {279488574,176917125,279591724,176953456}, {282455508,176953456,282351219,176987315}, 
+    {279591724,176953456,279696013,176987315}, {282351219,176987315,282245825,177018667}, {279696013,176987315,279801407,177018667}, 
+    {282245825,177018667,282139361,177047476}, {279801407,177018667,279907871,177047476}, {282139361,177047476,282031863,177073708}, 
+    {279907871,177047476,280015369,177073708}, {282031863,177073708,281923366,177097328}, {280015369,177073708,280123866,177097328}, 
+    {281923366,177097328,281813904,177118301}, {280123866,177097328,280233328,177118301}, {281813904,177118301,281703513,177136590}, 
+    {280233328,177118301,280343719,177136590}, {281703513,177136590,281592228,177152163}, {280343719,177136590,280455004,177152163}, 
+    {281592228,177152163,281480083,177164982}, {280455004,177152163,280567149,177164982}, {281480083,177164982,281367115,177175014}, 
+    {280567149,177164982,280680117,177175014}, {281367115,177175014,281253358,177182223}, {280680117,177175014,280793874,177182223}, 
+    {281253358,177182223,281138846,177186574}, {280793874,177182223,280908386,177186574}, {281138846,177186574,281023616,177188032}, 
+    {280908386,177186574,281023616,177188032}, 
+};
+
+const Segment SEGMENTS_INNER4[] = {
+    {264968192,168392640,265083422,168394098}, {264968192,168392640,264852962,168394098}, {265083422,168394098,265197934,168398449}, 
+    {264852962,168394098,264738450,168398449}, {265197934,168398449,265311691,168405658}, {264738450,168398449,264624693,168405658}, 
+    {265311691,168405658,265424659,168415690}, {264624693,168405658,264511725,168415690}, {265424659,168415690,265536804,168428509}, 
+    {264511725,168415690,264399580,168428509}, {265536804,168428509,265648089,168444082}, {264399580,168428509,264288295,168444082}, 
+    {265648089,168444082,265758480,168462371}, {264288295,168444082,264177904,168462371}, {265758480,168462371,265867942,168483344}, 
+    {264177904,168462371,264068442,168483344}, {265867942,168483344,265976439,168506964}, {264068442,168483344,263959945,168506964}, 
+    {265976439,168506964,266083937,168533196}, {263959945,168506964,263852447,168533196}, {266083937,168533196,266190401,168562005}, 
+    {263852447,168533196,263745983,168562005}, {266190401,168562005,266295795,168593357}, {263745983,168562005,263640589,168593357}, 
+    {266295795,168593357,266400084,168627216}, {263640589,168593357,263536300,168627216}, {266400084,168627216,266503234,168663547}, 
+    {263536300,168627216,263433150,168663547}, {266503234,168663547,266605209,168702316}, {263433150,168663547,263331175,168702316}, 
+    {266605209,168702316,266705974,168743486}, {263331175,168702316,263230410,168743486}, {266705974,168743486,266805494,168787023}, 
+    {263230410,168743486,263130890,168787023}, {266805494,168787023,266903735,168832892}, {263130890,168787023,263032649,168832892}, 
+    {266903735,168832892,267000660,168881058}, {263032649,168832892,262935724,168881058}, {267000660,168881058,267096236,168931486}, 
+    {262935724,168881058,262840148,168931486}, {267096236,168931486,267190426,168984141}, {262840148,168931486,262745958,168984141}, 
+    {267190426,168984141,267283196,169038987}, {262745958,168984141,262653188,169038987}, {267283196,169038987,267374511,169095989}, 
+    {262653188,169038987,262561873,169095989}, {267374511,169095989,267464335,169155113}, {262561873,169095989,262472049,169155113}, 
+    {267464335,169155113,267552634,169216324}, {262472049,169155113,262383750,169216324}, {267552634,169216324,267639373,169279586}, 
+    {262383750,169216324,262297011,169279586}, {267639373,169279586,267724516,169344864}, {262297011,169279586,262211868,169344864}, 
+    {267724516,169344864,267808029,169412123}, {262211868,169344864,262128355,169412123}, {267808029,169412123,267889876,169481329}, 
+    {262128355,169412123,262046508,169481329}, {267889876,169481329,267970022,169552446}, {262046508,169481329,261966362,169552446}, 
+    {267970022,169552446,268048432,169625438}, {261966362,169552446,261887952,169625438}, {268048432,169625438,268125072,169700272}, 
+    {261887952,169625438,261811312,169700272}, {268125072,169700272,268199906,169776912}, {261811312,169700272,261736478,169776912}, 
+    {268199906,169776912,268272898,169855322}, {261736478,169776912,261663486,169855322}, {268272898,169855322,268344015,169935468}, 
+    {261663486,169855322,261592369,169935468}, {268344015,169935468,268413221,170017315}, {261592369,169935468,261523163,170017315}, 
+    {268413221,170017315,268480480,170100828}, {261523163,170017315,261455904,170100828}, {268480480,170100828,268545758,170185971}, 
+    {261455904,170100828,261390626,170185971}, {268545758,170185971,268609020,170272710}, {261390626,170185971,261327364,170272710}, 
+    {268609020,170272710,268670231,170361009}, {261327364,170272710,261266153,170361009}, {268670231,170361009,268729355,170450833}, 
+    {261266153,170361009,261207029,170450833}, {268729355,170450833,268786357,170542148}, {261207029,170450833,261150027,170542148}, 
+    {268786357,170542148,268841203,170634918}, {261150027,170542148,261095181,170634918}, {268841203,170634918,268893858,170729108}, 
+    {261095181,170634918,261042526,170729108}, {268893858,170729108,268944286,170824684}, {261042526,170729108,260992098,170824684}, 
+    {268944286,170824684,268992452,170921609}, {260992098,170824684,260943932,170921609}, {268992452,170921609,269038321,171019850}, 
+    {260943932,170921609,260898063,171019850}, {269038321,171019850,269081858,171119370}, {260898063,171019850,260854526,171119370}, 
+    {269081858,171119370,269123028,171220135}, {260854526,171119370,260813356,171220135}, {269123028,171220135,269161797,171322110}, 
+    {260813356,171220135,260774587,171322110}, {269161797,171322110,269198128,171425260}, {260774587,171322110,260738256,171425260}, 
+    {269198128,171425260,269231987,171529549}, {260738256,171425260,260704397,171529549}, {269231987,171529549,269263339,171634943}, 
+    {260704397,171529549,260673045,171634943}, {269263339,171634943,269292148,171741407}, {260673045,171634943,260644236,171741407}, 
+    {269292148,171741407,269318380,171848905}, {260644236,171741407,260618004,171848905}, {269318380,171848905,269342000,171957402}, 
+    {260618004,171848905,260594384,171957402}, {269342000,171957402,269362973,172066864}, {260594384,171957402,260573411,172066864}, 
+    {269362973,172066864,269381262,172177255}, {260573411,172066864,260555122,172177255}, {269381262,172177255,269396835,172288540}, 
+    {260555122,172177255,260539549,172288540}, {269396835,172288540,269409654,172400685}, {260539549,172288540,260526730,172400685}, 
+    {269409654,172400685,269419686,172513653}, {260526730,172400685,260516698,172513653}, {269419686,172513653,269426895,172627410}, 
+    {260516698,172513653,260509489,172627410}, {269426895,172627410,269431246,172741922}, {260509489,172627410,260505138,172741922}, 
+    {269431246,172741922,269432704,172857152}, {260505138,172741922,260503680,172857152}, {269432704,172857152,269431246,172972382}, 
+    {260503680,172857152,260505138,172972382}, {269431246,172972382,269426895,173086894}, {260505138,172972382,260509489,173086894}, 
+    {269426895,173086894,269419686,173200651}, {260509489,173086894,260516698,173200651}, {269419686,173200651,269409654,173313619}, 
+    {260516698,173200651,260526730,173313619}, {269409654,173313619,269396835,173425764}, {260526730,173313619,260539549,173425764}, 
+    {269396835,173425764,269381262,173537049}, {260539549,173425764,260555122,173537049}, {269381262,173537049,269362973,173647440}, 
+    {260555122,173537049,260573411,173647440}, {269362973,173647440,269342000,173756902}, {260573411,173647440,260594384,173756902}, 
+    {269342000,173756902,269318380,173865399}, {260594384,173756902,260618004,173865399}, {269318380,173865399,269292148,173972897}, 
+    {260618004,173865399,260644236,173972897}, {269292148,173972897,269263339,174079361}, {260644236,173972897,260673045,174079361}, 
+    {269263339,174079361,269231987,174184755}, {260673045,174079361,260704397,174184755}, {269231987,174184755,269198128,174289044}, 
+    {260704397,174184755,260738256,174289044}, {269198128,174289044,269161797,174392194}, {260738256,174289044,260774587,174392194}, 
+    {269161797,174392194,269123028,174494169}, {260774587,174392194,260813356,174494169}, {269123028,174494169,269081858,174594934}, 
+    {260813356,174494169,260854526,174594934}, {269081858,174594934,269038321,174694454}, {260854526,174594934,260898063,174694454}, 
+    {269038321,174694454,268992452,174792695}, {260898063,174694454,260943932,174792695}, {268992452,174792695,268944286,174889620}, 
+    {260943932,174792695,260992098,174889620}, {268944286,174889620,268893858,174985196}, {260992098,174889620,261042526,174985196}, 
+    {268893858,174985196,268841203,175079386}, {261042526,174985196,261095181,175079386}, {268841203,175079386,268786357,175172156}, 
+    {261095181,175079386,261150027,175172156}, {268786357,175172156,268729355,175263471}, {261150027,175172156,261207029,175263471}, 
+    {268729355,175263471,268670231,175353295}, {261207029,175263471,261266153,175353295}, {268670231,175353295,268609020,175441594}, 
+    {261266153,175353295,261327364,175441594}, {268609020,175441594,268545758,175528333}, {261327364,175441594,261390626,175528333}, 
+    {268545758,175528333,268480480,175613476}, {261390626,175528333,261455904,175613476}, {268480480,175613476,268413221,175696989}, 
+    {261455904,175613476,261523163,175696989}, {268413221,175696989,268344015,175778836}, {261523163,175696989,261592369,175778836}, 
+    {268344015,175778836,268272898,175858982}, {261592369,175778836,261663486,175858982}, {268272898,175858982,268199906,175937392}, 
+    {261663486,175858982,261736478,175937392}, {268199906,175937392,268125072,176014032}, {261736478,175937392,261811312,176014032}, 
+    {268125072,176014032,268048432,176088866}, {261811312,176014032,261887952,176088866}, {268048432,176088866,267970022,176161858}, 
+    {261887952,176088866,261966362,176161858}, {267970022,176161858,267889876,176232975}, {261966362,176161858,262046508,176232975}, 
+    {267889876,176232975,267808029,176302181}, {262046508,176232975,262128355,176302181}, {267808029,176302181,267724516,176369440}, 
+    {262128355,176302181,262211868,176369440}, {267724516,176369440,267639373,176434718}, {262211868,176369440,262297011,176434718}, 
+    {267639373,176434718,267552634,176497980}, {262297011,176434718,262383750,176497980}, {267552634,176497980,267464335,176559191}, 
+    {262383750,176497980,262472049,176559191}, {267464335,176559191,267374511,176618315}, {262472049,176559191,262561873,176618315}, 
+    {267374511,176618315,267283196,176675317}, {262561873,176618315,262653188,176675317}, {267283196,176675317,267190426,176730163}, 
+    {262653188,176675317,262745958,176730163}, {267190426,176730163,267096236,176782818}, {262745958,176730163,262840148,176782818}, 
+    {267096236,176782818,267000660,176833246}, {262840148,176782818,262935724,176833246}, {267000660,176833246,266903735,176881412}, 
+    {262935724,176833246,263032649,176881412}, {266903735,176881412,266805494,176927281}, {263032649,176881412,263130890,176927281}, 
+    {266805494,176927281,266705974,176970818}, {263130890,176927281,263230410,176970818}, {266705974,176970818,266605209,177011988}, 
+    {263230410,176970818,263331175,177011988}, {266605209,177011988,266503234,177050757}, {263331175,177011988,263433150,177050757}, 
+    {266503234,177050757,266400084,177087088}, {263433150,177050757,263536300,177087088}, {266400084,177087088,266295795,177120947}, 
+    {263536300,177087088,263640589,177120947}, {266295795,177120947,266190401,177152299}, {263640589,177120947,263745983,177152299}, 
+    {266190401,177152299,266083937,177181108}, {263745983,177152299,263852447,177181108}, {266083937,177181108,265976439,177207340}, 
+    {263852447,177181108,263959945,177207340}, {265976439,177207340,265867942,177230960}, {263959945,177207340,264068442,177230960}, 
+    {265867942,177230960,265758480,177251933}, {264068442,177230960,264177904,177251933}, {265758480,177251933,265648089,177270222}, 
+    {264177904,177251933,264288295,177270222}, {265648089,177270222,265536804,177285795}, {264288295,177270222,264399580,177285795}, 
+    {265536804,177285795,265424659,177298614}, {264399580,177285795,264511725,177298614}, {265424659,177298614,265311691,177308646}, 
+    {264511725,177298614,264624693,177308646}, {265311691,177308646,265197934,177315855}, {264624693,177308646,264738450,177315855}, 
+    {265197934,177315855,265083422,177320206}, {264738450,177315855,264852962,177320206}, {265083422,177320206,264968192,177321664}, 
+    {264852962,177320206,264968192,177321664}, 
+};
+
+const Segment SEGMENTS_INNER5[] = {
+    {251734208,177375936,251849438,177377394}, {251734208,177375936,251618978,177377394}, {251849438,177377394,251963950,177381745}, 
+    {251618978,177377394,251504466,177381745}, {251963950,177381745,252077707,177388954}, {251504466,177381745,251390709,177388954}, 
+    {252077707,177388954,252190675,177398986}, {251390709,177388954,251277741,177398986}, {252190675,177398986,252302820,177411805}, 
+    {251277741,177398986,251165596,177411805}, {252302820,177411805,252414105,177427378}, {251165596,177411805,251054311,177427378}, 
+    {252414105,177427378,252524496,177445667}, {251054311,177427378,250943920,177445667}, {252524496,177445667,252633958,177466640}, 
+    {250943920,177445667,250834458,177466640}, {252633958,177466640,252742455,177490260}, {250834458,177466640,250725961,177490260}, 
+    {252742455,177490260,252849953,177516492}, {250725961,177490260,250618463,177516492}, {252849953,177516492,252956417,177545301}, 
+    {250618463,177516492,250511999,177545301}, {252956417,177545301,253061811,177576653}, {250511999,177545301,250406605,177576653}, 
+    {253061811,177576653,253166100,177610512}, {250406605,177576653,250302316,177610512}, {253166100,177610512,253269250,177646843}, 
+    {250302316,177610512,250199166,177646843}, {253269250,177646843,253371225,177685612}, {250199166,177646843,250097191,177685612}, 
+    {253371225,177685612,253471990,177726782}, {250097191,177685612,249996426,177726782}, {253471990,177726782,253571510,177770319}, 
+    {249996426,177726782,249896906,177770319}, {253571510,177770319,253669751,177816188}, {249896906,177770319,249798665,177816188}, 
+    {253669751,177816188,253766676,177864354}, {249798665,177816188,249701740,177864354}, {253766676,177864354,253862252,177914782}, 
+    {249701740,177864354,249606164,177914782}, {253862252,177914782,253956442,177967437}, {249606164,177914782,249511974,177967437}, 
+    {253956442,177967437,254049212,178022283}, {249511974,177967437,249419204,178022283}, {254049212,178022283,254140527,178079285}, 
+    {249419204,178022283,249327889,178079285}, {254140527,178079285,254230351,178138409}, {249327889,178079285,249238065,178138409}, 
+    {254230351,178138409,254318650,178199620}, {249238065,178138409,249149766,178199620}, {254318650,178199620,254405389,178262882}, 
+    {249149766,178199620,249063027,178262882}, {254405389,178262882,254490532,178328160}, {249063027,178262882,248977884,178328160}, 
+    {254490532,178328160,254574045,178395419}, {248977884,178328160,248894371,178395419}, {254574045,178395419,254655892,178464625}, 
+    {248894371,178395419,248812524,178464625}, {254655892,178464625,254736038,178535742}, {248812524,178464625,248732378,178535742}, 
+    {254736038,178535742,254814448,178608734}, {248732378,178535742,248653968,178608734}, {254814448,178608734,254891088,178683568}, 
+    {248653968,178608734,248577328,178683568}, {254891088,178683568,254965922,178760208}, {248577328,178683568,248502494,178760208}, 
+    {254965922,178760208,255038914,178838618}, {248502494,178760208,248429502,178838618}, {255038914,178838618,255110031,178918764}, 
+    {248429502,178838618,248358385,178918764}, {255110031,178918764,255179237,179000611}, {248358385,178918764,248289179,179000611}, 
+    {255179237,179000611,255246496,179084124}, {248289179,179000611,248221920,179084124}, {255246496,179084124,255311774,179169267}, 
+    {248221920,179084124,248156642,179169267}, {255311774,179169267,255375036,179256006}, {248156642,179169267,248093380,179256006}, 
+    {255375036,179256006,255436247,179344305}, {248093380,179256006,248032169,179344305}, {255436247,179344305,255495371,179434129}, 
+    {248032169,179344305,247973045,179434129}, {255495371,179434129,255552373,179525444}, {247973045,179434129,247916043,179525444}, 
+    {255552373,179525444,255607219,179618214}, {247916043,179525444,247861197,179618214}, {255607219,179618214,255659874,179712404}, 
+    {247861197,179618214,247808542,179712404}, {255659874,179712404,255710302,179807980}, {247808542,179712404,247758114,179807980}, 
+    {255710302,179807980,255758468,179904905}, {247758114,179807980,247709948,179904905}, {255758468,179904905,255804337,180003146}, 
+    {247709948,179904905,247664079,180003146}, {255804337,180003146,255847874,180102666}, {247664079,180003146,247620542,180102666}, 
+    {255847874,180102666,255889044,180203431}, {247620542,180102666,247579372,180203431}, {255889044,180203431,255927813,180305406}, 
+    {247579372,180203431,247540603,180305406}, {255927813,180305406,255964144,180408556}, {247540603,180305406,247504272,180408556}, 
+    {255964144,180408556,255998003,180512845}, {247504272,180408556,247470413,180512845}, {255998003,180512845,256029355,180618239}, 
+    {247470413,180512845,247439061,180618239}, {256029355,180618239,256058164,180724703}, {247439061,180618239,247410252,180724703}, 
+    {256058164,180724703,256084396,180832201}, {247410252,180724703,247384020,180832201}, {256084396,180832201,256108016,180940698}, 
+    {247384020,180832201,247360400,180940698}, {256108016,180940698,256128989,181050160}, {247360400,180940698,247339427,181050160}, 
+    {256128989,181050160,256147278,181160551}, {247339427,181050160,247321138,181160551}, {256147278,181160551,256162851,181271836}, 
+    {247321138,181160551,247305565,181271836}, {256162851,181271836,256175670,181383981}, {247305565,181271836,247292746,181383981}, 
+    {256175670,181383981,256185702,181496949}, {247292746,181383981,247282714,181496949}, {256185702,181496949,256192911,181610706}, 
+    {247282714,181496949,247275505,181610706}, {256192911,181610706,256197262,181725218}, {247275505,181610706,247271154,181725218}, 
+    {256197262,181725218,256198720,181840448}, {247271154,181725218,247269696,181840448}, {256198720,181840448,256197262,181955678}, 
+    {247269696,181840448,247271154,181955678}, {256197262,181955678,256192911,182070190}, {247271154,181955678,247275505,182070190}, 
+    {256192911,182070190,256185702,182183947}, {247275505,182070190,247282714,182183947}, {256185702,182183947,256175670,182296915}, 
+    {247282714,182183947,247292746,182296915}, {256175670,182296915,256162851,182409060}, {247292746,182296915,247305565,182409060}, 
+    {256162851,182409060,256147278,182520345}, {247305565,182409060,247321138,182520345}, {256147278,182520345,256128989,182630736}, 
+    {247321138,182520345,247339427,182630736}, {256128989,182630736,256108016,182740198}, {247339427,182630736,247360400,182740198}, 
+    {256108016,182740198,256084396,182848695}, {247360400,182740198,247384020,182848695}, {256084396,182848695,256058164,182956193}, 
+    {247384020,182848695,247410252,182956193}, {256058164,182956193,256029355,183062657}, {247410252,182956193,247439061,183062657}, 
+    {256029355,183062657,255998003,183168051}, {247439061,183062657,247470413,183168051}, {255998003,183168051,255964144,183272340}, 
+    {247470413,183168051,247504272,183272340}, {255964144,183272340,255927813,183375490}, {247504272,183272340,247540603,183375490}, 
+    {255927813,183375490,255889044,183477465}, {247540603,183375490,247579372,183477465}, {255889044,183477465,255847874,183578230}, 
+    {247579372,183477465,247620542,183578230}, {255847874,183578230,255804337,183677750}, {247620542,183578230,247664079,183677750}, 
+    {255804337,183677750,255758468,183775991}, {247664079,183677750,247709948,183775991}, {255758468,183775991,255710302,183872916}, 
+    {247709948,183775991,247758114,183872916}, {255710302,183872916,255659874,183968492}, {247758114,183872916,247808542,183968492}, 
+    {255659874,183968492,255607219,184062682}, {247808542,183968492,247861197,184062682}, {255607219,184062682,255552373,184155452}, 
+    {247861197,184062682,247916043,184155452}, {255552373,184155452,255495371,184246767}, {247916043,184155452,247973045,184246767}, 
+    {255495371,184246767,255436247,184336591}, {247973045,184246767,248032169,184336591}, {255436247,184336591,255375036,184424890}, 
+    {248032169,184336591,248093380,184424890}, {255375036,184424890,255311774,184511629}, {248093380,184424890,248156642,184511629}, 
+    {255311774,184511629,255246496,184596772}, {248156642,184511629,248221920,184596772}, {255246496,184596772,255179237,184680285}, 
+    {248221920,184596772,248289179,184680285}, {255179237,184680285,255110031,184762132}, {248289179,184680285,248358385,184762132}, 
+    {255110031,184762132,255038914,184842278}, {248358385,184762132,248429502,184842278}, {255038914,184842278,254965922,184920688}, 
+    {248429502,184842278,248502494,184920688}, {254965922,184920688,254891088,184997328}, {248502494,184920688,248577328,184997328}, 
+    {254891088,184997328,254814448,185072162}, {248577328,184997328,248653968,185072162}, {254814448,185072162,254736038,185145154}, 
+    {248653968,185072162,248732378,185145154}, {254736038,185145154,254655892,185216271}, {248732378,185145154,248812524,185216271}, 
+    {254655892,185216271,254574045,185285477}, {248812524,185216271,248894371,185285477}, {254574045,185285477,254490532,185352736}, 
+    {248894371,185285477,248977884,185352736}, {254490532,185352736,254405389,185418014}, {248977884,185352736,249063027,185418014}, 
+    {254405389,185418014,254318650,185481276}, {249063027,185418014,249149766,185481276}, {254318650,185481276,254230351,185542487}, 
+    {249149766,185481276,249238065,185542487}, {254230351,185542487,254140527,185601611}, {249238065,185542487,249327889,185601611}, 
+    {254140527,185601611,254049212,185658613}, {249327889,185601611,249419204,185658613}, {254049212,185658613,253956442,185713459}, 
+    {249419204,185658613,249511974,185713459}, {253956442,185713459,253862252,185766114}, {249511974,185713459,249606164,185766114}, 
+    {253862252,185766114,253766676,185816542}, {249606164,185766114,249701740,185816542}, {253766676,185816542,253669751,185864708}, 
+    {249701740,185816542,249798665,185864708}, {253669751,185864708,253571510,185910577}, {249798665,185864708,249896906,185910577}, 
+    {253571510,185910577,253471990,185954114}, {249896906,185910577,249996426,185954114}, {253471990,185954114,253371225,185995284}, 
+    {249996426,185954114,250097191,185995284}, {253371225,185995284,253269250,186034053}, {250097191,185995284,250199166,186034053}, 
+    {253269250,186034053,253166100,186070384}, {250199166,186034053,250302316,186070384}, {253166100,186070384,253061811,186104243}, 
+    {250302316,186070384,250406605,186104243}, {253061811,186104243,252956417,186135595}, {250406605,186104243,250511999,186135595}, 
+    {252956417,186135595,252849953,186164404}, {250511999,186135595,250618463,186164404}, {252849953,186164404,252742455,186190636}, 
+    {250618463,186164404,250725961,186190636}, {252742455,186190636,252633958,186214256}, {250725961,186190636,250834458,186214256}, 
+    {252633958,186214256,252524496,186235229}, {250834458,186214256,250943920,186235229}, {252524496,186235229,252414105,186253518}, 
+    {250943920,186235229,251054311,186253518}, {252414105,186253518,252302820,186269091}, {251054311,186253518,251165596,186269091}, 
+    {252302820,186269091,252190675,186281910}, {251165596,186269091,251277741,186281910}, {252190675,186281910,252077707,186291942}, 
+    {251277741,186281910,251390709,186291942}, {252077707,186291942,251963950,186299151}, {251390709,186291942,251504466,186299151}, 
+    {251963950,186299151,251849438,186303502}, {251504466,186299151,251618978,186303502}, {251849438,186303502,251734208,186304960}, 
+    {251618978,186303502,251734208,186304960}, 
+};
+
+const Segment SEGMENTS_INNER6[] = {
+    {245642304,192370176,245757534,192371634}, {245642304,192370176,245527074,192371634}, {245757534,192371634,245872046,192375985}, 
+    {245527074,192371634,245412562,192375985}, {245872046,192375985,245985803,192383194}, {245412562,192375985,245298805,192383194}, 
+    {245985803,192383194,246098771,192393226}, {245298805,192383194,245185837,192393226}, {246098771,192393226,246210916,192406045}, 
+    {245185837,192393226,245073692,192406045}, {246210916,192406045,246322201,192421618}, {245073692,192406045,244962407,192421618}, 
+    {246322201,192421618,246432592,192439907}, {244962407,192421618,244852016,192439907}, {246432592,192439907,246542054,192460880}, 
+    {244852016,192439907,244742554,192460880}, {246542054,192460880,246650551,192484500}, {244742554,192460880,244634057,192484500}, 
+    {246650551,192484500,246758049,192510732}, {244634057,192484500,244526559,192510732}, {246758049,192510732,246864513,192539541}, 
+    {244526559,192510732,244420095,192539541}, {246864513,192539541,246969907,192570893}, {244420095,192539541,244314701,192570893}, 
+    {246969907,192570893,247074196,192604752}, {244314701,192570893,244210412,192604752}, {247074196,192604752,247177346,192641083}, 
+    {244210412,192604752,244107262,192641083}, {247177346,192641083,247279321,192679852}, {244107262,192641083,244005287,192679852}, 
+    {247279321,192679852,247380086,192721022}, {244005287,192679852,243904522,192721022}, {247380086,192721022,247479606,192764559}, 
+    {243904522,192721022,243805002,192764559}, {247479606,192764559,247577847,192810428}, {243805002,192764559,243706761,192810428}, 
+    {247577847,192810428,247674772,192858594}, {243706761,192810428,243609836,192858594}, {247674772,192858594,247770348,192909022}, 
+    {243609836,192858594,243514260,192909022}, {247770348,192909022,247864538,192961677}, {243514260,192909022,243420070,192961677}, 
+    {247864538,192961677,247957308,193016523}, {243420070,192961677,243327300,193016523}, {247957308,193016523,248048623,193073525}, 
+    {243327300,193016523,243235985,193073525}, {248048623,193073525,248138447,193132649}, {243235985,193073525,243146161,193132649}, 
+    {248138447,193132649,248226746,193193860}, {243146161,193132649,243057862,193193860}, {248226746,193193860,248313485,193257122}, 
+    {243057862,193193860,242971123,193257122}, {248313485,193257122,248398628,193322400}, {242971123,193257122,242885980,193322400}, 
+    {248398628,193322400,248482141,193389659}, {242885980,193322400,242802467,193389659}, {248482141,193389659,248563988,193458865}, 
+    {242802467,193389659,242720620,193458865}, {248563988,193458865,248644134,193529982}, {242720620,193458865,242640474,193529982}, 
+    {248644134,193529982,248722544,193602974}, {242640474,193529982,242562064,193602974}, {248722544,193602974,248799184,193677808}, 
+    {242562064,193602974,242485424,193677808}, {248799184,193677808,248874018,193754448}, {242485424,193677808,242410590,193754448}, 
+    {248874018,193754448,248947010,193832858}, {242410590,193754448,242337598,193832858}, {248947010,193832858,249018127,193913004}, 
+    {242337598,193832858,242266481,193913004}, {249018127,193913004,249087333,193994851}, {242266481,193913004,242197275,193994851}, 
+    {249087333,193994851,249154592,194078364}, {242197275,193994851,242130016,194078364}, {249154592,194078364,249219870,194163507}, 
+    {242130016,194078364,242064738,194163507}, {249219870,194163507,249283132,194250246}, {242064738,194163507,242001476,194250246}, 
+    {249283132,194250246,249344343,194338545}, {242001476,194250246,241940265,194338545}, {249344343,194338545,249403467,194428369}, 
+    {241940265,194338545,241881141,194428369}, {249403467,194428369,249460469,194519684}, {241881141,194428369,241824139,194519684}, 
+    {249460469,194519684,249515315,194612454}, {241824139,194519684,241769293,194612454}, {249515315,194612454,249567970,194706644}, 
+    {241769293,194612454,241716638,194706644}, {249567970,194706644,249618398,194802220}, {241716638,194706644,241666210,194802220}, 
+    {249618398,194802220,249666564,194899145}, {241666210,194802220,241618044,194899145}, {249666564,194899145,249712433,194997386}, 
+    {241618044,194899145,241572175,194997386}, {249712433,194997386,249755970,195096906}, {241572175,194997386,241528638,195096906}, 
+    {249755970,195096906,249797140,195197671}, {241528638,195096906,241487468,195197671}, {249797140,195197671,249835909,195299646}, 
+    {241487468,195197671,241448699,195299646}, {249835909,195299646,249872240,195402796}, {241448699,195299646,241412368,195402796}, 
+    {249872240,195402796,249906099,195507085}, {241412368,195402796,241378509,195507085}, {249906099,195507085,249937451,195612479}, 
+    {241378509,195507085,241347157,195612479}, {249937451,195612479,249966260,195718943}, {241347157,195612479,241318348,195718943}, 
+    {249966260,195718943,249992492,195826441}, {241318348,195718943,241292116,195826441}, {249992492,195826441,250016112,195934938}, 
+    {241292116,195826441,241268496,195934938}, {250016112,195934938,250037085,196044400}, {241268496,195934938,241247523,196044400}, 
+    {250037085,196044400,250055374,196154791}, {241247523,196044400,241229234,196154791}, {250055374,196154791,250070947,196266076}, 
+    {241229234,196154791,241213661,196266076}, {250070947,196266076,250083766,196378221}, {241213661,196266076,241200842,196378221}, 
+    {250083766,196378221,250093798,196491189}, {241200842,196378221,241190810,196491189}, {250093798,196491189,250101007,196604946}, 
+    {241190810,196491189,241183601,196604946}, {250101007,196604946,250105358,196719458}, {241183601,196604946,241179250,196719458}, 
+    {250105358,196719458,250106816,196834688}, {241179250,196719458,241177792,196834688}, {250106816,196834688,250105358,196949918}, 
+    {241177792,196834688,241179250,196949918}, {250105358,196949918,250101007,197064430}, {241179250,196949918,241183601,197064430}, 
+    {250101007,197064430,250093798,197178187}, {241183601,197064430,241190810,197178187}, {250093798,197178187,250083766,197291155}, 
+    {241190810,197178187,241200842,197291155}, {250083766,197291155,250070947,197403300}, {241200842,197291155,241213661,197403300}, 
+    {250070947,197403300,250055374,197514585}, {241213661,197403300,241229234,197514585}, {250055374,197514585,250037085,197624976}, 
+    {241229234,197514585,241247523,197624976}, {250037085,197624976,250016112,197734438}, {241247523,197624976,241268496,197734438}, 
+    {250016112,197734438,249992492,197842935}, {241268496,197734438,241292116,197842935}, {249992492,197842935,249966260,197950433}, 
+    {241292116,197842935,241318348,197950433}, {249966260,197950433,249937451,198056897}, {241318348,197950433,241347157,198056897}, 
+    {249937451,198056897,249906099,198162291}, {241347157,198056897,241378509,198162291}, {249906099,198162291,249872240,198266580}, 
+    {241378509,198162291,241412368,198266580}, {249872240,198266580,249835909,198369730}, {241412368,198266580,241448699,198369730}, 
+    {249835909,198369730,249797140,198471705}, {241448699,198369730,241487468,198471705}, {249797140,198471705,249755970,198572470}, 
+    {241487468,198471705,241528638,198572470}, {249755970,198572470,249712433,198671990}, {241528638,198572470,241572175,198671990}, 
+    {249712433,198671990,249666564,198770231}, {241572175,198671990,241618044,198770231}, {249666564,198770231,249618398,198867156}, 
+    {241618044,198770231,241666210,198867156}, {249618398,198867156,249567970,198962732}, {241666210,198867156,241716638,198962732}, 
+    {249567970,198962732,249515315,199056922}, {241716638,198962732,241769293,199056922}, {249515315,199056922,249460469,199149692}, 
+    {241769293,199056922,241824139,199149692}, {249460469,199149692,249403467,199241007}, {241824139,199149692,241881141,199241007}, 
+    {249403467,199241007,249344343,199330831}, {241881141,199241007,241940265,199330831}, {249344343,199330831,249283132,199419130}, 
+    {241940265,199330831,242001476,199419130}, {249283132,199419130,249219870,199505869}, {242001476,199419130,242064738,199505869}, 
+    {249219870,199505869,249154592,199591012}, {242064738,199505869,242130016,199591012}, {249154592,199591012,249087333,199674525}, 
+    {242130016,199591012,242197275,199674525}, {249087333,199674525,249018127,199756372}, {242197275,199674525,242266481,199756372}, 
+    {249018127,199756372,248947010,199836518}, {242266481,199756372,242337598,199836518}, {248947010,199836518,248874018,199914928}, 
+    {242337598,199836518,242410590,199914928}, {248874018,199914928,248799184,199991568}, {242410590,199914928,242485424,199991568}, 
+    {248799184,199991568,248722544,200066402}, {242485424,199991568,242562064,200066402}, {248722544,200066402,248644134,200139394}, 
+    {242562064,200066402,242640474,200139394}, {248644134,200139394,248563988,200210511}, {242640474,200139394,242720620,200210511}, 
+    {248563988,200210511,248482141,200279717}, {242720620,200210511,242802467,200279717}, {248482141,200279717,248398628,200346976}, 
+    {242802467,200279717,242885980,200346976}, {248398628,200346976,248313485,200412254}, {242885980,200346976,242971123,200412254}, 
+    {248313485,200412254,248226746,200475516}, {242971123,200412254,243057862,200475516}, {248226746,200475516,248138447,200536727}, 
+    {243057862,200475516,243146161,200536727}, {248138447,200536727,248048623,200595851}, {243146161,200536727,243235985,200595851}, 
+    {248048623,200595851,247957308,200652853}, {243235985,200595851,243327300,200652853}, {247957308,200652853,247864538,200707699}, 
+    {243327300,200652853,243420070,200707699}, {247864538,200707699,247770348,200760354}, {243420070,200707699,243514260,200760354}, 
+    {247770348,200760354,247674772,200810782}, {243514260,200760354,243609836,200810782}, {247674772,200810782,247577847,200858948}, 
+    {243609836,200810782,243706761,200858948}, {247577847,200858948,247479606,200904817}, {243706761,200858948,243805002,200904817}, 
+    {247479606,200904817,247380086,200948354}, {243805002,200904817,243904522,200948354}, {247380086,200948354,247279321,200989524}, 
+    {243904522,200948354,244005287,200989524}, {247279321,200989524,247177346,201028293}, {244005287,200989524,244107262,201028293}, 
+    {247177346,201028293,247074196,201064624}, {244107262,201028293,244210412,201064624}, {247074196,201064624,246969907,201098483}, 
+    {244210412,201064624,244314701,201098483}, {246969907,201098483,246864513,201129835}, {244314701,201098483,244420095,201129835}, 
+    {246864513,201129835,246758049,201158644}, {244420095,201129835,244526559,201158644}, {246758049,201158644,246650551,201184876}, 
+    {244526559,201158644,244634057,201184876}, {246650551,201184876,246542054,201208496}, {244634057,201184876,244742554,201208496}, 
+    {246542054,201208496,246432592,201229469}, {244742554,201208496,244852016,201229469}, {246432592,201229469,246322201,201247758}, 
+    {244852016,201229469,244962407,201247758}, {246322201,201247758,246210916,201263331}, {244962407,201247758,245073692,201263331}, 
+    {246210916,201263331,246098771,201276150}, {245073692,201263331,245185837,201276150}, {246098771,201276150,245985803,201286182}, 
+    {245185837,201276150,245298805,201286182}, {245985803,201286182,245872046,201293391}, {245298805,201286182,245412562,201293391}, 
+    {245872046,201293391,245757534,201297742}, {245412562,201293391,245527074,201297742}, {245757534,201297742,245642304,201299200}, 
+    {245527074,201297742,245642304,201299200}, 
+};
+
+const Segment SEGMENTS_INNER8[] = {
+    {245309760,208496448,245424990,208497906}, {245309760,208496448,245194530,208497906}, {245424990,208497906,245539502,208502257}, 
+    {245194530,208497906,245080018,208502257}, {245539502,208502257,245653259,208509466}, {245080018,208502257,244966261,208509466}, 
+    {245653259,208509466,245766227,208519498}, {244966261,208509466,244853293,208519498}, {245766227,208519498,245878372,208532317}, 
+    {244853293,208519498,244741148,208532317}, {245878372,208532317,245989657,208547890}, {244741148,208532317,244629863,208547890}, 
+    {245989657,208547890,246100048,208566179}, {244629863,208547890,244519472,208566179}, {246100048,208566179,246209510,208587152}, 
+    {244519472,208566179,244410010,208587152}, {246209510,208587152,246318007,208610772}, {244410010,208587152,244301513,208610772}, 
+    {246318007,208610772,246425505,208637004}, {244301513,208610772,244194015,208637004}, {246425505,208637004,246531969,208665813}, 
+    {244194015,208637004,244087551,208665813}, {246531969,208665813,246637363,208697165}, {244087551,208665813,243982157,208697165}, 
+    {246637363,208697165,246741652,208731024}, {243982157,208697165,243877868,208731024}, {246741652,208731024,246844802,208767355}, 
+    {243877868,208731024,243774718,208767355}, {246844802,208767355,246946777,208806124}, {243774718,208767355,243672743,208806124}, 
+    {246946777,208806124,247047542,208847294}, {243672743,208806124,243571978,208847294}, {247047542,208847294,247147062,208890831}, 
+    {243571978,208847294,243472458,208890831}, {247147062,208890831,247245303,208936700}, {243472458,208890831,243374217,208936700}, 
+    {247245303,208936700,247342228,208984866}, {243374217,208936700,243277292,208984866}, {247342228,208984866,247437804,209035294}, 
+    {243277292,208984866,243181716,209035294}, {247437804,209035294,247531994,209087949}, {243181716,209035294,243087526,209087949}, 
+    {247531994,209087949,247624764,209142795}, {243087526,209087949,242994756,209142795}, {247624764,209142795,247716079,209199797}, 
+    {242994756,209142795,242903441,209199797}, {247716079,209199797,247805903,209258921}, {242903441,209199797,242813617,209258921}, 
+    {247805903,209258921,247894202,209320132}, {242813617,209258921,242725318,209320132}, {247894202,209320132,247980941,209383394}, 
+    {242725318,209320132,242638579,209383394}, {247980941,209383394,248066084,209448672}, {242638579,209383394,242553436,209448672}, 
+    {248066084,209448672,248149597,209515931}, {242553436,209448672,242469923,209515931}, {248149597,209515931,248231444,209585137}, 
+    {242469923,209515931,242388076,209585137}, {248231444,209585137,248311590,209656254}, {242388076,209585137,242307930,209656254}, 
+    {248311590,209656254,248390000,209729246}, {242307930,209656254,242229520,209729246}, {248390000,209729246,248466640,209804080}, 
+    {242229520,209729246,242152880,209804080}, {248466640,209804080,248541474,209880720}, {242152880,209804080,242078046,209880720}, 
+    {248541474,209880720,248614466,209959130}, {242078046,209880720,242005054,209959130}, {248614466,209959130,248685583,210039276}, 
+    {242005054,209959130,241933937,210039276}, {248685583,210039276,248754789,210121123}, {241933937,210039276,241864731,210121123}, 
+    {248754789,210121123,248822048,210204636}, {241864731,210121123,241797472,210204636}, {248822048,210204636,248887326,210289779}, 
+    {241797472,210204636,241732194,210289779}, {248887326,210289779,248950588,210376518}, {241732194,210289779,241668932,210376518}, 
+    {248950588,210376518,249011799,210464817}, {241668932,210376518,241607721,210464817}, {249011799,210464817,249070923,210554641}, 
+    {241607721,210464817,241548597,210554641}, {249070923,210554641,249127925,210645956}, {241548597,210554641,241491595,210645956}, 
+    {249127925,210645956,249182771,210738726}, {241491595,210645956,241436749,210738726}, {249182771,210738726,249235426,210832916}, 
+    {241436749,210738726,241384094,210832916}, {249235426,210832916,249285854,210928492}, {241384094,210832916,241333666,210928492}, 
+    {249285854,210928492,249334020,211025417}, {241333666,210928492,241285500,211025417}, {249334020,211025417,249379889,211123658}, 
+    {241285500,211025417,241239631,211123658}, {249379889,211123658,249423426,211223178}, {241239631,211123658,241196094,211223178}, 
+    {249423426,211223178,249464596,211323943}, {241196094,211223178,241154924,211323943}, {249464596,211323943,249503365,211425918}, 
+    {241154924,211323943,241116155,211425918}, {249503365,211425918,249539696,211529068}, {241116155,211425918,241079824,211529068}, 
+    {249539696,211529068,249573555,211633357}, {241079824,211529068,241045965,211633357}, {249573555,211633357,249604907,211738751}, 
+    {241045965,211633357,241014613,211738751}, {249604907,211738751,249633716,211845215}, {241014613,211738751,240985804,211845215}, 
+    {249633716,211845215,249659948,211952713}, {240985804,211845215,240959572,211952713}, {249659948,211952713,249683568,212061210}, 
+    {240959572,211952713,240935952,212061210}, {249683568,212061210,249704541,212170672}, {240935952,212061210,240914979,212170672}, 
+    {249704541,212170672,249722830,212281063}, {240914979,212170672,240896690,212281063}, {249722830,212281063,249738403,212392348}, 
+    {240896690,212281063,240881117,212392348}, {249738403,212392348,249751222,212504493}, {240881117,212392348,240868298,212504493}, 
+    {249751222,212504493,249761254,212617461}, {240868298,212504493,240858266,212617461}, {249761254,212617461,249768463,212731218}, 
+    {240858266,212617461,240851057,212731218}, {249768463,212731218,249772814,212845730}, {240851057,212731218,240846706,212845730}, 
+    {249772814,212845730,249774272,212960960}, {240846706,212845730,240845248,212960960}, {249774272,212960960,249772814,213076190}, 
+    {240845248,212960960,240846706,213076190}, {249772814,213076190,249768463,213190702}, {240846706,213076190,240851057,213190702}, 
+    {249768463,213190702,249761254,213304459}, {240851057,213190702,240858266,213304459}, {249761254,213304459,249751222,213417427}, 
+    {240858266,213304459,240868298,213417427}, {249751222,213417427,249738403,213529572}, {240868298,213417427,240881117,213529572}, 
+    {249738403,213529572,249722830,213640857}, {240881117,213529572,240896690,213640857}, {249722830,213640857,249704541,213751248}, 
+    {240896690,213640857,240914979,213751248}, {249704541,213751248,249683568,213860710}, {240914979,213751248,240935952,213860710}, 
+    {249683568,213860710,249659948,213969207}, {240935952,213860710,240959572,213969207}, {249659948,213969207,249633716,214076705}, 
+    {240959572,213969207,240985804,214076705}, {249633716,214076705,249604907,214183169}, {240985804,214076705,241014613,214183169}, 
+    {249604907,214183169,249573555,214288563}, {241014613,214183169,241045965,214288563}, {249573555,214288563,249539696,214392852}, 
+    {241045965,214288563,241079824,214392852}, {249539696,214392852,249503365,214496002}, {241079824,214392852,241116155,214496002}, 
+    {249503365,214496002,249464596,214597977}, {241116155,214496002,241154924,214597977}, {249464596,214597977,249423426,214698742}, 
+    {241154924,214597977,241196094,214698742}, {249423426,214698742,249379889,214798262}, {241196094,214698742,241239631,214798262}, 
+    {249379889,214798262,249334020,214896503}, {241239631,214798262,241285500,214896503}, {249334020,214896503,249285854,214993428}, 
+    {241285500,214896503,241333666,214993428}, {249285854,214993428,249235426,215089004}, {241333666,214993428,241384094,215089004}, 
+    {249235426,215089004,249182771,215183194}, {241384094,215089004,241436749,215183194}, {249182771,215183194,249127925,215275964}, 
+    {241436749,215183194,241491595,215275964}, {249127925,215275964,249070923,215367279}, {241491595,215275964,241548597,215367279}, 
+    {249070923,215367279,249011799,215457103}, {241548597,215367279,241607721,215457103}, {249011799,215457103,248950588,215545402}, 
+    {241607721,215457103,241668932,215545402}, {248950588,215545402,248887326,215632141}, {241668932,215545402,241732194,215632141}, 
+    {248887326,215632141,248822048,215717284}, {241732194,215632141,241797472,215717284}, {248822048,215717284,248754789,215800797}, 
+    {241797472,215717284,241864731,215800797}, {248754789,215800797,248685583,215882644}, {241864731,215800797,241933937,215882644}, 
+    {248685583,215882644,248614466,215962790}, {241933937,215882644,242005054,215962790}, {248614466,215962790,248541474,216041200}, 
+    {242005054,215962790,242078046,216041200}, {248541474,216041200,248466640,216117840}, {242078046,216041200,242152880,216117840}, 
+    {248466640,216117840,248390000,216192674}, {242152880,216117840,242229520,216192674}, {248390000,216192674,248311590,216265666}, 
+    {242229520,216192674,242307930,216265666}, {248311590,216265666,248231444,216336783}, {242307930,216265666,242388076,216336783}, 
+    {248231444,216336783,248149597,216405989}, {242388076,216336783,242469923,216405989}, {248149597,216405989,248066084,216473248}, 
+    {242469923,216405989,242553436,216473248}, {248066084,216473248,247980941,216538526}, {242553436,216473248,242638579,216538526}, 
+    {247980941,216538526,247894202,216601788}, {242638579,216538526,242725318,216601788}, {247894202,216601788,247805903,216662999}, 
+    {242725318,216601788,242813617,216662999}, {247805903,216662999,247716079,216722123}, {242813617,216662999,242903441,216722123}, 
+    {247716079,216722123,247624764,216779125}, {242903441,216722123,242994756,216779125}, {247624764,216779125,247531994,216833971}, 
+    {242994756,216779125,243087526,216833971}, {247531994,216833971,247437804,216886626}, {243087526,216833971,243181716,216886626}, 
+    {247437804,216886626,247342228,216937054}, {243181716,216886626,243277292,216937054}, {247342228,216937054,247245303,216985220}, 
+    {243277292,216937054,243374217,216985220}, {247245303,216985220,247147062,217031089}, {243374217,216985220,243472458,217031089}, 
+    {247147062,217031089,247047542,217074626}, {243472458,217031089,243571978,217074626}, {247047542,217074626,246946777,217115796}, 
+    {243571978,217074626,243672743,217115796}, {246946777,217115796,246844802,217154565}, {243672743,217115796,243774718,217154565}, 
+    {246844802,217154565,246741652,217190896}, {243774718,217154565,243877868,217190896}, {246741652,217190896,246637363,217224755}, 
+    {243877868,217190896,243982157,217224755}, {246637363,217224755,246531969,217256107}, {243982157,217224755,244087551,217256107}, 
+    {246531969,217256107,246425505,217284916}, {244087551,217256107,244194015,217284916}, {246425505,217284916,246318007,217311148}, 
+    {244194015,217284916,244301513,217311148}, {246318007,217311148,246209510,217334768}, {244301513,217311148,244410010,217334768}, 
+    {246209510,217334768,246100048,217355741}, {244410010,217334768,244519472,217355741}, {246100048,217355741,245989657,217374030}, 
+    {244519472,217355741,244629863,217374030}, {245989657,217374030,245878372,217389603}, {244629863,217374030,244741148,217389603}, 
+    {245878372,217389603,245766227,217402422}, {244741148,217389603,244853293,217402422}, {245766227,217402422,245653259,217412454}, 
+    {244853293,217402422,244966261,217412454}, {245653259,217412454,245539502,217419663}, {244966261,217412454,245080018,217419663}, 
+    {245539502,217419663,245424990,217424014}, {245080018,217419663,245194530,217424014}, {245424990,217424014,245309760,217425472}, 
+    {245194530,217424014,245309760,217425472}, 
+};
+
+const Segment SEGMENTS_LEFT_ARM[] = {
+    {261072747,233144111,261053344,233144265}, {261072747,233144111,261092035,233144295}, {261053344,233144265,261033825,233144759}, 
+    {261092035,233144295,261111206,233144813}, {261033825,233144759,260994441,233146777}, {261111206,233144813,261130260,233145664}, 
+    {261130260,233145664,261149197,233146844}, {260994441,233146777,260954600,233150186}, {261149197,233146844,261168016,233148351}, 
+    {261168016,233148351,261186718,233150182}, {261186718,233150182,261205301,233152334}, {260954600,233150186,260914304,233155008}, 
+    {261205301,233152334,261223765,233154806}, {261223765,233154806,261242111,233157594}, {260914304,233155008,239990272,236012224}, 
+    {261242111,233157594,261260336,233160696}, {261260336,233160696,261278442,233164108}, {261278442,233164108,261296428,233167830}, 
+    {261296428,233167830,261314292,233171857}, {261314292,233171857,261332036,233176187}, {261332036,233176187,261349659,233180818}, 
+    {261349659,233180818,261367159,233185747}, {261367159,233185747,261384537,233190972}, {261384537,233190972,261401793,233196489}, 
+    {261401793,233196489,261435935,233208390}, {261435935,233208390,261469582,233221432}, {261469582,233221432,261502730,233235591}, 
+    {261502730,233235591,261535377,233250848}, {261535377,233250848,261567520,233267182}, {261567520,233267182,261599156,233284571}, 
+    {261599156,233284571,261630280,233302994}, {261630280,233302994,261660891,233322431}, {261660891,233322431,261690985,233342860}, 
+    {261690985,233342860,261720559,233364261}, {261720559,233364261,261749611,233386612}, {261749611,233386612,261778136,233409892}, 
+    {261778136,233409892,261806131,233434081}, {261806131,233434081,261833595,233459157}, {261833595,233459157,261860523,233485100}, 
+    {261860523,233485100,261886912,233511888}, {261886912,233511888,261912760,233539501}, {261912760,233539501,261938063,233567917}, 
+    {261938063,233567917,261962818,233597115}, {261962818,233597115,261987022,233627075}, {261987022,233627075,262010672,233657775}, 
+    {262010672,233657775,262033765,233689194}, {262033765,233689194,262056298,233721312}, {262056298,233721312,262078267,233754108}, 
+    {262078267,233754108,262099670,233787560}, {262099670,233787560,262120504,233821647}, {262120504,233821647,262140764,233856348}, 
+    {262140764,233856348,262160449,233891643}, {262160449,233891643,262179555,233927511}, {262179555,233927511,262198079,233963929}, 
+    {262198079,233963929,262216018,234000879}, {262216018,234000879,262233369,234038337}, {262233369,234038337,262250128,234076284}, 
+    {262250128,234076284,262281861,234153559}, {262281861,234153559,262311191,234232536}, {262311191,234232536,262338094,234313046}, 
+    {262338094,234313046,262362545,234394922}, {262362545,234394922,262384519,234477995}, {262384519,234477995,262403992,234562098}, 
+    {262403992,234562098,262420938,234647063}, {262420938,234647063,262435333,234732721}, {262435333,234732721,262447152,234818904}, 
+    {262447152,234818904,262456370,234905445}, {262456370,234905445,262462962,234992176}, {262462962,234992176,262466904,235078928}, 
+    {262466904,235078928,262468170,235165533}, {262468170,235165533,262466736,235251824}, {262466736,235251824,262462577,235337633}, 
+    {262462577,235337633,262455669,235422790}, {262455669,235422790,262445985,235507130}, {262445985,235507130,262440095,235548940}, 
+    {262440095,235548940,262433502,235590483}, {262433502,235590483,262426204,235631737}, {262426204,235631737,262418195,235672681}, 
+    {262418195,235672681,262409475,235713295}, {262409475,235713295,262400039,235753557}, {262400039,235753557,262389885,235793446}, 
+    {262389885,235793446,262379009,235832942}, {262379009,235832942,262367409,235872023}, {262367409,235872023,262355081,235910669}, 
+    {262355081,235910669,262342021,235948857}, {262342021,235948857,262328228,235986569}, {262328228,235986569,262313698,236023781}, 
+    {239990272,236012224,239946509,236018888}, {239946509,236018888,239903680,236026790}, {262313698,236023781,262298428,236060474}, 
+    {239903680,236026790,239861781,236035909}, {239861781,236035909,239820807,236046225}, {239820807,236046225,239780754,236057715}, 
+    {239780754,236057715,239741615,236070360}, {262298428,236060474,262282414,236096626}, {239741615,236070360,239703387,236084138}, 
+    {239703387,236084138,239666065,236099029}, {262282414,236096626,262265654,236132217}, {239666065,236099029,239629644,236115010}, 
+    {239629644,236115010,239594119,236132061}, {239594119,236132061,239559486,236150162}, {262265654,236132217,262248144,236167225}, 
+    {239559486,236150162,239525739,236169290}, {262248144,236167225,262229882,236201629}, {239525739,236169290,239492874,236189426}, 
+    {239492874,236189426,239460887,236210547}, {262229882,236201629,262210864,236235409}, {239460887,236210547,239429771,236232633}, 
+    {239429771,236232633,239399523,236255663}, {262210864,236235409,262191088,236268543}, {239399523,236255663,239370138,236279615}, 
+    {262191088,236268543,262170549,236301010}, {239370138,236279615,239341610,236304470}, {262170549,236301010,262149246,236332790}, 
+    {239341610,236304470,239313936,236330205}, {239313936,236330205,239287110,236356800}, {262149246,236332790,262127174,236363861}, 
+    {239287110,236356800,239261128,236384234}, {262127174,236363861,262104331,236394202}, {239261128,236384234,239235985,236412485}, 
+    {262104331,236394202,262080714,236423793}, {239235985,236412485,239211675,236441533}, {262080714,236423793,262056319,236452612}, 
+    {239211675,236441533,239188195,236471356}, {262056319,236452612,262031144,236480639}, {239188195,236471356,239165539,236501934}, 
+    {262031144,236480639,262005185,236507851}, {239165539,236501934,239143702,236533245}, {262005185,236507851,261978440,236534229}, 
+    {239143702,236533245,239122681,236565269}, {261978440,236534229,261950904,236559752}, {261950904,236559752,261922576,236584398}, 
+    {239122681,236565269,239102470,236597984}, {261922576,236584398,261893452,236608146}, {239102470,236597984,239083064,236631370}, 
+    {261893452,236608146,261863528,236630975}, {261863528,236630975,261832803,236652865}, {239083064,236631370,239064458,236665404}, 
+    {261832803,236652865,261801272,236673794}, {239064458,236665404,239046648,236700068}, {261801272,236673794,261768932,236693741}, 
+    {261768932,236693741,261735781,236712686}, {239046648,236700068,239029629,236735338}, {261735781,236712686,261701816,236730607}, 
+    {261701816,236730607,261667032,236747484}, {239029629,236735338,239013396,236771195}, {261667032,236747484,261631428,236763294}, 
+    {261631428,236763294,261595000,236778018}, {239013396,236771195,238997945,236807617}, {261595000,236778018,261557745,236791635}, 
+    {261557745,236791635,261519660,236804123}, {261519660,236804123,261480741,236815461}, {238997945,236807617,238983270,236844583}, 
+    {261480741,236815461,261440986,236825628}, {261440986,236825628,261400392,236834604}, {261400392,236834604,261358955,236842367}, 
+    {261358955,236842367,261316672,236848896}, {238983270,236844583,238969366,236882072}, {261316672,236848896,240350208,239749312}, 
+    {238969366,236882072,238956230,236920063}, {238956230,236920063,238943856,236958535}, {238943856,236958535,238932239,236997468}, 
+    {238932239,236997468,238921375,237036839}, {238921375,237036839,238911259,237076628}, {238911259,237076628,238901886,237116814}, 
+    {238901886,237116814,238893251,237157376}, {238893251,237157376,238885349,237198293}, {238885349,237198293,238878177,237239544}, 
+    {238878177,237239544,238871728,237281107}, {238871728,237281107,238865998,237322962}, {238865998,237322962,238860982,237365088}, 
+    {238860982,237365088,238853075,237450068}, {238853075,237450068,238847968,237535878}, {238847968,237535878,238845622,237622350}, 
+    {238845622,237622350,238846000,237709316}, {238846000,237709316,238849062,237796607}, {238849062,237796607,238854771,237884056}, 
+    {238854771,237884056,238863089,237971494}, {238863089,237971494,238873976,238058752}, {238873976,238058752,238887395,238145663}, 
+    {238887395,238145663,238903308,238232057}, {238903308,238232057,238921676,238317768}, {238921676,238317768,238942461,238402626}, 
+    {238942461,238402626,238965624,238486463}, {238965624,238486463,238991128,238569112}, {238991128,238569112,239018933,238650402}, 
+    {239018933,238650402,239049003,238730168}, {239049003,238730168,239081297,238808239}, {239081297,238808239,239115779,238884448}, 
+    {239115779,238884448,239152410,238958627}, {239152410,238958627,239171519,238994903}, {239171519,238994903,239191151,239030607}, 
+    {239191151,239030607,239211301,239065720}, {239211301,239065720,239231964,239100220}, {239231964,239100220,239253136,239134086}, 
+    {239253136,239134086,239274812,239167298}, {239274812,239167298,239296986,239199833}, {239296986,239199833,239319655,239231672}, 
+    {239319655,239231672,239342813,239262792}, {239342813,239262792,239366455,239293174}, {239366455,239293174,239390577,239322796}, 
+    {239390577,239322796,239415174,239351636}, {239415174,239351636,239440242,239379674}, {239440242,239379674,239465774,239406890}, 
+    {239465774,239406890,239491768,239433261}, {239491768,239433261,239518217,239458766}, {239518217,239458766,239545117,239483386}, 
+    {239545117,239483386,239572464,239507098}, {239572464,239507098,239600252,239529882}, {239600252,239529882,239628476,239551717}, 
+    {239628476,239551717,239657133,239572581}, {239657133,239572581,239686216,239592453}, {239686216,239592453,239715722,239611314}, 
+    {239715722,239611314,239745646,239629140}, {239745646,239629140,239775982,239645913}, {239775982,239645913,239806726,239661609}, 
+    {239806726,239661609,239837873,239676209}, {239837873,239676209,239853597,239683091}, {239853597,239683091,239869419,239689692}, 
+    {239869419,239689692,239885340,239696007}, {239885340,239696007,239901358,239702035}, {239901358,239702035,239917474,239707774}, 
+    {239917474,239707774,239933686,239713219}, {239933686,239713219,239949995,239718370}, {239949995,239718370,239966398,239723223}, 
+    {239966398,239723223,239982897,239727775}, {239982897,239727775,239999490,239732024}, {239999490,239732024,240016176,239735967}, 
+    {240016176,239735967,240032956,239739603}, {240032956,239739603,240049827,239742927}, {240049827,239742927,240066791,239745937}, 
+    {240066791,239745937,240083846,239748632}, {240083846,239748632,240100991,239751007}, {240350208,239749312,240331857,239751677}, 
+    {240100991,239751007,240118227,239753061}, {240331857,239751677,240313588,239753685}, {240118227,239753061,240135552,239754791}, 
+    {240313588,239753685,240295401,239755341}, {240135552,239754791,240152965,239756194}, {240295401,239755341,240277299,239756647}, 
+    {240152965,239756194,240170467,239757268}, {240277299,239756647,240259280,239757604}, {240170467,239757268,240188057,239758010}, 
+    {240259280,239757604,240241346,239758217}, {240188057,239758010,240205734,239758417}, {240241346,239758217,240223497,239758487}, 
+    {240205734,239758417,240223497,239758487}, 
+};
+
+const Segment SEGMENTS_LEFT_ARM_INNER[] = {
+    {238731948,216366562,238751682,216366981}, {238731948,216366562,238722114,216366607}, {238722114,216366607,238712307,216366822}, 
+    {238712307,216366822,238702529,216367207}, {238751682,216366981,238771480,216368080}, {238702529,216367207,238692786,216367762}, 
+    {238692786,216367762,238683079,216368487}, {238771480,216368080,238791315,216369857}, {238683079,216368487,238673413,216369382}, 
+    {238673413,216369382,238663791,216370447}, {238791315,216369857,238811159,216372313}, {238663791,216370447,238654217,216371683}, 
+    {238654217,216371683,238644693,216373088}, {238811159,216372313,238830984,216375447}, {238644693,216373088,238635224,216374664}, 
+    {238635224,216374664,238625813,216376410}, {238830984,216375447,238850762,216379259}, {238625813,216376410,238616463,216378326}, 
+    {238616463,216378326,238607179,216380413}, {238850762,216379259,238870466,216383749}, {238607179,216380413,238597962,216382670}, 
+    {238597962,216382670,238588818,216385097}, {238870466,216383749,238890066,216388915}, {238588818,216385097,238579749,216387695}, 
+    {238579749,216387695,238570759,216390464}, {238890066,216388915,238909536,216394759}, {238570759,216390464,238561852,216393403}, 
+    {238561852,216393403,238553030,216396512}, {238909536,216394759,238928848,216401280}, {238553030,216396512,238544297,216399792}, 
+    {238544297,216399792,238535658,216403243}, {238928848,216401280,238947973,216408477}, {238535658,216403243,238527114,216406865}, 
+    {238527114,216406865,238518671,216410657}, {238947973,216408477,238957457,216412329}, {238518671,216410657,238510330,216414620}, 
+    {238957457,216412329,238966884,216416350}, {238510330,216414620,238502097,216418754}, {238966884,216416350,238976251,216420540}, 
+    {238502097,216418754,238493974,216423058}, {238976251,216420540,238985553,216424899}, {238493974,216423058,238485964,216427534}, 
+    {238985553,216424899,238994788,216429427}, {238485964,216427534,238478072,216432180}, {238994788,216429427,239003952,216434123}, 
+    {238478072,216432180,238470300,216436997}, {239003952,216434123,239013042,216438988}, {238470300,216436997,238462653,216441986}, 
+    {239013042,216438988,239022053,216444022}, {238462653,216441986,238455133,216447145}, {239022053,216444022,239030983,216449225}, 
+    {238455133,216447145,238447744,216452476}, {239030983,216449225,239039829,216454596}, {238447744,216452476,238440490,216457977}, 
+    {239039829,216454596,239048586,216460137}, {238440490,216457977,238433375,216463650}, {239048586,216460137,239057251,216465845}, 
+    {238433375,216463650,238426400,216469494}, {239057251,216465845,239065820,216471722}, {238426400,216469494,238419571,216475509}, 
+    {239065820,216471722,239074291,216477768}, {238419571,216475509,238412891,216481696}, {239074291,216477768,239082660,216483982}, 
+    {238412891,216481696,238406362,216488054}, {239082660,216483982,239090922,216490365}, {238406362,216488054,238399990,216494583}, 
+    {239090922,216490365,239099075,216496916}, {238399990,216494583,238393776,216501284}, {239099075,216496916,239107116,216503635}, 
+    {238393776,216501284,238387724,216508156}, {239107116,216503635,239115040,216510522}, {238387724,216508156,238381839,216515199}, 
+    {239115040,216510522,239122845,216517578}, {238381839,216515199,238376123,216522414}, {239122845,216517578,239130526,216524802}, 
+    {238376123,216522414,238370580,216529801}, {239130526,216524802,239138080,216532195}, {238370580,216529801,238365214,216537359}, 
+    {239138080,216532195,239145505,216539755}, {238365214,216537359,238360028,216545088}, {239145505,216539755,239152795,216547484}, 
+    {238360028,216545088,238355025,216552990}, {239152795,216547484,239159949,216555380}, {238355025,216552990,238350208,216561063}, 
+    {239159949,216555380,239166961,216563445}, {238350208,216561063,238345583,216569308}, {239166961,216563445,239173830,216571678}, 
+    {238345583,216569308,238341151,216577724}, {239173830,216571678,239180551,216580079}, {238341151,216577724,238336917,216586313}, 
+    {239180551,216580079,239187120,216588647}, {238336917,216586313,238332883,216595073}, {239187120,216588647,239193536,216597384}, 
+    {238332883,216595073,238329054,216604005}, {239193536,216597384,239199793,216606288}, {238329054,216604005,238325432,216613110}, 
+    {239199793,216606288,239205888,216615360}, {238325432,216613110,238322022,216622386}, {239205888,216615360,239240646,216667271}, 
+    {238322022,216622386,238318827,216631834}, {238318827,216631834,238315850,216641454}, {238315850,216641454,238313095,216651246}, 
+    {238313095,216651246,238310565,216661211}, {238310565,216661211,238308264,216671347}, {239240646,216667271,239277346,216720074}, 
+    {238308264,216671347,238306195,216681656}, {238306195,216681656,238304361,216692137}, {238304361,216692137,238302767,216702791}, 
+    {238302767,216702791,238301416,216713616}, {238301416,216713616,238300311,216724614}, {239277346,216720074,239356398,216828185}, 
+    {238300311,216724614,238299455,216735785}, {238299455,216735785,238298853,216747128}, {238298853,216747128,238298507,216758643}, 
+    {238298507,216758643,238298421,216770331}, {238298421,216770331,238298599,216782192}, {238298599,216782192,238299044,216794225}, 
+    {238299044,216794225,238299759,216806430}, {238299759,216806430,238300749,216818809}, {238300749,216818809,238302016,216831360}, 
+    {239356398,216828185,239442708,216939345}, {238302016,216831360,238313479,216922178}, {238313479,216922178,238319705,216963324}, 
+    {239442708,216939345,239535938,217053207}, {238319705,216963324,238326255,217001853}, {238326255,217001853,238333123,217037933}, 
+    {238333123,217037933,238340305,217071734}, {239535938,217053207,239635751,217169422}, {238340305,217071734,238347796,217103423}, 
+    {238347796,217103423,238355591,217133170}, {238355591,217133170,238363685,217161142}, {238363685,217161142,238372075,217187510}, 
+    {239635751,217169422,239741809,217287644}, {238372075,217187510,238380754,217212442}, {238380754,217212442,238389719,217236105}, 
+    {238389719,217236105,238398964,217258670}, {238398964,217258670,238408485,217280304}, {238408485,217280304,238418276,217301176}, 
+    {239741809,217287644,239853775,217407524}, {238418276,217301176,238428334,217321456}, {238428334,217321456,238449229,217360911}, 
+    {238449229,217360911,238471130,217400018}, {238471130,217400018,238517802,217482586}, {239853775,217407524,239971312,217528715}, 
+    {238517802,217482586,238542496,217528747}, {239971312,217528715,240221749,217773639}, {238542496,217528747,238568045,217579958}, 
+    {238568045,217579958,238581127,217607879}, {238581127,217607879,238594409,217637568}, {238594409,217637568,238607886,217669195}, 
+    {238607886,217669195,238621552,217702928}, {238621552,217702928,238635403,217738935}, {238635403,217738935,238649435,217777386}, 
+    {240221749,217773639,240490422,218019636}, {238649435,217777386,238678019,217862293}, {238678019,217862293,238707267,217958996}, 
+    {238707267,217958996,238737140,218068848}, {240490422,218019636,240774632,218263923}, {238737140,218068848,238767600,218193195}, 
+    {238767600,218193195,238798609,218333389}, {240774632,218263923,241071680,218503720}, {238798609,218333389,238830129,218490778}, 
+    {238830129,218490778,238862122,218666712}, {241071680,218503720,241378868,218736246}, {238862122,218666712,238927372,219079613}, 
+    {241378868,218736246,241693498,218958719}, {241693498,218958719,241852760,219065317}, {248088559,219014476,248098076,219014679}, 
+    {248088559,219014476,248078751,219014507}, {248078751,219014507,248068651,219014777}, {248098076,219014679,248107308,219015114}, 
+    {248068651,219014777,248058254,219015287}, {248107308,219015114,248116257,219015778}, {248058254,219015287,248047558,219016041}, 
+    {248116257,219015778,248124926,219016668}, {248047558,219016041,248036558,219017041}, {248124926,219016668,248133319,219017781}, 
+    {248036558,219017041,248025252,219018290}, {248133319,219017781,248141440,219019114}, {248025252,219018290,248013635,219019792}, 
+    {248141440,219019114,248149292,219020665}, {248013635,219019792,247989459,219023565}, {248149292,219020665,248156878,219022430}, 
+    {248156878,219022430,248160572,219023392}, {248160572,219023392,248164202,219024407}, {247989459,219023565,247964002,219028382}, 
+    {248164202,219024407,248167766,219025473}, {248167766,219025473,248171266,219026592}, {248171266,219026592,248174702,219027761}, 
+    {248174702,219027761,248178075,219028982}, {247964002,219028382,247937236,219034267}, {248178075,219028982,248181385,219030254}, 
+    {248181385,219030254,248184632,219031575}, {248184632,219031575,248187817,219032947}, {248187817,219032947,248190940,219034368}, 
+    {247937236,219034267,247909136,219041244}, {248190940,219034368,248194002,219035839}, {248194002,219035839,248197003,219037358}, 
+    {248197003,219037358,248199944,219038926}, {248199944,219038926,248202824,219040542}, {248202824,219040542,248205645,219042206}, 
+    {247909136,219041244,247879672,219049335}, {248205645,219042206,248208407,219043917}, {248208407,219043917,248211110,219045675}, 
+    {248211110,219045675,248213754,219047480}, {248213754,219047480,248216341,219049331}, {248216341,219049331,248218870,219051228}, 
+    {247879672,219049335,247848819,219058564}, {248218870,219051228,248221342,219053170}, {248221342,219053170,248223757,219055158}, 
+    {248223757,219055158,248226116,219057190}, {248226116,219057190,248228419,219059267}, {247848819,219058564,247816549,219068954}, 
+    {248228419,219059267,248230667,219061388}, {248230667,219061388,248232860,219063553}, {248232860,219063553,248234999,219065761}, 
+    {241852760,219065317,242012871,219168359}, {248234999,219065761,248237083,219068013}, {248237083,219068013,248239114,219070306}, 
+    {247816549,219068954,247782834,219080529}, {248239114,219070306,248241091,219072642}, {248241091,219072642,248243016,219075020}, 
+    {248243016,219075020,248244888,219077440}, {248244888,219077440,248246708,219079901}, {238927372,219079613,238994055,219582888}, 
+    {248246708,219079901,248248477,219082402}, {247782834,219080529,247747648,219093312}, {248248477,219082402,248250194,219084944}, 
+    {248250194,219084944,248251861,219087526}, {248251861,219087526,248253478,219090148}, {248253478,219090148,248255044,219092809}, 
+    {248255044,219092809,248256562,219095509}, {247747648,219093312,247128641,219335303}, {248256562,219095509,248258030,219098247}, 
+    {248258030,219098247,248259450,219101024}, {248259450,219101024,248260822,219103839}, {248260822,219103839,248262146,219106691}, 
+    {248262146,219106691,248263422,219109581}, {248263422,219109581,248264652,219112507}, {248264652,219112507,248265835,219115470}, 
+    {248265835,219115470,248268064,219121503}, {248268064,219121503,248270113,219127677}, {248270113,219127677,248271984,219133990}, 
+    {248271984,219133990,248273681,219140439}, {248273681,219140439,248275208,219147019}, {248275208,219147019,248276568,219153730}, 
+    {248276568,219153730,248277764,219160567}, {248277764,219160567,248278800,219167528}, {248278800,219167528,248279679,219174610}, 
+    {242012871,219168359,242173492,219267498}, {248279679,219174610,248280405,219181810}, {248280405,219181810,248280981,219189124}, 
+    {248280981,219189124,248281410,219196551}, {248281410,219196551,248281696,219204087}, {248281696,219204087,248281842,219211729}, 
+    {248281842,219211729,248281728,219227321}, {248281728,219227321,248281096,219243302}, {248281096,219243302,248279973,219259651}, 
+    {248279973,219259651,248278387,219276342}, {242173492,219267498,242334288,219362385}, {248278387,219276342,248276363,219293353}, 
+    {248276363,219293353,248273930,219310660}, {248273930,219310660,248271115,219328240}, {248271115,219328240,248264447,219364127}, 
+    {247128641,219335303,246572857,219563273}, {242334288,219362385,242494920,219452673}, {248264447,219364127,248256578,219400825}, 
+    {248256578,219400825,248247724,219438147}, {248247724,219438147,248227936,219513917}, {242494920,219452673,242655051,219538015}, 
+    {248227936,219513917,248206827,219589942}, {242655051,219538015,242814344,219618062}, {246572857,219563273,246062806,219764544}, 
+    {238994055,219582888,239130496,220903744}, {248206827,219589942,248186139,219664724}, {242814344,219618062,242972462,219692468}, 
+    {248186139,219664724,248167616,219736768}, {242972462,219692468,243129067,219760884}, {248167616,219736768,248158414,219772463}, 
+    {243129067,219760884,243283822,219822964}, {246062806,219764544,245819466,219851206}, {248158414,219772463,248147551,219809963}, 
+    {248147551,219809963,248135065,219849212}, {243283822,219822964,243360400,219851518}, {248135065,219849212,248120996,219890158}, 
+    {245819466,219851206,245699760,219890351}, {243360400,219851518,243436389,219878358}, {243436389,219878358,243511747,219903440}, 
+    {248120996,219890158,248105383,219932749}, {245699760,219890351,245581000,219926440}, {243511747,219903440,243586432,219926720}, 
+    {245581000,219926440,245462912,219959276}, {243586432,219926720,243657276,219947377}, {248105383,219932749,248088266,219976930}, 
+    {243657276,219947377,243727229,219966454}, {245462912,219959276,245345223,219988660}, {243727229,219966454,243796326,219983974}, 
+    {248088266,219976930,248049673,220069853}, {243796326,219983974,243864600,219999963}, {245345223,219988660,245227660,220014395}, 
+    {243864600,219999963,243932086,220014445}, {245227660,220014395,245109949,220036283}, {243932086,220014445,243998817,220027446}, 
+    {243998817,220027446,244064828,220038989}, {245109949,220036283,245050952,220045722}, {244064828,220038989,244130154,220049100}, 
+    {245050952,220045722,244991817,220054124}, {244130154,220049100,244194828,220057803}, {244991817,220054124,244932508,220061466}, 
+    {244194828,220057803,244258884,220065124}, {244932508,220061466,244872991,220067722}, {244258884,220065124,244322356,220071086}, 
+    {244872991,220067722,244813232,220072868}, {248049673,220069853,248005531,220168500}, {244322356,220071086,244385279,220075716}, 
+    {244813232,220072868,244753197,220076879}, {244385279,220075716,244447688,220079036}, {244753197,220076879,244692852,220079729}, 
+    {244447688,220079036,244509615,220081073}, {244692852,220079729,244632163,220081395}, {244509615,220081073,244571095,220081851}, 
+    {244632163,220081395,244571095,220081851}, {248005531,220168500,247956153,220272448}, {247956153,220272448,247842946,220494539}, 
+    {247842946,220494539,247712558,220732724}, {247712558,220732724,247567498,220983598}, {239130496,220903744,239152710,221130116}, 
+    {247567498,220983598,247243392,221509800}, {239152710,221130116,239180148,221362099}, {239180148,221362099,239213369,221598055}, 
+    {247243392,221509800,246890690,222045917}, {239213369,221598055,239252928,221836347}, {239252928,221836347,239299384,222075336}, 
+    {246890690,222045917,246529454,222564721}, {239299384,222075336,239353296,222313384}, {239353296,222313384,239383221,222431543}, 
+    {239383221,222431543,239415219,222548852}, {239415219,222548852,239449359,222665108}, {246529454,222564721,246179747,223038982}, 
+    {239449359,222665108,239485712,222780104}, {239485712,222780104,239524347,222893636}, {239524347,222893636,239565333,223005500}, 
+    {239565333,223005500,239608740,223115491}, {246179747,223038982,246015487,223250900}, {239608740,223115491,239654638,223223403}, 
+    {239654638,223223403,239703098,223329033}, {246015487,223250900,245861632,223441472}, {239703098,223329033,239754187,223432175}, 
+    {239754187,223432175,239807977,223532625}, {245861632,223441472,245781694,223535997}, {239807977,223532625,239835906,223581776}, 
+    {245781694,223535997,245702843,223625129}, {239835906,223581776,239864536,223630177}, {245702843,223625129,245625069,223709152}, 
+    {239864536,223630177,239893876,223677803}, {239893876,223677803,239923935,223724628}, {245625069,223709152,245548365,223788345}, 
+    {239923935,223724628,239954721,223770626}, {239954721,223770626,239986243,223815771}, {245548365,223788345,245472722,223862989}, 
+    {239986243,223815771,240018510,223860039}, {240018510,223860039,240051530,223903404}, {245472722,223862989,245398131,223933367}, 
+    {240051530,223903404,240085312,223945839}, {245398131,223933367,245324584,223999757}, {240085312,223945839,240119866,223987320}, 
+    {240119866,223987320,240155198,224027821}, {245324584,223999757,245252072,224062443}, {240155198,224027821,240191319,224067315}, 
+    {245252072,224062443,245180587,224121704}, {240191319,224067315,240228237,224105779}, {240228237,224105779,240265961,224143185}, 
+    {245180587,224121704,245110120,224177823}, {240265961,224143185,240304500,224179509}, {245110120,224177823,244972207,224281754}, 
+    {240304500,224179509,240343861,224214724}, {240343861,224214724,240384054,224248806}, {240384054,224248806,240425088,224281728}, 
+    {240425088,224281728,238272640,233090624}, {244972207,224281754,244838264,224376485}, {244838264,224376485,244708224,224464264}, 
+    {244708224,224464264,244459577,224627961}, {244459577,224627961,244340834,224708376}, {244340834,224708376,244225720,224790833}, 
+    {244225720,224790833,244169503,224833530}, {244169503,224833530,244114167,224877580}, {244114167,224877580,244059705,224923265}, 
+    {244059705,224923265,244006107,224970866}, {244006107,224970866,243953365,225020664}, {243953365,225020664,243901471,225072939}, 
+    {243901471,225072939,243850416,225127974}, {243850416,225127974,243825201,225156613}, {243825201,225156613,243800192,225186048}, 
+    {243800192,225186048,241141056,233824256}, {238272640,233090624,238269757,233102976}, {238269757,233102976,238267143,233115328}, 
+    {238267143,233115328,238264796,233127679}, {238264796,233127679,238262715,233140028}, {238262715,233140028,238260896,233152374}, 
+    {238260896,233152374,238259339,233164717}, {238259339,233164717,238258042,233177056}, {238258042,233177056,238257002,233189389}, 
+    {238257002,233189389,238256219,233201715}, {238256219,233201715,238255689,233214035}, {238255689,233214035,238255411,233226347}, 
+    {238255411,233226347,238255384,233238650}, {238255384,233238650,238255605,233250943}, {238255605,233250943,238256072,233263225}, 
+    {238256072,233263225,238256784,233275496}, {238256784,233275496,238257739,233287755}, {238257739,233287755,238258934,233300000}, 
+    {238258934,233300000,238260369,233312231}, {238260369,233312231,238262041,233324448}, {238262041,233324448,238263948,233336648}, 
+    {238263948,233336648,238266088,233348832}, {238266088,233348832,238268460,233360998}, {238268460,233360998,238271061,233373145}, 
+    {238271061,233373145,238273891,233385273}, {238273891,233385273,238276946,233397381}, {238276946,233397381,238280225,233409467}, 
+    {238280225,233409467,238287448,233433574}, {238287448,233433574,238295545,233457585}, {238295545,233457585,238304500,233481494}, 
+    {238304500,233481494,238314299,233505294}, {238314299,233505294,238324927,233528978}, {238324927,233528978,238336369,233552538}, 
+    {238336369,233552538,238348609,233575968}, {238348609,233575968,238361633,233599261}, {238361633,233599261,238375426,233622410}, 
+    {238375426,233622410,238389973,233645407}, {238389973,233645407,238405259,233668246}, {238405259,233668246,238421269,233690920}, 
+    {238421269,233690920,238437988,233713421}, {238437988,233713421,238455400,233735743}, {238455400,233735743,238473492,233757879}, 
+    {238473492,233757879,238492248,233779821}, {238492248,233779821,238511653,233801562}, {238511653,233801562,238531692,233823096}, 
+    {238531692,233823096,238552350,233844416}, {241141056,233824256,241130670,233856226}, {238552350,233844416,238573612,233865514}, 
+    {241130670,233856226,241119466,233887307}, {238573612,233865514,238595464,233886384}, {238595464,233886384,238617889,233907018}, 
+    {241119466,233887307,241107458,233917507}, {238617889,233907018,238640874,233927409}, {241107458,233917507,241094663,233946831}, 
+    {238640874,233927409,238688462,233967436}, {241094663,233946831,241081094,233975289}, {238688462,233967436,238738107,234006408}, 
+    {241081094,233975289,241066767,234002885}, {241066767,234002885,241051696,234029629}, {238738107,234006408,238789690,234044269}, 
+    {241051696,234029629,241043887,234042682}, {241043887,234042682,241035897,234055525}, {238789690,234044269,238843090,234080963}, 
+    {241035897,234055525,241027730,234068158}, {241027730,234068158,241019385,234080582}, {241019385,234080582,241010866,234092798}, 
+    {238843090,234080963,238898188,234116434}, {241010866,234092798,241002175,234104807}, {241002175,234104807,240993312,234116609}, 
+    {238898188,234116434,238954865,234150626}, {240993312,234116609,240984281,234128206}, {240984281,234128206,240975082,234139598}, 
+    {240975082,234139598,240965718,234150787}, {238954865,234150626,239013000,234183482}, {240965718,234150787,240956191,234161773}, 
+    {240956191,234161773,240946502,234172556}, {240946502,234172556,240936654,234183139}, {240936654,234183139,240926648,234193521}, 
+    {239013000,234183482,239072473,234214946}, {240926648,234193521,240916486,234203704}, {240916486,234203704,240906170,234213689}, 
+    {240906170,234213689,240885084,234233066}, {239072473,234214946,239133166,234244963}, {240885084,234233066,240863404,234251660}, 
+    {239133166,234244963,239194958,234273475}, {240863404,234251660,240841145,234269477}, {240841145,234269477,240818323,234286526}, 
+    {239194958,234273475,239257729,234300427}, {240818323,234286526,240794952,234302812}, {239257729,234300427,239321359,234325763}, 
+    {240794952,234302812,240771047,234318343}, {240771047,234318343,240746624,234333125}, {239321359,234325763,239385730,234349426}, 
+    {240746624,234333125,240721697,234347167}, {240721697,234347167,240696281,234360474}, {239385730,234349426,239450720,234371360}, 
+    {240696281,234360474,240670391,234373054}, {239450720,234371360,239516211,234391509}, {240670391,234373054,240644043,234384914}, 
+    {240644043,234384914,240617250,234396061}, {239516211,234391509,239582082,234409817}, {240617250,234396061,240590029,234406501}, 
+    {240590029,234406501,240562394,234416243}, {239582082,234409817,239648214,234426228}, {240562394,234416243,240534359,234425293}, 
+    {240534359,234425293,240505941,234433657}, {239648214,234426228,239714486,234440685}, {240505941,234433657,240477154,234441344}, 
+    {239714486,234440685,239780780,234453132}, {240477154,234441344,240448013,234448360}, {240448013,234448360,240418533,234454711}, 
+    {239780780,234453132,239846976,234463514}, {240418533,234454711,240388728,234460406}, {240388728,234460406,240358615,234465451}, 
+    {239846976,234463514,239912953,234471773}, {240358615,234465451,240328207,234469853}, {240328207,234469853,240297520,234473619}, 
+    {239912953,234471773,239978591,234477854}, {240297520,234473619,240266569,234476757}, {240266569,234476757,240235369,234479272}, 
+    {239978591,234477854,240043772,234481701}, {240235369,234479272,240203934,234481173}, {240203934,234481173,240172281,234482466}, 
+    {240043772,234481701,240076153,234482769}, {240172281,234482466,240140423,234483158}, {240076153,234482769,240108375,234483257}, 
+    {240140423,234483158,240108375,234483257}, 
+};
+
+const Segment SEGMENTS_LEFT_ARM_MID[] = {
+    {225893028,217671280,225900677,217671329}, {225893028,217671280,225885514,217671372}, {225900677,217671329,225908463,217671520}, 
+    {225885514,217671372,225878136,217671605}, {225908463,217671520,225916386,217671854}, {225878136,217671605,225870894,217671977}, 
+    {225916386,217671854,225932641,217672955}, {225870894,217671977,225863787,217672488}, {225863787,217672488,225856815,217673137}, 
+    {225932641,217672955,225949447,217674637}, {225856815,217673137,225849977,217673923}, {225849977,217673923,225843273,217674846}, 
+    {225949447,217674637,225966804,217676908}, {225843273,217674846,225836704,217675904}, {225836704,217675904,225830268,217677096}, 
+    {225966804,217676908,225984716,217679775}, {225830268,217677096,225823966,217678423}, {225823966,217678423,225817797,217679882}, 
+    {225984716,217679775,226003184,217683243}, {225817797,217679882,225811761,217681473}, {225811761,217681473,225805858,217683196}, 
+    {225805858,217683196,225800087,217685049}, {226003184,217683243,226022211,217687321}, {225800087,217685049,225794448,217687032}, 
+    {225794448,217687032,225788940,217689143}, {226022211,217687321,226041799,217692013}, {225788940,217689143,225783565,217691383}, 
+    {225783565,217691383,225778320,217693749}, {226041799,217692013,226061950,217697328}, {225778320,217693749,225773206,217696242}, 
+    {225773206,217696242,225768223,217698860}, {226061950,217697328,226082667,217703272}, {225768223,217698860,225763371,217701602}, 
+    {225763371,217701602,225758648,217704469}, {226082667,217703272,226103951,217709850}, {225758648,217704469,225754055,217707458}, 
+    {225754055,217707458,225749592,217710569}, {226103951,217709850,226125806,217717072}, {225749592,217710569,225745258,217713802}, 
+    {225745258,217713802,225741053,217717155}, {226125806,217717072,226148233,217724942}, {225741053,217717155,225736976,217720628}, 
+    {225736976,217720628,225733028,217724219}, {225733028,217724219,225729208,217727928}, {226148233,217724942,226194812,217742655}, 
+    {225729208,217727928,225725516,217731754}, {225725516,217731754,225721952,217735697}, {225721952,217735697,225718514,217739754}, 
+    {225718514,217739754,225715204,217743927}, {226194812,217742655,226243709,217763044}, {225715204,217743927,225712020,217748213}, 
+    {225712020,217748213,225708963,217752612}, {225708963,217752612,225706032,217757123}, {225706032,217757123,225703226,217761745}, 
+    {225703226,217761745,225700547,217766477}, {226243709,217763044,226294939,217786162}, {225700547,217766477,225697992,217771319}, 
+    {225697992,217771319,225695563,217776270}, {225695563,217776270,225693258,217781328}, {225693258,217781328,225691077,217786494}, 
+    {226294939,217786162,226348523,217812063}, {225691077,217786494,225689021,217791765}, {225689021,217791765,225687089,217797142}, 
+    {225687089,217797142,225685280,217802624}, {225685280,217802624,225683594,217808209}, {225683594,217808209,225682032,217813897}, 
+    {226348523,217812063,226404477,217840801}, {225682032,217813897,225680592,217819687}, {225680592,217819687,225679275,217825578}, 
+    {225679275,217825578,225678080,217831570}, {225678080,217831570,225677006,217837661}, {225677006,217837661,225676055,217843850}, 
+    {226404477,217840801,226462819,217872428}, {225676055,217843850,225675224,217850138}, {225675224,217850138,225674515,217856522}, 
+    {225674515,217856522,225673926,217863003}, {225673926,217863003,225673458,217869579}, {225673458,217869579,225673110,217876249}, 
+    {226462819,217872428,226523569,217906999}, {225673110,217876249,225672882,217883013}, {225672882,217883013,225672774,217889870}, 
+    {225672774,217889870,225672915,217903858}, {225672915,217903858,225673530,217918208}, {226523569,217906999,226586743,217944566}, 
+    {225673530,217918208,225674619,217932912}, {225674619,217932912,225676179,217947963}, {226586743,217944566,226720440,218028906}, 
+    {225676179,217947963,225678206,217963356}, {225678206,217963356,225680700,217979083}, {225680700,217979083,225683657,217995138}, 
+    {225683657,217995138,225687076,218011514}, {225687076,218011514,225690954,218028204}, {225690954,218028204,225695289,218045202}, 
+    {226720440,218028906,226864053,218125876}, {225695289,218045202,225700079,218062500}, {225700079,218062500,225705322,218080093}, 
+    {225705322,218080093,225711014,218097973}, {225711014,218097973,225723741,218134570}, {226864053,218125876,227017728,218235904}, 
+    {225723741,218134570,225738241,218172236}, {225738241,218172236,225754497,218210918}, {225754497,218210918,225772491,218250564}, 
+    {227017728,218235904,227289224,218432058}, {235945825,218237905,235956110,218237990}, {235945825,218237905,235935399,218238056}, 
+    {235956110,218237990,235966253,218238312}, {235935399,218238056,235924833,218238445}, {235966253,218238312,235976253,218238870}, 
+    {235924833,218238445,235914129,218239072}, {235976253,218238870,235986110,218239662}, {235914129,218239072,235903287,218239938}, 
+    {235986110,218239662,235995820,218240688}, {235903287,218239938,235892309,218241045}, {235995820,218240688,236005385,218241947}, 
+    {235892309,218241045,235881195,218242392}, {236005385,218241947,236014802,218243439}, {235881195,218242392,235869947,218243981}, 
+    {236014802,218243439,236024071,218245162}, {235869947,218243981,235858566,218245811}, {236024071,218245162,236033190,218247117}, 
+    {235858566,218245811,235847053,218247885}, {236033190,218247117,236042159,218249301}, {235847053,218247885,235835409,218250203}, 
+    {236042159,218249301,236050975,218251715}, {235835409,218250203,235823635,218252765}, {225772491,218250564,225792204,218291118}, 
+    {236050975,218251715,236059639,218254357}, {235823635,218252765,235811733,218255572}, {236059639,218254357,236068149,218257228}, 
+    {235811733,218255572,235787546,218261925}, {236068149,218257228,236076504,218260326}, {236076504,218260326,236084702,218263650}, 
+    {235787546,218261925,235762857,218269267}, {236084702,218263650,236092743,218267200}, {236092743,218267200,236100626,218270974}, 
+    {235762857,218269267,235737675,218277606}, {236100626,218270974,236108350,218274973}, {236108350,218274973,236115912,218279195}, 
+    {235737675,218277606,235712009,218286947}, {236115912,218279195,236123313,218283640}, {236123313,218283640,236130552,218288307}, 
+    {235712009,218286947,235685868,218297295}, {236130552,218288307,236137626,218293195}, {225792204,218291118,225813618,218332528}, 
+    {236137626,218293195,236144536,218298304}, {235685868,218297295,235659260,218308657}, {236144536,218298304,236151280,218303632}, 
+    {236151280,218303632,236157856,218309179}, {235659260,218308657,235632194,218321040}, {236157856,218309179,236164264,218314944}, 
+    {236164264,218314944,236170503,218320927}, {236170503,218320927,236176571,218327126}, {235632194,218321040,235604678,218334448}, 
+    {236176571,218327126,236182468,218333541}, {225813618,218332528,225836715,218374740}, {236182468,218333541,236188192,218340171}, 
+    {235604678,218334448,235576723,218348888}, {236188192,218340171,236193742,218347016}, {236193742,218347016,236199118,218354074}, 
+    {235576723,218348888,235548335,218364366}, {236199118,218354074,236204318,218361345}, {236204318,218361345,236209340,218368829}, 
+    {235548335,218364366,235519525,218380888}, {236209340,218368829,236214185,218376524}, {225836715,218374740,225861478,218417701}, 
+    {236214185,218376524,236218850,218384429}, {235519525,218380888,235490301,218398460}, {236218850,218384429,236223335,218392544}, 
+    {236223335,218392544,236227638,218400869}, {235490301,218398460,235460672,218417088}, {236227638,218400869,236231759,218409402}, 
+    {236231759,218409402,236235697,218418142}, {235460672,218417088,235346736,218491860}, {225861478,218417701,225887888,218461357}, 
+    {236235697,218418142,236239450,218427090}, {236239450,218427090,236243016,218436243}, {227289224,218432058,227567109,218625409}, 
+    {236243016,218436243,236246396,218445602}, {236246396,218445602,236249588,218455165}, {236249588,218455165,236252591,218464933}, 
+    {225887888,218461357,225915926,218505654}, {236252591,218464933,236255404,218474903}, {236255404,218474903,236258025,218485076}, 
+    {236258025,218485076,236260454,218495451}, {235346736,218491860,235233972,218568801}, {236260454,218495451,236262690,218506026}, 
+    {225915926,218505654,225945576,218550539}, {236262690,218506026,236264731,218516802}, {236264731,218516802,236266576,218527777}, 
+    {236266576,218527777,236268224,218538950}, {236268224,218538950,236269675,218550321}, {236269675,218550321,236270926,218561890}, 
+    {225945576,218550539,225976818,218595959}, {236270926,218561890,236271978,218573655}, {235233972,218568801,235011611,218727954}, 
+    {236271978,218573655,236272828,218585615}, {236272828,218585615,236273921,218610120}, {225976818,218595959,226009635,218641860}, 
+    {236273921,218610120,236274196,218635398}, {227567109,218625409,227851083,218814733}, {236274196,218635398,236273644,218661444}, 
+    {226009635,218641860,226044009,218688188}, {236273644,218661444,236272257,218688251}, {226044009,218688188,226117353,218781912}, 
+    {236272257,218688251,236270026,218715813}, {236270026,218715813,236266942,218744125}, {235011611,218727954,234577087,219058691}, 
+    {236266942,218744125,236262996,218773180}, {236262996,218773180,236258179,218802973}, {226117353,218781912,226196707,218876704}, 
+    {236258179,218802973,236252483,218833497}, {227851083,218814733,228140845,218998805}, {236252483,218833497,236245899,218864746}, 
+    {236245899,218864746,236238418,218896715}, {226196707,218876704,226281926,218972135}, {236238418,218896715,236230032,218929397}, 
+    {236230032,218929397,236220731,218962786}, {236220731,218962786,236210507,218996877}, {226281926,218972135,226372864,219067776}, 
+    {236210507,218996877,236199351,219031663}, {228140845,218998805,228436092,219176402}, {236199351,219031663,236187254,219067138}, 
+    {234577087,219058691,234151466,219389517}, {236187254,219067138,236174208,219103296}, {226372864,219067776,226442118,219140544}, 
+    {236174208,219103296,236127277,219225299}, {226442118,219140544,226505980,219212038}, {228436092,219176402,228736524,219346300}, 
+    {226505980,219212038,226564929,219282667}, {236127277,219225299,236076200,219349945}, {226564929,219282667,226592709,219317786}, 
+    {226592709,219317786,226619440,219352843}, {228736524,219346300,229041839,219507276}, {236076200,219349945,235963303,219606904}, 
+    {226619440,219352843,226645181,219387890}, {226645181,219387890,226669992,219422976}, {234151466,219389517,233940233,219548781}, 
+    {226669992,219422976,226693932,219458155}, {226693932,219458155,226717061,219493477}, {226717061,219493477,226761125,219564755}, 
+    {229041839,219507276,229351736,219658104}, {233940233,219548781,233729112,219700648}, {226761125,219564755,226802659,219637222}, 
+    {235963303,219606904,235706373,220149660}, {226802659,219637222,226842142,219711288}, {229351736,219658104,229508308,219729331}, 
+    {233729112,219700648,233623374,219773035}, {226842142,219711288,226880050,219787362}, {229508308,219729331,229665913,219797562}, 
+    {233623374,219773035,233517400,219842646}, {226880050,219787362,226916860,219865857}, {229665913,219797562,229824512,219862644}, 
+    {233517400,219842646,233411102,219909172}, {229824512,219862644,229984069,219924425}, {226916860,219865857,226953050,219947182}, 
+    {233411102,219909172,233304391,219972302}, {229984069,219924425,230144544,219982751}, {226953050,219947182,227025476,220119964}, 
+    {233304391,219972302,233197181,220031729}, {230144544,219982751,230305902,220037469}, {233197181,220031729,233089383,220087144}, 
+    {230305902,220037469,230468103,220088427}, {233089383,220087144,233035235,220113249}, {230468103,220088427,230631111,220135471}, 
+    {233035235,220113249,232980908,220138236}, {227025476,220119964,227101144,220308992}, {230631111,220135471,230794887,220178449}, 
+    {232980908,220138236,232926389,220162065}, {235706373,220149660,235430478,220727378}, {232926389,220162065,232871669,220184697}, 
+    {230794887,220178449,230959395,220217207}, {232871669,220184697,232816735,220206094}, {232816735,220206094,232761578,220226218}, 
+    {230959395,220217207,231124596,220251592}, {232761578,220226218,232706185,220245029}, {232706185,220245029,232650546,220262490}, 
+    {231124596,220251592,231290452,220281452}, {232650546,220262490,232594650,220278561}, {232594650,220278561,232538486,220293203}, 
+    {231290452,220281452,231456926,220306633}, {232538486,220293203,232482043,220306379}, {232482043,220306379,232425310,220318049}, 
+    {231456926,220306633,231623981,220326983}, {227101144,220308992,227277471,220748922}, {232425310,220318049,232368276,220328175}, 
+    {231623981,220326983,231791578,220342348}, {232368276,220328175,232310929,220336718}, {232310929,220336718,232253260,220343640}, 
+    {231791578,220342348,231959680,220352576}, {232253260,220343640,232195256,220348902}, {232195256,220348902,232136907,220352465}, 
+    {232136907,220352465,232078202,220354291}, {231959680,220352576,232019130,220354341}, {232078202,220354291,232019130,220354341}, 
+    {235430478,220727378,235293876,221028039}, {227277471,220748922,227385762,221006392}, {227385762,221006392,227512561,221293242}, 
+    {235293876,221028039,235162680,221335872}, {227512561,221293242,227661683,221612757}, {235162680,221335872,235100167,221492314}, 
+    {235100167,221492314,235040273,221650353}, {227661683,221612757,227836945,221968221}, {235040273,221650353,234983423,221809923}, 
+    {234983423,221809923,234930039,221970958}, {227836945,221968221,228042162,222362916}, {234930039,221970958,234880543,222133395}, 
+    {234880543,222133395,234835358,222297166}, {234835358,222297166,234794908,222462207}, {228042162,222362916,228281152,222800128}, 
+    {234794908,222462207,234759615,222628452}, {234759615,222628452,234744034,222712006}, {234744034,222712006,234729902,222795836}, 
+    {234729902,222795836,234717270,222879935}, {228281152,222800128,228296583,222827025}, {228296583,222827025,228312651,222853714}, 
+    {228312651,222853714,228329343,222880197}, {234717270,222879935,234706191,222964294}, {228329343,222880197,228346648,222906479}, 
+    {228346648,222906479,228364555,222932563}, {228364555,222932563,228383053,222958453}, {228383053,222958453,228402129,222984152}, 
+    {234706191,222964294,234696719,223048904}, {228402129,222984152,228421773,223009664}, {228421773,223009664,228462718,223060141}, 
+    {234696719,223048904,234688906,223133759}, {228462718,223060141,228505795,223109915}, {228505795,223109915,228550913,223159013}, 
+    {234688906,223133759,234682806,223218850}, {228550913,223159013,228597981,223207465}, {228597981,223207465,228646907,223255300}, 
+    {234682806,223218850,234678470,223304168}, {228646907,223255300,228697600,223302547}, {228697600,223302547,228749968,223349235}, 
+    {234678470,223304168,234675952,223389705}, {228749968,223349235,228803920,223395394}, {234675952,223389705,234675305,223475453}, 
+    {228803920,223395394,228916210,223486239}, {234675305,223475453,234676581,223561405}, {228916210,223486239,229033736,223575314}, 
+    {234676581,223561405,234679833,223647551}, {229033736,223575314,229155768,223662853}, {234679833,223647551,234685115,223733884}, 
+    {229155768,223662853,229281573,223749088}, {234685115,223733884,234692479,223820395}, {229281573,223749088,229541575,223918578}, 
+    {234692479,223820395,234701978,223907076}, {234701978,223907076,234713664,223993920}, {229541575,223918578,230074656,224252160}, 
+    {234713664,223993920,236112960,233495744}, {230074656,224252160,230336024,224419977}, {230336024,224419977,230462853,224504957}, 
+    {230462853,224504957,230586137,224590962}, {230586137,224590962,230705143,224678224}, {230705143,224678224,230819139,224766977}, 
+    {230819139,224766977,230874030,224811985}, {230874030,224811985,230927394,224857453}, {230927394,224857453,230979140,224903411}, 
+    {230979140,224903411,231029176,224949886}, {231029176,224949886,231077411,224996909}, {231077411,224996909,231123752,225044508}, 
+    {231123752,225044508,231168110,225092712}, {231168110,225092712,231210392,225141551}, {231210392,225141551,231250506,225191054}, 
+    {231250506,225191054,231269722,225216063}, {231269722,225216063,231288362,225241249}, {231288362,225241249,231306414,225266616}, 
+    {231306414,225266616,231323867,225292167}, {231323867,225292167,231340710,225317905}, {231340710,225317905,231356931,225343835}, 
+    {231356931,225343835,231372519,225369960}, {231372519,225369960,231387462,225396284}, {231387462,225396284,231401748,225422810}, 
+    {231401748,225422810,231415367,225449542}, {231415367,225449542,231428307,225476483}, {231428307,225476483,231440557,225503638}, 
+    {231440557,225503638,231452105,225531009}, {231452105,225531009,231462939,225558601}, {231462939,225558601,231473048,225586417}, 
+    {231473048,225586417,231482422,225614461}, {231482422,225614461,231491047,225642737}, {231491047,225642737,231498914,225671247}, 
+    {231498914,225671247,231506010,225699996}, {231506010,225699996,231512324,225728988}, {231512324,225728988,231517844,225758225}, 
+    {231517844,225758225,231522560,225787712}, {231522560,225787712,232700416,233874112}, {236112960,233495744,236118336,233536544}, 
+    {236118336,233536544,236122385,233576838}, {236122385,233576838,236125129,233616625}, {236125129,233616625,236126586,233655902}, 
+    {236126586,233655902,236126776,233694667}, {236126776,233694667,236125719,233732918}, {236125719,233732918,236123433,233770653}, 
+    {236123433,233770653,236119939,233807869}, {236119939,233807869,236115256,233844565}, {236115256,233844565,236109404,233880738}, 
+    {232700416,233874112,232706964,233914745}, {236109404,233880738,236102403,233916386}, {232706964,233914745,232714651,233954601}, 
+    {236102403,233916386,236094270,233951507}, {236094270,233951507,236085028,233986099}, {232714651,233954601,232723456,233993682}, 
+    {236085028,233986099,236074694,234020159}, {232723456,233993682,232733359,234031990}, {236074694,234020159,236063289,234053686}, 
+    {232733359,234031990,232744342,234069529}, {236063289,234053686,236050831,234086678}, {232744342,234069529,232756385,234106298}, 
+    {236050831,234086678,236037341,234119131}, {232756385,234106298,232769468,234142302}, {236037341,234119131,236022839,234151045}, 
+    {232769468,234142302,232783572,234177542}, {236022839,234151045,236007343,234182416}, {232783572,234177542,232798676,234212020}, 
+    {236007343,234182416,235990873,234213243}, {232798676,234212020,232814763,234245738}, {235990873,234213243,235973449,234243524}, 
+    {235973449,234243524,235955090,234273256}, {232814763,234245738,232831811,234278699}, {235955090,234273256,235935816,234302438}, 
+    {232831811,234278699,232849801,234310904}, {235935816,234302438,235915647,234331066}, {232849801,234310904,232868715,234342356}, 
+    {235915647,234331066,235894602,234359140}, {232868715,234342356,232888531,234373057}, {235894602,234359140,235872700,234386656}, 
+    {232888531,234373057,232909232,234403009}, {235872700,234386656,235849961,234413613}, {232909232,234403009,232930797,234432214}, 
+    {235849961,234413613,235826405,234440008}, {232930797,234432214,232953206,234460675}, {235826405,234440008,235802051,234465840}, 
+    {232953206,234460675,232976441,234488394}, {235802051,234465840,235776919,234491106}, {232976441,234488394,233000481,234515372}, 
+    {235776919,234491106,235751028,234515804}, {233000481,234515372,233025307,234541612}, {235751028,234515804,235724398,234539932}, 
+    {235724398,234539932,235697048,234563488}, {233025307,234541612,233050899,234567115}, {235697048,234563488,235668999,234586469}, 
+    {233050899,234567115,233077239,234591886}, {235668999,234586469,235640269,234608873}, {233077239,234591886,233104305,234615924}, 
+    {235640269,234608873,235610878,234630699}, {233104305,234615924,233132080,234639233}, {235610878,234630699,235580845,234651944}, 
+    {233132080,234639233,233160543,234661814}, {235580845,234651944,235550191,234672606}, {233160543,234661814,233189674,234683671}, 
+    {235550191,234672606,235518934,234692683}, {233189674,234683671,233219455,234704804}, {235518934,234692683,235487095,234712172}, 
+    {233219455,234704804,233249865,234725216}, {235487095,234712172,235454693,234731072}, {233249865,234725216,233280885,234744910}, 
+    {235454693,234731072,235421747,234749381}, {233280885,234744910,233312496,234763887}, {235421747,234749381,235388277,234767095}, 
+    {233312496,234763887,233344677,234782150}, {235388277,234767095,235354302,234784213}, {233344677,234782150,233377410,234799700}, 
+    {235354302,234784213,235319843,234800734}, {233377410,234799700,233410675,234816540}, {235319843,234800734,235284918,234816654}, 
+    {233410675,234816540,233444452,234832672}, {235284918,234816654,235249547,234831971}, {235249547,234831971,235213750,234846684}, 
+    {233444452,234832672,233478721,234848099}, {235213750,234846684,235177546,234860791}, {233478721,234848099,233513464,234862821}, 
+    {235177546,234860791,235140955,234874288}, {233513464,234862821,233548661,234876843}, {235140955,234874288,235103996,234887175}, 
+    {233548661,234876843,233584291,234890164}, {235103996,234887175,235066690,234899448}, {233584291,234890164,233620336,234902789}, 
+    {235066690,234899448,234991110,234922146}, {233620336,234902789,233656776,234914719}, {233656776,234914719,233693591,234925955}, 
+    {234991110,234922146,234914373,234942365}, {233693591,234925955,233730762,234936501}, {233730762,234936501,233768270,234946358}, 
+    {234914373,234942365,234836635,234960089}, {233768270,234946358,233806094,234955529}, {233806094,234955529,233844215,234964016}, 
+    {234836635,234960089,234758051,234975299}, {233844215,234964016,233882614,234971820}, {233882614,234971820,233921271,234978945}, 
+    {234758051,234975299,234678780,234987979}, {233921271,234978945,233960166,234985392}, {233960166,234985392,233999281,234991162}, 
+    {234678780,234987979,234598976,234998112}, {233999281,234991162,234038595,234996260}, {234038595,234996260,234117742,235004443}, 
+    {234598976,234998112,234518797,235005680}, {234117742,235004443,234197453,235009958}, {234518797,235005680,234438398,235010665}, 
+    {234197453,235009958,234277570,235012822}, {234438398,235010665,234357937,235013052}, {234277570,235012822,234357937,235013052}, 
+};
+
+const Segment SEGMENTS_LEFT_ARM_OUTER[] = {
+    {212914181,217439789,212901677,217439958}, {212914181,217439789,212926916,217440035}, {212901677,217439958,212889405,217440536}, 
+    {212926916,217440035,212939882,217440700}, {212889405,217440536,212883357,217440977}, {212939882,217440700,212953076,217441788}, 
+    {212883357,217440977,212877367,217441519}, {212877367,217441519,212871437,217442161}, {212953076,217441788,212966498,217443306}, 
+    {212871437,217442161,212865565,217442903}, {212865565,217442903,212859752,217443743}, {212966498,217443306,212980146,217445256}, 
+    {212859752,217443743,212853999,217444682}, {212853999,217444682,212848305,217445718}, {212980146,217445256,212994019,217447644}, 
+    {212848305,217445718,212842671,217446851}, {212842671,217446851,212837096,217448081}, {212994019,217447644,213008116,217450475}, 
+    {212837096,217448081,212831581,217449407}, {212831581,217449407,212826127,217450829}, {213008116,217450475,213022435,217453753}, 
+    {212826127,217450829,212820732,217452345}, {212820732,217452345,212815398,217453955}, {213022435,217453753,213036976,217457484}, 
+    {212815398,217453955,212810124,217455659}, {212810124,217455659,212804912,217457456}, {212804912,217457456,212799760,217459345}, 
+    {213036976,217457484,213051736,217461671}, {212799760,217459345,212794669,217461326}, {212794669,217461326,212789639,217463398}, 
+    {213051736,217461671,213066715,217466319}, {212789639,217463398,212784670,217465561}, {212784670,217465561,212779763,217467814}, 
+    {213066715,217466319,213081912,217471434}, {212779763,217467814,212774918,217470156}, {212774918,217470156,212770135,217472588}, 
+    {213081912,217471434,213097324,217477019}, {212770135,217472588,212765413,217475107}, {212765413,217475107,212760754,217477715}, 
+    {213097324,217477019,213112952,217483080}, {212760754,217477715,212756157,217480409}, {212756157,217480409,212751622,217483190}, 
+    {213112952,217483080,213128793,217489621}, {212751622,217483190,212747150,217486057}, {212747150,217486057,212742740,217489009}, 
+    {212742740,217489009,212738394,217492046}, {213128793,217489621,213144846,217496648}, {212738394,217492046,212734111,217495167}, 
+    {212734111,217495167,212729891,217498372}, {213144846,217496648,213161110,217504164}, {212729891,217498372,212725734,217501660}, 
+    {212725734,217501660,212721641,217505030}, {213161110,217504164,213177584,217512174}, {212721641,217505030,212717611,217508482}, 
+    {212717611,217508482,212713646,217512015}, {212713646,217512015,212709744,217515629}, {213177584,217512174,213194266,217520683}, 
+    {212709744,217515629,212705907,217519323}, {212705907,217519323,212702134,217523097}, {213194266,217520683,213211156,217529697}, 
+    {223331940,217522338,223318562,217522558}, {223331940,217522338,223345225,217522459}, {223345225,217522459,223358406,217522928}, 
+    {223318562,217522558,223305098,217523114}, {223358406,217522928,223371477,217523751}, {212702134,217523097,212698425,217526949}, 
+    {223305098,217523114,223291557,217523999}, {223371477,217523751,223384428,217524935}, {223291557,217523999,223277948,217525207}, 
+    {223384428,217524935,223397251,217526485}, {223277948,217525207,223264278,217526732}, {223397251,217526485,223409938,217528409}, 
+    {223264278,217526732,223250557,217528567}, {212698425,217526949,212694782,217530879}, {223409938,217528409,223422480,217530712}, 
+    {223250557,217528567,223236793,217530705}, {213211156,217529697,213228251,217539219}, {223236793,217530705,223222994,217533142}, 
+    {223422480,217530712,223434868,217533401}, {212694782,217530879,212691203,217534888}, {223222994,217533142,223209168,217535869}, 
+    {223434868,217533401,223447095,217536481}, {212691203,217534888,212687689,217538973}, {223209168,217535869,223195326,217538882}, 
+    {223447095,217536481,223459151,217539960}, {223195326,217538882,223181474,217542174}, {212687689,217538973,212684240,217543135}, 
+    {213228251,217539219,213245551,217549254}, {223459151,217539960,223465112,217541851}, {223465112,217541851,223471028,217543844}, 
+    {223181474,217542174,223167621,217545738}, {212684240,217543135,212680856,217547373}, {223471028,217543844,223476897,217545939}, 
+    {223167621,217545738,223153776,217549569}, {223476897,217545939,223482718,217548138}, {212680856,217547373,212677538,217551686}, 
+    {223482718,217548138,223488490,217550441}, {213245551,217549254,213280761,217570882}, {223153776,217549569,223126144,217558003}, 
+    {223488490,217550441,223494211,217552850}, {212677538,217551686,212674286,217556074}, {223494211,217552850,223499882,217555364}, 
+    {223499882,217555364,223505501,217557985}, {212674286,217556074,212671099,217560536}, {223505501,217557985,223511066,217560713}, 
+    {223126144,217558003,223098645,217567427}, {212671099,217560536,212667978,217565071}, {223511066,217560713,223516578,217563549}, 
+    {223516578,217563549,223522033,217566494}, {212667978,217565071,212661935,217574361}, {223522033,217566494,223527433,217569549}, 
+    {223098645,217567427,223071346,217577790}, {223527433,217569549,223532775,217572715}, {213280761,217570882,213316773,217594621}, 
+    {223532775,217572715,223538058,217575992}, {212661935,217574361,212656158,217583938}, {223538058,217575992,223543282,217579381}, 
+    {223071346,217577790,223044317,217589043}, {223543282,217579381,223548445,217582883}, {223548445,217582883,223553547,217586499}, 
+    {212656158,217583938,212650648,217593797}, {223553547,217586499,223558586,217590229}, {223044317,217589043,223017624,217601134}, 
+    {223558586,217590229,223563561,217594075}, {212650648,217593797,212645405,217603935}, {223563561,217594075,223568471,217598037}, 
+    {213316773,217594621,213353579,217620506}, {223568471,217598037,223573315,217602115}, {223017624,217601134,222991336,217614013}, 
+    {223573315,217602115,223578092,217606311}, {212645405,217603935,212640433,217614345}, {223578092,217606311,223582801,217610626}, 
+    {223582801,217610626,223587441,217615059}, {222991336,217614013,222965520,217627630}, {212640433,217614345,212635731,217625024}, 
+    {223587441,217615059,223592011,217619613}, {223592011,217619613,223596510,217624288}, {213353579,217620506,213391168,217648576}, 
+    {223596510,217624288,223600936,217629084}, {212635731,217625024,212631301,217635966}, {222965520,217627630,222940245,217641936}, 
+    {223600936,217629084,223605289,217634002}, {223605289,217634002,223609567,217639044}, {212631301,217635966,212627144,217647168}, 
+    {223609567,217639044,223613770,217644209}, {222940245,217641936,222915578,217656879}, {223613770,217644209,223617896,217649499}, 
+    {212627144,217647168,212623262,217658624}, {213391168,217648576,214620877,218585546}, {223617896,217649499,223621945,217654915}, 
+    {223621945,217654915,223625915,217660457}, {222915578,217656879,222891587,217672409}, {212623262,217658624,212619656,217670329}, 
+    {223625915,217660457,223629806,217666126}, {223629806,217666126,223633615,217671923}, {212619656,217670329,212616326,217682280}, 
+    {223633615,217671923,223637343,217677848}, {222891587,217672409,222868340,217688476}, {223637343,217677848,223640988,217683903}, 
+    {212616326,217682280,212613276,217694470}, {223640988,217683903,223644548,217690088}, {222868340,217688476,222845906,217705030}, 
+    {223644548,217690088,223648024,217696404}, {212613276,217694470,212610504,217706896}, {223648024,217696404,223651414,217702852}, 
+    {223651414,217702852,223654716,217709432}, {222845906,217705030,222824351,217722020}, {212610504,217706896,212608014,217719553}, 
+    {223654716,217709432,223657931,217716146}, {223657931,217716146,223661056,217722994}, {212608014,217719553,212605806,217732436}, 
+    {222824351,217722020,222803744,217739396}, {223661056,217722994,223664090,217729977}, {223664090,217729977,223667034,217737095}, 
+    {212605806,217732436,212603881,217745540}, {223667034,217737095,223669884,217744350}, {222803744,217739396,222793817,217748213}, 
+    {223669884,217744350,223675304,217759273}, {212603881,217745540,212602241,217758861}, {222793817,217748213,222784152,217757108}, 
+    {222784152,217757108,222774758,217766075}, {212602241,217758861,212600888,217772393}, {223675304,217759273,223680342,217774751}, 
+    {222774758,217766075,222765644,217775106}, {212600888,217772393,212599821,217786133}, {223680342,217774751,223684988,217790791}, 
+    {222765644,217775106,222756817,217784196}, {222756817,217784196,222748287,217793339}, {212599821,217786133,212599043,217800075}, 
+    {223684988,217790791,223689235,217807399}, {222748287,217793339,222740062,217802528}, {212599043,217800075,212598554,217814216}, 
+    {222740062,217802528,222732150,217811757}, {223689235,217807399,223693074,217824581}, {222732150,217811757,222724560,217821019}, 
+    {212598554,217814216,212598357,217828549}, {222724560,217821019,222717300,217830309}, {223693074,217824581,223696496,217842343}, 
+    {212598357,217828549,212598452,217843071}, {222717300,217830309,222710379,217839620}, {222710379,217839620,222703805,217848946}, 
+    {223696496,217842343,223699493,217860692}, {212598452,217843071,212598841,217857776}, {222703805,217848946,222697587,217858281}, 
+    {212598841,217857776,212599525,217872660}, {222697587,217858281,222691733,217867617}, {223699493,217860692,223702057,217879635}, 
+    {222691733,217867617,222686252,217876950}, {212599525,217872660,212600505,217887719}, {222686252,217876950,222681152,217886272}, 
+    {223702057,217879635,223704179,217899177}, {222681152,217886272,222653612,217937057}, {212600505,217887719,212601782,217902947}, 
+    {223704179,217899177,223705850,217919324}, {212601782,217902947,212603358,217918340}, {212603358,217918340,212605234,217933893}, 
+    {223705850,217919324,223707062,217940083}, {212605234,217933893,212607411,217949602}, {222653612,217937057,222624388,217988105}, 
+    {223707062,217940083,223707807,217961461}, {212607411,217949602,212612674,217981466}, {223707807,217961461,223708076,217983463}, 
+    {212612674,217981466,212619158,218013896}, {223708076,217983463,223707860,218006096}, {222624388,217988105,222593509,218039381}, 
+    {223707860,218006096,223707152,218029367}, {212619158,218013896,212626871,218046853}, {223707152,218029367,223705942,218053280}, 
+    {222593509,218039381,222561003,218090852}, {212626871,218046853,212635826,218080301}, {223705942,218053280,223704222,218077843}, 
+    {223704222,218077843,223701984,218103063}, {212635826,218080301,212646031,218114200}, {222561003,218090852,222526899,218142485}, 
+    {223701984,218103063,223695919,218155494}, {212646031,218114200,212657497,218148514}, {222526899,218142485,222491226,218194245}, 
+    {212657497,218148514,212670234,218183205}, {223695919,218155494,223687678,218210625}, {212670234,218183205,212684253,218218235}, 
+    {222491226,218194245,222454013,218246099}, {223687678,218210625,223677195,218268505}, {212684253,218218235,212699563,218253567}, 
+    {222454013,218246099,222415288,218298014}, {212699563,218253567,212716174,218289162}, {223677195,218268505,223664400,218329185}, 
+    {212716174,218289162,212734097,218324984}, {222415288,218298014,222375080,218349956}, {212734097,218324984,212753342,218360995}, 
+    {223664400,218329185,223649226,218392716}, {222375080,218349956,222333418,218401891}, {212753342,218360995,212773919,218397156}, 
+    {223649226,218392716,223631605,218459147}, {212773919,218397156,212795839,218433431}, {222333418,218401891,222245848,218505606}, 
+    {212795839,218433431,212819111,218469781}, {223631605,218459147,223611470,218528528}, {212819111,218469781,212843745,218506169}, 
+    {222245848,218505606,222152807,218608890}, {212843745,218506169,212869752,218542557}, {223611470,218528528,223588752,218600911}, 
+    {212869752,218542557,212897142,218578908}, {212897142,218578908,212925926,218615184}, {214620877,218585546,214934494,218811091}, 
+    {223588752,218600911,223563383,218676345}, {222152807,218608890,222054526,218711474}, {212925926,218615184,212956112,218651347}, 
+    {212956112,218651347,212987712,218687360}, {223563383,218676345,223535296,218754880}, {212987712,218687360,213025641,218730741}, 
+    {222054526,218711474,221951235,218813090}, {213025641,218730741,213063327,218776221}, {223535296,218754880,223506637,218835403}, 
+    {213063327,218776221,213100775,218823729}, {214934494,218811091,215251579,219028620}, {221951235,218813090,221843163,218913467}, 
+    {213100775,218823729,213137989,218873191}, {223506637,218835403,223478745,218919052}, {213137989,218873191,213174974,218924534}, 
+    {221843163,218913467,221730542,219012338}, {223478745,218919052,223451634,219005722}, {213174974,218924534,213211733,218977685}, 
+    {213211733,218977685,213284595,219089116}, {223451634,219005722,223425322,219095305}, {221730542,219012338,221613601,219109433}, 
+    {215251579,219028620,215572628,219235866}, {213284595,219089116,213356611,219206899}, {223425322,219095305,223375153,219282788}, 
+    {221613601,219109433,221492571,219204483}, {221492571,219204483,221367682,219297218}, {213356611,219206899,213427816,219330450}, 
+    {215572628,219235866,215734794,219334924}, {223375153,219282788,223328362,219480649}, {221367682,219297218,221239164,219387371}, 
+    {213427816,219330450,213498246,219459182}, {215734794,219334924,215898136,219430560}, {221239164,219387371,221107248,219474672}, 
+    {215898136,219430560,216062717,219522491}, {213498246,219459182,213567937,219592511}, {221107248,219474672,220972163,219558852}, 
+    {223328362,219480649,223285074,219688038}, {216062717,219522491,216228599,219610434}, {220972163,219558852,220834140,219639641}, 
+    {213567937,219592511,213705245,219870616}, {216228599,219610434,216395844,219694105}, {220834140,219639641,220693409,219716771}, 
+    {223285074,219688038,223245414,219904103}, {216395844,219694105,216564514,219773220}, {220693409,219716771,220550201,219789973}, 
+    {216564514,219773220,216734670,219847496}, {220550201,219789973,220404745,219858978}, {216734670,219847496,216906375,219916649}, 
+    {220404745,219858978,220257271,219923516}, {213705245,219870616,213840024,220160081}, {223245414,219904103,223209507,220127994}, 
+    {216906375,219916649,217079691,219980396}, {220257271,219923516,220108011,219983319}, {217079691,219980396,217254679,220038454}, 
+    {220108011,219983319,219957194,220038118}, {219957194,220038118,219805050,220087643}, {217254679,220038454,217431402,220090538}, 
+    {219805050,220087643,219728553,220110344}, {217431402,220090538,217520433,220114252}, {219728553,220110344,219651810,220131626}, 
+    {217520433,220114252,217609922,220136366}, {223209507,220127994,223177477,220358859}, {219651810,220131626,219574851,220151455}, 
+    {217609922,220136366,217699875,220156845}, {219574851,220151455,219497704,220169797}, {217699875,220156845,217790300,220175654}, 
+    {213840024,220160081,214103144,220754360}, {219497704,220169797,219420398,220186619}, {217790300,220175654,217881205,220192756}, 
+    {219420398,220186619,219342962,220201888}, {217881205,220192756,217972599,220208117}, {219342962,220201888,219265425,220215569}, 
+    {217972599,220208117,218064488,220221702}, {219265425,220215569,219187815,220227629}, {218064488,220221702,218156880,220233474}, 
+    {219187815,220227629,219110161,220238034}, {218156880,220233474,218249784,220243398}, {219110161,220238034,219032492,220246751}, 
+    {218249784,220243398,218343206,220251439}, {219032492,220246751,218954836,220253746}, {218343206,220251439,218437155,220257562}, 
+    {218954836,220253746,218877223,220258986}, {218437155,220257562,218531639,220261731}, {218877223,220258986,218799682,220262436}, 
+    {218531639,220261731,218626665,220263910}, {218799682,220262436,218722240,220264064}, {218626665,220263910,218722240,220264064}, 
+    {223177477,220358859,223149450,220595847}, {223149450,220595847,223125550,220838108}, {214103144,220754360,214359583,221337884}, 
+    {223125550,220838108,223105903,221084790}, {223105903,221084790,223090632,221335042}, {223090632,221335042,223079863,221588012}, 
+    {214359583,221337884,214486011,221613906}, {223079863,221588012,223073721,221842851}, {214486011,221613906,214611627,221873189}, 
+    {223073721,221842851,223072330,222098707}, {214611627,221873189,214674219,221995090}, {214674219,221995090,214736716,222111051}, 
+    {223072330,222098707,223075816,222354728}, {214736716,222111051,214799152,222220486}, {214799152,222220486,214861564,222322809}, 
+    {214861564,222322809,214892772,222371121}, {223075816,222354728,223084303,222610064}, {214892772,222371121,214923987,222417436}, 
+    {214923987,222417436,214955214,222461680}, {214955214,222461680,214986457,222503780}, {214986457,222503780,215017720,222543663}, 
+    {215017720,222543663,215049009,222581256}, {215049009,222581256,215080328,222616486}, {223084303,222610064,223097916,222863864}, 
+    {215080328,222616486,215095999,222633192}, {215095999,222633192,215111680,222649280}, {215111680,222649280,215192085,222728526}, 
+    {215192085,222728526,215271694,222803786}, {215271694,222803786,215350526,222875193}, {223097916,222863864,223116780,223115276}, 
+    {215350526,222875193,215428599,222942876}, {215428599,222942876,215505930,223006966}, {215505930,223006966,215582538,223067595}, 
+    {215582538,223067595,215658440,223124893}, {223116780,223115276,223141019,223363449}, {215658440,223124893,215733654,223178991}, 
+    {215733654,223178991,215808197,223230020}, {215808197,223230020,215882089,223278111}, {215882089,223278111,215955345,223323395}, 
+    {215955345,223323395,216027986,223366002}, {223141019,223363449,223170759,223607533}, {216027986,223366002,216100027,223406063}, 
+    {216100027,223406063,216171488,223443710}, {216171488,223443710,216242385,223479073}, {216242385,223479073,216312737,223512283}, 
+    {216312737,223512283,216382562,223543471}, {216382562,223543471,216451877,223572767}, {216451877,223572767,216520700,223600304}, 
+    {216520700,223600304,216589050,223626210}, {223170759,223607533,223206125,223846677}, {216589050,223626210,216724399,223673659}, 
+    {216724399,223673659,216858066,223716159}, {216858066,223716159,216990195,223754759}, {216990195,223754759,217120927,223790505}, 
+    {217120927,223790505,217378776,223857624}, {223206125,223846677,223247240,224080028}, {217378776,223857624,217632754,223925891}, 
+    {217632754,223925891,217758648,223963073}, {217758648,223963073,217884003,224003682}, {217884003,224003682,217946523,224025599}, 
+    {217946523,224025599,218008961,224048766}, {218008961,224048766,218071336,224073313}, {218071336,224073313,218133665,224099372}, 
+    {223247240,224080028,223294231,224306737}, {218133665,224099372,218195967,224127073}, {218195967,224127073,218258258,224156547}, 
+    {218258258,224156547,218320558,224187924}, {218320558,224187924,218382883,224221337}, {218382883,224221337,218445252,224256915}, 
+    {218445252,224256915,218507682,224294790}, {218507682,224294790,218570191,224335092}, {223294231,224306737,223347222,224525952}, 
+    {218570191,224335092,218632798,224377952}, {218632798,224377952,218695519,224423502}, {218695519,224423502,218758373,224471871}, 
+    {218758373,224471871,218821378,224523192}, {218821378,224523192,218884551,224577594}, {223347222,224525952,223376006,224632483}, 
+    {218884551,224577594,218947911,224635208}, {223376006,224632483,223406337,224736822}, {218947911,224635208,219011475,224696166}, 
+    {219011475,224696166,219075261,224760599}, {223406337,224736822,223438230,224838861}, {219075261,224760599,219139286,224828636}, 
+    {219139286,224828636,219203569,224900410}, {223438230,224838861,223471702,224938495}, {219203569,224900410,219268128,224976051}, 
+    {223471702,224938495,223506767,225035618}, {219268128,224976051,219332981,225055689}, {223506767,225035618,223543441,225130122}, 
+    {219332981,225055689,219398144,225139456}, {223543441,225130122,223581740,225221902}, {219398144,225139456,229436288,238333952}, 
+    {223581740,225221902,223621680,225310851}, {223621680,225310851,223663276,225396862}, {223663276,225396862,223706543,225479830}, 
+    {223706543,225479830,223751497,225559647}, {223751497,225559647,223774612,225598342}, {223774612,225598342,223798155,225636209}, 
+    {223798155,225636209,223822127,225673235}, {223822127,225673235,223846530,225709407}, {223846530,225709407,223871367,225744712}, 
+    {223871367,225744712,223896640,225779136}, {223896640,225779136,232393728,237106048}, {232393728,237106048,232420080,237142108}, 
+    {232420080,237142108,232444990,237178101}, {232444990,237178101,232468475,237214021}, {232468475,237214021,232490550,237249857}, 
+    {232490550,237249857,232511230,237285602}, {232511230,237285602,232530532,237321248}, {232530532,237321248,232548472,237356786}, 
+    {232548472,237356786,232565064,237392207}, {232565064,237392207,232580326,237427505}, {232580326,237427505,232594272,237462669}, 
+    {232594272,237462669,232606918,237497692}, {232606918,237497692,232618281,237532565}, {232618281,237532565,232628376,237567281}, 
+    {232628376,237567281,232637219,237601830}, {232637219,237601830,232644825,237636204}, {232644825,237636204,232651210,237670396}, 
+    {232651210,237670396,232656391,237704396}, {232656391,237704396,232660383,237738196}, {232660383,237738196,232663201,237771789}, 
+    {232663201,237771789,232664862,237805165}, {232664862,237805165,232665381,237838316}, {232665381,237838316,232664774,237871234}, 
+    {232664774,237871234,232663057,237903911}, {232663057,237903911,232660245,237936338}, {232660245,237936338,232656355,237968506}, 
+    {232656355,237968506,232651402,238000409}, {232651402,238000409,232645402,238032036}, {232645402,238032036,232638370,238063380}, 
+    {232638370,238063380,232630323,238094433}, {232630323,238094433,232621277,238125186}, {232621277,238125186,232611246,238155630}, 
+    {232611246,238155630,232600247,238185758}, {232600247,238185758,232588296,238215561}, {232588296,238215561,232575408,238245031}, 
+    {232575408,238245031,232561599,238274159}, {232561599,238274159,232546885,238302937}, {232546885,238302937,232531282,238331356}, 
+    {232531282,238331356,232514805,238359409}, {229436288,238333952,229466769,238373095}, {232514805,238359409,232497471,238387087}, 
+    {229466769,238373095,229497797,238411120}, {232497471,238387087,232479294,238414382}, {229497797,238411120,229529355,238448035}, 
+    {232479294,238414382,232460292,238441284}, {232460292,238441284,232440479,238467787}, {229529355,238448035,229561428,238483849}, 
+    {232440479,238467787,232419871,238493881}, {229561428,238483849,229594001,238518569}, {232419871,238493881,232398485,238519559}, 
+    {229594001,238518569,229627057,238552205}, {232398485,238519559,232376335,238544811}, {232376335,238544811,232353439,238569630}, 
+    {229627057,238552205,229660580,238584764}, {232353439,238569630,232329810,238594007}, {229660580,238584764,229694556,238616255}, 
+    {232329810,238594007,232305466,238617933}, {229694556,238616255,229728967,238646686}, {232305466,238617933,232280422,238641401}, 
+    {232280422,238641401,232254694,238664403}, {229728967,238646686,229763799,238676066}, {232254694,238664403,232228297,238686929}, 
+    {229763799,238676066,229799035,238704403}, {232228297,238686929,232201248,238708971}, {229799035,238704403,229834660,238731705}, 
+    {232201248,238708971,232173562,238730522}, {232173562,238730522,232145255,238751572}, {229834660,238731705,229870658,238757981}, 
+    {232145255,238751572,232116342,238772113}, {229870658,238757981,229907014,238783239}, {232116342,238772113,232086840,238792138}, 
+    {229907014,238783239,229943710,238807487}, {232086840,238792138,232056765,238811637}, {229943710,238807487,229980733,238830734}, 
+    {232056765,238811637,232026131,238830602}, {232026131,238830602,231994955,238849026}, {229980733,238830734,230018065,238852988}, 
+    {231994955,238849026,231963253,238866899}, {230018065,238852988,230055691,238874258}, {231963253,238866899,231931040,238884213}, 
+    {230055691,238874258,230093596,238894551}, {231931040,238884213,231898333,238900960}, {230093596,238894551,230131763,238913876}, 
+    {231898333,238900960,231865146,238917132}, {230131763,238913876,230170176,238932242}, {231865146,238917132,231831496,238932720}, 
+    {230170176,238932242,230208821,238949656}, {231831496,238932720,231797399,238947716}, {231797399,238947716,231762869,238962111}, 
+    {230208821,238949656,230247681,238966128}, {231762869,238962111,231727924,238975898}, {230247681,238966128,230286741,238981665}, 
+    {231727924,238975898,231692579,238989067}, {230286741,238981665,230325984,238996276}, {231692579,238989067,231656849,239001610}, 
+    {230325984,238996276,230365394,239009969}, {231656849,239001610,231620751,239013520}, {230365394,239009969,230404957,239022753}, 
+    {231620751,239013520,231584300,239024788}, {230404957,239022753,230444657,239034635}, {231584300,239024788,231547511,239035405}, 
+    {230444657,239034635,230484476,239045625}, {231547511,239035405,231510402,239045363}, {231510402,239045363,231472987,239054653}, 
+    {230484476,239045625,230524401,239055731}, {231472987,239054653,231435282,239063268}, {230524401,239055731,230564414,239064960}, 
+    {231435282,239063268,231397303,239071200}, {230564414,239064960,230604501,239073322}, {231397303,239071200,231359067,239078438}, 
+    {230604501,239073322,230644645,239080824}, {231359067,239078438,231320587,239084976}, {230644645,239080824,230684831,239087476}, 
+    {231320587,239084976,231281882,239090805}, {230684831,239087476,230725042,239093285}, {231281882,239090805,231242965,239095917}, 
+    {230725042,239093285,230765264,239098259}, {231242965,239095917,231203853,239100303}, {230765264,239098259,230805480,239102408}, 
+    {231203853,239100303,231164562,239103954}, {230805480,239102408,230845674,239105738}, {231164562,239103954,231125108,239106864}, 
+    {230845674,239105738,230885831,239108260}, {231125108,239106864,231085506,239109022}, {230885831,239108260,230925935,239109981}, 
+    {231085506,239109022,231045771,239110421}, {230925935,239109981,230965971,239110909}, {231045771,239110421,231005921,239111053}, 
+    {230965971,239110909,231005921,239111053}, 
+};
+
+const Segment SEGMENTS_LEFT_CRUSH[] = {
+    {204570688,213502080,202152384,214887360}, {204570688,213502080,207965376,222674176}, {202152384,214887360,206462912,223624768}, 
+    {202225728,220137600,200531072,221295360}, {202225728,220137600,205785088,227691968}, {200531072,221295360,201818432,223959488}, 
+    {199255744,222168384,197648896,223290432}, {199255744,222168384,200508416,224885248}, {207965376,222674176,206462912,223624768}, 
+    {197648896,223290432,201243520,230861888}, {208255296,223883136,209009472,225485376}, {208255296,223883136,207028928,224642176}, 
+    {201818432,223959488,200508416,224885248}, {207028928,224642176,207853632,226248960}, {196397399,224799654,196470209,224800314}, 
+    {196397399,224799654,196321619,224801264}, {196470209,224800314,196505368,224801508}, {196321619,224801264,196243289,224805102}, 
+    {196505368,224801508,196539627,224803284}, {196539627,224803284,196572932,224805647}, {196243289,224805102,196162830,224811129}, 
+    {196572932,224805647,196605232,224808603}, {196605232,224808603,196636473,224812157}, {196162830,224811129,196080664,224819304}, 
+    {196636473,224812157,196666603,224816313}, {196666603,224816313,196695569,224821077}, {196080664,224819304,195997211,224829587}, 
+    {196695569,224821077,196723319,224826454}, {196723319,224826454,196749800,224832448}, {195997211,224829587,195912894,224841937}, 
+    {196749800,224832448,196762548,224835679}, {196762548,224835679,196774959,224839066}, {196774959,224839066,196787027,224842610}, 
+    {195912894,224841937,195828131,224856313}, {196787027,224842610,196798744,224846311}, {196798744,224846311,196810105,224850171}, 
+    {196810105,224850171,196821102,224854189}, {196821102,224854189,196831730,224858368}, {195828131,224856313,195743346,224872677}, 
+    {196831730,224858368,196841981,224862706}, {196841981,224862706,196851849,224867205}, {196851849,224867205,196861327,224871865}, 
+    {196861327,224871865,196870410,224876688}, {195743346,224872677,195658958,224890986}, {196870410,224876688,196879089,224881673}, 
+    {196879089,224881673,196883276,224884226}, {196883276,224884226,196887359,224886821}, {196887359,224886821,196891338,224889457}, 
+    {196891338,224889457,196895213,224892133}, {195658958,224890986,195575390,224911201}, {196895213,224892133,196898982,224894851}, 
+    {196898982,224894851,196902645,224897610}, {196902645,224897610,196906200,224900410}, {196906200,224900410,196909647,224903252}, 
+    {196909647,224903252,196912985,224906135}, {196912985,224906135,196916214,224909060}, {196916214,224909060,196919332,224912026}, 
+    {195575390,224911201,195493061,224933282}, {196919332,224912026,196922338,224915034}, {196922338,224915034,196925233,224918084}, 
+    {196925233,224918084,196928014,224921175}, {196928014,224921175,196930682,224924309}, {196930682,224924309,196933234,224927485}, 
+    {196933234,224927485,196935672,224930702}, {196935672,224930702,196937993,224933962}, {195493061,224933282,195412393,224957187}, 
+    {196937993,224933962,196940197,224937264}, {196940197,224937264,196942282,224940608}, {196942282,224940608,196944250,224943995}, 
+    {196944250,224943995,196946097,224947424}, {196946097,224947424,196947824,224950896}, {196947824,224950896,196949430,224954410}, 
+    {196949430,224954410,196950914,224957968}, {195412393,224957187,195333807,224982877}, {196950914,224957968,196952274,224961567}, 
+    {196952274,224961567,196953511,224965210}, {196953511,224965210,196954624,224968896}, {196954624,224968896,196941952,226406848}, 
+    {195333807,224982877,195257725,225010311}, {195257725,225010311,195184567,225039449}, {195184567,225039449,195149216,225054644}, 
+    {195149216,225054644,195114754,225070250}, {195114754,225070250,195081233,225086262}, {195081233,225086262,195048707,225102674}, 
+    {195048707,225102674,195017228,225119482}, {195017228,225119482,194986848,225136681}, {194986848,225136681,194957620,225154265}, 
+    {194957620,225154265,194929597,225172229}, {194929597,225172229,194902832,225190570}, {194902832,225190570,194877376,225209280}, 
+    {194877376,225209280,194814861,225257835}, {194814861,225257835,194752640,225308021}, {194752640,225308021,194690831,225359795}, 
+    {194690831,225359795,194629551,225413112}, {194629551,225413112,194568919,225467927}, {194568919,225467927,194509053,225524195}, 
+    {209009472,225485376,207853632,226248960}, {194509053,225524195,194450070,225581874}, {194450070,225581874,194392089,225640917}, 
+    {194392089,225640917,194335228,225701281}, {194335228,225701281,194279605,225762920}, {194279605,225762920,194225338,225825792}, 
+    {202694656,225799808,204143488,228866816}, {202694656,225799808,201419520,226690176}, {194225338,225825792,194172544,225889850}, 
+    {194172544,225889850,194121343,225955051}, {194121343,225955051,194071852,226021350}, {194071852,226021350,194024189,226088702}, 
+    {194024189,226088702,193978472,226157064}, {193978472,226157064,193934819,226226390}, {193934819,226226390,193893349,226296637}, 
+    {193893349,226296637,193854179,226367759}, {193854179,226367759,193817427,226439713}, {196941952,226406848,196884915,226416782}, 
+    {196884915,226416782,196825018,226425975}, {196825018,226425975,196697930,226442967}, {193817427,226439713,193783211,226512454}, 
+    {196697930,226442967,196423571,226477198}, {196423571,226477198,196281441,226497761}, {196281441,226497761,196210262,226509631}, 
+    {196210262,226509631,196139437,226522838}, {193783211,226512454,193767091,226549105}, {196139437,226522838,196069285,226537589}, 
+    {196069285,226537589,196000129,226554091}, {193767091,226549105,193751650,226585936}, {196000129,226554091,195932290,226572554}, 
+    {195932290,226572554,195898964,226582585}, {195898964,226582585,195866088,226593184}, {193751650,226585936,193736902,226622942}, 
+    {195866088,226593184,195833702,226604377}, {195833702,226604377,195801846,226616189}, {195801846,226616189,195770560,226628648}, 
+    {193736902,226622942,193722861,226660117}, {195770560,226628648,195739884,226641778}, {195739884,226641778,195709858,226655605}, 
+    {195709858,226655605,195680524,226670157}, {193722861,226660117,193709543,226697455}, {195680524,226670157,195651920,226685458}, 
+    {195651920,226685458,195624086,226701534}, {201419520,226690176,202868672,229792640}, {193709543,226697455,193696963,226734951}, 
+    {195624086,226701534,195610471,226709872}, {195610471,226709872,195597064,226718412}, {195597064,226718412,195583870,226727160}, 
+    {195583870,226727160,195570893,226736118}, {193696963,226734951,193685135,226772599}, {195570893,226736118,195558140,226745290}, 
+    {195558140,226745290,195545614,226754678}, {195545614,226754678,195533321,226764285}, {195533321,226764285,195521266,226774116}, 
+    {193685135,226772599,193674073,226810394}, {195521266,226774116,195509454,226784174}, {195509454,226784174,195497890,226794461}, 
+    {195497890,226794461,195486579,226804980}, {195486579,226804980,195475526,226815736}, {193674073,226810394,193663794,226848330}, 
+    {195475526,226815736,195464735,226826732}, {195464735,226826732,195454213,226837969}, {195454213,226837969,195443964,226849453}, 
+    {193663794,226848330,193654310,226886401}, {195443964,226849453,195433993,226861186}, {195433993,226861186,195424305,226873171}, 
+    {195424305,226873171,195414905,226885412}, {195414905,226885412,195405798,226897911}, {193654310,226886401,193645638,226924603}, 
+    {195405798,226897911,195396990,226910673}, {195396990,226910673,195388484,226923700}, {195388484,226923700,195380287,226936996}, 
+    {193645638,226924603,193637792,226962929}, {195380287,226936996,195372403,226950563}, {195372403,226950563,195364837,226964405}, 
+    {193637792,226962929,193630786,227001373}, {195364837,226964405,195357595,226978526}, {195357595,226978526,195350680,226992928}, 
+    {195350680,226992928,195344099,227007616}, {193630786,227001373,193624636,227039931}, {195344099,227007616,195337857,227022591}, 
+    {195337857,227022591,195331957,227037857}, {195331957,227037857,195326406,227053418}, {193624636,227039931,193619356,227078597}, 
+    {195326406,227053418,195321208,227069277}, {195321208,227069277,195316369,227085437}, {193619356,227078597,193614961,227117365}, 
+    {195316369,227085437,195311893,227101901}, {195311893,227101901,195307786,227118672}, {193614961,227117365,193611465,227156230}, 
+    {195307786,227118672,195304052,227135755}, {195304052,227135755,195300696,227153151}, {195300696,227153151,195297724,227170865}, 
+    {193611465,227156230,193608884,227195186}, {195297724,227170865,195295140,227188899}, {195295140,227188899,195292950,227207257}, 
+    {193608884,227195186,193607233,227234227}, {195292950,227207257,195291159,227225942}, {195291159,227225942,195289771,227244957}, 
+    {193607233,227234227,193606525,227273348}, {195289771,227244957,195288791,227264306}, {195288791,227264306,195288225,227283992}, 
+    {193606525,227273348,193606776,227312544}, {195288225,227283992,195288078,227304017}, {195288078,227304017,195288355,227324386}, 
+    {193606776,227312544,193608000,227351808}, {195288355,227324386,195289060,227345101}, {195289060,227345101,195290199,227366166}, 
+    {193608000,227351808,193611443,227417456}, {195290199,227366166,195291776,227387584}, {195291776,227387584,195292478,227395035}, 
+    {195292478,227395035,195293340,227402433}, {195293340,227402433,195294359,227409780}, {195294359,227409780,195295535,227417076}, 
+    {191810752,227412800,190111552,228627904}, {191810752,227412800,194608704,233372864}, {195295535,227417076,195296867,227424320}, 
+    {193611443,227417456,193616016,227482278}, {195296867,227424320,195298354,227431514}, {195298354,227431514,195299995,227438657}, 
+    {195299995,227438657,195301789,227445750}, {195301789,227445750,195303734,227452792}, {195303734,227452792,195305831,227459785}, 
+    {195305831,227459785,195308077,227466728}, {195308077,227466728,195310472,227473622}, {195310472,227473622,195313015,227480467}, 
+    {195313015,227480467,195315704,227487264}, {193616016,227482278,193621702,227546274}, {195315704,227487264,195318540,227494012}, 
+    {195318540,227494012,195321520,227500712}, {195321520,227500712,195324643,227507364}, {195324643,227507364,195327910,227513968}, 
+    {195327910,227513968,195331318,227520526}, {195331318,227520526,195334867,227527036}, {195334867,227527036,195338555,227533499}, 
+    {195338555,227533499,195342382,227539916}, {195342382,227539916,195346347,227546287}, {193621702,227546274,193628488,227609440}, 
+    {195346347,227546287,195350448,227552612}, {195350448,227552612,195354684,227558891}, {195354684,227558891,195359056,227565124}, 
+    {195359056,227565124,195363561,227571313}, {195363561,227571313,195368198,227577457}, {195368198,227577457,195377866,227589611}, 
+    {195377866,227589611,195388052,227601589}, {195388052,227601589,195398748,227613394}, {193628488,227609440,193636358,227671776}, 
+    {195398748,227613394,195409946,227625027}, {195409946,227625027,195421636,227636490}, {195421636,227636490,195433813,227647786}, 
+    {195433813,227647786,195446466,227658917}, {195446466,227658917,195459588,227669885}, {195459588,227669885,195473172,227680693}, 
+    {193636358,227671776,193645298,227733279}, {195473172,227680693,195487208,227691342}, {195487208,227691342,195501688,227701835}, 
+    {205785088,227691968,204143488,228866816}, {195501688,227701835,195516606,227712174}, {195516606,227712174,195531951,227722361}, 
+    {195531951,227722361,195547717,227732398}, {195547717,227732398,195563895,227742288}, {193645298,227733279,193655292,227793948}, 
+    {195563895,227742288,195580476,227752033}, {195580476,227752033,195614819,227771095}, {195614819,227771095,195650680,227789603}, 
+    {195650680,227789603,195687993,227807573}, {193655292,227793948,193666327,227853781}, {195687993,227807573,195726695,227825024}, 
+    {195726695,227825024,195766719,227841974}, {195766719,227841974,195808001,227858439}, {193666327,227853781,193678386,227912777}, 
+    {195808001,227858439,195850476,227874437}, {195850476,227874437,195938742,227905103}, {195938742,227905103,196030997,227934114}, 
+    {193678386,227912777,193691455,227970932}, {196030997,227934114,196126721,227961609}, {196126721,227961609,196225391,227987729}, 
+    {193691455,227970932,193705519,228028246}, {196225391,227987729,196326488,228012616}, {196326488,228012616,196533878,228059250}, 
+    {193705519,228028246,193720564,228084718}, {196533878,228059250,196744723,228102636}, {193720564,228084718,193736574,228140344}, 
+    {196744723,228102636,197160113,228184165}, {193736574,228140344,193753535,228195123}, {197160113,228184165,197356324,228224559}, 
+    {193753535,228195123,193771432,228249054}, {197356324,228224559,197539325,228266206}, {193771432,228249054,193790249,228302135}, 
+    {197539325,228266206,197624568,228287851}, {197624568,228287851,197704947,228310231}, {193790249,228302135,193809972,228354364}, 
+    {197704947,228310231,197779939,228333487}, {197779939,228333487,197815252,228345488}, {197815252,228345488,197849024,228357760}, 
+    {193809972,228354364,193830587,228405739}, {197849024,228357760,197923981,228386909}, {197923981,228386909,197997675,228417443}, 
+    {193830587,228405739,193852078,228456258}, {197997675,228417443,198070086,228449424}, {198070086,228449424,198141194,228482911}, 
+    {193852078,228456258,193874430,228505920}, {198141194,228482911,198210981,228517965}, {193874430,228505920,193897629,228554723}, 
+    {198210981,228517965,198279426,228554647}, {198279426,228554647,198346509,228593017}, {193897629,228554723,193921660,228602665}, 
+    {198346509,228593017,198412211,228633135}, {193921660,228602665,193946507,228649744}, {190111552,228627904,192583744,234023296}, 
+    {198412211,228633135,198476512,228675062}, {193946507,228649744,193972157,228695959}, {198476512,228675062,198539394,228718859}, 
+    {193972157,228695959,193998593,228741308}, {198539394,228718859,198600835,228764585}, {193998593,228741308,194025802,228785788}, 
+    {198600835,228764585,198660816,228812302}, {194025802,228785788,194053768,228829399}, {198660816,228812302,198719318,228862069}, 
+    {194053768,228829399,194082477,228872138}, {198719318,228862069,198776321,228913948}, {194082477,228872138,194111914,228914004}, 
+    {198776321,228913948,198831806,228967998}, {194111914,228914004,194142063,228954995}, {194142063,228954995,194172910,228995109}, 
+    {198831806,228967998,198885752,229024280}, {194172910,228995109,194204440,229034344}, {198885752,229024280,198938140,229082855}, 
+    {194204440,229034344,194236638,229072699}, {194236638,229072699,194269490,229110171}, {198938140,229082855,198988951,229143783}, 
+    {194269490,229110171,194302980,229146760}, {198988951,229143783,199038164,229207124}, {194302980,229146760,194337094,229182462}, 
+    {194337094,229182462,194371817,229217278}, {199038164,229207124,199085761,229272939}, {194371817,229217278,194407133,229251203}, 
+    {194407133,229251203,194443029,229284238}, {199085761,229272939,199131721,229341289}, {194443029,229284238,194479488,229316380}, 
+    {194479488,229316380,194516497,229347627}, {199131721,229341289,199176025,229412234}, {194516497,229347627,194554040,229377978}, 
+    {194554040,229377978,194592103,229407430}, {194592103,229407430,194630671,229435983}, {199176025,229412234,199218653,229485833}, 
+    {194630671,229435983,194669728,229463633}, {194669728,229463633,194709261,229490380}, {199218653,229485833,199259585,229562149}, 
+    {194709261,229490380,194749253,229516222}, {188820224,229511936,187204928,230637504}, {188820224,229511936,191374208,234712320}, 
+    {194749253,229516222,194789691,229541157}, {194789691,229541157,194830559,229565183}, {199259585,229562149,199298802,229641241}, 
+    {194830559,229565183,194871843,229588298}, {194871843,229588298,194913527,229610501}, {194913527,229610501,194955597,229631789}, 
+    {194955597,229631789,194998038,229652162}, {199298802,229641241,199336285,229723169}, {194998038,229652162,195040835,229671617}, 
+    {195040835,229671617,195083974,229690152}, {195083974,229690152,195127438,229707766}, {195127438,229707766,195171214,229724456}, 
+    {199336285,229723169,199372013,229807995}, {195171214,229724456,195215287,229740222}, {195215287,229740222,195259642,229755062}, 
+    {195259642,229755062,195304263,229768972}, {195304263,229768972,195349136,229781953}, {195349136,229781953,195394247,229794002}, 
+    {202868672,229792640,201243520,230861888}, {195394247,229794002,195439580,229805117}, {195439580,229805117,195485120,229815296}, 
+    {199372013,229807995,199405967,229895778}, {195485120,229815296,195821581,229889881}, {195821581,229889881,195996804,229932647}, 
+    {199405967,229895778,199438127,229986579}, {195996804,229932647,196172855,229979868}, {196172855,229979868,196346856,230032148}, 
+    {199438127,229986579,199468473,230080459}, {196346856,230032148,196432189,230060375}, {196432189,230060375,196515932,230090093}, 
+    {199468473,230080459,199496987,230177478}, {196515932,230090093,196597723,230121378}, {196597723,230121378,196677205,230154306}, 
+    {196677205,230154306,196754017,230188952}, {199496987,230177478,199523648,230277696}, {196754017,230188952,196791310,230206943}, 
+    {196791310,230206943,196827800,230225392}, {196827800,230225392,196863443,230244308}, {196863443,230244308,196898194,230263701}, 
+    {196898194,230263701,196932008,230283581}, {199523648,230277696,199535906,230328891}, {196932008,230283581,196964840,230303956}, 
+    {196964840,230303956,196996645,230324836}, {196996645,230324836,197027378,230346230}, {199535906,230328891,199546771,230379882}, 
+    {197027378,230346230,197056995,230368149}, {197056995,230368149,197085449,230390601}, {199546771,230379882,199556259,230430666}, 
+    {197085449,230390601,197112697,230413596}, {197112697,230413596,197125855,230425300}, {197125855,230425300,197138693,230437143}, 
+    {199556259,230430666,199564385,230481240}, {197138693,230437143,197151208,230449127}, {197151208,230449127,197163393,230461253}, 
+    {197163393,230461253,197175243,230473521}, {197175243,230473521,197186751,230485933}, {199564385,230481240,199571166,230531602}, 
+    {197186751,230485933,197197913,230498490}, {197197913,230498490,197208723,230511194}, {197208723,230511194,197219174,230524045}, 
+    {197219174,230524045,197229263,230537045}, {199571166,230531602,199576618,230581749}, {197229263,230537045,197238982,230550195}, 
+    {197238982,230550195,197248327,230563496}, {197248327,230563496,197257291,230576949}, {197257291,230576949,197265869,230590556}, 
+    {199576618,230581749,199580755,230631680}, {197265869,230590556,197274056,230604317}, {197274056,230604317,197281845,230618234}, 
+    {197281845,230618234,197289232,230632308}, {199580755,230631680,199583595,230681392}, {197289232,230632308,197296210,230646541}, 
+    {187204928,230637504,189723328,236131136}, {197296210,230646541,197302774,230660932}, {197302774,230660932,197308919,230675484}, 
+    {197308919,230675484,197314638,230690198}, {199583595,230681392,199585152,230730882}, {197314638,230690198,197319927,230705074}, 
+    {197319927,230705074,197324779,230720115}, {197324779,230720115,197329189,230735321}, {199585152,230730882,199585444,230780147}, 
+    {197329189,230735321,197333151,230750694}, {197333151,230750694,197336659,230766233}, {197336659,230766233,197339709,230781942}, 
+    {199585444,230780147,199584485,230829187}, {197339709,230781942,197342294,230797821}, {197342294,230797821,197344409,230813871}, 
+    {197344409,230813871,197346048,230830093}, {199584485,230829187,199582292,230877997}, {197346048,230830093,197347206,230846489}, 
+    {197347206,230846489,197347876,230863059}, {197347876,230863059,197348054,230879805}, {199582292,230877997,199578880,230926576}, 
+    {197348054,230879805,197347734,230896729}, {197347734,230896729,197346909,230913830}, {197346909,230913830,197345576,230931111}, 
+    {199578880,230926576,199574265,230974921}, {197345576,230931111,197343726,230948573}, {197343726,230948573,197341357,230966216}, 
+    {197341357,230966216,197338460,230984042}, {199574265,230974921,199568463,231023030}, {197338460,230984042,197335032,231002053}, 
+    {197335032,231002053,197331066,231020248}, {197331066,231020248,197326557,231038631}, {199568463,231023030,199561491,231070901}, 
+    {197326557,231038631,197321499,231057200}, {197321499,231057200,197315887,231075959}, {199561491,231070901,199553363,231118531}, 
+    {197315887,231075959,197309714,231094908}, {197309714,231094908,197302976,231114048}, {197302976,231114048,197293952,231137556}, 
+    {199553363,231118531,199544097,231165917}, {197293952,231137556,197284270,231160509}, {197284270,231160509,197273938,231182911}, 
+    {199544097,231165917,199533706,231213057}, {197273938,231182911,197262967,231204766}, {197262967,231204766,197251366,231226079}, 
+    {199533706,231213057,199522209,231259949}, {197251366,231226079,197239144,231246853}, {197239144,231246853,197226312,231267093}, 
+    {199522209,231259949,199509619,231306590}, {197226312,231267093,197212878,231286802}, {197212878,231286802,197198854,231305986}, 
+    {197198854,231305986,197184247,231324647}, {199509619,231306590,199495954,231352978}, {197184247,231324647,197169068,231342791}, 
+    {197169068,231342791,197153326,231360421}, {199495954,231352978,199481229,231399111}, {197153326,231360421,197137031,231377542}, 
+    {197137031,231377542,197120192,231394157}, {197120192,231394157,197102820,231410271}, {199481229,231399111,199465460,231444986}, 
+    {197102820,231410271,197084924,231425888}, {197084924,231425888,197066513,231441012}, {197066513,231441012,197047597,231455647}, 
+    {199465460,231444986,199448662,231490600}, {197047597,231455647,197028186,231469798}, {197028186,231469798,197008289,231483468}, 
+    {197008289,231483468,196987916,231496661}, {199448662,231490600,199430853,231535952}, {196987916,231496661,196967076,231509383}, 
+    {196967076,231509383,196945779,231521636}, {196945779,231521636,196924036,231533426}, {196924036,231533426,196901854,231544755}, 
+    {199430853,231535952,199412046,231581038}, {196901854,231544755,196879244,231555629}, {196879244,231555629,196856216,231566051}, 
+    {196856216,231566051,196832779,231576027}, {196832779,231576027,196808943,231585558}, {199412046,231581038,199392260,231625857}, 
+    {196808943,231585558,196784718,231594651}, {196784718,231594651,196760112,231603309}, {196760112,231603309,196735136,231611536}, 
+    {196735136,231611536,196709799,231619336}, {196709799,231619336,196684111,231626714}, {199392260,231625857,199371508,231670406}, 
+    {196684111,231626714,196658082,231633674}, {196658082,231633674,196631721,231640219}, {196631721,231640219,196578041,231652083}, 
+    {196578041,231652083,196523148,231662340}, {196523148,231662340,196467121,231671024}, {199371508,231670406,199349808,231714682}, 
+    {196467121,231671024,196410035,231678166}, {195797888,231672128,195937216,233579904}, {195797888,231672128,195861327,231678572}, 
+    {196410035,231678166,196351968,231683800}, {195861327,231678572,195924477,231683807}, {196351968,231683800,196292996,231687960}, 
+    {195924477,231683807,195987261,231687799}, {195987261,231687799,196049602,231690516}, {196292996,231687960,196233197,231690678}, 
+    {196049602,231690516,196111422,231691923}, {196233197,231690678,196172646,231691988}, {196111422,231691923,196172646,231691988}, 
+    {199349808,231714682,199327174,231758684}, {199327174,231758684,199303624,231802408}, {199303624,231802408,199279172,231845852}, 
+    {199279172,231845852,199253835,231889015}, {199253835,231889015,199227628,231931893}, {199227628,231931893,199200568,231974484}, 
+    {199200568,231974484,199143950,232058795}, {199143950,232058795,199084107,232141929}, {199084107,232141929,199021168,232223867}, 
+    {199021168,232223867,198955257,232304590}, {198955257,232304590,198886503,232384078}, {198886503,232384078,198815033,232462311}, 
+    {198815033,232462311,198740973,232539271}, {198740973,232539271,198664450,232614938}, {185281684,232557387,185336104,232558343}, 
+    {185281684,232557387,185226847,232557879}, {185226847,232557879,185171603,232559836}, {185336104,232558343,185390099,232560729}, 
+    {185171603,232559836,185115959,232563276}, {185390099,232560729,185443659,232564529}, {185115959,232563276,185059924,232568217}, 
+    {185443659,232564529,185496776,232569725}, {185059924,232568217,185003508,232574675}, {185496776,232569725,185549441,232576298}, 
+    {185003508,232574675,184946719,232582668}, {185549441,232576298,185601645,232584233}, {184946719,232582668,184889566,232592213}, 
+    {185601645,232584233,185653380,232593511}, {184889566,232592213,184832058,232603329}, {185653380,232593511,185704636,232604115}, 
+    {184832058,232603329,184774203,232616032}, {185704636,232604115,185755406,232616028}, {198664450,232614938,198585592,232689292}, 
+    {185755406,232616028,185805679,232629233}, {184774203,232616032,184716011,232630339}, {185805679,232629233,185855448,232643711}, 
+    {184716011,232630339,184657489,232646269}, {185855448,232643711,185904703,232659445}, {184657489,232646269,184598648,232663838}, 
+    {185904703,232659445,185953436,232676418}, {184598648,232663838,184539495,232683064}, {185953436,232676418,186001638,232694613}, 
+    {184539495,232683064,184480040,232703965}, {198585592,232689292,198504524,232762315}, {186001638,232694613,186049300,232714012}, 
+    {184480040,232703965,184420291,232726557}, {186049300,232714012,186096414,232734598}, {184420291,232726557,184360256,232750859}, 
+    {186096414,232734598,186142970,232756354}, {184360256,232750859,184299946,232776887}, {186142970,232756354,186188960,232779261}, 
+    {198504524,232762315,198421375,232833987}, {184299946,232776887,184239369,232804659}, {186188960,232779261,186234375,232803302}, 
+    {186234375,232803302,186279207,232828461}, {184239369,232804659,184178532,232834193}, {186279207,232828461,186323445,232854720}, 
+    {198421375,232833987,198336270,232904289}, {184178532,232834193,184117446,232865505}, {186323445,232854720,186367083,232882060}, 
+    {184117446,232865505,184056119,232898614}, {186367083,232882060,186410110,232910466}, {184056119,232898614,183994560,232933536}, 
+    {198336270,232904289,198249338,232973201}, {186410110,232910466,186452519,232939919}, {183994560,232933536,183932777,232970290}, 
+    {186452519,232939919,186494299,232970402}, {183932777,232970290,183870780,233008892}, {186494299,232970402,186535443,233001897}, 
+    {198249338,232973201,198160704,233040704}, {186535443,233001897,186575942,233034388}, {183870780,233008892,183808576,233049360}, 
+    {186575942,233034388,186615787,233067857}, {198160704,233040704,198101241,233084093}, {183808576,233049360,183746176,233091712}, 
+    {186615787,233067857,186654969,233102286}, {198101241,233084093,198042947,233124600}, {183746176,233091712,181649024,234544640}, 
+    {186654969,233102286,186693479,233137657}, {198042947,233124600,197985640,233162344}, {186693479,233137657,186731309,233173955}, 
+    {197985640,233162344,197929139,233197441}, {186731309,233173955,186768450,233211160}, {197929139,233197441,197873262,233230007}, 
+    {186768450,233211160,186804892,233249256}, {197873262,233230007,197817827,233260160}, {186804892,233249256,186840628,233288226}, 
+    {197817827,233260160,197762654,233288016}, {197762654,233288016,197707561,233313693}, {186840628,233288226,186875649,233328051}, 
+    {197707561,233313693,197652366,233337307}, {186875649,233328051,186909944,233368715}, {197652366,233337307,197596887,233358975}, 
+    {197596887,233358975,197540943,233378814}, {186909944,233368715,186943507,233410200}, {194608704,233372864,194632876,233426346}, 
+    {197540943,233378814,197484353,233396941}, {197484353,233396941,197426935,233413472}, {186943507,233410200,186976328,233452488}, 
+    {197426935,233413472,197368507,233428526}, {194632876,233426346,194655259,233479972}, {197368507,233428526,197308888,233442217}, 
+    {197308888,233442217,197247896,233454664}, {186976328,233452488,187008398,233495563}, {197247896,233454664,197185350,233465983}, 
+    {197185350,233465983,197121069,233476291}, {197121069,233476291,196986572,233494342}, {194655259,233479972,194675870,233533729}, 
+    {196986572,233494342,196842954,233509752}, {187008398,233495563,187039709,233539406}, {196842954,233509752,196688763,233523455}, 
+    {196688763,233523455,195937216,233579904}, {194675870,233533729,194694724,233587606}, {187039709,233539406,187070251,233584001}, 
+    {187070251,233584001,187100016,233629329}, {194694724,233587606,194711837,233641592}, {187100016,233629329,187128995,233675375}, 
+    {194711837,233641592,194727225,233695673}, {187128995,233675375,187157180,233722119}, {194727225,233695673,194740903,233749839}, 
+    {187157180,233722119,187184561,233769545}, {194740903,233749839,194752888,233804077}, {187184561,233769545,187211129,233817635}, 
+    {194752888,233804077,194763194,233858375}, {187211129,233817635,187236877,233866372}, {194763194,233858375,194771837,233912721}, 
+    {187236877,233866372,187261795,233915739}, {194771837,233912721,194778834,233967104}, {187261795,233915739,187285874,233965718}, 
+    {187285874,233965718,187309106,234016291}, {194778834,233967104,194784200,234021512}, {187309106,234016291,187331482,234067442}, 
+    {194784200,234021512,194787951,234075931}, {192583744,234023296,192606081,234073879}, {187331482,234067442,187352993,234119152}, 
+    {192606081,234073879,192625750,234122242}, {194787951,234075931,194790102,234130352}, {187352993,234119152,187373630,234171405}, 
+    {192625750,234122242,192642822,234168464}, {194790102,234130352,194790669,234184761}, {192642822,234168464,192650406,234190798}, 
+    {187373630,234171405,187393384,234224183}, {194790669,234184761,194789668,234239147}, {192650406,234190798,192657366,234212626}, 
+    {192657366,234212626,192663712,234233959}, {187393384,234224183,187412247,234277468}, {192663712,234233959,192669452,234254806}, 
+    {194789668,234239147,194787115,234293498}, {192669452,234254806,192674596,234275179}, {192674596,234275179,192679151,234295086}, 
+    {187412247,234277468,187430210,234331243}, {194787115,234293498,194783025,234347801}, {192679151,234295086,192683126,234314538}, 
+    {192683126,234314538,192686531,234333545}, {187430210,234331243,187447264,234385491}, {192686531,234333545,192689374,234352116}, 
+    {194783025,234347801,194777414,234402046}, {192689374,234352116,192691664,234370262}, {192691664,234370262,192693409,234387993}, 
+    {187447264,234385491,187463400,234440195}, {192693409,234387993,192694619,234405318}, {185013847,234398130,184994297,234398273}, 
+    {185013847,234398130,185033440,234398567}, {184994297,234398273,184974806,234399001}, {185033440,234398567,185053061,234399579}, 
+    {184974806,234399001,184955390,234400319}, {185053061,234399579,185072695,234401161}, {184955390,234400319,184936065,234402233}, 
+    {185072695,234401161,185092326,234403308}, {194777414,234402046,194770297,234456220}, {184936065,234402233,184916845,234404746}, 
+    {185092326,234403308,185111938,234406015}, {184916845,234404746,184897746,234407864}, {192694619,234405318,192695301,234422248}, 
+    {185111938,234406015,185131516,234409277}, {184897746,234407864,184878783,234411592}, {185131516,234409277,185151044,234413089}, 
+    {184878783,234411592,184859973,234415935}, {185151044,234413089,185170508,234417447}, {184859973,234415935,184841331,234420898}, 
+    {185170508,234417447,185189891,234422344}, {184841331,234420898,184822872,234426486}, {192695301,234422248,192695465,234438792}, 
+    {185189891,234422344,185209177,234427777}, {184822872,234426486,184804612,234432704}, {185209177,234427777,185228352,234433740}, 
+    {184804612,234432704,184795561,234436051}, {185228352,234433740,185247400,234440227}, {184795561,234436051,184786566,234439557}, 
+    {192695465,234438792,192695120,234454961}, {184786566,234439557,184777629,234443223}, {187463400,234440195,187478610,234495336}, 
+    {185247400,234440227,185266305,234447235}, {184777629,234443223,184768750,234447050}, {184768750,234447050,184759933,234451038}, 
+    {185266305,234447235,185285051,234454759}, {184759933,234451038,184751180,234455187}, {185285051,234454759,185303624,234462792}, 
+    {192695120,234454961,192694274,234470765}, {184751180,234455187,184742492,234459500}, {194770297,234456220,194761692,234510310}, 
+    {184742492,234459500,184733870,234463975}, {185303624,234462792,185322007,234471331}, {184733870,234463975,184725318,234468614}, 
+    {184725318,234468614,184716837,234473418}, {192694274,234470765,192692936,234486213}, {185322007,234471331,185340186,234480369}, 
+    {184716837,234473418,184708429,234478386}, {184708429,234478386,184700096,234483520}, {185340186,234480369,185358144,234489903}, 
+    {184700096,234483520,183989632,234930176}, {192692936,234486213,192691114,234501315}, {185358144,234489903,185375867,234499927}, 
+    {187478610,234495336,187492885,234550898}, {185375867,234499927,185393338,234510436}, {192691114,234501315,192688818,234516082}, 
+    {194761692,234510310,194751612,234564306}, {185393338,234510436,185410542,234521426}, {192688818,234516082,192687495,234523343}, 
+    {185410542,234521426,185427463,234532891}, {192687495,234523343,192686056,234530524}, {192686056,234530524,192684503,234537626}, 
+    {185427463,234532891,185444087,234544826}, {192684503,234537626,192682837,234544650}, {181649024,234544640,185219648,242169472}, 
+    {192682837,234544650,192681059,234551598}, {185444087,234544826,185460397,234557226}, {187492885,234550898,187506215,234606863}, 
+    {192681059,234551598,192679170,234558470}, {185460397,234557226,185476377,234570086}, {192679170,234558470,192677171,234565269}, 
+    {194751612,234564306,194740074,234618195}, {192677171,234565269,192675063,234571995}, {185476377,234570086,185492014,234583402}, 
+    {192675063,234571995,192672847,234578650}, {192672847,234578650,192670525,234585234}, {185492014,234583402,185507290,234597168}, 
+    {192670525,234585234,192668097,234591750}, {192668097,234591750,192665565,234598198}, {185507290,234597168,185522190,234611379}, 
+    {192665565,234598198,192662930,234604580}, {192662930,234604580,192660192,234610896}, {187506215,234606863,187518592,234663213}, 
+    {192660192,234610896,192654414,234623338}, {185522190,234611379,185536700,234626031}, {194740074,234618195,194727094,234671966}, 
+    {192654414,234623338,192648240,234635535}, {185536700,234626031,185550803,234641118}, {192648240,234635535,192641680,234647496}, 
+    {185550803,234641118,185564483,234656635}, {192641680,234647496,192634740,234659231}, {185564483,234656635,185577726,234672578}, 
+    {192634740,234659231,192627431,234670751}, {187518592,234663213,187530008,234719932}, {192627431,234670751,192619761,234682065}, 
+    {194727094,234671966,194712688,234725605}, {185577726,234672578,185590515,234688940}, {192619761,234682065,192611739,234693183}, 
+    {185590515,234688940,185602836,234705719}, {192611739,234693183,192603374,234704115}, {192603374,234704115,192594674,234714871}, 
+    {185602836,234705719,185614672,234722907}, {191374208,234712320,191385136,234733775}, {192594674,234714871,192585648,234725462}, 
+    {187530008,234719932,187540454,234777002}, {185614672,234722907,185626009,234740501}, {192585648,234725462,192576304,234735897}, 
+    {194712688,234725605,194696870,234779103}, {191385136,234733775,191396426,234754436}, {192576304,234735897,192566653,234746185}, 
+    {185626009,234740501,185636830,234758495}, {192566653,234746185,192556701,234756338}, {191396426,234754436,191408066,234774315}, 
+    {192556701,234756338,192546459,234766366}, {185636830,234758495,185647120,234776885}, {192546459,234766366,192535934,234776277}, 
+    {191408066,234774315,191420045,234793422}, {192535934,234776277,192525136,234786082}, {185647120,234776885,185656864,234795665}, 
+    {187540454,234777002,187549920,234834405}, {194696870,234779103,194679658,234832445}, {192525136,234786082,192502754,234805415}, 
+    {191420045,234793422,191432351,234811768}, {185656864,234795665,185666046,234814830}, {192502754,234805415,192479383,234824443}, 
+    {191432351,234811768,191444973,234829364}, {185666046,234814830,185674650,234834376}, {192479383,234824443,192455093,234843248}, 
+    {191444973,234829364,191457900,234846221}, {194679658,234832445,194661065,234885622}, {185674650,234834376,185682662,234854297}, 
+    {187549920,234834405,187558398,234892124}, {192455093,234843248,192429954,234861908}, {191457900,234846221,191471119,234862349}, 
+    {185682662,234854297,185690064,234874589}, {192429954,234861908,192377408,234899116}, {191471119,234862349,191484619,234877760}, 
+    {185690064,234874589,185696843,234895246}, {191484619,234877760,191498389,234892464}, {194661065,234885622,194641109,234938620}, 
+    {187558398,234892124,187565880,234950141}, {191498389,234892464,191512417,234906471}, {185696843,234895246,185702982,234916264}, 
+    {192377408,234899116,192322304,234936704}, {191512417,234906471,191526691,234919794}, {185702982,234916264,185708467,234937637}, 
+    {191526691,234919794,191541201,234932442}, {183989632,234930176,184684800,236384960}, {191541201,234932442,191555933,234944427}, 
+    {192322304,234936704,192311119,234944104}, {185708467,234937637,185713280,234959360}, {194641109,234938620,194619805,234991427}, 
+    {192311119,234944104,192299581,234951382}, {191555933,234944427,191570878,234955759}, {187565880,234950141,187572355,235008440}, 
+    {192299581,234951382,192287700,234958526}, {191570878,234955759,191586023,234966449}, {192287700,234958526,192275488,234965526}, 
+    {185713280,234959360,185719406,234991737}, {192275488,234965526,192262958,234972371}, {191586023,234966449,191601357,234976508}, 
+    {192262958,234972371,192250119,234979049}, {191601357,234976508,191616868,234985947}, {192250119,234979049,192236985,234985551}, 
+    {192236985,234985551,192223566,234991866}, {191616868,234985947,191632545,234994776}, {194619805,234991427,194597169,235044033}, 
+    {185719406,234991737,185724465,235023577}, {192223566,234991866,192209874,234997982}, {191632545,234994776,191648375,235003006}, 
+    {192209874,234997982,192195921,235003889}, {191648375,235003006,191664349,235010649}, {192195921,235003889,192181718,235009576}, 
+    {187572355,235008440,187577817,235067002}, {192181718,235009576,192167276,235015032}, {191664349,235010649,191680453,235017715}, 
+    {192167276,235015032,192152608,235020246}, {191680453,235017715,191696678,235024214}, {192152608,235020246,192137724,235025208}, 
+    {185724465,235023577,185728475,235054891}, {191696678,235024214,191713010,235030158}, {192137724,235025208,192122637,235029907}, 
+    {192122637,235029907,192107357,235034331}, {191713010,235030158,191729438,235035558}, {192107357,235034331,192091897,235038471}, 
+    {191729438,235035558,191745952,235040424}, {192091897,235038471,192076268,235042314}, {191745952,235040424,191762538,235044767}, 
+    {192076268,235042314,192060481,235045852}, {194597169,235044033,194573216,235096424}, {191762538,235044767,191779187,235048597}, 
+    {192060481,235045852,192044548,235049071}, {191779187,235048597,191795886,235051927}, {192044548,235049071,192028481,235051963}, 
+    {191795886,235051927,191812623,235054766}, {192028481,235051963,192012290,235054516}, {192012290,235054516,191995989,235056718}, 
+    {191812623,235054766,191829388,235057125}, {185728475,235054891,185731451,235085689}, {191995989,235056718,191979587,235058561}, 
+    {191829388,235057125,191846168,235059016}, {191979587,235058561,191963098,235060031}, {191846168,235059016,191862952,235060449}, 
+    {191963098,235060031,191946531,235061120}, {191862952,235060449,191879729,235061434}, {191946531,235061120,191929900,235061815}, 
+    {191879729,235061434,191896487,235061983}, {191929900,235061815,191913214,235062106}, {191896487,235061983,191913214,235062106}, 
+    {187577817,235067002,187582255,235125811}, {185731451,235085689,185733414,235115981}, {194573216,235096424,194547962,235148589}, 
+    {185733414,235115981,185734378,235145779}, {187582255,235125811,187585661,235184849}, {185734378,235145779,185734364,235175092}, 
+    {194547962,235148589,194521423,235200516}, {185734364,235175092,185733387,235203930}, {187585661,235184849,187588027,235244098}, 
+    {194521423,235200516,194493615,235252194}, {185733387,235203930,185731465,235232306}, {185731465,235232306,185728617,235260228}, 
+    {187588027,235244098,187589343,235303541}, {194493615,235252194,194464553,235303609}, {185728617,235260228,185724859,235287707}, 
+    {185724859,235287707,185720210,235314754}, {187589343,235303541,187589600,235363161}, {194464553,235303609,194434253,235354751}, 
+    {185720210,235314754,185714686,235341379}, {185714686,235341379,185708305,235367593}, {194434253,235354751,194402730,235405607}, 
+    {187589600,235363161,187588791,235422940}, {185708305,235367593,185701085,235393406}, {185701085,235393406,185693043,235418828}, 
+    {194402730,235405607,194370001,235456165}, {185693043,235418828,185684197,235443871}, {187588791,235422940,187586906,235482861}, 
+    {185684197,235443871,185674565,235468544}, {194370001,235456165,194336082,235506413}, {185674565,235468544,185664163,235492857}, 
+    {187586906,235482861,187583936,235542906}, {185664163,235492857,185653011,235516823}, {194336082,235506413,194300987,235556340}, 
+    {185653011,235516823,185641124,235540450}, {185641124,235540450,185628521,235563750}, {187583936,235542906,187579872,235603059}, 
+    {194300987,235556340,194264732,235605934}, {185628521,235563750,185615219,235586732}, {185615219,235586732,185601236,235609408}, 
+    {187579872,235603059,187574706,235663301}, {194264732,235605934,194227334,235655182}, {185601236,235609408,185586589,235631787}, 
+    {185586589,235631787,185571296,235653880}, {185571296,235653880,185555374,235675698}, {194227334,235655182,194188809,235704073}, 
+    {187574706,235663301,187568430,235723615}, {185555374,235675698,185538842,235697251}, {185538842,235697251,185521716,235718550}, 
+    {194188809,235704073,194108436,235800735}, {185521716,235718550,185504014,235739605}, {180280896,235718784,180198084,235751470}, 
+    {180280896,235718784,181132160,237666304}, {187568430,235723615,187561033,235783984}, {185504014,235739605,185485753,235760426}, 
+    {180198084,235751470,180115732,235786468}, {185485753,235760426,185466952,235781024}, {185466952,235781024,185447628,235801409}, 
+    {187561033,235783984,187552508,235844390}, {180115732,235786468,180033899,235823763}, {194108436,235800735,194023740,235895825}, 
+    {185447628,235801409,185427797,235821593}, {185427797,235821593,185386690,235861395}, {180033899,235823763,179952645,235863339}, 
+    {187552508,235844390,187542845,235904816}, {185386690,235861395,185343771,235900513}, {179952645,235863339,179872028,235905179}, 
+    {194023740,235895825,193934847,235989247}, {185343771,235900513,185299179,235939032}, {187542845,235904816,187532036,235965245}, 
+    {179872028,235905179,179792107,235949267}, {185299179,235939032,185253057,235977036}, {179792107,235949267,179712943,235995588}, 
+    {187532036,235965245,187520072,236025658}, {185253057,235977036,185205543,236014607}, {193934847,235989247,193841882,236080905}, 
+    {179712943,235995588,179634593,236044125}, {185205543,236014607,185106905,236088788}, {187520072,236025658,187506944,236086040}, 
+    {179634593,236044125,179557118,236094862}, {193841882,236080905,193744971,236170705}, {187506944,236086040,187492644,236146372}, 
+    {185106905,236088788,184899116,236235646}, {179557118,236094862,179480576,236147783}, {189723328,236131136,189737451,236161220}, 
+    {187492644,236146372,187477163,236206636}, {179480576,236147783,179405027,236202873}, {189737451,236161220,189752016,236190788}, 
+    {193744971,236170705,193644240,236258550}, {189752016,236190788,189767017,236219844}, {179405027,236202873,179330530,236260114}, 
+    {187477163,236206636,187460491,236266816}, {189767017,236219844,189782449,236248390}, {184899116,236235646,184684800,236384960}, 
+    {189782449,236248390,189798306,236276428}, {193644240,236258550,193539815,236344346}, {179330530,236260114,179257144,236319491}, 
+    {187460491,236266816,187442620,236326894}, {189798306,236276428,189814582,236303960}, {189814582,236303960,189831271,236330988}, 
+    {179257144,236319491,179184928,236380988}, {187442620,236326894,187423542,236386853}, {189831271,236330988,189848369,236357515}, 
+    {193539815,236344346,193431822,236427996}, {189848369,236357515,189865869,236383544}, {179184928,236380988,179113941,236444589}, 
+    {189865869,236383544,189883766,236409076}, {187423542,236386853,187403247,236446674}, {189883766,236409076,189902055,236434114}, 
+    {193431822,236427996,193320385,236509406}, {189902055,236434114,189920728,236458661}, {179113941,236444589,179044243,236510278}, 
+    {187403247,236446674,187381726,236506342}, {189920728,236458661,189939782,236482717}, {189939782,236482717,189959211,236506287}, 
+    {189959211,236506287,189979008,236529372}, {187381726,236506342,187358972,236565838}, {193320385,236509406,193205632,236588480}, 
+    {179044243,236510278,178975893,236578038}, {189979008,236529372,189999168,236551974}, {189999168,236551974,190019686,236574096}, 
+    {187358972,236565838,187334975,236625145}, {190019686,236574096,190040556,236595741}, {178975893,236578038,178908950,236647854}, 
+    {193205632,236588480,193154730,236621748}, {190040556,236595741,190061772,236616909}, {190061772,236616909,190083329,236637605}, 
+    {193154730,236621748,193102789,236654116}, {187334975,236625145,187309726,236684245}, {190083329,236637605,190105221,236657829}, 
+    {178908950,236647854,178843473,236719709}, {193102789,236654116,193049854,236685567}, {190105221,236657829,190127443,236677585}, 
+    {190127443,236677585,190149988,236696875}, {187309726,236684245,187283217,236743122}, {193049854,236685567,192995968,236716082}, 
+    {190149988,236696875,190172852,236715701}, {190172852,236715701,190196028,236734065}, {192995968,236716082,192941179,236745642}, 
+    {178843473,236719709,178779521,236793588}, {190196028,236734065,190219512,236751970}, {187283217,236743122,187255438,236801757}, 
+    {192941179,236745642,192885529,236774228}, {190219512,236751970,190243297,236769418}, {190243297,236769418,190267377,236786412}, 
+    {192885529,236774228,192829064,236801823}, {190267377,236786412,190291748,236802953}, {178779521,236793588,178717154,236869474}, 
+    {187255438,236801757,187226382,236860133}, {192829064,236801823,192771830,236828407}, {190291748,236802953,190316404,236819044}, 
+    {190316404,236819044,190341338,236834687}, {192771830,236828407,192713870,236853962}, {190341338,236834687,190366546,236849885}, 
+    {190366546,236849885,190392022,236864640}, {192713870,236853962,192655230,236878469}, {187226382,236860133,187196038,236918233}, 
+    {190392022,236864640,190417759,236878954}, {178717154,236869474,178656431,236947352}, {192655230,236878469,192595955,236901910}, 
+    {190417759,236878954,190469999,236906270}, {192595955,236901910,192536090,236924266}, {190469999,236906270,190523220,236931851}, 
+    {187196038,236918233,187164399,236976040}, {192536090,236924266,192475679,236945519}, {190523220,236931851,190577377,236955715}, 
+    {192475679,236945519,192414767,236965650}, {178656431,236947352,178597411,237027204}, {190577377,236955715,190632425,236977881}, 
+    {192414767,236965650,192353400,236984640}, {187164399,236976040,187131456,237033536}, {190632425,236977881,190688321,236998368}, 
+    {192353400,236984640,192291622,237002471}, {190688321,236998368,190745017,237017195}, {192291622,237002471,192229478,237019124}, 
+    {190745017,237017195,190802471,237034379}, {192229478,237019124,192167013,237034581}, {178597411,237027204,178540153,237109016}, 
+    {187131456,237033536,189815680,238959616}, {190802471,237034379,190860636,237049940}, {192167013,237034581,192104273,237048824}, 
+    {192104273,237048824,192041301,237061832}, {190860636,237049940,190919468,237063896}, {192041301,237061832,191978142,237073589}, 
+    {190919468,237063896,190978922,237076266}, {191978142,237073589,191914843,237084075}, {190978922,237076266,191038954,237087067}, 
+    {191914843,237084075,191851447,237093272}, {191038954,237087067,191099517,237096320}, {191851447,237093272,191787999,237101162}, 
+    {191099517,237096320,191160568,237104042}, {191787999,237101162,191724545,237107725}, {191160568,237104042,191222061,237110252}, 
+    {191724545,237107725,191661129,237112943}, {178540153,237109016,178484717,237192771}, {191222061,237110252,191283952,237114968}, 
+    {191661129,237112943,191597796,237116797}, {191283952,237114968,191346195,237118209}, {191597796,237116797,191534592,237119270}, 
+    {191346195,237118209,191408746,237119994}, {191534592,237119270,191471560,237120342}, {191408746,237119994,191471560,237120342}, 
+    {178484717,237192771,178431161,237278453}, {178431161,237278453,178379544,237366046}, {178379544,237366046,178329927,237455534}, 
+    {178329927,237455534,178282368,237546900}, {178282368,237546900,178236926,237640129}, {178236926,237640129,178193661,237735205}, 
+    {181132160,237666304,181055832,237697743}, {181055832,237697743,180982030,237730045}, {180982030,237730045,180910730,237763203}, 
+    {178193661,237735205,178152632,237832112}, {180910730,237763203,180841902,237797208}, {180841902,237797208,180775521,237832053}, 
+    {180775521,237832053,180711559,237867731}, {178152632,237832112,178113898,237930833}, {180711559,237867731,180649990,237904234}, 
+    {180649990,237904234,180590786,237941554}, {178113898,237930833,178077517,238031353}, {180590786,237941554,180533921,237979684}, 
+    {180533921,237979684,180479368,238018616}, {180479368,238018616,180427099,238058342}, {178077517,238031353,178043550,238133655}, 
+    {180427099,238058342,180377088,238098855}, {180377088,238098855,180329307,238140147}, {178043550,238133655,178012056,238237723}, 
+    {180329307,238140147,180283730,238182211}, {180283730,238182211,180240330,238225038}, {180240330,238225038,180199080,238268622}, 
+    {186141632,238227456,185619520,238526208}, {186141632,238227456,188416960,239946880}, {178012056,238237723,177983093,238343541}, 
+    {180199080,238268622,180179253,238290695}, {180179253,238290695,180159953,238312954}, {180159953,238312954,180141177,238335399}, 
+    {180141177,238335399,180122921,238358028}, {177983093,238343541,177956722,238451094}, {180122921,238358028,180105183,238380840}, 
+    {180105183,238380840,180087959,238403835}, {180087959,238403835,180071245,238427011}, {180071245,238427011,180055038,238450367}, 
+    {180055038,238450367,180039336,238473903}, {177956722,238451094,177933000,238560365}, {180039336,238473903,180024133,238497618}, 
+    {180024133,238497618,180009428,238521510}, {180009428,238521510,179995216,238545579}, {185619520,238526208,186837184,241075712}, 
+    {179995216,238545579,179981494,238569824}, {177933000,238560365,177911988,238671338}, {179981494,238569824,179968260,238594243}, 
+    {179968260,238594243,179955508,238618837}, {179955508,238618837,179943238,238643603}, {179943238,238643603,179931443,238668541}, 
+    {179931443,238668541,179920123,238693650}, {177911988,238671338,177893744,238783997}, {179920123,238693650,179909272,238718929}, 
+    {179909272,238718929,179898888,238744377}, {179898888,238744377,179888967,238769993}, {179888967,238769993,179879507,238795776}, 
+    {177893744,238783997,177878328,238898325}, {179879507,238795776,179870503,238821726}, {179870503,238821726,179861952,238847840}, 
+    {179861952,238847840,179846196,238900562}, {177878328,238898325,177865799,239014308}, {179846196,238900562,179832213,238953932}, 
+    {179832213,238953932,179819975,239007945}, {189815680,238959616,188416960,239946880}, {179819975,239007945,179809456,239062592}, 
+    {177865799,239014308,177856216,239131928}, {179809456,239062592,179800628,239117866}, {179800628,239117866,179793465,239173758}, 
+    {177856216,239131928,177849638,239251170}, {179793465,239173758,179787940,239230262}, {179787940,239230262,179784025,239287370}, 
+    {177849638,239251170,177846125,239372018}, {179784025,239287370,179781693,239345073}, {179781693,239345073,179780919,239403366}, 
+    {177846125,239372018,177845736,239494455}, {179780919,239403366,179781674,239462239}, {179781674,239462239,179783932,239521685}, 
+    {177845736,239494455,177848529,239618466}, {179783932,239521685,179787666,239581697}, {179787666,239581697,179792849,239642267}, 
+    {177848529,239618466,177854564,239744034}, {179792849,239642267,179799454,239703388}, {179799454,239703388,179807454,239765051}, 
+    {177854564,239744034,177863901,239871144}, {179807454,239765051,179816822,239827249}, {179816822,239827249,179827531,239889975}, 
+    {177863901,239871144,177876598,239999778}, {179827531,239889975,179839554,239953220}, {179839554,239953220,179852864,240016978}, 
+    {177876598,239999778,177892715,240129922}, {179852864,240016978,179883238,240146000}, {177892715,240129922,177912311,240261560}, 
+    {179883238,240146000,179918437,240276979}, {177912311,240261560,177935445,240394674}, {179918437,240276979,179958245,240409855}, 
+    {177935445,240394674,177962176,240529249}, {179958245,240409855,180002448,240544566}, {177962176,240529249,177992564,240665269}, 
+    {180002448,240544566,180050828,240681051}, {177992564,240665269,178026667,240802718}, {180050828,240681051,180103170,240819250}, 
+    {178026667,240802718,178064545,240941580}, {180103170,240819250,180159260,240959101}, {178064545,240941580,178106257,241081839}, 
+    {180159260,240959101,180218880,241100544}, {186837184,241075712,185219648,242169472}, {178106257,241081839,178151862,241223478}, 
+    {180218880,241100544,180254699,241181040}, {180254699,241181040,180291170,241257979}, {178151862,241223478,178201420,241366482}, 
+    {180291170,241257979,180328272,241331419}, {180328272,241331419,180365985,241401416}, {178201420,241366482,178254990,241510834}, 
+    {180365985,241401416,180404289,241468029}, {182984384,241464256,182830968,241591604}, {182984384,241464256,183817088,243191360}, 
+    {180404289,241468029,180443164,241531314}, {178254990,241510834,178312630,241656519}, {180443164,241531314,180482589,241591328}, 
+    {180482589,241591328,180522544,241648128}, {182830968,241591604,182750949,241654405}, {180522544,241648128,180563010,241701773}, 
+    {182750949,241654405,182668939,241716016}, {178312630,241656519,178374400,241803520}, {180563010,241701773,180583428,241727429}, 
+    {182668939,241716016,182585098,241775977}, {180583428,241727429,180603966,241752318}, {180603966,241752318,180624621,241776446}, 
+    {182585098,241775977,182499588,241833833}, {180624621,241776446,180645392,241799821}, {180645392,241799821,180666274,241822450}, 
+    {178374400,241803520,178449878,241973000}, {180666274,241822450,180687267,241844339}, {182499588,241833833,182412570,241889125}, 
+    {180687267,241844339,180708367,241865497}, {180708367,241865497,180729572,241885930}, {180729572,241885930,180750879,241905645}, 
+    {182412570,241889125,182324205,241941396}, {180750879,241905645,180772287,241924650}, {180772287,241924650,180793791,241942952}, 
+    {182324205,241941396,182279568,241966256}, {180793791,241942952,180815390,241960557}, {180815390,241960557,180837082,241977474}, 
+    {182279568,241966256,182234655,241990189}, {178449878,241973000,178526631,242135435}, {180837082,241977474,180858863,241993708}, 
+    {182234655,241990189,182189486,242013139}, {180858863,241993708,180880731,242009268}, {180880731,242009268,180902685,242024160}, 
+    {182189486,242013139,182144081,242035047}, {180902685,242024160,180924720,242038391}, {182144081,242035047,182098461,242055857}, 
+    {180924720,242038391,180946835,242051970}, {180946835,242051970,180969027,242064902}, {182098461,242055857,182052645,242075512}, 
+    {180969027,242064902,180991294,242077195}, {182052645,242075512,182006653,242093954}, {180991294,242077195,181013633,242088856}, 
+    {181013633,242088856,181036041,242099893}, {182006653,242093954,181960507,242111126}, {181036041,242099893,181058517,242110312}, 
+    {181058517,242110312,181081057,242120121}, {181960507,242111126,181914225,242126972}, {181081057,242120121,181103659,242129326}, 
+    {181914225,242126972,181867829,242141434}, {181103659,242129326,181126321,242137935}, {178526631,242135435,178604609,242290939}, 
+    {181126321,242137935,181149040,242145955}, {181867829,242141434,181821338,242154454}, {181149040,242145955,181171813,242153394}, 
+    {181171813,242153394,181194638,242160257}, {181821338,242154454,181774772,242165976}, {181194638,242160257,181217512,242166554}, 
+    {181774772,242165976,181728152,242175942}, {181217512,242166554,181240433,242172289}, {181240433,242172289,181263399,242177472}, 
+    {181728152,242175942,181681498,242184296}, {181263399,242177472,181286407,242182108}, {181286407,242182108,181309454,242186205}, 
+    {181681498,242184296,181658165,242187850}, {181309454,242186205,181332537,242189771}, {181658165,242187850,181634830,242190979}, 
+    {181332537,242189771,181355656,242192812}, {181634830,242190979,181611497,242193677}, {181355656,242192812,181378805,242195335}, 
+    {181611497,242193677,181588168,242195936}, {181378805,242195335,181401984,242197348}, {181588168,242195936,181564846,242197749}, 
+    {181401984,242197348,181425190,242198858}, {181564846,242197749,181541532,242199108}, {181425190,242198858,181448420,242199872}, 
+    {181541532,242199108,181518231,242200008}, {181448420,242199872,181471672,242200396}, {181518231,242200008,181494943,242200439}, 
+    {181471672,242200396,181494943,242200439}, {178604609,242290939,178683768,242439626}, {178683768,242439626,178764059,242581610}, 
+    {178764059,242581610,178845436,242717004}, {178845436,242717004,178927853,242845923}, {178927853,242845923,179011261,242968481}, 
+    {179011261,242968481,179095614,243084791}, {179095614,243084791,179180865,243194966}, {183817088,243191360,183687352,243295365}, 
+    {179180865,243194966,179266968,243299122}, {183687352,243295365,183551258,243398970}, {179266968,243299122,179353875,243397371}, 
+    {179353875,243397371,179397615,243444317}, {183551258,243398970,183409181,243501264}, {179397615,243444317,179441539,243489828}, 
+    {179441539,243489828,179485640,243533920}, {183409181,243501264,183261497,243601336}, {179485640,243533920,179529913,243576607}, 
+    {179529913,243576607,179574352,243617902}, {183261497,243601336,183108582,243698275}, {179574352,243617902,179618951,243657820}, 
+    {179618951,243657820,179663705,243696376}, {179663705,243696376,179708606,243733583}, {183108582,243698275,182950811,243791171}, 
+    {179708606,243733583,179753650,243769456}, {179753650,243769456,179798830,243804009}, {182950811,243791171,182870221,243835818}, 
+    {179798830,243804009,179844141,243837256}, {182870221,243835818,182788559,243879113}, {179844141,243837256,179889577,243869211}, 
+    {179889577,243869211,179935132,243899890}, {182788559,243879113,182705870,243920941}, {179935132,243899890,179980799,243929305}, 
+    {182705870,243920941,182622202,243961189}, {179980799,243929305,180026574,243957471}, {180026574,243957471,180072450,243984402}, 
+    {182622202,243961189,182537602,243999743}, {180072450,243984402,180118422,244010114}, {182537602,243999743,182452116,244036490}, 
+    {180118422,244010114,180164484,244034619}, {180164484,244034619,180210629,244057932}, {182452116,244036490,182365791,244071315}, 
+    {180210629,244057932,180256851,244080067}, {182365791,244071315,182278675,244104104}, {180256851,244080067,180303146,244101039}, 
+    {180303146,244101039,180349507,244120861}, {182278675,244104104,182190814,244134744}, {180349507,244120861,180395929,244139549}, 
+    {182190814,244134744,182102256,244163121}, {180395929,244139549,180442404,244157116}, {180442404,244157116,180488928,244173576}, 
+    {182102256,244163121,182013047,244189120}, {180488928,244173576,180535495,244188944}, {180535495,244188944,180582099,244203233}, 
+    {182013047,244189120,181923234,244212629}, {180582099,244203233,180628733,244216459}, {181923234,244212629,181832864,244233534}, 
+    {180628733,244216459,180675393,244228636}, {180675393,244228636,180722072,244239776}, {181832864,244233534,181741984,244251719}, 
+    {180722072,244239776,180768764,244249896}, {180768764,244249896,180815463,244259009}, {181741984,244251719,181650641,244267072}, 
+    {180815463,244259009,180862165,244267129}, {181650641,244267072,181558882,244279479}, {180862165,244267129,180908861,244274270}, 
+    {180908861,244274270,180955548,244280448}, {181558882,244279479,181466754,244288826}, {180955548,244280448,181002219,244285675}, 
+    {181002219,244285675,181048868,244289966}, {181466754,244288826,181420566,244292317}, {181048868,244289966,181095489,244293336}, 
+    {181420566,244292317,181374304,244294999}, {181095489,244293336,181142076,244295799}, {181374304,244294999,181327972,244296860}, 
+    {181142076,244295799,181188624,244297368}, {181327972,244296860,181281578,244297884}, {181188624,244297368,181235127,244298059}, 
+    {181281578,244297884,181235127,244298059}, 
+};
+
+const Segment SEGMENTS_LEFT_LEG_DOWN[] = {
+    {268173065,251667201,268139250,251667421}, {268173065,251667201,268206704,251667759}, {268139250,251667421,268105267,251668427}, 
+    {268206704,251667759,268240159,251669086}, {268105267,251668427,268071126,251670228}, {268240159,251669086,268273421,251671173}, 
+    {268071126,251670228,268036833,251672833}, {268273421,251671173,268306482,251674012}, {268036833,251672833,268002399,251676251}, 
+    {268306482,251674012,268339334,251677593}, {268002399,251676251,267967830,251680491}, {268339334,251677593,268371967,251681909}, 
+    {267967830,251680491,267933137,251685560}, {268371967,251681909,268404375,251686949}, {267933137,251685560,267898326,251691469}, 
+    {268404375,251686949,268436548,251692706}, {267898326,251691469,267863406,251698225}, {268436548,251692706,268468478,251699171}, 
+    {267863406,251698225,267828386,251705838}, {268468478,251699171,268500156,251706335}, {267828386,251705838,267793275,251714316}, 
+    {268500156,251706335,268531574,251714189}, {268531574,251714189,268562724,251722724}, {267793275,251714316,267758080,251723668}, 
+    {268562724,251722724,268593598,251731932}, {267758080,251723668,267722810,251733903}, {268593598,251731932,268624186,251741804}, 
+    {267722810,251733903,267687473,251745029}, {268624186,251741804,268654481,251752332}, {267687473,251745029,267652078,251757055}, 
+    {268654481,251752332,268684474,251763505}, {267652078,251757055,267616633,251769990}, {268684474,251763505,268714157,251775317}, 
+    {267616633,251769990,267581147,251783843}, {268714157,251775317,268743521,251787757}, {267581147,251783843,267545627,251798623}, 
+    {268743521,251787757,268772558,251800818}, {267545627,251798623,267510083,251814337}, {268772558,251800818,268801259,251814490}, 
+    {267510083,251814337,267474523,251830996}, {268801259,251814490,268829617,251828765}, {268829617,251828765,268857622,251843634}, 
+    {267474523,251830996,267438955,251848607}, {268857622,251843634,268885267,251859088}, {267438955,251848607,267403387,251867180}, 
+    {268885267,251859088,268912542,251875118}, {267403387,251867180,267367829,251886722}, {268912542,251875118,268939440,251891716}, 
+    {267367829,251886722,267332287,251907244}, {268939440,251891716,268965952,251908874}, {267332287,251907244,267296772,251928754}, 
+    {268965952,251908874,268992070,251926581}, {268992070,251926581,269017785,251944830}, {267296772,251928754,267261291,251951260}, 
+    {269017785,251944830,269043089,251963611}, {267261291,251951260,267225852,251974771}, {269043089,251963611,269067973,251982917}, 
+    {267225852,251974771,267190464,251999296}, {269067973,251982917,269092430,252002738}, {267190464,251999296,267085207,252076551}, 
+    {269092430,252002738,269116450,252023065}, {269116450,252023065,269140026,252043890}, {269140026,252043890,269163148,252065204}, 
+    {269163148,252065204,269185809,252086998}, {267085207,252076551,266980988,252158407}, {269185809,252086998,269208000,252109264}, 
+    {269208000,252109264,269229713,252131992}, {269229713,252131992,269250939,252155175}, {269250939,252155175,269271670,252178802}, 
+    {266980988,252158407,266877889,252244665}, {269271670,252178802,269291897,252202866}, {269291897,252202866,269311612,252227358}, 
+    {269311612,252227358,269330807,252252269}, {266877889,252244665,266775990,252335120}, {269330807,252252269,269349474,252277590}, 
+    {269349474,252277590,269367603,252303313}, {269367603,252303313,269385187,252329428}, {269385187,252329428,269402217,252355927}, 
+    {266775990,252335120,266675372,252429571}, {269402217,252355927,269418684,252382802}, {269418684,252382802,269434581,252410042}, 
+    {269434581,252410042,269449899,252437641}, {266675372,252429571,266576115,252527815}, {269449899,252437641,269464629,252465589}, 
+    {269464629,252465589,269478763,252493877}, {269478763,252493877,269492293,252522496}, {269492293,252522496,269505210,252551438}, 
+    {266576115,252527815,266478301,252629651}, {269505210,252551438,269517506,252580694}, {269517506,252580694,269529172,252610255}, 
+    {269529172,252610255,269540201,252640113}, {266478301,252629651,266382010,252734877}, {269540201,252640113,269550583,252670259}, 
+    {269550583,252670259,269560310,252700683}, {269560310,252700683,269569375,252731378}, {269569375,252731378,269577768,252762334}, 
+    {266382010,252734877,266287323,252843290}, {269577768,252762334,269585480,252793543}, {269585480,252793543,269592505,252824996}, 
+    {269592505,252824996,269598833,252856685}, {266287323,252843290,266194319,252954688}, {269598833,252856685,269604455,252888599}, 
+    {269604455,252888599,269609364,252920732}, {269609364,252920732,269613551,252953073}, {269613551,252953073,269617008,252985615}, 
+    {266194319,252954688,266103081,253068868}, {269617008,252985615,269619726,253018348}, {269619726,253018348,269621697,253051264}, 
+    {269621697,253051264,269622912,253084354}, {266103081,253068868,266013689,253185630}, {269622912,253084354,269623363,253117609}, 
+    {269623363,253117609,269623042,253151021}, {269623042,253151021,269621941,253184580}, {269621941,253184580,269620050,253218278}, 
+    {266013689,253185630,265926223,253304770}, {269620050,253218278,269617361,253252107}, {269617361,253252107,269613867,253286057}, 
+    {269613867,253286057,269609558,253320120}, {265926223,253304770,265840765,253426086}, {269609558,253320120,269604426,253354287}, 
+    {269604426,253354287,269598464,253388549}, {269598464,253388549,269591661,253422898}, {269591661,253422898,269584011,253457324}, 
+    {265840765,253426086,265757394,253549377}, {269584011,253457324,269575504,253491819}, {269575504,253491819,269566133,253526375}, 
+    {269566133,253526375,269555888,253560982}, {265757394,253549377,265676192,253674440}, {269555888,253560982,269544762,253595632}, 
+    {269544762,253595632,269532746,253630316}, {269532746,253630316,269519831,253665025}, {269519831,253665025,269506010,253699750}, 
+    {265676192,253674440,265597239,253801073}, {269506010,253699750,269491274,253734484}, {269491274,253734484,269475614,253769216}, 
+    {269475614,253769216,269459022,253803939}, {265597239,253801073,265520616,253929073}, {269459022,253803939,269441489,253838643}, 
+    {269441489,253838643,269423008,253873320}, {269423008,253873320,269403570,253907961}, {269403570,253907961,269383166,253942557}, 
+    {265520616,253929073,265446404,254058239}, {269383166,253942557,269361788,253977099}, {269361788,253977099,269339427,254011580}, 
+    {269339427,254011580,269316076,254045989}, {269316076,254045989,269291726,254080319}, {265446404,254058239,265374683,254188369}, 
+    {269291726,254080319,269266368,254114560}, {269266368,254114560,268999418,254473543}, {265374683,254188369,265305534,254319260}, 
+    {265305534,254319260,265239038,254450710}, {265239038,254450710,265175275,254582517}, {268999418,254473543,268853691,254677661}, 
+    {265175275,254582517,265114326,254714479}, {268853691,254677661,268704074,254895931}, {265114326,254714479,265056272,254846394}, 
+    {265056272,254846394,265001194,254978059}, {268704074,254895931,268553773,255126655}, {265001194,254978059,264949172,255109272}, 
+    {264949172,255109272,264900286,255239831}, {268553773,255126655,268405997,255368135}, {264900286,255239831,264854619,255369535}, 
+    {268405997,255368135,268334058,255492378}, {264854619,255369535,264812249,255498180}, {268334058,255492378,268263953,255618672}, 
+    {264812249,255498180,264773259,255625565}, {268263953,255618672,268196083,255746806}, {264773259,255625565,264737728,255751488}, 
+    {268196083,255746806,268130848,255876568}, {264737728,255751488,264718805,255825854}, {264718805,255825854,264702015,255900658}, 
+    {268130848,255876568,268068650,256007745}, {264702015,255900658,264687296,255975880}, {264687296,255975880,264674588,256051499}, 
+    {268068650,256007745,268009890,256140124}, {264674588,256051499,264663828,256127492}, {264663828,256127492,264654957,256203840}, 
+    {268009890,256140124,267954969,256273494}, {264654957,256203840,264647912,256280520}, {267954969,256273494,267904287,256407642}, 
+    {264647912,256280520,264642633,256357512}, {264642633,256357512,264639058,256434793}, {267904287,256407642,267858245,256542356}, 
+    {264639058,256434793,264637125,256512343}, {264637125,256512343,264636774,256590141}, {267858245,256542356,267837090,256609858}, 
+    {264636774,256590141,264637944,256668164}, {267837090,256609858,267817246,256677423}, {264637944,256668164,264640572,256746393}, 
+    {267817246,256677423,267798761,256745023}, {267798761,256745023,267781688,256812632}, {264640572,256746393,264644599,256824805}, 
+    {267781688,256812632,267766076,256880222}, {264644599,256824805,264656600,256982096}, {267766076,256880222,267751974,256947769}, 
+    {267751974,256947769,267739434,257015245}, {264656600,256982096,264673457,257139866}, {267739434,257015245,267728504,257082623}, 
+    {267728504,257082623,267719236,257149877}, {264673457,257139866,264694681,257297945}, {267719236,257149877,267711680,257216981}, 
+    {267711680,257216981,267705885,257283908}, {267705885,257283908,267701901,257350632}, {264694681,257297945,264719781,257456162}, 
+    {267701901,257350632,267699780,257417125}, {267699780,257417125,267699570,257483362}, {264719781,257456162,264748267,257614348}, 
+    {267699570,257483362,267701323,257549315}, {267701323,257549315,267705087,257614959}, {264748267,257614348,264813437,257929946}, 
+    {267705087,257614959,267710914,257680267}, {267710914,257680267,267718853,257745211}, {267718853,257745211,267728955,257809767}, 
+    {267728955,257809767,267734832,257841890}, {267734832,257841890,267741269,257873906}, {267741269,257873906,267748272,257905812}, 
+    {267748272,257905812,267755846,257937604}, {264813437,257929946,264886272,258243376}, {267755846,257937604,267763999,257969278}, 
+    {267763999,257969278,267772736,258000832}, {267772736,258000832,267828620,258184553}, {267828620,258184553,267888842,258362263}, 
+    {264886272,258243376,265039253,258858286}, {267888842,258362263,267953013,258534534}, {267953013,258534534,268020746,258701939}, 
+    {268020746,258701939,268091652,258865052}, {259060176,258837878,259015519,258838368}, {259060176,258837878,259104577,258838578}, 
+    {259015519,258838368,258970630,258840030}, {259104577,258838578,259148699,258840487}, {258970630,258840030,258925533,258842845}, 
+    {259148699,258840487,259192518,258843622}, {258925533,258842845,258880251,258846795}, {259192518,258843622,259236010,258848003}, 
+    {258880251,258846795,258834809,258851862}, {259236010,258848003,259279152,258853647}, {258834809,258851862,258789230,258858026}, 
+    {259279152,258853647,259321919,258860573}, {258789230,258858026,258743538,258865271}, {265039253,258858286,265111559,259157042}, 
+    {259321919,258860573,259364288,258868800}, {268091652,258865052,268165343,259024445}, {258743538,258865271,258697757,258873577}, 
+    {259364288,258868800,259438242,258885464}, {258697757,258873577,258651910,258882926}, {258651910,258882926,258606021,258893300}, 
+    {259438242,258885464,259512210,258904245}, {258606021,258893300,258560114,258904680}, {259512210,258904245,259586191,258925079}, 
+    {258560114,258904680,258514213,258917047}, {258514213,258917047,258468341,258930385}, {259586191,258925079,259660185,258947896}, 
+    {258468341,258930385,258422522,258944673}, {258422522,258944673,258376780,258959894}, {259660185,258947896,259734190,258972630}, 
+    {258376780,258959894,258331139,258976029}, {259734190,258972630,259808206,258999213}, {258331139,258976029,258285622,258993061}, 
+    {258285622,258993061,258240254,259010970}, {259808206,258999213,259882232,259027579}, {258240254,259010970,258195057,259029738}, 
+    {268165343,259024445,268319527,259334364}, {259882232,259027579,259956267,259057661}, {258195057,259029738,258105274,259069778}, 
+    {259956267,259057661,260030312,259089391}, {258105274,259069778,258016464,259113035}, {260030312,259089391,260104364,259122702}, 
+    {258016464,259113035,257928816,259159360}, {260104364,259122702,260252490,259193798}, {265111559,259157042,265175848,259448184}, 
+    {257928816,259159360,257842521,259208607}, {260252490,259193798,260400639,259270412}, {257842521,259208607,257757769,259260630}, 
+    {257757769,259260630,257674749,259315280}, {260400639,259270412,260548806,259352008}, {257674749,259315280,257593652,259372411}, 
+    {268319527,259334364,268644239,259934779}, {260548806,259352008,260696985,259438047}, {257593652,259372411,257514667,259431876}, 
+    {257514667,259431876,257437986,259493527}, {260696985,259438047,260845169,259527993}, {265175848,259448184,265203761,259590474}, 
+    {257437986,259493527,257363796,259557218}, {260845169,259527993,261141534,259717455}, {257363796,259557218,257292290,259622802}, 
+    {265203761,259590474,265228200,259730350}, {257292290,259622802,257223656,259690131}, {257223656,259690131,257190476,259724404}, 
+    {261141534,259717455,261734080,260119616}, {257190476,259724404,257158085,259759058}, {265228200,259730350,265248675,259867642}, 
+    {257158085,259759058,257126508,259794075}, {257126508,259794075,257095767,259829437}, {257095767,259829437,257065887,259865124}, 
+    {257065887,259865124,257036891,259901120}, {265248675,259867642,265264695,260002178}, {257036891,259901120,257008804,259937404}, 
+    {268644239,259934779,268970040,260539856}, {257008804,259937404,256981648,259973960}, {256981648,259973960,256955449,260010768}, 
+    {265264695,260002178,265270882,260068361}, {256955449,260010768,256930228,260047810}, {256930228,260047810,256906011,260085068}, 
+    {265270882,260068361,265275771,260133791}, {256906011,260085068,256882821,260122523}, {261734080,260119616,262326074,260524105}, 
+    {256882821,260122523,256860681,260160157}, {265275771,260133791,265279302,260198447}, {256860681,260160157,256839616,260197952}, 
+    {256839616,260197952,256804759,260264444}, {265279302,260198447,265281412,260262308}, {265281412,260262308,265282042,260325352}, 
+    {256804759,260264444,256772398,260330593}, {265282042,260325352,265281129,260387560}, {256772398,260330593,256742480,260396399}, 
+    {265281129,260387560,265278613,260448908}, {256742480,260396399,256714951,260461861}, {265278613,260448908,265274432,260509376}, 
+    {256714951,260461861,256689759,260526978}, {265274432,260509376,265267521,260579860}, {262326074,260524105,262621749,260716477}, 
+    {256689759,260526978,256666850,260591751}, {268970040,260539856,269048750,260696151}, {265267521,260579860,265258813,260647692}, 
+    {256666850,260591751,256646170,260656179}, {265258813,260647692,265248296,260712862}, {256646170,260656179,256627667,260720260}, 
+    {269048750,260696151,269125587,260855603}, {265248296,260712862,265242355,260744447}, {262621749,260716477,262769485,260808314}, 
+    {256627667,260720260,256611286,260783995}, {265242355,260744447,265235956,260775363}, {265235956,260775363,265229098,260805610}, 
+    {256611286,260783995,256596975,260847383}, {265229098,260805610,265221779,260835186}, {262769485,260808314,262917146,260896536}, 
+    {265221779,260835186,265213998,260864091}, {256596975,260847383,256584681,260910424}, {269125587,260855603,269200163,261018784}, 
+    {265213998,260864091,265205752,260892323}, {265205752,260892323,265197040,260919881}, {262917146,260896536,263064726,260980605}, 
+    {256584681,260910424,256574349,260973116}, {265197040,260919881,265187861,260946765}, {265187861,260946765,265178212,260972973}, 
+    {265178212,260972973,265168092,260998504}, {256574349,260973116,256565927,261035460}, {263064726,260980605,263212220,261059984}, 
+    {265168092,260998504,265157499,261023357}, {269200163,261018784,269272090,261186267}, {265157499,261023357,265146432,261047532}, 
+    {256565927,261035460,256559362,261097454}, {265146432,261047532,265134889,261071027}, {263212220,261059984,263359622,261134136}, 
+    {265134889,261071027,265122868,261093840}, {265122868,261093840,265110367,261115972}, {256559362,261097454,256554599,261159099}, 
+    {265110367,261115972,265097385,261137421}, {263359622,261134136,263506925,261202523}, {265097385,261137421,265083920,261158185}, 
+    {265083920,261158185,265069970,261178265}, {256554599,261159099,256551586,261220394}, {265069970,261178265,265055534,261197658}, 
+    {269272090,261186267,269340981,261358626}, {265055534,261197658,265040610,261216365}, {263506925,261202523,263580538,261234387}, 
+    {265040610,261216365,265025196,261234382}, {256551586,261220394,256550269,261281338}, {265025196,261234382,265017305,261243133}, 
+    {263580538,261234387,263654124,261264608}, {265017305,261243133,265009290,261251711}, {265009290,261251711,265001153,261260117}, 
+    {265001153,261260117,264992892,261268349}, {263654124,261264608,263727683,261293120}, {264992892,261268349,264984507,261276409}, 
+    {264984507,261276409,264975998,261284296}, {256550269,261281338,256550596,261341931}, {264975998,261284296,264967365,261292010}, 
+    {264967365,261292010,264958608,261299551}, {263727683,261293120,263801213,261319854}, {264958608,261299551,264949727,261306918}, 
+    {264949727,261306918,264940720,261314112}, {264940720,261314112,264931588,261321132}, {263801213,261319854,263874715,261344745}, 
+    {264931588,261321132,264922332,261327979}, {264922332,261327979,264912950,261334651}, {264912950,261334651,264903442,261341150}, 
+    {264903442,261341150,264893808,261347474}, {256550596,261341931,256552512,261402171}, {263874715,261344745,263948187,261367724}, 
+    {264893808,261347474,264884048,261353624}, {264884048,261353624,264874163,261359600}, {269340981,261358626,269406446,261536433}, 
+    {264874163,261359600,264864150,261365401}, {264864150,261365401,264854011,261371027}, {263948187,261367724,264021629,261388725}, 
+    {264854011,261371027,264843745,261376479}, {264843745,261376479,264833352,261381756}, {264833352,261381756,264822831,261386857}, 
+    {264822831,261386857,264812183,261391784}, {264021629,261388725,264095040,261407680}, {264812183,261391784,264801408,261396535}, 
+    {264801408,261396535,264790504,261401111}, {264790504,261401111,264779472,261405511}, {256552512,261402171,256555965,261462060}, 
+    {264779472,261405511,264768312,261409735}, {264095040,261407680,264163948,261423314}, {264768312,261409735,264757023,261413784}, 
+    {264757023,261413784,264734058,261421353}, {264734058,261421353,264710577,261428217}, {264163948,261423314,264197574,261430041}, 
+    {264710577,261428217,264686577,261434376}, {264197574,261430041,264230651,261436044}, {264686577,261434376,264662056,261439827}, 
+    {264230651,261436044,264263181,261441323}, {264662056,261439827,264637014,261444570}, {264263181,261441323,264295165,261445880}, 
+    {264637014,261444570,264611448,261448604}, {264295165,261445880,264326605,261449715}, {264611448,261448604,264585356,261451928}, 
+    {264326605,261449715,264357502,261452829}, {264585356,261451928,264558737,261454541}, {264357502,261452829,264387859,261455224}, 
+    {264558737,261454541,264531589,261456441}, {264387859,261455224,264417676,261456900}, {264531589,261456441,264503911,261457628}, 
+    {264417676,261456900,264446956,261457859}, {264503911,261457628,264475701,261458101}, {264446956,261457859,264475701,261458101}, 
+    {256555965,261462060,256560900,261521595}, {256560900,261521595,256567266,261580777}, {269406446,261536433,269468098,261720261}, 
+    {256567266,261580777,256575007,261639605}, {256575007,261639605,256584072,261698079}, {256584072,261698079,256594407,261756197}, 
+    {269468098,261720261,269525549,261910684}, {256594407,261756197,256605958,261813960}, {256605958,261813960,256618672,261871367}, 
+    {256618672,261871367,256632496,261928417}, {269525549,261910684,269578410,262108274}, {256632496,261928417,256647377,261985110}, 
+    {256647377,261985110,256663260,262041445}, {256663260,262041445,256697824,262153040}, {269578410,262108274,269626294,262313605}, 
+    {256697824,262153040,256735760,262263198}, {256735760,262263198,256776643,262371914}, {269626294,262313605,269668811,262527249}, 
+    {256776643,262371914,256820045,262479184}, {256820045,262479184,256865540,262585003}, {269668811,262527249,269705575,262749779}, 
+    {256865540,262585003,256961102,262792275}, {269705575,262749779,269736197,262981769}, {256961102,262792275,257059918,262993694}, 
+    {269736197,262981769,269760288,263223791}, {257059918,262993694,257253657,263378838}, {269760288,263223791,269777461,263476418}, 
+    {257253657,263378838,257341756,263562494}, {269777461,263476418,269787328,263740224}, {257341756,263562494,257382119,263652078}, 
+    {257382119,263652078,257419456,263740160}, {257419456,263740160,269787328,263740224}, 
+};
+
+const Segment SEGMENTS_LEFT_LEG_UP[] = {
+    {248125189,243517567,248025986,243518116}, {248125189,243517567,248224552,243520153}, {248025986,243518116,247927183,243521787}, 
+    {248224552,243520153,248323836,243525885}, {247927183,243521787,247829020,243528569}, {248323836,243525885,248422800,243534776}, 
+    {247829020,243528569,247731738,243538449}, {248422800,243534776,248521204,243546838}, {247731738,243538449,247635576,243551415}, 
+    {248521204,243546838,248618808,243562083}, {247635576,243551415,247540775,243567455}, {248618808,243562083,248715372,243580523}, 
+    {247540775,243567455,247493959,243576625}, {247493959,243576625,247447574,243586558}, {248715372,243580523,248763189,243590944}, 
+    {247447574,243586558,247401649,243597254}, {248763189,243590944,248810656,243602169}, {247401649,243597254,247356214,243608710}, 
+    {248810656,243602169,248857744,243614199}, {247356214,243608710,247311299,243620927}, {248857744,243614199,248904421,243627035}, 
+    {247311299,243620927,247266934,243633901}, {248904421,243627035,248950658,243640679}, {247266934,243633901,247223150,243647632}, 
+    {248950658,243640679,248996425,243655133}, {247223150,243647632,247179976,243662117}, {248996425,243655133,249041691,243670397}, 
+    {247179976,243662117,247137442,243677356}, {249041691,243670397,249086428,243686473}, {247137442,243677356,247095578,243693347}, 
+    {249086428,243686473,249130605,243703363}, {247095578,243693347,247054414,243710088}, {249130605,243703363,249174192,243721069}, 
+    {247054414,243710088,247013980,243727579}, {249174192,243721069,249217159,243739591}, {247013980,243727579,246974307,243745816}, 
+    {249217159,243739591,249259475,243758932}, {246974307,243745816,246935424,243764800}, {249259475,243758932,249301112,243779093}, 
+    {246935424,243764800,246868427,243799435}, {249301112,243779093,249342038,243800075}, {246868427,243799435,246802890,243835179}, 
+    {249342038,243800075,249382225,243821880}, {249382225,243821880,249421641,243844510}, {246802890,243835179,246738797,243872001}, 
+    {249421641,243844510,249460257,243867965}, {249460257,243867965,249498044,243892248}, {246738797,243872001,246676128,243909873}, 
+    {249498044,243892248,249534970,243917360}, {246676128,243909873,246614865,243948763}, {249534970,243917360,249571005,243943302}, 
+    {249571005,243943302,249606121,243970076}, {246614865,243948763,246554991,243988644}, {249606121,243970076,249640287,243997684}, 
+    {246554991,243988644,246496487,244029484}, {249640287,243997684,249673472,244026127}, {249673472,244026127,249705648,244055406}, 
+    {246496487,244029484,246439334,244071254}, {249705648,244055406,249736783,244085523}, {246439334,244071254,246383516,244113925}, 
+    {249736783,244085523,249766848,244116480}, {246383516,244113925,246329013,244157466}, {249766848,244116480,249817970,244172305}, 
+    {246329013,244157466,246275807,244201848}, {249817970,244172305,249867787,244229688}, {246275807,244201848,246223880,244247041}, 
+    {249867787,244229688,249916338,244288581}, {246223880,244247041,246173215,244293016}, {249916338,244288581,249963666,244348933}, 
+    {246173215,244293016,246123792,244339743}, {246123792,244339743,246075594,244387191}, {249963666,244348933,250009812,244410695}, 
+    {246075594,244387191,246028602,244435332}, {250009812,244410695,250054817,244473818}, {246028602,244435332,245982798,244484135}, 
+    {250054817,244473818,250098722,244538253}, {245982798,244484135,245938165,244533571}, {259427363,244485928,259066651,244492651}, 
+    {259427363,244485928,259784194,244490788}, {259784194,244490788,260132663,244505729}, {259066651,244492651,258886239,244500824}, 
+    {258886239,244500824,258706536,244512456}, {260132663,244505729,260468292,244529250}, {258706536,244512456,258528102,244527734}, 
+    {258528102,244527734,258351498,244546845}, {260468292,244529250,260786601,244559851}, {245938165,244533571,245894683,244583611}, 
+    {250098722,244538253,250141568,244603949}, {258351498,244546845,258177282,244569977}, {260786601,244559851,261083112,244596031}, 
+    {258177282,244569977,258006016,244597319}, {245894683,244583611,245852335,244634223}, {261083112,244596031,261353344,244636288}, 
+    {258006016,244597319,257838258,244629056}, {250141568,244603949,250183397,244670857}, {257838258,244629056,257674569,244665378}, 
+    {245852335,244634223,245811103,244685379}, {261353344,244636288,261394872,244643623}, {261394872,244643623,261435646,244651912}, 
+    {261435646,244651912,261475668,244661138}, {261475668,244661138,261514940,244671287}, {257674569,244665378,257594425,244685316}, 
+    {250183397,244670857,250224250,244738928}, {261514940,244671287,261553463,244682342}, {261553463,244682342,261591238,244694288}, 
+    {257594425,244685316,257515509,244706471}, {245811103,244685379,245770968,244737049}, {261591238,244694288,261628268,244707109}, 
+    {257515509,244706471,257437889,244728865}, {261628268,244707109,261664554,244720791}, {261664554,244720791,261700098,244735317}, 
+    {257437889,244728865,257361637,244752523}, {261700098,244735317,261734901,244750671}, {245770968,244737049,245693917,244841812}, 
+    {250224250,244738928,250303193,244878361}, {261734901,244750671,261768965,244766839}, {257361637,244752523,257286822,244777467}, 
+    {261768965,244766839,261802291,244783804}, {257286822,244777467,257213514,244803722}, {261802291,244783804,261834882,244801552}, 
+    {261834882,244801552,261866739,244820066}, {257213514,244803722,257141783,244831310}, {261866739,244820066,261897863,244839331}, 
+    {257141783,244831310,257071699,244860255}, {261897863,244839331,261928257,244859331}, {245693917,244841812,245621037,244948273}, 
+    {261928257,244859331,261957921,244880051}, {257071699,244860255,257003332,244890581}, {250303193,244878361,250378725,245021851}, 
+    {261957921,244880051,261986858,244901476}, {257003332,244890581,256936752,244922311}, {261986858,244901476,262015069,244923589}, 
+    {256936752,244922311,256872029,244955468}, {262015069,244923589,262042556,244946375}, {262042556,244946375,262069320,244969819}, 
+    {245621037,244948273,245552182,245056196}, {256872029,244955468,256809234,244990076}, {262069320,244969819,262095363,244993905}, 
+    {256809234,244990076,256748435,245026158}, {262095363,244993905,262120687,245018618}, {262120687,245018618,262145293,245043941}, 
+    {250378725,245021851,250451178,245169002}, {256748435,245026158,256689703,245063738}, {262145293,245043941,262169183,245069860}, 
+    {245552182,245056196,245487208,245165341}, {256689703,245063738,256661134,245083097}, {262169183,245069860,262192359,245096358}, 
+    {256661134,245083097,256633109,245102839}, {262192359,245096358,262214822,245123421}, {256633109,245102839,256605635,245122968}, 
+    {256605635,245122968,256578721,245143485}, {262214822,245123421,262236574,245151032}, {256578721,245143485,256552377,245164395}, 
+    {262236574,245151032,262257616,245179177}, {256552377,245164395,256526610,245185699}, {245487208,245165341,245425968,245275472}, 
+    {250451178,245169002,250520881,245319419}, {262257616,245179177,262277951,245207839}, {256526610,245185699,256501431,245207401}, 
+    {256501431,245207401,256476847,245229505}, {262277951,245207839,262297579,245237003}, {256476847,245229505,256452867,245252011}, 
+    {262297579,245237003,262316503,245266653}, {256452867,245252011,256429500,245274925}, {262316503,245266653,262334724,245296774}, 
+    {256429500,245274925,256406755,245298248}, {245425968,245275472,245368317,245386350}, {262334724,245296774,262352244,245327351}, 
+    {256406755,245298248,256384640,245321984}, {250520881,245319419,250588163,245472706}, {256384640,245321984,256336967,245375390}, 
+    {262352244,245327351,262369064,245358367}, {262369064,245358367,262385186,245389807}, {256336967,245375390,256290757,245429209}, 
+    {245368317,245386350,245314110,245497738}, {262385186,245389807,262400612,245421656}, {262400612,245421656,262415343,245453898}, 
+    {256290757,245429209,256245963,245483423}, {262415343,245453898,262429381,245486517}, {250588163,245472706,250716787,245786306}, 
+    {256245963,245483423,256202538,245538013}, {262429381,245486517,262442728,245519499}, {245314110,245497738,245263201,245609397}, 
+    {262442728,245519499,262455385,245552826}, {256202538,245538013,256160436,245592961}, {262455385,245552826,262467353,245586485}, 
+    {262467353,245586485,262478636,245620458}, {256160436,245592961,256119610,245648249}, {245263201,245609397,245215445,245721090}, 
+    {262478636,245620458,262489233,245654732}, {256119610,245648249,256041598,245759769}, {262489233,245654732,262499147,245689289}, 
+    {262499147,245689289,262508380,245724115}, {245215445,245721090,245170696,245832579}, {262508380,245724115,262516933,245759194}, 
+    {262516933,245759194,262524808,245794510}, {256041598,245759769,255968130,245872426}, {250716787,245786306,250959504,246430528}, 
+    {262524808,245794510,262532006,245830049}, {262532006,245830049,262538529,245865793}, {245170696,245832579,245128809,245943626}, 
+    {262538529,245865793,262544378,245901728}, {255968130,245872426,255898830,245986073}, {262544378,245901728,262549556,245937838}, 
+    {262549556,245937838,262554064,245974108}, {245128809,245943626,245089638,246053994}, {262554064,245974108,262557903,246010522}, 
+    {255898830,245986073,255833326,246100561}, {262557903,246010522,262561076,246047065}, {262561076,246047065,262563584,246083720}, 
+    {245089638,246053994,245053038,246163444}, {262563584,246083720,262565428,246120473}, {255833326,246100561,255771243,246215743}, 
+    {262565428,246120473,262566610,246157307}, {262566610,246157307,262567132,246194208}, {245053038,246163444,244986968,246378640}, 
+    {262567132,246194208,262566995,246231159}, {255771243,246215743,255712208,246331472}, {262566995,246231159,262566202,246268146}, 
+    {262566202,246268146,262564753,246305152}, {262564753,246305152,262562650,246342162}, {255712208,246331472,255655846,246447600}, 
+    {262562650,246342162,262559896,246379160}, {244986968,246378640,244929436,246587312}, {262559896,246379160,262556491,246416131}, 
+    {262556491,246416131,262552438,246453060}, {250959504,246430528,251200439,247076334}, {255655846,246447600,255549648,246680463}, 
+    {262552438,246453060,262547737,246489930}, {262547737,246489930,262542391,246526726}, {262542391,246526726,262536401,246563433}, 
+    {262536401,246563433,262529769,246600035}, {244929436,246587312,244879277,246787557}, {262529769,246600035,262522497,246636517}, 
+    {262522497,246636517,262514586,246672862}, {262514586,246672862,262506037,246709056}, {255549648,246680463,255352888,247144488}, 
+    {262506037,246709056,262496853,246745082}, {262496853,246745082,262487035,246780926}, {262487035,246780926,262476585,246816572}, 
+    {244879277,246787557,244835328,246977472}, {262476585,246816572,262465504,246852003}, {262465504,246852003,262453794,246887205}, 
+    {262453794,246887205,262441456,246922162}, {262441456,246922162,262428493,246956859}, {262428493,246956859,262414906,246991279}, 
+    {244835328,246977472,245478661,247404241}, {262414906,246991279,262400697,247025407}, {262400697,247025407,262385866,247059229}, 
+    {262385866,247059229,262370417,247092727}, {251200439,247076334,251326835,247391914}, {262370417,247092727,262354350,247125887}, 
+    {262354350,247125887,262337667,247158693}, {255352888,247144488,255256344,247373289}, {262337667,247158693,262320369,247191130}, 
+    {262320369,247191130,262302460,247223182}, {262302460,247223182,262283939,247254832}, {262283939,247254832,262264809,247286067}, 
+    {262264809,247286067,262245071,247316870}, {262245071,247316870,262224727,247347225}, {262224727,247347225,262203779,247377118}, 
+    {255256344,247373289,255157037,247598376}, {262203779,247377118,262182228,247406532}, {251326835,247391914,251392670,247546488}, 
+    {245478661,247404241,246131594,247813504}, {262182228,247406532,262160076,247435452}, {262160076,247435452,262137325,247463863}, 
+    {262137325,247463863,262113976,247491748}, {262113976,247491748,262090030,247519093}, {262090030,247519093,262065490,247545882}, 
+    {262065490,247545882,262040358,247572098}, {251392670,247546488,251460702,247698390}, {262040358,247572098,262014634,247597727}, 
+    {262014634,247597727,261988320,247622754}, {255157037,247598376,255105412,247709157}, {261988320,247622754,261961418,247647161}, 
+    {261961418,247647161,261933930,247670935}, {261933930,247670935,261905858,247694059}, {261905858,247694059,261877202,247716518}, 
+    {251460702,247698390,251531261,247847224}, {255105412,247709157,255051975,247818568}, {261877202,247716518,261847965,247738296}, 
+    {261847965,247738296,261818148,247759378}, {261818148,247759378,261787753,247779747}, {261787753,247779747,261756782,247799390}, 
+    {261756782,247799390,261725236,247818289}, {246131594,247813504,246792754,248207762}, {261725236,247818289,261693116,247836430}, 
+    {255051975,247818568,254996352,247926460}, {261693116,247836430,261660425,247853796}, {251531261,247847224,251604678,247992595}, 
+    {261660425,247853796,261627164,247870373}, {261627164,247870373,261593335,247886145}, {261593335,247886145,261558939,247901096}, 
+    {261558939,247901096,261523979,247915210}, {261523979,247915210,261488455,247928473}, {254996352,247926460,254938169,248032685}, 
+    {261488455,247928473,261452369,247940868}, {261452369,247940868,261415723,247952379}, {261415723,247952379,261378519,247962993}, 
+    {261378519,247962993,261340758,247972692}, {261340758,247972692,261302442,247981461}, {261302442,247981461,261263572,247989285}, 
+    {261263572,247989285,261224151,247996148}, {251604678,247992595,251681281,248134107}, {261224151,247996148,261184179,248002034}, 
+    {259673162,247999808,259931376,248000793}, {259673162,247999808,259543424,248002564}, {259931376,248000793,260185480,248007241}, 
+    {261184179,248002034,261143659,248006929}, {259543424,248002564,259413750,248008127}, {261143659,248006929,261102592,248010816}, 
+    {260185480,248007241,260669718,248021156}, {259413750,248008127,259284503,248016976}, {261102592,248010816,261000462,248017356}, 
+    {259284503,248016976,259156048,248029592}, {261000462,248017356,260894030,248020939}, {260894030,248020939,260783661,248022045}, 
+    {260669718,248021156,260783661,248022045}, {259156048,248029592,259092231,248037463}, {254938169,248032685,254877052,248137097}, 
+    {259092231,248037463,259028748,248046455}, {259028748,248046455,258965645,248056629}, {258965645,248056629,258902968,248068045}, 
+    {258902968,248068045,258840761,248080763}, {258840761,248080763,258779070,248094843}, {258779070,248094843,258717941,248110345}, 
+    {258717941,248110345,258657420,248127329}, {258657420,248127329,258597550,248145855}, {251681281,248134107,251761402,248271363}, 
+    {254877052,248137097,254812627,248239547}, {258597550,248145855,258538379,248165983}, {258538379,248165983,258479952,248187773}, 
+    {258479952,248187773,258422313,248211285}, {246792754,248207762,247460772,248589516}, {258422313,248211285,258365510,248236579}, 
+    {258365510,248236579,258309586,248263716}, {254812627,248239547,254779057,248289991}, {258309586,248263716,258254587,248292754}, 
+    {251761402,248271363,251802884,248338272}, {254779057,248289991,254744521,248339888}, {258254587,248292754,258227449,248308006}, 
+    {258227449,248308006,258200560,248323755}, {258200560,248323755,258173925,248340010}, {251802884,248338272,251845369,248403969}, 
+    {254744521,248339888,254708970,248389222}, {258173925,248340010,258147549,248356778}, {258147549,248356778,258121439,248374067}, 
+    {258121439,248374067,258095600,248391883}, {254708970,248389222,254672359,248437974}, {258095600,248391883,258070038,248410236}, 
+    {251845369,248403969,251888898,248468403}, {258070038,248410236,258044758,248429131}, {258044758,248429131,258019767,248448577}, 
+    {254672359,248437974,254634640,248486124}, {258019767,248448577,257995070,248468581}, {251888898,248468403,251933512,248531527}, 
+    {257995070,248468581,257970672,248489151}, {254634640,248486124,254595767,248533655}, {257970672,248489151,257946579,248510294}, 
+    {257946579,248510294,257922797,248532017}, {251933512,248531527,251979253,248593290}, {257922797,248532017,257899332,248554328}, 
+    {254595767,248533655,254555694,248580548}, {257899332,248554328,257876190,248577235}, {257876190,248577235,257853375,248600746}, 
+    {254555694,248580548,254514373,248626785}, {247460772,248589516,250173984,250041504}, {251979253,248593290,252026162,248653643}, 
+    {257853375,248600746,257830894,248624866}, {257830894,248624866,257808752,248649605}, {254514373,248626785,254471758,248672347}, 
+    {257808752,248649605,257786956,248674970}, {252026162,248653643,252074280,248712536}, {254471758,248672347,254427802,248717216}, 
+    {257786956,248674970,257765510,248700968}, {257765510,248700968,257744421,248727606}, {252074280,248712536,252123648,248769920}, 
+    {254427802,248717216,254382458,248761373}, {257744421,248727606,257723693,248754892}, {257723693,248754892,257703334,248782834}, 
+    {254382458,248761373,254335680,248804800}, {252123648,248769920,252135683,248783308}, {257703334,248782834,257683348,248811440}, 
+    {252135683,248783308,252147943,248796477}, {252147943,248796477,252173127,248822155}, {254335680,248804800,254308603,248828609}, 
+    {257683348,248811440,257663741,248840716}, {252173127,248822155,252199174,248846958}, {254308603,248828609,254280725,248851697}, 
+    {257663741,248840716,257644519,248870670}, {252199174,248846958,252226056,248870887}, {254280725,248851697,254252073,248874062}, 
+    {257644519,248870670,257625688,248901309}, {252226056,248870887,252253746,248893946}, {254252073,248874062,254222674,248895701}, 
+    {252253746,248893946,252282216,248916136}, {254222674,248895701,254192556,248916613}, {257625688,248901309,257607253,248932642}, 
+    {252282216,248916136,252311439,248937461}, {254192556,248916613,254161746,248936793}, {257607253,248932642,257589219,248964676}, 
+    {254161746,248936793,254130270,248956241}, {252311439,248937461,252341389,248957922}, {254130270,248956241,254098157,248974953}, 
+    {252341389,248957922,252372037,248977523}, {257589219,248964676,257571593,248997417}, {254098157,248974953,254065434,248992926}, 
+    {252372037,248977523,252403356,248996266}, {254065434,248992926,254032127,249010159}, {252403356,248996266,252435320,249014153}, 
+    {257571593,248997417,257554381,249030875}, {254032127,249010159,253998265,249026648}, {252435320,249014153,252467901,249031188}, 
+    {253998265,249026648,253963874,249042391}, {257554381,249030875,257537587,249065055}, {252467901,249031188,252501071,249047372}, 
+    {253963874,249042391,253928982,249057386}, {252501071,249047372,252534803,249062708}, {253928982,249057386,253893615,249071629}, 
+    {252534803,249062708,252569071,249077199}, {257537587,249065055,257521219,249099967}, {253893615,249071629,253857802,249085119}, 
+    {252569071,249077199,252603846,249090847}, {253857802,249085119,253821570,249097853}, {252603846,249090847,252639102,249103655}, 
+    {253821570,249097853,253784945,249109828}, {257521219,249099967,257505280,249135616}, {252639102,249103655,252674811,249115625}, 
+    {253784945,249109828,253747956,249121042}, {252674811,249115625,252710946,249126760}, {253747956,249121042,253710628,249131492}, 
+    {252710946,249126760,252747480,249137063}, {253710628,249131492,253672991,249141176}, {257505280,249135616,257327980,249552476}, 
+    {252747480,249137063,252784385,249146535}, {253672991,249141176,253635070,249150091}, {252784385,249146535,252821634,249155180}, 
+    {253635070,249150091,253596893,249158234}, {252821634,249155180,252859200,249163000}, {253596893,249158234,253558488,249165604}, 
+    {252859200,249163000,252897056,249169998}, {253558488,249165604,253519882,249172197}, {252897056,249169998,252935174,249176176}, 
+    {253519882,249172197,253481101,249178011}, {252935174,249176176,252973528,249181537}, {253481101,249178011,253442174,249183043}, 
+    {252973528,249181537,253012089,249186083}, {253442174,249183043,253403127,249187291}, {253012089,249186083,253050830,249189816}, 
+    {253403127,249187291,253363988,249190753}, {253050830,249189816,253089725,249192740}, {253363988,249190753,253324784,249193425}, 
+    {253089725,249192740,253128746,249194857}, {253324784,249193425,253285543,249195305}, {253128746,249194857,253167865,249196170}, 
+    {253285543,249195305,253246291,249196391}, {253167865,249196170,253207056,249196680}, {253246291,249196391,253207056,249196680}, 
+    {257327980,249552476,257178314,249923942}, {257178314,249923942,256944225,250550319}, {250173984,250041504,252887196,251493492}, 
+    {256944225,250550319,256767702,251053994}, {256767702,251053994,256689992,251272084}, {256689992,251272084,256613432,251474216}, 
+    {256613432,251474216,256574203,251570831}, {252887196,251493492,253555214,251875246}, {256574203,251570831,256533607,251665297}, 
+    {256533607,251665297,256491091,251758226}, {256491091,251758226,256446103,251850233}, {256446103,251850233,256398092,251941929}, 
+    {253555214,251875246,254216374,252269504}, {256398092,251941929,256346506,252033930}, {256346506,252033930,256290794,252126846}, 
+    {256290794,252126846,256230403,252221293}, {256230403,252221293,256164782,252317883}, {254216374,252269504,254869307,252678767}, 
+    {256164782,252317883,256093379,252417229}, {256093379,252417229,256015642,252519946}, {256015642,252519946,255931019,252626645}, 
+    {255931019,252626645,255838960,252737940}, {254869307,252678767,255512640,253105536}, {255838960,252737940,255738911,252854445}, 
+    {255738911,252854445,255512640,253105536}, 
+};
+
+const Segment SEGMENTS_LEFT_SPLAT[] = {
+    {211086324,239693657,211213841,239696115}, {211086324,239693657,210959945,239693914}, {210959945,239693914,210834731,239696881}, 
+    {211213841,239696115,211342471,239701289}, {210834731,239696881,210710708,239702557}, {211342471,239701289,211472189,239709184}, 
+    {210710708,239702557,210587900,239710938}, {211472189,239709184,211602967,239719800}, {210587900,239710938,210466335,239722022}, 
+    {211602967,239719800,211734782,239733142}, {210466335,239722022,210346037,239735807}, {211734782,239733142,211867606,239749211}, 
+    {210346037,239735807,210227032,239752288}, {211867606,239749211,212001415,239768012}, {210227032,239752288,210109347,239771464}, 
+    {212001415,239768012,212136182,239789546}, {210109347,239771464,209993006,239793331}, {212136182,239789546,212271881,239813816}, 
+    {209993006,239793331,209878037,239817887}, {212271881,239813816,212408487,239840826}, {209878037,239817887,209764464,239845129}, 
+    {212408487,239840826,212545974,239870577}, {209764464,239845129,209652313,239875054}, {212545974,239870577,212823488,239938317}, 
+    {209652313,239875054,209541610,239907660}, {209541610,239907660,209432381,239942943}, {212823488,239938317,213104217,240017059}, 
+    {209432381,239942943,209324652,239980901}, {209324652,239980901,209218448,240021531}, {213104217,240017059,213387955,240106825}, 
+    {209218448,240021531,209113796,240064830}, {209113796,240064830,209010720,240110795}, {213387955,240106825,213674494,240207637}, 
+    {209010720,240110795,208909247,240159424}, {208909247,240159424,208809403,240210714}, {213674494,240207637,213963630,240319518}, 
+    {208809403,240210714,208711213,240264662}, {208711213,240264662,208614703,240321265}, {213963630,240319518,214255155,240442490}, 
+    {208614703,240321265,208519899,240380520}, {208519899,240380520,208426827,240442425}, {208426827,240442425,208335512,240506976}, 
+    {214255155,240442490,214548864,240576576}, {208335512,240506976,208245980,240574172}, {208245980,240574172,208158257,240644009}, 
+    {214548864,240576576,213697792,243813120}, {208158257,240644009,208072369,240716484}, {208072369,240716484,207988341,240791594}, 
+    {207988341,240791594,207906200,240869338}, {207906200,240869338,207825970,240949711}, {207825970,240949711,207747679,241032711}, 
+    {207747679,241032711,207671351,241118336}, {207671351,241118336,207597013,241206583}, {207597013,241206583,207524690,241297448}, 
+    {207524690,241297448,207454407,241390929}, {207454407,241390929,207386192,241487023}, {207386192,241487023,207320069,241585728}, 
+    {207320069,241585728,207256064,241687040}, {207256064,241687040,207183466,241808013}, {207183466,241808013,207113384,241930375}, 
+    {207113384,241930375,207045930,242054392}, {207045930,242054392,206981214,242180326}, {206981214,242180326,206919348,242308441}, 
+    {206919348,242308441,206860445,242439003}, {206860445,242439003,206804616,242572274}, {210309696,242571648,210323840,246351488}, 
+    {210309696,242571648,213697792,243813120}, {206804616,242572274,206751972,242708518}, {206751972,242708518,206702626,242848000}, 
+    {206702626,242848000,206656689,242990984}, {206656689,242990984,206614272,243137733}, {206614272,243137733,206575488,243288511}, 
+    {206575488,243288511,206540449,243443583}, {206540449,243443583,206509265,243603213}, {206509265,243603213,206482049,243767664}, 
+    {206482049,243767664,206458912,243937200}, {206458912,243937200,206439966,244112086}, {206439966,244112086,206425323,244292585}, 
+    {206425323,244292585,206415094,244478961}, {206415094,244478961,206409392,244671479}, {206409392,244671479,206408327,244870402}, 
+    {206408327,244870402,206412011,245075994}, {206412011,245075994,206420557,245288519}, {206420557,245288519,206434076,245508242}, 
+    {206434076,245508242,206452679,245735426}, {206452679,245735426,206476479,245970335}, {206476479,245970335,206505587,246213233}, 
+    {206505587,246213233,206540114,246464384}, {208868096,246335360,208570240,247783936}, {208868096,246335360,210323840,246351488}, 
+    {206540114,246464384,206625876,246992502}, {206625876,246992502,206734656,247556800}, {206734656,247556800,208570240,247783936}, 
+    {223003968,249552256,228286336,255710976}, {223003968,249552256,222783936,253625216}, {218886720,250685184,222783936,253625216}, 
+    {218886720,250685184,221088576,256017408}, {241468288,251081197,241615897,251083377}, {241468288,251081197,241319015,251082637}, 
+    {241319015,251082637,241168100,251087701}, {241615897,251083377,241761818,251089176}, {241168100,251087701,241015567,251096392}, 
+    {241761818,251089176,241906027,251098589}, {241015567,251096392,240861439,251108712}, {241906027,251098589,242048502,251111615}, 
+    {240861439,251108712,240705740,251124665}, {242048502,251111615,242189219,251128251}, {240705740,251124665,240548493,251144252}, 
+    {242189219,251128251,242328154,251148493}, {240548493,251144252,240389721,251167478}, {242328154,251148493,242465285,251172339}, 
+    {240389721,251167478,240229447,251194344}, {242465285,251172339,242600588,251199786}, {240229447,251194344,240067695,251224854}, 
+    {242600588,251199786,242734040,251230832}, {240067695,251224854,239904489,251259011}, {242734040,251230832,242865617,251265472}, 
+    {239904489,251259011,239739850,251296817}, {242865617,251265472,242995296,251303705}, {239739850,251296817,239573804,251338275}, 
+    {242995296,251303705,243123054,251345527}, {239573804,251338275,239406373,251383388}, {243123054,251345527,243248868,251390937}, 
+    {239406373,251383388,239237580,251432159}, {243248868,251390937,243372713,251439930}, {239237580,251432159,239067448,251484591}, 
+    {243372713,251439930,243494568,251492504}, {239067448,251484591,238723264,251600448}, {243494568,251492504,243614408,251548656}, 
+    {243614408,251548656,243732211,251608384}, {238723264,251600448,241132800,253734272}, {243732211,251608384,243847952,251671684}, 
+    {243847952,251671684,243961609,251738554}, {243961609,251738554,244073158,251808991}, {244073158,251808991,244182576,251882992}, 
+    {244182576,251882992,244289840,251960554}, {244289840,251960554,244394926,252041674}, {244394926,252041674,244497811,252126349}, 
+    {244497811,252126349,244598472,252214577}, {244598472,252214577,244696885,252306355}, {244696885,252306355,244793027,252401680}, 
+    {244793027,252401680,244886875,252500549}, {244886875,252500549,244978406,252602959}, {244978406,252602959,245067596,252708907}, 
+    {245067596,252708907,245154421,252818391}, {245154421,252818391,245238859,252931408}, {245238859,252931408,245320886,253047954}, 
+    {245320886,253047954,245400479,253168027}, {245400479,253168027,245477614,253291625}, {245477614,253291625,245552269,253418743}, 
+    {245552269,253418743,245624420,253549381}, {224258112,253499136,227342208,257169024}, {224258112,253499136,224210432,256909632}, 
+    {245624420,253549381,245694043,253683533}, {245694043,253683533,245761116,253821199}, {241132800,253734272,238653568,256343040}, 
+    {245761116,253821199,245825614,253962374}, {245825614,253962374,245887515,254107057}, {245887515,254107057,245946796,254255243}, 
+    {245946796,254255243,246003432,254406931}, {246003432,254406931,246057401,254562118}, {246057401,254562118,246108680,254720800}, 
+    {246108680,254720800,246157245,254882975}, {246157245,254882975,246203072,255048640}, {246203072,255048640,246238635,255191551}, 
+    {246238635,255191551,246269323,255333828}, {235380288,255203392,231626176,258958144}, {235380288,255203392,228286336,255710976}, 
+    {246269323,255333828,246295228,255475429}, {246295228,255475429,246316440,255616310}, {246316440,255616310,246333051,255756430}, 
+    {246333051,255756430,246345151,255895746}, {246345151,255895746,246352833,256034216}, {222678144,255952448,224210432,256909632}, 
+    {222678144,255952448,222902592,258153792}, {221088576,256017408,220990784,257198272}, {246352833,256034216,246356187,256171797}, 
+    {246356187,256171797,246355305,256308446}, {246355305,256308446,246350277,256444121}, {238653568,256343040,242660352,257374208}, 
+    {246350277,256444121,246341196,256578780}, {246341196,256578780,246328151,256712380}, {246328151,256712380,246311235,256844878}, 
+    {246311235,256844878,246290538,256976233}, {246290538,256976233,246266153,257106401}, {246266153,257106401,246238169,257235341}, 
+    {227342208,257169024,230696064,257291520}, {220990784,257198272,218513344,257937152}, {246238169,257235341,246206678,257363009}, 
+    {230696064,257291520,229176896,258884544}, {246206678,257363009,246171772,257489364}, {242660352,257374208,241529024,259027136}, 
+    {246171772,257489364,246133542,257614362}, {246133542,257614362,246092078,257737961}, {246092078,257737961,246047473,257860119}, 
+    {246047473,257860119,245999816,257980793}, {218513344,257937152,221127232,260751296}, {245999816,257980793,245949201,258099941}, 
+    {245949201,258099941,245895716,258217521}, {222902592,258153792,221614144,258817216}, {245895716,258217521,245839455,258333489}, 
+    {245839455,258333489,245780508,258447804}, {245780508,258447804,245718966,258560422}, {245718966,258560422,245654920,258671302}, 
+    {245654920,258671302,245588463,258780400}, {245588463,258780400,245519684,258887675}, {221614144,258817216,222654208,259856576}, 
+    {229176896,258884544,230182144,260982784}, {245519684,258887675,245448675,258993084}, {231626176,258958144,231557632,259675840}, 
+    {245448675,258993084,245375528,259096584}, {241529024,259027136,243161088,259489728}, {245375528,259096584,245300333,259198133}, 
+    {245300333,259198133,245223182,259297689}, {245223182,259297689,245144166,259395208}, {245144166,259395208,245063376,259490649}, 
+    {243161088,259489728,242451392,261146624}, {245063376,259490649,244980904,259583969}, {244980904,259583969,244896840,259675126}, 
+    {244896840,259675126,244811276,259764076}, {231557632,259675840,234560064,261296064}, {244811276,259764076,244724303,259850778}, 
+    {244724303,259850778,244636012,259935189}, {222654208,259856576,222829248,261220096}, {244636012,259935189,244546494,260017267}, 
+    {244546494,260017267,244455841,260096968}, {244455841,260096968,244364144,260174252}, {244364144,260174252,244271494,260249074}, 
+    {244271494,260249074,244177983,260321393}, {244177983,260321393,244083701,260391166}, {244083701,260391166,243988739,260458351}, 
+    {243988739,260458351,243893189,260522905}, {243893189,260522905,243797143,260584786}, {243797143,260584786,243700690,260643950}, 
+    {225326464,260606016,222829248,261220096}, {225326464,260606016,227310848,263222592}, {243700690,260643950,243603924,260700357}, 
+    {243603924,260700357,243506934,260753963}, {221127232,260751296,220235200,263857152}, {243506934,260753963,243409812,260804725}, 
+    {243409812,260804725,243312649,260852602}, {243312649,260852602,243215536,260897550}, {243215536,260897550,243118565,260939528}, 
+    {243118565,260939528,243021826,260978493}, {243021826,260978493,242925412,261014402}, {230182144,260982784,228134656,261696832}, 
+    {242925412,261014402,242829413,261047212}, {242829413,261047212,242733920,261076883}, {242733920,261076883,242639025,261103369}, 
+    {242639025,261103369,242544818,261126631}, {242544818,261126631,242451392,261146624}, {234560064,261296064,230467648,262671616}, 
+    {228134656,261696832,227310848,263222592}, {224546944,262171968,220235200,263857152}, {224546944,262171968,227877056,266695616}, 
+    {230467648,262671616,231644160,265340224}, {228868672,264329024,227877056,266695616}, {228868672,264329024,231644160,265340224}, 
+};
+
+const Segment SEGMENTS_MID0[] = {
+    {313716672,208541056,313831902,208542514}, {313716672,208541056,313601442,208542514}, {313831902,208542514,313946414,208546865}, 
+    {313601442,208542514,313486930,208546865}, {313946414,208546865,314060171,208554074}, {313486930,208546865,313373173,208554074}, 
+    {314060171,208554074,314173139,208564106}, {313373173,208554074,313260205,208564106}, {314173139,208564106,314285284,208576925}, 
+    {313260205,208564106,313148060,208576925}, {314285284,208576925,314396569,208592498}, {313148060,208576925,313036775,208592498}, 
+    {314396569,208592498,314506960,208610787}, {313036775,208592498,312926384,208610787}, {314506960,208610787,314616422,208631760}, 
+    {312926384,208610787,312816922,208631760}, {314616422,208631760,314724919,208655380}, {312816922,208631760,312708425,208655380}, 
+    {314724919,208655380,314832417,208681612}, {312708425,208655380,312600927,208681612}, {314832417,208681612,314938881,208710421}, 
+    {312600927,208681612,312494463,208710421}, {314938881,208710421,315044275,208741773}, {312494463,208710421,312389069,208741773}, 
+    {315044275,208741773,315148564,208775632}, {312389069,208741773,312284780,208775632}, {315148564,208775632,315251714,208811963}, 
+    {312284780,208775632,312181630,208811963}, {315251714,208811963,315353689,208850732}, {312181630,208811963,312079655,208850732}, 
+    {315353689,208850732,315454454,208891902}, {312079655,208850732,311978890,208891902}, {315454454,208891902,315553974,208935439}, 
+    {311978890,208891902,311879370,208935439}, {315553974,208935439,315652215,208981308}, {311879370,208935439,311781129,208981308}, 
+    {315652215,208981308,315749140,209029474}, {311781129,208981308,311684204,209029474}, {315749140,209029474,315844716,209079902}, 
+    {311684204,209029474,311588628,209079902}, {315844716,209079902,315938906,209132557}, {311588628,209079902,311494438,209132557}, 
+    {315938906,209132557,316031676,209187403}, {311494438,209132557,311401668,209187403}, {316031676,209187403,316122991,209244405}, 
+    {311401668,209187403,311310353,209244405}, {316122991,209244405,316212815,209303529}, {311310353,209244405,311220529,209303529}, 
+    {316212815,209303529,316301114,209364740}, {311220529,209303529,311132230,209364740}, {316301114,209364740,316387853,209428002}, 
+    {311132230,209364740,311045491,209428002}, {316387853,209428002,316472996,209493280}, {311045491,209428002,310960348,209493280}, 
+    {316472996,209493280,316556509,209560539}, {310960348,209493280,310876835,209560539}, {316556509,209560539,316638356,209629745}, 
+    {310876835,209560539,310794988,209629745}, {316638356,209629745,316718502,209700862}, {310794988,209629745,310714842,209700862}, 
+    {316718502,209700862,316796912,209773854}, {310714842,209700862,310636432,209773854}, {316796912,209773854,316873552,209848688}, 
+    {310636432,209773854,310559792,209848688}, {316873552,209848688,316948386,209925328}, {310559792,209848688,310484958,209925328}, 
+    {316948386,209925328,317021378,210003738}, {310484958,209925328,310411966,210003738}, {317021378,210003738,317092495,210083884}, 
+    {310411966,210003738,310340849,210083884}, {317092495,210083884,317161701,210165731}, {310340849,210083884,310271643,210165731}, 
+    {317161701,210165731,317228960,210249244}, {310271643,210165731,310204384,210249244}, {317228960,210249244,317294238,210334387}, 
+    {310204384,210249244,310139106,210334387}, {317294238,210334387,317357500,210421126}, {310139106,210334387,310075844,210421126}, 
+    {317357500,210421126,317418711,210509425}, {310075844,210421126,310014633,210509425}, {317418711,210509425,317477835,210599249}, 
+    {310014633,210509425,309955509,210599249}, {317477835,210599249,317534837,210690564}, {309955509,210599249,309898507,210690564}, 
+    {317534837,210690564,317589683,210783334}, {309898507,210690564,309843661,210783334}, {317589683,210783334,317642338,210877524}, 
+    {309843661,210783334,309791006,210877524}, {317642338,210877524,317692766,210973100}, {309791006,210877524,309740578,210973100}, 
+    {317692766,210973100,317740932,211070025}, {309740578,210973100,309692412,211070025}, {317740932,211070025,317786801,211168266}, 
+    {309692412,211070025,309646543,211168266}, {317786801,211168266,317830338,211267786}, {309646543,211168266,309603006,211267786}, 
+    {317830338,211267786,317871508,211368551}, {309603006,211267786,309561836,211368551}, {317871508,211368551,317910277,211470526}, 
+    {309561836,211368551,309523067,211470526}, {317910277,211470526,317946608,211573676}, {309523067,211470526,309486736,211573676}, 
+    {317946608,211573676,317980467,211677965}, {309486736,211573676,309452877,211677965}, {317980467,211677965,318011819,211783359}, 
+    {309452877,211677965,309421525,211783359}, {318011819,211783359,318040628,211889823}, {309421525,211783359,309392716,211889823}, 
+    {318040628,211889823,318066860,211997321}, {309392716,211889823,309366484,211997321}, {318066860,211997321,318090480,212105818}, 
+    {309366484,211997321,309342864,212105818}, {318090480,212105818,318111453,212215280}, {309342864,212105818,309321891,212215280}, 
+    {318111453,212215280,318129742,212325671}, {309321891,212215280,309303602,212325671}, {318129742,212325671,318145315,212436956}, 
+    {309303602,212325671,309288029,212436956}, {318145315,212436956,318158134,212549101}, {309288029,212436956,309275210,212549101}, 
+    {318158134,212549101,318168166,212662069}, {309275210,212549101,309265178,212662069}, {318168166,212662069,318175375,212775826}, 
+    {309265178,212662069,309257969,212775826}, {318175375,212775826,318179726,212890338}, {309257969,212775826,309253618,212890338}, 
+    {318179726,212890338,318181184,213005568}, {309253618,212890338,309252160,213005568}, {318181184,213005568,318179726,213120798}, 
+    {309252160,213005568,309253618,213120798}, {318179726,213120798,318175375,213235310}, {309253618,213120798,309257969,213235310}, 
+    {318175375,213235310,318168166,213349067}, {309257969,213235310,309265178,213349067}, {318168166,213349067,318158134,213462035}, 
+    {309265178,213349067,309275210,213462035}, {318158134,213462035,318145315,213574180}, {309275210,213462035,309288029,213574180}, 
+    {318145315,213574180,318129742,213685465}, {309288029,213574180,309303602,213685465}, {318129742,213685465,318111453,213795856}, 
+    {309303602,213685465,309321891,213795856}, {318111453,213795856,318090480,213905318}, {309321891,213795856,309342864,213905318}, 
+    {318090480,213905318,318066860,214013815}, {309342864,213905318,309366484,214013815}, {318066860,214013815,318040628,214121313}, 
+    {309366484,214013815,309392716,214121313}, {318040628,214121313,318011819,214227777}, {309392716,214121313,309421525,214227777}, 
+    {318011819,214227777,317980467,214333171}, {309421525,214227777,309452877,214333171}, {317980467,214333171,317946608,214437460}, 
+    {309452877,214333171,309486736,214437460}, {317946608,214437460,317910277,214540610}, {309486736,214437460,309523067,214540610}, 
+    {317910277,214540610,317871508,214642585}, {309523067,214540610,309561836,214642585}, {317871508,214642585,317830338,214743350}, 
+    {309561836,214642585,309603006,214743350}, {317830338,214743350,317786801,214842870}, {309603006,214743350,309646543,214842870}, 
+    {317786801,214842870,317740932,214941111}, {309646543,214842870,309692412,214941111}, {317740932,214941111,317692766,215038036}, 
+    {309692412,214941111,309740578,215038036}, {317692766,215038036,317642338,215133612}, {309740578,215038036,309791006,215133612}, 
+    {317642338,215133612,317589683,215227802}, {309791006,215133612,309843661,215227802}, {317589683,215227802,317534837,215320572}, 
+    {309843661,215227802,309898507,215320572}, {317534837,215320572,317477835,215411887}, {309898507,215320572,309955509,215411887}, 
+    {317477835,215411887,317418711,215501711}, {309955509,215411887,310014633,215501711}, {317418711,215501711,317357500,215590010}, 
+    {310014633,215501711,310075844,215590010}, {317357500,215590010,317294238,215676749}, {310075844,215590010,310139106,215676749}, 
+    {317294238,215676749,317228960,215761892}, {310139106,215676749,310204384,215761892}, {317228960,215761892,317161701,215845405}, 
+    {310204384,215761892,310271643,215845405}, {317161701,215845405,317092495,215927252}, {310271643,215845405,310340849,215927252}, 
+    {317092495,215927252,317021378,216007398}, {310340849,215927252,310411966,216007398}, {317021378,216007398,316948386,216085808}, 
+    {310411966,216007398,310484958,216085808}, {316948386,216085808,316873552,216162448}, {310484958,216085808,310559792,216162448}, 
+    {316873552,216162448,316796912,216237282}, {310559792,216162448,310636432,216237282}, {316796912,216237282,316718502,216310274}, 
+    {310636432,216237282,310714842,216310274}, {316718502,216310274,316638356,216381391}, {310714842,216310274,310794988,216381391}, 
+    {316638356,216381391,316556509,216450597}, {310794988,216381391,310876835,216450597}, {316556509,216450597,316472996,216517856}, 
+    {310876835,216450597,310960348,216517856}, {316472996,216517856,316387853,216583134}, {310960348,216517856,311045491,216583134}, 
+    {316387853,216583134,316301114,216646396}, {311045491,216583134,311132230,216646396}, {316301114,216646396,316212815,216707607}, 
+    {311132230,216646396,311220529,216707607}, {316212815,216707607,316122991,216766731}, {311220529,216707607,311310353,216766731}, 
+    {316122991,216766731,316031676,216823733}, {311310353,216766731,311401668,216823733}, {316031676,216823733,315938906,216878579}, 
+    {311401668,216823733,311494438,216878579}, {315938906,216878579,315844716,216931234}, {311494438,216878579,311588628,216931234}, 
+    {315844716,216931234,315749140,216981662}, {311588628,216931234,311684204,216981662}, {315749140,216981662,315652215,217029828}, 
+    {311684204,216981662,311781129,217029828}, {315652215,217029828,315553974,217075697}, {311781129,217029828,311879370,217075697}, 
+    {315553974,217075697,315454454,217119234}, {311879370,217075697,311978890,217119234}, {315454454,217119234,315353689,217160404}, 
+    {311978890,217119234,312079655,217160404}, {315353689,217160404,315251714,217199173}, {312079655,217160404,312181630,217199173}, 
+    {315251714,217199173,315148564,217235504}, {312181630,217199173,312284780,217235504}, {315148564,217235504,315044275,217269363}, 
+    {312284780,217235504,312389069,217269363}, {315044275,217269363,314938881,217300715}, {312389069,217269363,312494463,217300715}, 
+    {314938881,217300715,314832417,217329524}, {312494463,217300715,312600927,217329524}, {314832417,217329524,314724919,217355756}, 
+    {312600927,217329524,312708425,217355756}, {314724919,217355756,314616422,217379376}, {312708425,217355756,312816922,217379376}, 
+    {314616422,217379376,314506960,217400349}, {312816922,217379376,312926384,217400349}, {314506960,217400349,314396569,217418638}, 
+    {312926384,217400349,313036775,217418638}, {314396569,217418638,314285284,217434211}, {313036775,217418638,313148060,217434211}, 
+    {314285284,217434211,314173139,217447030}, {313148060,217434211,313260205,217447030}, {314173139,217447030,314060171,217457062}, 
+    {313260205,217447030,313373173,217457062}, {314060171,217457062,313946414,217464271}, {313373173,217457062,313486930,217464271}, 
+    {313946414,217464271,313831902,217468622}, {313486930,217464271,313601442,217468622}, {313831902,217468622,313716672,217470080}, 
+    {313601442,217468622,313716672,217470080}, 
+};
+
+const Segment SEGMENTS_MID1[] = {
+    {313717440,191118336,313832670,191119794}, {313717440,191118336,313602210,191119794}, {313832670,191119794,313947182,191124145}, 
+    {313602210,191119794,313487698,191124145}, {313947182,191124145,314060939,191131354}, {313487698,191124145,313373941,191131354}, 
+    {314060939,191131354,314173907,191141386}, {313373941,191131354,313260973,191141386}, {314173907,191141386,314286052,191154205}, 
+    {313260973,191141386,313148828,191154205}, {314286052,191154205,314397337,191169778}, {313148828,191154205,313037543,191169778}, 
+    {314397337,191169778,314507728,191188067}, {313037543,191169778,312927152,191188067}, {314507728,191188067,314617190,191209040}, 
+    {312927152,191188067,312817690,191209040}, {314617190,191209040,314725687,191232660}, {312817690,191209040,312709193,191232660}, 
+    {314725687,191232660,314833185,191258892}, {312709193,191232660,312601695,191258892}, {314833185,191258892,314939649,191287701}, 
+    {312601695,191258892,312495231,191287701}, {314939649,191287701,315045043,191319053}, {312495231,191287701,312389837,191319053}, 
+    {315045043,191319053,315149332,191352912}, {312389837,191319053,312285548,191352912}, {315149332,191352912,315252482,191389243}, 
+    {312285548,191352912,312182398,191389243}, {315252482,191389243,315354457,191428012}, {312182398,191389243,312080423,191428012}, 
+    {315354457,191428012,315455222,191469182}, {312080423,191428012,311979658,191469182}, {315455222,191469182,315554742,191512719}, 
+    {311979658,191469182,311880138,191512719}, {315554742,191512719,315652983,191558588}, {311880138,191512719,311781897,191558588}, 
+    {315652983,191558588,315749908,191606754}, {311781897,191558588,311684972,191606754}, {315749908,191606754,315845484,191657182}, 
+    {311684972,191606754,311589396,191657182}, {315845484,191657182,315939674,191709837}, {311589396,191657182,311495206,191709837}, 
+    {315939674,191709837,316032444,191764683}, {311495206,191709837,311402436,191764683}, {316032444,191764683,316123759,191821685}, 
+    {311402436,191764683,311311121,191821685}, {316123759,191821685,316213583,191880809}, {311311121,191821685,311221297,191880809}, 
+    {316213583,191880809,316301882,191942020}, {311221297,191880809,311132998,191942020}, {316301882,191942020,316388621,192005282}, 
+    {311132998,191942020,311046259,192005282}, {316388621,192005282,316473764,192070560}, {311046259,192005282,310961116,192070560}, 
+    {316473764,192070560,316557277,192137819}, {310961116,192070560,310877603,192137819}, {316557277,192137819,316639124,192207025}, 
+    {310877603,192137819,310795756,192207025}, {316639124,192207025,316719270,192278142}, {310795756,192207025,310715610,192278142}, 
+    {316719270,192278142,316797680,192351134}, {310715610,192278142,310637200,192351134}, {316797680,192351134,316874320,192425968}, 
+    {310637200,192351134,310560560,192425968}, {316874320,192425968,316949154,192502608}, {310560560,192425968,310485726,192502608}, 
+    {316949154,192502608,317022146,192581018}, {310485726,192502608,310412734,192581018}, {317022146,192581018,317093263,192661164}, 
+    {310412734,192581018,310341617,192661164}, {317093263,192661164,317162469,192743011}, {310341617,192661164,310272411,192743011}, 
+    {317162469,192743011,317229728,192826524}, {310272411,192743011,310205152,192826524}, {317229728,192826524,317295006,192911667}, 
+    {310205152,192826524,310139874,192911667}, {317295006,192911667,317358268,192998406}, {310139874,192911667,310076612,192998406}, 
+    {317358268,192998406,317419479,193086705}, {310076612,192998406,310015401,193086705}, {317419479,193086705,317478603,193176529}, 
+    {310015401,193086705,309956277,193176529}, {317478603,193176529,317535605,193267844}, {309956277,193176529,309899275,193267844}, 
+    {317535605,193267844,317590451,193360614}, {309899275,193267844,309844429,193360614}, {317590451,193360614,317643106,193454804}, 
+    {309844429,193360614,309791774,193454804}, {317643106,193454804,317693534,193550380}, {309791774,193454804,309741346,193550380}, 
+    {317693534,193550380,317741700,193647305}, {309741346,193550380,309693180,193647305}, {317741700,193647305,317787569,193745546}, 
+    {309693180,193647305,309647311,193745546}, {317787569,193745546,317831106,193845066}, {309647311,193745546,309603774,193845066}, 
+    {317831106,193845066,317872276,193945831}, {309603774,193845066,309562604,193945831}, {317872276,193945831,317911045,194047806}, 
+    {309562604,193945831,309523835,194047806}, {317911045,194047806,317947376,194150956}, {309523835,194047806,309487504,194150956}, 
+    {317947376,194150956,317981235,194255245}, {309487504,194150956,309453645,194255245}, {317981235,194255245,318012587,194360639}, 
+    {309453645,194255245,309422293,194360639}, {318012587,194360639,318041396,194467103}, {309422293,194360639,309393484,194467103}, 
+    {318041396,194467103,318067628,194574601}, {309393484,194467103,309367252,194574601}, {318067628,194574601,318091248,194683098}, 
+    {309367252,194574601,309343632,194683098}, {318091248,194683098,318112221,194792560}, {309343632,194683098,309322659,194792560}, 
+    {318112221,194792560,318130510,194902951}, {309322659,194792560,309304370,194902951}, {318130510,194902951,318146083,195014236}, 
+    {309304370,194902951,309288797,195014236}, {318146083,195014236,318158902,195126381}, {309288797,195014236,309275978,195126381}, 
+    {318158902,195126381,318168934,195239349}, {309275978,195126381,309265946,195239349}, {318168934,195239349,318176143,195353106}, 
+    {309265946,195239349,309258737,195353106}, {318176143,195353106,318180494,195467618}, {309258737,195353106,309254386,195467618}, 
+    {318180494,195467618,318181952,195582848}, {309254386,195467618,309252928,195582848}, {318181952,195582848,318180494,195698078}, 
+    {309252928,195582848,309254386,195698078}, {318180494,195698078,318176143,195812590}, {309254386,195698078,309258737,195812590}, 
+    {318176143,195812590,318168934,195926347}, {309258737,195812590,309265946,195926347}, {318168934,195926347,318158902,196039315}, 
+    {309265946,195926347,309275978,196039315}, {318158902,196039315,318146083,196151460}, {309275978,196039315,309288797,196151460}, 
+    {318146083,196151460,318130510,196262745}, {309288797,196151460,309304370,196262745}, {318130510,196262745,318112221,196373136}, 
+    {309304370,196262745,309322659,196373136}, {318112221,196373136,318091248,196482598}, {309322659,196373136,309343632,196482598}, 
+    {318091248,196482598,318067628,196591095}, {309343632,196482598,309367252,196591095}, {318067628,196591095,318041396,196698593}, 
+    {309367252,196591095,309393484,196698593}, {318041396,196698593,318012587,196805057}, {309393484,196698593,309422293,196805057}, 
+    {318012587,196805057,317981235,196910451}, {309422293,196805057,309453645,196910451}, {317981235,196910451,317947376,197014740}, 
+    {309453645,196910451,309487504,197014740}, {317947376,197014740,317911045,197117890}, {309487504,197014740,309523835,197117890}, 
+    {317911045,197117890,317872276,197219865}, {309523835,197117890,309562604,197219865}, {317872276,197219865,317831106,197320630}, 
+    {309562604,197219865,309603774,197320630}, {317831106,197320630,317787569,197420150}, {309603774,197320630,309647311,197420150}, 
+    {317787569,197420150,317741700,197518391}, {309647311,197420150,309693180,197518391}, {317741700,197518391,317693534,197615316}, 
+    {309693180,197518391,309741346,197615316}, {317693534,197615316,317643106,197710892}, {309741346,197615316,309791774,197710892}, 
+    {317643106,197710892,317590451,197805082}, {309791774,197710892,309844429,197805082}, {317590451,197805082,317535605,197897852}, 
+    {309844429,197805082,309899275,197897852}, {317535605,197897852,317478603,197989167}, {309899275,197897852,309956277,197989167}, 
+    {317478603,197989167,317419479,198078991}, {309956277,197989167,310015401,198078991}, {317419479,198078991,317358268,198167290}, 
+    {310015401,198078991,310076612,198167290}, {317358268,198167290,317295006,198254029}, {310076612,198167290,310139874,198254029}, 
+    {317295006,198254029,317229728,198339172}, {310139874,198254029,310205152,198339172}, {317229728,198339172,317162469,198422685}, 
+    {310205152,198339172,310272411,198422685}, {317162469,198422685,317093263,198504532}, {310272411,198422685,310341617,198504532}, 
+    {317093263,198504532,317022146,198584678}, {310341617,198504532,310412734,198584678}, {317022146,198584678,316949154,198663088}, 
+    {310412734,198584678,310485726,198663088}, {316949154,198663088,316874320,198739728}, {310485726,198663088,310560560,198739728}, 
+    {316874320,198739728,316797680,198814562}, {310560560,198739728,310637200,198814562}, {316797680,198814562,316719270,198887554}, 
+    {310637200,198814562,310715610,198887554}, {316719270,198887554,316639124,198958671}, {310715610,198887554,310795756,198958671}, 
+    {316639124,198958671,316557277,199027877}, {310795756,198958671,310877603,199027877}, {316557277,199027877,316473764,199095136}, 
+    {310877603,199027877,310961116,199095136}, {316473764,199095136,316388621,199160414}, {310961116,199095136,311046259,199160414}, 
+    {316388621,199160414,316301882,199223676}, {311046259,199160414,311132998,199223676}, {316301882,199223676,316213583,199284887}, 
+    {311132998,199223676,311221297,199284887}, {316213583,199284887,316123759,199344011}, {311221297,199284887,311311121,199344011}, 
+    {316123759,199344011,316032444,199401013}, {311311121,199344011,311402436,199401013}, {316032444,199401013,315939674,199455859}, 
+    {311402436,199401013,311495206,199455859}, {315939674,199455859,315845484,199508514}, {311495206,199455859,311589396,199508514}, 
+    {315845484,199508514,315749908,199558942}, {311589396,199508514,311684972,199558942}, {315749908,199558942,315652983,199607108}, 
+    {311684972,199558942,311781897,199607108}, {315652983,199607108,315554742,199652977}, {311781897,199607108,311880138,199652977}, 
+    {315554742,199652977,315455222,199696514}, {311880138,199652977,311979658,199696514}, {315455222,199696514,315354457,199737684}, 
+    {311979658,199696514,312080423,199737684}, {315354457,199737684,315252482,199776453}, {312080423,199737684,312182398,199776453}, 
+    {315252482,199776453,315149332,199812784}, {312182398,199776453,312285548,199812784}, {315149332,199812784,315045043,199846643}, 
+    {312285548,199812784,312389837,199846643}, {315045043,199846643,314939649,199877995}, {312389837,199846643,312495231,199877995}, 
+    {314939649,199877995,314833185,199906804}, {312495231,199877995,312601695,199906804}, {314833185,199906804,314725687,199933036}, 
+    {312601695,199906804,312709193,199933036}, {314725687,199933036,314617190,199956656}, {312709193,199933036,312817690,199956656}, 
+    {314617190,199956656,314507728,199977629}, {312817690,199956656,312927152,199977629}, {314507728,199977629,314397337,199995918}, 
+    {312927152,199977629,313037543,199995918}, {314397337,199995918,314286052,200011491}, {313037543,199995918,313148828,200011491}, 
+    {314286052,200011491,314173907,200024310}, {313148828,200011491,313260973,200024310}, {314173907,200024310,314060939,200034342}, 
+    {313260973,200024310,313373941,200034342}, {314060939,200034342,313947182,200041551}, {313373941,200034342,313487698,200041551}, 
+    {313947182,200041551,313832670,200045902}, {313487698,200041551,313602210,200045902}, {313832670,200045902,313717440,200047360}, 
+    {313602210,200045902,313717440,200047360}, 
+};
+
+const Segment SEGMENTS_MID2[] = {
+    {308888320,173882496,309003550,173883954}, {308888320,173882496,308773090,173883954}, {309003550,173883954,309118062,173888305}, 
+    {308773090,173883954,308658578,173888305}, {309118062,173888305,309231819,173895514}, {308658578,173888305,308544821,173895514}, 
+    {309231819,173895514,309344787,173905546}, {308544821,173895514,308431853,173905546}, {309344787,173905546,309456932,173918365}, 
+    {308431853,173905546,308319708,173918365}, {309456932,173918365,309568217,173933938}, {308319708,173918365,308208423,173933938}, 
+    {309568217,173933938,309678608,173952227}, {308208423,173933938,308098032,173952227}, {309678608,173952227,309788070,173973200}, 
+    {308098032,173952227,307988570,173973200}, {309788070,173973200,309896567,173996820}, {307988570,173973200,307880073,173996820}, 
+    {309896567,173996820,310004065,174023052}, {307880073,173996820,307772575,174023052}, {310004065,174023052,310110529,174051861}, 
+    {307772575,174023052,307666111,174051861}, {310110529,174051861,310215923,174083213}, {307666111,174051861,307560717,174083213}, 
+    {310215923,174083213,310320212,174117072}, {307560717,174083213,307456428,174117072}, {310320212,174117072,310423362,174153403}, 
+    {307456428,174117072,307353278,174153403}, {310423362,174153403,310525337,174192172}, {307353278,174153403,307251303,174192172}, 
+    {310525337,174192172,310626102,174233342}, {307251303,174192172,307150538,174233342}, {310626102,174233342,310725622,174276879}, 
+    {307150538,174233342,307051018,174276879}, {310725622,174276879,310823863,174322748}, {307051018,174276879,306952777,174322748}, 
+    {310823863,174322748,310920788,174370914}, {306952777,174322748,306855852,174370914}, {310920788,174370914,311016364,174421342}, 
+    {306855852,174370914,306760276,174421342}, {311016364,174421342,311110554,174473997}, {306760276,174421342,306666086,174473997}, 
+    {311110554,174473997,311203324,174528843}, {306666086,174473997,306573316,174528843}, {311203324,174528843,311294639,174585845}, 
+    {306573316,174528843,306482001,174585845}, {311294639,174585845,311384463,174644969}, {306482001,174585845,306392177,174644969}, 
+    {311384463,174644969,311472762,174706180}, {306392177,174644969,306303878,174706180}, {311472762,174706180,311559501,174769442}, 
+    {306303878,174706180,306217139,174769442}, {311559501,174769442,311644644,174834720}, {306217139,174769442,306131996,174834720}, 
+    {311644644,174834720,311728157,174901979}, {306131996,174834720,306048483,174901979}, {311728157,174901979,311810004,174971185}, 
+    {306048483,174901979,305966636,174971185}, {311810004,174971185,311890150,175042302}, {305966636,174971185,305886490,175042302}, 
+    {311890150,175042302,311968560,175115294}, {305886490,175042302,305808080,175115294}, {311968560,175115294,312045200,175190128}, 
+    {305808080,175115294,305731440,175190128}, {312045200,175190128,312120034,175266768}, {305731440,175190128,305656606,175266768}, 
+    {312120034,175266768,312193026,175345178}, {305656606,175266768,305583614,175345178}, {312193026,175345178,312264143,175425324}, 
+    {305583614,175345178,305512497,175425324}, {312264143,175425324,312333349,175507171}, {305512497,175425324,305443291,175507171}, 
+    {312333349,175507171,312400608,175590684}, {305443291,175507171,305376032,175590684}, {312400608,175590684,312465886,175675827}, 
+    {305376032,175590684,305310754,175675827}, {312465886,175675827,312529148,175762566}, {305310754,175675827,305247492,175762566}, 
+    {312529148,175762566,312590359,175850865}, {305247492,175762566,305186281,175850865}, {312590359,175850865,312649483,175940689}, 
+    {305186281,175850865,305127157,175940689}, {312649483,175940689,312706485,176032004}, {305127157,175940689,305070155,176032004}, 
+    {312706485,176032004,312761331,176124774}, {305070155,176032004,305015309,176124774}, {312761331,176124774,312813986,176218964}, 
+    {305015309,176124774,304962654,176218964}, {312813986,176218964,312864414,176314540}, {304962654,176218964,304912226,176314540}, 
+    {312864414,176314540,312912580,176411465}, {304912226,176314540,304864060,176411465}, {312912580,176411465,312958449,176509706}, 
+    {304864060,176411465,304818191,176509706}, {312958449,176509706,313001986,176609226}, {304818191,176509706,304774654,176609226}, 
+    {313001986,176609226,313043156,176709991}, {304774654,176609226,304733484,176709991}, {313043156,176709991,313081925,176811966}, 
+    {304733484,176709991,304694715,176811966}, {313081925,176811966,313118256,176915116}, {304694715,176811966,304658384,176915116}, 
+    {313118256,176915116,313152115,177019405}, {304658384,176915116,304624525,177019405}, {313152115,177019405,313183467,177124799}, 
+    {304624525,177019405,304593173,177124799}, {313183467,177124799,313212276,177231263}, {304593173,177124799,304564364,177231263}, 
+    {313212276,177231263,313238508,177338761}, {304564364,177231263,304538132,177338761}, {313238508,177338761,313262128,177447258}, 
+    {304538132,177338761,304514512,177447258}, {313262128,177447258,313283101,177556720}, {304514512,177447258,304493539,177556720}, 
+    {313283101,177556720,313301390,177667111}, {304493539,177556720,304475250,177667111}, {313301390,177667111,313316963,177778396}, 
+    {304475250,177667111,304459677,177778396}, {313316963,177778396,313329782,177890541}, {304459677,177778396,304446858,177890541}, 
+    {313329782,177890541,313339814,178003509}, {304446858,177890541,304436826,178003509}, {313339814,178003509,313347023,178117266}, 
+    {304436826,178003509,304429617,178117266}, {313347023,178117266,313351374,178231778}, {304429617,178117266,304425266,178231778}, 
+    {313351374,178231778,313352832,178347008}, {304425266,178231778,304423808,178347008}, {313352832,178347008,313351374,178462238}, 
+    {304423808,178347008,304425266,178462238}, {313351374,178462238,313347023,178576750}, {304425266,178462238,304429617,178576750}, 
+    {313347023,178576750,313339814,178690507}, {304429617,178576750,304436826,178690507}, {313339814,178690507,313329782,178803475}, 
+    {304436826,178690507,304446858,178803475}, {313329782,178803475,313316963,178915620}, {304446858,178803475,304459677,178915620}, 
+    {313316963,178915620,313301390,179026905}, {304459677,178915620,304475250,179026905}, {313301390,179026905,313283101,179137296}, 
+    {304475250,179026905,304493539,179137296}, {313283101,179137296,313262128,179246758}, {304493539,179137296,304514512,179246758}, 
+    {313262128,179246758,313238508,179355255}, {304514512,179246758,304538132,179355255}, {313238508,179355255,313212276,179462753}, 
+    {304538132,179355255,304564364,179462753}, {313212276,179462753,313183467,179569217}, {304564364,179462753,304593173,179569217}, 
+    {313183467,179569217,313152115,179674611}, {304593173,179569217,304624525,179674611}, {313152115,179674611,313118256,179778900}, 
+    {304624525,179674611,304658384,179778900}, {313118256,179778900,313081925,179882050}, {304658384,179778900,304694715,179882050}, 
+    {313081925,179882050,313043156,179984025}, {304694715,179882050,304733484,179984025}, {313043156,179984025,313001986,180084790}, 
+    {304733484,179984025,304774654,180084790}, {313001986,180084790,312958449,180184310}, {304774654,180084790,304818191,180184310}, 
+    {312958449,180184310,312912580,180282551}, {304818191,180184310,304864060,180282551}, {312912580,180282551,312864414,180379476}, 
+    {304864060,180282551,304912226,180379476}, {312864414,180379476,312813986,180475052}, {304912226,180379476,304962654,180475052}, 
+    {312813986,180475052,312761331,180569242}, {304962654,180475052,305015309,180569242}, {312761331,180569242,312706485,180662012}, 
+    {305015309,180569242,305070155,180662012}, {312706485,180662012,312649483,180753327}, {305070155,180662012,305127157,180753327}, 
+    {312649483,180753327,312590359,180843151}, {305127157,180753327,305186281,180843151}, {312590359,180843151,312529148,180931450}, 
+    {305186281,180843151,305247492,180931450}, {312529148,180931450,312465886,181018189}, {305247492,180931450,305310754,181018189}, 
+    {312465886,181018189,312400608,181103332}, {305310754,181018189,305376032,181103332}, {312400608,181103332,312333349,181186845}, 
+    {305376032,181103332,305443291,181186845}, {312333349,181186845,312264143,181268692}, {305443291,181186845,305512497,181268692}, 
+    {312264143,181268692,312193026,181348838}, {305512497,181268692,305583614,181348838}, {312193026,181348838,312120034,181427248}, 
+    {305583614,181348838,305656606,181427248}, {312120034,181427248,312045200,181503888}, {305656606,181427248,305731440,181503888}, 
+    {312045200,181503888,311968560,181578722}, {305731440,181503888,305808080,181578722}, {311968560,181578722,311890150,181651714}, 
+    {305808080,181578722,305886490,181651714}, {311890150,181651714,311810004,181722831}, {305886490,181651714,305966636,181722831}, 
+    {311810004,181722831,311728157,181792037}, {305966636,181722831,306048483,181792037}, {311728157,181792037,311644644,181859296}, 
+    {306048483,181792037,306131996,181859296}, {311644644,181859296,311559501,181924574}, {306131996,181859296,306217139,181924574}, 
+    {311559501,181924574,311472762,181987836}, {306217139,181924574,306303878,181987836}, {311472762,181987836,311384463,182049047}, 
+    {306303878,181987836,306392177,182049047}, {311384463,182049047,311294639,182108171}, {306392177,182049047,306482001,182108171}, 
+    {311294639,182108171,311203324,182165173}, {306482001,182108171,306573316,182165173}, {311203324,182165173,311110554,182220019}, 
+    {306573316,182165173,306666086,182220019}, {311110554,182220019,311016364,182272674}, {306666086,182220019,306760276,182272674}, 
+    {311016364,182272674,310920788,182323102}, {306760276,182272674,306855852,182323102}, {310920788,182323102,310823863,182371268}, 
+    {306855852,182323102,306952777,182371268}, {310823863,182371268,310725622,182417137}, {306952777,182371268,307051018,182417137}, 
+    {310725622,182417137,310626102,182460674}, {307051018,182417137,307150538,182460674}, {310626102,182460674,310525337,182501844}, 
+    {307150538,182460674,307251303,182501844}, {310525337,182501844,310423362,182540613}, {307251303,182501844,307353278,182540613}, 
+    {310423362,182540613,310320212,182576944}, {307353278,182540613,307456428,182576944}, {310320212,182576944,310215923,182610803}, 
+    {307456428,182576944,307560717,182610803}, {310215923,182610803,310110529,182642155}, {307560717,182610803,307666111,182642155}, 
+    {310110529,182642155,310004065,182670964}, {307666111,182642155,307772575,182670964}, {310004065,182670964,309896567,182697196}, 
+    {307772575,182670964,307880073,182697196}, {309896567,182697196,309788070,182720816}, {307880073,182697196,307988570,182720816}, 
+    {309788070,182720816,309678608,182741789}, {307988570,182720816,308098032,182741789}, {309678608,182741789,309568217,182760078}, 
+    {308098032,182741789,308208423,182760078}, {309568217,182760078,309456932,182775651}, {308208423,182760078,308319708,182775651}, 
+    {309456932,182775651,309344787,182788470}, {308319708,182775651,308431853,182788470}, {309344787,182788470,309231819,182798502}, 
+    {308431853,182788470,308544821,182798502}, {309231819,182798502,309118062,182805711}, {308544821,182798502,308658578,182805711}, 
+    {309118062,182805711,309003550,182810062}, {308658578,182805711,308773090,182810062}, {309003550,182810062,308888320,182811520}, 
+    {308773090,182810062,308888320,182811520}, 
+};
+
+const Segment SEGMENTS_MID3[] = {
+    {297645760,160067584,297760990,160069042}, {297645760,160067584,297530530,160069042}, {297760990,160069042,297875502,160073393}, 
+    {297530530,160069042,297416018,160073393}, {297875502,160073393,297989259,160080602}, {297416018,160073393,297302261,160080602}, 
+    {297989259,160080602,298102227,160090634}, {297302261,160080602,297189293,160090634}, {298102227,160090634,298214372,160103453}, 
+    {297189293,160090634,297077148,160103453}, {298214372,160103453,298325657,160119026}, {297077148,160103453,296965863,160119026}, 
+    {298325657,160119026,298436048,160137315}, {296965863,160119026,296855472,160137315}, {298436048,160137315,298545510,160158288}, 
+    {296855472,160137315,296746010,160158288}, {298545510,160158288,298654007,160181908}, {296746010,160158288,296637513,160181908}, 
+    {298654007,160181908,298761505,160208140}, {296637513,160181908,296530015,160208140}, {298761505,160208140,298867969,160236949}, 
+    {296530015,160208140,296423551,160236949}, {298867969,160236949,298973363,160268301}, {296423551,160236949,296318157,160268301}, 
+    {298973363,160268301,299077652,160302160}, {296318157,160268301,296213868,160302160}, {299077652,160302160,299180802,160338491}, 
+    {296213868,160302160,296110718,160338491}, {299180802,160338491,299282777,160377260}, {296110718,160338491,296008743,160377260}, 
+    {299282777,160377260,299383542,160418430}, {296008743,160377260,295907978,160418430}, {299383542,160418430,299483062,160461967}, 
+    {295907978,160418430,295808458,160461967}, {299483062,160461967,299581303,160507836}, {295808458,160461967,295710217,160507836}, 
+    {299581303,160507836,299678228,160556002}, {295710217,160507836,295613292,160556002}, {299678228,160556002,299773804,160606430}, 
+    {295613292,160556002,295517716,160606430}, {299773804,160606430,299867994,160659085}, {295517716,160606430,295423526,160659085}, 
+    {299867994,160659085,299960764,160713931}, {295423526,160659085,295330756,160713931}, {299960764,160713931,300052079,160770933}, 
+    {295330756,160713931,295239441,160770933}, {300052079,160770933,300141903,160830057}, {295239441,160770933,295149617,160830057}, 
+    {300141903,160830057,300230202,160891268}, {295149617,160830057,295061318,160891268}, {300230202,160891268,300316941,160954530}, 
+    {295061318,160891268,294974579,160954530}, {300316941,160954530,300402084,161019808}, {294974579,160954530,294889436,161019808}, 
+    {300402084,161019808,300485597,161087067}, {294889436,161019808,294805923,161087067}, {300485597,161087067,300567444,161156273}, 
+    {294805923,161087067,294724076,161156273}, {300567444,161156273,300647590,161227390}, {294724076,161156273,294643930,161227390}, 
+    {300647590,161227390,300726000,161300382}, {294643930,161227390,294565520,161300382}, {300726000,161300382,300802640,161375216}, 
+    {294565520,161300382,294488880,161375216}, {300802640,161375216,300877474,161451856}, {294488880,161375216,294414046,161451856}, 
+    {300877474,161451856,300950466,161530266}, {294414046,161451856,294341054,161530266}, {300950466,161530266,301021583,161610412}, 
+    {294341054,161530266,294269937,161610412}, {301021583,161610412,301090789,161692259}, {294269937,161610412,294200731,161692259}, 
+    {301090789,161692259,301158048,161775772}, {294200731,161692259,294133472,161775772}, {301158048,161775772,301223326,161860915}, 
+    {294133472,161775772,294068194,161860915}, {301223326,161860915,301286588,161947654}, {294068194,161860915,294004932,161947654}, 
+    {301286588,161947654,301347799,162035953}, {294004932,161947654,293943721,162035953}, {301347799,162035953,301406923,162125777}, 
+    {293943721,162035953,293884597,162125777}, {301406923,162125777,301463925,162217092}, {293884597,162125777,293827595,162217092}, 
+    {301463925,162217092,301518771,162309862}, {293827595,162217092,293772749,162309862}, {301518771,162309862,301571426,162404052}, 
+    {293772749,162309862,293720094,162404052}, {301571426,162404052,301621854,162499628}, {293720094,162404052,293669666,162499628}, 
+    {301621854,162499628,301670020,162596553}, {293669666,162499628,293621500,162596553}, {301670020,162596553,301715889,162694794}, 
+    {293621500,162596553,293575631,162694794}, {301715889,162694794,301759426,162794314}, {293575631,162694794,293532094,162794314}, 
+    {301759426,162794314,301800596,162895079}, {293532094,162794314,293490924,162895079}, {301800596,162895079,301839365,162997054}, 
+    {293490924,162895079,293452155,162997054}, {301839365,162997054,301875696,163100204}, {293452155,162997054,293415824,163100204}, 
+    {301875696,163100204,301909555,163204493}, {293415824,163100204,293381965,163204493}, {301909555,163204493,301940907,163309887}, 
+    {293381965,163204493,293350613,163309887}, {301940907,163309887,301969716,163416351}, {293350613,163309887,293321804,163416351}, 
+    {301969716,163416351,301995948,163523849}, {293321804,163416351,293295572,163523849}, {301995948,163523849,302019568,163632346}, 
+    {293295572,163523849,293271952,163632346}, {302019568,163632346,302040541,163741808}, {293271952,163632346,293250979,163741808}, 
+    {302040541,163741808,302058830,163852199}, {293250979,163741808,293232690,163852199}, {302058830,163852199,302074403,163963484}, 
+    {293232690,163852199,293217117,163963484}, {302074403,163963484,302087222,164075629}, {293217117,163963484,293204298,164075629}, 
+    {302087222,164075629,302097254,164188597}, {293204298,164075629,293194266,164188597}, {302097254,164188597,302104463,164302354}, 
+    {293194266,164188597,293187057,164302354}, {302104463,164302354,302108814,164416866}, {293187057,164302354,293182706,164416866}, 
+    {302108814,164416866,302110272,164532096}, {293182706,164416866,293181248,164532096}, {302110272,164532096,302108814,164647326}, 
+    {293181248,164532096,293182706,164647326}, {302108814,164647326,302104463,164761838}, {293182706,164647326,293187057,164761838}, 
+    {302104463,164761838,302097254,164875595}, {293187057,164761838,293194266,164875595}, {302097254,164875595,302087222,164988563}, 
+    {293194266,164875595,293204298,164988563}, {302087222,164988563,302074403,165100708}, {293204298,164988563,293217117,165100708}, 
+    {302074403,165100708,302058830,165211993}, {293217117,165100708,293232690,165211993}, {302058830,165211993,302040541,165322384}, 
+    {293232690,165211993,293250979,165322384}, {302040541,165322384,302019568,165431846}, {293250979,165322384,293271952,165431846}, 
+    {302019568,165431846,301995948,165540343}, {293271952,165431846,293295572,165540343}, {301995948,165540343,301969716,165647841}, 
+    {293295572,165540343,293321804,165647841}, {301969716,165647841,301940907,165754305}, {293321804,165647841,293350613,165754305}, 
+    {301940907,165754305,301909555,165859699}, {293350613,165754305,293381965,165859699}, {301909555,165859699,301875696,165963988}, 
+    {293381965,165859699,293415824,165963988}, {301875696,165963988,301839365,166067138}, {293415824,165963988,293452155,166067138}, 
+    {301839365,166067138,301800596,166169113}, {293452155,166067138,293490924,166169113}, {301800596,166169113,301759426,166269878}, 
+    {293490924,166169113,293532094,166269878}, {301759426,166269878,301715889,166369398}, {293532094,166269878,293575631,166369398}, 
+    {301715889,166369398,301670020,166467639}, {293575631,166369398,293621500,166467639}, {301670020,166467639,301621854,166564564}, 
+    {293621500,166467639,293669666,166564564}, {301621854,166564564,301571426,166660140}, {293669666,166564564,293720094,166660140}, 
+    {301571426,166660140,301518771,166754330}, {293720094,166660140,293772749,166754330}, {301518771,166754330,301463925,166847100}, 
+    {293772749,166754330,293827595,166847100}, {301463925,166847100,301406923,166938415}, {293827595,166847100,293884597,166938415}, 
+    {301406923,166938415,301347799,167028239}, {293884597,166938415,293943721,167028239}, {301347799,167028239,301286588,167116538}, 
+    {293943721,167028239,294004932,167116538}, {301286588,167116538,301223326,167203277}, {294004932,167116538,294068194,167203277}, 
+    {301223326,167203277,301158048,167288420}, {294068194,167203277,294133472,167288420}, {301158048,167288420,301090789,167371933}, 
+    {294133472,167288420,294200731,167371933}, {301090789,167371933,301021583,167453780}, {294200731,167371933,294269937,167453780}, 
+    {301021583,167453780,300950466,167533926}, {294269937,167453780,294341054,167533926}, {300950466,167533926,300877474,167612336}, 
+    {294341054,167533926,294414046,167612336}, {300877474,167612336,300802640,167688976}, {294414046,167612336,294488880,167688976}, 
+    {300802640,167688976,300726000,167763810}, {294488880,167688976,294565520,167763810}, {300726000,167763810,300647590,167836802}, 
+    {294565520,167763810,294643930,167836802}, {300647590,167836802,300567444,167907919}, {294643930,167836802,294724076,167907919}, 
+    {300567444,167907919,300485597,167977125}, {294724076,167907919,294805923,167977125}, {300485597,167977125,300402084,168044384}, 
+    {294805923,167977125,294889436,168044384}, {300402084,168044384,300316941,168109662}, {294889436,168044384,294974579,168109662}, 
+    {300316941,168109662,300230202,168172924}, {294974579,168109662,295061318,168172924}, {300230202,168172924,300141903,168234135}, 
+    {295061318,168172924,295149617,168234135}, {300141903,168234135,300052079,168293259}, {295149617,168234135,295239441,168293259}, 
+    {300052079,168293259,299960764,168350261}, {295239441,168293259,295330756,168350261}, {299960764,168350261,299867994,168405107}, 
+    {295330756,168350261,295423526,168405107}, {299867994,168405107,299773804,168457762}, {295423526,168405107,295517716,168457762}, 
+    {299773804,168457762,299678228,168508190}, {295517716,168457762,295613292,168508190}, {299678228,168508190,299581303,168556356}, 
+    {295613292,168508190,295710217,168556356}, {299581303,168556356,299483062,168602225}, {295710217,168556356,295808458,168602225}, 
+    {299483062,168602225,299383542,168645762}, {295808458,168602225,295907978,168645762}, {299383542,168645762,299282777,168686932}, 
+    {295907978,168645762,296008743,168686932}, {299282777,168686932,299180802,168725701}, {296008743,168686932,296110718,168725701}, 
+    {299180802,168725701,299077652,168762032}, {296110718,168725701,296213868,168762032}, {299077652,168762032,298973363,168795891}, 
+    {296213868,168762032,296318157,168795891}, {298973363,168795891,298867969,168827243}, {296318157,168795891,296423551,168827243}, 
+    {298867969,168827243,298761505,168856052}, {296423551,168827243,296530015,168856052}, {298761505,168856052,298654007,168882284}, 
+    {296530015,168856052,296637513,168882284}, {298654007,168882284,298545510,168905904}, {296637513,168882284,296746010,168905904}, 
+    {298545510,168905904,298436048,168926877}, {296746010,168905904,296855472,168926877}, {298436048,168926877,298325657,168945166}, 
+    {296855472,168926877,296965863,168945166}, {298325657,168945166,298214372,168960739}, {296965863,168945166,297077148,168960739}, 
+    {298214372,168960739,298102227,168973558}, {297077148,168960739,297189293,168973558}, {298102227,168973558,297989259,168983590}, 
+    {297189293,168973558,297302261,168983590}, {297989259,168983590,297875502,168990799}, {297302261,168983590,297416018,168990799}, 
+    {297875502,168990799,297760990,168995150}, {297416018,168990799,297530530,168995150}, {297760990,168995150,297645760,168996608}, 
+    {297530530,168995150,297645760,168996608}, 
+};
+
+const Segment SEGMENTS_MID4[] = {
+    {281622272,152295424,281737502,152296882}, {281622272,152295424,281507042,152296882}, {281737502,152296882,281852014,152301233}, 
+    {281507042,152296882,281392530,152301233}, {281852014,152301233,281965771,152308442}, {281392530,152301233,281278773,152308442}, 
+    {281965771,152308442,282078739,152318474}, {281278773,152308442,281165805,152318474}, {282078739,152318474,282190884,152331293}, 
+    {281165805,152318474,281053660,152331293}, {282190884,152331293,282302169,152346866}, {281053660,152331293,280942375,152346866}, 
+    {282302169,152346866,282412560,152365155}, {280942375,152346866,280831984,152365155}, {282412560,152365155,282522022,152386128}, 
+    {280831984,152365155,280722522,152386128}, {282522022,152386128,282630519,152409748}, {280722522,152386128,280614025,152409748}, 
+    {282630519,152409748,282738017,152435980}, {280614025,152409748,280506527,152435980}, {282738017,152435980,282844481,152464789}, 
+    {280506527,152435980,280400063,152464789}, {282844481,152464789,282949875,152496141}, {280400063,152464789,280294669,152496141}, 
+    {282949875,152496141,283054164,152530000}, {280294669,152496141,280190380,152530000}, {283054164,152530000,283157314,152566331}, 
+    {280190380,152530000,280087230,152566331}, {283157314,152566331,283259289,152605100}, {280087230,152566331,279985255,152605100}, 
+    {283259289,152605100,283360054,152646270}, {279985255,152605100,279884490,152646270}, {283360054,152646270,283459574,152689807}, 
+    {279884490,152646270,279784970,152689807}, {283459574,152689807,283557815,152735676}, {279784970,152689807,279686729,152735676}, 
+    {283557815,152735676,283654740,152783842}, {279686729,152735676,279589804,152783842}, {283654740,152783842,283750316,152834270}, 
+    {279589804,152783842,279494228,152834270}, {283750316,152834270,283844506,152886925}, {279494228,152834270,279400038,152886925}, 
+    {283844506,152886925,283937276,152941771}, {279400038,152886925,279307268,152941771}, {283937276,152941771,284028591,152998773}, 
+    {279307268,152941771,279215953,152998773}, {284028591,152998773,284118415,153057897}, {279215953,152998773,279126129,153057897}, 
+    {284118415,153057897,284206714,153119108}, {279126129,153057897,279037830,153119108}, {284206714,153119108,284293453,153182370}, 
+    {279037830,153119108,278951091,153182370}, {284293453,153182370,284378596,153247648}, {278951091,153182370,278865948,153247648}, 
+    {284378596,153247648,284462109,153314907}, {278865948,153247648,278782435,153314907}, {284462109,153314907,284543956,153384113}, 
+    {278782435,153314907,278700588,153384113}, {284543956,153384113,284624102,153455230}, {278700588,153384113,278620442,153455230}, 
+    {284624102,153455230,284702512,153528222}, {278620442,153455230,278542032,153528222}, {284702512,153528222,284779152,153603056}, 
+    {278542032,153528222,278465392,153603056}, {284779152,153603056,284853986,153679696}, {278465392,153603056,278390558,153679696}, 
+    {284853986,153679696,284926978,153758106}, {278390558,153679696,278317566,153758106}, {284926978,153758106,284998095,153838252}, 
+    {278317566,153758106,278246449,153838252}, {284998095,153838252,285067301,153920099}, {278246449,153838252,278177243,153920099}, 
+    {285067301,153920099,285134560,154003612}, {278177243,153920099,278109984,154003612}, {285134560,154003612,285199838,154088755}, 
+    {278109984,154003612,278044706,154088755}, {285199838,154088755,285263100,154175494}, {278044706,154088755,277981444,154175494}, 
+    {285263100,154175494,285324311,154263793}, {277981444,154175494,277920233,154263793}, {285324311,154263793,285383435,154353617}, 
+    {277920233,154263793,277861109,154353617}, {285383435,154353617,285440437,154444932}, {277861109,154353617,277804107,154444932}, 
+    {285440437,154444932,285495283,154537702}, {277804107,154444932,277749261,154537702}, {285495283,154537702,285547938,154631892}, 
+    {277749261,154537702,277696606,154631892}, {285547938,154631892,285598366,154727468}, {277696606,154631892,277646178,154727468}, 
+    {285598366,154727468,285646532,154824393}, {277646178,154727468,277598012,154824393}, {285646532,154824393,285692401,154922634}, 
+    {277598012,154824393,277552143,154922634}, {285692401,154922634,285735938,155022154}, {277552143,154922634,277508606,155022154}, 
+    {285735938,155022154,285777108,155122919}, {277508606,155022154,277467436,155122919}, {285777108,155122919,285815877,155224894}, 
+    {277467436,155122919,277428667,155224894}, {285815877,155224894,285852208,155328044}, {277428667,155224894,277392336,155328044}, 
+    {285852208,155328044,285886067,155432333}, {277392336,155328044,277358477,155432333}, {285886067,155432333,285917419,155537727}, 
+    {277358477,155432333,277327125,155537727}, {285917419,155537727,285946228,155644191}, {277327125,155537727,277298316,155644191}, 
+    {285946228,155644191,285972460,155751689}, {277298316,155644191,277272084,155751689}, {285972460,155751689,285996080,155860186}, 
+    {277272084,155751689,277248464,155860186}, {285996080,155860186,286017053,155969648}, {277248464,155860186,277227491,155969648}, 
+    {286017053,155969648,286035342,156080039}, {277227491,155969648,277209202,156080039}, {286035342,156080039,286050915,156191324}, 
+    {277209202,156080039,277193629,156191324}, {286050915,156191324,286063734,156303469}, {277193629,156191324,277180810,156303469}, 
+    {286063734,156303469,286073766,156416437}, {277180810,156303469,277170778,156416437}, {286073766,156416437,286080975,156530194}, 
+    {277170778,156416437,277163569,156530194}, {286080975,156530194,286085326,156644706}, {277163569,156530194,277159218,156644706}, 
+    {286085326,156644706,286086784,156759936}, {277159218,156644706,277157760,156759936}, {286086784,156759936,286085326,156875166}, 
+    {277157760,156759936,277159218,156875166}, {286085326,156875166,286080975,156989678}, {277159218,156875166,277163569,156989678}, 
+    {286080975,156989678,286073766,157103435}, {277163569,156989678,277170778,157103435}, {286073766,157103435,286063734,157216403}, 
+    {277170778,157103435,277180810,157216403}, {286063734,157216403,286050915,157328548}, {277180810,157216403,277193629,157328548}, 
+    {286050915,157328548,286035342,157439833}, {277193629,157328548,277209202,157439833}, {286035342,157439833,286017053,157550224}, 
+    {277209202,157439833,277227491,157550224}, {286017053,157550224,285996080,157659686}, {277227491,157550224,277248464,157659686}, 
+    {285996080,157659686,285972460,157768183}, {277248464,157659686,277272084,157768183}, {285972460,157768183,285946228,157875681}, 
+    {277272084,157768183,277298316,157875681}, {285946228,157875681,285917419,157982145}, {277298316,157875681,277327125,157982145}, 
+    {285917419,157982145,285886067,158087539}, {277327125,157982145,277358477,158087539}, {285886067,158087539,285852208,158191828}, 
+    {277358477,158087539,277392336,158191828}, {285852208,158191828,285815877,158294978}, {277392336,158191828,277428667,158294978}, 
+    {285815877,158294978,285777108,158396953}, {277428667,158294978,277467436,158396953}, {285777108,158396953,285735938,158497718}, 
+    {277467436,158396953,277508606,158497718}, {285735938,158497718,285692401,158597238}, {277508606,158497718,277552143,158597238}, 
+    {285692401,158597238,285646532,158695479}, {277552143,158597238,277598012,158695479}, {285646532,158695479,285598366,158792404}, 
+    {277598012,158695479,277646178,158792404}, {285598366,158792404,285547938,158887980}, {277646178,158792404,277696606,158887980}, 
+    {285547938,158887980,285495283,158982170}, {277696606,158887980,277749261,158982170}, {285495283,158982170,285440437,159074940}, 
+    {277749261,158982170,277804107,159074940}, {285440437,159074940,285383435,159166255}, {277804107,159074940,277861109,159166255}, 
+    {285383435,159166255,285324311,159256079}, {277861109,159166255,277920233,159256079}, {285324311,159256079,285263100,159344378}, 
+    {277920233,159256079,277981444,159344378}, {285263100,159344378,285199838,159431117}, {277981444,159344378,278044706,159431117}, 
+    {285199838,159431117,285134560,159516260}, {278044706,159431117,278109984,159516260}, {285134560,159516260,285067301,159599773}, 
+    {278109984,159516260,278177243,159599773}, {285067301,159599773,284998095,159681620}, {278177243,159599773,278246449,159681620}, 
+    {284998095,159681620,284926978,159761766}, {278246449,159681620,278317566,159761766}, {284926978,159761766,284853986,159840176}, 
+    {278317566,159761766,278390558,159840176}, {284853986,159840176,284779152,159916816}, {278390558,159840176,278465392,159916816}, 
+    {284779152,159916816,284702512,159991650}, {278465392,159916816,278542032,159991650}, {284702512,159991650,284624102,160064642}, 
+    {278542032,159991650,278620442,160064642}, {284624102,160064642,284543956,160135759}, {278620442,160064642,278700588,160135759}, 
+    {284543956,160135759,284462109,160204965}, {278700588,160135759,278782435,160204965}, {284462109,160204965,284378596,160272224}, 
+    {278782435,160204965,278865948,160272224}, {284378596,160272224,284293453,160337502}, {278865948,160272224,278951091,160337502}, 
+    {284293453,160337502,284206714,160400764}, {278951091,160337502,279037830,160400764}, {284206714,160400764,284118415,160461975}, 
+    {279037830,160400764,279126129,160461975}, {284118415,160461975,284028591,160521099}, {279126129,160461975,279215953,160521099}, 
+    {284028591,160521099,283937276,160578101}, {279215953,160521099,279307268,160578101}, {283937276,160578101,283844506,160632947}, 
+    {279307268,160578101,279400038,160632947}, {283844506,160632947,283750316,160685602}, {279400038,160632947,279494228,160685602}, 
+    {283750316,160685602,283654740,160736030}, {279494228,160685602,279589804,160736030}, {283654740,160736030,283557815,160784196}, 
+    {279589804,160736030,279686729,160784196}, {283557815,160784196,283459574,160830065}, {279686729,160784196,279784970,160830065}, 
+    {283459574,160830065,283360054,160873602}, {279784970,160830065,279884490,160873602}, {283360054,160873602,283259289,160914772}, 
+    {279884490,160873602,279985255,160914772}, {283259289,160914772,283157314,160953541}, {279985255,160914772,280087230,160953541}, 
+    {283157314,160953541,283054164,160989872}, {280087230,160953541,280190380,160989872}, {283054164,160989872,282949875,161023731}, 
+    {280190380,160989872,280294669,161023731}, {282949875,161023731,282844481,161055083}, {280294669,161023731,280400063,161055083}, 
+    {282844481,161055083,282738017,161083892}, {280400063,161055083,280506527,161083892}, {282738017,161083892,282630519,161110124}, 
+    {280506527,161083892,280614025,161110124}, {282630519,161110124,282522022,161133744}, {280614025,161110124,280722522,161133744}, 
+    {282522022,161133744,282412560,161154717}, {280722522,161133744,280831984,161154717}, {282412560,161154717,282302169,161173006}, 
+    {280831984,161154717,280942375,161173006}, {282302169,161173006,282190884,161188579}, {280942375,161173006,281053660,161188579}, 
+    {282190884,161188579,282078739,161201398}, {281053660,161188579,281165805,161201398}, {282078739,161201398,281965771,161211430}, 
+    {281165805,161201398,281278773,161211430}, {281965771,161211430,281852014,161218639}, {281278773,161211430,281392530,161218639}, 
+    {281852014,161218639,281737502,161222990}, {281392530,161218639,281507042,161222990}, {281737502,161222990,281622272,161224448}, 
+    {281507042,161222990,281622272,161224448}, 
+};
+
+const Segment SEGMENTS_MID5[] = {
+    {264494848,152584960,264610078,152586418}, {264494848,152584960,264379618,152586418}, {264610078,152586418,264724590,152590769}, 
+    {264379618,152586418,264265106,152590769}, {264724590,152590769,264838347,152597978}, {264265106,152590769,264151349,152597978}, 
+    {264838347,152597978,264951315,152608010}, {264151349,152597978,264038381,152608010}, {264951315,152608010,265063460,152620829}, 
+    {264038381,152608010,263926236,152620829}, {265063460,152620829,265174745,152636402}, {263926236,152620829,263814951,152636402}, 
+    {265174745,152636402,265285136,152654691}, {263814951,152636402,263704560,152654691}, {265285136,152654691,265394598,152675664}, 
+    {263704560,152654691,263595098,152675664}, {265394598,152675664,265503095,152699284}, {263595098,152675664,263486601,152699284}, 
+    {265503095,152699284,265610593,152725516}, {263486601,152699284,263379103,152725516}, {265610593,152725516,265717057,152754325}, 
+    {263379103,152725516,263272639,152754325}, {265717057,152754325,265822451,152785677}, {263272639,152754325,263167245,152785677}, 
+    {265822451,152785677,265926740,152819536}, {263167245,152785677,263062956,152819536}, {265926740,152819536,266029890,152855867}, 
+    {263062956,152819536,262959806,152855867}, {266029890,152855867,266131865,152894636}, {262959806,152855867,262857831,152894636}, 
+    {266131865,152894636,266232630,152935806}, {262857831,152894636,262757066,152935806}, {266232630,152935806,266332150,152979343}, 
+    {262757066,152935806,262657546,152979343}, {266332150,152979343,266430391,153025212}, {262657546,152979343,262559305,153025212}, 
+    {266430391,153025212,266527316,153073378}, {262559305,153025212,262462380,153073378}, {266527316,153073378,266622892,153123806}, 
+    {262462380,153073378,262366804,153123806}, {266622892,153123806,266717082,153176461}, {262366804,153123806,262272614,153176461}, 
+    {266717082,153176461,266809852,153231307}, {262272614,153176461,262179844,153231307}, {266809852,153231307,266901167,153288309}, 
+    {262179844,153231307,262088529,153288309}, {266901167,153288309,266990991,153347433}, {262088529,153288309,261998705,153347433}, 
+    {266990991,153347433,267079290,153408644}, {261998705,153347433,261910406,153408644}, {267079290,153408644,267166029,153471906}, 
+    {261910406,153408644,261823667,153471906}, {267166029,153471906,267251172,153537184}, {261823667,153471906,261738524,153537184}, 
+    {267251172,153537184,267334685,153604443}, {261738524,153537184,261655011,153604443}, {267334685,153604443,267416532,153673649}, 
+    {261655011,153604443,261573164,153673649}, {267416532,153673649,267496678,153744766}, {261573164,153673649,261493018,153744766}, 
+    {267496678,153744766,267575088,153817758}, {261493018,153744766,261414608,153817758}, {267575088,153817758,267651728,153892592}, 
+    {261414608,153817758,261337968,153892592}, {267651728,153892592,267726562,153969232}, {261337968,153892592,261263134,153969232}, 
+    {267726562,153969232,267799554,154047642}, {261263134,153969232,261190142,154047642}, {267799554,154047642,267870671,154127788}, 
+    {261190142,154047642,261119025,154127788}, {267870671,154127788,267939877,154209635}, {261119025,154127788,261049819,154209635}, 
+    {267939877,154209635,268007136,154293148}, {261049819,154209635,260982560,154293148}, {268007136,154293148,268072414,154378291}, 
+    {260982560,154293148,260917282,154378291}, {268072414,154378291,268135676,154465030}, {260917282,154378291,260854020,154465030}, 
+    {268135676,154465030,268196887,154553329}, {260854020,154465030,260792809,154553329}, {268196887,154553329,268256011,154643153}, 
+    {260792809,154553329,260733685,154643153}, {268256011,154643153,268313013,154734468}, {260733685,154643153,260676683,154734468}, 
+    {268313013,154734468,268367859,154827238}, {260676683,154734468,260621837,154827238}, {268367859,154827238,268420514,154921428}, 
+    {260621837,154827238,260569182,154921428}, {268420514,154921428,268470942,155017004}, {260569182,154921428,260518754,155017004}, 
+    {268470942,155017004,268519108,155113929}, {260518754,155017004,260470588,155113929}, {268519108,155113929,268564977,155212170}, 
+    {260470588,155113929,260424719,155212170}, {268564977,155212170,268608514,155311690}, {260424719,155212170,260381182,155311690}, 
+    {268608514,155311690,268649684,155412455}, {260381182,155311690,260340012,155412455}, {268649684,155412455,268688453,155514430}, 
+    {260340012,155412455,260301243,155514430}, {268688453,155514430,268724784,155617580}, {260301243,155514430,260264912,155617580}, 
+    {268724784,155617580,268758643,155721869}, {260264912,155617580,260231053,155721869}, {268758643,155721869,268789995,155827263}, 
+    {260231053,155721869,260199701,155827263}, {268789995,155827263,268818804,155933727}, {260199701,155827263,260170892,155933727}, 
+    {268818804,155933727,268845036,156041225}, {260170892,155933727,260144660,156041225}, {268845036,156041225,268868656,156149722}, 
+    {260144660,156041225,260121040,156149722}, {268868656,156149722,268889629,156259184}, {260121040,156149722,260100067,156259184}, 
+    {268889629,156259184,268907918,156369575}, {260100067,156259184,260081778,156369575}, {268907918,156369575,268923491,156480860}, 
+    {260081778,156369575,260066205,156480860}, {268923491,156480860,268936310,156593005}, {260066205,156480860,260053386,156593005}, 
+    {268936310,156593005,268946342,156705973}, {260053386,156593005,260043354,156705973}, {268946342,156705973,268953551,156819730}, 
+    {260043354,156705973,260036145,156819730}, {268953551,156819730,268957902,156934242}, {260036145,156819730,260031794,156934242}, 
+    {268957902,156934242,268959360,157049472}, {260031794,156934242,260030336,157049472}, {268959360,157049472,268957902,157164702}, 
+    {260030336,157049472,260031794,157164702}, {268957902,157164702,268953551,157279214}, {260031794,157164702,260036145,157279214}, 
+    {268953551,157279214,268946342,157392971}, {260036145,157279214,260043354,157392971}, {268946342,157392971,268936310,157505939}, 
+    {260043354,157392971,260053386,157505939}, {268936310,157505939,268923491,157618084}, {260053386,157505939,260066205,157618084}, 
+    {268923491,157618084,268907918,157729369}, {260066205,157618084,260081778,157729369}, {268907918,157729369,268889629,157839760}, 
+    {260081778,157729369,260100067,157839760}, {268889629,157839760,268868656,157949222}, {260100067,157839760,260121040,157949222}, 
+    {268868656,157949222,268845036,158057719}, {260121040,157949222,260144660,158057719}, {268845036,158057719,268818804,158165217}, 
+    {260144660,158057719,260170892,158165217}, {268818804,158165217,268789995,158271681}, {260170892,158165217,260199701,158271681}, 
+    {268789995,158271681,268758643,158377075}, {260199701,158271681,260231053,158377075}, {268758643,158377075,268724784,158481364}, 
+    {260231053,158377075,260264912,158481364}, {268724784,158481364,268688453,158584514}, {260264912,158481364,260301243,158584514}, 
+    {268688453,158584514,268649684,158686489}, {260301243,158584514,260340012,158686489}, {268649684,158686489,268608514,158787254}, 
+    {260340012,158686489,260381182,158787254}, {268608514,158787254,268564977,158886774}, {260381182,158787254,260424719,158886774}, 
+    {268564977,158886774,268519108,158985015}, {260424719,158886774,260470588,158985015}, {268519108,158985015,268470942,159081940}, 
+    {260470588,158985015,260518754,159081940}, {268470942,159081940,268420514,159177516}, {260518754,159081940,260569182,159177516}, 
+    {268420514,159177516,268367859,159271706}, {260569182,159177516,260621837,159271706}, {268367859,159271706,268313013,159364476}, 
+    {260621837,159271706,260676683,159364476}, {268313013,159364476,268256011,159455791}, {260676683,159364476,260733685,159455791}, 
+    {268256011,159455791,268196887,159545615}, {260733685,159455791,260792809,159545615}, {268196887,159545615,268135676,159633914}, 
+    {260792809,159545615,260854020,159633914}, {268135676,159633914,268072414,159720653}, {260854020,159633914,260917282,159720653}, 
+    {268072414,159720653,268007136,159805796}, {260917282,159720653,260982560,159805796}, {268007136,159805796,267939877,159889309}, 
+    {260982560,159805796,261049819,159889309}, {267939877,159889309,267870671,159971156}, {261049819,159889309,261119025,159971156}, 
+    {267870671,159971156,267799554,160051302}, {261119025,159971156,261190142,160051302}, {267799554,160051302,267726562,160129712}, 
+    {261190142,160051302,261263134,160129712}, {267726562,160129712,267651728,160206352}, {261263134,160129712,261337968,160206352}, 
+    {267651728,160206352,267575088,160281186}, {261337968,160206352,261414608,160281186}, {267575088,160281186,267496678,160354178}, 
+    {261414608,160281186,261493018,160354178}, {267496678,160354178,267416532,160425295}, {261493018,160354178,261573164,160425295}, 
+    {267416532,160425295,267334685,160494501}, {261573164,160425295,261655011,160494501}, {267334685,160494501,267251172,160561760}, 
+    {261655011,160494501,261738524,160561760}, {267251172,160561760,267166029,160627038}, {261738524,160561760,261823667,160627038}, 
+    {267166029,160627038,267079290,160690300}, {261823667,160627038,261910406,160690300}, {267079290,160690300,266990991,160751511}, 
+    {261910406,160690300,261998705,160751511}, {266990991,160751511,266901167,160810635}, {261998705,160751511,262088529,160810635}, 
+    {266901167,160810635,266809852,160867637}, {262088529,160810635,262179844,160867637}, {266809852,160867637,266717082,160922483}, 
+    {262179844,160867637,262272614,160922483}, {266717082,160922483,266622892,160975138}, {262272614,160922483,262366804,160975138}, 
+    {266622892,160975138,266527316,161025566}, {262366804,160975138,262462380,161025566}, {266527316,161025566,266430391,161073732}, 
+    {262462380,161025566,262559305,161073732}, {266430391,161073732,266332150,161119601}, {262559305,161073732,262657546,161119601}, 
+    {266332150,161119601,266232630,161163138}, {262657546,161119601,262757066,161163138}, {266232630,161163138,266131865,161204308}, 
+    {262757066,161163138,262857831,161204308}, {266131865,161204308,266029890,161243077}, {262857831,161204308,262959806,161243077}, 
+    {266029890,161243077,265926740,161279408}, {262959806,161243077,263062956,161279408}, {265926740,161279408,265822451,161313267}, 
+    {263062956,161279408,263167245,161313267}, {265822451,161313267,265717057,161344619}, {263167245,161313267,263272639,161344619}, 
+    {265717057,161344619,265610593,161373428}, {263272639,161344619,263379103,161373428}, {265610593,161373428,265503095,161399660}, 
+    {263379103,161373428,263486601,161399660}, {265503095,161399660,265394598,161423280}, {263486601,161399660,263595098,161423280}, 
+    {265394598,161423280,265285136,161444253}, {263595098,161423280,263704560,161444253}, {265285136,161444253,265174745,161462542}, 
+    {263704560,161444253,263814951,161462542}, {265174745,161462542,265063460,161478115}, {263814951,161462542,263926236,161478115}, 
+    {265063460,161478115,264951315,161490934}, {263926236,161478115,264038381,161490934}, {264951315,161490934,264838347,161500966}, 
+    {264038381,161490934,264151349,161500966}, {264838347,161500966,264724590,161508175}, {264151349,161500966,264265106,161508175}, 
+    {264724590,161508175,264610078,161512526}, {264265106,161508175,264379618,161512526}, {264610078,161512526,264494848,161513984}, 
+    {264379618,161512526,264494848,161513984}, 
+};
+
+const Segment SEGMENTS_MID6[] = {
+    {248177408,160115264,248292638,160116722}, {248177408,160115264,248062178,160116722}, {248292638,160116722,248407150,160121073}, 
+    {248062178,160116722,247947666,160121073}, {248407150,160121073,248520907,160128282}, {247947666,160121073,247833909,160128282}, 
+    {248520907,160128282,248633875,160138314}, {247833909,160128282,247720941,160138314}, {248633875,160138314,248746020,160151133}, 
+    {247720941,160138314,247608796,160151133}, {248746020,160151133,248857305,160166706}, {247608796,160151133,247497511,160166706}, 
+    {248857305,160166706,248967696,160184995}, {247497511,160166706,247387120,160184995}, {248967696,160184995,249077158,160205968}, 
+    {247387120,160184995,247277658,160205968}, {249077158,160205968,249185655,160229588}, {247277658,160205968,247169161,160229588}, 
+    {249185655,160229588,249293153,160255820}, {247169161,160229588,247061663,160255820}, {249293153,160255820,249399617,160284629}, 
+    {247061663,160255820,246955199,160284629}, {249399617,160284629,249505011,160315981}, {246955199,160284629,246849805,160315981}, 
+    {249505011,160315981,249609300,160349840}, {246849805,160315981,246745516,160349840}, {249609300,160349840,249712450,160386171}, 
+    {246745516,160349840,246642366,160386171}, {249712450,160386171,249814425,160424940}, {246642366,160386171,246540391,160424940}, 
+    {249814425,160424940,249915190,160466110}, {246540391,160424940,246439626,160466110}, {249915190,160466110,250014710,160509647}, 
+    {246439626,160466110,246340106,160509647}, {250014710,160509647,250112951,160555516}, {246340106,160509647,246241865,160555516}, 
+    {250112951,160555516,250209876,160603682}, {246241865,160555516,246144940,160603682}, {250209876,160603682,250305452,160654110}, 
+    {246144940,160603682,246049364,160654110}, {250305452,160654110,250399642,160706765}, {246049364,160654110,245955174,160706765}, 
+    {250399642,160706765,250492412,160761611}, {245955174,160706765,245862404,160761611}, {250492412,160761611,250583727,160818613}, 
+    {245862404,160761611,245771089,160818613}, {250583727,160818613,250673551,160877737}, {245771089,160818613,245681265,160877737}, 
+    {250673551,160877737,250761850,160938948}, {245681265,160877737,245592966,160938948}, {250761850,160938948,250848589,161002210}, 
+    {245592966,160938948,245506227,161002210}, {250848589,161002210,250933732,161067488}, {245506227,161002210,245421084,161067488}, 
+    {250933732,161067488,251017245,161134747}, {245421084,161067488,245337571,161134747}, {251017245,161134747,251099092,161203953}, 
+    {245337571,161134747,245255724,161203953}, {251099092,161203953,251179238,161275070}, {245255724,161203953,245175578,161275070}, 
+    {251179238,161275070,251257648,161348062}, {245175578,161275070,245097168,161348062}, {251257648,161348062,251334288,161422896}, 
+    {245097168,161348062,245020528,161422896}, {251334288,161422896,251409122,161499536}, {245020528,161422896,244945694,161499536}, 
+    {251409122,161499536,251482114,161577946}, {244945694,161499536,244872702,161577946}, {251482114,161577946,251553231,161658092}, 
+    {244872702,161577946,244801585,161658092}, {251553231,161658092,251622437,161739939}, {244801585,161658092,244732379,161739939}, 
+    {251622437,161739939,251689696,161823452}, {244732379,161739939,244665120,161823452}, {251689696,161823452,251754974,161908595}, 
+    {244665120,161823452,244599842,161908595}, {251754974,161908595,251818236,161995334}, {244599842,161908595,244536580,161995334}, 
+    {251818236,161995334,251879447,162083633}, {244536580,161995334,244475369,162083633}, {251879447,162083633,251938571,162173457}, 
+    {244475369,162083633,244416245,162173457}, {251938571,162173457,251995573,162264772}, {244416245,162173457,244359243,162264772}, 
+    {251995573,162264772,252050419,162357542}, {244359243,162264772,244304397,162357542}, {252050419,162357542,252103074,162451732}, 
+    {244304397,162357542,244251742,162451732}, {252103074,162451732,252153502,162547308}, {244251742,162451732,244201314,162547308}, 
+    {252153502,162547308,252201668,162644233}, {244201314,162547308,244153148,162644233}, {252201668,162644233,252247537,162742474}, 
+    {244153148,162644233,244107279,162742474}, {252247537,162742474,252291074,162841994}, {244107279,162742474,244063742,162841994}, 
+    {252291074,162841994,252332244,162942759}, {244063742,162841994,244022572,162942759}, {252332244,162942759,252371013,163044734}, 
+    {244022572,162942759,243983803,163044734}, {252371013,163044734,252407344,163147884}, {243983803,163044734,243947472,163147884}, 
+    {252407344,163147884,252441203,163252173}, {243947472,163147884,243913613,163252173}, {252441203,163252173,252472555,163357567}, 
+    {243913613,163252173,243882261,163357567}, {252472555,163357567,252501364,163464031}, {243882261,163357567,243853452,163464031}, 
+    {252501364,163464031,252527596,163571529}, {243853452,163464031,243827220,163571529}, {252527596,163571529,252551216,163680026}, 
+    {243827220,163571529,243803600,163680026}, {252551216,163680026,252572189,163789488}, {243803600,163680026,243782627,163789488}, 
+    {252572189,163789488,252590478,163899879}, {243782627,163789488,243764338,163899879}, {252590478,163899879,252606051,164011164}, 
+    {243764338,163899879,243748765,164011164}, {252606051,164011164,252618870,164123309}, {243748765,164011164,243735946,164123309}, 
+    {252618870,164123309,252628902,164236277}, {243735946,164123309,243725914,164236277}, {252628902,164236277,252636111,164350034}, 
+    {243725914,164236277,243718705,164350034}, {252636111,164350034,252640462,164464546}, {243718705,164350034,243714354,164464546}, 
+    {252640462,164464546,252641920,164579776}, {243714354,164464546,243712896,164579776}, {252641920,164579776,252640462,164695006}, 
+    {243712896,164579776,243714354,164695006}, {252640462,164695006,252636111,164809518}, {243714354,164695006,243718705,164809518}, 
+    {252636111,164809518,252628902,164923275}, {243718705,164809518,243725914,164923275}, {252628902,164923275,252618870,165036243}, 
+    {243725914,164923275,243735946,165036243}, {252618870,165036243,252606051,165148388}, {243735946,165036243,243748765,165148388}, 
+    {252606051,165148388,252590478,165259673}, {243748765,165148388,243764338,165259673}, {252590478,165259673,252572189,165370064}, 
+    {243764338,165259673,243782627,165370064}, {252572189,165370064,252551216,165479526}, {243782627,165370064,243803600,165479526}, 
+    {252551216,165479526,252527596,165588023}, {243803600,165479526,243827220,165588023}, {252527596,165588023,252501364,165695521}, 
+    {243827220,165588023,243853452,165695521}, {252501364,165695521,252472555,165801985}, {243853452,165695521,243882261,165801985}, 
+    {252472555,165801985,252441203,165907379}, {243882261,165801985,243913613,165907379}, {252441203,165907379,252407344,166011668}, 
+    {243913613,165907379,243947472,166011668}, {252407344,166011668,252371013,166114818}, {243947472,166011668,243983803,166114818}, 
+    {252371013,166114818,252332244,166216793}, {243983803,166114818,244022572,166216793}, {252332244,166216793,252291074,166317558}, 
+    {244022572,166216793,244063742,166317558}, {252291074,166317558,252247537,166417078}, {244063742,166317558,244107279,166417078}, 
+    {252247537,166417078,252201668,166515319}, {244107279,166417078,244153148,166515319}, {252201668,166515319,252153502,166612244}, 
+    {244153148,166515319,244201314,166612244}, {252153502,166612244,252103074,166707820}, {244201314,166612244,244251742,166707820}, 
+    {252103074,166707820,252050419,166802010}, {244251742,166707820,244304397,166802010}, {252050419,166802010,251995573,166894780}, 
+    {244304397,166802010,244359243,166894780}, {251995573,166894780,251938571,166986095}, {244359243,166894780,244416245,166986095}, 
+    {251938571,166986095,251879447,167075919}, {244416245,166986095,244475369,167075919}, {251879447,167075919,251818236,167164218}, 
+    {244475369,167075919,244536580,167164218}, {251818236,167164218,251754974,167250957}, {244536580,167164218,244599842,167250957}, 
+    {251754974,167250957,251689696,167336100}, {244599842,167250957,244665120,167336100}, {251689696,167336100,251622437,167419613}, 
+    {244665120,167336100,244732379,167419613}, {251622437,167419613,251553231,167501460}, {244732379,167419613,244801585,167501460}, 
+    {251553231,167501460,251482114,167581606}, {244801585,167501460,244872702,167581606}, {251482114,167581606,251409122,167660016}, 
+    {244872702,167581606,244945694,167660016}, {251409122,167660016,251334288,167736656}, {244945694,167660016,245020528,167736656}, 
+    {251334288,167736656,251257648,167811490}, {245020528,167736656,245097168,167811490}, {251257648,167811490,251179238,167884482}, 
+    {245097168,167811490,245175578,167884482}, {251179238,167884482,251099092,167955599}, {245175578,167884482,245255724,167955599}, 
+    {251099092,167955599,251017245,168024805}, {245255724,167955599,245337571,168024805}, {251017245,168024805,250933732,168092064}, 
+    {245337571,168024805,245421084,168092064}, {250933732,168092064,250848589,168157342}, {245421084,168092064,245506227,168157342}, 
+    {250848589,168157342,250761850,168220604}, {245506227,168157342,245592966,168220604}, {250761850,168220604,250673551,168281815}, 
+    {245592966,168220604,245681265,168281815}, {250673551,168281815,250583727,168340939}, {245681265,168281815,245771089,168340939}, 
+    {250583727,168340939,250492412,168397941}, {245771089,168340939,245862404,168397941}, {250492412,168397941,250399642,168452787}, 
+    {245862404,168397941,245955174,168452787}, {250399642,168452787,250305452,168505442}, {245955174,168452787,246049364,168505442}, 
+    {250305452,168505442,250209876,168555870}, {246049364,168505442,246144940,168555870}, {250209876,168555870,250112951,168604036}, 
+    {246144940,168555870,246241865,168604036}, {250112951,168604036,250014710,168649905}, {246241865,168604036,246340106,168649905}, 
+    {250014710,168649905,249915190,168693442}, {246340106,168649905,246439626,168693442}, {249915190,168693442,249814425,168734612}, 
+    {246439626,168693442,246540391,168734612}, {249814425,168734612,249712450,168773381}, {246540391,168734612,246642366,168773381}, 
+    {249712450,168773381,249609300,168809712}, {246642366,168773381,246745516,168809712}, {249609300,168809712,249505011,168843571}, 
+    {246745516,168809712,246849805,168843571}, {249505011,168843571,249399617,168874923}, {246849805,168843571,246955199,168874923}, 
+    {249399617,168874923,249293153,168903732}, {246955199,168874923,247061663,168903732}, {249293153,168903732,249185655,168929964}, 
+    {247061663,168903732,247169161,168929964}, {249185655,168929964,249077158,168953584}, {247169161,168929964,247277658,168953584}, 
+    {249077158,168953584,248967696,168974557}, {247277658,168953584,247387120,168974557}, {248967696,168974557,248857305,168992846}, 
+    {247387120,168974557,247497511,168992846}, {248857305,168992846,248746020,169008419}, {247497511,168992846,247608796,169008419}, 
+    {248746020,169008419,248633875,169021238}, {247608796,169008419,247720941,169021238}, {248633875,169021238,248520907,169031270}, 
+    {247720941,169021238,247833909,169031270}, {248520907,169031270,248407150,169038479}, {247833909,169031270,247947666,169038479}, 
+    {248407150,169038479,248292638,169042830}, {247947666,169038479,248062178,169042830}, {248292638,169042830,248177408,169044288}, 
+    {248062178,169042830,248177408,169044288}, 
+};
+
+const Segment SEGMENTS_MID7[] = {
+    {237143552,173744064,237258782,173745522}, {237143552,173744064,237028322,173745522}, {237258782,173745522,237373294,173749873}, 
+    {237028322,173745522,236913810,173749873}, {237373294,173749873,237487051,173757082}, {236913810,173749873,236800053,173757082}, 
+    {237487051,173757082,237600019,173767114}, {236800053,173757082,236687085,173767114}, {237600019,173767114,237712164,173779933}, 
+    {236687085,173767114,236574940,173779933}, {237712164,173779933,237823449,173795506}, {236574940,173779933,236463655,173795506}, 
+    {237823449,173795506,237933840,173813795}, {236463655,173795506,236353264,173813795}, {237933840,173813795,238043302,173834768}, 
+    {236353264,173813795,236243802,173834768}, {238043302,173834768,238151799,173858388}, {236243802,173834768,236135305,173858388}, 
+    {238151799,173858388,238259297,173884620}, {236135305,173858388,236027807,173884620}, {238259297,173884620,238365761,173913429}, 
+    {236027807,173884620,235921343,173913429}, {238365761,173913429,238471155,173944781}, {235921343,173913429,235815949,173944781}, 
+    {238471155,173944781,238575444,173978640}, {235815949,173944781,235711660,173978640}, {238575444,173978640,238678594,174014971}, 
+    {235711660,173978640,235608510,174014971}, {238678594,174014971,238780569,174053740}, {235608510,174014971,235506535,174053740}, 
+    {238780569,174053740,238881334,174094910}, {235506535,174053740,235405770,174094910}, {238881334,174094910,238980854,174138447}, 
+    {235405770,174094910,235306250,174138447}, {238980854,174138447,239079095,174184316}, {235306250,174138447,235208009,174184316}, 
+    {239079095,174184316,239176020,174232482}, {235208009,174184316,235111084,174232482}, {239176020,174232482,239271596,174282910}, 
+    {235111084,174232482,235015508,174282910}, {239271596,174282910,239365786,174335565}, {235015508,174282910,234921318,174335565}, 
+    {239365786,174335565,239458556,174390411}, {234921318,174335565,234828548,174390411}, {239458556,174390411,239549871,174447413}, 
+    {234828548,174390411,234737233,174447413}, {239549871,174447413,239639695,174506537}, {234737233,174447413,234647409,174506537}, 
+    {239639695,174506537,239727994,174567748}, {234647409,174506537,234559110,174567748}, {239727994,174567748,239814733,174631010}, 
+    {234559110,174567748,234472371,174631010}, {239814733,174631010,239899876,174696288}, {234472371,174631010,234387228,174696288}, 
+    {239899876,174696288,239983389,174763547}, {234387228,174696288,234303715,174763547}, {239983389,174763547,240065236,174832753}, 
+    {234303715,174763547,234221868,174832753}, {240065236,174832753,240145382,174903870}, {234221868,174832753,234141722,174903870}, 
+    {240145382,174903870,240223792,174976862}, {234141722,174903870,234063312,174976862}, {240223792,174976862,240300432,175051696}, 
+    {234063312,174976862,233986672,175051696}, {240300432,175051696,240375266,175128336}, {233986672,175051696,233911838,175128336}, 
+    {240375266,175128336,240448258,175206746}, {233911838,175128336,233838846,175206746}, {240448258,175206746,240519375,175286892}, 
+    {233838846,175206746,233767729,175286892}, {240519375,175286892,240588581,175368739}, {233767729,175286892,233698523,175368739}, 
+    {240588581,175368739,240655840,175452252}, {233698523,175368739,233631264,175452252}, {240655840,175452252,240721118,175537395}, 
+    {233631264,175452252,233565986,175537395}, {240721118,175537395,240784380,175624134}, {233565986,175537395,233502724,175624134}, 
+    {240784380,175624134,240845591,175712433}, {233502724,175624134,233441513,175712433}, {240845591,175712433,240904715,175802257}, 
+    {233441513,175712433,233382389,175802257}, {240904715,175802257,240961717,175893572}, {233382389,175802257,233325387,175893572}, 
+    {240961717,175893572,241016563,175986342}, {233325387,175893572,233270541,175986342}, {241016563,175986342,241069218,176080532}, 
+    {233270541,175986342,233217886,176080532}, {241069218,176080532,241119646,176176108}, {233217886,176080532,233167458,176176108}, 
+    {241119646,176176108,241167812,176273033}, {233167458,176176108,233119292,176273033}, {241167812,176273033,241213681,176371274}, 
+    {233119292,176273033,233073423,176371274}, {241213681,176371274,241257218,176470794}, {233073423,176371274,233029886,176470794}, 
+    {241257218,176470794,241298388,176571559}, {233029886,176470794,232988716,176571559}, {241298388,176571559,241337157,176673534}, 
+    {232988716,176571559,232949947,176673534}, {241337157,176673534,241373488,176776684}, {232949947,176673534,232913616,176776684}, 
+    {241373488,176776684,241407347,176880973}, {232913616,176776684,232879757,176880973}, {241407347,176880973,241438699,176986367}, 
+    {232879757,176880973,232848405,176986367}, {241438699,176986367,241467508,177092831}, {232848405,176986367,232819596,177092831}, 
+    {241467508,177092831,241493740,177200329}, {232819596,177092831,232793364,177200329}, {241493740,177200329,241517360,177308826}, 
+    {232793364,177200329,232769744,177308826}, {241517360,177308826,241538333,177418288}, {232769744,177308826,232748771,177418288}, 
+    {241538333,177418288,241556622,177528679}, {232748771,177418288,232730482,177528679}, {241556622,177528679,241572195,177639964}, 
+    {232730482,177528679,232714909,177639964}, {241572195,177639964,241585014,177752109}, {232714909,177639964,232702090,177752109}, 
+    {241585014,177752109,241595046,177865077}, {232702090,177752109,232692058,177865077}, {241595046,177865077,241602255,177978834}, 
+    {232692058,177865077,232684849,177978834}, {241602255,177978834,241606606,178093346}, {232684849,177978834,232680498,178093346}, 
+    {241606606,178093346,241608064,178208576}, {232680498,178093346,232679040,178208576}, {241608064,178208576,241606606,178323806}, 
+    {232679040,178208576,232680498,178323806}, {241606606,178323806,241602255,178438318}, {232680498,178323806,232684849,178438318}, 
+    {241602255,178438318,241595046,178552075}, {232684849,178438318,232692058,178552075}, {241595046,178552075,241585014,178665043}, 
+    {232692058,178552075,232702090,178665043}, {241585014,178665043,241572195,178777188}, {232702090,178665043,232714909,178777188}, 
+    {241572195,178777188,241556622,178888473}, {232714909,178777188,232730482,178888473}, {241556622,178888473,241538333,178998864}, 
+    {232730482,178888473,232748771,178998864}, {241538333,178998864,241517360,179108326}, {232748771,178998864,232769744,179108326}, 
+    {241517360,179108326,241493740,179216823}, {232769744,179108326,232793364,179216823}, {241493740,179216823,241467508,179324321}, 
+    {232793364,179216823,232819596,179324321}, {241467508,179324321,241438699,179430785}, {232819596,179324321,232848405,179430785}, 
+    {241438699,179430785,241407347,179536179}, {232848405,179430785,232879757,179536179}, {241407347,179536179,241373488,179640468}, 
+    {232879757,179536179,232913616,179640468}, {241373488,179640468,241337157,179743618}, {232913616,179640468,232949947,179743618}, 
+    {241337157,179743618,241298388,179845593}, {232949947,179743618,232988716,179845593}, {241298388,179845593,241257218,179946358}, 
+    {232988716,179845593,233029886,179946358}, {241257218,179946358,241213681,180045878}, {233029886,179946358,233073423,180045878}, 
+    {241213681,180045878,241167812,180144119}, {233073423,180045878,233119292,180144119}, {241167812,180144119,241119646,180241044}, 
+    {233119292,180144119,233167458,180241044}, {241119646,180241044,241069218,180336620}, {233167458,180241044,233217886,180336620}, 
+    {241069218,180336620,241016563,180430810}, {233217886,180336620,233270541,180430810}, {241016563,180430810,240961717,180523580}, 
+    {233270541,180430810,233325387,180523580}, {240961717,180523580,240904715,180614895}, {233325387,180523580,233382389,180614895}, 
+    {240904715,180614895,240845591,180704719}, {233382389,180614895,233441513,180704719}, {240845591,180704719,240784380,180793018}, 
+    {233441513,180704719,233502724,180793018}, {240784380,180793018,240721118,180879757}, {233502724,180793018,233565986,180879757}, 
+    {240721118,180879757,240655840,180964900}, {233565986,180879757,233631264,180964900}, {240655840,180964900,240588581,181048413}, 
+    {233631264,180964900,233698523,181048413}, {240588581,181048413,240519375,181130260}, {233698523,181048413,233767729,181130260}, 
+    {240519375,181130260,240448258,181210406}, {233767729,181130260,233838846,181210406}, {240448258,181210406,240375266,181288816}, 
+    {233838846,181210406,233911838,181288816}, {240375266,181288816,240300432,181365456}, {233911838,181288816,233986672,181365456}, 
+    {240300432,181365456,240223792,181440290}, {233986672,181365456,234063312,181440290}, {240223792,181440290,240145382,181513282}, 
+    {234063312,181440290,234141722,181513282}, {240145382,181513282,240065236,181584399}, {234141722,181513282,234221868,181584399}, 
+    {240065236,181584399,239983389,181653605}, {234221868,181584399,234303715,181653605}, {239983389,181653605,239899876,181720864}, 
+    {234303715,181653605,234387228,181720864}, {239899876,181720864,239814733,181786142}, {234387228,181720864,234472371,181786142}, 
+    {239814733,181786142,239727994,181849404}, {234472371,181786142,234559110,181849404}, {239727994,181849404,239639695,181910615}, 
+    {234559110,181849404,234647409,181910615}, {239639695,181910615,239549871,181969739}, {234647409,181910615,234737233,181969739}, 
+    {239549871,181969739,239458556,182026741}, {234737233,181969739,234828548,182026741}, {239458556,182026741,239365786,182081587}, 
+    {234828548,182026741,234921318,182081587}, {239365786,182081587,239271596,182134242}, {234921318,182081587,235015508,182134242}, 
+    {239271596,182134242,239176020,182184670}, {235015508,182134242,235111084,182184670}, {239176020,182184670,239079095,182232836}, 
+    {235111084,182184670,235208009,182232836}, {239079095,182232836,238980854,182278705}, {235208009,182232836,235306250,182278705}, 
+    {238980854,182278705,238881334,182322242}, {235306250,182278705,235405770,182322242}, {238881334,182322242,238780569,182363412}, 
+    {235405770,182322242,235506535,182363412}, {238780569,182363412,238678594,182402181}, {235506535,182363412,235608510,182402181}, 
+    {238678594,182402181,238575444,182438512}, {235608510,182402181,235711660,182438512}, {238575444,182438512,238471155,182472371}, 
+    {235711660,182438512,235815949,182472371}, {238471155,182472371,238365761,182503723}, {235815949,182472371,235921343,182503723}, 
+    {238365761,182503723,238259297,182532532}, {235921343,182503723,236027807,182532532}, {238259297,182532532,238151799,182558764}, 
+    {236027807,182532532,236135305,182558764}, {238151799,182558764,238043302,182582384}, {236135305,182558764,236243802,182582384}, 
+    {238043302,182582384,237933840,182603357}, {236243802,182582384,236353264,182603357}, {237933840,182603357,237823449,182621646}, 
+    {236353264,182603357,236463655,182621646}, {237823449,182621646,237712164,182637219}, {236463655,182621646,236574940,182637219}, 
+    {237712164,182637219,237600019,182650038}, {236574940,182637219,236687085,182650038}, {237600019,182650038,237487051,182660070}, 
+    {236687085,182650038,236800053,182660070}, {237487051,182660070,237373294,182667279}, {236800053,182660070,236913810,182667279}, 
+    {237373294,182667279,237258782,182671630}, {236913810,182667279,237028322,182671630}, {237258782,182671630,237143552,182673088}, 
+    {237028322,182671630,237143552,182673088}, 
+};
+
+const Segment SEGMENTS_MID8[] = {
+    {231942976,191191680,232058206,191193138}, {231942976,191191680,231827746,191193138}, {232058206,191193138,232172718,191197489}, 
+    {231827746,191193138,231713234,191197489}, {232172718,191197489,232286475,191204698}, {231713234,191197489,231599477,191204698}, 
+    {232286475,191204698,232399443,191214730}, {231599477,191204698,231486509,191214730}, {232399443,191214730,232511588,191227549}, 
+    {231486509,191214730,231374364,191227549}, {232511588,191227549,232622873,191243122}, {231374364,191227549,231263079,191243122}, 
+    {232622873,191243122,232733264,191261411}, {231263079,191243122,231152688,191261411}, {232733264,191261411,232842726,191282384}, 
+    {231152688,191261411,231043226,191282384}, {232842726,191282384,232951223,191306004}, {231043226,191282384,230934729,191306004}, 
+    {232951223,191306004,233058721,191332236}, {230934729,191306004,230827231,191332236}, {233058721,191332236,233165185,191361045}, 
+    {230827231,191332236,230720767,191361045}, {233165185,191361045,233270579,191392397}, {230720767,191361045,230615373,191392397}, 
+    {233270579,191392397,233374868,191426256}, {230615373,191392397,230511084,191426256}, {233374868,191426256,233478018,191462587}, 
+    {230511084,191426256,230407934,191462587}, {233478018,191462587,233579993,191501356}, {230407934,191462587,230305959,191501356}, 
+    {233579993,191501356,233680758,191542526}, {230305959,191501356,230205194,191542526}, {233680758,191542526,233780278,191586063}, 
+    {230205194,191542526,230105674,191586063}, {233780278,191586063,233878519,191631932}, {230105674,191586063,230007433,191631932}, 
+    {233878519,191631932,233975444,191680098}, {230007433,191631932,229910508,191680098}, {233975444,191680098,234071020,191730526}, 
+    {229910508,191680098,229814932,191730526}, {234071020,191730526,234165210,191783181}, {229814932,191730526,229720742,191783181}, 
+    {234165210,191783181,234257980,191838027}, {229720742,191783181,229627972,191838027}, {234257980,191838027,234349295,191895029}, 
+    {229627972,191838027,229536657,191895029}, {234349295,191895029,234439119,191954153}, {229536657,191895029,229446833,191954153}, 
+    {234439119,191954153,234527418,192015364}, {229446833,191954153,229358534,192015364}, {234527418,192015364,234614157,192078626}, 
+    {229358534,192015364,229271795,192078626}, {234614157,192078626,234699300,192143904}, {229271795,192078626,229186652,192143904}, 
+    {234699300,192143904,234782813,192211163}, {229186652,192143904,229103139,192211163}, {234782813,192211163,234864660,192280369}, 
+    {229103139,192211163,229021292,192280369}, {234864660,192280369,234944806,192351486}, {229021292,192280369,228941146,192351486}, 
+    {234944806,192351486,235023216,192424478}, {228941146,192351486,228862736,192424478}, {235023216,192424478,235099856,192499312}, 
+    {228862736,192424478,228786096,192499312}, {235099856,192499312,235174690,192575952}, {228786096,192499312,228711262,192575952}, 
+    {235174690,192575952,235247682,192654362}, {228711262,192575952,228638270,192654362}, {235247682,192654362,235318799,192734508}, 
+    {228638270,192654362,228567153,192734508}, {235318799,192734508,235388005,192816355}, {228567153,192734508,228497947,192816355}, 
+    {235388005,192816355,235455264,192899868}, {228497947,192816355,228430688,192899868}, {235455264,192899868,235520542,192985011}, 
+    {228430688,192899868,228365410,192985011}, {235520542,192985011,235583804,193071750}, {228365410,192985011,228302148,193071750}, 
+    {235583804,193071750,235645015,193160049}, {228302148,193071750,228240937,193160049}, {235645015,193160049,235704139,193249873}, 
+    {228240937,193160049,228181813,193249873}, {235704139,193249873,235761141,193341188}, {228181813,193249873,228124811,193341188}, 
+    {235761141,193341188,235815987,193433958}, {228124811,193341188,228069965,193433958}, {235815987,193433958,235868642,193528148}, 
+    {228069965,193433958,228017310,193528148}, {235868642,193528148,235919070,193623724}, {228017310,193528148,227966882,193623724}, 
+    {235919070,193623724,235967236,193720649}, {227966882,193623724,227918716,193720649}, {235967236,193720649,236013105,193818890}, 
+    {227918716,193720649,227872847,193818890}, {236013105,193818890,236056642,193918410}, {227872847,193818890,227829310,193918410}, 
+    {236056642,193918410,236097812,194019175}, {227829310,193918410,227788140,194019175}, {236097812,194019175,236136581,194121150}, 
+    {227788140,194019175,227749371,194121150}, {236136581,194121150,236172912,194224300}, {227749371,194121150,227713040,194224300}, 
+    {236172912,194224300,236206771,194328589}, {227713040,194224300,227679181,194328589}, {236206771,194328589,236238123,194433983}, 
+    {227679181,194328589,227647829,194433983}, {236238123,194433983,236266932,194540447}, {227647829,194433983,227619020,194540447}, 
+    {236266932,194540447,236293164,194647945}, {227619020,194540447,227592788,194647945}, {236293164,194647945,236316784,194756442}, 
+    {227592788,194647945,227569168,194756442}, {236316784,194756442,236337757,194865904}, {227569168,194756442,227548195,194865904}, 
+    {236337757,194865904,236356046,194976295}, {227548195,194865904,227529906,194976295}, {236356046,194976295,236371619,195087580}, 
+    {227529906,194976295,227514333,195087580}, {236371619,195087580,236384438,195199725}, {227514333,195087580,227501514,195199725}, 
+    {236384438,195199725,236394470,195312693}, {227501514,195199725,227491482,195312693}, {236394470,195312693,236401679,195426450}, 
+    {227491482,195312693,227484273,195426450}, {236401679,195426450,236406030,195540962}, {227484273,195426450,227479922,195540962}, 
+    {236406030,195540962,236407488,195656192}, {227479922,195540962,227478464,195656192}, {236407488,195656192,236406030,195771422}, 
+    {227478464,195656192,227479922,195771422}, {236406030,195771422,236401679,195885934}, {227479922,195771422,227484273,195885934}, 
+    {236401679,195885934,236394470,195999691}, {227484273,195885934,227491482,195999691}, {236394470,195999691,236384438,196112659}, 
+    {227491482,195999691,227501514,196112659}, {236384438,196112659,236371619,196224804}, {227501514,196112659,227514333,196224804}, 
+    {236371619,196224804,236356046,196336089}, {227514333,196224804,227529906,196336089}, {236356046,196336089,236337757,196446480}, 
+    {227529906,196336089,227548195,196446480}, {236337757,196446480,236316784,196555942}, {227548195,196446480,227569168,196555942}, 
+    {236316784,196555942,236293164,196664439}, {227569168,196555942,227592788,196664439}, {236293164,196664439,236266932,196771937}, 
+    {227592788,196664439,227619020,196771937}, {236266932,196771937,236238123,196878401}, {227619020,196771937,227647829,196878401}, 
+    {236238123,196878401,236206771,196983795}, {227647829,196878401,227679181,196983795}, {236206771,196983795,236172912,197088084}, 
+    {227679181,196983795,227713040,197088084}, {236172912,197088084,236136581,197191234}, {227713040,197088084,227749371,197191234}, 
+    {236136581,197191234,236097812,197293209}, {227749371,197191234,227788140,197293209}, {236097812,197293209,236056642,197393974}, 
+    {227788140,197293209,227829310,197393974}, {236056642,197393974,236013105,197493494}, {227829310,197393974,227872847,197493494}, 
+    {236013105,197493494,235967236,197591735}, {227872847,197493494,227918716,197591735}, {235967236,197591735,235919070,197688660}, 
+    {227918716,197591735,227966882,197688660}, {235919070,197688660,235868642,197784236}, {227966882,197688660,228017310,197784236}, 
+    {235868642,197784236,235815987,197878426}, {228017310,197784236,228069965,197878426}, {235815987,197878426,235761141,197971196}, 
+    {228069965,197878426,228124811,197971196}, {235761141,197971196,235704139,198062511}, {228124811,197971196,228181813,198062511}, 
+    {235704139,198062511,235645015,198152335}, {228181813,198062511,228240937,198152335}, {235645015,198152335,235583804,198240634}, 
+    {228240937,198152335,228302148,198240634}, {235583804,198240634,235520542,198327373}, {228302148,198240634,228365410,198327373}, 
+    {235520542,198327373,235455264,198412516}, {228365410,198327373,228430688,198412516}, {235455264,198412516,235388005,198496029}, 
+    {228430688,198412516,228497947,198496029}, {235388005,198496029,235318799,198577876}, {228497947,198496029,228567153,198577876}, 
+    {235318799,198577876,235247682,198658022}, {228567153,198577876,228638270,198658022}, {235247682,198658022,235174690,198736432}, 
+    {228638270,198658022,228711262,198736432}, {235174690,198736432,235099856,198813072}, {228711262,198736432,228786096,198813072}, 
+    {235099856,198813072,235023216,198887906}, {228786096,198813072,228862736,198887906}, {235023216,198887906,234944806,198960898}, 
+    {228862736,198887906,228941146,198960898}, {234944806,198960898,234864660,199032015}, {228941146,198960898,229021292,199032015}, 
+    {234864660,199032015,234782813,199101221}, {229021292,199032015,229103139,199101221}, {234782813,199101221,234699300,199168480}, 
+    {229103139,199101221,229186652,199168480}, {234699300,199168480,234614157,199233758}, {229186652,199168480,229271795,199233758}, 
+    {234614157,199233758,234527418,199297020}, {229271795,199233758,229358534,199297020}, {234527418,199297020,234439119,199358231}, 
+    {229358534,199297020,229446833,199358231}, {234439119,199358231,234349295,199417355}, {229446833,199358231,229536657,199417355}, 
+    {234349295,199417355,234257980,199474357}, {229536657,199417355,229627972,199474357}, {234257980,199474357,234165210,199529203}, 
+    {229627972,199474357,229720742,199529203}, {234165210,199529203,234071020,199581858}, {229720742,199529203,229814932,199581858}, 
+    {234071020,199581858,233975444,199632286}, {229814932,199581858,229910508,199632286}, {233975444,199632286,233878519,199680452}, 
+    {229910508,199632286,230007433,199680452}, {233878519,199680452,233780278,199726321}, {230007433,199680452,230105674,199726321}, 
+    {233780278,199726321,233680758,199769858}, {230105674,199726321,230205194,199769858}, {233680758,199769858,233579993,199811028}, 
+    {230205194,199769858,230305959,199811028}, {233579993,199811028,233478018,199849797}, {230305959,199811028,230407934,199849797}, 
+    {233478018,199849797,233374868,199886128}, {230407934,199849797,230511084,199886128}, {233374868,199886128,233270579,199919987}, 
+    {230511084,199886128,230615373,199919987}, {233270579,199919987,233165185,199951339}, {230615373,199919987,230720767,199951339}, 
+    {233165185,199951339,233058721,199980148}, {230720767,199951339,230827231,199980148}, {233058721,199980148,232951223,200006380}, 
+    {230827231,199980148,230934729,200006380}, {232951223,200006380,232842726,200030000}, {230934729,200006380,231043226,200030000}, 
+    {232842726,200030000,232733264,200050973}, {231043226,200030000,231152688,200050973}, {232733264,200050973,232622873,200069262}, 
+    {231152688,200050973,231263079,200069262}, {232622873,200069262,232511588,200084835}, {231263079,200069262,231374364,200084835}, 
+    {232511588,200084835,232399443,200097654}, {231374364,200084835,231486509,200097654}, {232399443,200097654,232286475,200107686}, 
+    {231486509,200097654,231599477,200107686}, {232286475,200107686,232172718,200114895}, {231599477,200107686,231713234,200114895}, 
+    {232172718,200114895,232058206,200119246}, {231713234,200114895,231827746,200119246}, {232058206,200119246,231942976,200120704}, 
+    {231827746,200119246,231942976,200120704}, 
+};
+
+const Segment SEGMENTS_MID9[] = {
+    {231877568,208614848,231992798,208616306}, {231877568,208614848,231762338,208616306}, {231992798,208616306,232107310,208620657}, 
+    {231762338,208616306,231647826,208620657}, {232107310,208620657,232221067,208627866}, {231647826,208620657,231534069,208627866}, 
+    {232221067,208627866,232334035,208637898}, {231534069,208627866,231421101,208637898}, {232334035,208637898,232446180,208650717}, 
+    {231421101,208637898,231308956,208650717}, {232446180,208650717,232557465,208666290}, {231308956,208650717,231197671,208666290}, 
+    {232557465,208666290,232667856,208684579}, {231197671,208666290,231087280,208684579}, {232667856,208684579,232777318,208705552}, 
+    {231087280,208684579,230977818,208705552}, {232777318,208705552,232885815,208729172}, {230977818,208705552,230869321,208729172}, 
+    {232885815,208729172,232993313,208755404}, {230869321,208729172,230761823,208755404}, {232993313,208755404,233099777,208784213}, 
+    {230761823,208755404,230655359,208784213}, {233099777,208784213,233205171,208815565}, {230655359,208784213,230549965,208815565}, 
+    {233205171,208815565,233309460,208849424}, {230549965,208815565,230445676,208849424}, {233309460,208849424,233412610,208885755}, 
+    {230445676,208849424,230342526,208885755}, {233412610,208885755,233514585,208924524}, {230342526,208885755,230240551,208924524}, 
+    {233514585,208924524,233615350,208965694}, {230240551,208924524,230139786,208965694}, {233615350,208965694,233714870,209009231}, 
+    {230139786,208965694,230040266,209009231}, {233714870,209009231,233813111,209055100}, {230040266,209009231,229942025,209055100}, 
+    {233813111,209055100,233910036,209103266}, {229942025,209055100,229845100,209103266}, {233910036,209103266,234005612,209153694}, 
+    {229845100,209103266,229749524,209153694}, {234005612,209153694,234099802,209206349}, {229749524,209153694,229655334,209206349}, 
+    {234099802,209206349,234192572,209261195}, {229655334,209206349,229562564,209261195}, {234192572,209261195,234283887,209318197}, 
+    {229562564,209261195,229471249,209318197}, {234283887,209318197,234373711,209377321}, {229471249,209318197,229381425,209377321}, 
+    {234373711,209377321,234462010,209438532}, {229381425,209377321,229293126,209438532}, {234462010,209438532,234548749,209501794}, 
+    {229293126,209438532,229206387,209501794}, {234548749,209501794,234633892,209567072}, {229206387,209501794,229121244,209567072}, 
+    {234633892,209567072,234717405,209634331}, {229121244,209567072,229037731,209634331}, {234717405,209634331,234799252,209703537}, 
+    {229037731,209634331,228955884,209703537}, {234799252,209703537,234879398,209774654}, {228955884,209703537,228875738,209774654}, 
+    {234879398,209774654,234957808,209847646}, {228875738,209774654,228797328,209847646}, {234957808,209847646,235034448,209922480}, 
+    {228797328,209847646,228720688,209922480}, {235034448,209922480,235109282,209999120}, {228720688,209922480,228645854,209999120}, 
+    {235109282,209999120,235182274,210077530}, {228645854,209999120,228572862,210077530}, {235182274,210077530,235253391,210157676}, 
+    {228572862,210077530,228501745,210157676}, {235253391,210157676,235322597,210239523}, {228501745,210157676,228432539,210239523}, 
+    {235322597,210239523,235389856,210323036}, {228432539,210239523,228365280,210323036}, {235389856,210323036,235455134,210408179}, 
+    {228365280,210323036,228300002,210408179}, {235455134,210408179,235518396,210494918}, {228300002,210408179,228236740,210494918}, 
+    {235518396,210494918,235579607,210583217}, {228236740,210494918,228175529,210583217}, {235579607,210583217,235638731,210673041}, 
+    {228175529,210583217,228116405,210673041}, {235638731,210673041,235695733,210764356}, {228116405,210673041,228059403,210764356}, 
+    {235695733,210764356,235750579,210857126}, {228059403,210764356,228004557,210857126}, {235750579,210857126,235803234,210951316}, 
+    {228004557,210857126,227951902,210951316}, {235803234,210951316,235853662,211046892}, {227951902,210951316,227901474,211046892}, 
+    {235853662,211046892,235901828,211143817}, {227901474,211046892,227853308,211143817}, {235901828,211143817,235947697,211242058}, 
+    {227853308,211143817,227807439,211242058}, {235947697,211242058,235991234,211341578}, {227807439,211242058,227763902,211341578}, 
+    {235991234,211341578,236032404,211442343}, {227763902,211341578,227722732,211442343}, {236032404,211442343,236071173,211544318}, 
+    {227722732,211442343,227683963,211544318}, {236071173,211544318,236107504,211647468}, {227683963,211544318,227647632,211647468}, 
+    {236107504,211647468,236141363,211751757}, {227647632,211647468,227613773,211751757}, {236141363,211751757,236172715,211857151}, 
+    {227613773,211751757,227582421,211857151}, {236172715,211857151,236201524,211963615}, {227582421,211857151,227553612,211963615}, 
+    {236201524,211963615,236227756,212071113}, {227553612,211963615,227527380,212071113}, {236227756,212071113,236251376,212179610}, 
+    {227527380,212071113,227503760,212179610}, {236251376,212179610,236272349,212289072}, {227503760,212179610,227482787,212289072}, 
+    {236272349,212289072,236290638,212399463}, {227482787,212289072,227464498,212399463}, {236290638,212399463,236306211,212510748}, 
+    {227464498,212399463,227448925,212510748}, {236306211,212510748,236319030,212622893}, {227448925,212510748,227436106,212622893}, 
+    {236319030,212622893,236329062,212735861}, {227436106,212622893,227426074,212735861}, {236329062,212735861,236336271,212849618}, 
+    {227426074,212735861,227418865,212849618}, {236336271,212849618,236340622,212964130}, {227418865,212849618,227414514,212964130}, 
+    {236340622,212964130,236342080,213079360}, {227414514,212964130,227413056,213079360}, {236342080,213079360,236340622,213194590}, 
+    {227413056,213079360,227414514,213194590}, {236340622,213194590,236336271,213309102}, {227414514,213194590,227418865,213309102}, 
+    {236336271,213309102,236329062,213422859}, {227418865,213309102,227426074,213422859}, {236329062,213422859,236319030,213535827}, 
+    {227426074,213422859,227436106,213535827}, {236319030,213535827,236306211,213647972}, {227436106,213535827,227448925,213647972}, 
+    {236306211,213647972,236290638,213759257}, {227448925,213647972,227464498,213759257}, {236290638,213759257,236272349,213869648}, 
+    {227464498,213759257,227482787,213869648}, {236272349,213869648,236251376,213979110}, {227482787,213869648,227503760,213979110}, 
+    {236251376,213979110,236227756,214087607}, {227503760,213979110,227527380,214087607}, {236227756,214087607,236201524,214195105}, 
+    {227527380,214087607,227553612,214195105}, {236201524,214195105,236172715,214301569}, {227553612,214195105,227582421,214301569}, 
+    {236172715,214301569,236141363,214406963}, {227582421,214301569,227613773,214406963}, {236141363,214406963,236107504,214511252}, 
+    {227613773,214406963,227647632,214511252}, {236107504,214511252,236071173,214614402}, {227647632,214511252,227683963,214614402}, 
+    {236071173,214614402,236032404,214716377}, {227683963,214614402,227722732,214716377}, {236032404,214716377,235991234,214817142}, 
+    {227722732,214716377,227763902,214817142}, {235991234,214817142,235947697,214916662}, {227763902,214817142,227807439,214916662}, 
+    {235947697,214916662,235901828,215014903}, {227807439,214916662,227853308,215014903}, {235901828,215014903,235853662,215111828}, 
+    {227853308,215014903,227901474,215111828}, {235853662,215111828,235803234,215207404}, {227901474,215111828,227951902,215207404}, 
+    {235803234,215207404,235750579,215301594}, {227951902,215207404,228004557,215301594}, {235750579,215301594,235695733,215394364}, 
+    {228004557,215301594,228059403,215394364}, {235695733,215394364,235638731,215485679}, {228059403,215394364,228116405,215485679}, 
+    {235638731,215485679,235579607,215575503}, {228116405,215485679,228175529,215575503}, {235579607,215575503,235518396,215663802}, 
+    {228175529,215575503,228236740,215663802}, {235518396,215663802,235455134,215750541}, {228236740,215663802,228300002,215750541}, 
+    {235455134,215750541,235389856,215835684}, {228300002,215750541,228365280,215835684}, {235389856,215835684,235322597,215919197}, 
+    {228365280,215835684,228432539,215919197}, {235322597,215919197,235253391,216001044}, {228432539,215919197,228501745,216001044}, 
+    {235253391,216001044,235182274,216081190}, {228501745,216001044,228572862,216081190}, {235182274,216081190,235109282,216159600}, 
+    {228572862,216081190,228645854,216159600}, {235109282,216159600,235034448,216236240}, {228645854,216159600,228720688,216236240}, 
+    {235034448,216236240,234957808,216311074}, {228720688,216236240,228797328,216311074}, {234957808,216311074,234879398,216384066}, 
+    {228797328,216311074,228875738,216384066}, {234879398,216384066,234799252,216455183}, {228875738,216384066,228955884,216455183}, 
+    {234799252,216455183,234717405,216524389}, {228955884,216455183,229037731,216524389}, {234717405,216524389,234633892,216591648}, 
+    {229037731,216524389,229121244,216591648}, {234633892,216591648,234548749,216656926}, {229121244,216591648,229206387,216656926}, 
+    {234548749,216656926,234462010,216720188}, {229206387,216656926,229293126,216720188}, {234462010,216720188,234373711,216781399}, 
+    {229293126,216720188,229381425,216781399}, {234373711,216781399,234283887,216840523}, {229381425,216781399,229471249,216840523}, 
+    {234283887,216840523,234192572,216897525}, {229471249,216840523,229562564,216897525}, {234192572,216897525,234099802,216952371}, 
+    {229562564,216897525,229655334,216952371}, {234099802,216952371,234005612,217005026}, {229655334,216952371,229749524,217005026}, 
+    {234005612,217005026,233910036,217055454}, {229749524,217005026,229845100,217055454}, {233910036,217055454,233813111,217103620}, 
+    {229845100,217055454,229942025,217103620}, {233813111,217103620,233714870,217149489}, {229942025,217103620,230040266,217149489}, 
+    {233714870,217149489,233615350,217193026}, {230040266,217149489,230139786,217193026}, {233615350,217193026,233514585,217234196}, 
+    {230139786,217193026,230240551,217234196}, {233514585,217234196,233412610,217272965}, {230240551,217234196,230342526,217272965}, 
+    {233412610,217272965,233309460,217309296}, {230342526,217272965,230445676,217309296}, {233309460,217309296,233205171,217343155}, 
+    {230445676,217309296,230549965,217343155}, {233205171,217343155,233099777,217374507}, {230549965,217343155,230655359,217374507}, 
+    {233099777,217374507,232993313,217403316}, {230655359,217374507,230761823,217403316}, {232993313,217403316,232885815,217429548}, 
+    {230761823,217403316,230869321,217429548}, {232885815,217429548,232777318,217453168}, {230869321,217429548,230977818,217453168}, 
+    {232777318,217453168,232667856,217474141}, {230977818,217453168,231087280,217474141}, {232667856,217474141,232557465,217492430}, 
+    {231087280,217474141,231197671,217492430}, {232557465,217492430,232446180,217508003}, {231197671,217492430,231308956,217508003}, 
+    {232446180,217508003,232334035,217520822}, {231308956,217508003,231421101,217520822}, {232334035,217520822,232221067,217530854}, 
+    {231421101,217520822,231534069,217530854}, {232221067,217530854,232107310,217538063}, {231534069,217530854,231647826,217538063}, 
+    {232107310,217538063,231992798,217542414}, {231647826,217538063,231762338,217542414}, {231992798,217542414,231877568,217543872}, 
+    {231762338,217542414,231877568,217543872}, 
+};
+
+const Segment SEGMENTS_OUTER0[] = {
+    {327038912,208429696,327154142,208431154}, {327038912,208429696,326923682,208431154}, {327154142,208431154,327268654,208435505}, 
+    {326923682,208431154,326809170,208435505}, {327268654,208435505,327382411,208442714}, {326809170,208435505,326695413,208442714}, 
+    {327382411,208442714,327495379,208452746}, {326695413,208442714,326582445,208452746}, {327495379,208452746,327607524,208465565}, 
+    {326582445,208452746,326470300,208465565}, {327607524,208465565,327718809,208481138}, {326470300,208465565,326359015,208481138}, 
+    {327718809,208481138,327829200,208499427}, {326359015,208481138,326248624,208499427}, {327829200,208499427,327938662,208520400}, 
+    {326248624,208499427,326139162,208520400}, {327938662,208520400,328047159,208544020}, {326139162,208520400,326030665,208544020}, 
+    {328047159,208544020,328154657,208570252}, {326030665,208544020,325923167,208570252}, {328154657,208570252,328261121,208599061}, 
+    {325923167,208570252,325816703,208599061}, {328261121,208599061,328366515,208630413}, {325816703,208599061,325711309,208630413}, 
+    {328366515,208630413,328470804,208664272}, {325711309,208630413,325607020,208664272}, {328470804,208664272,328573954,208700603}, 
+    {325607020,208664272,325503870,208700603}, {328573954,208700603,328675929,208739372}, {325503870,208700603,325401895,208739372}, 
+    {328675929,208739372,328776694,208780542}, {325401895,208739372,325301130,208780542}, {328776694,208780542,328876214,208824079}, 
+    {325301130,208780542,325201610,208824079}, {328876214,208824079,328974455,208869948}, {325201610,208824079,325103369,208869948}, 
+    {328974455,208869948,329071380,208918114}, {325103369,208869948,325006444,208918114}, {329071380,208918114,329166956,208968542}, 
+    {325006444,208918114,324910868,208968542}, {329166956,208968542,329261146,209021197}, {324910868,208968542,324816678,209021197}, 
+    {329261146,209021197,329353916,209076043}, {324816678,209021197,324723908,209076043}, {329353916,209076043,329445231,209133045}, 
+    {324723908,209076043,324632593,209133045}, {329445231,209133045,329535055,209192169}, {324632593,209133045,324542769,209192169}, 
+    {329535055,209192169,329623354,209253380}, {324542769,209192169,324454470,209253380}, {329623354,209253380,329710093,209316642}, 
+    {324454470,209253380,324367731,209316642}, {329710093,209316642,329795236,209381920}, {324367731,209316642,324282588,209381920}, 
+    {329795236,209381920,329878749,209449179}, {324282588,209381920,324199075,209449179}, {329878749,209449179,329960596,209518385}, 
+    {324199075,209449179,324117228,209518385}, {329960596,209518385,330040742,209589502}, {324117228,209518385,324037082,209589502}, 
+    {330040742,209589502,330119152,209662494}, {324037082,209589502,323958672,209662494}, {330119152,209662494,330195792,209737328}, 
+    {323958672,209662494,323882032,209737328}, {330195792,209737328,330270626,209813968}, {323882032,209737328,323807198,209813968}, 
+    {330270626,209813968,330343618,209892378}, {323807198,209813968,323734206,209892378}, {330343618,209892378,330414735,209972524}, 
+    {323734206,209892378,323663089,209972524}, {330414735,209972524,330483941,210054371}, {323663089,209972524,323593883,210054371}, 
+    {330483941,210054371,330551200,210137884}, {323593883,210054371,323526624,210137884}, {330551200,210137884,330616478,210223027}, 
+    {323526624,210137884,323461346,210223027}, {330616478,210223027,330679740,210309766}, {323461346,210223027,323398084,210309766}, 
+    {330679740,210309766,330740951,210398065}, {323398084,210309766,323336873,210398065}, {330740951,210398065,330800075,210487889}, 
+    {323336873,210398065,323277749,210487889}, {330800075,210487889,330857077,210579204}, {323277749,210487889,323220747,210579204}, 
+    {330857077,210579204,330911923,210671974}, {323220747,210579204,323165901,210671974}, {330911923,210671974,330964578,210766164}, 
+    {323165901,210671974,323113246,210766164}, {330964578,210766164,331015006,210861740}, {323113246,210766164,323062818,210861740}, 
+    {331015006,210861740,331063172,210958665}, {323062818,210861740,323014652,210958665}, {331063172,210958665,331109041,211056906}, 
+    {323014652,210958665,322968783,211056906}, {331109041,211056906,331152578,211156426}, {322968783,211056906,322925246,211156426}, 
+    {331152578,211156426,331193748,211257191}, {322925246,211156426,322884076,211257191}, {331193748,211257191,331232517,211359166}, 
+    {322884076,211257191,322845307,211359166}, {331232517,211359166,331268848,211462316}, {322845307,211359166,322808976,211462316}, 
+    {331268848,211462316,331302707,211566605}, {322808976,211462316,322775117,211566605}, {331302707,211566605,331334059,211671999}, 
+    {322775117,211566605,322743765,211671999}, {331334059,211671999,331362868,211778463}, {322743765,211671999,322714956,211778463}, 
+    {331362868,211778463,331389100,211885961}, {322714956,211778463,322688724,211885961}, {331389100,211885961,331412720,211994458}, 
+    {322688724,211885961,322665104,211994458}, {331412720,211994458,331433693,212103920}, {322665104,211994458,322644131,212103920}, 
+    {331433693,212103920,331451982,212214311}, {322644131,212103920,322625842,212214311}, {331451982,212214311,331467555,212325596}, 
+    {322625842,212214311,322610269,212325596}, {331467555,212325596,331480374,212437741}, {322610269,212325596,322597450,212437741}, 
+    {331480374,212437741,331490406,212550709}, {322597450,212437741,322587418,212550709}, {331490406,212550709,331497615,212664466}, 
+    {322587418,212550709,322580209,212664466}, {331497615,212664466,331501966,212778978}, {322580209,212664466,322575858,212778978}, 
+    {331501966,212778978,331503424,212894208}, {322575858,212778978,322574400,212894208}, {331503424,212894208,331501966,213009438}, 
+    {322574400,212894208,322575858,213009438}, {331501966,213009438,331497615,213123950}, {322575858,213009438,322580209,213123950}, 
+    {331497615,213123950,331490406,213237707}, {322580209,213123950,322587418,213237707}, {331490406,213237707,331480374,213350675}, 
+    {322587418,213237707,322597450,213350675}, {331480374,213350675,331467555,213462820}, {322597450,213350675,322610269,213462820}, 
+    {331467555,213462820,331451982,213574105}, {322610269,213462820,322625842,213574105}, {331451982,213574105,331433693,213684496}, 
+    {322625842,213574105,322644131,213684496}, {331433693,213684496,331412720,213793958}, {322644131,213684496,322665104,213793958}, 
+    {331412720,213793958,331389100,213902455}, {322665104,213793958,322688724,213902455}, {331389100,213902455,331362868,214009953}, 
+    {322688724,213902455,322714956,214009953}, {331362868,214009953,331334059,214116417}, {322714956,214009953,322743765,214116417}, 
+    {331334059,214116417,331302707,214221811}, {322743765,214116417,322775117,214221811}, {331302707,214221811,331268848,214326100}, 
+    {322775117,214221811,322808976,214326100}, {331268848,214326100,331232517,214429250}, {322808976,214326100,322845307,214429250}, 
+    {331232517,214429250,331193748,214531225}, {322845307,214429250,322884076,214531225}, {331193748,214531225,331152578,214631990}, 
+    {322884076,214531225,322925246,214631990}, {331152578,214631990,331109041,214731510}, {322925246,214631990,322968783,214731510}, 
+    {331109041,214731510,331063172,214829751}, {322968783,214731510,323014652,214829751}, {331063172,214829751,331015006,214926676}, 
+    {323014652,214829751,323062818,214926676}, {331015006,214926676,330964578,215022252}, {323062818,214926676,323113246,215022252}, 
+    {330964578,215022252,330911923,215116442}, {323113246,215022252,323165901,215116442}, {330911923,215116442,330857077,215209212}, 
+    {323165901,215116442,323220747,215209212}, {330857077,215209212,330800075,215300527}, {323220747,215209212,323277749,215300527}, 
+    {330800075,215300527,330740951,215390351}, {323277749,215300527,323336873,215390351}, {330740951,215390351,330679740,215478650}, 
+    {323336873,215390351,323398084,215478650}, {330679740,215478650,330616478,215565389}, {323398084,215478650,323461346,215565389}, 
+    {330616478,215565389,330551200,215650532}, {323461346,215565389,323526624,215650532}, {330551200,215650532,330483941,215734045}, 
+    {323526624,215650532,323593883,215734045}, {330483941,215734045,330414735,215815892}, {323593883,215734045,323663089,215815892}, 
+    {330414735,215815892,330343618,215896038}, {323663089,215815892,323734206,215896038}, {330343618,215896038,330270626,215974448}, 
+    {323734206,215896038,323807198,215974448}, {330270626,215974448,330195792,216051088}, {323807198,215974448,323882032,216051088}, 
+    {330195792,216051088,330119152,216125922}, {323882032,216051088,323958672,216125922}, {330119152,216125922,330040742,216198914}, 
+    {323958672,216125922,324037082,216198914}, {330040742,216198914,329960596,216270031}, {324037082,216198914,324117228,216270031}, 
+    {329960596,216270031,329878749,216339237}, {324117228,216270031,324199075,216339237}, {329878749,216339237,329795236,216406496}, 
+    {324199075,216339237,324282588,216406496}, {329795236,216406496,329710093,216471774}, {324282588,216406496,324367731,216471774}, 
+    {329710093,216471774,329623354,216535036}, {324367731,216471774,324454470,216535036}, {329623354,216535036,329535055,216596247}, 
+    {324454470,216535036,324542769,216596247}, {329535055,216596247,329445231,216655371}, {324542769,216596247,324632593,216655371}, 
+    {329445231,216655371,329353916,216712373}, {324632593,216655371,324723908,216712373}, {329353916,216712373,329261146,216767219}, 
+    {324723908,216712373,324816678,216767219}, {329261146,216767219,329166956,216819874}, {324816678,216767219,324910868,216819874}, 
+    {329166956,216819874,329071380,216870302}, {324910868,216819874,325006444,216870302}, {329071380,216870302,328974455,216918468}, 
+    {325006444,216870302,325103369,216918468}, {328974455,216918468,328876214,216964337}, {325103369,216918468,325201610,216964337}, 
+    {328876214,216964337,328776694,217007874}, {325201610,216964337,325301130,217007874}, {328776694,217007874,328675929,217049044}, 
+    {325301130,217007874,325401895,217049044}, {328675929,217049044,328573954,217087813}, {325401895,217049044,325503870,217087813}, 
+    {328573954,217087813,328470804,217124144}, {325503870,217087813,325607020,217124144}, {328470804,217124144,328366515,217158003}, 
+    {325607020,217124144,325711309,217158003}, {328366515,217158003,328261121,217189355}, {325711309,217158003,325816703,217189355}, 
+    {328261121,217189355,328154657,217218164}, {325816703,217189355,325923167,217218164}, {328154657,217218164,328047159,217244396}, 
+    {325923167,217218164,326030665,217244396}, {328047159,217244396,327938662,217268016}, {326030665,217244396,326139162,217268016}, 
+    {327938662,217268016,327829200,217288989}, {326139162,217268016,326248624,217288989}, {327829200,217288989,327718809,217307278}, 
+    {326248624,217288989,326359015,217307278}, {327718809,217307278,327607524,217322851}, {326359015,217307278,326470300,217322851}, 
+    {327607524,217322851,327495379,217335670}, {326470300,217322851,326582445,217335670}, {327495379,217335670,327382411,217345702}, 
+    {326582445,217335670,326695413,217345702}, {327382411,217345702,327268654,217352911}, {326695413,217345702,326809170,217352911}, 
+    {327268654,217352911,327154142,217357262}, {326809170,217352911,326923682,217357262}, {327154142,217357262,327038912,217358720}, 
+    {326923682,217357262,327038912,217358720}, 
+};
+
+const Segment SEGMENTS_OUTER1[] = {
+    {327027520,189543040,327142750,189544498}, {327027520,189543040,326912290,189544498}, {327142750,189544498,327257262,189548849}, 
+    {326912290,189544498,326797778,189548849}, {327257262,189548849,327371019,189556058}, {326797778,189548849,326684021,189556058}, 
+    {327371019,189556058,327483987,189566090}, {326684021,189556058,326571053,189566090}, {327483987,189566090,327596132,189578909}, 
+    {326571053,189566090,326458908,189578909}, {327596132,189578909,327707417,189594482}, {326458908,189578909,326347623,189594482}, 
+    {327707417,189594482,327817808,189612771}, {326347623,189594482,326237232,189612771}, {327817808,189612771,327927270,189633744}, 
+    {326237232,189612771,326127770,189633744}, {327927270,189633744,328035767,189657364}, {326127770,189633744,326019273,189657364}, 
+    {328035767,189657364,328143265,189683596}, {326019273,189657364,325911775,189683596}, {328143265,189683596,328249729,189712405}, 
+    {325911775,189683596,325805311,189712405}, {328249729,189712405,328355123,189743757}, {325805311,189712405,325699917,189743757}, 
+    {328355123,189743757,328459412,189777616}, {325699917,189743757,325595628,189777616}, {328459412,189777616,328562562,189813947}, 
+    {325595628,189777616,325492478,189813947}, {328562562,189813947,328664537,189852716}, {325492478,189813947,325390503,189852716}, 
+    {328664537,189852716,328765302,189893886}, {325390503,189852716,325289738,189893886}, {328765302,189893886,328864822,189937423}, 
+    {325289738,189893886,325190218,189937423}, {328864822,189937423,328963063,189983292}, {325190218,189937423,325091977,189983292}, 
+    {328963063,189983292,329059988,190031458}, {325091977,189983292,324995052,190031458}, {329059988,190031458,329155564,190081886}, 
+    {324995052,190031458,324899476,190081886}, {329155564,190081886,329249754,190134541}, {324899476,190081886,324805286,190134541}, 
+    {329249754,190134541,329342524,190189387}, {324805286,190134541,324712516,190189387}, {329342524,190189387,329433839,190246389}, 
+    {324712516,190189387,324621201,190246389}, {329433839,190246389,329523663,190305513}, {324621201,190246389,324531377,190305513}, 
+    {329523663,190305513,329611962,190366724}, {324531377,190305513,324443078,190366724}, {329611962,190366724,329698701,190429986}, 
+    {324443078,190366724,324356339,190429986}, {329698701,190429986,329783844,190495264}, {324356339,190429986,324271196,190495264}, 
+    {329783844,190495264,329867357,190562523}, {324271196,190495264,324187683,190562523}, {329867357,190562523,329949204,190631729}, 
+    {324187683,190562523,324105836,190631729}, {329949204,190631729,330029350,190702846}, {324105836,190631729,324025690,190702846}, 
+    {330029350,190702846,330107760,190775838}, {324025690,190702846,323947280,190775838}, {330107760,190775838,330184400,190850672}, 
+    {323947280,190775838,323870640,190850672}, {330184400,190850672,330259234,190927312}, {323870640,190850672,323795806,190927312}, 
+    {330259234,190927312,330332226,191005722}, {323795806,190927312,323722814,191005722}, {330332226,191005722,330403343,191085868}, 
+    {323722814,191005722,323651697,191085868}, {330403343,191085868,330472549,191167715}, {323651697,191085868,323582491,191167715}, 
+    {330472549,191167715,330539808,191251228}, {323582491,191167715,323515232,191251228}, {330539808,191251228,330605086,191336371}, 
+    {323515232,191251228,323449954,191336371}, {330605086,191336371,330668348,191423110}, {323449954,191336371,323386692,191423110}, 
+    {330668348,191423110,330729559,191511409}, {323386692,191423110,323325481,191511409}, {330729559,191511409,330788683,191601233}, 
+    {323325481,191511409,323266357,191601233}, {330788683,191601233,330845685,191692548}, {323266357,191601233,323209355,191692548}, 
+    {330845685,191692548,330900531,191785318}, {323209355,191692548,323154509,191785318}, {330900531,191785318,330953186,191879508}, 
+    {323154509,191785318,323101854,191879508}, {330953186,191879508,331003614,191975084}, {323101854,191879508,323051426,191975084}, 
+    {331003614,191975084,331051780,192072009}, {323051426,191975084,323003260,192072009}, {331051780,192072009,331097649,192170250}, 
+    {323003260,192072009,322957391,192170250}, {331097649,192170250,331141186,192269770}, {322957391,192170250,322913854,192269770}, 
+    {331141186,192269770,331182356,192370535}, {322913854,192269770,322872684,192370535}, {331182356,192370535,331221125,192472510}, 
+    {322872684,192370535,322833915,192472510}, {331221125,192472510,331257456,192575660}, {322833915,192472510,322797584,192575660}, 
+    {331257456,192575660,331291315,192679949}, {322797584,192575660,322763725,192679949}, {331291315,192679949,331322667,192785343}, 
+    {322763725,192679949,322732373,192785343}, {331322667,192785343,331351476,192891807}, {322732373,192785343,322703564,192891807}, 
+    {331351476,192891807,331377708,192999305}, {322703564,192891807,322677332,192999305}, {331377708,192999305,331401328,193107802}, 
+    {322677332,192999305,322653712,193107802}, {331401328,193107802,331422301,193217264}, {322653712,193107802,322632739,193217264}, 
+    {331422301,193217264,331440590,193327655}, {322632739,193217264,322614450,193327655}, {331440590,193327655,331456163,193438940}, 
+    {322614450,193327655,322598877,193438940}, {331456163,193438940,331468982,193551085}, {322598877,193438940,322586058,193551085}, 
+    {331468982,193551085,331479014,193664053}, {322586058,193551085,322576026,193664053}, {331479014,193664053,331486223,193777810}, 
+    {322576026,193664053,322568817,193777810}, {331486223,193777810,331490574,193892322}, {322568817,193777810,322564466,193892322}, 
+    {331490574,193892322,331492032,194007552}, {322564466,193892322,322563008,194007552}, {331492032,194007552,331490574,194122782}, 
+    {322563008,194007552,322564466,194122782}, {331490574,194122782,331486223,194237294}, {322564466,194122782,322568817,194237294}, 
+    {331486223,194237294,331479014,194351051}, {322568817,194237294,322576026,194351051}, {331479014,194351051,331468982,194464019}, 
+    {322576026,194351051,322586058,194464019}, {331468982,194464019,331456163,194576164}, {322586058,194464019,322598877,194576164}, 
+    {331456163,194576164,331440590,194687449}, {322598877,194576164,322614450,194687449}, {331440590,194687449,331422301,194797840}, 
+    {322614450,194687449,322632739,194797840}, {331422301,194797840,331401328,194907302}, {322632739,194797840,322653712,194907302}, 
+    {331401328,194907302,331377708,195015799}, {322653712,194907302,322677332,195015799}, {331377708,195015799,331351476,195123297}, 
+    {322677332,195015799,322703564,195123297}, {331351476,195123297,331322667,195229761}, {322703564,195123297,322732373,195229761}, 
+    {331322667,195229761,331291315,195335155}, {322732373,195229761,322763725,195335155}, {331291315,195335155,331257456,195439444}, 
+    {322763725,195335155,322797584,195439444}, {331257456,195439444,331221125,195542594}, {322797584,195439444,322833915,195542594}, 
+    {331221125,195542594,331182356,195644569}, {322833915,195542594,322872684,195644569}, {331182356,195644569,331141186,195745334}, 
+    {322872684,195644569,322913854,195745334}, {331141186,195745334,331097649,195844854}, {322913854,195745334,322957391,195844854}, 
+    {331097649,195844854,331051780,195943095}, {322957391,195844854,323003260,195943095}, {331051780,195943095,331003614,196040020}, 
+    {323003260,195943095,323051426,196040020}, {331003614,196040020,330953186,196135596}, {323051426,196040020,323101854,196135596}, 
+    {330953186,196135596,330900531,196229786}, {323101854,196135596,323154509,196229786}, {330900531,196229786,330845685,196322556}, 
+    {323154509,196229786,323209355,196322556}, {330845685,196322556,330788683,196413871}, {323209355,196322556,323266357,196413871}, 
+    {330788683,196413871,330729559,196503695}, {323266357,196413871,323325481,196503695}, {330729559,196503695,330668348,196591994}, 
+    {323325481,196503695,323386692,196591994}, {330668348,196591994,330605086,196678733}, {323386692,196591994,323449954,196678733}, 
+    {330605086,196678733,330539808,196763876}, {323449954,196678733,323515232,196763876}, {330539808,196763876,330472549,196847389}, 
+    {323515232,196763876,323582491,196847389}, {330472549,196847389,330403343,196929236}, {323582491,196847389,323651697,196929236}, 
+    {330403343,196929236,330332226,197009382}, {323651697,196929236,323722814,197009382}, {330332226,197009382,330259234,197087792}, 
+    {323722814,197009382,323795806,197087792}, {330259234,197087792,330184400,197164432}, {323795806,197087792,323870640,197164432}, 
+    {330184400,197164432,330107760,197239266}, {323870640,197164432,323947280,197239266}, {330107760,197239266,330029350,197312258}, 
+    {323947280,197239266,324025690,197312258}, {330029350,197312258,329949204,197383375}, {324025690,197312258,324105836,197383375}, 
+    {329949204,197383375,329867357,197452581}, {324105836,197383375,324187683,197452581}, {329867357,197452581,329783844,197519840}, 
+    {324187683,197452581,324271196,197519840}, {329783844,197519840,329698701,197585118}, {324271196,197519840,324356339,197585118}, 
+    {329698701,197585118,329611962,197648380}, {324356339,197585118,324443078,197648380}, {329611962,197648380,329523663,197709591}, 
+    {324443078,197648380,324531377,197709591}, {329523663,197709591,329433839,197768715}, {324531377,197709591,324621201,197768715}, 
+    {329433839,197768715,329342524,197825717}, {324621201,197768715,324712516,197825717}, {329342524,197825717,329249754,197880563}, 
+    {324712516,197825717,324805286,197880563}, {329249754,197880563,329155564,197933218}, {324805286,197880563,324899476,197933218}, 
+    {329155564,197933218,329059988,197983646}, {324899476,197933218,324995052,197983646}, {329059988,197983646,328963063,198031812}, 
+    {324995052,197983646,325091977,198031812}, {328963063,198031812,328864822,198077681}, {325091977,198031812,325190218,198077681}, 
+    {328864822,198077681,328765302,198121218}, {325190218,198077681,325289738,198121218}, {328765302,198121218,328664537,198162388}, 
+    {325289738,198121218,325390503,198162388}, {328664537,198162388,328562562,198201157}, {325390503,198162388,325492478,198201157}, 
+    {328562562,198201157,328459412,198237488}, {325492478,198201157,325595628,198237488}, {328459412,198237488,328355123,198271347}, 
+    {325595628,198237488,325699917,198271347}, {328355123,198271347,328249729,198302699}, {325699917,198271347,325805311,198302699}, 
+    {328249729,198302699,328143265,198331508}, {325805311,198302699,325911775,198331508}, {328143265,198331508,328035767,198357740}, 
+    {325911775,198331508,326019273,198357740}, {328035767,198357740,327927270,198381360}, {326019273,198357740,326127770,198381360}, 
+    {327927270,198381360,327817808,198402333}, {326127770,198381360,326237232,198402333}, {327817808,198402333,327707417,198420622}, 
+    {326237232,198402333,326347623,198420622}, {327707417,198420622,327596132,198436195}, {326347623,198420622,326458908,198436195}, 
+    {327596132,198436195,327483987,198449014}, {326458908,198436195,326571053,198449014}, {327483987,198449014,327371019,198459046}, 
+    {326571053,198449014,326684021,198459046}, {327371019,198459046,327257262,198466255}, {326684021,198459046,326797778,198466255}, 
+    {327257262,198466255,327142750,198470606}, {326797778,198466255,326912290,198470606}, {327142750,198470606,327027520,198472064}, 
+    {326912290,198470606,327027520,198472064}, 
+};
+
+const Segment SEGMENTS_OUTER2[] = {
+    {323654976,171416512,323770206,171417970}, {323654976,171416512,323539746,171417970}, {323770206,171417970,323884718,171422321}, 
+    {323539746,171417970,323425234,171422321}, {323884718,171422321,323998475,171429530}, {323425234,171422321,323311477,171429530}, 
+    {323998475,171429530,324111443,171439562}, {323311477,171429530,323198509,171439562}, {324111443,171439562,324223588,171452381}, 
+    {323198509,171439562,323086364,171452381}, {324223588,171452381,324334873,171467954}, {323086364,171452381,322975079,171467954}, 
+    {324334873,171467954,324445264,171486243}, {322975079,171467954,322864688,171486243}, {324445264,171486243,324554726,171507216}, 
+    {322864688,171486243,322755226,171507216}, {324554726,171507216,324663223,171530836}, {322755226,171507216,322646729,171530836}, 
+    {324663223,171530836,324770721,171557068}, {322646729,171530836,322539231,171557068}, {324770721,171557068,324877185,171585877}, 
+    {322539231,171557068,322432767,171585877}, {324877185,171585877,324982579,171617229}, {322432767,171585877,322327373,171617229}, 
+    {324982579,171617229,325086868,171651088}, {322327373,171617229,322223084,171651088}, {325086868,171651088,325190018,171687419}, 
+    {322223084,171651088,322119934,171687419}, {325190018,171687419,325291993,171726188}, {322119934,171687419,322017959,171726188}, 
+    {325291993,171726188,325392758,171767358}, {322017959,171726188,321917194,171767358}, {325392758,171767358,325492278,171810895}, 
+    {321917194,171767358,321817674,171810895}, {325492278,171810895,325590519,171856764}, {321817674,171810895,321719433,171856764}, 
+    {325590519,171856764,325687444,171904930}, {321719433,171856764,321622508,171904930}, {325687444,171904930,325783020,171955358}, 
+    {321622508,171904930,321526932,171955358}, {325783020,171955358,325877210,172008013}, {321526932,171955358,321432742,172008013}, 
+    {325877210,172008013,325969980,172062859}, {321432742,172008013,321339972,172062859}, {325969980,172062859,326061295,172119861}, 
+    {321339972,172062859,321248657,172119861}, {326061295,172119861,326151119,172178985}, {321248657,172119861,321158833,172178985}, 
+    {326151119,172178985,326239418,172240196}, {321158833,172178985,321070534,172240196}, {326239418,172240196,326326157,172303458}, 
+    {321070534,172240196,320983795,172303458}, {326326157,172303458,326411300,172368736}, {320983795,172303458,320898652,172368736}, 
+    {326411300,172368736,326494813,172435995}, {320898652,172368736,320815139,172435995}, {326494813,172435995,326576660,172505201}, 
+    {320815139,172435995,320733292,172505201}, {326576660,172505201,326656806,172576318}, {320733292,172505201,320653146,172576318}, 
+    {326656806,172576318,326735216,172649310}, {320653146,172576318,320574736,172649310}, {326735216,172649310,326811856,172724144}, 
+    {320574736,172649310,320498096,172724144}, {326811856,172724144,326886690,172800784}, {320498096,172724144,320423262,172800784}, 
+    {326886690,172800784,326959682,172879194}, {320423262,172800784,320350270,172879194}, {326959682,172879194,327030799,172959340}, 
+    {320350270,172879194,320279153,172959340}, {327030799,172959340,327100005,173041187}, {320279153,172959340,320209947,173041187}, 
+    {327100005,173041187,327167264,173124700}, {320209947,173041187,320142688,173124700}, {327167264,173124700,327232542,173209843}, 
+    {320142688,173124700,320077410,173209843}, {327232542,173209843,327295804,173296582}, {320077410,173209843,320014148,173296582}, 
+    {327295804,173296582,327357015,173384881}, {320014148,173296582,319952937,173384881}, {327357015,173384881,327416139,173474705}, 
+    {319952937,173384881,319893813,173474705}, {327416139,173474705,327473141,173566020}, {319893813,173474705,319836811,173566020}, 
+    {327473141,173566020,327527987,173658790}, {319836811,173566020,319781965,173658790}, {327527987,173658790,327580642,173752980}, 
+    {319781965,173658790,319729310,173752980}, {327580642,173752980,327631070,173848556}, {319729310,173752980,319678882,173848556}, 
+    {327631070,173848556,327679236,173945481}, {319678882,173848556,319630716,173945481}, {327679236,173945481,327725105,174043722}, 
+    {319630716,173945481,319584847,174043722}, {327725105,174043722,327768642,174143242}, {319584847,174043722,319541310,174143242}, 
+    {327768642,174143242,327809812,174244007}, {319541310,174143242,319500140,174244007}, {327809812,174244007,327848581,174345982}, 
+    {319500140,174244007,319461371,174345982}, {327848581,174345982,327884912,174449132}, {319461371,174345982,319425040,174449132}, 
+    {327884912,174449132,327918771,174553421}, {319425040,174449132,319391181,174553421}, {327918771,174553421,327950123,174658815}, 
+    {319391181,174553421,319359829,174658815}, {327950123,174658815,327978932,174765279}, {319359829,174658815,319331020,174765279}, 
+    {327978932,174765279,328005164,174872777}, {319331020,174765279,319304788,174872777}, {328005164,174872777,328028784,174981274}, 
+    {319304788,174872777,319281168,174981274}, {328028784,174981274,328049757,175090736}, {319281168,174981274,319260195,175090736}, 
+    {328049757,175090736,328068046,175201127}, {319260195,175090736,319241906,175201127}, {328068046,175201127,328083619,175312412}, 
+    {319241906,175201127,319226333,175312412}, {328083619,175312412,328096438,175424557}, {319226333,175312412,319213514,175424557}, 
+    {328096438,175424557,328106470,175537525}, {319213514,175424557,319203482,175537525}, {328106470,175537525,328113679,175651282}, 
+    {319203482,175537525,319196273,175651282}, {328113679,175651282,328118030,175765794}, {319196273,175651282,319191922,175765794}, 
+    {328118030,175765794,328119488,175881024}, {319191922,175765794,319190464,175881024}, {328119488,175881024,328118030,175996254}, 
+    {319190464,175881024,319191922,175996254}, {328118030,175996254,328113679,176110766}, {319191922,175996254,319196273,176110766}, 
+    {328113679,176110766,328106470,176224523}, {319196273,176110766,319203482,176224523}, {328106470,176224523,328096438,176337491}, 
+    {319203482,176224523,319213514,176337491}, {328096438,176337491,328083619,176449636}, {319213514,176337491,319226333,176449636}, 
+    {328083619,176449636,328068046,176560921}, {319226333,176449636,319241906,176560921}, {328068046,176560921,328049757,176671312}, 
+    {319241906,176560921,319260195,176671312}, {328049757,176671312,328028784,176780774}, {319260195,176671312,319281168,176780774}, 
+    {328028784,176780774,328005164,176889271}, {319281168,176780774,319304788,176889271}, {328005164,176889271,327978932,176996769}, 
+    {319304788,176889271,319331020,176996769}, {327978932,176996769,327950123,177103233}, {319331020,176996769,319359829,177103233}, 
+    {327950123,177103233,327918771,177208627}, {319359829,177103233,319391181,177208627}, {327918771,177208627,327884912,177312916}, 
+    {319391181,177208627,319425040,177312916}, {327884912,177312916,327848581,177416066}, {319425040,177312916,319461371,177416066}, 
+    {327848581,177416066,327809812,177518041}, {319461371,177416066,319500140,177518041}, {327809812,177518041,327768642,177618806}, 
+    {319500140,177518041,319541310,177618806}, {327768642,177618806,327725105,177718326}, {319541310,177618806,319584847,177718326}, 
+    {327725105,177718326,327679236,177816567}, {319584847,177718326,319630716,177816567}, {327679236,177816567,327631070,177913492}, 
+    {319630716,177816567,319678882,177913492}, {327631070,177913492,327580642,178009068}, {319678882,177913492,319729310,178009068}, 
+    {327580642,178009068,327527987,178103258}, {319729310,178009068,319781965,178103258}, {327527987,178103258,327473141,178196028}, 
+    {319781965,178103258,319836811,178196028}, {327473141,178196028,327416139,178287343}, {319836811,178196028,319893813,178287343}, 
+    {327416139,178287343,327357015,178377167}, {319893813,178287343,319952937,178377167}, {327357015,178377167,327295804,178465466}, 
+    {319952937,178377167,320014148,178465466}, {327295804,178465466,327232542,178552205}, {320014148,178465466,320077410,178552205}, 
+    {327232542,178552205,327167264,178637348}, {320077410,178552205,320142688,178637348}, {327167264,178637348,327100005,178720861}, 
+    {320142688,178637348,320209947,178720861}, {327100005,178720861,327030799,178802708}, {320209947,178720861,320279153,178802708}, 
+    {327030799,178802708,326959682,178882854}, {320279153,178802708,320350270,178882854}, {326959682,178882854,326886690,178961264}, 
+    {320350270,178882854,320423262,178961264}, {326886690,178961264,326811856,179037904}, {320423262,178961264,320498096,179037904}, 
+    {326811856,179037904,326735216,179112738}, {320498096,179037904,320574736,179112738}, {326735216,179112738,326656806,179185730}, 
+    {320574736,179112738,320653146,179185730}, {326656806,179185730,326576660,179256847}, {320653146,179185730,320733292,179256847}, 
+    {326576660,179256847,326494813,179326053}, {320733292,179256847,320815139,179326053}, {326494813,179326053,326411300,179393312}, 
+    {320815139,179326053,320898652,179393312}, {326411300,179393312,326326157,179458590}, {320898652,179393312,320983795,179458590}, 
+    {326326157,179458590,326239418,179521852}, {320983795,179458590,321070534,179521852}, {326239418,179521852,326151119,179583063}, 
+    {321070534,179521852,321158833,179583063}, {326151119,179583063,326061295,179642187}, {321158833,179583063,321248657,179642187}, 
+    {326061295,179642187,325969980,179699189}, {321248657,179642187,321339972,179699189}, {325969980,179699189,325877210,179754035}, 
+    {321339972,179699189,321432742,179754035}, {325877210,179754035,325783020,179806690}, {321432742,179754035,321526932,179806690}, 
+    {325783020,179806690,325687444,179857118}, {321526932,179806690,321622508,179857118}, {325687444,179857118,325590519,179905284}, 
+    {321622508,179857118,321719433,179905284}, {325590519,179905284,325492278,179951153}, {321719433,179905284,321817674,179951153}, 
+    {325492278,179951153,325392758,179994690}, {321817674,179951153,321917194,179994690}, {325392758,179994690,325291993,180035860}, 
+    {321917194,179994690,322017959,180035860}, {325291993,180035860,325190018,180074629}, {322017959,180035860,322119934,180074629}, 
+    {325190018,180074629,325086868,180110960}, {322119934,180074629,322223084,180110960}, {325086868,180110960,324982579,180144819}, 
+    {322223084,180110960,322327373,180144819}, {324982579,180144819,324877185,180176171}, {322327373,180144819,322432767,180176171}, 
+    {324877185,180176171,324770721,180204980}, {322432767,180176171,322539231,180204980}, {324770721,180204980,324663223,180231212}, 
+    {322539231,180204980,322646729,180231212}, {324663223,180231212,324554726,180254832}, {322646729,180231212,322755226,180254832}, 
+    {324554726,180254832,324445264,180275805}, {322755226,180254832,322864688,180275805}, {324445264,180275805,324334873,180294094}, 
+    {322864688,180275805,322975079,180294094}, {324334873,180294094,324223588,180309667}, {322975079,180294094,323086364,180309667}, 
+    {324223588,180309667,324111443,180322486}, {323086364,180309667,323198509,180322486}, {324111443,180322486,323998475,180332518}, 
+    {323198509,180322486,323311477,180332518}, {323998475,180332518,323884718,180339727}, {323311477,180332518,323425234,180339727}, 
+    {323884718,180339727,323770206,180344078}, {323425234,180339727,323539746,180344078}, {323770206,180344078,323654976,180345536}, 
+    {323539746,180344078,323654976,180345536}, 
+};
+
+const Segment SEGMENTS_OUTER3[] = {
+    {313850752,154515008,313965982,154516466}, {313850752,154515008,313735522,154516466}, {313965982,154516466,314080494,154520817}, 
+    {313735522,154516466,313621010,154520817}, {314080494,154520817,314194251,154528026}, {313621010,154520817,313507253,154528026}, 
+    {314194251,154528026,314307219,154538058}, {313507253,154528026,313394285,154538058}, {314307219,154538058,314419364,154550877}, 
+    {313394285,154538058,313282140,154550877}, {314419364,154550877,314530649,154566450}, {313282140,154550877,313170855,154566450}, 
+    {314530649,154566450,314641040,154584739}, {313170855,154566450,313060464,154584739}, {314641040,154584739,314750502,154605712}, 
+    {313060464,154584739,312951002,154605712}, {314750502,154605712,314858999,154629332}, {312951002,154605712,312842505,154629332}, 
+    {314858999,154629332,314966497,154655564}, {312842505,154629332,312735007,154655564}, {314966497,154655564,315072961,154684373}, 
+    {312735007,154655564,312628543,154684373}, {315072961,154684373,315178355,154715725}, {312628543,154684373,312523149,154715725}, 
+    {315178355,154715725,315282644,154749584}, {312523149,154715725,312418860,154749584}, {315282644,154749584,315385794,154785915}, 
+    {312418860,154749584,312315710,154785915}, {315385794,154785915,315487769,154824684}, {312315710,154785915,312213735,154824684}, 
+    {315487769,154824684,315588534,154865854}, {312213735,154824684,312112970,154865854}, {315588534,154865854,315688054,154909391}, 
+    {312112970,154865854,312013450,154909391}, {315688054,154909391,315786295,154955260}, {312013450,154909391,311915209,154955260}, 
+    {315786295,154955260,315883220,155003426}, {311915209,154955260,311818284,155003426}, {315883220,155003426,315978796,155053854}, 
+    {311818284,155003426,311722708,155053854}, {315978796,155053854,316072986,155106509}, {311722708,155053854,311628518,155106509}, 
+    {316072986,155106509,316165756,155161355}, {311628518,155106509,311535748,155161355}, {316165756,155161355,316257071,155218357}, 
+    {311535748,155161355,311444433,155218357}, {316257071,155218357,316346895,155277481}, {311444433,155218357,311354609,155277481}, 
+    {316346895,155277481,316435194,155338692}, {311354609,155277481,311266310,155338692}, {316435194,155338692,316521933,155401954}, 
+    {311266310,155338692,311179571,155401954}, {316521933,155401954,316607076,155467232}, {311179571,155401954,311094428,155467232}, 
+    {316607076,155467232,316690589,155534491}, {311094428,155467232,311010915,155534491}, {316690589,155534491,316772436,155603697}, 
+    {311010915,155534491,310929068,155603697}, {316772436,155603697,316852582,155674814}, {310929068,155603697,310848922,155674814}, 
+    {316852582,155674814,316930992,155747806}, {310848922,155674814,310770512,155747806}, {316930992,155747806,317007632,155822640}, 
+    {310770512,155747806,310693872,155822640}, {317007632,155822640,317082466,155899280}, {310693872,155822640,310619038,155899280}, 
+    {317082466,155899280,317155458,155977690}, {310619038,155899280,310546046,155977690}, {317155458,155977690,317226575,156057836}, 
+    {310546046,155977690,310474929,156057836}, {317226575,156057836,317295781,156139683}, {310474929,156057836,310405723,156139683}, 
+    {317295781,156139683,317363040,156223196}, {310405723,156139683,310338464,156223196}, {317363040,156223196,317428318,156308339}, 
+    {310338464,156223196,310273186,156308339}, {317428318,156308339,317491580,156395078}, {310273186,156308339,310209924,156395078}, 
+    {317491580,156395078,317552791,156483377}, {310209924,156395078,310148713,156483377}, {317552791,156483377,317611915,156573201}, 
+    {310148713,156483377,310089589,156573201}, {317611915,156573201,317668917,156664516}, {310089589,156573201,310032587,156664516}, 
+    {317668917,156664516,317723763,156757286}, {310032587,156664516,309977741,156757286}, {317723763,156757286,317776418,156851476}, 
+    {309977741,156757286,309925086,156851476}, {317776418,156851476,317826846,156947052}, {309925086,156851476,309874658,156947052}, 
+    {317826846,156947052,317875012,157043977}, {309874658,156947052,309826492,157043977}, {317875012,157043977,317920881,157142218}, 
+    {309826492,157043977,309780623,157142218}, {317920881,157142218,317964418,157241738}, {309780623,157142218,309737086,157241738}, 
+    {317964418,157241738,318005588,157342503}, {309737086,157241738,309695916,157342503}, {318005588,157342503,318044357,157444478}, 
+    {309695916,157342503,309657147,157444478}, {318044357,157444478,318080688,157547628}, {309657147,157444478,309620816,157547628}, 
+    {318080688,157547628,318114547,157651917}, {309620816,157547628,309586957,157651917}, {318114547,157651917,318145899,157757311}, 
+    {309586957,157651917,309555605,157757311}, {318145899,157757311,318174708,157863775}, {309555605,157757311,309526796,157863775}, 
+    {318174708,157863775,318200940,157971273}, {309526796,157863775,309500564,157971273}, {318200940,157971273,318224560,158079770}, 
+    {309500564,157971273,309476944,158079770}, {318224560,158079770,318245533,158189232}, {309476944,158079770,309455971,158189232}, 
+    {318245533,158189232,318263822,158299623}, {309455971,158189232,309437682,158299623}, {318263822,158299623,318279395,158410908}, 
+    {309437682,158299623,309422109,158410908}, {318279395,158410908,318292214,158523053}, {309422109,158410908,309409290,158523053}, 
+    {318292214,158523053,318302246,158636021}, {309409290,158523053,309399258,158636021}, {318302246,158636021,318309455,158749778}, 
+    {309399258,158636021,309392049,158749778}, {318309455,158749778,318313806,158864290}, {309392049,158749778,309387698,158864290}, 
+    {318313806,158864290,318315264,158979520}, {309387698,158864290,309386240,158979520}, {318315264,158979520,318313806,159094750}, 
+    {309386240,158979520,309387698,159094750}, {318313806,159094750,318309455,159209262}, {309387698,159094750,309392049,159209262}, 
+    {318309455,159209262,318302246,159323019}, {309392049,159209262,309399258,159323019}, {318302246,159323019,318292214,159435987}, 
+    {309399258,159323019,309409290,159435987}, {318292214,159435987,318279395,159548132}, {309409290,159435987,309422109,159548132}, 
+    {318279395,159548132,318263822,159659417}, {309422109,159548132,309437682,159659417}, {318263822,159659417,318245533,159769808}, 
+    {309437682,159659417,309455971,159769808}, {318245533,159769808,318224560,159879270}, {309455971,159769808,309476944,159879270}, 
+    {318224560,159879270,318200940,159987767}, {309476944,159879270,309500564,159987767}, {318200940,159987767,318174708,160095265}, 
+    {309500564,159987767,309526796,160095265}, {318174708,160095265,318145899,160201729}, {309526796,160095265,309555605,160201729}, 
+    {318145899,160201729,318114547,160307123}, {309555605,160201729,309586957,160307123}, {318114547,160307123,318080688,160411412}, 
+    {309586957,160307123,309620816,160411412}, {318080688,160411412,318044357,160514562}, {309620816,160411412,309657147,160514562}, 
+    {318044357,160514562,318005588,160616537}, {309657147,160514562,309695916,160616537}, {318005588,160616537,317964418,160717302}, 
+    {309695916,160616537,309737086,160717302}, {317964418,160717302,317920881,160816822}, {309737086,160717302,309780623,160816822}, 
+    {317920881,160816822,317875012,160915063}, {309780623,160816822,309826492,160915063}, {317875012,160915063,317826846,161011988}, 
+    {309826492,160915063,309874658,161011988}, {317826846,161011988,317776418,161107564}, {309874658,161011988,309925086,161107564}, 
+    {317776418,161107564,317723763,161201754}, {309925086,161107564,309977741,161201754}, {317723763,161201754,317668917,161294524}, 
+    {309977741,161201754,310032587,161294524}, {317668917,161294524,317611915,161385839}, {310032587,161294524,310089589,161385839}, 
+    {317611915,161385839,317552791,161475663}, {310089589,161385839,310148713,161475663}, {317552791,161475663,317491580,161563962}, 
+    {310148713,161475663,310209924,161563962}, {317491580,161563962,317428318,161650701}, {310209924,161563962,310273186,161650701}, 
+    {317428318,161650701,317363040,161735844}, {310273186,161650701,310338464,161735844}, {317363040,161735844,317295781,161819357}, 
+    {310338464,161735844,310405723,161819357}, {317295781,161819357,317226575,161901204}, {310405723,161819357,310474929,161901204}, 
+    {317226575,161901204,317155458,161981350}, {310474929,161901204,310546046,161981350}, {317155458,161981350,317082466,162059760}, 
+    {310546046,161981350,310619038,162059760}, {317082466,162059760,317007632,162136400}, {310619038,162059760,310693872,162136400}, 
+    {317007632,162136400,316930992,162211234}, {310693872,162136400,310770512,162211234}, {316930992,162211234,316852582,162284226}, 
+    {310770512,162211234,310848922,162284226}, {316852582,162284226,316772436,162355343}, {310848922,162284226,310929068,162355343}, 
+    {316772436,162355343,316690589,162424549}, {310929068,162355343,311010915,162424549}, {316690589,162424549,316607076,162491808}, 
+    {311010915,162424549,311094428,162491808}, {316607076,162491808,316521933,162557086}, {311094428,162491808,311179571,162557086}, 
+    {316521933,162557086,316435194,162620348}, {311179571,162557086,311266310,162620348}, {316435194,162620348,316346895,162681559}, 
+    {311266310,162620348,311354609,162681559}, {316346895,162681559,316257071,162740683}, {311354609,162681559,311444433,162740683}, 
+    {316257071,162740683,316165756,162797685}, {311444433,162740683,311535748,162797685}, {316165756,162797685,316072986,162852531}, 
+    {311535748,162797685,311628518,162852531}, {316072986,162852531,315978796,162905186}, {311628518,162852531,311722708,162905186}, 
+    {315978796,162905186,315883220,162955614}, {311722708,162905186,311818284,162955614}, {315883220,162955614,315786295,163003780}, 
+    {311818284,162955614,311915209,163003780}, {315786295,163003780,315688054,163049649}, {311915209,163003780,312013450,163049649}, 
+    {315688054,163049649,315588534,163093186}, {312013450,163049649,312112970,163093186}, {315588534,163093186,315487769,163134356}, 
+    {312112970,163093186,312213735,163134356}, {315487769,163134356,315385794,163173125}, {312213735,163134356,312315710,163173125}, 
+    {315385794,163173125,315282644,163209456}, {312315710,163173125,312418860,163209456}, {315282644,163209456,315178355,163243315}, 
+    {312418860,163209456,312523149,163243315}, {315178355,163243315,315072961,163274667}, {312523149,163243315,312628543,163274667}, 
+    {315072961,163274667,314966497,163303476}, {312628543,163274667,312735007,163303476}, {314966497,163303476,314858999,163329708}, 
+    {312735007,163303476,312842505,163329708}, {314858999,163329708,314750502,163353328}, {312842505,163329708,312951002,163353328}, 
+    {314750502,163353328,314641040,163374301}, {312951002,163353328,313060464,163374301}, {314641040,163374301,314530649,163392590}, 
+    {313060464,163374301,313170855,163392590}, {314530649,163392590,314419364,163408163}, {313170855,163392590,313282140,163408163}, 
+    {314419364,163408163,314307219,163420982}, {313282140,163408163,313394285,163420982}, {314307219,163420982,314194251,163431014}, 
+    {313394285,163420982,313507253,163431014}, {314194251,163431014,314080494,163438223}, {313507253,163431014,313621010,163438223}, 
+    {314080494,163438223,313965982,163442574}, {313621010,163438223,313735522,163442574}, {313965982,163442574,313850752,163444032}, 
+    {313735522,163442574,313850752,163444032}, 
+};
+
+const Segment SEGMENTS_OUTER4[] = {
+    {300575808,142766848,300691038,142768306}, {300575808,142766848,300460578,142768306}, {300691038,142768306,300805550,142772657}, 
+    {300460578,142768306,300346066,142772657}, {300805550,142772657,300919307,142779866}, {300346066,142772657,300232309,142779866}, 
+    {300919307,142779866,301032275,142789898}, {300232309,142779866,300119341,142789898}, {301032275,142789898,301144420,142802717}, 
+    {300119341,142789898,300007196,142802717}, {301144420,142802717,301255705,142818290}, {300007196,142802717,299895911,142818290}, 
+    {301255705,142818290,301366096,142836579}, {299895911,142818290,299785520,142836579}, {301366096,142836579,301475558,142857552}, 
+    {299785520,142836579,299676058,142857552}, {301475558,142857552,301584055,142881172}, {299676058,142857552,299567561,142881172}, 
+    {301584055,142881172,301691553,142907404}, {299567561,142881172,299460063,142907404}, {301691553,142907404,301798017,142936213}, 
+    {299460063,142907404,299353599,142936213}, {301798017,142936213,301903411,142967565}, {299353599,142936213,299248205,142967565}, 
+    {301903411,142967565,302007700,143001424}, {299248205,142967565,299143916,143001424}, {302007700,143001424,302110850,143037755}, 
+    {299143916,143001424,299040766,143037755}, {302110850,143037755,302212825,143076524}, {299040766,143037755,298938791,143076524}, 
+    {302212825,143076524,302313590,143117694}, {298938791,143076524,298838026,143117694}, {302313590,143117694,302413110,143161231}, 
+    {298838026,143117694,298738506,143161231}, {302413110,143161231,302511351,143207100}, {298738506,143161231,298640265,143207100}, 
+    {302511351,143207100,302608276,143255266}, {298640265,143207100,298543340,143255266}, {302608276,143255266,302703852,143305694}, 
+    {298543340,143255266,298447764,143305694}, {302703852,143305694,302798042,143358349}, {298447764,143305694,298353574,143358349}, 
+    {302798042,143358349,302890812,143413195}, {298353574,143358349,298260804,143413195}, {302890812,143413195,302982127,143470197}, 
+    {298260804,143413195,298169489,143470197}, {302982127,143470197,303071951,143529321}, {298169489,143470197,298079665,143529321}, 
+    {303071951,143529321,303160250,143590532}, {298079665,143529321,297991366,143590532}, {303160250,143590532,303246989,143653794}, 
+    {297991366,143590532,297904627,143653794}, {303246989,143653794,303332132,143719072}, {297904627,143653794,297819484,143719072}, 
+    {303332132,143719072,303415645,143786331}, {297819484,143719072,297735971,143786331}, {303415645,143786331,303497492,143855537}, 
+    {297735971,143786331,297654124,143855537}, {303497492,143855537,303577638,143926654}, {297654124,143855537,297573978,143926654}, 
+    {303577638,143926654,303656048,143999646}, {297573978,143926654,297495568,143999646}, {303656048,143999646,303732688,144074480}, 
+    {297495568,143999646,297418928,144074480}, {303732688,144074480,303807522,144151120}, {297418928,144074480,297344094,144151120}, 
+    {303807522,144151120,303880514,144229530}, {297344094,144151120,297271102,144229530}, {303880514,144229530,303951631,144309676}, 
+    {297271102,144229530,297199985,144309676}, {303951631,144309676,304020837,144391523}, {297199985,144309676,297130779,144391523}, 
+    {304020837,144391523,304088096,144475036}, {297130779,144391523,297063520,144475036}, {304088096,144475036,304153374,144560179}, 
+    {297063520,144475036,296998242,144560179}, {304153374,144560179,304216636,144646918}, {296998242,144560179,296934980,144646918}, 
+    {304216636,144646918,304277847,144735217}, {296934980,144646918,296873769,144735217}, {304277847,144735217,304336971,144825041}, 
+    {296873769,144735217,296814645,144825041}, {304336971,144825041,304393973,144916356}, {296814645,144825041,296757643,144916356}, 
+    {304393973,144916356,304448819,145009126}, {296757643,144916356,296702797,145009126}, {304448819,145009126,304501474,145103316}, 
+    {296702797,145009126,296650142,145103316}, {304501474,145103316,304551902,145198892}, {296650142,145103316,296599714,145198892}, 
+    {304551902,145198892,304600068,145295817}, {296599714,145198892,296551548,145295817}, {304600068,145295817,304645937,145394058}, 
+    {296551548,145295817,296505679,145394058}, {304645937,145394058,304689474,145493578}, {296505679,145394058,296462142,145493578}, 
+    {304689474,145493578,304730644,145594343}, {296462142,145493578,296420972,145594343}, {304730644,145594343,304769413,145696318}, 
+    {296420972,145594343,296382203,145696318}, {304769413,145696318,304805744,145799468}, {296382203,145696318,296345872,145799468}, 
+    {304805744,145799468,304839603,145903757}, {296345872,145799468,296312013,145903757}, {304839603,145903757,304870955,146009151}, 
+    {296312013,145903757,296280661,146009151}, {304870955,146009151,304899764,146115615}, {296280661,146009151,296251852,146115615}, 
+    {304899764,146115615,304925996,146223113}, {296251852,146115615,296225620,146223113}, {304925996,146223113,304949616,146331610}, 
+    {296225620,146223113,296202000,146331610}, {304949616,146331610,304970589,146441072}, {296202000,146331610,296181027,146441072}, 
+    {304970589,146441072,304988878,146551463}, {296181027,146441072,296162738,146551463}, {304988878,146551463,305004451,146662748}, 
+    {296162738,146551463,296147165,146662748}, {305004451,146662748,305017270,146774893}, {296147165,146662748,296134346,146774893}, 
+    {305017270,146774893,305027302,146887861}, {296134346,146774893,296124314,146887861}, {305027302,146887861,305034511,147001618}, 
+    {296124314,146887861,296117105,147001618}, {305034511,147001618,305038862,147116130}, {296117105,147001618,296112754,147116130}, 
+    {305038862,147116130,305040320,147231360}, {296112754,147116130,296111296,147231360}, {305040320,147231360,305038862,147346590}, 
+    {296111296,147231360,296112754,147346590}, {305038862,147346590,305034511,147461102}, {296112754,147346590,296117105,147461102}, 
+    {305034511,147461102,305027302,147574859}, {296117105,147461102,296124314,147574859}, {305027302,147574859,305017270,147687827}, 
+    {296124314,147574859,296134346,147687827}, {305017270,147687827,305004451,147799972}, {296134346,147687827,296147165,147799972}, 
+    {305004451,147799972,304988878,147911257}, {296147165,147799972,296162738,147911257}, {304988878,147911257,304970589,148021648}, 
+    {296162738,147911257,296181027,148021648}, {304970589,148021648,304949616,148131110}, {296181027,148021648,296202000,148131110}, 
+    {304949616,148131110,304925996,148239607}, {296202000,148131110,296225620,148239607}, {304925996,148239607,304899764,148347105}, 
+    {296225620,148239607,296251852,148347105}, {304899764,148347105,304870955,148453569}, {296251852,148347105,296280661,148453569}, 
+    {304870955,148453569,304839603,148558963}, {296280661,148453569,296312013,148558963}, {304839603,148558963,304805744,148663252}, 
+    {296312013,148558963,296345872,148663252}, {304805744,148663252,304769413,148766402}, {296345872,148663252,296382203,148766402}, 
+    {304769413,148766402,304730644,148868377}, {296382203,148766402,296420972,148868377}, {304730644,148868377,304689474,148969142}, 
+    {296420972,148868377,296462142,148969142}, {304689474,148969142,304645937,149068662}, {296462142,148969142,296505679,149068662}, 
+    {304645937,149068662,304600068,149166903}, {296505679,149068662,296551548,149166903}, {304600068,149166903,304551902,149263828}, 
+    {296551548,149166903,296599714,149263828}, {304551902,149263828,304501474,149359404}, {296599714,149263828,296650142,149359404}, 
+    {304501474,149359404,304448819,149453594}, {296650142,149359404,296702797,149453594}, {304448819,149453594,304393973,149546364}, 
+    {296702797,149453594,296757643,149546364}, {304393973,149546364,304336971,149637679}, {296757643,149546364,296814645,149637679}, 
+    {304336971,149637679,304277847,149727503}, {296814645,149637679,296873769,149727503}, {304277847,149727503,304216636,149815802}, 
+    {296873769,149727503,296934980,149815802}, {304216636,149815802,304153374,149902541}, {296934980,149815802,296998242,149902541}, 
+    {304153374,149902541,304088096,149987684}, {296998242,149902541,297063520,149987684}, {304088096,149987684,304020837,150071197}, 
+    {297063520,149987684,297130779,150071197}, {304020837,150071197,303951631,150153044}, {297130779,150071197,297199985,150153044}, 
+    {303951631,150153044,303880514,150233190}, {297199985,150153044,297271102,150233190}, {303880514,150233190,303807522,150311600}, 
+    {297271102,150233190,297344094,150311600}, {303807522,150311600,303732688,150388240}, {297344094,150311600,297418928,150388240}, 
+    {303732688,150388240,303656048,150463074}, {297418928,150388240,297495568,150463074}, {303656048,150463074,303577638,150536066}, 
+    {297495568,150463074,297573978,150536066}, {303577638,150536066,303497492,150607183}, {297573978,150536066,297654124,150607183}, 
+    {303497492,150607183,303415645,150676389}, {297654124,150607183,297735971,150676389}, {303415645,150676389,303332132,150743648}, 
+    {297735971,150676389,297819484,150743648}, {303332132,150743648,303246989,150808926}, {297819484,150743648,297904627,150808926}, 
+    {303246989,150808926,303160250,150872188}, {297904627,150808926,297991366,150872188}, {303160250,150872188,303071951,150933399}, 
+    {297991366,150872188,298079665,150933399}, {303071951,150933399,302982127,150992523}, {298079665,150933399,298169489,150992523}, 
+    {302982127,150992523,302890812,151049525}, {298169489,150992523,298260804,151049525}, {302890812,151049525,302798042,151104371}, 
+    {298260804,151049525,298353574,151104371}, {302798042,151104371,302703852,151157026}, {298353574,151104371,298447764,151157026}, 
+    {302703852,151157026,302608276,151207454}, {298447764,151157026,298543340,151207454}, {302608276,151207454,302511351,151255620}, 
+    {298543340,151207454,298640265,151255620}, {302511351,151255620,302413110,151301489}, {298640265,151255620,298738506,151301489}, 
+    {302413110,151301489,302313590,151345026}, {298738506,151301489,298838026,151345026}, {302313590,151345026,302212825,151386196}, 
+    {298838026,151345026,298938791,151386196}, {302212825,151386196,302110850,151424965}, {298938791,151386196,299040766,151424965}, 
+    {302110850,151424965,302007700,151461296}, {299040766,151424965,299143916,151461296}, {302007700,151461296,301903411,151495155}, 
+    {299143916,151461296,299248205,151495155}, {301903411,151495155,301798017,151526507}, {299248205,151495155,299353599,151526507}, 
+    {301798017,151526507,301691553,151555316}, {299353599,151526507,299460063,151555316}, {301691553,151555316,301584055,151581548}, 
+    {299460063,151555316,299567561,151581548}, {301584055,151581548,301475558,151605168}, {299567561,151581548,299676058,151605168}, 
+    {301475558,151605168,301366096,151626141}, {299676058,151605168,299785520,151626141}, {301366096,151626141,301255705,151644430}, 
+    {299785520,151626141,299895911,151644430}, {301255705,151644430,301144420,151660003}, {299895911,151644430,300007196,151660003}, 
+    {301144420,151660003,301032275,151672822}, {300007196,151660003,300119341,151672822}, {301032275,151672822,300919307,151682854}, 
+    {300119341,151672822,300232309,151682854}, {300919307,151682854,300805550,151690063}, {300232309,151682854,300346066,151690063}, 
+    {300805550,151690063,300691038,151694414}, {300346066,151690063,300460578,151694414}, {300691038,151694414,300575808,151695872}, 
+    {300460578,151694414,300575808,151695872}, 
+};
+
+const Segment SEGMENTS_OUTER5[] = {
+    {282072064,136040256,282187294,136041714}, {282072064,136040256,281956834,136041714}, {282187294,136041714,282301806,136046065}, 
+    {281956834,136041714,281842322,136046065}, {282301806,136046065,282415563,136053274}, {281842322,136046065,281728565,136053274}, 
+    {282415563,136053274,282528531,136063306}, {281728565,136053274,281615597,136063306}, {282528531,136063306,282640676,136076125}, 
+    {281615597,136063306,281503452,136076125}, {282640676,136076125,282751961,136091698}, {281503452,136076125,281392167,136091698}, 
+    {282751961,136091698,282862352,136109987}, {281392167,136091698,281281776,136109987}, {282862352,136109987,282971814,136130960}, 
+    {281281776,136109987,281172314,136130960}, {282971814,136130960,283080311,136154580}, {281172314,136130960,281063817,136154580}, 
+    {283080311,136154580,283187809,136180812}, {281063817,136154580,280956319,136180812}, {283187809,136180812,283294273,136209621}, 
+    {280956319,136180812,280849855,136209621}, {283294273,136209621,283399667,136240973}, {280849855,136209621,280744461,136240973}, 
+    {283399667,136240973,283503956,136274832}, {280744461,136240973,280640172,136274832}, {283503956,136274832,283607106,136311163}, 
+    {280640172,136274832,280537022,136311163}, {283607106,136311163,283709081,136349932}, {280537022,136311163,280435047,136349932}, 
+    {283709081,136349932,283809846,136391102}, {280435047,136349932,280334282,136391102}, {283809846,136391102,283909366,136434639}, 
+    {280334282,136391102,280234762,136434639}, {283909366,136434639,284007607,136480508}, {280234762,136434639,280136521,136480508}, 
+    {284007607,136480508,284104532,136528674}, {280136521,136480508,280039596,136528674}, {284104532,136528674,284200108,136579102}, 
+    {280039596,136528674,279944020,136579102}, {284200108,136579102,284294298,136631757}, {279944020,136579102,279849830,136631757}, 
+    {284294298,136631757,284387068,136686603}, {279849830,136631757,279757060,136686603}, {284387068,136686603,284478383,136743605}, 
+    {279757060,136686603,279665745,136743605}, {284478383,136743605,284568207,136802729}, {279665745,136743605,279575921,136802729}, 
+    {284568207,136802729,284656506,136863940}, {279575921,136802729,279487622,136863940}, {284656506,136863940,284743245,136927202}, 
+    {279487622,136863940,279400883,136927202}, {284743245,136927202,284828388,136992480}, {279400883,136927202,279315740,136992480}, 
+    {284828388,136992480,284911901,137059739}, {279315740,136992480,279232227,137059739}, {284911901,137059739,284993748,137128945}, 
+    {279232227,137059739,279150380,137128945}, {284993748,137128945,285073894,137200062}, {279150380,137128945,279070234,137200062}, 
+    {285073894,137200062,285152304,137273054}, {279070234,137200062,278991824,137273054}, {285152304,137273054,285228944,137347888}, 
+    {278991824,137273054,278915184,137347888}, {285228944,137347888,285303778,137424528}, {278915184,137347888,278840350,137424528}, 
+    {285303778,137424528,285376770,137502938}, {278840350,137424528,278767358,137502938}, {285376770,137502938,285447887,137583084}, 
+    {278767358,137502938,278696241,137583084}, {285447887,137583084,285517093,137664931}, {278696241,137583084,278627035,137664931}, 
+    {285517093,137664931,285584352,137748444}, {278627035,137664931,278559776,137748444}, {285584352,137748444,285649630,137833587}, 
+    {278559776,137748444,278494498,137833587}, {285649630,137833587,285712892,137920326}, {278494498,137833587,278431236,137920326}, 
+    {285712892,137920326,285774103,138008625}, {278431236,137920326,278370025,138008625}, {285774103,138008625,285833227,138098449}, 
+    {278370025,138008625,278310901,138098449}, {285833227,138098449,285890229,138189764}, {278310901,138098449,278253899,138189764}, 
+    {285890229,138189764,285945075,138282534}, {278253899,138189764,278199053,138282534}, {285945075,138282534,285997730,138376724}, 
+    {278199053,138282534,278146398,138376724}, {285997730,138376724,286048158,138472300}, {278146398,138376724,278095970,138472300}, 
+    {286048158,138472300,286096324,138569225}, {278095970,138472300,278047804,138569225}, {286096324,138569225,286142193,138667466}, 
+    {278047804,138569225,278001935,138667466}, {286142193,138667466,286185730,138766986}, {278001935,138667466,277958398,138766986}, 
+    {286185730,138766986,286226900,138867751}, {277958398,138766986,277917228,138867751}, {286226900,138867751,286265669,138969726}, 
+    {277917228,138867751,277878459,138969726}, {286265669,138969726,286302000,139072876}, {277878459,138969726,277842128,139072876}, 
+    {286302000,139072876,286335859,139177165}, {277842128,139072876,277808269,139177165}, {286335859,139177165,286367211,139282559}, 
+    {277808269,139177165,277776917,139282559}, {286367211,139282559,286396020,139389023}, {277776917,139282559,277748108,139389023}, 
+    {286396020,139389023,286422252,139496521}, {277748108,139389023,277721876,139496521}, {286422252,139496521,286445872,139605018}, 
+    {277721876,139496521,277698256,139605018}, {286445872,139605018,286466845,139714480}, {277698256,139605018,277677283,139714480}, 
+    {286466845,139714480,286485134,139824871}, {277677283,139714480,277658994,139824871}, {286485134,139824871,286500707,139936156}, 
+    {277658994,139824871,277643421,139936156}, {286500707,139936156,286513526,140048301}, {277643421,139936156,277630602,140048301}, 
+    {286513526,140048301,286523558,140161269}, {277630602,140048301,277620570,140161269}, {286523558,140161269,286530767,140275026}, 
+    {277620570,140161269,277613361,140275026}, {286530767,140275026,286535118,140389538}, {277613361,140275026,277609010,140389538}, 
+    {286535118,140389538,286536576,140504768}, {277609010,140389538,277607552,140504768}, {286536576,140504768,286535118,140619998}, 
+    {277607552,140504768,277609010,140619998}, {286535118,140619998,286530767,140734510}, {277609010,140619998,277613361,140734510}, 
+    {286530767,140734510,286523558,140848267}, {277613361,140734510,277620570,140848267}, {286523558,140848267,286513526,140961235}, 
+    {277620570,140848267,277630602,140961235}, {286513526,140961235,286500707,141073380}, {277630602,140961235,277643421,141073380}, 
+    {286500707,141073380,286485134,141184665}, {277643421,141073380,277658994,141184665}, {286485134,141184665,286466845,141295056}, 
+    {277658994,141184665,277677283,141295056}, {286466845,141295056,286445872,141404518}, {277677283,141295056,277698256,141404518}, 
+    {286445872,141404518,286422252,141513015}, {277698256,141404518,277721876,141513015}, {286422252,141513015,286396020,141620513}, 
+    {277721876,141513015,277748108,141620513}, {286396020,141620513,286367211,141726977}, {277748108,141620513,277776917,141726977}, 
+    {286367211,141726977,286335859,141832371}, {277776917,141726977,277808269,141832371}, {286335859,141832371,286302000,141936660}, 
+    {277808269,141832371,277842128,141936660}, {286302000,141936660,286265669,142039810}, {277842128,141936660,277878459,142039810}, 
+    {286265669,142039810,286226900,142141785}, {277878459,142039810,277917228,142141785}, {286226900,142141785,286185730,142242550}, 
+    {277917228,142141785,277958398,142242550}, {286185730,142242550,286142193,142342070}, {277958398,142242550,278001935,142342070}, 
+    {286142193,142342070,286096324,142440311}, {278001935,142342070,278047804,142440311}, {286096324,142440311,286048158,142537236}, 
+    {278047804,142440311,278095970,142537236}, {286048158,142537236,285997730,142632812}, {278095970,142537236,278146398,142632812}, 
+    {285997730,142632812,285945075,142727002}, {278146398,142632812,278199053,142727002}, {285945075,142727002,285890229,142819772}, 
+    {278199053,142727002,278253899,142819772}, {285890229,142819772,285833227,142911087}, {278253899,142819772,278310901,142911087}, 
+    {285833227,142911087,285774103,143000911}, {278310901,142911087,278370025,143000911}, {285774103,143000911,285712892,143089210}, 
+    {278370025,143000911,278431236,143089210}, {285712892,143089210,285649630,143175949}, {278431236,143089210,278494498,143175949}, 
+    {285649630,143175949,285584352,143261092}, {278494498,143175949,278559776,143261092}, {285584352,143261092,285517093,143344605}, 
+    {278559776,143261092,278627035,143344605}, {285517093,143344605,285447887,143426452}, {278627035,143344605,278696241,143426452}, 
+    {285447887,143426452,285376770,143506598}, {278696241,143426452,278767358,143506598}, {285376770,143506598,285303778,143585008}, 
+    {278767358,143506598,278840350,143585008}, {285303778,143585008,285228944,143661648}, {278840350,143585008,278915184,143661648}, 
+    {285228944,143661648,285152304,143736482}, {278915184,143661648,278991824,143736482}, {285152304,143736482,285073894,143809474}, 
+    {278991824,143736482,279070234,143809474}, {285073894,143809474,284993748,143880591}, {279070234,143809474,279150380,143880591}, 
+    {284993748,143880591,284911901,143949797}, {279150380,143880591,279232227,143949797}, {284911901,143949797,284828388,144017056}, 
+    {279232227,143949797,279315740,144017056}, {284828388,144017056,284743245,144082334}, {279315740,144017056,279400883,144082334}, 
+    {284743245,144082334,284656506,144145596}, {279400883,144082334,279487622,144145596}, {284656506,144145596,284568207,144206807}, 
+    {279487622,144145596,279575921,144206807}, {284568207,144206807,284478383,144265931}, {279575921,144206807,279665745,144265931}, 
+    {284478383,144265931,284387068,144322933}, {279665745,144265931,279757060,144322933}, {284387068,144322933,284294298,144377779}, 
+    {279757060,144322933,279849830,144377779}, {284294298,144377779,284200108,144430434}, {279849830,144377779,279944020,144430434}, 
+    {284200108,144430434,284104532,144480862}, {279944020,144430434,280039596,144480862}, {284104532,144480862,284007607,144529028}, 
+    {280039596,144480862,280136521,144529028}, {284007607,144529028,283909366,144574897}, {280136521,144529028,280234762,144574897}, 
+    {283909366,144574897,283809846,144618434}, {280234762,144574897,280334282,144618434}, {283809846,144618434,283709081,144659604}, 
+    {280334282,144618434,280435047,144659604}, {283709081,144659604,283607106,144698373}, {280435047,144659604,280537022,144698373}, 
+    {283607106,144698373,283503956,144734704}, {280537022,144698373,280640172,144734704}, {283503956,144734704,283399667,144768563}, 
+    {280640172,144734704,280744461,144768563}, {283399667,144768563,283294273,144799915}, {280744461,144768563,280849855,144799915}, 
+    {283294273,144799915,283187809,144828724}, {280849855,144799915,280956319,144828724}, {283187809,144828724,283080311,144854956}, 
+    {280956319,144828724,281063817,144854956}, {283080311,144854956,282971814,144878576}, {281063817,144854956,281172314,144878576}, 
+    {282971814,144878576,282862352,144899549}, {281172314,144878576,281281776,144899549}, {282862352,144899549,282751961,144917838}, 
+    {281281776,144899549,281392167,144917838}, {282751961,144917838,282640676,144933411}, {281392167,144917838,281503452,144933411}, 
+    {282640676,144933411,282528531,144946230}, {281503452,144933411,281615597,144946230}, {282528531,144946230,282415563,144956262}, 
+    {281615597,144946230,281728565,144956262}, {282415563,144956262,282301806,144963471}, {281728565,144956262,281842322,144963471}, 
+    {282301806,144963471,282187294,144967822}, {281842322,144963471,281956834,144967822}, {282187294,144967822,282072064,144969280}, 
+    {281956834,144967822,282072064,144969280}, 
+};
+
+const Segment SEGMENTS_OUTER6[] = {
+    {264356608,136041920,264471838,136043378}, {264356608,136041920,264241378,136043378}, {264471838,136043378,264586350,136047729}, 
+    {264241378,136043378,264126866,136047729}, {264586350,136047729,264700107,136054938}, {264126866,136047729,264013109,136054938}, 
+    {264700107,136054938,264813075,136064970}, {264013109,136054938,263900141,136064970}, {264813075,136064970,264925220,136077789}, 
+    {263900141,136064970,263787996,136077789}, {264925220,136077789,265036505,136093362}, {263787996,136077789,263676711,136093362}, 
+    {265036505,136093362,265146896,136111651}, {263676711,136093362,263566320,136111651}, {265146896,136111651,265256358,136132624}, 
+    {263566320,136111651,263456858,136132624}, {265256358,136132624,265364855,136156244}, {263456858,136132624,263348361,136156244}, 
+    {265364855,136156244,265472353,136182476}, {263348361,136156244,263240863,136182476}, {265472353,136182476,265578817,136211285}, 
+    {263240863,136182476,263134399,136211285}, {265578817,136211285,265684211,136242637}, {263134399,136211285,263029005,136242637}, 
+    {265684211,136242637,265788500,136276496}, {263029005,136242637,262924716,136276496}, {265788500,136276496,265891650,136312827}, 
+    {262924716,136276496,262821566,136312827}, {265891650,136312827,265993625,136351596}, {262821566,136312827,262719591,136351596}, 
+    {265993625,136351596,266094390,136392766}, {262719591,136351596,262618826,136392766}, {266094390,136392766,266193910,136436303}, 
+    {262618826,136392766,262519306,136436303}, {266193910,136436303,266292151,136482172}, {262519306,136436303,262421065,136482172}, 
+    {266292151,136482172,266389076,136530338}, {262421065,136482172,262324140,136530338}, {266389076,136530338,266484652,136580766}, 
+    {262324140,136530338,262228564,136580766}, {266484652,136580766,266578842,136633421}, {262228564,136580766,262134374,136633421}, 
+    {266578842,136633421,266671612,136688267}, {262134374,136633421,262041604,136688267}, {266671612,136688267,266762927,136745269}, 
+    {262041604,136688267,261950289,136745269}, {266762927,136745269,266852751,136804393}, {261950289,136745269,261860465,136804393}, 
+    {266852751,136804393,266941050,136865604}, {261860465,136804393,261772166,136865604}, {266941050,136865604,267027789,136928866}, 
+    {261772166,136865604,261685427,136928866}, {267027789,136928866,267112932,136994144}, {261685427,136928866,261600284,136994144}, 
+    {267112932,136994144,267196445,137061403}, {261600284,136994144,261516771,137061403}, {267196445,137061403,267278292,137130609}, 
+    {261516771,137061403,261434924,137130609}, {267278292,137130609,267358438,137201726}, {261434924,137130609,261354778,137201726}, 
+    {267358438,137201726,267436848,137274718}, {261354778,137201726,261276368,137274718}, {267436848,137274718,267513488,137349552}, 
+    {261276368,137274718,261199728,137349552}, {267513488,137349552,267588322,137426192}, {261199728,137349552,261124894,137426192}, 
+    {267588322,137426192,267661314,137504602}, {261124894,137426192,261051902,137504602}, {267661314,137504602,267732431,137584748}, 
+    {261051902,137504602,260980785,137584748}, {267732431,137584748,267801637,137666595}, {260980785,137584748,260911579,137666595}, 
+    {267801637,137666595,267868896,137750108}, {260911579,137666595,260844320,137750108}, {267868896,137750108,267934174,137835251}, 
+    {260844320,137750108,260779042,137835251}, {267934174,137835251,267997436,137921990}, {260779042,137835251,260715780,137921990}, 
+    {267997436,137921990,268058647,138010289}, {260715780,137921990,260654569,138010289}, {268058647,138010289,268117771,138100113}, 
+    {260654569,138010289,260595445,138100113}, {268117771,138100113,268174773,138191428}, {260595445,138100113,260538443,138191428}, 
+    {268174773,138191428,268229619,138284198}, {260538443,138191428,260483597,138284198}, {268229619,138284198,268282274,138378388}, 
+    {260483597,138284198,260430942,138378388}, {268282274,138378388,268332702,138473964}, {260430942,138378388,260380514,138473964}, 
+    {268332702,138473964,268380868,138570889}, {260380514,138473964,260332348,138570889}, {268380868,138570889,268426737,138669130}, 
+    {260332348,138570889,260286479,138669130}, {268426737,138669130,268470274,138768650}, {260286479,138669130,260242942,138768650}, 
+    {268470274,138768650,268511444,138869415}, {260242942,138768650,260201772,138869415}, {268511444,138869415,268550213,138971390}, 
+    {260201772,138869415,260163003,138971390}, {268550213,138971390,268586544,139074540}, {260163003,138971390,260126672,139074540}, 
+    {268586544,139074540,268620403,139178829}, {260126672,139074540,260092813,139178829}, {268620403,139178829,268651755,139284223}, 
+    {260092813,139178829,260061461,139284223}, {268651755,139284223,268680564,139390687}, {260061461,139284223,260032652,139390687}, 
+    {268680564,139390687,268706796,139498185}, {260032652,139390687,260006420,139498185}, {268706796,139498185,268730416,139606682}, 
+    {260006420,139498185,259982800,139606682}, {268730416,139606682,268751389,139716144}, {259982800,139606682,259961827,139716144}, 
+    {268751389,139716144,268769678,139826535}, {259961827,139716144,259943538,139826535}, {268769678,139826535,268785251,139937820}, 
+    {259943538,139826535,259927965,139937820}, {268785251,139937820,268798070,140049965}, {259927965,139937820,259915146,140049965}, 
+    {268798070,140049965,268808102,140162933}, {259915146,140049965,259905114,140162933}, {268808102,140162933,268815311,140276690}, 
+    {259905114,140162933,259897905,140276690}, {268815311,140276690,268819662,140391202}, {259897905,140276690,259893554,140391202}, 
+    {268819662,140391202,268821120,140506432}, {259893554,140391202,259892096,140506432}, {268821120,140506432,268819662,140621662}, 
+    {259892096,140506432,259893554,140621662}, {268819662,140621662,268815311,140736174}, {259893554,140621662,259897905,140736174}, 
+    {268815311,140736174,268808102,140849931}, {259897905,140736174,259905114,140849931}, {268808102,140849931,268798070,140962899}, 
+    {259905114,140849931,259915146,140962899}, {268798070,140962899,268785251,141075044}, {259915146,140962899,259927965,141075044}, 
+    {268785251,141075044,268769678,141186329}, {259927965,141075044,259943538,141186329}, {268769678,141186329,268751389,141296720}, 
+    {259943538,141186329,259961827,141296720}, {268751389,141296720,268730416,141406182}, {259961827,141296720,259982800,141406182}, 
+    {268730416,141406182,268706796,141514679}, {259982800,141406182,260006420,141514679}, {268706796,141514679,268680564,141622177}, 
+    {260006420,141514679,260032652,141622177}, {268680564,141622177,268651755,141728641}, {260032652,141622177,260061461,141728641}, 
+    {268651755,141728641,268620403,141834035}, {260061461,141728641,260092813,141834035}, {268620403,141834035,268586544,141938324}, 
+    {260092813,141834035,260126672,141938324}, {268586544,141938324,268550213,142041474}, {260126672,141938324,260163003,142041474}, 
+    {268550213,142041474,268511444,142143449}, {260163003,142041474,260201772,142143449}, {268511444,142143449,268470274,142244214}, 
+    {260201772,142143449,260242942,142244214}, {268470274,142244214,268426737,142343734}, {260242942,142244214,260286479,142343734}, 
+    {268426737,142343734,268380868,142441975}, {260286479,142343734,260332348,142441975}, {268380868,142441975,268332702,142538900}, 
+    {260332348,142441975,260380514,142538900}, {268332702,142538900,268282274,142634476}, {260380514,142538900,260430942,142634476}, 
+    {268282274,142634476,268229619,142728666}, {260430942,142634476,260483597,142728666}, {268229619,142728666,268174773,142821436}, 
+    {260483597,142728666,260538443,142821436}, {268174773,142821436,268117771,142912751}, {260538443,142821436,260595445,142912751}, 
+    {268117771,142912751,268058647,143002575}, {260595445,142912751,260654569,143002575}, {268058647,143002575,267997436,143090874}, 
+    {260654569,143002575,260715780,143090874}, {267997436,143090874,267934174,143177613}, {260715780,143090874,260779042,143177613}, 
+    {267934174,143177613,267868896,143262756}, {260779042,143177613,260844320,143262756}, {267868896,143262756,267801637,143346269}, 
+    {260844320,143262756,260911579,143346269}, {267801637,143346269,267732431,143428116}, {260911579,143346269,260980785,143428116}, 
+    {267732431,143428116,267661314,143508262}, {260980785,143428116,261051902,143508262}, {267661314,143508262,267588322,143586672}, 
+    {261051902,143508262,261124894,143586672}, {267588322,143586672,267513488,143663312}, {261124894,143586672,261199728,143663312}, 
+    {267513488,143663312,267436848,143738146}, {261199728,143663312,261276368,143738146}, {267436848,143738146,267358438,143811138}, 
+    {261276368,143738146,261354778,143811138}, {267358438,143811138,267278292,143882255}, {261354778,143811138,261434924,143882255}, 
+    {267278292,143882255,267196445,143951461}, {261434924,143882255,261516771,143951461}, {267196445,143951461,267112932,144018720}, 
+    {261516771,143951461,261600284,144018720}, {267112932,144018720,267027789,144083998}, {261600284,144018720,261685427,144083998}, 
+    {267027789,144083998,266941050,144147260}, {261685427,144083998,261772166,144147260}, {266941050,144147260,266852751,144208471}, 
+    {261772166,144147260,261860465,144208471}, {266852751,144208471,266762927,144267595}, {261860465,144208471,261950289,144267595}, 
+    {266762927,144267595,266671612,144324597}, {261950289,144267595,262041604,144324597}, {266671612,144324597,266578842,144379443}, 
+    {262041604,144324597,262134374,144379443}, {266578842,144379443,266484652,144432098}, {262134374,144379443,262228564,144432098}, 
+    {266484652,144432098,266389076,144482526}, {262228564,144432098,262324140,144482526}, {266389076,144482526,266292151,144530692}, 
+    {262324140,144482526,262421065,144530692}, {266292151,144530692,266193910,144576561}, {262421065,144530692,262519306,144576561}, 
+    {266193910,144576561,266094390,144620098}, {262519306,144576561,262618826,144620098}, {266094390,144620098,265993625,144661268}, 
+    {262618826,144620098,262719591,144661268}, {265993625,144661268,265891650,144700037}, {262719591,144661268,262821566,144700037}, 
+    {265891650,144700037,265788500,144736368}, {262821566,144700037,262924716,144736368}, {265788500,144736368,265684211,144770227}, 
+    {262924716,144736368,263029005,144770227}, {265684211,144770227,265578817,144801579}, {263029005,144770227,263134399,144801579}, 
+    {265578817,144801579,265472353,144830388}, {263134399,144801579,263240863,144830388}, {265472353,144830388,265364855,144856620}, 
+    {263240863,144830388,263348361,144856620}, {265364855,144856620,265256358,144880240}, {263348361,144856620,263456858,144880240}, 
+    {265256358,144880240,265146896,144901213}, {263456858,144880240,263566320,144901213}, {265146896,144901213,265036505,144919502}, 
+    {263566320,144901213,263676711,144919502}, {265036505,144919502,264925220,144935075}, {263676711,144919502,263787996,144935075}, 
+    {264925220,144935075,264813075,144947894}, {263787996,144935075,263900141,144947894}, {264813075,144947894,264700107,144957926}, 
+    {263900141,144947894,264013109,144957926}, {264700107,144957926,264586350,144965135}, {264013109,144957926,264126866,144965135}, 
+    {264586350,144965135,264471838,144969486}, {264126866,144965135,264241378,144969486}, {264471838,144969486,264356608,144970944}, 
+    {264241378,144969486,264356608,144970944}, 
+};
+
+const Segment SEGMENTS_OUTER7[] = {
+    {245965440,142784000,246080670,142785458}, {245965440,142784000,245850210,142785458}, {246080670,142785458,246195182,142789809}, 
+    {245850210,142785458,245735698,142789809}, {246195182,142789809,246308939,142797018}, {245735698,142789809,245621941,142797018}, 
+    {246308939,142797018,246421907,142807050}, {245621941,142797018,245508973,142807050}, {246421907,142807050,246534052,142819869}, 
+    {245508973,142807050,245396828,142819869}, {246534052,142819869,246645337,142835442}, {245396828,142819869,245285543,142835442}, 
+    {246645337,142835442,246755728,142853731}, {245285543,142835442,245175152,142853731}, {246755728,142853731,246865190,142874704}, 
+    {245175152,142853731,245065690,142874704}, {246865190,142874704,246973687,142898324}, {245065690,142874704,244957193,142898324}, 
+    {246973687,142898324,247081185,142924556}, {244957193,142898324,244849695,142924556}, {247081185,142924556,247187649,142953365}, 
+    {244849695,142924556,244743231,142953365}, {247187649,142953365,247293043,142984717}, {244743231,142953365,244637837,142984717}, 
+    {247293043,142984717,247397332,143018576}, {244637837,142984717,244533548,143018576}, {247397332,143018576,247500482,143054907}, 
+    {244533548,143018576,244430398,143054907}, {247500482,143054907,247602457,143093676}, {244430398,143054907,244328423,143093676}, 
+    {247602457,143093676,247703222,143134846}, {244328423,143093676,244227658,143134846}, {247703222,143134846,247802742,143178383}, 
+    {244227658,143134846,244128138,143178383}, {247802742,143178383,247900983,143224252}, {244128138,143178383,244029897,143224252}, 
+    {247900983,143224252,247997908,143272418}, {244029897,143224252,243932972,143272418}, {247997908,143272418,248093484,143322846}, 
+    {243932972,143272418,243837396,143322846}, {248093484,143322846,248187674,143375501}, {243837396,143322846,243743206,143375501}, 
+    {248187674,143375501,248280444,143430347}, {243743206,143375501,243650436,143430347}, {248280444,143430347,248371759,143487349}, 
+    {243650436,143430347,243559121,143487349}, {248371759,143487349,248461583,143546473}, {243559121,143487349,243469297,143546473}, 
+    {248461583,143546473,248549882,143607684}, {243469297,143546473,243380998,143607684}, {248549882,143607684,248636621,143670946}, 
+    {243380998,143607684,243294259,143670946}, {248636621,143670946,248721764,143736224}, {243294259,143670946,243209116,143736224}, 
+    {248721764,143736224,248805277,143803483}, {243209116,143736224,243125603,143803483}, {248805277,143803483,248887124,143872689}, 
+    {243125603,143803483,243043756,143872689}, {248887124,143872689,248967270,143943806}, {243043756,143872689,242963610,143943806}, 
+    {248967270,143943806,249045680,144016798}, {242963610,143943806,242885200,144016798}, {249045680,144016798,249122320,144091632}, 
+    {242885200,144016798,242808560,144091632}, {249122320,144091632,249197154,144168272}, {242808560,144091632,242733726,144168272}, 
+    {249197154,144168272,249270146,144246682}, {242733726,144168272,242660734,144246682}, {249270146,144246682,249341263,144326828}, 
+    {242660734,144246682,242589617,144326828}, {249341263,144326828,249410469,144408675}, {242589617,144326828,242520411,144408675}, 
+    {249410469,144408675,249477728,144492188}, {242520411,144408675,242453152,144492188}, {249477728,144492188,249543006,144577331}, 
+    {242453152,144492188,242387874,144577331}, {249543006,144577331,249606268,144664070}, {242387874,144577331,242324612,144664070}, 
+    {249606268,144664070,249667479,144752369}, {242324612,144664070,242263401,144752369}, {249667479,144752369,249726603,144842193}, 
+    {242263401,144752369,242204277,144842193}, {249726603,144842193,249783605,144933508}, {242204277,144842193,242147275,144933508}, 
+    {249783605,144933508,249838451,145026278}, {242147275,144933508,242092429,145026278}, {249838451,145026278,249891106,145120468}, 
+    {242092429,145026278,242039774,145120468}, {249891106,145120468,249941534,145216044}, {242039774,145120468,241989346,145216044}, 
+    {249941534,145216044,249989700,145312969}, {241989346,145216044,241941180,145312969}, {249989700,145312969,250035569,145411210}, 
+    {241941180,145312969,241895311,145411210}, {250035569,145411210,250079106,145510730}, {241895311,145411210,241851774,145510730}, 
+    {250079106,145510730,250120276,145611495}, {241851774,145510730,241810604,145611495}, {250120276,145611495,250159045,145713470}, 
+    {241810604,145611495,241771835,145713470}, {250159045,145713470,250195376,145816620}, {241771835,145713470,241735504,145816620}, 
+    {250195376,145816620,250229235,145920909}, {241735504,145816620,241701645,145920909}, {250229235,145920909,250260587,146026303}, 
+    {241701645,145920909,241670293,146026303}, {250260587,146026303,250289396,146132767}, {241670293,146026303,241641484,146132767}, 
+    {250289396,146132767,250315628,146240265}, {241641484,146132767,241615252,146240265}, {250315628,146240265,250339248,146348762}, 
+    {241615252,146240265,241591632,146348762}, {250339248,146348762,250360221,146458224}, {241591632,146348762,241570659,146458224}, 
+    {250360221,146458224,250378510,146568615}, {241570659,146458224,241552370,146568615}, {250378510,146568615,250394083,146679900}, 
+    {241552370,146568615,241536797,146679900}, {250394083,146679900,250406902,146792045}, {241536797,146679900,241523978,146792045}, 
+    {250406902,146792045,250416934,146905013}, {241523978,146792045,241513946,146905013}, {250416934,146905013,250424143,147018770}, 
+    {241513946,146905013,241506737,147018770}, {250424143,147018770,250428494,147133282}, {241506737,147018770,241502386,147133282}, 
+    {250428494,147133282,250429952,147248512}, {241502386,147133282,241500928,147248512}, {250429952,147248512,250428494,147363742}, 
+    {241500928,147248512,241502386,147363742}, {250428494,147363742,250424143,147478254}, {241502386,147363742,241506737,147478254}, 
+    {250424143,147478254,250416934,147592011}, {241506737,147478254,241513946,147592011}, {250416934,147592011,250406902,147704979}, 
+    {241513946,147592011,241523978,147704979}, {250406902,147704979,250394083,147817124}, {241523978,147704979,241536797,147817124}, 
+    {250394083,147817124,250378510,147928409}, {241536797,147817124,241552370,147928409}, {250378510,147928409,250360221,148038800}, 
+    {241552370,147928409,241570659,148038800}, {250360221,148038800,250339248,148148262}, {241570659,148038800,241591632,148148262}, 
+    {250339248,148148262,250315628,148256759}, {241591632,148148262,241615252,148256759}, {250315628,148256759,250289396,148364257}, 
+    {241615252,148256759,241641484,148364257}, {250289396,148364257,250260587,148470721}, {241641484,148364257,241670293,148470721}, 
+    {250260587,148470721,250229235,148576115}, {241670293,148470721,241701645,148576115}, {250229235,148576115,250195376,148680404}, 
+    {241701645,148576115,241735504,148680404}, {250195376,148680404,250159045,148783554}, {241735504,148680404,241771835,148783554}, 
+    {250159045,148783554,250120276,148885529}, {241771835,148783554,241810604,148885529}, {250120276,148885529,250079106,148986294}, 
+    {241810604,148885529,241851774,148986294}, {250079106,148986294,250035569,149085814}, {241851774,148986294,241895311,149085814}, 
+    {250035569,149085814,249989700,149184055}, {241895311,149085814,241941180,149184055}, {249989700,149184055,249941534,149280980}, 
+    {241941180,149184055,241989346,149280980}, {249941534,149280980,249891106,149376556}, {241989346,149280980,242039774,149376556}, 
+    {249891106,149376556,249838451,149470746}, {242039774,149376556,242092429,149470746}, {249838451,149470746,249783605,149563516}, 
+    {242092429,149470746,242147275,149563516}, {249783605,149563516,249726603,149654831}, {242147275,149563516,242204277,149654831}, 
+    {249726603,149654831,249667479,149744655}, {242204277,149654831,242263401,149744655}, {249667479,149744655,249606268,149832954}, 
+    {242263401,149744655,242324612,149832954}, {249606268,149832954,249543006,149919693}, {242324612,149832954,242387874,149919693}, 
+    {249543006,149919693,249477728,150004836}, {242387874,149919693,242453152,150004836}, {249477728,150004836,249410469,150088349}, 
+    {242453152,150004836,242520411,150088349}, {249410469,150088349,249341263,150170196}, {242520411,150088349,242589617,150170196}, 
+    {249341263,150170196,249270146,150250342}, {242589617,150170196,242660734,150250342}, {249270146,150250342,249197154,150328752}, 
+    {242660734,150250342,242733726,150328752}, {249197154,150328752,249122320,150405392}, {242733726,150328752,242808560,150405392}, 
+    {249122320,150405392,249045680,150480226}, {242808560,150405392,242885200,150480226}, {249045680,150480226,248967270,150553218}, 
+    {242885200,150480226,242963610,150553218}, {248967270,150553218,248887124,150624335}, {242963610,150553218,243043756,150624335}, 
+    {248887124,150624335,248805277,150693541}, {243043756,150624335,243125603,150693541}, {248805277,150693541,248721764,150760800}, 
+    {243125603,150693541,243209116,150760800}, {248721764,150760800,248636621,150826078}, {243209116,150760800,243294259,150826078}, 
+    {248636621,150826078,248549882,150889340}, {243294259,150826078,243380998,150889340}, {248549882,150889340,248461583,150950551}, 
+    {243380998,150889340,243469297,150950551}, {248461583,150950551,248371759,151009675}, {243469297,150950551,243559121,151009675}, 
+    {248371759,151009675,248280444,151066677}, {243559121,151009675,243650436,151066677}, {248280444,151066677,248187674,151121523}, 
+    {243650436,151066677,243743206,151121523}, {248187674,151121523,248093484,151174178}, {243743206,151121523,243837396,151174178}, 
+    {248093484,151174178,247997908,151224606}, {243837396,151174178,243932972,151224606}, {247997908,151224606,247900983,151272772}, 
+    {243932972,151224606,244029897,151272772}, {247900983,151272772,247802742,151318641}, {244029897,151272772,244128138,151318641}, 
+    {247802742,151318641,247703222,151362178}, {244128138,151318641,244227658,151362178}, {247703222,151362178,247602457,151403348}, 
+    {244227658,151362178,244328423,151403348}, {247602457,151403348,247500482,151442117}, {244328423,151403348,244430398,151442117}, 
+    {247500482,151442117,247397332,151478448}, {244430398,151442117,244533548,151478448}, {247397332,151478448,247293043,151512307}, 
+    {244533548,151478448,244637837,151512307}, {247293043,151512307,247187649,151543659}, {244637837,151512307,244743231,151543659}, 
+    {247187649,151543659,247081185,151572468}, {244743231,151543659,244849695,151572468}, {247081185,151572468,246973687,151598700}, 
+    {244849695,151572468,244957193,151598700}, {246973687,151598700,246865190,151622320}, {244957193,151598700,245065690,151622320}, 
+    {246865190,151622320,246755728,151643293}, {245065690,151622320,245175152,151643293}, {246755728,151643293,246645337,151661582}, 
+    {245175152,151643293,245285543,151661582}, {246645337,151661582,246534052,151677155}, {245285543,151661582,245396828,151677155}, 
+    {246534052,151677155,246421907,151689974}, {245396828,151677155,245508973,151689974}, {246421907,151689974,246308939,151700006}, 
+    {245508973,151689974,245621941,151700006}, {246308939,151700006,246195182,151707215}, {245621941,151700006,245735698,151707215}, 
+    {246195182,151707215,246080670,151711566}, {245735698,151707215,245850210,151711566}, {246080670,151711566,245965440,151713024}, 
+    {245850210,151711566,245965440,151713024}, 
+};
+
+const Segment SEGMENTS_OUTER8[] = {
+    {232089984,154334592,232205214,154336050}, {232089984,154334592,231974754,154336050}, {232205214,154336050,232319726,154340401}, 
+    {231974754,154336050,231860242,154340401}, {232319726,154340401,232433483,154347610}, {231860242,154340401,231746485,154347610}, 
+    {232433483,154347610,232546451,154357642}, {231746485,154347610,231633517,154357642}, {232546451,154357642,232658596,154370461}, 
+    {231633517,154357642,231521372,154370461}, {232658596,154370461,232769881,154386034}, {231521372,154370461,231410087,154386034}, 
+    {232769881,154386034,232880272,154404323}, {231410087,154386034,231299696,154404323}, {232880272,154404323,232989734,154425296}, 
+    {231299696,154404323,231190234,154425296}, {232989734,154425296,233098231,154448916}, {231190234,154425296,231081737,154448916}, 
+    {233098231,154448916,233205729,154475148}, {231081737,154448916,230974239,154475148}, {233205729,154475148,233312193,154503957}, 
+    {230974239,154475148,230867775,154503957}, {233312193,154503957,233417587,154535309}, {230867775,154503957,230762381,154535309}, 
+    {233417587,154535309,233521876,154569168}, {230762381,154535309,230658092,154569168}, {233521876,154569168,233625026,154605499}, 
+    {230658092,154569168,230554942,154605499}, {233625026,154605499,233727001,154644268}, {230554942,154605499,230452967,154644268}, 
+    {233727001,154644268,233827766,154685438}, {230452967,154644268,230352202,154685438}, {233827766,154685438,233927286,154728975}, 
+    {230352202,154685438,230252682,154728975}, {233927286,154728975,234025527,154774844}, {230252682,154728975,230154441,154774844}, 
+    {234025527,154774844,234122452,154823010}, {230154441,154774844,230057516,154823010}, {234122452,154823010,234218028,154873438}, 
+    {230057516,154823010,229961940,154873438}, {234218028,154873438,234312218,154926093}, {229961940,154873438,229867750,154926093}, 
+    {234312218,154926093,234404988,154980939}, {229867750,154926093,229774980,154980939}, {234404988,154980939,234496303,155037941}, 
+    {229774980,154980939,229683665,155037941}, {234496303,155037941,234586127,155097065}, {229683665,155037941,229593841,155097065}, 
+    {234586127,155097065,234674426,155158276}, {229593841,155097065,229505542,155158276}, {234674426,155158276,234761165,155221538}, 
+    {229505542,155158276,229418803,155221538}, {234761165,155221538,234846308,155286816}, {229418803,155221538,229333660,155286816}, 
+    {234846308,155286816,234929821,155354075}, {229333660,155286816,229250147,155354075}, {234929821,155354075,235011668,155423281}, 
+    {229250147,155354075,229168300,155423281}, {235011668,155423281,235091814,155494398}, {229168300,155423281,229088154,155494398}, 
+    {235091814,155494398,235170224,155567390}, {229088154,155494398,229009744,155567390}, {235170224,155567390,235246864,155642224}, 
+    {229009744,155567390,228933104,155642224}, {235246864,155642224,235321698,155718864}, {228933104,155642224,228858270,155718864}, 
+    {235321698,155718864,235394690,155797274}, {228858270,155718864,228785278,155797274}, {235394690,155797274,235465807,155877420}, 
+    {228785278,155797274,228714161,155877420}, {235465807,155877420,235535013,155959267}, {228714161,155877420,228644955,155959267}, 
+    {235535013,155959267,235602272,156042780}, {228644955,155959267,228577696,156042780}, {235602272,156042780,235667550,156127923}, 
+    {228577696,156042780,228512418,156127923}, {235667550,156127923,235730812,156214662}, {228512418,156127923,228449156,156214662}, 
+    {235730812,156214662,235792023,156302961}, {228449156,156214662,228387945,156302961}, {235792023,156302961,235851147,156392785}, 
+    {228387945,156302961,228328821,156392785}, {235851147,156392785,235908149,156484100}, {228328821,156392785,228271819,156484100}, 
+    {235908149,156484100,235962995,156576870}, {228271819,156484100,228216973,156576870}, {235962995,156576870,236015650,156671060}, 
+    {228216973,156576870,228164318,156671060}, {236015650,156671060,236066078,156766636}, {228164318,156671060,228113890,156766636}, 
+    {236066078,156766636,236114244,156863561}, {228113890,156766636,228065724,156863561}, {236114244,156863561,236160113,156961802}, 
+    {228065724,156863561,228019855,156961802}, {236160113,156961802,236203650,157061322}, {228019855,156961802,227976318,157061322}, 
+    {236203650,157061322,236244820,157162087}, {227976318,157061322,227935148,157162087}, {236244820,157162087,236283589,157264062}, 
+    {227935148,157162087,227896379,157264062}, {236283589,157264062,236319920,157367212}, {227896379,157264062,227860048,157367212}, 
+    {236319920,157367212,236353779,157471501}, {227860048,157367212,227826189,157471501}, {236353779,157471501,236385131,157576895}, 
+    {227826189,157471501,227794837,157576895}, {236385131,157576895,236413940,157683359}, {227794837,157576895,227766028,157683359}, 
+    {236413940,157683359,236440172,157790857}, {227766028,157683359,227739796,157790857}, {236440172,157790857,236463792,157899354}, 
+    {227739796,157790857,227716176,157899354}, {236463792,157899354,236484765,158008816}, {227716176,157899354,227695203,158008816}, 
+    {236484765,158008816,236503054,158119207}, {227695203,158008816,227676914,158119207}, {236503054,158119207,236518627,158230492}, 
+    {227676914,158119207,227661341,158230492}, {236518627,158230492,236531446,158342637}, {227661341,158230492,227648522,158342637}, 
+    {236531446,158342637,236541478,158455605}, {227648522,158342637,227638490,158455605}, {236541478,158455605,236548687,158569362}, 
+    {227638490,158455605,227631281,158569362}, {236548687,158569362,236553038,158683874}, {227631281,158569362,227626930,158683874}, 
+    {236553038,158683874,236554496,158799104}, {227626930,158683874,227625472,158799104}, {236554496,158799104,236553038,158914334}, 
+    {227625472,158799104,227626930,158914334}, {236553038,158914334,236548687,159028846}, {227626930,158914334,227631281,159028846}, 
+    {236548687,159028846,236541478,159142603}, {227631281,159028846,227638490,159142603}, {236541478,159142603,236531446,159255571}, 
+    {227638490,159142603,227648522,159255571}, {236531446,159255571,236518627,159367716}, {227648522,159255571,227661341,159367716}, 
+    {236518627,159367716,236503054,159479001}, {227661341,159367716,227676914,159479001}, {236503054,159479001,236484765,159589392}, 
+    {227676914,159479001,227695203,159589392}, {236484765,159589392,236463792,159698854}, {227695203,159589392,227716176,159698854}, 
+    {236463792,159698854,236440172,159807351}, {227716176,159698854,227739796,159807351}, {236440172,159807351,236413940,159914849}, 
+    {227739796,159807351,227766028,159914849}, {236413940,159914849,236385131,160021313}, {227766028,159914849,227794837,160021313}, 
+    {236385131,160021313,236353779,160126707}, {227794837,160021313,227826189,160126707}, {236353779,160126707,236319920,160230996}, 
+    {227826189,160126707,227860048,160230996}, {236319920,160230996,236283589,160334146}, {227860048,160230996,227896379,160334146}, 
+    {236283589,160334146,236244820,160436121}, {227896379,160334146,227935148,160436121}, {236244820,160436121,236203650,160536886}, 
+    {227935148,160436121,227976318,160536886}, {236203650,160536886,236160113,160636406}, {227976318,160536886,228019855,160636406}, 
+    {236160113,160636406,236114244,160734647}, {228019855,160636406,228065724,160734647}, {236114244,160734647,236066078,160831572}, 
+    {228065724,160734647,228113890,160831572}, {236066078,160831572,236015650,160927148}, {228113890,160831572,228164318,160927148}, 
+    {236015650,160927148,235962995,161021338}, {228164318,160927148,228216973,161021338}, {235962995,161021338,235908149,161114108}, 
+    {228216973,161021338,228271819,161114108}, {235908149,161114108,235851147,161205423}, {228271819,161114108,228328821,161205423}, 
+    {235851147,161205423,235792023,161295247}, {228328821,161205423,228387945,161295247}, {235792023,161295247,235730812,161383546}, 
+    {228387945,161295247,228449156,161383546}, {235730812,161383546,235667550,161470285}, {228449156,161383546,228512418,161470285}, 
+    {235667550,161470285,235602272,161555428}, {228512418,161470285,228577696,161555428}, {235602272,161555428,235535013,161638941}, 
+    {228577696,161555428,228644955,161638941}, {235535013,161638941,235465807,161720788}, {228644955,161638941,228714161,161720788}, 
+    {235465807,161720788,235394690,161800934}, {228714161,161720788,228785278,161800934}, {235394690,161800934,235321698,161879344}, 
+    {228785278,161800934,228858270,161879344}, {235321698,161879344,235246864,161955984}, {228858270,161879344,228933104,161955984}, 
+    {235246864,161955984,235170224,162030818}, {228933104,161955984,229009744,162030818}, {235170224,162030818,235091814,162103810}, 
+    {229009744,162030818,229088154,162103810}, {235091814,162103810,235011668,162174927}, {229088154,162103810,229168300,162174927}, 
+    {235011668,162174927,234929821,162244133}, {229168300,162174927,229250147,162244133}, {234929821,162244133,234846308,162311392}, 
+    {229250147,162244133,229333660,162311392}, {234846308,162311392,234761165,162376670}, {229333660,162311392,229418803,162376670}, 
+    {234761165,162376670,234674426,162439932}, {229418803,162376670,229505542,162439932}, {234674426,162439932,234586127,162501143}, 
+    {229505542,162439932,229593841,162501143}, {234586127,162501143,234496303,162560267}, {229593841,162501143,229683665,162560267}, 
+    {234496303,162560267,234404988,162617269}, {229683665,162560267,229774980,162617269}, {234404988,162617269,234312218,162672115}, 
+    {229774980,162617269,229867750,162672115}, {234312218,162672115,234218028,162724770}, {229867750,162672115,229961940,162724770}, 
+    {234218028,162724770,234122452,162775198}, {229961940,162724770,230057516,162775198}, {234122452,162775198,234025527,162823364}, 
+    {230057516,162775198,230154441,162823364}, {234025527,162823364,233927286,162869233}, {230154441,162823364,230252682,162869233}, 
+    {233927286,162869233,233827766,162912770}, {230252682,162869233,230352202,162912770}, {233827766,162912770,233727001,162953940}, 
+    {230352202,162912770,230452967,162953940}, {233727001,162953940,233625026,162992709}, {230452967,162953940,230554942,162992709}, 
+    {233625026,162992709,233521876,163029040}, {230554942,162992709,230658092,163029040}, {233521876,163029040,233417587,163062899}, 
+    {230658092,163029040,230762381,163062899}, {233417587,163062899,233312193,163094251}, {230762381,163062899,230867775,163094251}, 
+    {233312193,163094251,233205729,163123060}, {230867775,163094251,230974239,163123060}, {233205729,163123060,233098231,163149292}, 
+    {230974239,163123060,231081737,163149292}, {233098231,163149292,232989734,163172912}, {231081737,163149292,231190234,163172912}, 
+    {232989734,163172912,232880272,163193885}, {231190234,163172912,231299696,163193885}, {232880272,163193885,232769881,163212174}, 
+    {231299696,163193885,231410087,163212174}, {232769881,163212174,232658596,163227747}, {231410087,163212174,231521372,163227747}, 
+    {232658596,163227747,232546451,163240566}, {231521372,163227747,231633517,163240566}, {232546451,163240566,232433483,163250598}, 
+    {231633517,163240566,231746485,163250598}, {232433483,163250598,232319726,163257807}, {231746485,163250598,231860242,163257807}, 
+    {232319726,163257807,232205214,163262158}, {231860242,163257807,231974754,163262158}, {232205214,163262158,232089984,163263616}, 
+    {231974754,163262158,232089984,163263616}, 
+};
+
+const Segment SEGMENTS_OUTER9[] = {
+    {222333888,171137728,222449118,171139186}, {222333888,171137728,222218658,171139186}, {222449118,171139186,222563630,171143537}, 
+    {222218658,171139186,222104146,171143537}, {222563630,171143537,222677387,171150746}, {222104146,171143537,221990389,171150746}, 
+    {222677387,171150746,222790355,171160778}, {221990389,171150746,221877421,171160778}, {222790355,171160778,222902500,171173597}, 
+    {221877421,171160778,221765276,171173597}, {222902500,171173597,223013785,171189170}, {221765276,171173597,221653991,171189170}, 
+    {223013785,171189170,223124176,171207459}, {221653991,171189170,221543600,171207459}, {223124176,171207459,223233638,171228432}, 
+    {221543600,171207459,221434138,171228432}, {223233638,171228432,223342135,171252052}, {221434138,171228432,221325641,171252052}, 
+    {223342135,171252052,223449633,171278284}, {221325641,171252052,221218143,171278284}, {223449633,171278284,223556097,171307093}, 
+    {221218143,171278284,221111679,171307093}, {223556097,171307093,223661491,171338445}, {221111679,171307093,221006285,171338445}, 
+    {223661491,171338445,223765780,171372304}, {221006285,171338445,220901996,171372304}, {223765780,171372304,223868930,171408635}, 
+    {220901996,171372304,220798846,171408635}, {223868930,171408635,223970905,171447404}, {220798846,171408635,220696871,171447404}, 
+    {223970905,171447404,224071670,171488574}, {220696871,171447404,220596106,171488574}, {224071670,171488574,224171190,171532111}, 
+    {220596106,171488574,220496586,171532111}, {224171190,171532111,224269431,171577980}, {220496586,171532111,220398345,171577980}, 
+    {224269431,171577980,224366356,171626146}, {220398345,171577980,220301420,171626146}, {224366356,171626146,224461932,171676574}, 
+    {220301420,171626146,220205844,171676574}, {224461932,171676574,224556122,171729229}, {220205844,171676574,220111654,171729229}, 
+    {224556122,171729229,224648892,171784075}, {220111654,171729229,220018884,171784075}, {224648892,171784075,224740207,171841077}, 
+    {220018884,171784075,219927569,171841077}, {224740207,171841077,224830031,171900201}, {219927569,171841077,219837745,171900201}, 
+    {224830031,171900201,224918330,171961412}, {219837745,171900201,219749446,171961412}, {224918330,171961412,225005069,172024674}, 
+    {219749446,171961412,219662707,172024674}, {225005069,172024674,225090212,172089952}, {219662707,172024674,219577564,172089952}, 
+    {225090212,172089952,225173725,172157211}, {219577564,172089952,219494051,172157211}, {225173725,172157211,225255572,172226417}, 
+    {219494051,172157211,219412204,172226417}, {225255572,172226417,225335718,172297534}, {219412204,172226417,219332058,172297534}, 
+    {225335718,172297534,225414128,172370526}, {219332058,172297534,219253648,172370526}, {225414128,172370526,225490768,172445360}, 
+    {219253648,172370526,219177008,172445360}, {225490768,172445360,225565602,172522000}, {219177008,172445360,219102174,172522000}, 
+    {225565602,172522000,225638594,172600410}, {219102174,172522000,219029182,172600410}, {225638594,172600410,225709711,172680556}, 
+    {219029182,172600410,218958065,172680556}, {225709711,172680556,225778917,172762403}, {218958065,172680556,218888859,172762403}, 
+    {225778917,172762403,225846176,172845916}, {218888859,172762403,218821600,172845916}, {225846176,172845916,225911454,172931059}, 
+    {218821600,172845916,218756322,172931059}, {225911454,172931059,225974716,173017798}, {218756322,172931059,218693060,173017798}, 
+    {225974716,173017798,226035927,173106097}, {218693060,173017798,218631849,173106097}, {226035927,173106097,226095051,173195921}, 
+    {218631849,173106097,218572725,173195921}, {226095051,173195921,226152053,173287236}, {218572725,173195921,218515723,173287236}, 
+    {226152053,173287236,226206899,173380006}, {218515723,173287236,218460877,173380006}, {226206899,173380006,226259554,173474196}, 
+    {218460877,173380006,218408222,173474196}, {226259554,173474196,226309982,173569772}, {218408222,173474196,218357794,173569772}, 
+    {226309982,173569772,226358148,173666697}, {218357794,173569772,218309628,173666697}, {226358148,173666697,226404017,173764938}, 
+    {218309628,173666697,218263759,173764938}, {226404017,173764938,226447554,173864458}, {218263759,173764938,218220222,173864458}, 
+    {226447554,173864458,226488724,173965223}, {218220222,173864458,218179052,173965223}, {226488724,173965223,226527493,174067198}, 
+    {218179052,173965223,218140283,174067198}, {226527493,174067198,226563824,174170348}, {218140283,174067198,218103952,174170348}, 
+    {226563824,174170348,226597683,174274637}, {218103952,174170348,218070093,174274637}, {226597683,174274637,226629035,174380031}, 
+    {218070093,174274637,218038741,174380031}, {226629035,174380031,226657844,174486495}, {218038741,174380031,218009932,174486495}, 
+    {226657844,174486495,226684076,174593993}, {218009932,174486495,217983700,174593993}, {226684076,174593993,226707696,174702490}, 
+    {217983700,174593993,217960080,174702490}, {226707696,174702490,226728669,174811952}, {217960080,174702490,217939107,174811952}, 
+    {226728669,174811952,226746958,174922343}, {217939107,174811952,217920818,174922343}, {226746958,174922343,226762531,175033628}, 
+    {217920818,174922343,217905245,175033628}, {226762531,175033628,226775350,175145773}, {217905245,175033628,217892426,175145773}, 
+    {226775350,175145773,226785382,175258741}, {217892426,175145773,217882394,175258741}, {226785382,175258741,226792591,175372498}, 
+    {217882394,175258741,217875185,175372498}, {226792591,175372498,226796942,175487010}, {217875185,175372498,217870834,175487010}, 
+    {226796942,175487010,226798400,175602240}, {217870834,175487010,217869376,175602240}, {226798400,175602240,226796942,175717470}, 
+    {217869376,175602240,217870834,175717470}, {226796942,175717470,226792591,175831982}, {217870834,175717470,217875185,175831982}, 
+    {226792591,175831982,226785382,175945739}, {217875185,175831982,217882394,175945739}, {226785382,175945739,226775350,176058707}, 
+    {217882394,175945739,217892426,176058707}, {226775350,176058707,226762531,176170852}, {217892426,176058707,217905245,176170852}, 
+    {226762531,176170852,226746958,176282137}, {217905245,176170852,217920818,176282137}, {226746958,176282137,226728669,176392528}, 
+    {217920818,176282137,217939107,176392528}, {226728669,176392528,226707696,176501990}, {217939107,176392528,217960080,176501990}, 
+    {226707696,176501990,226684076,176610487}, {217960080,176501990,217983700,176610487}, {226684076,176610487,226657844,176717985}, 
+    {217983700,176610487,218009932,176717985}, {226657844,176717985,226629035,176824449}, {218009932,176717985,218038741,176824449}, 
+    {226629035,176824449,226597683,176929843}, {218038741,176824449,218070093,176929843}, {226597683,176929843,226563824,177034132}, 
+    {218070093,176929843,218103952,177034132}, {226563824,177034132,226527493,177137282}, {218103952,177034132,218140283,177137282}, 
+    {226527493,177137282,226488724,177239257}, {218140283,177137282,218179052,177239257}, {226488724,177239257,226447554,177340022}, 
+    {218179052,177239257,218220222,177340022}, {226447554,177340022,226404017,177439542}, {218220222,177340022,218263759,177439542}, 
+    {226404017,177439542,226358148,177537783}, {218263759,177439542,218309628,177537783}, {226358148,177537783,226309982,177634708}, 
+    {218309628,177537783,218357794,177634708}, {226309982,177634708,226259554,177730284}, {218357794,177634708,218408222,177730284}, 
+    {226259554,177730284,226206899,177824474}, {218408222,177730284,218460877,177824474}, {226206899,177824474,226152053,177917244}, 
+    {218460877,177824474,218515723,177917244}, {226152053,177917244,226095051,178008559}, {218515723,177917244,218572725,178008559}, 
+    {226095051,178008559,226035927,178098383}, {218572725,178008559,218631849,178098383}, {226035927,178098383,225974716,178186682}, 
+    {218631849,178098383,218693060,178186682}, {225974716,178186682,225911454,178273421}, {218693060,178186682,218756322,178273421}, 
+    {225911454,178273421,225846176,178358564}, {218756322,178273421,218821600,178358564}, {225846176,178358564,225778917,178442077}, 
+    {218821600,178358564,218888859,178442077}, {225778917,178442077,225709711,178523924}, {218888859,178442077,218958065,178523924}, 
+    {225709711,178523924,225638594,178604070}, {218958065,178523924,219029182,178604070}, {225638594,178604070,225565602,178682480}, 
+    {219029182,178604070,219102174,178682480}, {225565602,178682480,225490768,178759120}, {219102174,178682480,219177008,178759120}, 
+    {225490768,178759120,225414128,178833954}, {219177008,178759120,219253648,178833954}, {225414128,178833954,225335718,178906946}, 
+    {219253648,178833954,219332058,178906946}, {225335718,178906946,225255572,178978063}, {219332058,178906946,219412204,178978063}, 
+    {225255572,178978063,225173725,179047269}, {219412204,178978063,219494051,179047269}, {225173725,179047269,225090212,179114528}, 
+    {219494051,179047269,219577564,179114528}, {225090212,179114528,225005069,179179806}, {219577564,179114528,219662707,179179806}, 
+    {225005069,179179806,224918330,179243068}, {219662707,179179806,219749446,179243068}, {224918330,179243068,224830031,179304279}, 
+    {219749446,179243068,219837745,179304279}, {224830031,179304279,224740207,179363403}, {219837745,179304279,219927569,179363403}, 
+    {224740207,179363403,224648892,179420405}, {219927569,179363403,220018884,179420405}, {224648892,179420405,224556122,179475251}, 
+    {220018884,179420405,220111654,179475251}, {224556122,179475251,224461932,179527906}, {220111654,179475251,220205844,179527906}, 
+    {224461932,179527906,224366356,179578334}, {220205844,179527906,220301420,179578334}, {224366356,179578334,224269431,179626500}, 
+    {220301420,179578334,220398345,179626500}, {224269431,179626500,224171190,179672369}, {220398345,179626500,220496586,179672369}, 
+    {224171190,179672369,224071670,179715906}, {220496586,179672369,220596106,179715906}, {224071670,179715906,223970905,179757076}, 
+    {220596106,179715906,220696871,179757076}, {223970905,179757076,223868930,179795845}, {220696871,179757076,220798846,179795845}, 
+    {223868930,179795845,223765780,179832176}, {220798846,179795845,220901996,179832176}, {223765780,179832176,223661491,179866035}, 
+    {220901996,179832176,221006285,179866035}, {223661491,179866035,223556097,179897387}, {221006285,179866035,221111679,179897387}, 
+    {223556097,179897387,223449633,179926196}, {221111679,179897387,221218143,179926196}, {223449633,179926196,223342135,179952428}, 
+    {221218143,179926196,221325641,179952428}, {223342135,179952428,223233638,179976048}, {221325641,179952428,221434138,179976048}, 
+    {223233638,179976048,223124176,179997021}, {221434138,179976048,221543600,179997021}, {223124176,179997021,223013785,180015310}, 
+    {221543600,179997021,221653991,180015310}, {223013785,180015310,222902500,180030883}, {221653991,180015310,221765276,180030883}, 
+    {222902500,180030883,222790355,180043702}, {221765276,180030883,221877421,180043702}, {222790355,180043702,222677387,180053734}, 
+    {221877421,180043702,221990389,180053734}, {222677387,180053734,222563630,180060943}, {221990389,180053734,222104146,180060943}, 
+    {222563630,180060943,222449118,180065294}, {222104146,180060943,222218658,180065294}, {222449118,180065294,222333888,180066752}, 
+    {222218658,180065294,222333888,180066752}, 
+};
+
+const Segment SEGMENTS_OUTERA[] = {
+    {218618688,189369216,218733918,189370674}, {218618688,189369216,218503458,189370674}, {218733918,189370674,218848430,189375025}, 
+    {218503458,189370674,218388946,189375025}, {218848430,189375025,218962187,189382234}, {218388946,189375025,218275189,189382234}, 
+    {218962187,189382234,219075155,189392266}, {218275189,189382234,218162221,189392266}, {219075155,189392266,219187300,189405085}, 
+    {218162221,189392266,218050076,189405085}, {219187300,189405085,219298585,189420658}, {218050076,189405085,217938791,189420658}, 
+    {219298585,189420658,219408976,189438947}, {217938791,189420658,217828400,189438947}, {219408976,189438947,219518438,189459920}, 
+    {217828400,189438947,217718938,189459920}, {219518438,189459920,219626935,189483540}, {217718938,189459920,217610441,189483540}, 
+    {219626935,189483540,219734433,189509772}, {217610441,189483540,217502943,189509772}, {219734433,189509772,219840897,189538581}, 
+    {217502943,189509772,217396479,189538581}, {219840897,189538581,219946291,189569933}, {217396479,189538581,217291085,189569933}, 
+    {219946291,189569933,220050580,189603792}, {217291085,189569933,217186796,189603792}, {220050580,189603792,220153730,189640123}, 
+    {217186796,189603792,217083646,189640123}, {220153730,189640123,220255705,189678892}, {217083646,189640123,216981671,189678892}, 
+    {220255705,189678892,220356470,189720062}, {216981671,189678892,216880906,189720062}, {220356470,189720062,220455990,189763599}, 
+    {216880906,189720062,216781386,189763599}, {220455990,189763599,220554231,189809468}, {216781386,189763599,216683145,189809468}, 
+    {220554231,189809468,220651156,189857634}, {216683145,189809468,216586220,189857634}, {220651156,189857634,220746732,189908062}, 
+    {216586220,189857634,216490644,189908062}, {220746732,189908062,220840922,189960717}, {216490644,189908062,216396454,189960717}, 
+    {220840922,189960717,220933692,190015563}, {216396454,189960717,216303684,190015563}, {220933692,190015563,221025007,190072565}, 
+    {216303684,190015563,216212369,190072565}, {221025007,190072565,221114831,190131689}, {216212369,190072565,216122545,190131689}, 
+    {221114831,190131689,221203130,190192900}, {216122545,190131689,216034246,190192900}, {221203130,190192900,221289869,190256162}, 
+    {216034246,190192900,215947507,190256162}, {221289869,190256162,221375012,190321440}, {215947507,190256162,215862364,190321440}, 
+    {221375012,190321440,221458525,190388699}, {215862364,190321440,215778851,190388699}, {221458525,190388699,221540372,190457905}, 
+    {215778851,190388699,215697004,190457905}, {221540372,190457905,221620518,190529022}, {215697004,190457905,215616858,190529022}, 
+    {221620518,190529022,221698928,190602014}, {215616858,190529022,215538448,190602014}, {221698928,190602014,221775568,190676848}, 
+    {215538448,190602014,215461808,190676848}, {221775568,190676848,221850402,190753488}, {215461808,190676848,215386974,190753488}, 
+    {221850402,190753488,221923394,190831898}, {215386974,190753488,215313982,190831898}, {221923394,190831898,221994511,190912044}, 
+    {215313982,190831898,215242865,190912044}, {221994511,190912044,222063717,190993891}, {215242865,190912044,215173659,190993891}, 
+    {222063717,190993891,222130976,191077404}, {215173659,190993891,215106400,191077404}, {222130976,191077404,222196254,191162547}, 
+    {215106400,191077404,215041122,191162547}, {222196254,191162547,222259516,191249286}, {215041122,191162547,214977860,191249286}, 
+    {222259516,191249286,222320727,191337585}, {214977860,191249286,214916649,191337585}, {222320727,191337585,222379851,191427409}, 
+    {214916649,191337585,214857525,191427409}, {222379851,191427409,222436853,191518724}, {214857525,191427409,214800523,191518724}, 
+    {222436853,191518724,222491699,191611494}, {214800523,191518724,214745677,191611494}, {222491699,191611494,222544354,191705684}, 
+    {214745677,191611494,214693022,191705684}, {222544354,191705684,222594782,191801260}, {214693022,191705684,214642594,191801260}, 
+    {222594782,191801260,222642948,191898185}, {214642594,191801260,214594428,191898185}, {222642948,191898185,222688817,191996426}, 
+    {214594428,191898185,214548559,191996426}, {222688817,191996426,222732354,192095946}, {214548559,191996426,214505022,192095946}, 
+    {222732354,192095946,222773524,192196711}, {214505022,192095946,214463852,192196711}, {222773524,192196711,222812293,192298686}, 
+    {214463852,192196711,214425083,192298686}, {222812293,192298686,222848624,192401836}, {214425083,192298686,214388752,192401836}, 
+    {222848624,192401836,222882483,192506125}, {214388752,192401836,214354893,192506125}, {222882483,192506125,222913835,192611519}, 
+    {214354893,192506125,214323541,192611519}, {222913835,192611519,222942644,192717983}, {214323541,192611519,214294732,192717983}, 
+    {222942644,192717983,222968876,192825481}, {214294732,192717983,214268500,192825481}, {222968876,192825481,222992496,192933978}, 
+    {214268500,192825481,214244880,192933978}, {222992496,192933978,223013469,193043440}, {214244880,192933978,214223907,193043440}, 
+    {223013469,193043440,223031758,193153831}, {214223907,193043440,214205618,193153831}, {223031758,193153831,223047331,193265116}, 
+    {214205618,193153831,214190045,193265116}, {223047331,193265116,223060150,193377261}, {214190045,193265116,214177226,193377261}, 
+    {223060150,193377261,223070182,193490229}, {214177226,193377261,214167194,193490229}, {223070182,193490229,223077391,193603986}, 
+    {214167194,193490229,214159985,193603986}, {223077391,193603986,223081742,193718498}, {214159985,193603986,214155634,193718498}, 
+    {223081742,193718498,223083200,193833728}, {214155634,193718498,214154176,193833728}, {223083200,193833728,223081742,193948958}, 
+    {214154176,193833728,214155634,193948958}, {223081742,193948958,223077391,194063470}, {214155634,193948958,214159985,194063470}, 
+    {223077391,194063470,223070182,194177227}, {214159985,194063470,214167194,194177227}, {223070182,194177227,223060150,194290195}, 
+    {214167194,194177227,214177226,194290195}, {223060150,194290195,223047331,194402340}, {214177226,194290195,214190045,194402340}, 
+    {223047331,194402340,223031758,194513625}, {214190045,194402340,214205618,194513625}, {223031758,194513625,223013469,194624016}, 
+    {214205618,194513625,214223907,194624016}, {223013469,194624016,222992496,194733478}, {214223907,194624016,214244880,194733478}, 
+    {222992496,194733478,222968876,194841975}, {214244880,194733478,214268500,194841975}, {222968876,194841975,222942644,194949473}, 
+    {214268500,194841975,214294732,194949473}, {222942644,194949473,222913835,195055937}, {214294732,194949473,214323541,195055937}, 
+    {222913835,195055937,222882483,195161331}, {214323541,195055937,214354893,195161331}, {222882483,195161331,222848624,195265620}, 
+    {214354893,195161331,214388752,195265620}, {222848624,195265620,222812293,195368770}, {214388752,195265620,214425083,195368770}, 
+    {222812293,195368770,222773524,195470745}, {214425083,195368770,214463852,195470745}, {222773524,195470745,222732354,195571510}, 
+    {214463852,195470745,214505022,195571510}, {222732354,195571510,222688817,195671030}, {214505022,195571510,214548559,195671030}, 
+    {222688817,195671030,222642948,195769271}, {214548559,195671030,214594428,195769271}, {222642948,195769271,222594782,195866196}, 
+    {214594428,195769271,214642594,195866196}, {222594782,195866196,222544354,195961772}, {214642594,195866196,214693022,195961772}, 
+    {222544354,195961772,222491699,196055962}, {214693022,195961772,214745677,196055962}, {222491699,196055962,222436853,196148732}, 
+    {214745677,196055962,214800523,196148732}, {222436853,196148732,222379851,196240047}, {214800523,196148732,214857525,196240047}, 
+    {222379851,196240047,222320727,196329871}, {214857525,196240047,214916649,196329871}, {222320727,196329871,222259516,196418170}, 
+    {214916649,196329871,214977860,196418170}, {222259516,196418170,222196254,196504909}, {214977860,196418170,215041122,196504909}, 
+    {222196254,196504909,222130976,196590052}, {215041122,196504909,215106400,196590052}, {222130976,196590052,222063717,196673565}, 
+    {215106400,196590052,215173659,196673565}, {222063717,196673565,221994511,196755412}, {215173659,196673565,215242865,196755412}, 
+    {221994511,196755412,221923394,196835558}, {215242865,196755412,215313982,196835558}, {221923394,196835558,221850402,196913968}, 
+    {215313982,196835558,215386974,196913968}, {221850402,196913968,221775568,196990608}, {215386974,196913968,215461808,196990608}, 
+    {221775568,196990608,221698928,197065442}, {215461808,196990608,215538448,197065442}, {221698928,197065442,221620518,197138434}, 
+    {215538448,197065442,215616858,197138434}, {221620518,197138434,221540372,197209551}, {215616858,197138434,215697004,197209551}, 
+    {221540372,197209551,221458525,197278757}, {215697004,197209551,215778851,197278757}, {221458525,197278757,221375012,197346016}, 
+    {215778851,197278757,215862364,197346016}, {221375012,197346016,221289869,197411294}, {215862364,197346016,215947507,197411294}, 
+    {221289869,197411294,221203130,197474556}, {215947507,197411294,216034246,197474556}, {221203130,197474556,221114831,197535767}, 
+    {216034246,197474556,216122545,197535767}, {221114831,197535767,221025007,197594891}, {216122545,197535767,216212369,197594891}, 
+    {221025007,197594891,220933692,197651893}, {216212369,197594891,216303684,197651893}, {220933692,197651893,220840922,197706739}, 
+    {216303684,197651893,216396454,197706739}, {220840922,197706739,220746732,197759394}, {216396454,197706739,216490644,197759394}, 
+    {220746732,197759394,220651156,197809822}, {216490644,197759394,216586220,197809822}, {220651156,197809822,220554231,197857988}, 
+    {216586220,197809822,216683145,197857988}, {220554231,197857988,220455990,197903857}, {216683145,197857988,216781386,197903857}, 
+    {220455990,197903857,220356470,197947394}, {216781386,197903857,216880906,197947394}, {220356470,197947394,220255705,197988564}, 
+    {216880906,197947394,216981671,197988564}, {220255705,197988564,220153730,198027333}, {216981671,197988564,217083646,198027333}, 
+    {220153730,198027333,220050580,198063664}, {217083646,198027333,217186796,198063664}, {220050580,198063664,219946291,198097523}, 
+    {217186796,198063664,217291085,198097523}, {219946291,198097523,219840897,198128875}, {217291085,198097523,217396479,198128875}, 
+    {219840897,198128875,219734433,198157684}, {217396479,198128875,217502943,198157684}, {219734433,198157684,219626935,198183916}, 
+    {217502943,198157684,217610441,198183916}, {219626935,198183916,219518438,198207536}, {217610441,198183916,217718938,198207536}, 
+    {219518438,198207536,219408976,198228509}, {217718938,198207536,217828400,198228509}, {219408976,198228509,219298585,198246798}, 
+    {217828400,198228509,217938791,198246798}, {219298585,198246798,219187300,198262371}, {217938791,198246798,218050076,198262371}, 
+    {219187300,198262371,219075155,198275190}, {218050076,198262371,218162221,198275190}, {219075155,198275190,218962187,198285222}, 
+    {218162221,198275190,218275189,198285222}, {218962187,198285222,218848430,198292431}, {218275189,198285222,218388946,198292431}, 
+    {218848430,198292431,218733918,198296782}, {218388946,198292431,218503458,198296782}, {218733918,198296782,218618688,198298240}, 
+    {218503458,198296782,218618688,198298240}, 
+};
+
+const Segment SEGMENTS_OUTERB[] = {
+    {218549952,208366464,218665182,208367922}, {218549952,208366464,218434722,208367922}, {218665182,208367922,218779694,208372273}, 
+    {218434722,208367922,218320210,208372273}, {218779694,208372273,218893451,208379482}, {218320210,208372273,218206453,208379482}, 
+    {218893451,208379482,219006419,208389514}, {218206453,208379482,218093485,208389514}, {219006419,208389514,219118564,208402333}, 
+    {218093485,208389514,217981340,208402333}, {219118564,208402333,219229849,208417906}, {217981340,208402333,217870055,208417906}, 
+    {219229849,208417906,219340240,208436195}, {217870055,208417906,217759664,208436195}, {219340240,208436195,219449702,208457168}, 
+    {217759664,208436195,217650202,208457168}, {219449702,208457168,219558199,208480788}, {217650202,208457168,217541705,208480788}, 
+    {219558199,208480788,219665697,208507020}, {217541705,208480788,217434207,208507020}, {219665697,208507020,219772161,208535829}, 
+    {217434207,208507020,217327743,208535829}, {219772161,208535829,219877555,208567181}, {217327743,208535829,217222349,208567181}, 
+    {219877555,208567181,219981844,208601040}, {217222349,208567181,217118060,208601040}, {219981844,208601040,220084994,208637371}, 
+    {217118060,208601040,217014910,208637371}, {220084994,208637371,220186969,208676140}, {217014910,208637371,216912935,208676140}, 
+    {220186969,208676140,220287734,208717310}, {216912935,208676140,216812170,208717310}, {220287734,208717310,220387254,208760847}, 
+    {216812170,208717310,216712650,208760847}, {220387254,208760847,220485495,208806716}, {216712650,208760847,216614409,208806716}, 
+    {220485495,208806716,220582420,208854882}, {216614409,208806716,216517484,208854882}, {220582420,208854882,220677996,208905310}, 
+    {216517484,208854882,216421908,208905310}, {220677996,208905310,220772186,208957965}, {216421908,208905310,216327718,208957965}, 
+    {220772186,208957965,220864956,209012811}, {216327718,208957965,216234948,209012811}, {220864956,209012811,220956271,209069813}, 
+    {216234948,209012811,216143633,209069813}, {220956271,209069813,221046095,209128937}, {216143633,209069813,216053809,209128937}, 
+    {221046095,209128937,221134394,209190148}, {216053809,209128937,215965510,209190148}, {221134394,209190148,221221133,209253410}, 
+    {215965510,209190148,215878771,209253410}, {221221133,209253410,221306276,209318688}, {215878771,209253410,215793628,209318688}, 
+    {221306276,209318688,221389789,209385947}, {215793628,209318688,215710115,209385947}, {221389789,209385947,221471636,209455153}, 
+    {215710115,209385947,215628268,209455153}, {221471636,209455153,221551782,209526270}, {215628268,209455153,215548122,209526270}, 
+    {221551782,209526270,221630192,209599262}, {215548122,209526270,215469712,209599262}, {221630192,209599262,221706832,209674096}, 
+    {215469712,209599262,215393072,209674096}, {221706832,209674096,221781666,209750736}, {215393072,209674096,215318238,209750736}, 
+    {221781666,209750736,221854658,209829146}, {215318238,209750736,215245246,209829146}, {221854658,209829146,221925775,209909292}, 
+    {215245246,209829146,215174129,209909292}, {221925775,209909292,221994981,209991139}, {215174129,209909292,215104923,209991139}, 
+    {221994981,209991139,222062240,210074652}, {215104923,209991139,215037664,210074652}, {222062240,210074652,222127518,210159795}, 
+    {215037664,210074652,214972386,210159795}, {222127518,210159795,222190780,210246534}, {214972386,210159795,214909124,210246534}, 
+    {222190780,210246534,222251991,210334833}, {214909124,210246534,214847913,210334833}, {222251991,210334833,222311115,210424657}, 
+    {214847913,210334833,214788789,210424657}, {222311115,210424657,222368117,210515972}, {214788789,210424657,214731787,210515972}, 
+    {222368117,210515972,222422963,210608742}, {214731787,210515972,214676941,210608742}, {222422963,210608742,222475618,210702932}, 
+    {214676941,210608742,214624286,210702932}, {222475618,210702932,222526046,210798508}, {214624286,210702932,214573858,210798508}, 
+    {222526046,210798508,222574212,210895433}, {214573858,210798508,214525692,210895433}, {222574212,210895433,222620081,210993674}, 
+    {214525692,210895433,214479823,210993674}, {222620081,210993674,222663618,211093194}, {214479823,210993674,214436286,211093194}, 
+    {222663618,211093194,222704788,211193959}, {214436286,211093194,214395116,211193959}, {222704788,211193959,222743557,211295934}, 
+    {214395116,211193959,214356347,211295934}, {222743557,211295934,222779888,211399084}, {214356347,211295934,214320016,211399084}, 
+    {222779888,211399084,222813747,211503373}, {214320016,211399084,214286157,211503373}, {222813747,211503373,222845099,211608767}, 
+    {214286157,211503373,214254805,211608767}, {222845099,211608767,222873908,211715231}, {214254805,211608767,214225996,211715231}, 
+    {222873908,211715231,222900140,211822729}, {214225996,211715231,214199764,211822729}, {222900140,211822729,222923760,211931226}, 
+    {214199764,211822729,214176144,211931226}, {222923760,211931226,222944733,212040688}, {214176144,211931226,214155171,212040688}, 
+    {222944733,212040688,222963022,212151079}, {214155171,212040688,214136882,212151079}, {222963022,212151079,222978595,212262364}, 
+    {214136882,212151079,214121309,212262364}, {222978595,212262364,222991414,212374509}, {214121309,212262364,214108490,212374509}, 
+    {222991414,212374509,223001446,212487477}, {214108490,212374509,214098458,212487477}, {223001446,212487477,223008655,212601234}, 
+    {214098458,212487477,214091249,212601234}, {223008655,212601234,223013006,212715746}, {214091249,212601234,214086898,212715746}, 
+    {223013006,212715746,223014464,212830976}, {214086898,212715746,214085440,212830976}, {223014464,212830976,223013006,212946206}, 
+    {214085440,212830976,214086898,212946206}, {223013006,212946206,223008655,213060718}, {214086898,212946206,214091249,213060718}, 
+    {223008655,213060718,223001446,213174475}, {214091249,213060718,214098458,213174475}, {223001446,213174475,222991414,213287443}, 
+    {214098458,213174475,214108490,213287443}, {222991414,213287443,222978595,213399588}, {214108490,213287443,214121309,213399588}, 
+    {222978595,213399588,222963022,213510873}, {214121309,213399588,214136882,213510873}, {222963022,213510873,222944733,213621264}, 
+    {214136882,213510873,214155171,213621264}, {222944733,213621264,222923760,213730726}, {214155171,213621264,214176144,213730726}, 
+    {222923760,213730726,222900140,213839223}, {214176144,213730726,214199764,213839223}, {222900140,213839223,222873908,213946721}, 
+    {214199764,213839223,214225996,213946721}, {222873908,213946721,222845099,214053185}, {214225996,213946721,214254805,214053185}, 
+    {222845099,214053185,222813747,214158579}, {214254805,214053185,214286157,214158579}, {222813747,214158579,222779888,214262868}, 
+    {214286157,214158579,214320016,214262868}, {222779888,214262868,222743557,214366018}, {214320016,214262868,214356347,214366018}, 
+    {222743557,214366018,222704788,214467993}, {214356347,214366018,214395116,214467993}, {222704788,214467993,222663618,214568758}, 
+    {214395116,214467993,214436286,214568758}, {222663618,214568758,222620081,214668278}, {214436286,214568758,214479823,214668278}, 
+    {222620081,214668278,222574212,214766519}, {214479823,214668278,214525692,214766519}, {222574212,214766519,222526046,214863444}, 
+    {214525692,214766519,214573858,214863444}, {222526046,214863444,222475618,214959020}, {214573858,214863444,214624286,214959020}, 
+    {222475618,214959020,222422963,215053210}, {214624286,214959020,214676941,215053210}, {222422963,215053210,222368117,215145980}, 
+    {214676941,215053210,214731787,215145980}, {222368117,215145980,222311115,215237295}, {214731787,215145980,214788789,215237295}, 
+    {222311115,215237295,222251991,215327119}, {214788789,215237295,214847913,215327119}, {222251991,215327119,222190780,215415418}, 
+    {214847913,215327119,214909124,215415418}, {222190780,215415418,222127518,215502157}, {214909124,215415418,214972386,215502157}, 
+    {222127518,215502157,222062240,215587300}, {214972386,215502157,215037664,215587300}, {222062240,215587300,221994981,215670813}, 
+    {215037664,215587300,215104923,215670813}, {221994981,215670813,221925775,215752660}, {215104923,215670813,215174129,215752660}, 
+    {221925775,215752660,221854658,215832806}, {215174129,215752660,215245246,215832806}, {221854658,215832806,221781666,215911216}, 
+    {215245246,215832806,215318238,215911216}, {221781666,215911216,221706832,215987856}, {215318238,215911216,215393072,215987856}, 
+    {221706832,215987856,221630192,216062690}, {215393072,215987856,215469712,216062690}, {221630192,216062690,221551782,216135682}, 
+    {215469712,216062690,215548122,216135682}, {221551782,216135682,221471636,216206799}, {215548122,216135682,215628268,216206799}, 
+    {221471636,216206799,221389789,216276005}, {215628268,216206799,215710115,216276005}, {221389789,216276005,221306276,216343264}, 
+    {215710115,216276005,215793628,216343264}, {221306276,216343264,221221133,216408542}, {215793628,216343264,215878771,216408542}, 
+    {221221133,216408542,221134394,216471804}, {215878771,216408542,215965510,216471804}, {221134394,216471804,221046095,216533015}, 
+    {215965510,216471804,216053809,216533015}, {221046095,216533015,220956271,216592139}, {216053809,216533015,216143633,216592139}, 
+    {220956271,216592139,220864956,216649141}, {216143633,216592139,216234948,216649141}, {220864956,216649141,220772186,216703987}, 
+    {216234948,216649141,216327718,216703987}, {220772186,216703987,220677996,216756642}, {216327718,216703987,216421908,216756642}, 
+    {220677996,216756642,220582420,216807070}, {216421908,216756642,216517484,216807070}, {220582420,216807070,220485495,216855236}, 
+    {216517484,216807070,216614409,216855236}, {220485495,216855236,220387254,216901105}, {216614409,216855236,216712650,216901105}, 
+    {220387254,216901105,220287734,216944642}, {216712650,216901105,216812170,216944642}, {220287734,216944642,220186969,216985812}, 
+    {216812170,216944642,216912935,216985812}, {220186969,216985812,220084994,217024581}, {216912935,216985812,217014910,217024581}, 
+    {220084994,217024581,219981844,217060912}, {217014910,217024581,217118060,217060912}, {219981844,217060912,219877555,217094771}, 
+    {217118060,217060912,217222349,217094771}, {219877555,217094771,219772161,217126123}, {217222349,217094771,217327743,217126123}, 
+    {219772161,217126123,219665697,217154932}, {217327743,217126123,217434207,217154932}, {219665697,217154932,219558199,217181164}, 
+    {217434207,217154932,217541705,217181164}, {219558199,217181164,219449702,217204784}, {217541705,217181164,217650202,217204784}, 
+    {219449702,217204784,219340240,217225757}, {217650202,217204784,217759664,217225757}, {219340240,217225757,219229849,217244046}, 
+    {217759664,217225757,217870055,217244046}, {219229849,217244046,219118564,217259619}, {217870055,217244046,217981340,217259619}, 
+    {219118564,217259619,219006419,217272438}, {217981340,217259619,218093485,217272438}, {219006419,217272438,218893451,217282470}, 
+    {218093485,217272438,218206453,217282470}, {218893451,217282470,218779694,217289679}, {218206453,217282470,218320210,217289679}, 
+    {218779694,217289679,218665182,217294030}, {218320210,217289679,218434722,217294030}, {218665182,217294030,218549952,217295488}, 
+    {218434722,217294030,218549952,217295488}, 
+};
+
+const Segment SEGMENTS_RIGHT_ARM[] = {
+    {284312322,233150688,284331726,233150812}, {284312322,233150688,284293035,233150901}, {284331726,233150812,284351246,233151276}, 
+    {284293035,233150901,284273864,233151448}, {284351246,233151276,284390633,233153234}, {284273864,233151448,284254811,233152327}, 
+    {284254811,233152327,284235876,233153536}, {284390633,233153234,284430480,233156583}, {284235876,233153536,284217058,233155071}, 
+    {284217058,233155071,284198359,233156931}, {284430480,233156583,284470784,233161344}, {284198359,233156931,284179779,233159111}, 
+    {284179779,233159111,284161318,233161611}, {284470784,233161344,305399168,235986688}, {284161318,233161611,284142977,233164427}, 
+    {284142977,233164427,284124756,233167556}, {284124756,233167556,284106655,233170996}, {284106655,233170996,284088675,233174745}, 
+    {284088675,233174745,284070816,233178799}, {284070816,233178799,284053079,233183156}, {284053079,233183156,284035463,233187814}, 
+    {284035463,233187814,284017970,233192769}, {284017970,233192769,284000600,233198020}, {284000600,233198020,283983352,233203563}, 
+    {283983352,233203563,283949228,233215517}, {283949228,233215517,283915601,233228609}, {283915601,233228609,283882474,233242818}, 
+    {283882474,233242818,283849849,233258125}, {283849849,233258125,283817731,233274507}, {283817731,233274507,283786122,233291943}, 
+    {283786122,233291943,283755025,233310414}, {283755025,233310414,283724444,233329897}, {283724444,233329897,283694380,233350371}, 
+    {283694380,233350371,283664839,233371816}, {283664839,233371816,283635821,233394211}, {283635821,233394211,283607331,233417535}, 
+    {283607331,233417535,283579372,233441766}, {283579372,233441766,283551947,233466883}, {283551947,233466883,283525058,233492866}, 
+    {283525058,233492866,283498710,233519694}, {283498710,233519694,283472904,233547346}, {283472904,233547346,283447644,233575800}, 
+    {283447644,233575800,283422933,233605035}, {283422933,233605035,283398774,233635031}, {283398774,233635031,283375171,233665767}, 
+    {283375171,233665767,283352126,233697221}, {283352126,233697221,283329642,233729373}, {283329642,233729373,283307722,233762201}, 
+    {283307722,233762201,283286370,233795685}, {283286370,233795685,283265589,233829803}, {283265589,233829803,283245381,233864535}, 
+    {283245381,233864535,283225749,233899859}, {283225749,233899859,283206698,233935755}, {283206698,233935755,283188229,233972202}, 
+    {283188229,233972202,283170347,234009177}, {283170347,234009177,283153053,234046662}, {283153053,234046662,283136351,234084634}, 
+    {283136351,234084634,283104736,234161956}, {283104736,234161956,283075526,234240976}, {283075526,234240976,283048745,234321526}, 
+    {283048745,234321526,283024418,234403438}, {283024418,234403438,283002570,234486544}, {283002570,234486544,282983226,234570676}, 
+    {282983226,234570676,282966409,234655665}, {282966409,234655665,282952144,234741344}, {282952144,234741344,282940456,234827544}, 
+    {282940456,234827544,282931370,234914098}, {282931370,234914098,282924909,235000838}, {282924909,235000838,282921099,235087595}, 
+    {282921099,235087595,282919964,235174201}, {282919964,235174201,282921529,235260489}, {282921529,235260489,282925818,235346290}, 
+    {282925818,235346290,282932856,235431437}, {282932856,235431437,282942667,235515761}, {282942667,235515761,282948620,235557562}, 
+    {282948620,235557562,282955276,235599094}, {282955276,235599094,282962638,235640337}, {282962638,235640337,282970708,235681268}, 
+    {282970708,235681268,282979489,235721868}, {282979489,235721868,282988986,235762116}, {282988986,235762116,282999201,235801989}, 
+    {282999201,235801989,283010136,235841468}, {283010136,235841468,283021796,235880532}, {283021796,235880532,283034182,235919158}, 
+    {283034182,235919158,283047299,235957327}, {283047299,235957327,283061149,235995017}, {305399168,235986688,305442940,235993285}, 
+    {305442940,235993285,305485779,236001121}, {283061149,235995017,283075735,236032207}, {305485779,236001121,305527690,236010177}, 
+    {305527690,236010177,305568678,236020430}, {305568678,236020430,305608748,236031859}, {305608748,236031859,305647904,236044444}, 
+    {283075735,236032207,283091061,236068876}, {305647904,236044444,305686152,236058164}, {305686152,236058164,305723495,236072997}, 
+    {283091061,236068876,283107129,236105004}, {305723495,236072997,305759939,236088923}, {305759939,236088923,305795489,236105920}, 
+    {283107129,236105004,283123943,236140569}, {305795489,236105920,305830148,236123967}, {305830148,236123967,305863923,236143044}, 
+    {283123943,236140569,283141505,236175550}, {305863923,236143044,305896817,236163128}, {305896817,236163128,305928836,236184200}, 
+    {283141505,236175550,283159819,236209927}, {305928836,236184200,305959984,236206239}, {305959984,236206239,305990266,236229222}, 
+    {283159819,236209927,283178888,236243677}, {305990266,236229222,306019687,236253130}, {283178888,236243677,283198714,236276781}, 
+    {306019687,236253130,306048252,236277940}, {283198714,236276781,283219302,236309217}, {306048252,236277940,306075964,236303633}, 
+    {306075964,236303633,306102830,236330186}, {283219302,236309217,283240653,236340964}, {306102830,236330186,306128853,236357580}, 
+    {283240653,236340964,283262771,236372001}, {306128853,236357580,306154039,236385792}, {283262771,236372001,283285660,236402308}, 
+    {306154039,236385792,306178392,236414802}, {283285660,236402308,283309321,236431863}, {306178392,236414802,306201917,236444589}, 
+    {283309321,236431863,283333759,236460645}, {306201917,236444589,306224619,236475132}, {283333759,236460645,283358976,236488633}, 
+    {306224619,236475132,306246502,236506410}, {283358976,236488633,283384975,236515806}, {306246502,236506410,306267572,236538401}, 
+    {283384975,236515806,283411760,236542143}, {306267572,236538401,306287832,236571084}, {283411760,236542143,283439333,236567624}, 
+    {283439333,236567624,283467698,236592227}, {306287832,236571084,306307289,236604440}, {283467698,236592227,283496857,236615931}, 
+    {306307289,236604440,306325946,236638446}, {283496857,236615931,283526815,236638715}, {306325946,236638446,306343808,236673081}, 
+    {283526815,236638715,283557572,236660558}, {283557572,236660558,283589134,236681439}, {306343808,236673081,306360880,236708325}, 
+    {283589134,236681439,283621503,236701337}, {283621503,236701337,283654682,236720232}, {306360880,236708325,306377167,236744156}, 
+    {283654682,236720232,283688673,236738102}, {283688673,236738102,283723481,236754925}, {306377167,236744156,306392674,236780554}, 
+    {283723481,236754925,283759108,236770682}, {283759108,236770682,283795558,236785351}, {306392674,236780554,306407405,236817497}, 
+    {283795558,236785351,283832832,236798911}, {283832832,236798911,283870935,236811341}, {283870935,236811341,283909870,236822620}, 
+    {306407405,236817497,306421365,236854964}, {283909870,236822620,283949639,236832728}, {283949639,236832728,283990246,236841642}, 
+    {283990246,236841642,284031693,236849343}, {284031693,236849343,284073984,236855808}, {306421365,236854964,306434558,236892935}, 
+    {284073984,236855808,305044864,239724288}, {306434558,236892935,306446991,236931388}, {306446991,236931388,306458666,236970302}, 
+    {306458666,236970302,306469590,237009656}, {306469590,237009656,306479767,237049429}, {306479767,237049429,306489201,237089600}, 
+    {306489201,237089600,306497897,237130148}, {306497897,237130148,306505861,237171052}, {306505861,237171052,306513097,237212291}, 
+    {306513097,237212291,306519609,237253844}, {306519609,237253844,306525402,237295690}, {306525402,237295690,306530482,237337807}, 
+    {306530482,237337807,306538518,237422774}, {306538518,237422774,306543756,237508574}, {306543756,237508574,306546233,237595042}, 
+    {306546233,237595042,306545988,237682007}, {306545988,237682007,306543059,237769301}, {306543059,237769301,306537483,237856757}, 
+    {306537483,237856757,306529299,237944206}, {306529299,237944206,306518544,238031480}, {306518544,238031480,306505257,238118410}, 
+    {306505257,238118410,306489476,238204828}, {306489476,238204828,306471239,238290565}, {306471239,238290565,306450583,238375454}, 
+    {306450583,238375454,306427548,238459325}, {306427548,238459325,306402170,238542011}, {306402170,238542011,306374488,238623343}, 
+    {306374488,238623343,306344540,238703154}, {306344540,238703154,306312365,238781273}, {306312365,238781273,306277999,238857534}, 
+    {306277999,238857534,306241481,238931768}, {306241481,238931768,306222427,238968072}, {306222427,238968072,306202849,239003807}, 
+    {306202849,239003807,306182753,239038950}, {306182753,239038950,306162142,239073481}, {306162142,239073481,306141021,239107380}, 
+    {306141021,239107380,306119396,239140624}, {306119396,239140624,306097271,239173193}, {306097271,239173193,306074651,239205066}, 
+    {306074651,239205066,306051540,239236222}, {306051540,239236222,306027944,239266639}, {306027944,239266639,306003867,239296297}, 
+    {306003867,239296297,305979313,239325175}, {305979313,239325175,305954288,239353252}, {305954288,239353252,305928797,239380506}, 
+    {305928797,239380506,305902843,239406916}, {305902843,239406916,305876433,239432462}, {305876433,239432462,305849569,239457123}, 
+    {305849569,239457123,305822259,239480877}, {305822259,239480877,305794505,239503703}, {305794505,239503703,305766313,239525581}, 
+    {305766313,239525581,305737688,239546489}, {305737688,239546489,305708634,239566406}, {305708634,239566406,305679156,239585312}, 
+    {305679156,239585312,305649260,239603184}, {305649260,239603184,305618948,239620003}, {305618948,239620003,305588228,239635747}, 
+    {305588228,239635747,305557102,239650395}, {305557102,239650395,305541389,239657301}, {305541389,239657301,305525576,239663926}, 
+    {305525576,239663926,305509664,239670266}, {305509664,239670266,305493655,239676318}, {305493655,239676318,305477547,239682081}, 
+    {305477547,239682081,305461343,239687552}, {305461343,239687552,305445042,239692728}, {305445042,239692728,305428645,239697606}, 
+    {305428645,239697606,305412153,239702183}, {305412153,239702183,305395566,239706458}, {305395566,239706458,305378886,239710427}, 
+    {305378886,239710427,305362111,239714088}, {305362111,239714088,305345244,239717438}, {305345244,239717438,305328285,239720475}, 
+    {305328285,239720475,305311233,239723196}, {305311233,239723196,305294091,239725598}, {305044864,239724288,305063220,239726624}, 
+    {305294091,239725598,305276858,239727678}, {305063220,239726624,305081492,239728605}, {305276858,239727678,305259535,239729435}, 
+    {305081492,239728605,305099682,239730232}, {305259535,239729435,305242123,239730865}, {305099682,239730232,305117787,239731510}, 
+    {305242123,239730865,305224622,239731966}, {305117787,239731510,305135808,239732440}, {305224622,239731966,305207033,239732735}, 
+    {305135808,239732440,305153743,239733024}, {305207033,239732735,305189357,239733169}, {305153743,239733024,305171593,239733267}, 
+    {305189357,239733169,305171593,239733267}, 
+};
+
+const Segment SEGMENTS_RIGHT_ARM_INNER[] = {
+    {306295722,216176138,306285889,216176258}, {306295722,216176138,306305532,216176188}, {306305532,216176188,306315314,216176409}, 
+    {306285889,216176258,306266165,216177008}, {306315314,216176409,306325066,216176801}, {306325066,216176801,306334784,216177363}, 
+    {306266165,216177008,306246388,216178438}, {306334784,216177363,306344463,216178096}, {306344463,216178096,306354102,216178999}, 
+    {306246388,216178438,306226585,216180548}, {306354102,216178999,306363696,216180074}, {306363696,216180074,306373242,216181319}, 
+    {306226585,216180548,306206785,216183337}, {306373242,216181319,306382736,216182736}, {306382736,216182736,306392175,216184324}, 
+    {306206785,216183337,306187016,216186803}, {306392175,216184324,306401556,216186083}, {306401556,216186083,306410874,216188014}, 
+    {306187016,216186803,306167304,216190946}, {306410874,216188014,306420127,216190116}, {306420127,216190116,306429311,216192389}, 
+    {306167304,216190946,306147679,216195765}, {306429311,216192389,306438422,216194835}, {306438422,216194835,306447458,216197452}, 
+    {306147679,216195765,306128168,216201260}, {306447458,216197452,306456413,216200241}, {306456413,216200241,306465286,216203202}, 
+    {306128168,216201260,306108799,216207430}, {306465286,216203202,306474073,216206335}, {306474073,216206335,306482769,216209641}, 
+    {306108799,216207430,306089600,216214273}, {306482769,216209641,306491372,216213118}, {306491372,216213118,306499879,216216768}, 
+    {306089600,216214273,306070598,216221790}, {306499879,216216768,306508284,216220591}, {306508284,216220591,306516586,216224586}, 
+    {306070598,216221790,306061180,216225800}, {306516586,216224586,306524781,216228754}, {306061180,216225800,306051822,216229979}, 
+    {306524781,216228754,306532864,216233094}, {306051822,216229979,306042527,216234325}, {306532864,216233094,306540834,216237608}, 
+    {306042527,216234325,306033299,216238839}, {306540834,216237608,306548685,216242294}, {306033299,216238839,306024141,216243521}, 
+    {306548685,216242294,306556416,216247154}, {306024141,216243521,306015057,216248371}, {306556416,216247154,306564021,216252186}, 
+    {306015057,216248371,306006051,216253387}, {306564021,216252186,306571498,216257392}, {306006051,216253387,305997125,216258572}, 
+    {306571498,216257392,306578844,216262771}, {305997125,216258572,305988283,216263923}, {306578844,216262771,306586054,216268324}, 
+    {305988283,216263923,305979529,216269442}, {306586054,216268324,306593126,216274050}, {305979529,216269442,305970867,216275128}, 
+    {306593126,216274050,306600055,216279950}, {305970867,216275128,305962299,216280981}, {306600055,216279950,306606839,216286024}, 
+    {305962299,216280981,305953829,216287001}, {306606839,216286024,306613473,216292271}, {305953829,216287001,305945461,216293187}, 
+    {306613473,216292271,306619955,216298693}, {305945461,216293187,305937198,216299541}, {306619955,216298693,306626281,216305288}, 
+    {305937198,216299541,305929044,216306061}, {306626281,216305288,306632447,216312058}, {305929044,216306061,305921002,216312747}, 
+    {306632447,216312058,306638450,216319002}, {305921002,216312747,305913075,216319600}, {306638450,216319002,306644286,216326120}, 
+    {305913075,216319600,305905267,216326619}, {306644286,216326120,306649953,216333413}, {305905267,216326619,305897583,216333805}, 
+    {306649953,216333413,306655446,216340880}, {305897583,216333805,305890024,216341156}, {306655446,216340880,306660761,216348522}, 
+    {305890024,216341156,305882594,216348674}, {306660761,216348522,306665897,216356339}, {305882594,216348674,305875298,216356357}, 
+    {306665897,216356339,306670848,216364330}, {305875298,216356357,305868138,216364207}, {305868138,216364207,305861118,216372222}, 
+    {306670848,216364330,306675612,216372496}, {305861118,216372222,305854242,216380403}, {306675612,216372496,306680185,216380838}, 
+    {305854242,216380403,305847513,216388749}, {306680185,216380838,306684563,216389354}, {305847513,216388749,305840934,216397261}, 
+    {306684563,216389354,306688743,216398046}, {305840934,216397261,305834509,216405938}, {306688743,216398046,306692722,216406913}, 
+    {305834509,216405938,305828241,216414780}, {306692722,216406913,306696497,216415955}, {305828241,216414780,305822134,216423787}, 
+    {306696497,216415955,306700062,216425173}, {305822134,216423787,305816192,216432960}, {306700062,216425173,306703416,216434567}, 
+    {305816192,216432960,305782305,216485442}, {306703416,216434567,306706555,216444136}, {306706555,216444136,306709474,216453881}, 
+    {306709474,216453881,306712172,216463802}, {306712172,216463802,306714643,216473899}, {306714643,216473899,306716885,216484172}, 
+    {306716885,216484172,306718895,216494622}, {305782305,216485442,305746493,216538850}, {306718895,216494622,306720668,216505247}, 
+    {306720668,216505247,306722202,216516049}, {306722202,216516049,306723492,216527028}, {306723492,216527028,306724535,216538183}, 
+    {306724535,216538183,306725329,216549514}, {305746493,216538850,305669258,216648263}, {306725329,216549514,306725868,216561023}, 
+    {306725868,216561023,306726151,216572708}, {306726151,216572708,306726173,216584571}, {306726173,216584571,306725930,216596610}, 
+    {306725930,216596610,306725421,216608827}, {306725421,216608827,306724640,216621221}, {306724640,216621221,306723584,216633792}, 
+    {306723584,216633792,306713640,216724790}, {305669258,216648263,305584818,216760847}, {306713640,216724790,306708103,216766035}, 
+    {305584818,216760847,305493504,216876249}, {306708103,216766035,306702198,216804669}, {306702198,216804669,306695933,216840859}, 
+    {306695933,216840859,306689317,216874776}, {306689317,216874776,306682356,216906586}, {305493504,216876249,305395648,216994114}, 
+    {306682356,216906586,306675059,216936460}, {306675059,216936460,306667432,216964565}, {306667432,216964565,306659484,216991070}, 
+    {306659484,216991070,306651222,217016143}, {305395648,216994114,305291581,217114091}, {306651222,217016143,306642654,217039954}, 
+    {306642654,217039954,306633786,217062671}, {306633786,217062671,306624628,217084462}, {306624628,217084462,306615186,217105496}, 
+    {306615186,217105496,306605468,217125941}, {305291581,217114091,305181635,217235825}, {306605468,217125941,306585234,217165741}, 
+    {306585234,217165741,306563988,217205210}, {306563988,217205210,306518699,217288550}, {305181635,217235825,305066141,217358963}, 
+    {306518699,217288550,306494778,217335118}, {306494778,217335118,306470088,217386750}, {305066141,217358963,304819835,217608039}, 
+    {306470088,217386750,306457473,217414887}, {306457473,217414887,306444688,217444795}, {306444688,217444795,306431741,217476643}, 
+    {306431741,217476643,306418640,217510600}, {306418640,217510600,306405392,217546835}, {306405392,217546835,306392004,217585515}, 
+    {306392004,217585515,306364842,217670889}, {304819835,217608039,304555313,217858494}, {306364842,217670889,306337213,217768069}, 
+    {306337213,217768069,306309179,217878405}, {304555313,217858494,304275229,218107500}, {306309179,217878405,306280800,218003246}, 
+    {306280800,218003246,306252138,218143939}, {304275229,218107500,303982232,218352232}, {306252138,218143939,306223252,218301834}, 
+    {306223252,218301834,306194204,218478279}, {303982232,218352232,303678975,218589864}, {306194204,218478279,306135864,218892215}, 
+    {303678975,218589864,303368108,218817569}, {303368108,218817569,303210649,218926817}, {306135864,218892215,306077603,219396535}, 
+    {303210649,218926817,303052283,219032522}, {296984644,218980054,296974839,218980186}, {296984644,218980054,296994747,218980155}, 
+    {296994747,218980155,297005150,218980491}, {296974839,218980186,296965326,218980548}, {297005150,218980491,297015857,218981066}, 
+    {296965326,218980548,296956104,218981137}, {297015857,218981066,297026871,218981882}, {296956104,218981137,296947168,218981951}, 
+    {297026871,218981882,297038195,218982943}, {296947168,218981951,296938516,218982985}, {297038195,218982943,297049834,218984250}, 
+    {296938516,218982985,296930143,218984239}, {296930143,218984239,296922046,218985707}, {297049834,218984250,297074068,218987619}, 
+    {296922046,218985707,296914222,218987389}, {296914222,218987389,296906667,218989280}, {297074068,218987619,297099600,218992010}, 
+    {296906667,218989280,296902990,218990304}, {296902990,218990304,296899378,218991379}, {296899378,218991379,296895832,218992505}, 
+    {297099600,218992010,297126458,218997446}, {296895832,218992505,296892352,218993682}, {296892352,218993682,296888936,218994908}, 
+    {296888936,218994908,296885584,218996185}, {296885584,218996185,296882296,218997512}, {297126458,218997446,297154670,219003952}, 
+    {296882296,218997512,296879072,218998888}, {296879072,218998888,296875911,219000312}, {296875911,219000312,296872812,219001786}, 
+    {296872812,219001786,296869775,219003307}, {296869775,219003307,296866800,219004876}, {297154670,219003952,297184262,219011549}, 
+    {296866800,219004876,296863887,219006493}, {296863887,219006493,296861034,219008157}, {296861034,219008157,296858242,219009867}, 
+    {296858242,219009867,296855509,219011624}, {297184262,219011549,297215262,219020261}, {296855509,219011624,296852836,219013427}, 
+    {296852836,219013427,296850223,219015276}, {296850223,219015276,296847668,219017170}, {296847668,219017170,296845171,219019109}, 
+    {296845171,219019109,296842732,219021092}, {297215262,219020261,297247699,219030110}, {296842732,219021092,296840351,219023120}, 
+    {296840351,219023120,296838026,219025191}, {296838026,219025191,296835758,219027306}, {296835758,219027306,296833546,219029465}, 
+    {296833546,219029465,296831390,219031666}, {297247699,219030110,297281600,219041119}, {296831390,219031666,296829289,219033909}, 
+    {303052283,219032522,302893339,219134334}, {296829289,219033909,296827242,219036195}, {296827242,219036195,296825251,219038522}, 
+    {296825251,219038522,296823313,219040891}, {296823313,219040891,296821428,219043301}, {297281600,219041119,297316992,219053312}, 
+    {296821428,219043301,296819597,219045751}, {296819597,219045751,296817818,219048242}, {296817818,219048242,296816092,219050772}, 
+    {296816092,219050772,296814417,219053342}, {297316992,219053312,297939965,219284916}, {296814417,219053342,296812794,219055952}, 
+    {296812794,219055952,296811222,219058600}, {296811222,219058600,296809700,219061287}, {296809700,219061287,296808228,219064012}, 
+    {296808228,219064012,296806806,219066775}, {296806806,219066775,296805433,219069575}, {296805433,219069575,296804109,219072412}, 
+    {296804109,219072412,296802833,219075286}, {296802833,219075286,296801605,219078196}, {296801605,219078196,296800424,219081143}, 
+    {296800424,219081143,296799291,219084125}, {296799291,219084125,296797163,219090194}, {296797163,219090194,296795218,219096402}, 
+    {296795218,219096402,296793453,219102745}, {296793453,219102745,296791864,219109221}, {296791864,219109221,296790448,219115826}, 
+    {296790448,219115826,296789201,219122559}, {296789201,219122559,296788119,219129415}, {296788119,219129415,296787200,219136392}, 
+    {302893339,219134334,302734151,219231897}, {296787200,219136392,296786440,219143488}, {296786440,219143488,296785835,219150698}, 
+    {296785835,219150698,296785381,219158022}, {296785381,219158022,296785077,219165455}, {296785077,219165455,296784917,219172995}, 
+    {296784917,219172995,296784899,219180638}, {296784899,219180638,296785273,219196226}, {296785273,219196226,296786173,219212195}, 
+    {296786173,219212195,296787569,219228522}, {296787569,219228522,296789435,219245185}, {302734151,219231897,302575049,219324859}, 
+    {296789435,219245185,296791743,219262160}, {296791743,219262160,296794466,219279425}, {296794466,219279425,296797574,219296957}, 
+    {297939965,219284916,298499489,219503564}, {296797574,219296957,296804842,219332728}, {302575049,219324859,302416364,219412867}, 
+    {296804842,219332728,296813325,219369291}, {296813325,219369291,296822802,219406463}, {306077603,219396535,305963264,220719488}, 
+    {296822802,219406463,296843856,219481899}, {302416364,219412867,302258428,219495567}, {296843856,219481899,296866236,219557568}, 
+    {302258428,219495567,302101573,219572606}, {298499489,219503564,299012838,219696286}, {296866236,219557568,296888174,219632006}, 
+    {302101573,219572606,301946129,219643631}, {296888174,219632006,296907904,219703744}, {301946129,219643631,301792429,219708289}, 
+    {299012838,219696286,299257596,219778871}, {296907904,219703744,296917700,219739278}, {301792429,219708289,301716336,219738119}, 
+    {301716336,219738119,301640804,219766225}, {296917700,219739278,296929188,219776588}, {301640804,219766225,301565872,219792563}, 
+    {296929188,219776588,296942327,219815621}, {299257596,219778871,299377940,219816011}, {301565872,219792563,301491584,219817088}, 
+    {296942327,219815621,296957077,219856325}, {299377940,219816011,299497288,219850112}, {301491584,219817088,301421095,219838926}, 
+    {301421095,219838926,301351471,219859168}, {299497288,219850112,299615909,219880971}, {296957077,219856325,296973399,219898646}, 
+    {301351471,219859168,301282677,219877840}, {301282677,219877840,301214680,219894967}, {299615909,219880971,299734074,219908387}, 
+    {301214680,219894967,301147446,219910574}, {296973399,219898646,296991252,219942534}, {299734074,219908387,299852052,219932155}, 
+    {301147446,219910574,301080942,219924687}, {301080942,219924687,301015133,219937331}, {299852052,219932155,299970113,219952074}, 
+    {301015133,219937331,300949986,219948532}, {296991252,219942534,297031391,220034794}, {300949986,219948532,300885467,219958314}, 
+    {299970113,219952074,300029259,219960527}, {300885467,219958314,300821542,219966703}, {300029259,219960527,300088527,219967942}, 
+    {300821542,219966703,300758178,219973724}, {300088527,219967942,300147951,219974292}, {300758178,219973724,300695341,219979404}, 
+    {300147951,219974292,300207564,219979554}, {300695341,219979404,300632997,219983766}, {300207564,219979554,300267400,219983701}, 
+    {300267400,219983701,300327494,219986709}, {300632997,219983766,300571113,219986836}, {300327494,219986709,300387878,219988552}, 
+    {300571113,219986836,300509654,219988641}, {300387878,219988552,300448587,219989204}, {300509654,219988641,300448587,219989204}, 
+    {297031391,220034794,297077174,220132687}, {297077174,220132687,297128281,220235791}, {297128281,220235791,297245182,220455954}, 
+    {297245182,220455954,297379531,220691922}, {297379531,220691922,297528762,220940333}, {305963264,220719488,305944827,220946200}, 
+    {297528762,220940333,297861616,221461040}, {305944827,220946200,305921264,221178609}, {305921264,221178609,305891988,221415087}, 
+    {305891988,221415087,305856414,221654006}, {297861616,221461040,298223228,221991185}, {305856414,221654006,305813958,221893737}, 
+    {305813958,221893737,305764033,222132652}, {298223228,221991185,298593082,222503878}, {305764033,222132652,305736088,222251295}, 
+    {305736088,222251295,305706056,222369123}, {305706056,222369123,305673864,222485932}, {305673864,222485932,305639440,222601520}, 
+    {298593082,222503878,298950663,222972228}, {305639440,222601520,305602710,222715682}, {305602710,222715682,305563601,222828216}, 
+    {305563601,222828216,305522039,222938917}, {305522039,222938917,305477953,223047582}, {298950663,222972228,299118440,223181371}, 
+    {305477953,223047582,305431268,223154007}, {305431268,223154007,305381911,223257989}, {299118440,223181371,299275456,223369344}, 
+    {305381911,223257989,305329809,223359325}, {305329809,223359325,305302707,223408936}, {299275456,223369344,299356961,223462522}, 
+    {305302707,223408936,305274890,223457810}, {305274890,223457810,305246351,223505920}, {299356961,223462522,299437291,223550327}, 
+    {305246351,223505920,305217080,223553241}, {299437291,223550327,299516457,223633040}, {305217080,223553241,305187067,223599748}, 
+    {305187067,223599748,305156305,223645415}, {299516457,223633040,299594473,223710941}, {305156305,223645415,305124783,223690217}, 
+    {305124783,223690217,305092493,223734129}, {299594473,223710941,299671353,223784312}, {305092493,223734129,305059425,223777124}, 
+    {305059425,223777124,305025570,223819177}, {299671353,223784312,299747109,223853434}, {305025570,223819177,304990920,223860264}, 
+    {299747109,223853434,299821755,223918587}, {304990920,223860264,304955464,223900358}, {304955464,223900358,304919194,223939434}, 
+    {299821755,223918587,299895304,223980053}, {304919194,223939434,304882101,223977467}, {304882101,223977467,304844175,224014431}, 
+    {299895304,223980053,299967769,224038112}, {304844175,224014431,304805408,224050301}, {299967769,224038112,300039164,224093045}, 
+    {304805408,224050301,304765790,224085051}, {304765790,224085051,304725312,224118656}, {300039164,224093045,300178795,224194656}, 
+    {304725312,224118656,307024704,232890304}, {300178795,224194656,300314302,224287135}, {300314302,224287135,300445792,224372728}, 
+    {300445792,224372728,300697141,224532245}, {300697141,224532245,300817212,224610663}, {300817212,224610663,300933688,224691183}, 
+    {300933688,224691183,300990611,224732934}, {300990611,224732934,301046675,224776053}, {301046675,224776053,301101893,224820821}, 
+    {301101893,224820821,301156279,224867520}, {301156279,224867520,301209845,224916429}, {301209845,224916429,301262605,224967830}, 
+    {301262605,224967830,301314573,225022004}, {301314573,225022004,301340263,225050219}, {301340263,225050219,301365760,225079232}, 
+    {301365760,225079232,304168896,233671808}, {307024704,232890304,307027792,232902607}, {307027792,232902607,307030612,232914913}, 
+    {307030612,232914913,307033164,232927224}, {307033164,232927224,307035452,232939537}, {307035452,232939537,307037476,232951852}, 
+    {307037476,232951852,307039238,232964167}, {307039238,232964167,307040741,232976482}, {307040741,232976482,307041986,232988797}, 
+    {307041986,232988797,307042975,233001109}, {307042975,233001109,307043711,233013419}, {307043711,233013419,307044194,233025724}, 
+    {307044194,233025724,307044426,233038025}, {307044426,233038025,307044410,233050321}, {307044410,233050321,307044148,233062610}, 
+    {307044148,233062610,307043641,233074891}, {307043641,233074891,307042891,233087164}, {307042891,233087164,307041899,233099428}, 
+    {307041899,233099428,307040669,233111682}, {307040669,233111682,307039201,233123925}, {307039201,233123925,307037498,233136156}, 
+    {307037498,233136156,307035561,233148374}, {307035561,233148374,307033393,233160578}, {307033393,233160578,307030994,233172768}, 
+    {307030994,233172768,307028368,233184942}, {307028368,233184942,307025515,233197100}, {307025515,233197100,307022438,233209240}, 
+    {307022438,233209240,307015618,233233464}, {307015618,233233464,307007923,233257608}, {307007923,233257608,306999368,233281664}, 
+    {306999368,233281664,306989967,233305625}, {306989967,233305625,306979736,233329484}, {306979736,233329484,306968689,233353233}, 
+    {306968689,233353233,306956842,233376865}, {306956842,233376865,306944208,233400373}, {306944208,233400373,306930803,233423749}, 
+    {306930803,233423749,306916642,233446987}, {306916642,233446987,306901740,233470079}, {306901740,233470079,306886111,233493018}, 
+    {306886111,233493018,306869770,233515796}, {306869770,233515796,306852733,233538406}, {306852733,233538406,306835013,233560842}, 
+    {306835013,233560842,306816626,233583095}, {306816626,233583095,306797587,233605158}, {306797587,233605158,306777910,233627025}, 
+    {306777910,233627025,306757611,233648687}, {306757611,233648687,306736704,233670138}, {306736704,233670138,306715204,233691370}, 
+    {304168896,233671808,304179816,233703600}, {306715204,233691370,306693126,233712377}, {304179816,233703600,304191539,233734490}, 
+    {306693126,233712377,306670485,233733150}, {306670485,233733150,306623572,233773967}, {304191539,233734490,304204051,233764485}, 
+    {304204051,233764485,304217336,233793592}, {306623572,233773967,306574585,233813765}, {304217336,233793592,304231379,233821818}, 
+    {306574585,233813765,306523642,233852484}, {304231379,233821818,304246167,233849172}, {304246167,233849172,304261683,233875660}, 
+    {306523642,233852484,306470862,233890066}, {304261683,233875660,304269710,233888581}, {304269710,233888581,304277913,233901289}, 
+    {306470862,233890066,306416364,233926454}, {304277913,233901289,304286291,233913784}, {304286291,233913784,304294843,233926067}, 
+    {304294843,233926067,304303565,233938139}, {306416364,233926454,306360267,233961589}, {304303565,233938139,304312456,233950000}, 
+    {304312456,233950000,304321515,233961653}, {306360267,233961589,306302689,233995412}, {304321515,233961653,304330740,233973097}, 
+    {304330740,233973097,304340128,233984334}, {304340128,233984334,304349678,233995365}, {304349678,233995365,304359388,234006190}, 
+    {306302689,233995412,306243749,234027867}, {304359388,234006190,304369256,234016810}, {304369256,234016810,304379280,234027227}, 
+    {304379280,234027227,304389458,234037440}, {306243749,234027867,306183566,234058894}, {304389458,234037440,304399789,234047452}, 
+    {304399789,234047452,304410271,234057263}, {304410271,234057263,304431679,234076285}, {306183566,234058894,306122260,234088436}, 
+    {304431679,234076285,304453668,234094514}, {306122260,234088436,306059948,234116434}, {304453668,234094514,304476222,234111957}, 
+    {304476222,234111957,304499326,234128622}, {306059948,234116434,305996749,234142830}, {304499326,234128622,304522967,234144515}, 
+    {305996749,234142830,305932783,234167566}, {304522967,234144515,304547128,234159644}, {304547128,234159644,304571796,234174017}, 
+    {305932783,234167566,305868168,234190584}, {304571796,234174017,304596955,234187640}, {304596955,234187640,304622590,234200520}, 
+    {305868168,234190584,305803023,234211825}, {304622590,234200520,304648687,234212666}, {305803023,234211825,305737467,234231232}, 
+    {304648687,234212666,304675230,234224084}, {304675230,234224084,304702206,234234781}, {305737467,234231232,305671618,234248746}, 
+    {304702206,234234781,304729598,234244766}, {304729598,234244766,304757393,234254044}, {305671618,234248746,305605596,234264309}, 
+    {304757393,234254044,304785575,234262624}, {304785575,234262624,304814129,234270513}, {305605596,234264309,305539519,234277863}, 
+    {304814129,234270513,304843041,234277717}, {304843041,234277717,304872296,234284245}, {305539519,234277863,305473507,234289350}, 
+    {304872296,234284245,304901878,234290103}, {305473507,234289350,305407677,234298711}, {304901878,234290103,304931774,234295299}, 
+    {304931774,234295299,304961968,234299840}, {305407677,234298711,305342148,234305888}, {304961968,234299840,304992445,234303733}, 
+    {304992445,234303733,305023191,234306985}, {305342148,234305888,305277041,234310824}, {305023191,234306985,305054190,234309605}, 
+    {305054190,234309605,305085429,234311599}, {305277041,234310824,305244682,234312433}, {305085429,234311599,305116891,234312974}, 
+    {305244682,234312433,305212472,234313460}, {305116891,234312974,305148562,234313737}, {305212472,234313460,305180427,234313897}, 
+    {305148562,234313737,305180427,234313897}, 
+};
+
+const Segment SEGMENTS_RIGHT_ARM_MID[] = {
+    {319114243,217661407,319106594,217661525}, {319114243,217661407,319121758,217661431}, {319121758,217661431,319129137,217661597}, 
+    {319106594,217661525,319098810,217661786}, {319129137,217661597,319136383,217661904}, {319098810,217661786,319090891,217662192}, 
+    {319136383,217661904,319143495,217662351}, {319090891,217662192,319074646,217663439}, {319143495,217662351,319150473,217662938}, 
+    {319150473,217662938,319157317,217663662}, {319074646,217663439,319057856,217665274}, {319157317,217663662,319164029,217664524}, 
+    {319164029,217664524,319170608,217665523}, {319057856,217665274,319040520,217667701}, {319170608,217665523,319177054,217666657}, 
+    {319177054,217666657,319183368,217667926}, {319040520,217667701,319022634,217670729}, {319183368,217667926,319189550,217669330}, 
+    {319189550,217669330,319195600,217670867}, {319022634,217670729,319004198,217674365}, {319195600,217670867,319201519,217672536}, 
+    {319201519,217672536,319207307,217674337}, {319207307,217674337,319212964,217676269}, {319004198,217674365,318985208,217678613}, 
+    {319212964,217676269,319218490,217678330}, {319218490,217678330,319223886,217680521}, {318985208,217678613,318965664,217683483}, 
+    {319223886,217680521,319229152,217682840}, {319229152,217682840,319234288,217685287}, {318965664,217683483,318945561,217688979}, 
+    {319234288,217685287,319239295,217687860}, {319239295,217687860,319244172,217690558}, {318945561,217688979,318924899,217695109}, 
+    {319244172,217690558,319248921,217693382}, {319248921,217693382,319253540,217696330}, {318924899,217695109,318903674,217701880}, 
+    {319253540,217696330,319258032,217699401}, {319258032,217699401,319262395,217702594}, {318903674,217701880,318881886,217709298}, 
+    {319262395,217702594,319266630,217705909}, {319266630,217705909,319270738,217709345}, {318881886,217709298,318859531,217717370}, 
+    {319270738,217709345,319274719,217712900}, {319274719,217712900,319278572,217716575}, {319278572,217716575,319282299,217720368}, 
+    {318859531,217717370,318813112,217735503}, {319282299,217720368,319285899,217724278}, {319285899,217724278,319289373,217728304}, 
+    {319289373,217728304,319292721,217732447}, {319292721,217732447,319295944,217736704}, {318813112,217735503,318764402,217756333}, 
+    {319295944,217736704,319299041,217741075}, {319299041,217741075,319302013,217745559}, {319302013,217745559,319304860,217750156}, 
+    {319304860,217750156,319307582,217754864}, {319307582,217754864,319310181,217759683}, {318764402,217756333,318713382,217779913}, 
+    {319310181,217759683,319312655,217764611}, {319312655,217764611,319315005,217769649}, {319315005,217769649,319317233,217774795}, 
+    {319317233,217774795,319319337,217780048}, {318713382,217779913,318660035,217806297}, {319319337,217780048,319321318,217785407}, 
+    {319321318,217785407,319323176,217790872}, {319323176,217790872,319324912,217796442}, {319324912,217796442,319326526,217802116}, 
+    {319326526,217802116,319328018,217807892}, {318660035,217806297,318604343,217835538}, {319328018,217807892,319329389,217813771}, 
+    {319329389,217813771,319330638,217819752}, {319330638,217819752,319331767,217825833}, {319331767,217825833,319332774,217832014}, 
+    {319332774,217832014,319333662,217838294}, {318604343,217835538,318546288,217867690}, {319333662,217838294,319334429,217844671}, 
+    {319334429,217844671,319335076,217851147}, {319335076,217851147,319335604,217857718}, {319335604,217857718,319336012,217864385}, 
+    {319336012,217864385,319336301,217871147}, {318546288,217867690,318485853,217902808}, {319336301,217871147,319336472,217878002}, 
+    {319336472,217878002,319336458,217891991}, {319336458,217891991,319335972,217906346}, {318485853,217902808,318423021,217940944}, 
+    {319335972,217906346,319335016,217921060}, {319335016,217921060,319333593,217936125}, {319333593,217936125,319331705,217951536}, 
+    {318423021,217940944,318290092,218026487}, {319331705,217951536,319329353,217967285}, {319329353,217967285,319326541,217983366}, 
+    {319326541,217983366,319323271,217999772}, {319323271,217999772,319319544,218016497}, {319319544,218016497,319315362,218033533}, 
+    {318290092,218026487,318147362,218124749}, {319315362,218033533,319310729,218050875}, {319310729,218050875,319305646,218068514}, 
+    {319305646,218068514,319300115,218086446}, {319300115,218086446,319287720,218123156}, {319287720,218123156,319273561,218160952}, 
+    {318147362,218124749,317994688,218236160}, {319273561,218160952,319257655,218199780}, {319257655,218199780,319240020,218239587}, 
+    {317994688,218236160,317724982,218434768}, {319240020,218239587,319220674,218280319}, {319220674,218280319,319199635,218321921}, 
+    {309066989,218318830,309056705,218319008}, {309066989,218318830,309077415,218318887}, {309077415,218318887,309087984,218319181}, 
+    {309056705,218319008,309046565,218319422}, {309087984,218319181,309098693,218319712}, {309046565,218319422,309036570,218320069}, 
+    {309098693,218319712,309109542,218320481}, {309036570,218320069,309026722,218320950}, {309109542,218320481,309120530,218321488}, 
+    {309026722,218320950,309017021,218322063}, {309120530,218321488,309131655,218322735}, {319199635,218321921,319176920,218364341}, 
+    {309017021,218322063,309007468,218323409}, {309131655,218322735,309142916,218324222}, {309007468,218323409,308998065,218324985}, 
+    {309142916,218324222,309154313,218325950}, {308998065,218324985,308988812,218326792}, {309154313,218325950,309165844,218327920}, 
+    {308988812,218326792,308979711,218328828}, {309165844,218327920,309177508,218330133}, {308979711,218328828,308970763,218331093}, 
+    {309177508,218330133,309189305,218332589}, {308970763,218331093,308961969,218333586}, {309189305,218332589,309201232,218335288}, 
+    {308961969,218333586,308953329,218336307}, {309201232,218335288,309225475,218341423}, {308953329,218336307,308944846,218339254}, 
+    {308944846,218339254,308936520,218342426}, {309225475,218341423,309250228,218348543}, {308936520,218342426,308928351,218345824}, 
+    {308928351,218345824,308920343,218349446}, {309250228,218348543,309275483,218356654}, {308920343,218349446,308912494,218353292}, 
+    {308912494,218353292,308904807,218357360}, {309275483,218356654,309301232,218365763}, {308904807,218357360,308897283,218361650}, 
+    {308897283,218361650,308889922,218366161}, {319176920,218364341,319152546,218407524}, {309301232,218365763,309327465,218375875}, 
+    {308889922,218366161,308882726,218370893}, {308882726,218370893,308875696,218375845}, {308875696,218375845,308868833,218381015}, 
+    {309327465,218375875,309354174,218386997}, {308868833,218381015,308862138,218386404}, {308862138,218386404,308855612,218392009}, 
+    {309354174,218386997,309381351,218399135}, {308855612,218392009,308849256,218397832}, {308849256,218397832,308843071,218403870}, 
+    {309381351,218399135,309408985,218412294}, {308843071,218403870,308837059,218410124}, {319152546,218407524,319126531,218451418}, 
+    {308837059,218410124,308831221,218416592}, {309408985,218412294,309437069,218426482}, {308831221,218416592,308825556,218423273}, 
+    {308825556,218423273,308820068,218430168}, {309437069,218426482,309465594,218441703}, {308820068,218430168,308814756,218437274}, 
+    {317724982,218434768,317448860,218630629}, {308814756,218437274,308809622,218444592}, {309465594,218441703,309494552,218457965}, 
+    {308809622,218444592,308804667,218452120}, {319126531,218451418,319098894,218495967}, {308804667,218452120,308799892,218459858}, 
+    {309494552,218457965,309523932,218475272}, {308799892,218459858,308795299,218467805}, {308795299,218467805,308790887,218475960}, 
+    {309523932,218475272,309553728,218493632}, {308790887,218475960,308786659,218484323}, {308786659,218484323,308782615,218492893}, 
+    {308782615,218492893,308778756,218501668}, {309553728,218493632,309668335,218567371}, {319098894,218495967,319069650,218541119}, 
+    {308778756,218501668,308775084,218510649}, {308775084,218510649,308771600,218519834}, {308771600,218519834,308768304,218529223}, 
+    {308768304,218529223,308765199,218538815}, {308765199,218538815,308762284,218548608}, {319069650,218541119,319038819,218586821}, 
+    {308762284,218548608,308759561,218558604}, {308759561,218558604,308757031,218568800}, {309668335,218567371,309781789,218643290}, 
+    {308757031,218568800,308754696,218579196}, {308754696,218579196,308752556,218589791}, {319038819,218586821,319006417,218633017}, 
+    {308752556,218589791,308750612,218600584}, {308750612,218600584,308748865,218611575}, {308748865,218611575,308747317,218622763}, 
+    {308747317,218622763,308745969,218634147}, {317448860,218630629,317166610,218822518}, {319006417,218633017,318972463,218679655}, 
+    {308745969,218634147,308744822,218645726}, {309781789,218643290,310005579,218800428}, {308744822,218645726,308743876,218657500}, 
+    {308743876,218657500,308743133,218669467}, {308743133,218669467,308742261,218693981}, {318972463,218679655,318899966,218774040}, 
+    {308742261,218693981,308742213,218719261}, {308742213,218719261,308742999,218745300}, {308742999,218745300,308744627,218772094}, 
+    {308744627,218772094,308747106,218799635}, {318899966,218774040,318821469,218869547}, {308747106,218799635,308750445,218827918}, 
+    {310005579,218800428,310443074,219127224}, {317166610,218822518,316878524,219009207}, {308750445,218827918,308754652,218856936}, 
+    {308754652,218856936,308759736,218886684}, {318821469,218869547,318737114,218965746}, {308759736,218886684,308765706,218917156}, 
+    {308765706,218917156,308772570,218948344}, {308772570,218948344,308780338,218980244}, {318737114,218965746,318647040,219062208}, 
+    {308780338,218980244,308789017,219012850}, {316878524,219009207,316584893,219189470}, {308789017,219012850,308798617,219046154}, 
+    {308798617,219046154,308809147,219080151}, {318647040,219062208,318578445,219135598}, {308809147,219080151,308820615,219114835}, 
+    {308820615,219114835,308833030,219150200}, {310443074,219127224,310871668,219454188}, {318578445,219135598,318515230,219207665}, 
+    {308833030,219150200,308846400,219186240}, {308846400,219186240,308894435,219307815}, {316584893,219189470,316286006,219362079}, 
+    {318515230,219207665,318456921,219278824}, {318456921,219278824,318429458,219314193}, {308894435,219307815,308946639,219431996}, 
+    {318429458,219314193,318403044,219349490}, {318403044,219349490,318377620,219384767}, {316286006,219362079,315982156,219525809}, 
+    {318377620,219384767,318353127,219420077}, {318353127,219420077,318329506,219455470}, {308946639,219431996,309061859,219687927}, 
+    {310871668,219454188,311084332,219611536}, {318329506,219455470,318306696,219490999}, {318306696,219490999,318263278,219562672}, 
+    {315982156,219525809,315673632,219679432}, {318263278,219562672,318222399,219635511}, {311084332,219611536,311296816,219761488}, 
+    {318222399,219635511,318183586,219709930}, {315673632,219679432,315517708,219752070}, {309061859,219687927,309323690,220228345}, 
+    {318183586,219709930,318146366,219786344}, {315517708,219752070,315360725,219821722}, {311296816,219761488,311403204,219832916}, 
+    {318146366,219786344,318110266,219865167}, {315360725,219821722,315202719,219888234}, {311403204,219832916,311509803,219901566}, 
+    {318110266,219865167,318074812,219946815}, {315202719,219888234,315043726,219951452}, {311509803,219901566,311616698,219967127}, 
+    {318074812,219946815,318003949,220120242}, {315043726,219951452,314883782,220011224}, {311616698,219967127,311723974,220029290}, 
+    {314883782,220011224,314722924,220067395}, {311723974,220029290,311831717,220087744}, {314722924,220067395,314561189,220119813}, 
+    {311831717,220087744,311940012,220142181}, {314561189,220119813,314398612,220168325}, {318003949,220120242,317929992,220309944}, 
+    {311940012,220142181,311994393,220167795}, {311994393,220167795,312048944,220192289}, {314398612,220168325,314235230,220212777}, 
+    {312048944,220192289,312103675,220215624}, {314235230,220212777,314071079,220253015}, {312103675,220215624,312158598,220237760}, 
+    {309323690,220228345,309604796,220803552}, {312158598,220237760,312213723,220258659}, {314071079,220253015,313906196,220288886}, 
+    {312213723,220258659,312269060,220278283}, {312269060,220278283,312324620,220296592}, {313906196,220288886,313740616,220320238}, 
+    {312324620,220296592,312380414,220313548}, {317929992,220309944,317757647,220751442}, {312380414,220313548,312436453,220329113}, 
+    {313740616,220320238,313574377,220346916}, {312436453,220329113,312492747,220343246}, {312492747,220343246,312549307,220355910}, 
+    {313574377,220346916,313407515,220368767}, {312549307,220355910,312606143,220367066}, {312606143,220367066,312663266,220376676}, 
+    {313407515,220368767,313240065,220385638}, {312663266,220376676,312720687,220384700}, {312720687,220384700,312778417,220391099}, 
+    {313240065,220385638,313072064,220397376}, {312778417,220391099,312836465,220395835}, {312836465,220395835,312894844,220398870}, 
+    {313072064,220397376,313012632,220399679}, {312894844,220398870,312953563,220400164}, {313012632,220399679,312953563,220400164}, 
+    {317757647,220751442,317651686,221009875}, {309604796,220803552,309744110,221102970}, {317651686,221009875,317527485,221297853}, 
+    {309744110,221102970,309878080,221409608}, {317527485,221297853,317381257,221618695}, {309878080,221409608,309942003,221565480}, 
+    {309942003,221565480,310003320,221722972}, {317381257,221618695,317209215,221975719}, {310003320,221722972,310061608,221882023}, 
+    {310061608,221882023,310116444,222042571}, {317209215,221975719,317007573,222372243}, {310116444,222042571,310167403,222204554}, 
+    {310167403,222204554,310214063,222367910}, {310214063,222367910,310255999,222532579}, {317007573,222372243,316772544,222811584}, 
+    {310255999,222532579,310292790,222698499}, {310292790,222698499,310309123,222781909}, {310309123,222781909,310324011,222865608}, 
+    {316772544,222811584,316757356,222838621}, {316757356,222838621,316741530,222865454}, {316741530,222865454,316725078,222892089}, 
+    {310324011,222865608,310337400,222949589}, {316725078,222892089,316708011,222918527}, {316708011,222918527,316690340,222944772}, 
+    {316690340,222944772,316672077,222970829}, {310337400,222949589,310349239,223033844}, {316672077,222970829,316653234,222996700}, 
+    {316653234,222996700,316633821,223022390}, {316633821,223022390,316593334,223073237}, {310349239,223033844,310359473,223118365}, 
+    {316593334,223073237,316550708,223123399}, {310359473,223118365,310368050,223203146}, {316550708,223123399,316506035,223172905}, 
+    {316506035,223172905,316459406,223221781}, {310368050,223203146,310374917,223288177}, {316459406,223221781,316410914,223270058}, 
+    {316410914,223270058,316360650,223317763}, {310374917,223288177,310380021,223373452}, {316360650,223317763,316308705,223364924}, 
+    {316308705,223364924,316255172,223411569}, {310380021,223373452,310383310,223458962}, {316255172,223411569,316143707,223503427}, 
+    {310383310,223458962,310384729,223544701}, {316143707,223503427,316026990,223593563}, {310384729,223544701,310384227,223630660}, 
+    {316026990,223593563,315905754,223682203}, {310384227,223630660,310381751,223716831}, {315905754,223682203,315780732,223769573}, 
+    {310381751,223716831,310377247,223803207}, {315780732,223769573,315522271,223941409}, {310377247,223803207,310370662,223889780}, 
+    {310370662,223889780,310361944,223976543}, {315522271,223941409,314992224,224279800}, {310361944,223976543,310351040,224063488}, 
+    {310351040,224063488,309037632,233577536}, {314992224,224279800,314732383,224449975}, {314732383,224449975,314606326,224536099}, 
+    {314606326,224536099,314483825,224623216}, {314483825,224623216,314365613,224711552}, {314365613,224711552,314252424,224801333}, 
+    {314252424,224801333,314197942,224846837}, {314197942,224846837,314144991,224892786}, {314144991,224892786,314093663,224939210}, 
+    {314093663,224939210,314044050,224986137}, {314044050,224986137,313996243,225033595}, {313996243,225033595,313950334,225081612}, 
+    {313950334,225081612,313906414,225130217}, {313906414,225130217,313864576,225179437}, {313864576,225179437,313824911,225229302}, 
+    {313824911,225229302,313805922,225254485}, {313805922,225254485,313787511,225279839}, {313787511,225279839,313769690,225305369}, 
+    {313769690,225305369,313752468,225331077}, {313752468,225331077,313735859,225356967}, {313735859,225356967,313719874,225383044}, 
+    {313719874,225383044,313704523,225409309}, {313704523,225409309,313689819,225435768}, {313689819,225435768,313675773,225462423}, 
+    {313675773,225462423,313662397,225489277}, {313662397,225489277,313649701,225516336}, {313649701,225516336,313637698,225543601}, 
+    {313637698,225543601,313626399,225571077}, {313626399,225571077,313615815,225598767}, {313615815,225598767,313605958,225626674}, 
+    {313605958,225626674,313596839,225654803}, {313596839,225654803,313588470,225683156}, {313588470,225683156,313580862,225711737}, 
+    {313580862,225711737,313574027,225740551}, {313574027,225740551,313567976,225769599}, {313567976,225769599,313562720,225798886}, 
+    {313562720,225798886,313558272,225828416}, {313558272,225828416,312453504,233925056}, {309037632,233577536,309032626,233618384}, 
+    {309032626,233618384,309028941,233658714}, {309028941,233658714,309026558,233698525}, {309026558,233698525,309025457,233737815}, 
+    {309025457,233737815,309025618,233776581}, {309025618,233776581,309027022,233814822}, {309027022,233814822,309029649,233852535}, 
+    {309029649,233852535,309033479,233889719}, {309033479,233889719,309038494,233926372}, {312453504,233925056,312447323,233965747}, 
+    {309038494,233926372,309044674,233962491}, {309044674,233962491,309051998,233998075}, {312447323,233965747,312439996,234005671}, 
+    {309051998,233998075,309060448,234033122}, {312439996,234005671,312431544,234044830}, {309060448,234033122,309070003,234067630}, 
+    {312431544,234044830,312421987,234083227}, {309070003,234067630,309080645,234101596}, {312421987,234083227,312411343,234120863}, 
+    {309080645,234101596,309092354,234135019}, {312411343,234120863,312399633,234157740}, {309092354,234135019,309105109,234167897}, 
+    {312399633,234157740,312386875,234193861}, {309105109,234167897,309118892,234200228}, {312386875,234193861,312373090,234229227}, 
+    {309118892,234200228,309133683,234232010}, {312373090,234229227,312358298,234263840}, {309133683,234232010,309149463,234263241}, 
+    {309149463,234263241,309166211,234293918}, {312358298,234263840,312342516,234297702}, {309166211,234293918,309183908,234324041}, 
+    {312342516,234297702,312325766,234330816}, {309183908,234324041,309202536,234353607}, {312325766,234330816,312308067,234363183}, 
+    {309202536,234353607,309222073,234382613}, {312308067,234363183,312289438,234394805}, {309222073,234382613,309242501,234411059}, 
+    {312289438,234394805,312269900,234425684}, {309242501,234411059,309263799,234438941}, {312269900,234425684,312249470,234455822}, 
+    {309263799,234438941,309285949,234466259}, {312249470,234455822,312228170,234485222}, {309285949,234466259,309308931,234493010}, 
+    {312228170,234485222,312206018,234513884}, {309308931,234493010,309332725,234519192}, {312206018,234513884,312183035,234541812}, 
+    {309332725,234519192,309357312,234544803}, {312183035,234541812,312159239,234569006}, {309357312,234544803,309382672,234569841}, 
+    {312159239,234569006,312134651,234595469}, {309382672,234569841,309408786,234594304}, {309408786,234594304,309435633,234618191}, 
+    {312134651,234595469,312109290,234621204}, {309435633,234618191,309463195,234641499}, {312109290,234621204,312083175,234646211}, 
+    {309463195,234641499,309491451,234664226}, {312083175,234646211,312056326,234670494}, {309491451,234664226,309520383,234686370}, 
+    {312056326,234670494,312028763,234694053}, {309520383,234686370,309549971,234707930}, {312028763,234694053,312000505,234716891}, 
+    {309549971,234707930,309580194,234728903}, {312000505,234716891,311971572,234739010}, {309580194,234728903,309611034,234749287}, 
+    {311971572,234739010,311941984,234760412}, {309611034,234749287,309642471,234769081}, {311941984,234760412,311911759,234781099}, 
+    {309642471,234769081,309674486,234788282}, {311911759,234781099,311880918,234801072}, {309674486,234788282,309707058,234806888}, 
+    {311880918,234801072,311849480,234820334}, {309707058,234806888,309740169,234824898}, {311849480,234820334,311817464,234838887}, 
+    {309740169,234824898,309773798,234842310}, {311817464,234838887,311784891,234856733}, {309773798,234842310,309807926,234859120}, 
+    {311784891,234856733,311751780,234873873}, {309807926,234859120,309842534,234875329}, {311751780,234873873,311718150,234890310}, 
+    {309842534,234875329,309877601,234890933}, {311718150,234890310,311684020,234906046}, {309877601,234890933,309913109,234905930}, 
+    {309913109,234905930,309949038,234920319}, {311684020,234906046,311649412,234921083}, {309949038,234920319,309985369,234934098}, 
+    {311649412,234921083,311614343,234935422}, {309985369,234934098,310022080,234947264}, {311614343,234935422,311578834,234949065}, 
+    {310022080,234947264,310059154,234959816}, {311578834,234949065,311542905,234962015}, {310059154,234959816,310096571,234971751}, 
+    {311542905,234962015,311506574,234974274}, {310096571,234971751,310172353,234993765}, {311506574,234974274,311469861,234985843}, 
+    {311469861,234985843,311432787,234996725}, {310172353,234993765,310249270,235013291}, {311432787,234996725,311395370,235006921}, 
+    {311395370,235006921,311357630,235016433}, {310249270,235013291,310327166,235030311}, {311357630,235016433,311319587,235025265}, 
+    {311319587,235025265,311281260,235033416}, {310327166,235030311,310405884,235044810}, {311281260,235033416,311242668,235040890}, 
+    {311242668,235040890,311203833,235047688}, {310405884,235044810,310485268,235056773}, {311203833,235047688,311164772,235053812}, 
+    {311164772,235053812,311125505,235059265}, {310485268,235056773,310565160,235066184}, {311125505,235059265,311046434,235068164}, 
+    {310565160,235066184,310645405,235073027}, {311046434,235068164,310966776,235074399}, {310645405,235073027,310725845,235077285}, 
+    {310966776,235074399,310886688,235077987}, {310725845,235077285,310806325,235078944}, {310886688,235077987,310806325,235078944}, 
+};
+
+const Segment SEGMENTS_RIGHT_ARM_OUTER[] = {
+    {332281353,216958045,332293858,216958217}, {332281353,216958045,332268616,216958288}, {332293858,216958217,332306130,216958798}, 
+    {332268616,216958288,332255650,216958950}, {332306130,216958798,332312178,216959241}, {332255650,216958950,332242454,216960036}, 
+    {332312178,216959241,332318168,216959784}, {332318168,216959784,332324099,216960427}, {332242454,216960036,332229031,216961550}, 
+    {332324099,216960427,332329971,216961170}, {332329971,216961170,332335784,216962012}, {332229031,216961550,332215382,216963497}, 
+    {332335784,216962012,332341538,216962952}, {332341538,216962952,332347232,216963989}, {332215382,216963497,332201507,216965882}, 
+    {332347232,216963989,332352866,216965124}, {332352866,216965124,332358441,216966355}, {332201507,216965882,332187409,216968709}, 
+    {332358441,216966355,332363956,216967683}, {332363956,216967683,332369411,216969105}, {332187409,216968709,332173088,216971984}, 
+    {332369411,216969105,332374805,216970622}, {332374805,216970622,332380139,216972234}, {332173088,216971984,332158546,216975711}, 
+    {332380139,216972234,332385413,216973939}, {332385413,216973939,332390626,216975737}, {332158546,216975711,332143783,216979895}, 
+    {332390626,216975737,332395778,216977627}, {332395778,216977627,332400868,216979610}, {332400868,216979610,332405898,216981683}, 
+    {332143783,216979895,332128802,216984540}, {332405898,216981683,332410867,216983847}, {332410867,216983847,332415773,216986101}, 
+    {332128802,216984540,332113604,216989651}, {332415773,216986101,332420619,216988445}, {332420619,216988445,332425402,216990877}, 
+    {332113604,216989651,332098189,216995232}, {332425402,216990877,332430123,216993398}, {332430123,216993398,332434782,216996006}, 
+    {332098189,216995232,332082559,217001290}, {332434782,216996006,332439379,216998702}, {332439379,216998702,332443914,217001484}, 
+    {332082559,217001290,332066716,217007827}, {332443914,217001484,332448386,217004352}, {332448386,217004352,332452795,217007305}, 
+    {332452795,217007305,332457141,217010343}, {332066716,217007827,332050660,217014850}, {332457141,217010343,332461424,217013465}, 
+    {332461424,217013465,332465643,217016671}, {332050660,217014850,332034393,217022362}, {332465643,217016671,332469800,217019959}, 
+    {332469800,217019959,332473892,217023330}, {332034393,217022362,332017916,217030368}, {332473892,217023330,332477921,217026783}, 
+    {332477921,217026783,332481887,217030317}, {332481887,217030317,332485788,217033932}, {332017916,217030368,332001231,217038874}, 
+    {332485788,217033932,332489625,217037627}, {332489625,217037627,332493397,217041401}, {321863615,217038268,321876993,217038491}, 
+    {321863615,217038268,321850330,217038387}, {321850330,217038387,321837148,217038853}, {321876993,217038491,321890457,217039050}, 
+    {321837148,217038853,321824077,217039673}, {332001231,217038874,331984338,217047883}, {321890457,217039050,321903998,217039938}, 
+    {321824077,217039673,321811126,217040855}, {321903998,217039938,321917607,217041149}, {321811126,217040855,321798302,217042402}, 
+    {321917607,217041149,321931276,217042676}, {332493397,217041401,332497105,217045254}, {321798302,217042402,321785615,217044324}, 
+    {321931276,217042676,321944997,217044513}, {321785615,217044324,321773072,217046624}, {321944997,217044513,321958761,217046654}, 
+    {332497105,217045254,332500748,217049185}, {321773072,217046624,321760683,217049310}, {321958761,217046654,321972560,217049093}, 
+    {331984338,217047883,331967240,217057401}, {321972560,217049093,321986384,217051824}, {332500748,217049185,332504327,217053194}, 
+    {321760683,217049310,321748456,217052388}, {321986384,217051824,322000226,217054839}, {321748456,217052388,321736399,217055865}, 
+    {332504327,217053194,332507840,217057280}, {322000226,217054839,322014078,217058133}, {321736399,217055865,321730437,217057754}, 
+    {332507840,217057280,332511288,217061443}, {331967240,217057401,331949936,217067432}, {321730437,217057754,321724520,217059746}, 
+    {322014078,217058133,322027929,217061700}, {321724520,217059746,321718651,217061840}, {332511288,217061443,332514671,217065682}, 
+    {322027929,217061700,322041773,217065533}, {321718651,217061840,321712829,217064037}, {321712829,217064037,321707057,217066339}, 
+    {322041773,217065533,322069404,217073973}, {332514671,217065682,332517989,217069995}, {321707057,217066339,321701334,217068746}, 
+    {331949936,217067432,331914720,217089053}, {321701334,217068746,321695663,217071259}, {332517989,217069995,332521241,217074384}, 
+    {321695663,217071259,321690043,217073879}, {321690043,217073879,321684477,217076605}, {322069404,217073973,322096901,217083402}, 
+    {332521241,217074384,332524427,217078847}, {321684477,217076605,321678965,217079441}, {332524427,217078847,332527547,217083383}, 
+    {321678965,217079441,321673509,217082385}, {321673509,217082385,321668108,217085439}, {332527547,217083383,332533588,217092674}, 
+    {322096901,217083402,322124197,217093770}, {321668108,217085439,321662766,217088603}, {321662766,217088603,321657481,217091879}, 
+    {331914720,217089053,331878700,217112782}, {321657481,217091879,321652257,217095267}, {332533588,217092674,332539364,217102252}, 
+    {322124197,217093770,322151223,217105027}, {321652257,217095267,321647092,217098768}, {321647092,217098768,321641990,217102382}, 
+    {332539364,217102252,332544873,217112113}, {321641990,217102382,321636950,217106111}, {322151223,217105027,322177913,217117122}, 
+    {321636950,217106111,321631974,217109956}, {321631974,217109956,321627063,217113916}, {332544873,217112113,332550114,217122251}, 
+    {331878700,217112782,331841886,217138659}, {321627063,217113916,321622218,217117993}, {322177913,217117122,322204198,217130006}, 
+    {321622218,217117993,321617440,217122188}, {321617440,217122188,321612729,217126502}, {332550114,217122251,332555085,217132662}, 
+    {321612729,217126502,321608088,217130934}, {322204198,217130006,322230010,217143628}, {321608088,217130934,321603517,217135487}, 
+    {332555085,217132662,332559785,217143342}, {321603517,217135487,321599018,217140160}, {331841886,217138659,331804288,217166720}, 
+    {321599018,217140160,321594590,217144955}, {332559785,217143342,332564213,217154286}, {322230010,217143628,322255282,217157937}, 
+    {321594590,217144955,321590236,217149872}, {321590236,217149872,321585957,217154913}, {332564213,217154286,332568368,217165488}, 
+    {321585957,217154913,321581752,217160077}, {322255282,217157937,322279945,217172884}, {321581752,217160077,321577625,217165366}, 
+    {321577625,217165366,321573575,217170781}, {332568368,217165488,332572248,217176945}, {331804288,217166720,330574391,218103401}, 
+    {321573575,217170781,321569603,217176322}, {322279945,217172884,322303932,217188418}, {321569603,217176322,321565711,217181990}, 
+    {332572248,217176945,332575853,217188651}, {321565711,217181990,321561900,217187786}, {321561900,217187786,321558171,217193710}, 
+    {322303932,217188418,322327174,217204488}, {332575853,217188651,332579180,217200602}, {321558171,217193710,321554525,217199764}, 
+    {321554525,217199764,321550962,217205948}, {332579180,217200602,332582229,217212793}, {322327174,217204488,322349604,217221045}, 
+    {321550962,217205948,321547485,217212263}, {321547485,217212263,321544094,217218710}, {332582229,217212793,332584998,217225219}, 
+    {321544094,217218710,321540790,217225290}, {322349604,217221045,322371154,217238038}, {332584998,217225219,332587486,217237876}, 
+    {321540790,217225290,321537574,217232002}, {321537574,217232002,321534447,217238849}, {332587486,217237876,332589692,217250759}, 
+    {322371154,217238038,322391757,217255417}, {321534447,217238849,321531411,217245831}, {321531411,217245831,321528466,217252949}, 
+    {332589692,217250759,332591614,217263863}, {321528466,217252949,321525613,217260203}, {322391757,217255417,322401681,217264236}, 
+    {321525613,217260203,321520189,217275124}, {332591614,217263863,332593251,217277184}, {322401681,217264236,322411343,217273132}, 
+    {322411343,217273132,322420734,217282099}, {321520189,217275124,321515148,217290600}, {332593251,217277184,332594603,217290717}, 
+    {322420734,217282099,322429846,217291132}, {321515148,217290600,321510498,217306638}, {332594603,217290717,332595667,217304457}, 
+    {322429846,217291132,322438670,217300223}, {322438670,217300223,322447197,217309366}, {332595667,217304457,332596443,217318399}, 
+    {321510498,217306638,321506247,217323245}, {322447197,217309366,322455420,217318556}, {332596443,217318399,332596929,217332539}, 
+    {322455420,217318556,322463329,217327786}, {321506247,217323245,321502404,217340425}, {322463329,217327786,322470916,217337049}, 
+    {332596929,217332539,332597123,217346872}, {322470916,217337049,322478174,217346340}, {321502404,217340425,321498978,217358186}, 
+    {322478174,217346340,322485092,217355651}, {332597123,217346872,332597026,217361394}, {322485092,217355651,322491663,217364977}, 
+    {321498978,217358186,321495976,217376534}, {332597026,217361394,332596634,217376099}, {322491663,217364977,322497878,217374312}, 
+    {322497878,217374312,322503729,217383649}, {332596634,217376099,332595948,217390983}, {321495976,217376534,321493408,217395475}, 
+    {322503729,217383649,322509207,217392982}, {332595948,217390983,332594965,217406041}, {322509207,217392982,322514304,217402304}, 
+    {321493408,217395475,321491282,217415016}, {322514304,217402304,322541832,217453098}, {332594965,217406041,332593685,217421268}, 
+    {321491282,217415016,321489606,217435162}, {332593685,217421268,332592107,217436660}, {321489606,217435162,321488389,217455920}, 
+    {332592107,217436660,332590228,217452213}, {332590228,217452213,332588048,217467921}, {322541832,217453098,322571044,217504155}, 
+    {321488389,217455920,321487639,217477297}, {332588048,217467921,332582779,217499783}, {321487639,217477297,321487365,217499298}, 
+    {321487365,217499298,321487575,217521930}, {332582779,217499783,332576290,217532211}, {322571044,217504155,322601911,217555441}, 
+    {321487575,217521930,321488278,217545200}, {332576290,217532211,332568570,217565165}, {321488278,217545200,321489482,217569113}, 
+    {322601911,217555441,322634405,217606922}, {332568570,217565165,332559609,217598610}, {321489482,217569113,321491196,217593675}, 
+    {321491196,217593675,321493428,217618894}, {332559609,217598610,332549398,217632506}, {322634405,217606922,322668497,217658564}, 
+    {321493428,217618894,321499481,217671324}, {332549398,217632506,332537926,217666816}, {322668497,217658564,322704158,217710334}, 
+    {332537926,217666816,332525182,217701503}, {321499481,217671324,321507709,217726455}, {332525182,217701503,332511157,217736529}, 
+    {322704158,217710334,322741360,217762199}, {321507709,217726455,321518180,217784335}, {332511157,217736529,332495841,217771857}, 
+    {322741360,217762199,322780073,217814124}, {332495841,217771857,332479223,217807447}, {321518180,217784335,321530961,217845015}, 
+    {332479223,217807447,332461294,217843264}, {322780073,217814124,322820269,217866076}, {332461294,217843264,332442042,217879269}, 
+    {321530961,217845015,321546120,217908546}, {322820269,217866076,322861919,217918022}, {332442042,217879269,332421459,217915424}, 
+    {321546120,217908546,321563725,217974978}, {332421459,217915424,332399533,217951693}, {322861919,217918022,322949466,218021759}, 
+    {332399533,217951693,332376255,217988036}, {321563725,217974978,321583845,218044361}, {332376255,217988036,332351614,218024417}, 
+    {322949466,218021759,323042483,218125065}, {332351614,218024417,332325600,218060798}, {321583845,218044361,321606547,218116746}, 
+    {332325600,218060798,332298204,218097142}, {332298204,218097142,332269415,218133409}, {330574391,218103401,330260729,218328873}, 
+    {321606547,218116746,321631899,218192182}, {323042483,218125065,323140742,218227673}, {332269415,218133409,332239222,218169564}, 
+    {332239222,218169564,332207616,218205568}, {321631899,218192182,321659968,218270720}, {332207616,218205568,332169675,218248940}, 
+    {323140742,218227673,323244011,218329312}, {332169675,218248940,332131976,218294412}, {321659968,218270720,321688609,218351249}, 
+    {332131976,218294412,332094515,218341911}, {330260729,218328873,329943602,218546329}, {323244011,218329312,323352061,218429715}, 
+    {332094515,218341911,332057288,218391364}, {321688609,218351249,321716482,218434904}, {332057288,218391364,332020290,218442698}, 
+    {323352061,218429715,323464660,218528611}, {321716482,218434904,321743572,218521579}, {332020290,218442698,331983517,218495840}, 
+    {331983517,218495840,331910626,218607255}, {321743572,218521579,321769864,218611168}, {323464660,218528611,323581580,218625731}, 
+    {329943602,218546329,329622513,218753501}, {331910626,218607255,331838581,218725022}, {321769864,218611168,321819991,218798662}, 
+    {323581580,218625731,323702590,218720808}, {323702590,218720808,323827459,218813571}, {331838581,218725022,331767345,218848556}, 
+    {329622513,218753501,329460329,218852521}, {321819991,218798662,321866737,218996533}, {323827459,218813571,323955958,218903751}, 
+    {331767345,218848556,331696883,218977273}, {329460329,218852521,329296968,218948120}, {323955958,218903751,324087856,218991080}, 
+    {329296968,218948120,329132369,219040014}, {331696883,218977273,331627160,219110586}, {324087856,218991080,324222923,219075288}, 
+    {321866737,218996533,321909977,219203932}, {329132369,219040014,328966470,219127919}, {324222923,219075288,324360929,219156107}, 
+    {331627160,219110586,331489786,219388660}, {328966470,219127919,328799210,219211551}, {324360929,219156107,324501644,219233267}, 
+    {321909977,219203932,321949588,219420007}, {328799210,219211551,328630525,219290628}, {324501644,219233267,324644838,219306500}, 
+    {328630525,219290628,328460354,219364866}, {324644838,219306500,324790280,219375535}, {328460354,219364866,328288636,219433980}, 
+    {324790280,219375535,324937740,219440105}, {331489786,219388660,331354938,219678096}, {321949588,219420007,321985444,219643906}, 
+    {328288636,219433980,328115308,219497689}, {324937740,219440105,325086988,219499940}, {328115308,219497689,327940309,219555707}, 
+    {325086988,219499940,325237794,219554771}, {325237794,219554771,325389928,219604329}, {327940309,219555707,327763576,219607752}, 
+    {325389928,219604329,325466421,219627047}, {327763576,219607752,327674540,219631446}, {325466421,219627047,325543159,219648345}, 
+    {327674540,219631446,327585048,219653540}, {321985444,219643906,322017421,219874779}, {325543159,219648345,325620114,219668191}, 
+    {327585048,219653540,327495091,219673999}, {325620114,219668191,325697258,219686550}, {327495091,219673999,327404662,219692787}, 
+    {331354938,219678096,331091680,220272320}, {325697258,219686550,325774560,219703389}, {327404662,219692787,327313753,219709869}, 
+    {325774560,219703389,325851993,219718675}, {327313753,219709869,327222357,219725210}, {325851993,219718675,325929528,219732373}, 
+    {327222357,219725210,327130465,219738774}, {325929528,219732373,326007136,219744451}, {327130465,219738774,327038070,219750526}, 
+    {326007136,219744451,326084788,219754873}, {327038070,219750526,326945165,219760430}, {326084788,219754873,326162455,219763608}, 
+    {326945165,219760430,326851741,219768451}, {326162455,219763608,326240110,219770621}, {326851741,219768451,326757790,219774553}, 
+    {326240110,219770621,326317721,219775878}, {326757790,219774553,326663306,219778700}, {326317721,219775878,326395263,219779346}, 
+    {326663306,219778700,326568280,219780859}, {326395263,219779346,326472704,219780992}, {326568280,219780859,326472704,219780992}, 
+    {322017421,219874779,322045394,220111775}, {322045394,220111775,322069239,220354041}, {331091680,220272320,330835106,220855792}, 
+    {322069239,220354041,322088831,220600729}, {322088831,220600729,322104045,220850985}, {322104045,220850985,322114757,221103960}, 
+    {330835106,220855792,330708613,221131788}, {322114757,221103960,322120842,221358801}, {330708613,221131788,330582936,221391046}, 
+    {322120842,221358801,322122175,221614658}, {330582936,221391046,330520314,221512935}, {330520314,221512935,330457790,221628884}, 
+    {322122175,221614658,322118632,221870680}, {330457790,221628884,330395327,221738306}, {330395327,221738306,330332890,221840617}, 
+    {330332890,221840617,330301670,221888923}, {322118632,221870680,322110088,222126015}, {330301670,221888923,330270443,221935232}, 
+    {330270443,221935232,330239205,221979470}, {330239205,221979470,330207951,222021564}, {330207951,222021564,330176677,222061441}, 
+    {330176677,222061441,330145378,222099028}, {330145378,222099028,330114050,222134252}, {322110088,222126015,322096419,222379813}, 
+    {330114050,222134252,330098373,222150955}, {330098373,222150955,330082688,222167040}, {330082688,222167040,330002269,222246268}, 
+    {330002269,222246268,329922645,222321511}, {329922645,222321511,329843800,222392900}, {322096419,222379813,322077500,222631222}, 
+    {329843800,222392900,329765715,222460565}, {329765715,222460565,329688371,222524639}, {329688371,222524639,329611753,222585250}, 
+    {329611753,222585250,329535840,222642532}, {322077500,222631222,322053206,222879392}, {329535840,222642532,329460616,222696613}, 
+    {329460616,222696613,329386063,222747625}, {329386063,222747625,329312163,222795700}, {329312163,222795700,329238897,222840967}, 
+    {329238897,222840967,329166249,222883558}, {322053206,222879392,322023413,223123470}, {329166249,222883558,329094200,222923604}, 
+    {329094200,222923604,329022733,222961235}, {329022733,222961235,328951828,222996582}, {328951828,222996582,328881470,223029776}, 
+    {328881470,223029776,328811639,223060948}, {328811639,223060948,328742318,223090229}, {328742318,223090229,328673490,223117750}, 
+    {328673490,223117750,328605135,223143642}, {322023413,223123470,321987996,223362607}, {328605135,223143642,328469777,223191060}, 
+    {328469777,223191060,328336101,223233531}, {328336101,223233531,328203964,223272102}, {328203964,223272102,328073224,223307819}, 
+    {328073224,223307819,327815360,223374880}, {321987996,223362607,321946830,223595950}, {327815360,223374880,327561366,223443090}, 
+    {327561366,223443090,327435463,223480244}, {327435463,223480244,327310099,223520825}, {327310099,223520825,327247574,223542728}, 
+    {327247574,223542728,327185131,223565881}, {327185131,223565881,327122750,223590414}, {327122750,223590414,327060415,223616459}, 
+    {321946830,223595950,321899791,223822649}, {327060415,223616459,326998107,223644146}, {326998107,223644146,326935809,223673606}, 
+    {326935809,223673606,326873503,223704970}, {326873503,223704970,326811170,223738368}, {326811170,223738368,326748793,223773932}, 
+    {326748793,223773932,326686355,223811793}, {326686355,223811793,326623837,223852081}, {321899791,223822649,321846754,224041853}, 
+    {326623837,223852081,326561221,223894927}, {326561221,223894927,326498489,223940462}, {326498489,223940462,326435625,223988817}, 
+    {326435625,223988817,326372609,224040123}, {326372609,224040123,326309424,224094511}, {321846754,224041853,321817948,224148378}, 
+    {326309424,224094511,326246052,224152111}, {321817948,224148378,321787595,224252710}, {326246052,224152111,326182475,224213055}, 
+    {326182475,224213055,326118675,224277473}, {321787595,224252710,321755680,224354742}, {326118675,224277473,326054635,224345496}, 
+    {326054635,224345496,325990337,224417255}, {321755680,224354742,321722188,224454369}, {325990337,224417255,325925762,224492880}, 
+    {321722188,224454369,321687104,224551484}, {325925762,224492880,325860893,224572504}, {321687104,224551484,321650410,224645980}, 
+    {325860893,224572504,325795712,224656256}, {321650410,224645980,321612093,224737751}, {325795712,224656256,315754560,237848512}, 
+    {321612093,224737751,321572136,224826690}, {321572136,224826690,321530524,224912692}, {321530524,224912692,321487240,224995650}, 
+    {321487240,224995650,321442271,225075457}, {321442271,225075457,321419149,225114146}, {321419149,225114146,321395599,225152008}, 
+    {321395599,225152008,321371620,225189028}, {321371620,225189028,321347210,225225195}, {321347210,225225195,321322367,225260494}, 
+    {321322367,225260494,321297088,225294912}, {321297088,225294912,312797376,236619904}, {312797376,236619904,312771018,236655959}, 
+    {312771018,236655959,312746102,236691949}, {312746102,236691949,312722611,236727864}, {312722611,236727864,312700530,236763697}, 
+    {312700530,236763697,312679843,236799439}, {312679843,236799439,312660535,236835082}, {312660535,236835082,312642589,236870617}, 
+    {312642589,236870617,312625991,236906036}, {312625991,236906036,312610723,236941331}, {312610723,236941331,312596770,236976493}, 
+    {312596770,236976493,312584117,237011515}, {312584117,237011515,312572748,237046387}, {312572748,237046387,312562647,237081101}, 
+    {312562647,237081101,312553798,237115649}, {312553798,237115649,312546185,237150023}, {312546185,237150023,312539793,237184214}, 
+    {312539793,237184214,312534606,237218214}, {312534606,237218214,312530608,237252014}, {312530608,237252014,312527783,237285607}, 
+    {312527783,237285607,312526116,237318983}, {312526116,237318983,312525591,237352135}, {312525591,237352135,312526191,237385054}, 
+    {312526191,237385054,312527902,237417732}, {312527902,237417732,312530707,237450160}, {312530707,237450160,312534591,237482330}, 
+    {312534591,237482330,312539538,237514234}, {312539538,237514234,312545532,237545863}, {312545532,237545863,312552557,237577210}, 
+    {312552557,237577210,312560597,237608265}, {312560597,237608265,312569638,237639020}, {312569638,237639020,312579662,237669467}, 
+    {312579662,237669467,312590655,237699598}, {312590655,237699598,312602600,237729404}, {312602600,237729404,312615482,237758877}, 
+    {312615482,237758877,312629285,237788008}, {312629285,237788008,312643992,237816790}, {312643992,237816790,312659590,237845214}, 
+    {312659590,237845214,312676060,237873270}, {315754560,237848512,315724070,237887648}, {312676060,237873270,312693389,237900953}, 
+    {315724070,237887648,315693034,237925665}, {312693389,237900953,312711559,237928251}, {315693034,237925665,315661467,237962572}, 
+    {312711559,237928251,312730556,237955159}, {312730556,237955159,312750363,237981666}, {315661467,237962572,315629386,237998378}, 
+    {312750363,237981666,312770965,238007765}, {315629386,237998378,315596806,238033091}, {312770965,238007765,312792346,238033447}, 
+    {315596806,238033091,315563742,238066718}, {312792346,238033447,312814490,238058705}, {312814490,238058705,312837381,238083529}, 
+    {315563742,238066718,315530212,238099269}, {312837381,238083529,312861004,238107911}, {315530212,238099269,315496229,238130752}, 
+    {312861004,238107911,312885343,238131843}, {315496229,238130752,315461811,238161175}, {312885343,238131843,312910382,238155317}, 
+    {312910382,238155317,312936105,238178324}, {315461811,238161175,315426973,238190547}, {312936105,238178324,312962496,238200856}, 
+    {315426973,238190547,315391730,238218876}, {312962496,238200856,312989541,238222905}, {315391730,238218876,315356099,238246170}, 
+    {312989541,238222905,313017222,238244461}, {313017222,238244461,313045524,238265518}, {315356099,238246170,315320095,238272437}, 
+    {313045524,238265518,313074432,238286066}, {315320095,238272437,315283735,238297686}, {313074432,238286066,313103929,238306097}, 
+    {315283735,238297686,315247033,238321926}, {313103929,238306097,313134000,238325603}, {315247033,238321926,315210006,238345164}, 
+    {313134000,238325603,313164629,238344575}, {313164629,238344575,313195801,238363006}, {315210006,238345164,315172669,238367410}, 
+    {313195801,238363006,313227499,238380886}, {315172669,238367410,315135038,238388670}, {313227499,238380886,313259707,238398207}, 
+    {315135038,238388670,315097129,238408955}, {313259707,238398207,313292411,238414962}, {315097129,238408955,315058958,238428271}, 
+    {313292411,238414962,313325594,238431141}, {315058958,238428271,315020541,238446628}, {313325594,238431141,313359240,238446736}, 
+    {315020541,238446628,314981892,238464034}, {313359240,238446736,313393334,238461739}, {313393334,238461739,313427859,238476142}, 
+    {314981892,238464034,314943029,238480496}, {313427859,238476142,313462801,238489936}, {314943029,238480496,314903966,238496025}, 
+    {313462801,238489936,313498143,238503113}, {314903966,238496025,314864721,238510627}, {313498143,238503113,313533870,238515665}, 
+    {314864721,238510627,314825307,238524311}, {313533870,238515665,313569965,238527583}, {314825307,238524311,314785742,238537086}, 
+    {313569965,238527583,313606413,238538858}, {314785742,238537086,314746040,238548959}, {313606413,238538858,313643199,238549483}, 
+    {314746040,238548959,314706218,238559940}, {313643199,238549483,313680306,238559450}, {313680306,238559450,313717718,238568749}, 
+    {314706218,238559940,314666292,238570037}, {313717718,238568749,313755420,238577372}, {314666292,238570037,314626277,238579257}, 
+    {313755420,238577372,313793397,238585311}, {314626277,238579257,314586189,238587610}, {313793397,238585311,313831632,238592559}, 
+    {314586189,238587610,314546044,238595103}, {313831632,238592559,313870109,238599105}, {314546044,238595103,314505857,238601746}, 
+    {313870109,238599105,313908813,238604943}, {314505857,238601746,314465645,238607546}, {313908813,238604943,313947728,238610063}, 
+    {314465645,238607546,314425423,238612511}, {313947728,238610063,313986838,238614457}, {314425423,238612511,314385206,238616651}, 
+    {313986838,238614457,314026128,238618118}, {314385206,238616651,314345012,238619973}, {314026128,238618118,314065581,238621036}, 
+    {314345012,238619973,314304854,238622485}, {314065581,238621036,314105182,238623203}, {314304854,238622485,314264750,238624197}, 
+    {314105182,238623203,314144916,238624611}, {314264750,238624197,314224715,238625116}, {314144916,238624611,314184765,238625252}, 
+    {314224715,238625116,314184765,238625252}, 
+};
+
+const Segment SEGMENTS_RIGHT_CRUSH[] = {
+    {361671424,230203328,359252928,231588800}, {361671424,230203328,365066048,239375616}, {359252928,231588800,363563392,240326080}, 
+    {359326400,236838848,357631808,237996864}, {359326400,236838848,362885824,244393280}, {357631808,237996864,358919104,240660800}, 
+    {356356416,238869824,354749440,239991744}, {356356416,238869824,357608896,241586560}, {365066048,239375616,363563392,240326080}, 
+    {354749440,239991744,358344192,247563328}, {365355968,240584384,366110144,242186688}, {365355968,240584384,364129408,241343424}, 
+    {358919104,240660800,357608896,241586560}, {364129408,241343424,364954304,242950272}, {353498064,241500921,353570876,241501583}, 
+    {353498064,241500921,353422282,241502530}, {353570876,241501583,353606036,241502777}, {353422282,241502530,353343950,241506367}, 
+    {353606036,241502777,353640295,241504554}, {353640295,241504554,353673601,241506919}, {353343950,241506367,353263489,241512393}, 
+    {353673601,241506919,353705901,241509876}, {353705901,241509876,353737143,241513431}, {353263489,241512393,353181320,241520568}, 
+    {353737143,241513431,353767273,241517589}, {353767273,241517589,353796240,241522355}, {353181320,241520568,353097864,241530851}, 
+    {353796240,241522355,353823990,241527733}, {353823990,241527733,353850471,241533729}, {353097864,241530851,353013543,241543201}, 
+    {353850471,241533729,353863219,241536961}, {353863219,241536961,353875631,241540349}, {353875631,241540349,353887698,241543893}, 
+    {353013543,241543201,352928777,241557579}, {353887698,241543893,353899416,241547596}, {353899416,241547596,353910777,241551457}, 
+    {353910777,241551457,353921774,241555476}, {353921774,241555476,353932402,241559655}, {352928777,241557579,352843987,241573944}, 
+    {353932402,241559655,353942653,241563995}, {353942653,241563995,353952521,241568495}, {353952521,241568495,353961999,241573156}, 
+    {353961999,241573156,353971081,241577980}, {352843987,241573944,352759594,241592255}, {353971081,241577980,353979761,241582966}, 
+    {353979761,241582966,353983947,241585520}, {353983947,241585520,353988031,241588115}, {353988031,241588115,353992010,241590752}, 
+    {353992010,241590752,353995885,241593429}, {352759594,241592255,352676020,241612472}, {353995885,241593429,353999654,241596147}, 
+    {353999654,241596147,354003317,241598907}, {354003317,241598907,354006872,241601708}, {354006872,241601708,354010319,241604550}, 
+    {354010319,241604550,354013657,241607434}, {354013657,241607434,354016886,241610359}, {354016886,241610359,354020004,241613326}, 
+    {352676020,241612472,352593685,241634555}, {354020004,241613326,354023010,241616335}, {354023010,241616335,354025905,241619385}, 
+    {354025905,241619385,354028686,241622478}, {354028686,241622478,354031354,241625612}, {354031354,241625612,354033906,241628788}, 
+    {354033906,241628788,354036344,241632006}, {354036344,241632006,354038665,241635267}, {352593685,241634555,352513011,241658463}, 
+    {354038665,241635267,354040869,241638569}, {354040869,241638569,354042954,241641914}, {354042954,241641914,354044922,241645302}, 
+    {354044922,241645302,354046769,241648732}, {354046769,241648732,354048496,241652204}, {354048496,241652204,354050102,241655719}, 
+    {354050102,241655719,354051586,241659277}, {352513011,241658463,352434418,241684156}, {354051586,241659277,354052946,241662878}, 
+    {354052946,241662878,354054183,241666522}, {354054183,241666522,354055296,241670208}, {354055296,241670208,354042624,243108096}, 
+    {352434418,241684156,352358328,241711594}, {352358328,241711594,352285162,241740735}, {352285162,241740735,352249806,241755933}, 
+    {352249806,241755933,352215340,241771541}, {352215340,241771541,352181815,241787555}, {352181815,241787555,352149284,241803970}, 
+    {352149284,241803970,352117799,241820780}, {352117799,241820780,352087414,241837981}, {352087414,241837981,352058181,241855568}, 
+    {352058181,241855568,352030153,241873536}, {352030153,241873536,352003381,241891879}, {352003381,241891879,351977920,241910592}, 
+    {351977920,241910592,351915417,241959158}, {351915417,241959158,351853207,242009354}, {351853207,242009354,351791408,242061137}, 
+    {351791408,242061137,351730138,242114461}, {351730138,242114461,351669514,242169282}, {351669514,242169282,351609656,242225556}, 
+    {366110144,242186688,364954304,242950272}, {351609656,242225556,351550682,242283239}, {351550682,242283239,351492708,242342286}, 
+    {351492708,242342286,351435854,242402653}, {351435854,242402653,351380237,242464295}, {351380237,242464295,351325976,242527168}, 
+    {359795392,242501056,361243968,245568320}, {359795392,242501056,358520192,243391488}, {351325976,242527168,351273188,242591228}, 
+    {351273188,242591228,351221993,242656431}, {351221993,242656431,351172507,242722731}, {351172507,242722731,351124848,242790085}, 
+    {351124848,242790085,351079136,242858448}, {351079136,242858448,351035488,242927776}, {351035488,242927776,350994021,242998025}, 
+    {350994021,242998025,350954855,243069149}, {350954855,243069149,350918108,243141106}, {354042624,243108096,353985586,243118031}, 
+    {353985586,243118031,353925688,243127225}, {353925688,243127225,353798594,243144223}, {350918108,243141106,350883896,243213850}, 
+    {353798594,243144223,353524216,243178473}, {353524216,243178473,353382074,243199047}, {353382074,243199047,353310890,243210924}, 
+    {353310890,243210924,353240058,243224136}, {350883896,243213850,350867778,243250503}, {353240058,243224136,353169901,243238893}, 
+    {353169901,243238893,353100739,243255401}, {350867778,243250503,350852339,243287337}, {353100739,243255401,353032894,243273869}, 
+    {353032894,243273869,352999566,243283903}, {352999566,243283903,352966688,243294504}, {350852339,243287337,350837593,243324345}, 
+    {352966688,243294504,352934300,243305699}, {352934300,243305699,352902441,243317513}, {352902441,243317513,352871153,243329974}, 
+    {350837593,243324345,350823554,243361522}, {352871153,243329974,352840476,243343105}, {352840476,243343105,352810449,243356934}, 
+    {352810449,243356934,352781113,243371487}, {350823554,243361522,350810238,243398863}, {352781113,243371487,352752508,243386789}, 
+    {352752508,243386789,352724674,243402867}, {358520192,243391488,359969344,246494080}, {350810238,243398863,350797660,243436362}, 
+    {352724674,243402867,352711059,243411204}, {352711059,243411204,352697651,243419745}, {352697651,243419745,352684457,243428493}, 
+    {352684457,243428493,352671480,243437452}, {350797660,243436362,350785834,243474013}, {352671480,243437452,352658726,243446623}, 
+    {352658726,243446623,352646201,243456011}, {352646201,243456011,352633908,243465619}, {352633908,243465619,352621853,243475449}, 
+    {350785834,243474013,350774774,243511812}, {352621853,243475449,352610041,243485507}, {352610041,243485507,352598477,243495793}, 
+    {352598477,243495793,352587167,243506313}, {352587167,243506313,352576114,243517068}, {350774774,243511812,350764497,243549752}, 
+    {352576114,243517068,352565324,243528063}, {352565324,243528063,352554803,243539300}, {352554803,243539300,352544554,243550783}, 
+    {350764497,243549752,350755016,243587827}, {352544554,243550783,352534584,243562515}, {352534584,243562515,352524897,243574499}, 
+    {352524897,243574499,352515498,243586739}, {352515498,243586739,352506392,243599238}, {350755016,243587827,350746346,243626033}, 
+    {352506392,243599238,352497585,243611998}, {352497585,243611998,352489081,243625024}, {352489081,243625024,352480885,243638318}, 
+    {350746346,243626033,350738502,243664364}, {352480885,243638318,352473002,243651884}, {352473002,243651884,352465438,243665725}, 
+    {350738502,243664364,350731498,243702814}, {352465438,243665725,352458197,243679844}, {352458197,243679844,352451285,243694244}, 
+    {352451285,243694244,352444705,243708930}, {350731498,243702814,350725350,243741377}, {352444705,243708930,352438465,243723903}, 
+    {352438465,243723903,352432567,243739167}, {352432567,243739167,352427018,243754726}, {350725350,243741377,350720073,243780049}, 
+    {352427018,243754726,352421823,243770582}, {352421823,243770582,352416986,243786740}, {350720073,243780049,350715680,243818823}, 
+    {352416986,243786740,352412513,243803201}, {352412513,243803201,352408408,243819970}, {350715680,243818823,350712187,243857694}, 
+    {352408408,243819970,352404676,243837050}, {352404676,243837050,352401324,243854444}, {352401324,243854444,352398355,243872154}, 
+    {350712187,243857694,350709609,243896657}, {352398355,243872154,352395774,243890185}, {352395774,243890185,352393587,243908540}, 
+    {350709609,243896657,350707960,243935706}, {352393587,243908540,352391799,243927222}, {352391799,243927222,352390414,243946234}, 
+    {350707960,243935706,350707255,243974835}, {352390414,243946234,352389439,243965579}, {352389439,243965579,352388877,243985260}, 
+    {350707255,243974835,350707509,244014039}, {352388877,243985260,352388733,244005282}, {352388733,244005282,352389014,244025647}, 
+    {350707509,244014039,350708736,244053312}, {352389014,244025647,352389723,244046358}, {352389723,244046358,352390866,244067419}, 
+    {350708736,244053312,350712179,244118948}, {352390866,244067419,352392448,244088832}, {352392448,244088832,352393151,244096283}, 
+    {352393151,244096283,352394013,244103683}, {352394013,244103683,352395033,244111031}, {352395033,244111031,352396210,244118327}, 
+    {348911232,244114240,347212224,245329216}, {348911232,244114240,351797568,250247424}, {352396210,244118327,352397543,244125572}, 
+    {350712179,244118948,350716752,244183760}, {352397543,244125572,352399030,244132766}, {352399030,244132766,352400672,244139910}, 
+    {352400672,244139910,352402466,244147003}, {352402466,244147003,352404412,244154046}, {352404412,244154046,352406509,244161040}, 
+    {352406509,244161040,352408756,244167984}, {352408756,244167984,352411151,244174878}, {352411151,244174878,352413695,244181724}, 
+    {352413695,244181724,352416385,244188521}, {350716752,244183760,350722438,244247745}, {352416385,244188521,352419220,244195270}, 
+    {352419220,244195270,352422201,244201970}, {352422201,244201970,352425325,244208623}, {352425325,244208623,352428592,244215228}, 
+    {352428592,244215228,352432000,244221786}, {352432000,244221786,352435549,244228297}, {352435549,244228297,352439238,244234761}, 
+    {352439238,244234761,352443065,244241178}, {352443065,244241178,352447030,244247549}, {352447030,244247549,352451131,244253875}, 
+    {350722438,244247745,350729224,244310901}, {352451131,244253875,352455368,244260154}, {352455368,244260154,352459740,244266388}, 
+    {352459740,244266388,352464245,244272578}, {352464245,244272578,352468883,244278722}, {352468883,244278722,352478551,244290877}, 
+    {352478551,244290877,352488738,244302856}, {352488738,244302856,352499434,244314662}, {350729224,244310901,350737093,244373228}, 
+    {352499434,244314662,352510631,244326295}, {352510631,244326295,352522322,244337759}, {352522322,244337759,352534498,244349056}, 
+    {352534498,244349056,352547151,244360188}, {352547151,244360188,352560274,244371157}, {352560274,244371157,352573857,244381966}, 
+    {350737093,244373228,350746033,244434723}, {352573857,244381966,352587893,244392615}, {352587893,244392615,352602373,244403109}, 
+    {362885824,244393280,361243968,245568320}, {352602373,244403109,352617290,244413449}, {352617290,244413449,352632635,244423636}, 
+    {352632635,244423636,352648400,244433674}, {352648400,244433674,352664577,244443565}, {350746033,244434723,350756026,244495384}, 
+    {352664577,244443565,352681159,244453310}, {352681159,244453310,352715500,244472374}, {352715500,244472374,352751359,244490883}, 
+    {352751359,244490883,352788672,244508855}, {350756026,244495384,350767060,244555209}, {352788672,244508855,352827371,244526307}, 
+    {352827371,244526307,352867394,244543258}, {352867394,244543258,352908674,244559724}, {350767060,244555209,350779118,244614197}, 
+    {352908674,244559724,352951147,244575723}, {352951147,244575723,353039408,244606393}, {353039408,244606393,353131659,244635406}, 
+    {350779118,244614197,350792187,244672347}, {353131659,244635406,353227378,244662905}, {353227378,244662905,353326044,244689029}, 
+    {350792187,244672347,350806251,244729655}, {353326044,244689029,353427136,244713920}, {353427136,244713920,353634517,244760564}, 
+    {350806251,244729655,350821294,244786121}, {353634517,244760564,353845356,244803963}, {350821294,244786121,350837304,244841742}, 
+    {353845356,244803963,354260740,244885530}, {350837304,244841742,350854264,244896517}, {354260740,244885530,354456954,244925950}, 
+    {350854264,244896517,350872159,244950444}, {354456954,244925950,354639962,244967628}, {350872159,244950444,350890976,245003521}, 
+    {354639962,244967628,354725212,244989291}, {354725212,244989291,354805598,245011691}, {350890976,245003521,350910699,245055747}, 
+    {354805598,245011691,354880600,245034968}, {354880600,245034968,354915919,245046980}, {354915919,245046980,354949696,245059264}, 
+    {350910699,245055747,350931312,245107119}, {354949696,245059264,355024652,245088406}, {355024652,245088406,355098345,245118934}, 
+    {350931312,245107119,350952802,245157636}, {355098345,245118934,355170753,245150907}, {355170753,245150907,355241859,245184386}, 
+    {350952802,245157636,350975154,245207296}, {355241859,245184386,355311641,245219431}, {350975154,245207296,350998351,245256097}, 
+    {355311641,245219431,355380081,245256104}, {350998351,245256097,351022381,245304038}, {355380081,245256104,355447160,245294464}, 
+    {355447160,245294464,355512857,245334573}, {351022381,245304038,351047228,245351116}, {347212224,245329216,349751360,250906176}, 
+    {355512857,245334573,355577153,245376490}, {351047228,245351116,351072876,245397330}, {355577153,245376490,355640029,245420277}, 
+    {351072876,245397330,351099312,245442679}, {355640029,245420277,355701465,245465993}, {351099312,245442679,351126519,245487159}, 
+    {355701465,245465993,355761441,245513700}, {351126519,245487159,351154485,245530770}, {355761441,245513700,355819938,245563457}, 
+    {351154485,245530770,351183192,245573510}, {355819938,245563457,355876937,245615326}, {351183192,245573510,351212628,245615377}, 
+    {355876937,245615326,355932417,245669367}, {351212628,245615377,351242776,245656368}, {351242776,245656368,351273623,245696483}, 
+    {355932417,245669367,355986360,245725640}, {351273623,245696483,351305152,245735720}, {355986360,245725640,356038746,245784206}, 
+    {351305152,245735720,351337350,245774076}, {351337350,245774076,351370201,245811551}, {356038746,245784206,356089555,245845126}, 
+    {351370201,245811551,351403690,245848141}, {356089555,245845126,356138767,245908459}, {351403690,245848141,351437804,245883846}, 
+    {351437804,245883846,351472526,245918663}, {356138767,245908459,356186364,245974267}, {351472526,245918663,351507842,245952591}, 
+    {351507842,245952591,351543737,245985628}, {356186364,245974267,356232326,246042610}, {351543737,245985628,351580196,246017773}, 
+    {351580196,246017773,351617205,246049022}, {356232326,246042610,356276632,246113549}, {351617205,246049022,351654748,246079376}, 
+    {351654748,246079376,351692811,246108831}, {351692811,246108831,351731378,246137386}, {356276632,246113549,356319265,246187144}, 
+    {351731378,246137386,351770436,246165039}, {351770436,246165039,351809969,246191789}, {356319265,246187144,356360203,246263455}, 
+    {351809969,246191789,351849962,246217634}, {345920768,246213440,344305600,247338752}, {345920768,246213440,348555264,251571392}, 
+    {351849962,246217634,351890400,246242571}, {351890400,246242571,351931269,246266599}, {356360203,246263455,356399428,246342544}, 
+    {351931269,246266599,351972553,246289717}, {351972553,246289717,352014238,246311922}, {352014238,246311922,352056310,246333213}, 
+    {352056310,246333213,352098752,246353588}, {356399428,246342544,356436920,246424470}, {352098752,246353588,352141550,246373045}, 
+    {352141550,246373045,352184690,246391582}, {352184690,246391582,352228156,246409198}, {352228156,246409198,352271934,246425890}, 
+    {356436920,246424470,356472659,246509294}, {352271934,246425890,352316008,246441658}, {352316008,246441658,352360365,246456498}, 
+    {352360365,246456498,352404988,246470410}, {352404988,246470410,352449864,246483392}, {352449864,246483392,352494977,246495441}, 
+    {359969344,246494080,358344192,247563328}, {352494977,246495441,352540313,246506557}, {352540313,246506557,352585856,246516736}, 
+    {356472659,246509294,356506626,246597077}, {352585856,246516736,352922317,246591279}, {352922317,246591279,353097540,246634028}, 
+    {356506626,246597077,356538802,246687880}, {353097540,246634028,353273590,246681234}, {353273590,246681234,353447590,246733502}, 
+    {356538802,246687880,356569167,246781762}, {353447590,246733502,353532923,246761723}, {353532923,246761723,353616664,246791436}, 
+    {356569167,246781762,356597700,246878785}, {353616664,246791436,353698455,246822717}, {353698455,246822717,353777936,246855641}, 
+    {353777936,246855641,353854746,246890283}, {356597700,246878785,356624384,246979008}, {353854746,246890283,353892038,246908273}, 
+    {353892038,246908273,353928528,246926720}, {353928528,246926720,353964170,246945635}, {353964170,246945635,353998921,246965026}, 
+    {353998921,246965026,354032734,246984904}, {356624384,246979008,356636642,247030203}, {354032734,246984904,354065565,247005278}, 
+    {354065565,247005278,354097369,247026157}, {354097369,247026157,354128101,247047551}, {356636642,247030203,356647507,247081194}, 
+    {354128101,247047551,354157716,247069469}, {354157716,247069469,354186170,247091920}, {356647507,247081194,356656995,247131978}, 
+    {354186170,247091920,354213416,247114914}, {354213416,247114914,354226573,247126618}, {354226573,247126618,354239411,247138461}, 
+    {356656995,247131978,356665121,247182552}, {354239411,247138461,354251925,247150444}, {354251925,247150444,354264110,247162569}, 
+    {354264110,247162569,354275958,247174837}, {354275958,247174837,354287466,247187249}, {356665121,247182552,356671901,247232914}, 
+    {354287466,247187249,354298627,247199806}, {354298627,247199806,354309436,247212509}, {354309436,247212509,354319887,247225360}, 
+    {354319887,247225360,354329975,247238360}, {356671901,247232914,356677352,247283061}, {354329975,247238360,354339693,247251510}, 
+    {354339693,247251510,354349037,247264811}, {354349037,247264811,354358001,247278264}, {354358001,247278264,354366578,247291870}, 
+    {356677352,247283061,356681489,247332992}, {354366578,247291870,354374764,247305631}, {354374764,247305631,354382552,247319548}, 
+    {354382552,247319548,354389938,247333622}, {356681489,247332992,356684328,247382704}, {354389938,247333622,354396916,247347854}, 
+    {344305600,247338752,346823872,252832448}, {354396916,247347854,354403479,247362245}, {354403479,247362245,354409623,247376797}, 
+    {354409623,247376797,354415341,247391511}, {356684328,247382704,356685885,247432194}, {354415341,247391511,354420628,247406387}, 
+    {354420628,247406387,354425479,247421428}, {354425479,247421428,354429888,247436634}, {356685885,247432194,356686176,247481459}, 
+    {354429888,247436634,354433849,247452006}, {354433849,247452006,354437357,247467546}, {354437357,247467546,354440405,247483255}, 
+    {356686176,247481459,356685216,247530499}, {354440405,247483255,354442990,247499133}, {354442990,247499133,354445103,247515183}, 
+    {354445103,247515183,354446741,247531405}, {356685216,247530499,356683022,247579309}, {354446741,247531405,354447898,247547801}, 
+    {354447898,247547801,354448567,247564371}, {354448567,247564371,354448744,247581117}, {356683022,247579309,356679609,247627888}, 
+    {354448744,247581117,354448422,247598041}, {354448422,247598041,354447597,247615142}, {354447597,247615142,354446261,247632423}, 
+    {356679609,247627888,356674993,247676233}, {354446261,247632423,354444411,247649885}, {354444411,247649885,354442040,247667528}, 
+    {354442040,247667528,354439142,247685354}, {356674993,247676233,356669191,247724342}, {354439142,247685354,354435713,247703365}, 
+    {354435713,247703365,354431746,247721560}, {354431746,247721560,354427235,247739943}, {356669191,247724342,356662217,247772213}, 
+    {354427235,247739943,354422176,247758512}, {354422176,247758512,354416562,247777271}, {356662217,247772213,356654088,247819843}, 
+    {354416562,247777271,354410388,247796220}, {354410388,247796220,354403648,247815360}, {354403648,247815360,354394624,247838865}, 
+    {356654088,247819843,356644820,247867229}, {354394624,247838865,354384942,247861816}, {354384942,247861816,354374611,247884216}, 
+    {356644820,247867229,356634429,247914369}, {354374611,247884216,354363640,247906069}, {354363640,247906069,354352039,247927381}, 
+    {356634429,247914369,356622930,247961261}, {354352039,247927381,354339818,247948154}, {354339818,247948154,354326986,247968393}, 
+    {356622930,247961261,356610339,248007902}, {354326986,247968393,354313553,247988102}, {354313553,247988102,354299528,248007285}, 
+    {354299528,248007285,354284922,248025947}, {356610339,248007902,356596672,248054290}, {354284922,248025947,354269744,248044091}, 
+    {354269744,248044091,354254002,248061721}, {356596672,248054290,356581946,248100423}, {354254002,248061721,354237708,248078843}, 
+    {354237708,248078843,354220870,248095459}, {354220870,248095459,354203499,248111575}, {356581946,248100423,356566175,248146298}, 
+    {354203499,248111575,354185603,248127193}, {354185603,248127193,354167193,248142319}, {354167193,248142319,354148277,248156956}, 
+    {356566175,248146298,356549377,248191912}, {354148277,248156956,354128866,248171109}, {354128866,248171109,354108970,248184781}, 
+    {354108970,248184781,354088597,248197977}, {356549377,248191912,356531565,248237264}, {354088597,248197977,354067758,248210701}, 
+    {354067758,248210701,354046461,248222957}, {354046461,248222957,354024718,248234750}, {354024718,248234750,354002536,248246083}, 
+    {356531565,248237264,356512758,248282350}, {354002536,248246083,353979927,248256960}, {353979927,248256960,353956898,248267386}, 
+    {353956898,248267386,353933461,248277364}, {353933461,248277364,353909625,248286899}, {356512758,248282350,356492970,248327169}, 
+    {353909625,248286899,353885399,248295996}, {353885399,248295996,353860793,248304657}, {353860793,248304657,353835816,248312888}, 
+    {353835816,248312888,353810478,248320692}, {353810478,248320692,353784790,248328074}, {356492970,248327169,356472217,248371718}, 
+    {353784790,248328074,353758759,248335037}, {353758759,248335037,353732396,248341586}, {353732396,248341586,353678713,248353458}, 
+    {353678713,248353458,353623817,248363723}, {353623817,248363723,353567785,248372414}, {356472217,248371718,356450515,248415994}, 
+    {353567785,248372414,353510694,248379563}, {352898432,248373568,353037952,250281344}, {352898432,248373568,352961888,248380012}, 
+    {353510694,248379563,353452620,248385205}, {352961888,248380012,353025054,248385245}, {353452620,248385205,353393641,248389371}, 
+    {353025054,248385245,353087852,248389234}, {353087852,248389234,353150206,248391947}, {353393641,248389371,353333833,248392095}, 
+    {353150206,248391947,353212039,248393351}, {353333833,248392095,353273273,248393411}, {353212039,248393351,353273273,248393411}, 
+    {356450515,248415994,356427880,248459996}, {356427880,248459996,356404328,248503720}, {356404328,248503720,356379875,248547164}, 
+    {356379875,248547164,356354536,248590327}, {356354536,248590327,356328328,248633205}, {356328328,248633205,356301266,248675796}, 
+    {356301266,248675796,356244645,248760107}, {356244645,248760107,356184800,248843241}, {356184800,248843241,356121857,248925179}, 
+    {356121857,248925179,356055944,249005902}, {356055944,249005902,355987188,249085390}, {355987188,249085390,355915715,249163623}, 
+    {355915715,249163623,355841653,249240583}, {355841653,249240583,355765128,249316250}, {342382257,249258666,342436680,249259623}, 
+    {342382257,249258666,342327418,249259157}, {342327418,249259157,342272170,249261113}, {342436680,249259623,342490677,249262010}, 
+    {342272170,249261113,342216523,249264553}, {342490677,249262010,342544240,249265811}, {342216523,249264553,342160486,249269492}, 
+    {342544240,249265811,342597359,249271007}, {342160486,249269492,342104067,249275949}, {342597359,249271007,342650026,249277582}, 
+    {342104067,249275949,342047275,249283941}, {342650026,249277582,342702233,249285517}, {342047275,249283941,341990119,249293486}, 
+    {342702233,249285517,342753970,249294796}, {341990119,249293486,341932607,249304600}, {342753970,249294796,342805229,249305401}, 
+    {341932607,249304600,341874749,249317302}, {342805229,249305401,342856000,249317315}, {355765128,249316250,355686268,249390604}, 
+    {341874749,249317302,341816554,249331608}, {342856000,249317315,342906275,249330519}, {342906275,249330519,342956046,249344998}, 
+    {341816554,249331608,341758029,249347537}, {342956046,249344998,343005303,249360733}, {341758029,249347537,341699184,249365105}, 
+    {343005303,249360733,343054038,249377707}, {341699184,249365105,341640028,249384330}, {343054038,249377707,343102242,249395903}, 
+    {341640028,249384330,341580569,249405229}, {355686268,249390604,355605199,249463627}, {343102242,249395903,343149906,249415302}, 
+    {341580569,249405229,341520816,249427820}, {343149906,249415302,343197021,249435889}, {341520816,249427820,341460778,249452120}, 
+    {343197021,249435889,343243579,249457644}, {341460778,249452120,341400464,249478147}, {343243579,249457644,343289570,249480552}, 
+    {355605199,249463627,355522048,249535299}, {341400464,249478147,341339882,249505918}, {343289570,249480552,343334987,249504594}, 
+    {343334987,249504594,343379819,249529753}, {341339882,249505918,341279042,249535450}, {343379819,249529753,343424059,249556012}, 
+    {355522048,249535299,355436943,249605601}, {341279042,249535450,341217952,249566762}, {343424059,249556012,343467698,249583353}, 
+    {341217952,249566762,341156621,249599869}, {343467698,249583353,343510726,249611759}, {341156621,249599869,341095057,249634790}, 
+    {355436943,249605601,355350010,249674513}, {343510726,249611759,343553136,249641213}, {341095057,249634790,341033270,249671543}, 
+    {343553136,249641213,343594917,249671696}, {341033270,249671543,340971269,249710143}, {343594917,249671696,343636062,249703192}, 
+    {355350010,249674513,355261376,249742016}, {343636062,249703192,343676562,249735683}, {340971269,249710143,340909061,249750610}, 
+    {343676562,249735683,343716408,249769152}, {355261376,249742016,355201913,249785416}, {340909061,249750610,340846656,249792960}, 
+    {343716408,249769152,343755590,249803581}, {355201913,249785416,355143619,249825935}, {340846656,249792960,338749696,251245952}, 
+    {343755590,249803581,343794101,249838953}, {355143619,249825935,355086312,249863689}, {343794101,249838953,343831931,249875250}, 
+    {355086312,249863689,355029811,249898795}, {343831931,249875250,343869073,249912456}, {355029811,249898795,354973934,249931370}, 
+    {343869073,249912456,343905516,249950552}, {354973934,249931370,354918500,249961531}, {343905516,249950552,343941252,249989522}, 
+    {354918500,249961531,354863327,249989395}, {354863327,249989395,354808234,250015079}, {343941252,249989522,343976272,250029347}, 
+    {354808234,250015079,354753039,250038699}, {343976272,250029347,344010568,250070011}, {354753039,250038699,354697561,250060373}, 
+    {354697561,250060373,354641618,250080218}, {344010568,250070011,344044131,250111496}, {354641618,250080218,354585028,250098350}, 
+    {354585028,250098350,354527611,250114886}, {344044131,250111496,344076952,250153784}, {354527611,250114886,354469184,250129943}, 
+    {354469184,250129943,354409566,250143638}, {354409566,250143638,354348576,250156088}, {344076952,250153784,344109022,250196859}, 
+    {354348576,250156088,354286032,250167410}, {354286032,250167410,354221752,250177720}, {354221752,250177720,354087260,250195775}, 
+    {354087260,250195775,353943647,250211188}, {344109022,250196859,344140332,250240702}, {353943647,250211188,353789462,250224893}, 
+    {353789462,250224893,353037952,250281344}, {344140332,250240702,344170874,250285297}, {351797568,250247424,351808612,250271531}, 
+    {351808612,250271531,351819125,250295801}, {344170874,250285297,344200639,250330625}, {351819125,250295801,351829113,250320230}, 
+    {351829113,250320230,351838578,250344814}, {344200639,250330625,344229618,250376670}, {351838578,250344814,351847526,250369550}, 
+    {351847526,250369550,351855960,250394432}, {344229618,250376670,344257802,250423414}, {351855960,250394432,351863885,250419457}, 
+    {351863885,250419457,351871304,250444622}, {344257802,250423414,344285183,250470840}, {351871304,250444622,351878222,250469922}, 
+    {351878222,250469922,351884643,250495352}, {344285183,250470840,344311751,250518931}, {351884643,250495352,351890570,250520910}, 
+    {344311751,250518931,344337498,250567668}, {351890570,250520910,351896009,250546590}, {351896009,250546590,351900963,250572390}, 
+    {344337498,250567668,344362416,250617034}, {351900963,250572390,351905436,250598305}, {351905436,250598305,351909432,250624330}, 
+    {344362416,250617034,344386494,250667012}, {351909432,250624330,351912956,250650463}, {351912956,250650463,351916012,250676699}, 
+    {344386494,250667012,344409725,250717586}, {351916012,250676699,351918603,250703033}, {351918603,250703033,351920734,250729463}, 
+    {344409725,250717586,344432100,250768736}, {351920734,250729463,351922409,250755983}, {351922409,250755983,351924407,250809280}, 
+    {344432100,250768736,344453610,250820446}, {351924407,250809280,351924630,250862894}, {344453610,250820446,344474246,250872698}, 
+    {351924630,250862894,351923111,250916790}, {344474246,250872698,344493999,250925476}, {349751360,250906176,349779673,250970924}, 
+    {351923111,250916790,351919882,250970938}, {344493999,250925476,344512861,250978761}, {349779673,250970924,349792914,251003405}, 
+    {351919882,250970938,351914978,251025305}, {344512861,250978761,344530823,251032536}, {349792914,251003405,349805425,251035929}, 
+    {351914978,251025305,351908430,251079860}, {344530823,251032536,344547875,251086783}, {349805425,251035929,349817113,251068474}, 
+    {349817113,251068474,349827889,251101018}, {351908430,251079860,351900272,251134570}, {344547875,251086783,344564010,251141486}, 
+    {349827889,251101018,349837662,251133538}, {349837662,251133538,349846341,251166014}, {351900272,251134570,351890536,251189403}, 
+    {344564010,251141486,344579219,251196627}, {349846341,251166014,349850242,251182228}, {349850242,251182228,349853835,251198423}, 
+    {351890536,251189403,351879255,251244326}, {344579219,251196627,344593492,251252188}, {349853835,251198423,349857110,251214595}, 
+    {349857110,251214595,349860055,251230742}, {349860055,251230742,349862658,251246862}, {351879255,251244326,351866463,251299309}, 
+    {338749696,251245952,342320320,258870720}, {349862658,251246862,349864908,251262951}, {344593492,251252188,344606820,251308153}, 
+    {349864908,251262951,349866794,251279008}, {349866794,251279008,349868305,251295028}, {349868305,251295028,349869429,251311009}, 
+    {351866463,251299309,351852191,251354318}, {344606820,251308153,344619196,251364503}, {349869429,251311009,349870154,251326949}, 
+    {342267347,251324745,342243345,251325155}, {342267347,251324745,342291002,251324883}, {342291002,251324883,342314301,251325565}, 
+    {342243345,251325155,342219005,251326116}, {342314301,251325565,342337237,251326788}, {342219005,251326116,342194335,251327632}, 
+    {342337237,251326788,342359801,251328547}, {349870154,251326949,349870470,251342846}, {342194335,251327632,342169344,251329706}, 
+    {342359801,251328547,342381983,251330840}, {342169344,251329706,342144040,251332343}, {342381983,251330840,342403776,251333662}, 
+    {342144040,251332343,342118432,251335546}, {342403776,251333662,342425172,251337010}, {342118432,251335546,342092529,251339318}, 
+    {342425172,251337010,342446161,251340881}, {342092529,251339318,342066338,251343663}, {342446161,251340881,342466734,251345270}, 
+    {349870470,251342846,349870366,251358695}, {342066338,251343663,342039869,251348585}, {342466734,251345270,342486885,251350175}, 
+    {342039869,251348585,342013129,251354087}, {342486885,251350175,342506603,251355591}, {342013129,251354087,341986128,251360173}, 
+    {351852191,251354318,351836474,251409323}, {342506603,251355591,342525881,251361515}, {349870366,251358695,349869829,251374494}, 
+    {341986128,251360173,341958874,251366846}, {342525881,251361515,342544709,251367943}, {344619196,251364503,344630610,251421221}, 
+    {341958874,251366846,341931376,251374111}, {342544709,251367943,342563080,251374871}, {341931376,251374111,341903641,251381971}, 
+    {349869829,251374494,349868849,251390242}, {342563080,251374871,342580985,251382297}, {341903641,251381971,341875680,251390429}, 
+    {342580985,251382297,342598416,251390216}, {342598416,251390216,342615363,251398625}, {349868849,251390242,349867413,251405934}, 
+    {341875680,251390429,341819108,251409154}, {342615363,251398625,342623652,251403012}, {342623652,251403012,342631818,251407520}, 
+    {349867413,251405934,349865512,251421568}, {342631818,251407520,342639859,251412149}, {341819108,251409154,341761728,251430317}, 
+    {351836474,251409323,351819343,251464290}, {342639859,251412149,342647773,251416898}, {342647773,251416898,342655561,251421767}, 
+    {344630610,251421221,344641054,251478290}, {349865512,251421568,349863133,251437142}, {342655561,251421767,342663220,251426755}, 
+    {342663220,251426755,342670750,251431861}, {341761728,251430317,341703609,251453946}, {342670750,251431861,342678149,251437087}, 
+    {342678149,251437087,342685417,251442430}, {349863133,251437142,349860265,251452652}, {342685417,251442430,342692552,251447890}, 
+    {342692552,251447890,342699554,251453468}, {349860265,251452652,349856897,251468097}, {342699554,251453468,342706421,251459162}, 
+    {341703609,251453946,341644819,251480070}, {342706421,251459162,342713153,251464972}, {351819343,251464290,351800833,251519187}, 
+    {342713153,251464972,342719748,251470898}, {349856897,251468097,349853018,251483472}, {342719748,251470898,342726205,251476939}, 
+    {342726205,251476939,342732522,251483094}, {344641054,251478290,344650518,251535692}, {341644819,251480070,341585426,251508718}, 
+    {342732522,251483094,342738700,251489365}, {349853018,251483472,349848616,251498776}, {342738700,251489365,342744737,251495748}, 
+    {342744737,251495748,342750632,251502246}, {349848616,251498776,349843679,251514006}, {342750632,251502246,342756384,251508856}, 
+    {341585426,251508718,341525498,251539919}, {342756384,251508856,342761991,251515579}, {349843679,251514006,349838197,251529159}, 
+    {342761991,251515579,342767454,251522413}, {351800833,251519187,351780975,251573983}, {342767454,251522413,342772769,251529360}, 
+    {349838197,251529159,349832158,251544232}, {342772769,251529360,342777938,251536417}, {344650518,251535692,344658995,251593410}, 
+    {342777938,251536417,342782958,251543585}, {341525498,251539919,341465104,251573701}, {342782958,251543585,342787828,251550864}, 
+    {349832158,251544232,349825551,251559223}, {342787828,251550864,342792548,251558252}, {342792548,251558252,342797116,251565749}, 
+    {349825551,251559223,349818364,251574128}, {342797116,251565749,342801531,251573356}, {348555264,251571392,348558616,251578056}, 
+    {342801531,251573356,342805792,251581070}, {341465104,251573701,341404311,251610095}, {351780975,251573983,351759802,251628645}, 
+    {349818364,251574128,349810587,251588946}, {348558616,251578056,348562095,251584681}, {342805792,251581070,342809899,251588893}, 
+    {348562095,251584681,348569428,251597809}, {342809899,251588893,342813849,251596823}, {349810587,251588946,349802207,251603673}, 
+    {344658995,251593410,344666474,251651427}, {342813849,251596823,342817643,251604861}, {348569428,251597809,348577250,251610771}, 
+    {349802207,251603673,349793214,251618306}, {342817643,251604861,342821278,251613004}, {341404311,251610095,341343188,251649129}, 
+    {348577250,251610771,348585550,251623561}, {342821278,251613004,342824755,251621254}, {349793214,251618306,349783595,251632843}, 
+    {342824755,251621254,342828071,251629610}, {348585550,251623561,348594314,251636174}, {351759802,251628645,351737349,251683142}, 
+    {342828071,251629610,342831225,251638071}, {349783595,251632843,349773341,251647281}, {348594314,251636174,348603531,251648605}, 
+    {342831225,251638071,342834218,251646637}, {342834218,251646637,342837047,251655307}, {349773341,251647281,349762439,251661618}, 
+    {348603531,251648605,348613188,251660848}, {341343188,251649129,341281803,251690832}, {344666474,251651427,344672948,251709725}, 
+    {342837047,251655307,342839711,251664081}, {348613188,251660848,348623272,251672898}, {349762439,251661618,349750878,251675850}, 
+    {342839711,251664081,342842210,251672958}, {348623272,251672898,348633773,251684749}, {342842210,251672958,342844543,251681939}, 
+    {349750878,251675850,349738647,251689975}, {342844543,251681939,342846708,251691021}, {351737349,251683142,351713646,251737440}, 
+    {348633773,251684749,348644677,251696397}, {349738647,251689975,349725734,251703991}, {341281803,251690832,341220224,251735232}, 
+    {342846708,251691021,342848704,251700206}, {348644677,251696397,348655971,251707836}, {342848704,251700206,342850530,251709493}, 
+    {349725734,251703991,349712129,251717893}, {348655971,251707836,348667644,251719060}, {342850530,251709493,342852185,251718881}, 
+    {344672948,251709725,344678407,251768287}, {349712129,251717893,349697819,251731680}, {342852185,251718881,342853668,251728369}, 
+    {348667644,251719060,348679684,251730064}, {342853668,251728369,342854979,251737958}, {348679684,251730064,348692077,251740844}, 
+    {349697819,251731680,349682793,251745350}, {341220224,251735232,341929408,253125440}, {351713646,251737440,351688728,251791509}, 
+    {342854979,251737958,342856115,251747646}, {348692077,251740844,348704812,251751393}, {349682793,251745350,349667041,251758898}, 
+    {342856115,251747646,342857076,251757434}, {348704812,251751393,348717876,251761706}, {342857076,251757434,342857861,251767321}, 
+    {349667041,251758898,349650550,251772323}, {348717876,251761706,348731257,251771778}, {342857861,251767321,342858469,251777306}, 
+    {344678407,251768287,344682843,251827095}, {348731257,251771778,348744943,251781604}, {349650550,251772323,349633310,251785621}, 
+    {342858469,251777306,342858898,251787390}, {348744943,251781604,348758921,251791178}, {349633310,251785621,349615309,251798791}, 
+    {342858898,251787390,342859148,251797570}, {348758921,251791178,348773179,251800495}, {351688728,251791509,351662627,251845316}, 
+    {342859148,251797570,342859218,251807848}, {349615309,251798791,349596536,251811828}, {348773179,251800495,348787705,251809550}, 
+    {342859218,251807848,342859106,251818223}, {348787705,251809550,348802486,251818336}, {349596536,251811828,349576979,251824731}, 
+    {342859106,251818223,342858333,251839260}, {348802486,251818336,348817511,251826850}, {349576979,251824731,349556627,251837497}, 
+    {348817511,251826850,348832766,251835085}, {344682843,251827095,344686247,251886132}, {348832766,251835085,348848239,251843037}, 
+    {349556627,251837497,349535469,251850123}, {342858333,251839260,342856821,251860678}, {348848239,251843037,348863918,251850699}, 
+    {351662627,251845316,351635376,251898829}, {349535469,251850123,349513493,251862606}, {348863918,251850699,348879791,251858067}, 
+    {348879791,251858067,348895846,251865135}, {342856821,251860678,342854562,251882474}, {349513493,251862606,349490688,251874944}, 
+    {348895846,251865135,348912070,251871899}, {348912070,251871899,348928450,251878351}, {349490688,251874944,349483532,251878644}, 
+    {348928450,251878351,348944975,251884488}, {349483532,251878644,349476309,251882220}, {349476309,251882220,349461667,251889005}, 
+    {342854562,251882474,342851547,251904644}, {348944975,251884488,348961632,251890304}, {344686247,251886132,344688610,251945380}, 
+    {349461667,251889005,349446776,251895303}, {348961632,251890304,348978409,251895793}, {349446776,251895303,349431647,251901120}, 
+    {348978409,251895793,348995293,251900951}, {351635376,251898829,351607008,251952016}, {348995293,251900951,349012273,251905772}, 
+    {349431647,251901120,349416293,251906461}, {342851547,251904644,342847767,251927184}, {349012273,251905772,349029335,251910250}, 
+    {349416293,251906461,349400727,251911331}, {349029335,251910250,349046468,251914380}, {349400727,251911331,349384959,251915737}, 
+    {349046468,251914380,349063659,251918157}, {349384959,251915737,349369004,251919682}, {349063659,251918157,349080896,251921576}, 
+    {349369004,251919682,349352872,251923173}, {349080896,251921576,349098166,251924631}, {349352872,251923173,349336577,251926215}, 
+    {349098166,251924631,349115458,251927317}, {349336577,251926215,349320130,251928814}, {342847767,251927184,342843215,251950091}, 
+    {349115458,251927317,349132759,251929628}, {349320130,251928814,349303545,251930973}, {349132759,251929628,349150056,251931560}, 
+    {349303545,251930973,349286833,251932700}, {349150056,251931560,349167338,251933106}, {349286833,251932700,349270006,251933999}, 
+    {349167338,251933106,349184591,251934262}, {349270006,251933999,349253078,251934875}, {349184591,251934262,349201804,251935022}, 
+    {349253078,251934875,349236060,251935334}, {349201804,251935022,349218965,251935381}, {349236060,251935334,349218965,251935381}, 
+    {344688610,251945380,344689924,252004823}, {342843215,251950091,342837881,251973360}, {351607008,251952016,351577556,252004845}, 
+    {342837881,251973360,342831757,251996990}, {342831757,251996990,342824834,252020974}, {344689924,252004823,344690179,252064442}, 
+    {351577556,252004845,351547053,252057283}, {342824834,252020974,342817104,252045311}, {342817104,252045311,342808559,252069997}, 
+    {351547053,252057283,351515531,252109299}, {344690179,252064442,344689367,252124220}, {342808559,252069997,342799189,252095028}, 
+    {342799189,252095028,342788987,252120399}, {351515531,252109299,351483024,252160860}, {342788987,252120399,342777944,252146109}, 
+    {344689367,252124220,344687479,252184140}, {342777944,252146109,342766051,252172153}, {351483024,252160860,351415185,252262491}, 
+    {342766051,252172153,342753300,252198527}, {344687479,252184140,344684506,252244185}, {342753300,252198527,342739682,252225227}, 
+    {342739682,252225227,342725188,252252251}, {344684506,252244185,344680440,252304336}, {342725188,252252251,342709811,252279595}, 
+    {351415185,252262491,351343799,252361919}, {342709811,252279595,342693542,252307255}, {344680440,252304336,344675271,252364577}, 
+    {342693542,252307255,342676372,252335227}, {342676372,252335227,342658292,252363507}, {337315392,252354752,337227394,252393910}, 
+    {337315392,252354752,338215616,254285248}, {351343799,252361919,351269130,252458887}, {342658292,252363507,342619371,252420980}, 
+    {344675271,252364577,344668992,252424890}, {337227394,252393910,337140114,252435109}, {342619371,252420980,342576709,252479644}, 
+    {344668992,252424890,344661592,252485258}, {337140114,252435109,337053608,252478339}, {351269130,252458887,351191439,252553140}, 
+    {337053608,252478339,336967932,252523588}, {342576709,252479644,342530240,252539471}, {344661592,252485258,344653064,252545663}, 
+    {336967932,252523588,336883142,252570845}, {342530240,252539471,342479895,252600431}, {344653064,252545663,344643398,252606088}, 
+    {351191439,252553140,351110992,252644419}, {336883142,252570845,336799295,252620098}, {342479895,252600431,342425605,252662496}, 
+    {344643398,252606088,344632586,252666516}, {336799295,252620098,336716447,252671337}, {351110992,252644419,351028050,252732468}, 
+    {342425605,252662496,342367303,252725636}, {344632586,252666516,344620618,252726929}, {336716447,252671337,336634655,252724549}, 
+    {336634655,252724549,336553974,252779723}, {342367303,252725636,342304920,252789823}, {344620618,252726929,344607487,252787309}, 
+    {351028050,252732468,350942877,252817031}, {336553974,252779723,336474461,252836849}, {344607487,252787309,344593184,252847639}, 
+    {342304920,252789823,342238388,252855027}, {350942877,252817031,350855736,252897851}, {346823872,252832448,346834774,252855452}, 
+    {336474461,252836849,336396172,252895915}, {344593184,252847639,344577699,252907903}, {342238388,252855027,342167639,252921220}, 
+    {346834774,252855452,346846235,252878103}, {346846235,252878103,346858247,252900402}, {336396172,252895915,336319164,252956909}, 
+    {350855736,252897851,350811510,252936777}, {346858247,252900402,346870804,252922350}, {344577699,252907903,344561023,252968082}, 
+    {342167639,252921220,342092605,252988372}, {346870804,252922350,346883899,252943948}, {350811510,252936777,350766891,252974671}, 
+    {346883899,252943948,346897523,252965198}, {336319164,252956909,336243492,253019820}, {346897523,252965198,346911671,252986100}, 
+    {344561023,252968082,344543149,253028158}, {350766891,252974671,350721911,253011501}, {346911671,252986100,346926334,253006656}, 
+    {342092605,252988372,342013217,253056455}, {346926334,253006656,346941506,253026867}, {350721911,253011501,350676604,253047235}, 
+    {336243492,253019820,336169214,253084636}, {346941506,253026867,346957180,253046733}, {344543149,253028158,344524067,253088116}, 
+    {346957180,253046733,346973347,253066257}, {350676604,253047235,350631002,253081841}, {342013217,253056455,341929408,253125440}, 
+    {346973347,253066257,346990002,253085438}, {350631002,253081841,350585138,253115286}, {336169214,253084636,336096384,253151348}, 
+    {346990002,253085438,347007136,253104279}, {344524067,253088116,344503768,253147936}, {347007136,253104279,347024743,253122780}, 
+    {350585138,253115286,350539046,253147538}, {347024743,253122780,347042815,253140943}, {347042815,253140943,347061346,253158768}, 
+    {350539046,253147538,350492758,253178566}, {344503768,253147936,344482244,253207603}, {336096384,253151348,336025060,253219942}, 
+    {347061346,253158768,347080327,253176257}, {347080327,253176257,347099752,253193410}, {350492758,253178566,350446307,253208338}, 
+    {347099752,253193410,347119614,253210230}, {344482244,253207603,344459486,253267097}, {350446307,253208338,350399725,253236821}, 
+    {347119614,253210230,347139906,253226717}, {336025060,253219942,335955298,253290408}, {347139906,253226717,347160619,253242872}, 
+    {350399725,253236821,350353047,253263983}, {347160619,253242872,347181748,253258696}, {347181748,253258696,347203285,253274191}, 
+    {350353047,253263983,350306304,253289792}, {344459486,253267097,344435485,253326403}, {347203285,253274191,347225222,253289357}, 
+    {347225222,253289357,347247553,253304196}, {350306304,253289792,350257310,253315313}, {335955298,253290408,335887154,253362735}, 
+    {347247553,253304196,347270270,253318709}, {350257310,253315313,350206955,253339983}, {347270270,253318709,347316833,253346760}, 
+    {344435485,253326403,344410232,253385502}, {350206955,253339983,350155295,253363792}, {347316833,253346760,347364856,253373520}, 
+    {335887154,253362735,335820684,253436910}, {350155295,253363792,350102389,253386731}, {347364856,253373520,347414280,253398998}, 
+    {344410232,253385502,344383718,253444377}, {350102389,253386731,350048294,253408792}, {347414280,253398998,347465047,253423202}, 
+    {350048294,253408792,349993068,253429966}, {347465047,253423202,347517101,253446142}, {349993068,253429966,349936769,253450243}, 
+    {335820684,253436910,335755944,253512924}, {344383718,253444377,344355936,253503011}, {347517101,253446142,347570383,253467827}, 
+    {349936769,253450243,349879452,253469614}, {347570383,253467827,347624836,253488265}, {349879452,253469614,349821178,253488071}, 
+    {349821178,253488071,349762002,253505605}, {347624836,253488265,347680402,253507466}, {344355936,253503011,344326875,253561386}, 
+    {349762002,253505605,349701983,253522207}, {347680402,253507466,347737025,253525438}, {335755944,253512924,335692992,253590764}, 
+    {349701983,253522207,349641178,253537867}, {347737025,253525438,347794645,253542191}, {349641178,253537867,349517439,253566327}, 
+    {347794645,253542191,347853206,253557733}, {347853206,253557733,347912651,253572074}, {344326875,253561386,344296527,253619484}, 
+    {349517439,253566327,349391248,253590914}, {347912651,253572074,347972921,253585222}, {347972921,253585222,348033959,253597186}, 
+    {335692992,253590764,335631883,253670418}, {349391248,253590914,349263064,253611556}, {348033959,253597186,348095708,253607976}, 
+    {348095708,253607976,348158109,253617600}, {349263064,253611556,349133347,253628182}, {348158109,253617600,348221106,253626067}, 
+    {344296527,253619484,344264884,253677290}, {348221106,253626067,348284641,253633387}, {349133347,253628182,349002559,253640720}, 
+    {348284641,253633387,348348656,253639568}, {348348656,253639568,348413094,253644619}, {349002559,253640720,348871160,253649097}, 
+    {348413094,253644619,348477897,253648549}, {348477897,253648549,348608368,253653083}, {348871160,253649097,348739609,253653242}, 
+    {348608368,253653083,348739609,253653242}, {335631883,253670418,335572673,253751877}, {344264884,253677290,344231936,253734784}, 
+    {344231936,253734784,346916352,255661120}, {335572673,253751877,335515419,253835128}, {335515419,253835128,335460177,253920160}, 
+    {335460177,253920160,335407003,254006962}, {335407003,254006962,335355954,254095523}, {335355954,254095523,335307085,254185830}, 
+    {335307085,254185830,335260453,254277873}, {335260453,254277873,335216115,254371641}, {338215616,254285248,338082578,254397898}, 
+    {335216115,254371641,335174127,254467122}, {338082578,254397898,337957522,254509987}, {335174127,254467122,335134544,254564304}, 
+    {337957522,254509987,337840328,254621553}, {335134544,254564304,335097423,254663177}, {337840328,254621553,337730876,254732633}, 
+    {335097423,254663177,335062821,254763729}, {337730876,254732633,337679015,254788004}, {335062821,254763729,335030794,254865948}, 
+    {337679015,254788004,337629045,254843267}, {337629045,254843267,337580949,254898429}, {335030794,254865948,335001398,254969824}, 
+    {337580949,254898429,337534713,254953493}, {337534713,254953493,337490322,255008465}, {335001398,254969824,334974688,255075345}, 
+    {337490322,255008465,337447761,255063349}, {343452544,255011072,342956224,255347968}, {343452544,255011072,345413312,256712064}, 
+    {337447761,255063349,337407015,255118151}, {334974688,255075345,334950723,255182500}, {337407015,255118151,337368068,255172874}, 
+    {337368068,255172874,337330906,255227524}, {334950723,255182500,334929557,255291277}, {337330906,255227524,337295513,255282106}, 
+    {337295513,255282106,337261875,255336624}, {334929557,255291277,334911247,255401666}, {337261875,255336624,337229975,255391083}, 
+    {342956224,255347968,344021696,257691904}, {337229975,255391083,337199800,255445487}, {334911247,255401666,334895850,255513654}, 
+    {337199800,255445487,337171335,255499843}, {337171335,255499843,337144563,255554154}, {334895850,255513654,334883421,255627230}, 
+    {337144563,255554154,337119470,255608426}, {337119470,255608426,337096041,255662662}, {334883421,255627230,334874017,255742384}, 
+    {346916352,255661120,345413312,256712064}, {337096041,255662662,337074261,255716869}, {337074261,255716869,337054114,255771050}, 
+    {334874017,255742384,334867694,255859103}, {337054114,255771050,337035587,255825211}, {337035587,255825211,337018662,255879356}, 
+    {334867694,255859103,334864509,255977376}, {337018662,255879356,337003327,255933490}, {337003327,255933490,336989564,255987617}, 
+    {334864509,255977376,334864517,256097193}, {336989564,255987617,336977360,256041744}, {336977360,256041744,336966699,256095874}, 
+    {336966699,256095874,336957566,256150012}, {334864517,256097193,334867775,256218541}, {336957566,256150012,336949947,256204164}, 
+    {336949947,256204164,336943825,256258333}, {334867775,256218541,334874340,256341410}, {336943825,256258333,336939186,256312525}, 
+    {336939186,256312525,336936015,256366744}, {334874340,256341410,334884267,256465788}, {336936015,256366744,336934297,256420996}, 
+    {336934297,256420996,336934016,256475284}, {334884267,256465788,334897613,256591663}, {336934016,256475284,336935158,256529615}, 
+    {336935158,256529615,336937707,256583992}, {336937707,256583992,336941649,256638420}, {334897613,256591663,334914434,256719025}, 
+    {336941649,256638420,336946968,256692905}, {336946968,256692905,336953649,256747451}, {334914434,256719025,334934786,256847862}, 
+    {336953649,256747451,336961678,256802062}, {336961678,256802062,336971038,256856744}, {334934786,256847862,334958727,256978163}, 
+    {336971038,256856744,336981716,256911502}, {336981716,256911502,336993695,256966340}, {336993695,256966340,337006962,257021263}, 
+    {334958727,256978163,334986310,257109916}, {337006962,257021263,337021500,257076275}, {337021500,257076275,337037294,257131382}, 
+    {334986310,257109916,335017594,257243110}, {337037294,257131382,337054331,257186589}, {337054331,257186589,337072593,257241900}, 
+    {337072593,257241900,337092068,257297319}, {335017594,257243110,335052635,257377733}, {337092068,257297319,337112738,257352853}, 
+    {337112738,257352853,337157608,257464280}, {335052635,257377733,335091488,257513775}, {337157608,257464280,337207082,257576220}, 
+    {335091488,257513775,335134210,257651224}, {337207082,257576220,337261039,257688711}, {335134210,257651224,335180858,257790069}, 
+    {337261039,257688711,337319360,257801792}, {344021696,257691904,342320320,258870720}, {335180858,257790069,335231487,257930298}, 
+    {337319360,257801792,337354303,257865336}, {337354303,257865336,337389928,257926241}, {337389928,257926241,337426213,257984550}, 
+    {335231487,257930298,335286154,258071901}, {337426213,257984550,337463138,258040306}, {337463138,258040306,337500682,258093553}, 
+    {335286154,258071901,335344915,258214864}, {337500682,258093553,337538825,258144333}, {337538825,258144333,337577546,258192690}, 
+    {337577546,258192690,337616824,258238667}, {335344915,258214864,335407826,258359179}, {337616824,258238667,337656639,258282307}, 
+    {337656639,258282307,337696970,258323653}, {337696970,258323653,337737797,258362749}, {340070016,258346944,339916136,258420606}, 
+    {340070016,258346944,340768320,259745536}, {335407826,258359179,335474944,258504832}, {337737797,258362749,337758390,258381467}, 
+    {337758390,258381467,337779099,258399638}, {337779099,258399638,337799922,258417268}, {337799922,258417268,337820855,258434362}, 
+    {339916136,258420606,339753694,258492798}, {337820855,258434362,337841897,258450926}, {337841897,258450926,337863045,258466965}, 
+    {337863045,258466965,337884296,258482485}, {337884296,258482485,337905648,258497490}, {339753694,258492798,339669675,258527479}, 
+    {337905648,258497490,337927098,258511987}, {335474944,258504832,335563202,258686984}, {337927098,258511987,337948644,258525981}, 
+    {337948644,258525981,337970283,258539477}, {339669675,258527479,339584010,258560757}, {337970283,258539477,337992012,258552480}, 
+    {337992012,258552480,338013828,258564996}, {339584010,258560757,339496865,258592285}, {338013828,258564996,338035730,258577031}, 
+    {338035730,258577031,338057715,258588589}, {338057715,258588589,338079780,258599677}, {339496865,258592285,339408404,258621719}, 
+    {338079780,258599677,338101922,258610298}, {338101922,258610298,338124139,258620460}, {338124139,258620460,338146429,258630167}, 
+    {339408404,258621719,339318792,258648713}, {338146429,258630167,338168788,258639425}, {338168788,258639425,338191215,258648239}, 
+    {338191215,258648239,338213706,258656614}, {339318792,258648713,339228194,258672922}, {338213706,258656614,338236260,258664556}, 
+    {338236260,258664556,338258872,258672071}, {338258872,258672071,338281542,258679163}, {339228194,258672922,339182577,258683874}, 
+    {338281542,258679163,338304266,258685838}, {339182577,258683874,339136775,258694000}, {338304266,258685838,338349867,258697960}, 
+    {335563202,258686984,335651857,258861410}, {339136775,258694000,339090809,258703258}, {338349867,258697960,338395654,258708478}, 
+    {339090809,258703258,339044700,258711603}, {338395654,258708478,338441607,258717437}, {339044700,258711603,338998468,258718992}, 
+    {338441607,258717437,338487705,258724879}, {338998468,258718992,338952134,258725384}, {338487705,258724879,338533927,258730847}, 
+    {338952134,258725384,338905718,258730733}, {338905718,258730733,338859241,258734998}, {338533927,258730847,338580254,258735385}, 
+    {338859241,258734998,338812724,258738134}, {338580254,258735385,338626663,258738537}, {338812724,258738134,338766187,258740100}, 
+    {338626663,258738537,338673136,258740344}, {338766187,258740100,338719651,258740851}, {338673136,258740344,338719651,258740851}, 
+    {335651857,258861410,335740882,259028232}, {335740882,259028232,335830249,259187575}, {335830249,259187575,335919930,259339563}, 
+    {335919930,259339563,336009898,259484320}, {336009898,259484320,336100124,259621969}, {336100124,259621969,336190581,259752634}, 
+    {340768320,259745536,340648811,259870989}, {336190581,259752634,336281241,259876439}, {340648811,259870989,340524120,259995755}, 
+    {336281241,259876439,336372076,259993509}, {336372076,259993509,336463059,260103966}, {340524120,259995755,340394469,260118844}, 
+    {336463059,260103966,336554162,260207935}, {340394469,260118844,340260079,260239264}, {336554162,260207935,336645358,260305539}, 
+    {340260079,260239264,340121174,260356025}, {336645358,260305539,336736617,260396903}, {340121174,260356025,340050097,260412724}, 
+    {336736617,260396903,336782262,260440283}, {340050097,260412724,339977975,260468136}, {336782262,260440283,336827913,260482150}, 
+    {339977975,260468136,339904834,260522138}, {336827913,260482150,336873566,260522518}, {339904834,260522138,339830703,260574606}, 
+    {336873566,260522518,336919218,260561404}, {336919218,260561404,336964865,260598822}, {339830703,260574606,339755610,260625416}, 
+    {336964865,260598822,337010504,260634789}, {339755610,260625416,339679582,260674444}, {337010504,260634789,337056131,260669320}, 
+    {337056131,260669320,337101743,260702429}, {339679582,260674444,339602647,260721567}, {337101743,260702429,337147337,260734133}, 
+    {339602647,260721567,339524833,260766660}, {337147337,260734133,337192908,260764448}, {337192908,260764448,337238454,260793388}, 
+    {339524833,260766660,339446167,260809599}, {337238454,260793388,337283971,260820969}, {339446167,260809599,339366678,260850262}, 
+    {337283971,260820969,337329456,260847207}, {337329456,260847207,337374904,260872116}, {339366678,260850262,339286392,260888523}, 
+    {337374904,260872116,337420313,260895714}, {339286392,260888523,339205339,260924259}, {337420313,260895714,337465680,260918014}, 
+    {337465680,260918014,337510999,260939033}, {339205339,260924259,339123545,260957347}, {337510999,260939033,337556270,260958786}, 
+    {339123545,260957347,339041038,260987662}, {337556270,260958786,337601486,260977289}, {337601486,260977289,337646646,260994556}, 
+    {339041038,260987662,338957846,261015080}, {337646646,260994556,337691746,261010604}, {337691746,261010604,337736782,261025448}, 
+    {338957846,261015080,338916002,261027665}, {337736782,261025448,337781751,261039103}, {338916002,261027665,338873997,261039479}, 
+    {337781751,261039103,337826649,261051585}, {338873997,261039479,338831835,261050506}, {338831835,261050506,338789519,261060733}, 
+    {337826649,261051585,337871473,261062910}, {338789519,261060733,338747052,261070142}, {337871473,261062910,337916220,261073092}, 
+    {338747052,261070142,338704438,261078718}, {337916220,261073092,337960886,261082148}, {338704438,261078718,338661681,261086447}, 
+    {337960886,261082148,338005467,261090092}, {338661681,261086447,338618784,261093312}, {338005467,261090092,338049960,261096941}, 
+    {338618784,261093312,338575751,261099299}, {338049960,261096941,338094361,261102710}, {338575751,261099299,338532584,261104390}, 
+    {338094361,261102710,338138668,261107414}, {338532584,261104390,338489288,261108572}, {338138668,261107414,338182876,261111068}, 
+    {338489288,261108572,338445865,261111829}, {338182876,261111068,338226983,261113689}, {338445865,261111829,338402320,261114145}, 
+    {338226983,261113689,338270984,261115292}, {338402320,261114145,338358656,261115504}, {338270984,261115292,338314876,261115892}, 
+    {338358656,261115504,338314876,261115892}, 
+};
+
+const Segment SEGMENTS_RIGHT_LEG_DOWN[] = {
+    {276894648,251603997,276928292,251604057}, {276894648,251603997,276861174,251604710}, {276928292,251604057,276962097,251604897}, 
+    {276861174,251604710,276827879,251606187}, {276962097,251604897,276996056,251606526}, {276827879,251606187,276794771,251608418}, 
+    {276996056,251606526,277030158,251608954}, {276794771,251608418,276761859,251611396}, {277030158,251608954,277064397,251612188}, 
+    {276761859,251611396,276729151,251615111}, {277064397,251612188,277098763,251616237}, {276729151,251615111,276696657,251619556}, 
+    {277098763,251616237,277133248,251621110}, {276696657,251619556,276664383,251624722}, {277133248,251621110,277167844,251626815}, 
+    {276664383,251624722,276632340,251630599}, {277167844,251626815,277202540,251633361}, {276632340,251630599,276600536,251637180}, 
+    {277202540,251633361,277237330,251640757}, {276600536,251637180,276568978,251644456}, {277237330,251640757,277272205,251649010}, 
+    {276568978,251644456,276537677,251652418}, {277272205,251649010,277307155,251658131}, {276537677,251652418,276506639,251661058}, 
+    {277307155,251658131,277342173,251668127}, {276506639,251661058,276475875,251670367}, {277342173,251668127,277377250,251679006}, 
+    {276475875,251670367,276445392,251680336}, {277377250,251679006,277412376,251690779}, {276445392,251680336,276415199,251690957}, 
+    {277412376,251690779,277447545,251703452}, {276415199,251690957,276385304,251702221}, {276385304,251702221,276355717,251714120}, 
+    {277447545,251703452,277482747,251717035}, {276355717,251714120,276326445,251726646}, {277482747,251717035,277517973,251731536}, 
+    {276326445,251726646,276297498,251739788}, {277517973,251731536,277553216,251746964}, {276297498,251739788,276268883,251753540}, 
+    {277553216,251746964,277588466,251763327}, {276268883,251753540,276240609,251767892}, {277588466,251763327,277623715,251780635}, 
+    {276240609,251767892,276212686,251782835}, {277623715,251780635,277658954,251798895}, {276212686,251782835,276185121,251798362}, 
+    {276185121,251798362,276157923,251814464}, {277658954,251798895,277694175,251818117}, {276157923,251814464,276131100,251831131}, 
+    {277694175,251818117,277729369,251838308}, {276131100,251831131,276104662,251848355}, {277729369,251838308,277764528,251859477}, 
+    {276104662,251848355,276078616,251866129}, {277764528,251859477,277799643,251881634}, {276078616,251866129,276052972,251884442}, 
+    {277799643,251881634,277834706,251904786}, {276052972,251884442,276027738,251903287}, {276027738,251903287,276002921,251922656}, 
+    {277834706,251904786,277869708,251928943}, {276002921,251922656,275978532,251942538}, {277869708,251928943,277904640,251954112}, 
+    {275978532,251942538,275954578,251962926}, {277904640,251954112,278008456,252033283}, {275954578,251962926,275931069,251983812}, 
+    {275931069,251983812,275908012,252005186}, {275908012,252005186,275885416,252027040}, {275885416,252027040,275863290,252049366}, 
+    {278008456,252033283,278111150,252117037}, {275863290,252049366,275841642,252072154}, {275841642,252072154,275820481,252095396}, 
+    {275820481,252095396,275799816,252119085}, {278111150,252117037,278212645,252205169}, {275799816,252119085,275779654,252143210}, 
+    {275779654,252143210,275760005,252167764}, {275760005,252167764,275740878,252192737}, {275740878,252192737,275722279,252218122}, 
+    {278212645,252205169,278312863,252297477}, {275722279,252218122,275704219,252243910}, {275704219,252243910,275686706,252270091}, 
+    {275686706,252270091,275669748,252296659}, {275669748,252296659,275653355,252323603}, {278312863,252297477,278411727,252393757}, 
+    {275653355,252323603,275637533,252350915}, {275637533,252350915,275622293,252378587}, {275622293,252378587,275607642,252406610}, 
+    {278411727,252393757,278509161,252493805}, {275607642,252406610,275593589,252434976}, {275593589,252434976,275580143,252463675}, 
+    {275580143,252463675,275567313,252492700}, {275567313,252492700,275555106,252522042}, {278509161,252493805,278605087,252597417}, 
+    {275555106,252522042,275543532,252551692}, {275543532,252551692,275532598,252581641}, {275532598,252581641,275522314,252611882}, 
+    {278605087,252597417,278699429,252704390}, {275522314,252611882,275512688,252642404}, {275512688,252642404,275503729,252673201}, 
+    {275503729,252673201,275495445,252704263}, {275495445,252704263,275487845,252735581}, {278699429,252704390,278792109,252814520}, 
+    {275487845,252735581,275480937,252767147}, {275480937,252767147,275474729,252798953}, {275474729,252798953,275469232,252830989}, 
+    {278792109,252814520,278883051,252927605}, {275469232,252830989,275464452,252863248}, {275464452,252863248,275460399,252895721}, 
+    {275460399,252895721,275457081,252928398}, {278883051,252927605,278972177,253043439}, {275457081,252928398,275454507,252961272}, 
+    {275454507,252961272,275452685,252994334}, {275452685,252994334,275451623,253027575}, {275451623,253027575,275451331,253060986}, 
+    {278972177,253043439,279059411,253161820}, {275451331,253060986,275451817,253094560}, {275451817,253094560,275453090,253128287}, 
+    {275453090,253128287,275455157,253162159}, {279059411,253161820,279144675,253282543}, {275455157,253162159,275458028,253196167}, 
+    {275458028,253196167,275461712,253230303}, {275461712,253230303,275466216,253264559}, {275466216,253264559,275471549,253298924}, 
+    {279144675,253282543,279227893,253405406}, {275471549,253298924,275477720,253333392}, {275477720,253333392,275484738,253367953}, 
+    {275484738,253367953,275492610,253402598}, {275492610,253402598,275501346,253437320}, {279227893,253405406,279308987,253530205}, 
+    {275501346,253437320,275510954,253472109}, {275510954,253472109,275521443,253506957}, {275521443,253506957,275532821,253541856}, 
+    {279308987,253530205,279387880,253656736}, {275532821,253541856,275545096,253576796}, {275545096,253576796,275558278,253611770}, 
+    {275558278,253611770,275572375,253646768}, {275572375,253646768,275587396,253681782}, {279387880,253656736,279464496,253784795}, 
+    {275587396,253681782,275603348,253716804}, {275603348,253716804,275620241,253751824}, {275620241,253751824,275638083,253786835}, 
+    {279464496,253784795,279538757,253914180}, {275638083,253786835,275656883,253821827}, {275656883,253821827,275676649,253856792}, 
+    {275676649,253856792,275697390,253891721}, {275697390,253891721,275719114,253926607}, {279538757,253914180,279610587,254044685}, 
+    {275719114,253926607,275741830,253961439}, {275741830,253961439,275765546,253996211}, {275765546,253996211,275790272,254030912}, 
+    {275790272,254030912,276050580,254394744}, {279610587,254044685,279679908,254176108}, {279679908,254176108,279746644,254308246}, 
+    {279746644,254308246,279810717,254440893}, {276050580,254394744,276192534,254601504}, {279810717,254440893,279872050,254573848}, 
+    {279872050,254573848,279930567,254706906}, {276192534,254601504,276338119,254822484}, {279930567,254706906,279986190,254839864}, 
+    {276338119,254822484,276484160,255055928}, {279986190,254839864,280038843,254972517}, {280038843,254972517,280088448,255104664}, 
+    {276484160,255055928,276627480,255300078}, {280088448,255104664,280134928,255236099}, {280134928,255236099,280178207,255366619}, 
+    {276627480,255300078,276697128,255425620}, {280178207,255366619,280218207,255496021}, {276697128,255425620,276764904,255553179}, 
+    {280218207,255496021,280254852,255624101}, {276764904,255553179,276830413,255682536}, {280254852,255624101,280288064,255750656}, 
+    {276830413,255682536,276893256,255813472}, {280288064,255750656,280305621,255825356}, {276893256,255813472,276953037,255945767}, 
+    {280305621,255825356,280321038,255900455}, {280321038,255900455,280334375,255975934}, {276953037,255945767,277009360,256079201}, 
+    {280334375,255975934,280345695,256051772}, {280345695,256051772,280355060,256127950}, {277009360,256079201,277061826,256213555}, 
+    {280355060,256127950,280362530,256204447}, {280362530,256204447,280368168,256281243}, {277061826,256213555,277110039,256348610}, 
+    {280368168,256281243,280372035,256358318}, {277110039,256348610,277153602,256484144}, {280372035,256358318,280374192,256435651}, 
+    {280374192,256435651,280374703,256513223}, {277153602,256484144,277173516,256552023}, {280374703,256513223,280373627,256591014}, 
+    {277173516,256552023,277192118,256619940}, {280373627,256591014,280371027,256669003}, {277192118,256619940,277209359,256687867}, 
+    {280371027,256669003,280366964,256747170}, {277209359,256687867,277225190,256755777}, {280366964,256747170,280361501,256825495}, 
+    {277225190,256755777,277239560,256823643}, {277239560,256823643,277252421,256891436}, {280361501,256825495,280346617,256982538}, 
+    {277252421,256891436,277263722,256959130}, {277263722,256959130,277273414,257026697}, {280346617,256982538,280326869,257139971}, 
+    {277273414,257026697,277281447,257094110}, {277281447,257094110,277287772,257161340}, {280326869,257139971,280302749,257297634}, 
+    {277287772,257161340,277292339,257228362}, {277292339,257228362,277295098,257295147}, {277295098,257295147,277296000,257361667}, 
+    {280302749,257297634,280274752,257455364}, {277296000,257361667,277294995,257427896}, {277294995,257427896,277292033,257493806}, 
+    {280274752,257455364,280243369,257613001}, {277292033,257493806,277287065,257559370}, {277287065,257559370,277280042,257624559}, 
+    {280243369,257613001,280172420,257927350}, {277280042,257624559,277270913,257689347}, {277270913,257689347,277259630,257753706}, 
+    {277259630,257753706,277253164,257785717}, {277253164,257785717,277246141,257817609}, {277246141,257817609,277238555,257849381}, 
+    {277238555,257849381,277230399,257881028}, {277230399,257881028,277221666,257912548}, {277221666,257912548,277212352,257943936}, 
+    {280172420,257927350,280093848,258239392}, {277212352,257943936,277153116,258126873}, {277153116,258126873,277089681,258304240}, 
+    {280093848,258239392,279929612,258851395}, {277089681,258304240,277022424,258476582}, {277022424,258476582,276951720,258644445}, 
+    {276951720,258644445,276877945,258808374}, {276877945,258808374,276801475,258968913}, {279929612,258851395,279851838,259148777}, 
+    {285863683,258940626,285908091,258940741}, {285863683,258940626,285819531,258941725}, {285908091,258940741,285952733,258942051}, 
+    {285819531,258941725,285775661,258944056}, {285952733,258942051,285997586,258944537}, {285775661,258944056,285732095,258947638}, 
+    {285997586,258944537,286042626,258948180}, {285732095,258947638,285688857,258952490}, {286042626,258948180,286087829,258952961}, 
+    {285688857,258952490,285645969,258958631}, {286087829,258952961,286133173,258958862}, {285645969,258958631,285603456,258966080}, 
+    {286133173,258958862,286178634,258965863}, {286178634,258965863,286224188,258973947}, {285603456,258966080,285529209,258981384}, 
+    {276801475,258968913,276641950,259282008}, {286224188,258973947,286269812,258983093}, {285529209,258981384,285454909,258998806}, 
+    {286269812,258983093,286315482,258993283}, {286315482,258993283,286361176,259004499}, {285454909,258998806,285380559,259018279}, 
+    {286361176,259004499,286406869,259016721}, {286406869,259016721,286452538,259029930}, {285380559,259018279,285306160,259039735}, 
+    {286452538,259029930,286498161,259044109}, {285306160,259039735,285231714,259063107}, {286498161,259044109,286543712,259059238}, 
+    {286543712,259059238,286589170,259075297}, {285231714,259063107,285157223,259088328}, {286589170,259075297,286634510,259092269}, 
+    {285157223,259088328,285082689,259115332}, {286634510,259092269,286679710,259110135}, {286679710,259110135,286724745,259128875}, 
+    {285082689,259115332,285008114,259144050}, {286724745,259128875,286769592,259148472}, {285008114,259144050,284933500,259174416}, 
+    {286769592,259148472,286858631,259190156}, {279851838,259148777,279782219,259438694}, {284933500,259174416,284858849,259206363}, 
+    {286858631,259190156,286946637,259235039}, {284858849,259206363,284709444,259274729}, {286946637,259235039,287033424,259282968}, 
+    {284709444,259274729,284559914,259348613}, {276641950,259282008,276307085,259891527}, {287033424,259282968,287118804,259333794}, 
+    {287118804,259333794,287202591,259387365}, {284559914,259348613,284410275,259427476}, {287202591,259387365,287284596,259443531}, 
+    {284410275,259427476,284260542,259510782}, {279782219,259438694,279751701,259580450}, {287284596,259443531,287364632,259502142}, 
+    {287364632,259502142,287442512,259563046}, {284260542,259510782,284110732,259597993}, {287442512,259563046,287518049,259626094}, 
+    {279751701,259580450,279724700,259719856}, {284110732,259597993,283810941,259781984}, {287518049,259626094,287591055,259691135}, 
+    {287591055,259691135,287661342,259758017}, {279724700,259719856,279701711,259856751}, {287661342,259758017,287728724,259826591}, 
+    {283810941,259781984,283211112,260173200}, {287728724,259826591,287761266,259861465}, {279701711,259856751,279683226,259990974}, 
+    {287761266,259861465,287793012,259896705}, {276307085,259891527,275971168,260507904}, {287793012,259896705,287823938,259932293}, 
+    {287823938,259932293,287854020,259968210}, {287854020,259968210,287883236,260004436}, {279683226,259990974,279675827,260057033}, 
+    {287883236,260004436,287911561,260040954}, {287911561,260040954,287938972,260077743}, {279675827,260057033,279669739,260122364}, 
+    {287938972,260077743,287965446,260114786}, {287965446,260114786,287990959,260152064}, {279669739,260122364,279665023,260186946}, 
+    {287990959,260152064,288015488,260189558}, {283211112,260173200,282611790,260566750}, {279665023,260186946,279661742,260250759}, 
+    {288015488,260189558,288039010,260227248}, {288039010,260227248,288061501,260265116}, {279661742,260250759,279659957,260313783}, 
+    {288061501,260265116,288082937,260303144}, {288082937,260303144,288103296,260341312}, {279659957,260313783,279659729,260375998}, 
+    {288103296,260341312,288136920,260408327}, {279659729,260375998,279661120,260437384}, {288136920,260408327,288168059,260474767}, 
+    {279661120,260437384,279664192,260497920}, {288168059,260474767,288196767,260540638}, {279664192,260497920,279669808,260568517}, 
+    {275971168,260507904,275810329,260829571}, {288196767,260540638,288223096,260605947}, {282611790,260566750,282312633,260753658}, 
+    {279669808,260568517,279677268,260636495}, {288223096,260605947,288247100,260670700}, {279677268,260636495,279686586,260701845}, 
+    {288247100,260670700,288268832,260734904}, {279686586,260701845,279691946,260733533}, {279691946,260733533,279697776,260764560}, 
+    {288268832,260734904,288288345,260798565}, {282312633,260753658,282163234,260842766}, {279697776,260764560,279704078,260794927}, 
+    {279704078,260794927,279710853,260824632}, {288288345,260798565,288305693,260861689}, {279710853,260824632,279718102,260853674}, 
+    {275810329,260829571,275733004,260995683}, {282163234,260842766,282013977,260928260}, {279718102,260853674,279725828,260882052}, 
+    {288305693,260861689,288320928,260924284}, {279725828,260882052,279734032,260909765}, {279734032,260909765,279742717,260936812}, 
+    {288320928,260924284,288334103,260986355}, {282013977,260928260,281864877,261009603}, {279742717,260936812,279751883,260963192}, 
+    {279751883,260963192,279761532,260988904}, {288334103,260986355,288345273,261047909}, {279761532,260988904,279771667,261013947}, 
+    {275733004,260995683,275658243,261166041}, {281864877,261009603,281715949,261086258}, {279771667,261013947,279782288,261038320}, 
+    {279782288,261038320,279793398,261062022}, {288345273,261047909,288354489,261108952}, {279793398,261062022,279804999,261085052}, 
+    {279804999,261085052,279817091,261107409}, {281715949,261086258,281567209,261157688}, {279817091,261107409,279829677,261129092}, 
+    {288354489,261108952,288361806,261169491}, {279829677,261129092,279842759,261150100}, {279842759,261150100,279856338,261170432}, 
+    {281567209,261157688,281418673,261223356}, {275658243,261166041,275586422,261341190}, {288361806,261169491,288367276,261229533}, 
+    {279856338,261170432,279870415,261190086}, {279870415,261190086,279884993,261209063}, {279884993,261209063,279900074,261227360}, 
+    {281418673,261223356,281344486,261253861}, {279900074,261227360,279907803,261236254}, {288367276,261229533,288370953,261289084}, 
+    {279907803,261236254,279915659,261244977}, {279915659,261244977,279923641,261253530}, {279923641,261253530,279931749,261261913}, 
+    {281344486,261253861,281270357,261282725}, {279931749,261261913,279939984,261270125}, {279939984,261270125,279948347,261278167}, 
+    {279948347,261278167,279956837,261286038}, {281270357,261282725,281196286,261309879}, {279956837,261286038,279965454,261293738}, 
+    {288370953,261289084,288372889,261348150}, {279965454,261293738,279974199,261301266}, {279974199,261301266,279983072,261308624}, 
+    {279983072,261308624,279992073,261315810}, {281196286,261309879,281122275,261335257}, {279992073,261315810,280001203,261322825}, 
+    {280001203,261322825,280010461,261329669}, {280010461,261329669,280019848,261336340}, {281122275,261335257,281048327,261358792}, 
+    {280019848,261336340,280029363,261342840}, {275586422,261341190,275517916,261521676}, {280029363,261342840,280039009,261349168}, 
+    {288372889,261348150,288373138,261406738}, {280039009,261349168,280048783,261355324}, {280048783,261355324,280058687,261361307}, 
+    {281048327,261358792,280974444,261380416}, {280058687,261361307,280068721,261367119}, {280068721,261367119,280078886,261372758}, 
+    {280078886,261372758,280089180,261378224}, {280089180,261378224,280099605,261383518}, {280974444,261380416,280900628,261400062}, 
+    {280099605,261383518,280110161,261388638}, {280110161,261388638,280120847,261393586}, {280120847,261393586,280131665,261398361}, 
+    {280131665,261398361,280142614,261402962}, {280900628,261400062,280826880,261417664}, {280142614,261402962,280153695,261407391}, 
+    {288373138,261406738,288371754,261464854}, {280153695,261407391,280164908,261411645}, {280164908,261411645,280187729,261419634}, 
+    {280826880,261417664,280757699,261432034}, {280187729,261419634,280211081,261426927}, {280211081,261426927,280234963,261433524}, 
+    {280757699,261432034,280723955,261438145}, {280234963,261433524,280259379,261439424}, {280723955,261438145,280690774,261443542}, 
+    {280259379,261439424,280284330,261444625}, {280690774,261443542,280658154,261448224}, {280284330,261444625,280309818,261449127}, 
+    {280658154,261448224,280626092,261452195}, {280309818,261449127,280335844,261452928}, {280626092,261452195,280594588,261455453}, 
+    {280335844,261452928,280362410,261456028}, {280594588,261455453,280563640,261458002}, {280362410,261456028,280389518,261458425}, 
+    {280563640,261458002,280533245,261459840}, {280389518,261458425,280417169,261460119}, {280533245,261459840,280503402,261460970}, 
+    {280417169,261460119,280445366,261461109}, {280503402,261460970,280474110,261461393}, {280445366,261461109,280474110,261461393}, 
+    {288371754,261464854,288368788,261522505}, {275517916,261521676,275453102,261708044}, {288368788,261522505,288364295,261579697}, 
+    {288364295,261579697,288358328,261636437}, {288358328,261636437,288350939,261692731}, {288350939,261692731,288342182,261748586}, 
+    {275453102,261708044,275392354,261900840}, {288342182,261748586,288332111,261804008}, {288332111,261804008,288320778,261859003}, 
+    {288320778,261859003,288308236,261913579}, {275392354,261900840,275336049,262100608}, {288308236,261913579,288294539,261967741}, 
+    {288294539,261967741,288279739,262021496}, {288279739,262021496,288263891,262074851}, {288263891,262074851,288247047,262127811}, 
+    {275336049,262100608,275284561,262307895}, {288247047,262127811,288229260,262180384}, {288229260,262180384,288210584,262232576}, 
+    {288210584,262232576,288170776,262335842}, {275284561,262307895,275238268,262523244}, {288170776,262335842,288128048,262437662}, 
+    {288128048,262437662,288082825,262538087}, {275238268,262523244,275197544,262747203}, {288082825,262538087,288035534,262637168}, 
+    {288035534,262637168,287936446,262831509}, {275197544,262747203,275162765,262980316}, {287936446,262831509,287834187,263021098}, 
+    {275162765,262980316,275134307,263223128}, {287834187,263021098,287633768,263387679}, {275134307,263223128,275112545,263476185}, 
+    {287633768,263387679,287542415,263565499}, {275112545,263476185,275097856,263740032}, {287542415,263565499,287500442,263653222}, 
+    {287500442,263653222,287461504,263740224}, {275097856,263740032,287461504,263740224}, 
+};
+
+const Segment SEGMENTS_RIGHT_LEG_UP[] = {
+    {297119692,244086099,297218869,244088467}, {297119692,244086099,297020298,244086862}, {297020298,244086862,296920926,244090773}, 
+    {297218869,244088467,297317587,244093950}, {296920926,244090773,296821816,244097848}, {297317587,244093950,297415608,244102531}, 
+    {296821816,244097848,296723207,244108104}, {297415608,244102531,297512692,244114194}, {296723207,244108104,296625340,244121556}, 
+    {297512692,244114194,297608599,244128923}, {296625340,244121556,296528454,244138222}, {297608599,244128923,297703089,244146701}, 
+    {296528454,244138222,296480453,244147765}, {297703089,244146701,297749728,244156728}, {296480453,244147765,296432788,244158118}, 
+    {297749728,244156728,297795922,244167511}, {296432788,244158118,296385489,244169282}, {297795922,244167511,297841643,244179048}, 
+    {296385489,244169282,296338584,244181260}, {297841643,244179048,297886859,244191337}, {296338584,244181260,296292104,244194054}, 
+    {297886859,244191337,297931542,244204376}, {296292104,244194054,296246080,244207665}, {297931542,244204376,297975660,244218163}, 
+    {296246080,244207665,296200541,244222096}, {297975660,244218163,298019184,244232696}, {296200541,244222096,296155516,244237349}, 
+    {298019184,244232696,298062084,244247973}, {296155516,244237349,296111037,244253426}, {298062084,244247973,298104331,244263991}, 
+    {296111037,244253426,296067133,244270329}, {298104331,244263991,298145893,244280749}, {296067133,244270329,296023834,244288060}, 
+    {298145893,244280749,298186742,244298244}, {296023834,244288060,295981170,244306621}, {298186742,244298244,298226846,244316475}, 
+    {295981170,244306621,295939170,244326014}, {298226846,244316475,298266177,244335440}, {295939170,244326014,295897866,244346241}, 
+    {298266177,244335440,298304704,244355136}, {295897866,244346241,295857286,244367305}, {298304704,244355136,298371052,244390994}, 
+    {295857286,244367305,295817462,244389207}, {295817462,244389207,295778422,244411949}, {298371052,244390994,298435920,244427933}, 
+    {295778422,244411949,295740197,244435534}, {298435920,244427933,298499325,244465924}, {295740197,244435534,295702817,244459963}, 
+    {295702817,244459963,295666312,244485238}, {298499325,244465924,298561287,244504938}, {295666312,244485238,295630711,244511363}, 
+    {298561287,244504938,298621824,244544945}, {295630711,244511363,295596045,244538337}, {295596045,244538337,295562344,244566165}, 
+    {298621824,244544945,298680955,244585917}, {295562344,244566165,295529637,244594847}, {298680955,244585917,298738698,244627823}, 
+    {295529637,244594847,295497955,244624386}, {295497955,244624386,295467328,244654784}, {298738698,244627823,298795074,244670634}, 
+    {295467328,244654784,295415189,244709664}, {298795074,244670634,298850099,244714321}, {295415189,244709664,295364327,244766126}, 
+    {298850099,244714321,298903793,244758854}, {298903793,244758854,298956175,244804205}, {295364327,244766126,295314702,244824120}, 
+    {298956175,244804205,299007263,244850343}, {295314702,244824120,295266274,244883595}, {285444776,244845228,285801629,244846918}, 
+    {285444776,244845228,285096100,244853772}, {285801629,244846918,286162152,244860260}, {299007263,244850343,299057076,244897239}, 
+    {285096100,244853772,284760106,244871131}, {286162152,244860260,286342382,244871744}, {284760106,244871131,284441301,244895888}, 
+    {286342382,244871744,286521840,244886672}, {295266274,244883595,295219001,244944502}, {286521840,244886672,286699962,244905223}, 
+    {284441301,244895888,284144190,244926624}, {299057076,244897239,299105632,244944864}, {286699962,244905223,286876186,244927573}, 
+    {284144190,244926624,283873280,244961920}, {286876186,244927573,287049948,244953899}, {295219001,244944502,295172845,245006791}, 
+    {299105632,244944864,299152952,244993188}, {287049948,244953899,287220685,244984380}, {283873280,244961920,283831623,244968491}, 
+    {283831623,244968491,283790702,244976029}, {283790702,244976029,283750516,244984519}, {287220685,244984380,287387833,245019192}, 
+    {283750516,244984519,283711064,244993944}, {299152952,244993188,299199052,245042183}, {283711064,244993944,283672344,245004290}, 
+    {283672344,245004290,283634354,245015540}, {295172845,245006791,295127764,245070410}, {283634354,245015540,283597094,245027679}, 
+    {287387833,245019192,287550830,245058512}, {283597094,245027679,283560562,245040691}, {283560562,245040691,283524757,245054561}, 
+    {299199052,245042183,299243952,245091818}, {283524757,245054561,283489677,245069274}, {287550830,245058512,287630596,245079919}, 
+    {283489677,245069274,283455321,245084813}, {295127764,245070410,295083719,245135310}, {287630596,245079919,287709112,245102519}, 
+    {283455321,245084813,283421687,245101164}, {299243952,245091818,299287671,245142065}, {283421687,245101164,283388775,245118309}, 
+    {287709112,245102519,287786309,245126334}, {283388775,245118309,283356583,245136235}, {287786309,245126334,287862116,245151388}, 
+    {295083719,245135310,295040668,245201441}, {283356583,245136235,283325110,245154925}, {299287671,245142065,299330228,245192893}, 
+    {287862116,245151388,287936463,245177702}, {283325110,245154925,283294353,245174363}, {283294353,245174363,283264313,245194535}, 
+    {287936463,245177702,288009278,245205298}, {299330228,245192893,299371640,245244274}, {283264313,245194535,283234987,245215424}, 
+    {295040668,245201441,294998572,245268752}, {288009278,245205298,288080493,245234198}, {283234987,245215424,283206374,245237015}, 
+    {288080493,245234198,288150036,245264425}, {283206374,245237015,283178473,245259293}, {299371640,245244274,299411927,245296178}, 
+    {283178473,245259293,283151282,245282241}, {288150036,245264425,288217837,245296001}, {294998572,245268752,294917083,245406715}, 
+    {283151282,245282241,283124800,245305845}, {288217837,245296001,288283826,245328947}, {299411927,245296178,299451108,245348576}, 
+    {283124800,245305845,283099026,245330088}, {288283826,245328947,288347932,245363287}, {283099026,245330088,283073959,245354955}, 
+    {299451108,245348576,299526224,245454735}, {283073959,245354955,283049596,245380430}, {288347932,245363287,288410085,245399042}, 
+    {283049596,245380430,283025938,245406498}, {288410085,245399042,288470214,245436234}, {283025938,245406498,283002981,245433144}, 
+    {294917083,245406715,294838928,245548796}, {283002981,245433144,282980725,245460351}, {288470214,245436234,288528249,245474886}, 
+    {299526224,245454735,299597140,245562516}, {282980725,245460351,282959169,245488104}, {288528249,245474886,288556460,245494766}, 
+    {282959169,245488104,282938311,245516387}, {288556460,245494766,288584120,245515020}, {288584120,245515020,288611222,245535649}, 
+    {282938311,245516387,282918150,245545185}, {288611222,245535649,288637756,245556657}, {282918150,245545185,282898685,245574483}, 
+    {294838928,245548796,294763786,245694595}, {288637756,245556657,288663714,245578046}, {299597140,245562516,299664004,245671684}, 
+    {282898685,245574483,282879914,245604264}, {288663714,245578046,288689087,245599820}, {288689087,245599820,288713866,245621981}, 
+    {282879914,245604264,282861835,245634514}, {288713866,245621981,288738042,245644532}, {282861835,245634514,282844448,245665215}, 
+    {288738042,245644532,288761607,245667475}, {282844448,245665215,282827751,245696354}, {288761607,245667475,288784551,245690814}, 
+    {299664004,245671684,299726966,245782003}, {288784551,245690814,288806867,245714550}, {294763786,245694595,294691333,245843709}, 
+    {282827751,245696354,282811743,245727914}, {288806867,245714550,288828544,245738688}, {282811743,245727914,282796422,245759880}, 
+    {288828544,245738688,288875226,245792959}, {282796422,245759880,282781787,245792236}, {299726966,245782003,299786176,245893240}, 
+    {282781787,245792236,282767837,245824966}, {288875226,245792959,288920438,245847616}, {282767837,245824966,282754570,245858056}, 
+    {294691333,245843709,294621248,245995736}, {288920438,245847616,288964228,245902643}, {282754570,245858056,282741985,245891489}, 
+    {282741985,245891489,282730081,245925249}, {299786176,245893240,299841784,246005158}, {288964228,245902643,289006641,245958020}, 
+    {282730081,245925249,282718856,245959322}, {289006641,245958020,289047725,246013731}, {282718856,245959322,282708308,245993691}, 
+    {282708308,245993691,282698438,246028342}, {294621248,245995736,294486888,246306924}, {299841784,246005158,299893939,246117523}, 
+    {289047725,246013731,289087527,246069759}, {282698438,246028342,282689242,246063258}, {282689242,246063258,282680720,246098423}, 
+    {289087527,246069759,289163475,246182691}, {282680720,246098423,282672871,246133823}, {299893939,246117523,299942792,246230098}, 
+    {282672871,246133823,282665693,246169441}, {282665693,246169441,282659184,246205263}, {289163475,246182691,289234860,246296676}, 
+    {282659184,246205263,282653344,246241272}, {299942792,246230098,299988492,246342650}, {282653344,246241272,282648171,246277453}, 
+    {282648171,246277453,282643664,246313790}, {289234860,246296676,289302058,246411574}, {294486888,246306924,294232384,246946584}, 
+    {282643664,246313790,282639821,246350268}, {299988492,246342650,300031188,246454943}, {282639821,246350268,282636641,246386871}, 
+    {282636641,246386871,282634122,246423583}, {289302058,246411574,289365447,246527245}, {282634122,246423583,282632264,246460390}, 
+    {300031188,246454943,300071031,246566742}, {282632264,246460390,282631065,246497275}, {282631065,246497275,282630523,246534222}, 
+    {289365447,246527245,289425403,246643546}, {282630523,246534222,282630637,246571217}, {300071031,246566742,300108170,246677812}, 
+    {282630637,246571217,282631407,246608243}, {282631407,246608243,282632829,246645285}, {289425403,246643546,289482302,246760338}, 
+    {282632829,246645285,282634904,246682328}, {300108170,246677812,300142756,246787917}, {282634904,246682328,282637630,246719355}, 
+    {282637630,246719355,282641004,246756352}, {282641004,246756352,282645027,246793302}, {289482302,246760338,289536521,246877480}, 
+    {300142756,246787917,300204864,247004294}, {282645027,246793302,282649697,246830191}, {282649697,246830191,282655012,246867001}, 
+    {282655012,246867001,282660971,246903719}, {289536521,246877480,289638424,247112252}, {282660971,246903719,282667573,246940328}, 
+    {282667573,246940328,282674815,246976812}, {294232384,246946584,293979632,247587861}, {282674815,246976812,282682698,247013157}, 
+    {300204864,247004294,300258554,247213991}, {282682698,247013157,282691219,247049346}, {282691219,247049346,282700378,247085364}, 
+    {282700378,247085364,282710172,247121195}, {289638424,247112252,289826632,247579808}, {282710172,247121195,282720601,247156824}, 
+    {282720601,247156824,282731663,247192235}, {282731663,247192235,282743357,247227413}, {300258554,247213991,300305024,247415128}, 
+    {282743357,247227413,282755681,247262342}, {282755681,247262342,282768634,247297006}, {282768634,247297006,282782215,247331390}, 
+    {282782215,247331390,282796422,247365478}, {282796422,247365478,282811254,247399254}, {282811254,247399254,282826710,247432704}, 
+    {300305024,247415128,300345472,247605824}, {282826710,247432704,282842788,247465811}, {282842788,247465811,282859487,247498560}, 
+    {282859487,247498560,282876805,247530935}, {282876805,247530935,282894742,247562920}, {282894742,247562920,282913296,247594501}, 
+    {289826632,247579808,289918961,247810341}, {293979632,247587861,293847462,247901070}, {282913296,247594501,282932465,247625661}, 
+    {300345472,247605824,299694420,248020704}, {282932465,247625661,282952248,247656386}, {282952248,247656386,282972644,247686658}, 
+    {282972644,247686658,282993651,247716463}, {282993651,247716463,283015269,247745785}, {283015269,247745785,283037495,247774609}, 
+    {283037495,247774609,283060329,247802919}, {283060329,247802919,283083768,247830699}, {289918961,247810341,290014123,248037212}, 
+    {283083768,247830699,283107812,247857933}, {283107812,247857933,283132460,247884607}, {283132460,247884607,283157709,247910705}, 
+    {293847462,247901070,293778800,248054411}, {283157709,247910705,283183559,247936210}, {283183559,247936210,283210008,247961108}, 
+    {283210008,247961108,283237055,247985383}, {283237055,247985383,283264699,248009018}, {283264699,248009018,283292938,248032000}, 
+    {299694420,248020704,299034091,248417907}, {283292938,248032000,283321770,248054311}, {290014123,248037212,290063708,248148922}, 
+    {283321770,248054311,283351195,248075937}, {293778800,248054411,293707990,248205041}, {283351195,248075937,283381211,248096862}, 
+    {283381211,248096862,283411817,248117070}, {283411817,248117070,283443011,248136546}, {283443011,248136546,283474792,248155274}, 
+    {290063708,248148922,290115130,248259294}, {283474792,248155274,283507159,248173238}, {283507159,248173238,283540110,248190423}, 
+    {283540110,248190423,283573644,248206814}, {293707990,248205041,293634709,248352558}, {283573644,248206814,283607759,248222394}, 
+    {283607759,248222394,283642455,248237148}, {283642455,248237148,283677730,248251061}, {283677730,248251061,283713582,248264117}, 
+    {290115130,248259294,290168766,248368187}, {283713582,248264117,283750010,248276300}, {283750010,248276300,283787013,248287595}, 
+    {283787013,248287595,283824590,248297986}, {283824590,248297986,283862739,248307458}, {283862739,248307458,283901458,248315995}, 
+    {283901458,248315995,283940747,248323581}, {283940747,248323581,283980604,248330201}, {283980604,248330201,284021027,248335839}, 
+    {284021027,248335839,284062016,248340480}, {284062016,248340480,284164008,248348892}, {284164008,248348892,284270355,248354426}, 
+    {285233220,248351943,284979039,248353728}, {285233220,248351943,285491411,248355694}, {293634709,248352558,293558635,248496559}, 
+    {284979039,248353728,284494626,248358758}, {284270355,248354426,284380685,248357557}, {285491411,248355694,285621078,248360830}, 
+    {284380685,248357557,284494626,248358758}, {285621078,248360830,285750629,248368771}, {290168766,248368187,290224993,248475462}, 
+    {285750629,248368771,285879693,248379990}, {285879693,248379990,286007896,248394960}, {286007896,248394960,286071558,248404000}, 
+    {286071558,248404000,286134866,248414155}, {286134866,248414155,286197772,248425486}, {299034091,248417907,298365810,248799959}, 
+    {286197772,248425486,286260230,248438050}, {286260230,248438050,286322193,248451907}, {286322193,248451907,286383616,248467116}, 
+    {286383616,248467116,286444450,248483736}, {290224993,248475462,290284187,248580977}, {286444450,248483736,286504650,248501828}, 
+    {293558635,248496559,293479445,248636644}, {286504650,248501828,286564170,248521448}, {286564170,248521448,286622962,248542658}, 
+    {286622962,248542658,286680980,248565516}, {286680980,248565516,286738177,248590082}, {290284187,248580977,290346724,248684592}, 
+    {286738177,248590082,286794507,248616414}, {286794507,248616414,286849924,248644571}, {293479445,248636644,293396817,248772411}, 
+    {286849924,248644571,286904380,248674614}, {286904380,248674614,286931233,248690360}, {290346724,248684592,290379365,248735642}, 
+    {286931233,248690360,286957829,248706600}, {286957829,248706600,286984162,248723341}, {286984162,248723341,287010225,248740590}, 
+    {290379365,248735642,290412982,248786165}, {287010225,248740590,287036013,248758354}, {287036013,248758354,287061521,248776642}, 
+    {293396817,248772411,293354113,248838549}, {287061521,248776642,287086741,248795460}, {290412982,248786165,290447623,248836143}, 
+    {287086741,248795460,287111670,248814816}, {298365810,248799959,297690903,249169385}, {287111670,248814816,287136300,248834717}, 
+    {287136300,248834717,287160626,248855170}, {290447623,248836143,290483336,248885557}, {293354113,248838549,293310428,248903457}, 
+    {287160626,248855170,287184642,248876184}, {287184642,248876184,287208342,248897765}, {290483336,248885557,290520167,248934391}, 
+    {287208342,248897765,287231721,248919921}, {293310428,248903457,293265723,248967084}, {287231721,248919921,287254772,248942659}, 
+    {290520167,248934391,290558163,248982627}, {287254772,248942659,287277490,248965986}, {287277490,248965986,287299869,248989911}, 
+    {293265723,248967084,293219956,249029381}, {290558163,248982627,290597372,249030247}, {287299869,248989911,287321904,249014440}, 
+    {287321904,249014440,287343587,249039580}, {293219956,249029381,293173088,249090297}, {290597372,249030247,290637840,249077234}, 
+    {287343587,249039580,287364914,249065340}, {287364914,249065340,287385879,249091727}, {290637840,249077234,290679615,249123570}, 
+    {293173088,249090297,293125078,249149781}, {287385879,249091727,287406475,249118747}, {287406475,249118747,287426698,249146409}, 
+    {290679615,249123570,290722743,249169237}, {287426698,249146409,287446541,249174720}, {293125078,249149781,293075886,249207784}, 
+    {290722743,249169237,290767272,249214218}, {297690903,249169385,294951512,250571336}, {287446541,249174720,287465998,249203687}, 
+    {287465998,249203687,287485064,249233317}, {293075886,249207784,293025472,249264256}, {290767272,249214218,290813248,249258496}, 
+    {287485064,249233317,287503732,249263618}, {290813248,249258496,290839881,249282798}, {287503732,249263618,287521997,249294598}, 
+    {293025472,249264256,293013195,249277420}, {293013195,249277420,293000696,249290361}, {290839881,249282798,290867329,249306395}, 
+    {293000696,249290361,292975047,249315571}, {287521997,249294598,287539854,249326264}, {290867329,249306395,290895564,249329282}, 
+    {292975047,249315571,292948552,249339890}, {287539854,249326264,287557296,249358622}, {290895564,249329282,290924559,249351458}, 
+    {292948552,249339890,292921237,249363320}, {290924559,249351458,290954287,249372919}, {287557296,249358622,287574317,249391682}, 
+    {292921237,249363320,292893131,249385865}, {290954287,249372919,290984720,249393663}, {292893131,249385865,292864260,249407528}, 
+    {287574317,249391682,287590912,249425449}, {290984720,249393663,291015832,249413685}, {292864260,249407528,292834652,249428311}, 
+    {291015832,249413685,291047595,249432983}, {287590912,249425449,287607074,249459931}, {292834652,249428311,292804334,249448218}, 
+    {291047595,249432983,291079982,249451554}, {292804334,249448218,292773333,249467252}, {291079982,249451554,291112965,249469396}, 
+    {287607074,249459931,287622799,249495137}, {292773333,249467252,292741677,249485415}, {291112965,249469396,291146518,249486504}, 
+    {292741677,249485415,292709392,249502712}, {291146518,249486504,291180613,249502876}, {287622799,249495137,287638080,249531072}, 
+    {292709392,249502712,292676505,249519145}, {291180613,249502876,291215223,249518508}, {291215223,249518508,291250321,249533399}, 
+    {292676505,249519145,292643045,249534716}, {287638080,249531072,287807704,249951112}, {291250321,249533399,291285879,249547544}, 
+    {292643045,249534716,292609038,249549430}, {291285879,249547544,291321871,249560941}, {292609038,249549430,292574512,249563288}, 
+    {291321871,249560941,291358269,249573586}, {292574512,249563288,292539493,249576295}, {291358269,249573586,291395046,249585478}, 
+    {292539493,249576295,292504009,249588453}, {291395046,249585478,291432174,249596611}, {292504009,249588453,292468088,249599765}, 
+    {291432174,249596611,291469627,249606984}, {292468088,249599765,292431755,249610234}, {291469627,249606984,291507377,249616594}, 
+    {292431755,249610234,292395040,249619864}, {291507377,249616594,291545397,249625437}, {292395040,249619864,292357968,249628657}, 
+    {291545397,249625437,291583659,249633510}, {292357968,249628657,292320567,249636616}, {291583659,249633510,291622138,249640810}, 
+    {292320567,249636616,292282864,249643745}, {291622138,249640810,291660804,249647335}, {292282864,249643745,292244887,249650047}, 
+    {291660804,249647335,291699632,249653081}, {292244887,249650047,292206663,249655523}, {291699632,249653081,291738593,249658045}, 
+    {292206663,249655523,292168219,249660179}, {291738593,249658045,291777662,249662225}, {292168219,249660179,292129582,249664016}, 
+    {291777662,249662225,291816809,249665616}, {292129582,249664016,292090779,249667038}, {291816809,249665616,291856009,249668216}, 
+    {292090779,249667038,292051838,249669247}, {291856009,249668216,291895234,249670023}, {292051838,249669247,292012785,249670647}, 
+    {291895234,249670023,291934456,249671032}, {292012785,249670647,291973649,249671241}, {291934456,249671032,291973649,249671241}, 
+    {287807704,249951112,287950532,250325262}, {287950532,250325262,288173088,250955831}, {294951512,250571336,292212109,251973299}, 
+    {288173088,250955831,288340336,251462667}, {288340336,251462667,288414029,251682149}, {288414029,251682149,288486864,251885656}, 
+    {288486864,251885656,288524311,251982977}, {292212109,251973299,291537195,252342732}, {288524311,251982977,288563166,252078173}, 
+    {288563166,252078173,288603968,252171869}, {288603968,252171869,288647258,252264686}, {288647258,252264686,288693576,252357250}, 
+    {291537195,252342732,290868906,252724792}, {288693576,252357250,288743462,252450182}, {288743462,252450182,288797458,252544106}, 
+    {288797458,252544106,288856104,252639645}, {288856104,252639645,288919940,252737423}, {290868906,252724792,290208567,253122005}, 
+    {288919940,252737423,288989506,252838062}, {288989506,252838062,289065342,252942187}, {289065342,252942187,289147990,253050419}, 
+    {289147990,253050419,289237990,253163383}, {290208567,253122005,289557504,253536896}, {289237990,253163383,289335882,253281702}, 
+    {289335882,253281702,289557504,253536896}, 
+};
+
+const Segment SEGMENTS_RIGHT_SPLAT[] = {
+    {333875207,239772211,333747689,239774529}, {333875207,239772211,334001584,239772606}, {334001584,239772606,334126793,239775711}, 
+    {333747689,239774529,333619055,239779562}, {334126793,239775711,334250809,239781523}, {333619055,239779562,333489330,239787314}, 
+    {334250809,239781523,334373606,239790039}, {333489330,239787314,333358541,239797787}, {334373606,239790039,334495158,239801256}, 
+    {333358541,239797787,333226713,239810984}, {334495158,239801256,334615439,239815172}, {333226713,239810984,333093873,239826908}, 
+    {334615439,239815172,334734424,239831784}, {333093873,239826908,332960045,239845561}, {334734424,239831784,334852087,239851089}, 
+    {332960045,239845561,332825256,239866948}, {334852087,239851089,334968402,239873084}, {332825256,239866948,332689531,239891069}, 
+    {334968402,239873084,335083343,239897766}, {332689531,239891069,332552896,239917929}, {335083343,239897766,335196885,239925132}, 
+    {332552896,239917929,332415377,239947529}, {335196885,239925132,335309002,239955180}, {332415377,239947529,332137791,240014965}, 
+    {335309002,239955180,335419668,239987907}, {335419668,239987907,335528857,240023310}, {332137791,240014965,331856977,240093398}, 
+    {335528857,240023310,335636544,240061386}, {335636544,240061386,335742702,240102132}, {331856977,240093398,331573141,240182853}, 
+    {335742702,240102132,335847307,240145546}, {335847307,240145546,335950332,240191625}, {331573141,240182853,331286491,240283350}, 
+    {335950332,240191625,336051751,240240365}, {336051751,240240365,336151539,240291764}, {331286491,240283350,330997232,240394913}, 
+    {336151539,240291764,336249670,240345819}, {336249670,240345819,336346118,240402528}, {330997232,240394913,330705570,240517565}, 
+    {336346118,240402528,336440857,240461887}, {336440857,240461887,336533862,240523894}, {330705570,240517565,330411712,240651328}, 
+    {336533862,240523894,336625107,240588545}, {336625107,240588545,336714566,240655839}, {330411712,240651328,331259136,243888768}, 
+    {336714566,240655839,336802214,240725772}, {336802214,240725772,336888024,240798341}, {336888024,240798341,336971971,240873544}, 
+    {336971971,240873544,337054028,240951377}, {337054028,240951377,337134172,241031838}, {337134172,241031838,337212374,241114925}, 
+    {337212374,241114925,337288611,241200633}, {337288611,241200633,337362855,241288961}, {337362855,241288961,337435082,241379905}, 
+    {337435082,241379905,337505265,241473464}, {337505265,241473464,337573379,241569633}, {337573379,241569633,337639398,241668410}, 
+    {337639398,241668410,337703296,241769792}, {337703296,241769792,337775749,241890830}, {337775749,241890830,337845686,242013257}, 
+    {337845686,242013257,337912995,242137336}, {337912995,242137336,337977564,242263331}, {337977564,242263331,338039280,242391505}, 
+    {338039280,242391505,338098033,242522124}, {338098033,242522124,338153708,242655449}, {334648768,242650944,334630400,246430912}, 
+    {334648768,242650944,331259136,243888768}, {338153708,242655449,338206196,242791746}, {338206196,242791746,338255383,242931278}, 
+    {338255383,242931278,338301158,243074308}, {338301158,243074308,338343408,243221101}, {338343408,243221101,338382022,243371920}, 
+    {338382022,243371920,338416887,243527030}, {338416887,243527030,338447892,243686693}, {338447892,243686693,338474924,243851174}, 
+    {338474924,243851174,338497872,244020736}, {338497872,244020736,338516623,244195644}, {338516623,244195644,338531065,244376160}, 
+    {338531065,244376160,338541087,244562550}, {338541087,244562550,338546576,244755076}, {338546576,244755076,338547420,244954002}, 
+    {338547420,244954002,338543508,245159593}, {338543508,245159593,338534726,245372112}, {338534726,245372112,338520964,245591822}, 
+    {338520964,245591822,338502109,245818988}, {338502109,245818988,338478049,246053873}, {338478049,246053873,338448672,246296742}, 
+    {338448672,246296742,338413866,246547857}, {336086144,246416256,336382528,247865216}, {336086144,246416256,334630400,246430912}, 
+    {338413866,246547857,338327519,247075884}, {338327519,247075884,338218112,247640064}, {338218112,247640064,336382528,247865216}, 
+    {321954624,249348160,316677376,255511424}, {321954624,249348160,322178112,253421120}, {326075712,250104128,322178112,253421120}, 
+    {326075712,250104128,323689344,255716992}, {303480800,251126387,303333189,251128404}, {303480800,251126387,303630071,251127993}, 
+    {303630071,251127993,303780980,251133225}, {303333189,251128404,303187262,251134041}, {303780980,251133225,303933502,251142085}, 
+    {303187262,251134041,303043042,251143295}, {303933502,251142085,304087615,251154576}, {303043042,251143295,302900553,251156164}, 
+    {304087615,251154576,304243296,251170702}, {302900553,251156164,302759817,251172644}, {304243296,251170702,304400520,251190465}, 
+    {302759817,251172644,302620859,251192733}, {304400520,251190465,304559265,251213867}, {302620859,251192733,302483701,251216428}, 
+    {304559265,251213867,304719507,251240912}, {302483701,251216428,302348367,251243727}, {304719507,251240912,304881223,251271603}, 
+    {302348367,251243727,302214880,251274625}, {304881223,251271603,305044390,251305942}, {302214880,251274625,302083264,251309121}, 
+    {305044390,251305942,305208984,251343932}, {302083264,251309121,301953542,251347211}, {305208984,251343932,305374982,251385576}, 
+    {301953542,251347211,301825736,251388894}, {305374982,251385576,305542361,251430877}, {301825736,251388894,301699871,251434165}, 
+    {305542361,251430877,305711097,251479837}, {301699871,251434165,301575970,251483023}, {305711097,251479837,305881167,251532460}, 
+    {301575970,251483023,301454056,251535464}, {305881167,251532460,306225216,251648704}, {301454056,251535464,301334152,251591486}, 
+    {301334152,251591486,301216282,251651085}, {306225216,251648704,303813440,253779968}, {301216282,251651085,301100470,251714259}, 
+    {301100470,251714259,300986737,251781005}, {300986737,251781005,300875108,251851321}, {300875108,251851321,300765607,251925203}, 
+    {300765607,251925203,300658255,252002648}, {300658255,252002648,300553078,252083655}, {300553078,252083655,300450097,252168219}, 
+    {300450097,252168219,300349337,252256338}, {300349337,252256338,300250820,252348010}, {300250820,252348010,300154571,252443231}, 
+    {300154571,252443231,300060612,252541999}, {300060612,252541999,299968966,252644311}, {299968966,252644311,299879657,252750164}, 
+    {299879657,252750164,299792709,252859555}, {299792709,252859555,299708144,252972481}, {299708144,252972481,299625986,253088940}, 
+    {299625986,253088940,299546259,253208929}, {299546259,253208929,299468985,253332445}, {320703936,253296320,317622720,256968576}, 
+    {320703936,253296320,320754368,256706624}, {299468985,253332445,299394188,253459484}, {299394188,253459484,299321891,253590045}, 
+    {299321891,253590045,299252118,253724125}, {299252118,253724125,299184892,253861720}, {303813440,253779968,306289600,256391296}, 
+    {299184892,253861720,299120236,254002828}, {299120236,254002828,299058173,254147446}, {299058173,254147446,298998727,254295571}, 
+    {298998727,254295571,298941922,254447200}, {298941922,254447200,298887780,254602331}, {298887780,254602331,298836325,254760960}, 
+    {298836325,254760960,298787580,254923086}, {298787580,254923086,298741568,255088704}, {309583040,255009600,313340160,258761344}, 
+    {309583040,255009600,316677376,255511424}, {298741568,255088704,298705852,255231576}, {298705852,255231576,298675012,255373819}, 
+    {298675012,255373819,298648955,255515392}, {298648955,255515392,298627592,255656250}, {298627592,255656250,298610831,255796352}, 
+    {323689344,255716992,323974144,256992704}, {322285696,255748160,320754368,256706624}, {322285696,255748160,322249984,257950912}, 
+    {298610831,255796352,298598581,255935656}, {298598581,255935656,298590750,256074118}, {298590750,256074118,298587248,256211695}, 
+    {298587248,256211695,298587984,256348346}, {298587984,256348346,298592865,256484028}, {306289600,256391296,302281728,257418112}, 
+    {298592865,256484028,298601802,256618698}, {298601802,256618698,298614702,256752313}, {298614702,256752313,298631475,256884832}, 
+    {298631475,256884832,298652030,257016210}, {317622720,256968576,314268864,257093952}, {323974144,256992704,326452096,257729408}, 
+    {298652030,257016210,298676275,257146406}, {314268864,257093952,315789504,258685696}, {298676275,257146406,298704119,257275378}, 
+    {298704119,257275378,298735471,257403082}, {298735471,257403082,298770241,257529476}, {302281728,257418112,303411200,259072256}, 
+    {298770241,257529476,298808336,257654517}, {298808336,257654517,298849666,257778164}, {326452096,257729408,323840640,260545920}, 
+    {298849666,257778164,298894139,257900372}, {298894139,257900372,298941665,258021100}, {322249984,257950912,324005888,258617088}, 
+    {298941665,258021100,298992151,258140305}, {298992151,258140305,299045508,258257944}, {299045508,258257944,299101644,258373975}, 
+    {299101644,258373975,299160467,258488355}, {299160467,258488355,299221887,258601042}, {299221887,258601042,299285812,258711993}, 
+    {324005888,258617088,322312896,259652288}, {315789504,258685696,314785920,260784832}, {299285812,258711993,299352152,258821165}, 
+    {313340160,258761344,313409280,259479040}, {299352152,258821165,299420814,258928516}, {299420814,258928516,299491709,259034003}, 
+    {299491709,259034003,299564744,259137584}, {303411200,259072256,301778624,259533056}, {299564744,259137584,299639829,259239216}, 
+    {299639829,259239216,299716872,259338856}, {299716872,259338856,299795783,259436462}, {299795783,259436462,299876470,259531992}, 
+    {313409280,259479040,310591552,261570240}, {299876470,259531992,299958841,259625402}, {301778624,259533056,302486720,261190720}, 
+    {299958841,259625402,300042807,259716650}, {322312896,259652288,322325056,261110848}, {300042807,259716650,300128275,259805694}, 
+    {300128275,259805694,300215155,259892490}, {300215155,259892490,300303355,259976997}, {300303355,259976997,300392784,260059171}, 
+    {300392784,260059171,300483352,260138971}, {300483352,260138971,300574966,260216353}, {300574966,260216353,300667536,260291275}, 
+    {300667536,260291275,300760971,260363694}, {300760971,260363694,300855179,260433568}, {319641344,260403904,322325056,261110848}, 
+    {319641344,260403904,317659008,263022080}, {300855179,260433568,300950069,260500854}, {300950069,260500854,301045550,260565510}, 
+    {323840640,260545920,324735168,263650880}, {301045550,260565510,301141532,260627492}, {301141532,260627492,301237922,260686759}, 
+    {301237922,260686759,301334630,260743267}, {301334630,260743267,301431564,260796975}, {314785920,260784832,316834112,261497088}, 
+    {301431564,260796975,301528634,260847839}, {301528634,260847839,301625748,260895817}, {301625748,260895817,301722815,260940867}, 
+    {301722815,260940867,301819743,260982945}, {301819743,260982945,301916443,261022009}, {301916443,261022009,302012822,261058017}, 
+    {302012822,261058017,302108789,261090926}, {302108789,261090926,302204254,261120694}, {302204254,261120694,302299125,261147277}, 
+    {302299125,261147277,302393311,261170633}, {302393311,261170633,302486720,261190720}, {316834112,261497088,317659008,263022080}, 
+    {310591552,261570240,314501824,262473664}, {320422208,261969152,324735168,263650880}, {320422208,261969152,317095680,266495680}, 
+    {314501824,262473664,313513472,265238144}, {316102272,264129984,317095680,266495680}, {316102272,264129984,313513472,265238144}, 
+};
+
+const Segment SEGMENTS_TENS_A[] = {
+    {355173376,131403264,354395456,132093760}, {355173376,131403264,358726976,131403264}, {358726976,131403264,359275264,132058368}, 
+    {359275264,132058368,357542528,133510272}, {354395456,132093760,355615296,133510272}, {357542528,133510272,355615296,133510272}, 
+};
+
+const Segment SEGMENTS_TENS_B[] = {
+    {360030848,132944064,360543680,133590656}, {360030848,132944064,358297024,134520768}, {360543680,133590656,359986752,137638784}, 
+    {358297024,134520768,357850048,137772864}, {359986752,137638784,358730432,138772672}, {357850048,137772864,358730432,138772672}, 
+};
+
+const Segment SEGMENTS_TENS_C[] = {
+    {358577856,140504640,359455936,141492480}, {358577856,140504640,357326656,141678976}, {359455936,141492480,358797376,146168128}, 
+    {357326656,141678976,356777856,145399808}, {356777856,145399808,358051008,146892544}, {358797376,146168128,358051008,146892544}, 
+};
+
+const Segment SEGMENTS_TENS_D[] = {
+    {353990016,146124608,355811968,146131840}, {353990016,146124608,352255808,147670784}, {355811968,146131840,357129088,147663552}, 
+    {357129088,147663552,356477760,148256960}, {352255808,147670784,352724096,148242432}, {352724096,148242432,356477760,148256960}, 
+};
+
+const Segment SEGMENTS_TENS_E[] = {
+    {352891712,140459072,351585152,141585152}, {352891712,140459072,353772864,141493696}, {353772864,141493696,353195584,145206400}, 
+    {351585152,141585152,350946944,146149824}, {353195584,145206400,351433088,146758464}, {350946944,146149824,351433088,146758464}, 
+};
+
+const Segment SEGMENTS_TENS_F[] = {
+    {353487488,132896704,352719168,133568704}, {353487488,132896704,354732160,134359872}, {352719168,133568704,352123968,137730368}, 
+    {354732160,134359872,354288256,137589440}, {354288256,137589440,353000576,138727488}, {352123968,137730368,353000576,138727488}, 
+};
+
+const Segment SEGMENTS_TENS_G[] = {
+    {355071808,138519168,356907712,138524288}, {355071808,138519168,353772864,139637376}, {356907712,138524288,357814272,139606976}, 
+    {357814272,139606976,356568512,140672064}, {353772864,139637376,354593408,140672064}, {354593408,140672064,356568512,140672064}, 
+};
+
+const Segment SEGMENTS_THOU_A[] = {
+    {319712128,131403264,318934208,132093760}, {319712128,131403264,323265728,131403264}, {323265728,131403264,323813952,132058368}, 
+    {323813952,132058368,322081216,133510272}, {318934208,132093760,320154048,133510272}, {322081216,133510272,320154048,133510272}, 
+};
+
+const Segment SEGMENTS_THOU_B[] = {
+    {324569536,132944064,325082432,133590656}, {324569536,132944064,322835776,134520768}, {325082432,133590656,324525504,137638784}, 
+    {322835776,134520768,322388736,137772864}, {324525504,137638784,323269184,138772672}, {322388736,137772864,323269184,138772672}, 
+};
+
+const Segment SEGMENTS_THOU_C[] = {
+    {323116608,140504640,323994624,141492480}, {323116608,140504640,321865344,141678976}, {323994624,141492480,323336128,146168128}, 
+    {321865344,141678976,321316544,145399808}, {321316544,145399808,322589760,146892544}, {323336128,146168128,322589760,146892544}, 
+};
+
+const Segment SEGMENTS_THOU_D[] = {
+    {318528704,146124608,320350720,146131840}, {318528704,146124608,316794560,147670784}, {320350720,146131840,321667776,147663552}, 
+    {321667776,147663552,321016512,148256960}, {316794560,147670784,317262784,148242432}, {317262784,148242432,321016512,148256960}, 
+};
+
+const Segment SEGMENTS_THOU_E[] = {
+    {317430400,140459072,316123840,141585152}, {317430400,140459072,318311552,141493696}, {318311552,141493696,317734272,145206400}, 
+    {316123840,141585152,315485632,146149824}, {317734272,145206400,315971840,146758464}, {315485632,146149824,315971840,146758464}, 
+};
+
+const Segment SEGMENTS_THOU_F[] = {
+    {318026176,132896704,317257920,133568704}, {318026176,132896704,319270912,134359872}, {317257920,133568704,316662656,137730368}, 
+    {319270912,134359872,318826944,137589440}, {318826944,137589440,317539264,138727488}, {316662656,137730368,317539264,138727488}, 
+};
+
+const Segment SEGMENTS_THOU_G[] = {
+    {319610496,138519168,321446464,138524288}, {319610496,138519168,318311552,139637376}, {321446464,138524288,322353024,139606976}, 
+    {322353024,139606976,321107200,140672064}, {318311552,139637376,319132096,140672064}, {319132096,140672064,321107200,140672064}, 
+};
+
+const Segment SEGMENTS_UNIT_A[] = {
+    {372904064,131403264,372126144,132093760}, {372904064,131403264,376457664,131403264}, {376457664,131403264,377005888,132058368}, 
+    {377005888,132058368,375273152,133510272}, {372126144,132093760,373345984,133510272}, {375273152,133510272,373345984,133510272}, 
+};
+
+const Segment SEGMENTS_UNIT_B[] = {
+    {377761472,132944064,378274368,133590656}, {377761472,132944064,376027648,134520768}, {378274368,133590656,377717376,137638784}, 
+    {376027648,134520768,375580672,137772864}, {377717376,137638784,376461056,138772672}, {375580672,137772864,376461056,138772672}, 
+};
+
+const Segment SEGMENTS_UNIT_C[] = {
+    {376308480,140504640,377186560,141492480}, {376308480,140504640,375057280,141678976}, {377186560,141492480,376528000,146168128}, 
+    {375057280,141678976,374508480,145399808}, {374508480,145399808,375781696,146892544}, {376528000,146168128,375781696,146892544}, 
+};
+
+const Segment SEGMENTS_UNIT_D[] = {
+    {371720640,146124608,373542592,146131840}, {371720640,146124608,369986496,147670784}, {373542592,146131840,374859712,147663552}, 
+    {374859712,147663552,374208448,148256960}, {369986496,147670784,370454720,148242432}, {370454720,148242432,374208448,148256960}, 
+};
+
+const Segment SEGMENTS_UNIT_E[] = {
+    {370622336,140459072,369315776,141585152}, {370622336,140459072,371503488,141493696}, {371503488,141493696,370926208,145206400}, 
+    {369315776,141585152,368677568,146149824}, {370926208,145206400,369163776,146758464}, {368677568,146149824,369163776,146758464}, 
+};
+
+const Segment SEGMENTS_UNIT_F[] = {
+    {371218112,132896704,370449792,133568704}, {371218112,132896704,372462848,134359872}, {370449792,133568704,369854592,137730368}, 
+    {372462848,134359872,372018880,137589440}, {372018880,137589440,370731200,138727488}, {369854592,137730368,370731200,138727488}, 
+};
+
+const Segment SEGMENTS_UNIT_G[] = {
+    {372802432,138519168,374638400,138524288}, {372802432,138519168,371503488,139637376}, {374638400,138524288,375544896,139606976}, 
+    {375544896,139606976,374299136,140672064}, {371503488,139637376,372324032,140672064}, {372324032,140672064,374299136,140672064}, 
+};
+
+const Segment* const ALL_SEGMENTS[76] = {
+    SEGMENTS_BODY,
+    SEGMENTS_FRAME,
+    SEGMENTS_HUND_A,
+    SEGMENTS_HUND_B,
+    SEGMENTS_HUND_C,
+    SEGMENTS_HUND_D,
+    SEGMENTS_HUND_E,
+    SEGMENTS_HUND_F,
+    SEGMENTS_HUND_G,
+    SEGMENTS_INNER0,
+    SEGMENTS_INNER1,
+    SEGMENTS_INNER2,
+    SEGMENTS_INNER3,
+    SEGMENTS_INNER4,
+    SEGMENTS_INNER5,
+    SEGMENTS_INNER6,
+    SEGMENTS_INNER8,
+    SEGMENTS_LEFT_ARM,
+    SEGMENTS_LEFT_ARM_INNER,
+    SEGMENTS_LEFT_ARM_MID,
+    SEGMENTS_LEFT_ARM_OUTER,
+    SEGMENTS_LEFT_CRUSH,
+    SEGMENTS_LEFT_LEG_DOWN,
+    SEGMENTS_LEFT_LEG_UP,
+    SEGMENTS_LEFT_SPLAT,
+    SEGMENTS_MID0,
+    SEGMENTS_MID1,
+    SEGMENTS_MID2,
+    SEGMENTS_MID3,
+    SEGMENTS_MID4,
+    SEGMENTS_MID5,
+    SEGMENTS_MID6,
+    SEGMENTS_MID7,
+    SEGMENTS_MID8,
+    SEGMENTS_MID9,
+    SEGMENTS_OUTER0,
+    SEGMENTS_OUTER1,
+    SEGMENTS_OUTER2,
+    SEGMENTS_OUTER3,
+    SEGMENTS_OUTER4,
+    SEGMENTS_OUTER5,
+    SEGMENTS_OUTER6,
+    SEGMENTS_OUTER7,
+    SEGMENTS_OUTER8,
+    SEGMENTS_OUTER9,
+    SEGMENTS_OUTERA,
+    SEGMENTS_OUTERB,
+    SEGMENTS_RIGHT_ARM,
+    SEGMENTS_RIGHT_ARM_INNER,
+    SEGMENTS_RIGHT_ARM_MID,
+    SEGMENTS_RIGHT_ARM_OUTER,
+    SEGMENTS_RIGHT_CRUSH,
+    SEGMENTS_RIGHT_LEG_DOWN,
+    SEGMENTS_RIGHT_LEG_UP,
+    SEGMENTS_RIGHT_SPLAT,
+    SEGMENTS_TENS_A,
+    SEGMENTS_TENS_B,
+    SEGMENTS_TENS_C,
+    SEGMENTS_TENS_D,
+    SEGMENTS_TENS_E,
+    SEGMENTS_TENS_F,
+    SEGMENTS_TENS_G,
+    SEGMENTS_THOU_A,
+    SEGMENTS_THOU_B,
+    SEGMENTS_THOU_C,
+    SEGMENTS_THOU_D,
+    SEGMENTS_THOU_E,
+    SEGMENTS_THOU_F,
+    SEGMENTS_THOU_G,
+    SEGMENTS_UNIT_A,
+    SEGMENTS_UNIT_B,
+    SEGMENTS_UNIT_C,
+    SEGMENTS_UNIT_D,
+    SEGMENTS_UNIT_E,
+    SEGMENTS_UNIT_F,
+    SEGMENTS_UNIT_G,
+};
+
+const size_t SEGMENT_COUNTS[76] = {
+    2547,
+    268,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    247,
+    520,
+    501,
+    583,
+    1366,
+    461,
+    484,
+    258,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    256,
+    247,
+    520,
+    501,
+    583,
+    1360,
+    461,
+    484,
+    258,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+    6,
+};
+#else
+
+const Segment* const ALL_SEGMENTS[76] = {};
+const size_t SEGMENT_COUNTS[76] = {};
+
+#endif  // NO_BUILTIN_OUTLINES
+
+}  // namespace Outlines
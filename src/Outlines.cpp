@@ -4,6 +4,8 @@
 
 namespace Outlines {
 
+#ifndef NO_BUILTIN_OUTLINES
+
 const Node OUTLINE_BODY[] = {
     { 4238006, 3615206, 'M'}, { 4172267, 3628288, 'A'}, { 4121586, 3690217, 'B'}, { 4121048, 3760846, 'C'}, 
     { 4120423, 3842470, 'A'}, { 4183499, 3909265, 'B'}, { 4261457, 3909526, 'C'}, { 4339417, 3909787, 'A'}, 
@@ -691,5 +693,89 @@ const Node* ALL_OUTLINES[76] = {
     OUTLINE_UNIT_F,
     OUTLINE_UNIT_G,
 };
+#else
+
+const Node* ALL_OUTLINES[76] = {};
+
+#endif  // NO_BUILTIN_OUTLINES
+
+const char* const NAMES[76] = {
+    "body",
+    "frame",
+    "hund_a",
+    "hund_b",
+    "hund_c",
+    "hund_d",
+    "hund_e",
+    "hund_f",
+    "hund_g",
+    "inner0",
+    "inner1",
+    "inner2",
+    "inner3",
+    "inner4",
+    "inner5",
+    "inner6",
+    "inner8",
+    "left_arm",
+    "left_arm_inner",
+    "left_arm_mid",
+    "left_arm_outer",
+    "left_crush",
+    "left_leg_down",
+    "left_leg_up",
+    "left_splat",
+    "mid0",
+    "mid1",
+    "mid2",
+    "mid3",
+    "mid4",
+    "mid5",
+    "mid6",
+    "mid7",
+    "mid8",
+    "mid9",
+    "outer0",
+    "outer1",
+    "outer2",
+    "outer3",
+    "outer4",
+    "outer5",
+    "outer6",
+    "outer7",
+    "outer8",
+    "outer9",
+    "outera",
+    "outerb",
+    "right_arm",
+    "right_arm_inner",
+    "right_arm_mid",
+    "right_arm_outer",
+    "right_crush",
+    "right_leg_down",
+    "right_leg_up",
+    "right_splat",
+    "tens_a",
+    "tens_b",
+    "tens_c",
+    "tens_d",
+    "tens_e",
+    "tens_f",
+    "tens_g",
+    "thou_a",
+    "thou_b",
+    "thou_c",
+    "thou_d",
+    "thou_e",
+    "thou_f",
+    "thou_g",
+    "unit_a",
+    "unit_b",
+    "unit_c",
+    "unit_d",
+    "unit_e",
+    "unit_f",
+    "unit_g",
+};
 
 }  // namespace Outlines
@@ -13,6 +13,16 @@ struct Node {
     char action;
 };
 
+// A flattened edge of an outline running from x0, y0 down to x1, y1, in 1/SEGMENT_SCALE outline units.
+struct Segment {
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+};
+
+constexpr int SEGMENT_SCALE = 64;
+
 constexpr size_t BODY = 0;
 constexpr size_t FRAME = 1;
 constexpr size_t HUND_A = 2;
@@ -91,6 +101,11 @@ constexpr size_t UNIT_F = 74;
 constexpr size_t UNIT_G = 75;
 constexpr size_t COUNT = 76;
 extern const Node* ALL_OUTLINES[COUNT];
+// The inkscape labels of the outlines, as used in an outline pack.
+extern const char* const NAMES[COUNT];
+// Each outline flattened into the edges Path builds from it, sorted by y0. Defined in OutlineSegments.cpp.
+extern const Segment* const ALL_SEGMENTS[COUNT];
+extern const size_t SEGMENT_COUNTS[COUNT];
 
 }  // namespace Outlines
 
@@ -0,0 +1,208 @@
+#include <SDL.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Board.h"
+#include "Output.h"
+
+Output::Output(const SDL_Rect& placement, Uint32 windowFlags, const std::vector<size_t>& boards,
+    const OutlinePack* outlinePack) :
+    placement(placement), windowFlags(windowFlags), width(placement.w), height(placement.h), boards(boards) {
+    Board::layout(width, height, boards.size(), outlinePack, viewports);
+    started = SDL_CreateSemaphore(0);
+    mutex = SDL_CreateMutex();
+    SDL_AtomicSet(&quitting, 0);
+    SDL_AtomicSet(&redrawRequested, 0);
+    SDL_AtomicSet(&middle, 2);
+    for (auto& buffer : buffers) buffer.resize(boards.size());
+}
+
+Output::~Output() {
+    stop();
+    SDL_DestroyMutex(mutex);
+    SDL_DestroySemaphore(started);
+}
+
+bool Output::isThreadedWindowSupported() {
+    const char* driver = SDL_GetCurrentVideoDriver();
+    return driver != nullptr && (SDL_strcasecmp(driver, "x11") == 0 || SDL_strcasecmp(driver, "KMSDRM") == 0);
+}
+
+bool Output::start(const ScreenFactory& createScreen, const ElementParameters& parameters, const Skin* skin) {
+    this->createScreen = createScreen;
+    elementParameters = parameters;
+    elementParameters.skin = nullptr;
+    if (skin != nullptr) {
+        this->skin = *skin;
+        elementParameters.skin = &this->skin;
+    }
+
+    thread = SDL_CreateThread(startThread, "output", this);
+    if (thread == nullptr) {
+        SDL_Log("Could not start an output's thread: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SemWait(started);
+    return isStarted;
+}
+
+void Output::stop() {
+    if (thread == nullptr)
+        return;
+    SDL_AtomicSet(&quitting, 1);
+    SDL_WaitThread(thread, nullptr);
+    thread = nullptr;
+}
+
+int Output::run() {
+    window = SDL_CreateWindow("Test", placement.x, placement.y, placement.w, placement.h, windowFlags);
+    if (window == nullptr)
+        SDL_Log("Could not create an output's window: %s", SDL_GetError());
+    else
+        screen = createScreen(window, renderer);
+    isStarted = screen != nullptr;
+    if (isStarted) {
+        usesImages = screen->usesElementImages();
+        if (usesImages) {
+            pixelFormat = screen->choosePixelFormat(false);
+            opaquePixelFormat = screen->choosePixelFormat(true);
+        }
+    }
+    SDL_SemPost(started);
+
+    if (screen != nullptr) {
+        // Record the size the images are for, for screens that scale to the drawable.
+        screen->resize(width, height, width, height);
+        if (!usesImages)
+            screen->setElementParameters(elementParameters);
+
+        bool needsRedraw = true;
+        bool hasStates = false;
+        while (SDL_AtomicGet(&quitting) == 0) {
+            if (takeImages())
+                needsRedraw = true;
+            if (SDL_AtomicSet(&redrawRequested, 0) != 0)
+                needsRedraw = true;
+            if (takeStates()) {
+                hasStates = true;
+                needsRedraw = true;
+            }
+            if (!needsRedraw || !hasStates) {
+                SDL_Delay(1);
+                continue;
+            }
+
+            const std::vector<DisplayState>& states = buffers[front];
+            if (states.size() == 1)
+                screen->render(states[0]);
+            else
+                screen->renderBoards(states.data(), viewports.data(), states.size());
+            needsRedraw = false;
+            screen->present();
+        }
+    }
+
+    screen.reset();
+    if (renderer != nullptr)
+        SDL_DestroyRenderer(renderer);
+    renderer = nullptr;
+    if (window != nullptr)
+        SDL_DestroyWindow(window);
+    window = nullptr;
+    return 0;
+}
+
+bool Output::takeImages() {
+    std::vector<PendingImage> images;
+    SDL_LockMutex(mutex);
+    images.swap(pendingImages);
+    const bool isComplete = pendingComplete;
+    pendingComplete = false;
+    SDL_UnlockMutex(mutex);
+
+    for (auto& pending : images) screen->setElementImage(pending.outlineID, pending.image);
+    if (isComplete)
+        screen->elementsComplete();
+    return !images.empty() || isComplete;
+}
+
+bool Output::takeStates() {
+    if ((SDL_AtomicGet(&middle) & NEW_STATES) == 0)
+        return false;
+    front = SDL_AtomicSet(&middle, front) & ~NEW_STATES;
+    SDL_MemoryBarrierAcquire();
+    return true;
+}
+
+void Output::publish(const std::vector<DisplayState>& states) {
+    std::vector<DisplayState>& buffer = buffers[back];
+    for (size_t i = 0; i < boards.size(); ++i) buffer[i] = states[boards[i]];
+    if (buffer == lastPublished)
+        return;
+    lastPublished = buffer;
+
+    SDL_MemoryBarrierRelease();
+    back = SDL_AtomicSet(&middle, back | NEW_STATES) & ~NEW_STATES;
+}
+
+int Output::boardAt(int x, int y) const {
+    const SDL_Point point = { x, y };
+    for (size_t i = 0; i < viewports.size(); ++i) {
+        if (SDL_PointInRect(&point, &viewports[i]))
+            return static_cast<int>(boards[i]);
+    }
+    return -1;
+}
+
+void Output::postImage(size_t outlineID, const ElementImage& image) {
+    PendingImage pending;
+    pending.outlineID = outlineID;
+    pending.image.dest = image.dest;
+    pending.image.format = image.format;
+    pending.image.pitch = image.pitch;
+    const size_t size = static_cast<size_t>(image.pitch) * image.dest.h;
+    pending.image.pixels = std::make_unique<uint8_t[]>(size);
+    std::memcpy(pending.image.pixels.get(), image.pixels.get(), size);
+
+    SDL_LockMutex(mutex);
+    pendingImages.push_back(std::move(pending));
+    SDL_UnlockMutex(mutex);
+}
+
+void Output::postElementsComplete() {
+    SDL_LockMutex(mutex);
+    pendingComplete = true;
+    SDL_UnlockMutex(mutex);
+}
+
+OutputGroup::OutputGroup(Output* output, const ElementParameters& parameters) :
+    elementParameters(parameters) {
+    outputs.push_back(output);
+    if (parameters.skin != nullptr) {
+        skin = *parameters.skin;
+        elementParameters.skin = &skin;
+    }
+}
+
+bool OutputGroup::add(Output* output, const ElementParameters& parameters) {
+    if (parameters.bounds.width != elementParameters.bounds.width ||
+        parameters.bounds.height != elementParameters.bounds.height ||
+        parameters.pixelFormat != elementParameters.pixelFormat ||
+        parameters.opaquePixelFormat != elementParameters.opaquePixelFormat)
+        return false;
+    outputs.push_back(output);
+    return true;
+}
+
+Uint32 OutputGroup::choosePixelFormat(bool isOpaque) {
+    return isOpaque ? elementParameters.opaquePixelFormat : elementParameters.pixelFormat;
+}
+
+void OutputGroup::setElementImage(size_t outlineID, const ElementImage& image) {
+    for (Output* output : outputs) output->postImage(outlineID, image);
+}
+
+void OutputGroup::elementsComplete() {
+    for (Output* output : outputs) output->postElementsComplete();
+}
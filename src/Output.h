@@ -0,0 +1,184 @@
+#ifndef OUTPUT_H_
+#define OUTPUT_H_
+
+#include <SDL.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "DisplayState.h"
+#include "LcdElement.h"
+#include "Screen.h"
+#include "Skin.h"
+#include "TextureBuilder.h"
+
+// One of several windows, usually each on its own display, drawn by its own thread so a present that waits on a slow
+// display doesn't hold up the others or the game. The window and its screen are created, used and destroyed on that
+// thread, which only some video drivers allow, see isThreadedWindowSupported. The game's thread hands over element
+// images through a queue as they're rasterised, and the boards' states through three buffers so neither thread ever
+// waits for the other.
+class Output {
+public:
+    // Make the screen for a window. renderer is set if an SDL renderer was created for it, which is destroyed after
+    // the screen. Returns nullptr, having logged why, if the screen can't be made.
+    typedef std::function<std::unique_ptr<Screen>(SDL_Window* window, SDL_Renderer*& renderer)> ScreenFactory;
+
+protected:
+    struct PendingImage {
+        size_t outlineID;
+        ElementImage image;
+    };
+
+    static constexpr int NEW_STATES = 4;
+
+    // Where the window is put and how it's made, it's created on the output's thread.
+    SDL_Rect placement;
+    Uint32 windowFlags;
+    int width;
+    int height;
+    // Set by the output's thread before it signals started.
+    SDL_Window* window = nullptr;
+    // The boards shown, by index into the game's boards, and where each is drawn.
+    std::vector<size_t> boards;
+    std::vector<SDL_Rect> viewports;
+    ScreenFactory createScreen;
+    ElementParameters elementParameters;
+    // The output's own copy for a screen that rasterises the outlines itself, it may be scaled on the output's thread.
+    Skin skin;
+
+    SDL_Thread* thread = nullptr;
+    SDL_sem* started;
+    SDL_atomic_t quitting;
+    SDL_atomic_t redrawRequested;
+    // Set by the output's thread before it signals started.
+    bool isStarted = false;
+    bool usesImages = true;
+    Uint32 pixelFormat = SDL_PIXELFORMAT_UNKNOWN;
+    Uint32 opaquePixelFormat = SDL_PIXELFORMAT_UNKNOWN;
+
+    // Only used on the output's thread.
+    std::unique_ptr<Screen> screen;
+    SDL_Renderer* renderer = nullptr;
+
+    // Images waiting for the output's thread.
+    SDL_mutex* mutex;
+    std::vector<PendingImage> pendingImages;
+    bool pendingComplete = false;
+
+    // The game writes into buffers[back] then swaps it with the middle buffer, flagging it with NEW_STATES. The output
+    // swaps buffers[front] for the middle buffer when it's flagged, so always gets the latest states whole.
+    std::vector<DisplayState> buffers[3];
+    SDL_atomic_t middle;
+    int back = 0;
+    int front = 1;
+    // What was last published, only used on the game's thread.
+    std::vector<DisplayState> lastPublished;
+
+    static int startThread(void* data) {
+        return reinterpret_cast<Output*>(data)->run();
+    }
+
+    int run();
+
+    // Give the screen any images handed over since the last call, returns true if there were any.
+    bool takeImages();
+
+    // Swap in the latest states if they've changed, returns true if they had.
+    bool takeStates();
+
+public:
+    // Show the given boards in a window with placement's position and size, made with windowFlags.
+    Output(const SDL_Rect& placement, Uint32 windowFlags, const std::vector<size_t>& boards,
+        const OutlinePack* outlinePack);
+    ~Output();
+
+    // True if the current video driver lets a window be created and drawn on a thread other than the main one. Only
+    // x11 and KMSDRM are known to, elsewhere window events or the GL context belong to the main thread.
+    static bool isThreadedWindowSupported();
+
+    // Start the output's thread and wait for it to make the window and the screen. parameters are for the size of
+    // one of this output's boards, a screen that rasterises the outlines
+    // itself is given them straight away. Returns false if the window or the screen couldn't be made.
+    bool start(const ScreenFactory& createScreen, const ElementParameters& parameters, const Skin* skin);
+
+    // Wait for the output's thread to finish, it destroys the screen and the window.
+    void stop();
+
+    SDL_Window* getWindow() const {
+        return window;
+    }
+
+    int getWidth() const {
+        return width;
+    }
+
+    int getHeight() const {
+        return height;
+    }
+
+    size_t getBoardCount() const {
+        return boards.size();
+    }
+
+    bool usesElementImages() const {
+        return usesImages;
+    }
+
+    Uint32 choosePixelFormat(bool isOpaque) const {
+        return isOpaque ? opaquePixelFormat : pixelFormat;
+    }
+
+    // The index of the board under the given point of the window, or -1 if there isn't one.
+    int boardAt(int x, int y) const;
+
+    // Hand over a copy of an element's image, it's given to the screen on the output's thread.
+    void postImage(size_t outlineID, const ElementImage& image);
+
+    // Every image posted so far is final.
+    void postElementsComplete();
+
+    // Make the states of the game's boards the next to be drawn, only called from the game's thread. The output picks
+    // out the boards it shows and nothing is passed on if they haven't changed.
+    void publish(const std::vector<DisplayState>& states);
+
+    // The window has to be drawn again, for instance because it was uncovered.
+    void requestRedraw() {
+        SDL_AtomicSet(&redrawRequested, 1);
+    }
+};
+
+// The outputs that use the same size and format of element images. The images are rasterised once for the group and
+// a copy handed to each output. TextureBuilder uploads to this as it would to the screen.
+class OutputGroup : public Screen {
+protected:
+    std::vector<Output*> outputs;
+    // The group's own copy, TextureBuilder scales it on its worker threads.
+    Skin skin;
+
+public:
+    TextureBuilder textureBuilder;
+    ElementParameters elementParameters;
+    bool elementsChanged = false;
+
+    // Make a group for the output whose images are made with parameters. Their skin is copied.
+    OutputGroup(Output* output, const ElementParameters& parameters);
+
+    // Add the output to the group if its images would be the same as the group's. Returns false if they wouldn't.
+    bool add(Output* output, const ElementParameters& parameters);
+
+    Uint32 choosePixelFormat(bool isOpaque) override;
+    void setElementImage(size_t outlineID, const ElementImage& image) override;
+    void elementsComplete() override;
+
+    // The outputs draw, not the group.
+    void render(const DisplayState& state) override {
+    }
+
+    void renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) override {
+    }
+
+    void present() override {
+    }
+};
+
+#endif  // OUTPUT_H_
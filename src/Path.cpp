@@ -12,10 +12,10 @@ void Path::moveTo(Point p) {
 }
 
 void Path::lineTo(Point p) {
-    if (p.y > last.y) {
-        edges.emplace_back(last, p);
+    if (p.y > last.y || (p.y == last.y && p.x != last.x)) {
+        appendEdge(last, p);
     } else if (p.y != last.y) {
-        edges.emplace_back(p, last);
+        appendEdge(p, last);
     }
     leftBound = std::min(leftBound, p.x);
     rightBound = std::max(rightBound, p.x);
@@ -24,6 +24,18 @@ void Path::lineTo(Point p) {
     last = p;
 }
 
+void Path::addEdge(Point start, Point end) {
+    if (edges.empty()) {
+        leftBound = rightBound = start.x;
+        bottomBound = topBound = start.y;
+    }
+    leftBound = std::min(leftBound, std::min(start.x, end.x));
+    rightBound = std::max(rightBound, std::max(start.x, end.x));
+    topBound = std::min(topBound, start.y);
+    bottomBound = std::max(bottomBound, end.y);
+    appendEdge(start, end);
+}
+
 void Path::curveTo(Point b, Point c, Point d, int div) {
     Point a1 = last * 0.5 + b * 0.5;
     Point b1 = b * 0.5 + c * 0.5;
@@ -69,13 +81,14 @@ void Path::curveTo(Point b, Point c, Point d) {
 }
 
 void Path::end() {
-    std::sort(edges.begin(), edges.end(), [](const Edge& e1, const Edge& e2) { return e1.start.y < e2.start.y; });
-    nextEdgeIndex = 0;
-    firstActive = nullptr;
+    if (!isSorted)
+        std::sort(edges.begin(), edges.end(), [](const Edge& e1, const Edge& e2) { return e1.start.y < e2.start.y; });
+    isSorted = true;
+    rewind();
 }
 
-void Path::scanLine(double y, double xFirst, double spacing, int length, const int subSamples, uint8_t* results) {
-    std::vector<double> intersections;
+void Path::scanLine(double y, double xFirst, double spacing, int length, const int subSamples, uint16_t* results) {
+    intersections.clear();
 
 #if 1
     // remove edges that we've skipped pass
@@ -110,14 +123,25 @@ void Path::scanLine(double y, double xFirst, double spacing, int length, const i
     }
 
 
-    // then fill
+    // then fill, adding whole pixels at a time rather than counting each sample
 
     if (intersections.size() > 1) {
         std::sort(intersections.begin(), intersections.end());
         for (size_t i = 0; i + 1 < intersections.size(); i += 2) {
-            int firstPixel = std::max(0, static_cast<int>(subSamples * intersections[i] / spacing));
-            int lastPixel = std::min(length * subSamples, static_cast<int>(subSamples * intersections[i + 1] / spacing));
-            for (int pixel = firstPixel; pixel < lastPixel; ++pixel) results[pixel / subSamples]++;
+            int firstSample = std::max(0, static_cast<int>(subSamples * intersections[i] / spacing));
+            int lastSample = std::min(length * subSamples, static_cast<int>(subSamples * intersections[i + 1] / spacing));
+            if (firstSample >= lastSample)
+                continue;
+            int firstPixel = firstSample / subSamples;
+            int lastPixel = lastSample / subSamples;
+            if (firstPixel == lastPixel) {
+                results[firstPixel] += lastSample - firstSample;
+            } else {
+                results[firstPixel] += subSamples * (firstPixel + 1) - firstSample;
+                for (int pixel = firstPixel + 1; pixel < lastPixel; ++pixel) results[pixel] += subSamples;
+                if (lastPixel < length)
+                    results[lastPixel] += lastSample - lastPixel * subSamples;
+            }
         }
     }
 #else
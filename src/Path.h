@@ -5,8 +5,9 @@
 #include "Point.h"
 
 class Path {
-protected:
-
+public:
+    // An edge always runs from the top to the bottom. Horizontal edges are kept (they never cross a scan line) so that
+    // the edges describe the whole outline.
     struct Edge {
         Point start;
         Point end;
@@ -15,12 +16,21 @@ protected:
         Edge(const Point& start, const Point& end) : start(start), end(end) {}
     };
 
+protected:
     Edge* firstActive = nullptr;
     size_t nextEdgeIndex;
 
     std::vector<Edge> edges;
+    std::vector<double> intersections;
     Point first;
     Point last;
+    // Whether the edges are still in order of their start, so end() needn't sort them.
+    bool isSorted = true;
+
+    void appendEdge(const Point& start, const Point& end) {
+        isSorted = isSorted && (edges.empty() || edges.back().start.y <= start.y);
+        edges.emplace_back(start, end);
+    }
 public:
 
     double leftBound;
@@ -38,13 +48,33 @@ public:
 
     void curveTo(Point b, Point c, Point d);
 
+    // Add an edge that already runs from top to bottom. Adding edges in order of their start y saves end() sorting
+    // them, as when they've been flattened and sorted ahead of time.
+    void addEdge(Point start, Point end);
+
+    void reserve(size_t edgeCount) {
+        edges.reserve(edgeCount);
+    }
+
     void end();
 
+    // Go back to the top so the path can be scanned again.
+    void rewind() {
+        nextEdgeIndex = 0;
+        firstActive = nullptr;
+    }
+
     void close() {
         lineTo(first);
     }
 
-    void scanLine(double y, double xFirst, double spacing, int length, int subSamples, uint8_t* results);
+    const std::vector<Edge>& getEdges() const {
+        return edges;
+    }
+
+    // Add the number of samples inside the path for each of the length pixels along the line y, starting at xFirst.
+    // Each pixel is sampled subSamples times horizontally. Scan lines must be visited in increasing y order.
+    void scanLine(double y, double xFirst, double spacing, int length, int subSamples, uint16_t* results);
 };
 
 #endif  // PATH_H_
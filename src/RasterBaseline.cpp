@@ -0,0 +1,267 @@
+#include <SDL.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Path.h"
+#include "RasterBaseline.h"
+
+namespace {
+    struct Configuration {
+        int width;
+        int height;
+        int subSamples;
+    };
+
+    const Configuration configurations[] = {
+        { 320, 240, 1 }, { 320, 240, 4 }, { 1024, 768, 1 }, { 1024, 768, 4 }, { 1024, 768, 8 }, { 1920, 1080, 4 },
+    };
+
+    // Each outline is timed this many times and the quickest kept, to keep the budgets steady.
+    constexpr int RUNS = 3;
+
+    // Small differences in coverage are allowed for, an optimisation may round differently.
+    constexpr double AREA_TOLERANCE = 0.002;
+    constexpr double AREA_TOLERANCE_PIXELS = 1.0;
+    constexpr float CELL_TOLERANCE = 0.02f;
+
+    // Timings are noisy, so rasterising only fails its budget when it's well over.
+    constexpr double TIME_SLACK = 1.5;
+    constexpr double TIME_SLACK_MICROSECONDS = 100.0;
+}
+
+void RasterBaseline::measure(const OutlinePack* outlinePack) {
+    measurements.clear();
+    for (const Configuration& configuration : configurations) {
+        // White on black so each pixel's colour is its coverage.
+        ElementParameters parameters;
+        parameters.bounds.computeBounds(configuration.width, configuration.height, outlinePack);
+        parameters.onColour = 0xFFFFFF;
+        parameters.offColour = 0x000000;
+        parameters.subSamples = configuration.subSamples;
+        parameters.pixelFormat = SDL_PIXELFORMAT_ARGB8888;
+        parameters.opaquePixelFormat = SDL_PIXELFORMAT_ARGB8888;
+
+        for (size_t outlineID = 0; outlineID < Outlines::COUNT; ++outlineID) {
+            Measurement measurement;
+            measurement.width = configuration.width;
+            measurement.height = configuration.height;
+            measurement.subSamples = configuration.subSamples;
+            measurement.outlineID = outlineID;
+
+            Path path;
+            parameters.bounds.outlineToPath(outlineID, path);
+            measurement.edges = path.getEdges().size();
+
+            ElementImage image;
+            measurement.microseconds = 0.0;
+            for (int run = 0; run < RUNS; ++run) {
+                auto s = std::chrono::high_resolution_clock::now();
+                LcdElementTexture::createImage(outlineID, parameters, image);
+                auto e = std::chrono::high_resolution_clock::now();
+                double microseconds = std::chrono::duration<double, std::micro>(e - s).count();
+                measurement.microseconds = run == 0 ? microseconds : std::min(measurement.microseconds, microseconds);
+            }
+
+            const SDL_Rect& dest = image.dest;
+            measurement.dest = dest;
+            measurement.area = 0.0;
+            for (int cellY = 0; cellY < GRID; ++cellY) {
+                for (int cellX = 0; cellX < GRID; ++cellX) {
+                    const int x0 = cellX * dest.w / GRID;
+                    const int x1 = (cellX + 1) * dest.w / GRID;
+                    const int y0 = cellY * dest.h / GRID;
+                    const int y1 = (cellY + 1) * dest.h / GRID;
+                    double covered = 0.0;
+                    for (int y = y0; y < y1; ++y) {
+                        auto line = reinterpret_cast<const uint32_t*>(image.pixels.get() + y * image.pitch);
+                        for (int x = x0; x < x1; ++x) covered += (line[x] & 0xFF) / 255.0;
+                    }
+                    const int pixels = (x1 - x0) * (y1 - y0);
+                    measurement.cells[cellY * GRID + cellX] = pixels > 0 ? static_cast<float>(covered / pixels) : 0.0f;
+                    measurement.area += covered;
+                }
+            }
+            measurements.push_back(measurement);
+        }
+    }
+}
+
+bool RasterBaseline::save(const char* path) const {
+    FILE* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        SDL_Log("Could not create %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    std::fprintf(file, "# width height subsamples outline x y w h edges area then %dx%d cell coverage\n", GRID, GRID);
+    for (const Measurement& m : measurements) {
+        std::fprintf(file, "%d %d %d %d %d %d %d %d %d %.3f", m.width, m.height, m.subSamples,
+            static_cast<int>(m.outlineID), m.dest.x, m.dest.y, m.dest.w, m.dest.h, static_cast<int>(m.edges), m.area);
+        for (float cell : m.cells) std::fprintf(file, " %.4f", cell);
+        std::fprintf(file, "\n");
+    }
+
+    if (std::fclose(file) != 0) {
+        SDL_Log("Could not write %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool RasterBaseline::load(const char* path) {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    measurements.clear();
+    char line[4096];
+    int lineNumber = 0;
+    bool ok = true;
+    while (ok && std::fgets(line, sizeof(line), file) != nullptr) {
+        ++lineNumber;
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+
+        Measurement m;
+        int outlineID;
+        int edges;
+        int consumed = 0;
+        ok = std::sscanf(line, "%d %d %d %d %d %d %d %d %d %lf%n", &m.width, &m.height, &m.subSamples, &outlineID,
+            &m.dest.x, &m.dest.y, &m.dest.w, &m.dest.h, &edges, &m.area, &consumed) == 10 &&
+            outlineID >= 0 && static_cast<size_t>(outlineID) < Outlines::COUNT && edges >= 0;
+        m.outlineID = outlineID;
+        m.edges = edges;
+        m.microseconds = -1.0;
+
+        const char* next = line + consumed;
+        for (int i = 0; ok && i < GRID * GRID; ++i) {
+            char* end;
+            m.cells[i] = std::strtof(next, &end);
+            ok = end != next;
+            next = end;
+        }
+
+        if (ok)
+            measurements.push_back(m);
+        else
+            SDL_Log("Could not parse line %d of %s.", lineNumber, path);
+    }
+    std::fclose(file);
+    return ok;
+}
+
+bool RasterBaseline::saveTimes(const char* path) const {
+    FILE* file = std::fopen(path, "w");
+    if (file == nullptr) {
+        SDL_Log("Could not create %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    std::fprintf(file, "# width height subsamples outline microseconds\n");
+    for (const Measurement& m : measurements) {
+        std::fprintf(file, "%d %d %d %d %.1f\n", m.width, m.height, m.subSamples, static_cast<int>(m.outlineID),
+            m.microseconds);
+    }
+
+    if (std::fclose(file) != 0) {
+        SDL_Log("Could not write %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool RasterBaseline::loadTimes(const char* path) {
+    FILE* file = std::fopen(path, "r");
+    if (file == nullptr) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    char line[256];
+    int lineNumber = 0;
+    bool ok = true;
+    while (ok && std::fgets(line, sizeof(line), file) != nullptr) {
+        ++lineNumber;
+        if (line[0] == '#' || line[0] == '\n')
+            continue;
+
+        int width;
+        int height;
+        int subSamples;
+        int outlineID;
+        double microseconds;
+        ok = std::sscanf(line, "%d %d %d %d %lf", &width, &height, &subSamples, &outlineID, &microseconds) == 5;
+        auto isSameCase = [&](const Measurement& candidate) {
+            return candidate.width == width && candidate.height == height && candidate.subSamples == subSamples &&
+                static_cast<int>(candidate.outlineID) == outlineID;
+        };
+        auto m = std::find_if(measurements.begin(), measurements.end(), isSameCase);
+        if (ok && m != measurements.end())
+            m->microseconds = microseconds;
+        else if (!ok)
+            SDL_Log("Could not parse line %d of %s.", lineNumber, path);
+    }
+    std::fclose(file);
+    return ok;
+}
+
+bool RasterBaseline::compare(const RasterBaseline& reference) const {
+    int failures = 0;
+    for (const Measurement& m : measurements) {
+        auto isSameCase = [&m](const Measurement& candidate) {
+            return candidate.width == m.width && candidate.height == m.height &&
+                candidate.subSamples == m.subSamples && candidate.outlineID == m.outlineID;
+        };
+        auto r = std::find_if(reference.measurements.begin(), reference.measurements.end(), isSameCase);
+        const int id = static_cast<int>(m.outlineID);
+        if (r == reference.measurements.end()) {
+            SDL_Log("Outline %d at %dx%d, %d subsamples: no reference.", id, m.width, m.height, m.subSamples);
+            ++failures;
+            continue;
+        }
+
+        bool failed = false;
+        if (m.dest.x != r->dest.x || m.dest.y != r->dest.y || m.dest.w != r->dest.w || m.dest.h != r->dest.h) {
+            SDL_Log("Outline %d at %dx%d, %d subsamples: bounds are %d,%d %dx%d, expected %d,%d %dx%d.", id, m.width,
+                m.height, m.subSamples, m.dest.x, m.dest.y, m.dest.w, m.dest.h, r->dest.x, r->dest.y, r->dest.w,
+                r->dest.h);
+            failed = true;
+        }
+        if (std::fabs(m.area - r->area) > r->area * AREA_TOLERANCE + AREA_TOLERANCE_PIXELS) {
+            SDL_Log("Outline %d at %dx%d, %d subsamples: covers %.1f pixels, expected %.1f.", id, m.width, m.height,
+                m.subSamples, m.area, r->area);
+            failed = true;
+        }
+        for (int i = 0; i < GRID * GRID; ++i) {
+            if (std::fabs(m.cells[i] - r->cells[i]) > CELL_TOLERANCE) {
+                SDL_Log("Outline %d at %dx%d, %d subsamples: cell %d,%d coverage is %.3f, expected %.3f.", id, m.width,
+                    m.height, m.subSamples, i % GRID, i / GRID, m.cells[i], r->cells[i]);
+                failed = true;
+                break;
+            }
+        }
+        if (m.edges > r->edges) {
+            SDL_Log("Outline %d at %dx%d, %d subsamples: %d edges, budget %d.", id, m.width, m.height, m.subSamples,
+                static_cast<int>(m.edges), static_cast<int>(r->edges));
+            failed = true;
+        }
+        if (r->microseconds >= 0.0 && m.microseconds > r->microseconds * TIME_SLACK + TIME_SLACK_MICROSECONDS) {
+            SDL_Log("Outline %d at %dx%d, %d subsamples: took %.1fus, budget %.1fus.", id, m.width, m.height,
+                m.subSamples, m.microseconds, r->microseconds);
+            failed = true;
+        }
+        if (failed)
+            ++failures;
+    }
+
+    SDL_Log("%d of %d rasterisations differ from the baseline or are over budget.", failures,
+        static_cast<int>(measurements.size()));
+    return failures == 0;
+}
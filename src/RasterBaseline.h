@@ -0,0 +1,52 @@
+#ifndef RASTERBASELINE_H_
+#define RASTERBASELINE_H_
+
+#include <SDL.h>
+#include <cstddef>
+#include <vector>
+
+#include "LcdElement.h"
+
+// How every outline rasterises at a few screen sizes and sample counts: where it lands, how much it covers, roughly
+// what shape that coverage is, how many edges it flattens to and how long it takes. Record one before changing Path or
+// LcdElementTexture::createImage and verify against it after to catch both changed output and slower rasterising.
+// The timings are kept in a file of their own as they only hold for the machine they were recorded on, the rest is
+// the same everywhere and test/raster_baseline.txt is checked by ctest.
+class RasterBaseline {
+protected:
+    // Coverage is summarised over a GRID by GRID division of the element's bounds.
+    static constexpr int GRID = 8;
+
+    struct Measurement {
+        int width;
+        int height;
+        int subSamples;
+        size_t outlineID;
+        SDL_Rect dest;
+        size_t edges;
+        // Negative when loaded from a baseline without timings.
+        double microseconds;
+        // Covered area in pixels.
+        double area;
+        float cells[GRID * GRID];
+    };
+
+    std::vector<Measurement> measurements;
+
+public:
+    // Rasterise every outline in each configuration, from outlinePack if given.
+    void measure(const OutlinePack* outlinePack = nullptr);
+
+    bool save(const char* path) const;
+    bool load(const char* path);
+
+    // The timings, kept apart from the rest. loadTimes adds them to the measurements already loaded.
+    bool saveTimes(const char* path) const;
+    bool loadTimes(const char* path);
+
+    // Log every measurement that differs from reference by more than the tolerances or is over its edge budget, or
+    // its time budget if reference has timings. Returns true if there were none.
+    bool compare(const RasterBaseline& reference) const;
+};
+
+#endif  // RASTERBASELINE_H_
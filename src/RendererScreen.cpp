@@ -0,0 +1,147 @@
+#include <SDL.h>
+
+#include "RendererScreen.h"
+
+RendererScreen::RendererScreen(SDL_Renderer* renderer, uint32_t clearColour) :
+    renderer(renderer), clearColour(clearColour) {
+    textures[Outlines::FRAME].setBlendMode(SDL_BLENDMODE_NONE);
+}
+
+RendererScreen::~RendererScreen() {
+    destroyPoseTextures();
+}
+
+Uint32 RendererScreen::choosePixelFormat(bool isOpaque) {
+    return LcdElementTexture::choosePixelFormat(renderer, isOpaque);
+}
+
+void RendererScreen::setElementImage(size_t outlineID, const ElementImage& image) {
+    textures[outlineID].createTexture(renderer, image);
+    havePoseTextures = false;
+    isComplete = false;
+}
+
+void RendererScreen::elementsComplete() {
+    isComplete = true;
+    createPoseTextures();
+}
+
+void RendererScreen::resize(int width, int height, int imageWidth, int imageHeight) {
+    // The pose textures are the size of the output so have to be made again. While the images are stretched the
+    // elements are drawn one by one.
+    destroyPoseTextures();
+    isStretched = width != imageWidth || height != imageHeight;
+    SDL_RenderSetScale(renderer, static_cast<float>(width) / imageWidth, static_cast<float>(height) / imageHeight);
+    if (isComplete)
+        createPoseTextures();
+}
+
+bool RendererScreen::wereElementImagesLost() {
+    const bool wereLost = areImagesLost;
+    areImagesLost = false;
+    return wereLost;
+}
+
+bool RendererScreen::handleEvent(const SDL_Event& event) {
+    if (event.type == SDL_RENDER_DEVICE_RESET) {
+        // Every texture went with the device. The poses are composed again once the images have been given again.
+        destroyPoseTextures();
+        for (auto& texture : textures) texture.destroyTexture();
+        isComplete = false;
+        areImagesLost = true;
+        return true;
+    }
+    if (event.type == SDL_RENDER_TARGETS_RESET) {
+        // Only the render targets' contents are lost. Unless every image is final they're composed later anyway.
+        if (isComplete)
+            createPoseTextures();
+        return true;
+    }
+    return Screen::handleEvent(event);
+}
+
+void RendererScreen::clear() {
+    SDL_SetRenderDrawColor(renderer, clearColour & 0xFF, (clearColour >> 8) & 0xFF, (clearColour >> 16) & 0xFF,
+        SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(renderer);
+}
+
+void RendererScreen::renderElements(const DisplayState& state, bool clearFirst) {
+    if (state.isSet(Outlines::FRAME)) {
+        if (clearFirst)
+            clear();
+        textures[Outlines::FRAME].renderWithInset(renderer, 1);
+    }
+    state.forEach([this](size_t outlineID) {
+        if (outlineID != Outlines::FRAME)
+            textures[outlineID].render(renderer);
+    });
+}
+
+void RendererScreen::createPoseTextures() {
+    havePoseTextures = false;
+    if (isStretched || !SDL_RenderTargetSupported(renderer))
+        return;
+
+    int w, h;
+    SDL_GetRendererOutputSize(renderer, &w, &h);
+    Uint32 format = choosePixelFormat(true);
+    for (uint32_t pose = 0; pose < 3; ++pose) {
+        if (poseTextures[pose] == nullptr) {
+            poseTextures[pose] = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, w, h);
+            if (poseTextures[pose] == nullptr) {
+                SDL_Log("Pose texture creation failed: %s", SDL_GetError());
+                destroyPoseTextures();
+                return;
+            }
+            SDL_SetTextureBlendMode(poseTextures[pose], SDL_BLENDMODE_NONE);
+        }
+        SDL_SetRenderTarget(renderer, poseTextures[pose]);
+        renderElements(DisplayState::forPose(pose));
+    }
+    SDL_SetRenderTarget(renderer, nullptr);
+    havePoseTextures = true;
+}
+
+void RendererScreen::destroyPoseTextures() {
+    for (auto& texture : poseTextures) {
+        if (texture != nullptr)
+            SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    havePoseTextures = false;
+}
+
+void RendererScreen::renderBoard(const DisplayState& state, const SDL_Rect* poseSource, bool clearFirst) {
+    if (havePoseTextures) {
+        for (uint32_t pose = 0; pose < 3; ++pose) {
+            const DisplayState& poseState = DisplayState::forPose(pose);
+            if (state.contains(poseState)) {
+                SDL_RenderCopy(renderer, poseTextures[pose], poseSource, nullptr);
+                renderElements(state ^ poseState, clearFirst);
+                return;
+            }
+        }
+    }
+    renderElements(state, clearFirst);
+}
+
+void RendererScreen::render(const DisplayState& state) {
+    renderBoard(state, nullptr, true);
+}
+
+void RendererScreen::renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) {
+    // SDL_RenderClear ignores the viewport, so the whole output is cleared once rather than for each board. The pose
+    // textures are the size of the output but only their top left corner is drawn on, that's what each board copies.
+    clear();
+    for (size_t i = 0; i < count; ++i) {
+        SDL_Rect poseSource = { 0, 0, viewports[i].w, viewports[i].h };
+        SDL_RenderSetViewport(renderer, &viewports[i]);
+        renderBoard(states[i], &poseSource, false);
+    }
+    SDL_RenderSetViewport(renderer, nullptr);
+}
+
+void RendererScreen::present() {
+    SDL_RenderPresent(renderer);
+}
@@ -0,0 +1,54 @@
+#ifndef RENDERERSCREEN_H_
+#define RENDERERSCREEN_H_
+
+#include <SDL.h>
+
+#include "LcdElement.h"
+#include "Screen.h"
+
+// Draws the game with an SDL renderer, each element has its own texture.
+class RendererScreen : public Screen {
+protected:
+    SDL_Renderer* renderer;
+    uint32_t clearColour;
+    LcdElementTexture textures[Outlines::COUNT];
+
+    // The frame and juggler for each arm position, composed into render targets once every texture is ready so a
+    // frame can start with a single copy. The crashed juggler is only shown briefly so is drawn over the top.
+    SDL_Texture* poseTextures[3] = { nullptr, nullptr, nullptr };
+    bool havePoseTextures = false;
+    bool isComplete = false;
+    // Set when the device is reset until the owner has been told.
+    bool areImagesLost = false;
+    // Set while the element images are for another size of output.
+    bool isStretched = false;
+
+    void clear();
+
+    // Draw the lit elements with the frame first, the rest are in outline ID order. Unless clearFirst is false the
+    // output is cleared before the frame is drawn.
+    void renderElements(const DisplayState& state, bool clearFirst = true);
+
+    // Draw the elements into the current viewport, starting from the pose texture's poseSource if there is one.
+    void renderBoard(const DisplayState& state, const SDL_Rect* poseSource, bool clearFirst);
+
+    void createPoseTextures();
+    void destroyPoseTextures();
+
+public:
+    // The colour shows around the edge of the frame.
+    RendererScreen(SDL_Renderer* renderer, uint32_t clearColour);
+    ~RendererScreen() override;
+
+    Uint32 choosePixelFormat(bool isOpaque) override;
+    void setElementImage(size_t outlineID, const ElementImage& image) override;
+    void elementsComplete() override;
+    void resize(int width, int height, int imageWidth, int imageHeight) override;
+    bool wereElementImagesLost() override;
+    bool handleEvent(const SDL_Event& event) override;
+    void render(const DisplayState& state) override;
+    void renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) override;
+    void present() override;
+};
+
+#endif  // RENDERERSCREEN_H_
@@ -0,0 +1,62 @@
+#ifndef SCREEN_H_
+#define SCREEN_H_
+
+#include <SDL.h>
+
+#include "DisplayState.h"
+#include "LcdElement.h"
+
+// Somewhere the game can be drawn. The element images are rasterised elsewhere and handed over as they are finished,
+// after that the screen only needs to know which elements are lit.
+class Screen {
+public:
+    virtual ~Screen() = default;
+
+    // The pixel format the element images should be rasterised in, isOpaque is set for the frame.
+    virtual Uint32 choosePixelFormat(bool isOpaque) = 0;
+
+    // Replace the image of an element. Only called on the thread that owns the screen.
+    virtual void setElementImage(size_t outlineID, const ElementImage& image) = 0;
+
+    // Screens that rasterise the outlines themselves as they draw return false. They are given the element parameters
+    // instead of images.
+    virtual bool usesElementImages() const {
+        return true;
+    }
+
+    virtual void setElementParameters(const ElementParameters& parameters) {
+    }
+
+    // Every element image is final, at least until setElementImage is next called.
+    virtual void elementsComplete() {
+    }
+
+    // The output is now width by height but the element images are for imageWidth by imageHeight, they're drawn
+    // stretched to fit until images for the new size replace them. That happens straight after this is called with
+    // imageWidth and imageHeight set to the new size.
+    virtual void resize(int width, int height, int imageWidth, int imageHeight) {
+    }
+
+    // Returns true, once, if the element images have been lost since this was last called, for instance with the
+    // graphics device. They have to be given again with setElementImage.
+    virtual bool wereElementImagesLost() {
+        return false;
+    }
+
+    // Returns true if the event means the screen has to be drawn again.
+    virtual bool handleEvent(const SDL_Event& event) {
+        return event.type == SDL_WINDOWEVENT;
+    }
+
+    // Draw the lit elements. The frame is opaque so is always drawn first.
+    virtual void render(const DisplayState& state) = 0;
+
+    // Draw count boards, each into its viewport. The element images are the size of a viewport and the viewports are
+    // in the same pixels as imageWidth and imageHeight given to resize.
+    virtual void renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) = 0;
+
+    // Show what has been drawn.
+    virtual void present() = 0;
+};
+
+#endif  // SCREEN_H_
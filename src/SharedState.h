@@ -0,0 +1,76 @@
+#ifndef SHAREDSTATE_H_
+#define SHAREDSTATE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "Outlines.h"
+
+// The layout of the POSIX shared memory the game publishes its boards in with -publish, for other local processes
+// such as segment drivers and spectator displays. Neither this nor SharedStateReader.h needs SDL.
+//
+// The region is guarded by a seqlock: the publisher makes sequence odd, writes the boards, then makes it even again,
+// and a reader retries if sequence was odd or changed while it copied. Every field is a 32 bit atomic so the region
+// stays lock free on a 32 bit Raspberry Pi, and so sequence can be waited on with a futex.
+namespace SharedState {
+
+constexpr uint32_t MAGIC = 0x50555354;
+constexpr uint32_t VERSION = 2;
+constexpr size_t MAX_BOARDS = 256;
+// The lit elements take one bit per outline ID, outline ID 0 being the lowest bit of the first word.
+constexpr size_t SEGMENT_WORDS = (Outlines::COUNT + 31) / 32;
+// The longest a reader sleeps on sequence before checking it and registering again.
+constexpr uint32_t MAX_SLEEP_MILLISECONDS = 100;
+
+// In the same order as Board::Mode.
+enum Mode : uint32_t {
+    GAME_A, GAME_A_HI_SCORE, GAME_B, GAME_B_HI_SCORE, TIME, ACL
+};
+
+struct Board {
+    std::atomic<uint32_t> segments[SEGMENT_WORDS];
+    std::atomic<uint32_t> score;
+    std::atomic<uint32_t> mode;
+};
+
+struct Region {
+    // Set once the publisher has filled in the region, they never change after that.
+    uint32_t magic;
+    uint32_t version;
+    uint32_t outlineCount;
+    uint32_t maxBoards;
+
+    // Odd while the publisher is writing. Bumped by 2 for each change, readers can wait on it with FUTEX_WAIT.
+    std::atomic<uint32_t> sequence;
+    // When the last reader asleep on sequence will wake by itself, from getMilliseconds. The publisher only makes the
+    // wake up system call before then. A reader killed in its sleep stops costing the publisher anything as soon as
+    // the sleep would have ended, where a count of sleeping readers would never go back down.
+    std::atomic<uint32_t> sleepDeadline;
+    // 0 once the game has quit, the region is kept for the next run so readers can carry on following it.
+    std::atomic<uint32_t> boardCount;
+    // The board the keys control.
+    std::atomic<uint32_t> focusedBoard;
+    Board boards[MAX_BOARDS];
+};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex needs a plain 32 bit word");
+
+// Milliseconds on a clock every process shares, wrapping every 49 days. On Linux steady_clock is CLOCK_MONOTONIC,
+// which is read without a system call.
+inline uint32_t getMilliseconds() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Milliseconds until sleepDeadline at now, 0 once it's passed. Anything further off than a reader sleeps for was left
+// long ago and has wrapped round, so counts as passed too.
+inline uint32_t getTimeToDeadline(uint32_t sleepDeadline, uint32_t now) {
+    const uint32_t remaining = sleepDeadline - now;
+    return remaining <= MAX_SLEEP_MILLISECONDS + 1 ? remaining : 0;
+}
+
+}  // namespace SharedState
+
+#endif  // SHAREDSTATE_H_
@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <thread>
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "SharedStateReader.h"
+
+SharedStateReader::~SharedStateReader() {
+    close();
+}
+
+bool SharedStateReader::open(const char* name) {
+#ifdef __linux__
+    close();
+    descriptor = shm_open(name, O_RDWR, 0);
+    if (descriptor < 0)
+        return false;
+
+    // The game may not have sized it yet.
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(SharedState::Region)) {
+        close();
+        return false;
+    }
+    void* mapping = mmap(nullptr, sizeof(SharedState::Region), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        close();
+        return false;
+    }
+    region = static_cast<SharedState::Region*>(mapping);
+
+    const bool isReady = region->magic == SharedState::MAGIC;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (!isReady || region->version != SharedState::VERSION || region->outlineCount != Outlines::COUNT ||
+        region->maxBoards != SharedState::MAX_BOARDS) {
+        close();
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SharedStateReader::close() {
+#ifdef __linux__
+    if (region != nullptr)
+        munmap(region, sizeof(SharedState::Region));
+    region = nullptr;
+    if (descriptor >= 0)
+        ::close(descriptor);
+    descriptor = -1;
+#endif
+}
+
+bool SharedStateReader::read(Snapshot& snapshot) const {
+    // The game only holds the sequence odd for a few stores, unless it dies part way through a write. So after
+    // spinning for a while this sleeps between tries, and gives up once READ_TIMEOUT_MILLISECONDS have passed.
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(READ_TIMEOUT_MILLISECONDS);
+    for (int attempt = 1;; ++attempt) {
+        const uint32_t sequence = region->sequence.load(std::memory_order_acquire);
+        snapshot.sequence = sequence;
+        if ((sequence & 1) == 0) {
+            snapshot.boardCount = region->boardCount.load(std::memory_order_relaxed);
+            snapshot.focusedBoard = region->focusedBoard.load(std::memory_order_relaxed);
+            // A torn count could be anything, it's only trusted once the sequence is checked below.
+            const uint32_t count = snapshot.boardCount < SharedState::MAX_BOARDS ? snapshot.boardCount :
+                static_cast<uint32_t>(SharedState::MAX_BOARDS);
+            for (uint32_t i = 0; i < count; ++i) {
+                const SharedState::Board& source = region->boards[i];
+                Board& board = snapshot.boards[i];
+                for (size_t word = 0; word < SharedState::SEGMENT_WORDS; ++word)
+                    board.segments[word] = source.segments[word].load(std::memory_order_relaxed);
+                board.score = source.score.load(std::memory_order_relaxed);
+                board.mode = static_cast<SharedState::Mode>(source.mode.load(std::memory_order_relaxed));
+            }
+
+            // Keeps the copies above before the sequence is checked again.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (region->sequence.load(std::memory_order_relaxed) == sequence)
+                return true;
+        }
+
+        if (attempt >= READ_SPINS) {
+            if (std::chrono::steady_clock::now() >= end)
+                return false;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+uint32_t SharedStateReader::waitForChange(uint32_t sequence, int timeoutMilliseconds, int spinMicroseconds) const {
+    // steady_clock is read without a system call on Linux, so spinning stays in user space.
+    const auto start = std::chrono::steady_clock::now();
+    const auto spinEnd = start + std::chrono::microseconds(spinMicroseconds);
+    const auto end = start + std::chrono::milliseconds(timeoutMilliseconds);
+    uint32_t current = getSequence();
+    while (current == sequence && std::chrono::steady_clock::now() < spinEnd) current = getSequence();
+
+#ifdef __linux__
+    while (current == sequence) {
+        // Sleep in short spells, registering again for each, so the game never has to wake a reader that's gone.
+        long long sleep = SharedState::MAX_SLEEP_MILLISECONDS * 1000000LL;
+        if (timeoutMilliseconds >= 0) {
+            const auto left =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - std::chrono::steady_clock::now());
+            if (left.count() <= 0)
+                break;
+            sleep = std::min<long long>(sleep, left.count());
+        }
+        timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(sleep / 1000000000);
+        timeout.tv_nsec = static_cast<long>(sleep % 1000000000);
+
+        // Pushing sleepDeadline on to when this sleep ends, unless another reader's ends later, before checking the
+        // sequence again means the game either sees the deadline and wakes this reader or has already changed the
+        // sequence, and FUTEX_WAIT doesn't sleep if the sequence has changed. The extra millisecond covers the
+        // deadline being rounded down.
+        const uint32_t now = SharedState::getMilliseconds();
+        const uint32_t deadline = now + static_cast<uint32_t>(sleep / 1000000) + 1;
+        uint32_t registered = region->sleepDeadline.load(std::memory_order_relaxed);
+        while (SharedState::getTimeToDeadline(registered, now) < deadline - now &&
+            !region->sleepDeadline.compare_exchange_weak(registered, deadline, std::memory_order_seq_cst)) {
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (region->sequence.load(std::memory_order_relaxed) == sequence)
+            syscall(SYS_futex, &region->sequence, FUTEX_WAIT, sequence, &timeout, nullptr, 0);
+        current = getSequence();
+    }
+#endif
+    return current;
+}
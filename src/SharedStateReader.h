@@ -0,0 +1,70 @@
+#ifndef SHAREDSTATEREADER_H_
+#define SHAREDSTATEREADER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SharedState.h"
+
+// Follows the state a game run with -publish writes into shared memory, for linking into other processes. Reading
+// and polling for changes are plain loads from the mapping, only waitForChange makes a system call and only once it
+// has spun for longer than asked. Only supported on Linux.
+class SharedStateReader {
+public:
+    struct Board {
+        uint32_t segments[SharedState::SEGMENT_WORDS];
+        uint32_t score;
+        SharedState::Mode mode;
+
+        // outlineID is one of the IDs in Outlines.h.
+        bool isLit(size_t outlineID) const {
+            return (segments[outlineID / 32] & (uint32_t(1) << (outlineID % 32))) != 0;
+        }
+    };
+
+    // A consistent copy of the region. Only the first boardCount boards are filled in.
+    struct Snapshot {
+        uint32_t sequence;
+        uint32_t boardCount;
+        uint32_t focusedBoard;
+        Board boards[SharedState::MAX_BOARDS];
+    };
+
+protected:
+    // How many times read tries straight away before it starts sleeping between tries, and how long it keeps on.
+    static constexpr int READ_SPINS = 1000;
+    static constexpr int READ_TIMEOUT_MILLISECONDS = 100;
+
+    int descriptor = -1;
+    SharedState::Region* region = nullptr;
+
+public:
+    SharedStateReader() = default;
+    SharedStateReader(const SharedStateReader&) = delete;
+    SharedStateReader& operator=(const SharedStateReader&) = delete;
+    ~SharedStateReader();
+
+    // Map the shared memory object name the game publishes in. Returns false if it doesn't exist, isn't the version
+    // this was built for or the game hasn't filled it in yet.
+    bool open(const char* name);
+    void close();
+
+    // Changes every time the game publishes something, and is never odd once read returns true. Cheap enough to poll.
+    uint32_t getSequence() const {
+        return region->sequence.load(std::memory_order_acquire);
+    }
+
+    // Copy the latest state, retrying if the game writes while it's being copied. Returns false if it's still being
+    // written after READ_TIMEOUT_MILLISECONDS, which means the game died part way through a write. snapshot's other
+    // fields are then meaningless, but its sequence can be passed to waitForChange to wait for the game to start
+    // again.
+    bool read(Snapshot& snapshot) const;
+
+    // Wait until the sequence isn't the one given. Spins for spinMicroseconds first, then sleeps in the kernel until
+    // the game wakes it or timeoutMilliseconds pass, forever if that's negative. The sleep is broken into spells of at
+    // most SharedState::MAX_SLEEP_MILLISECONDS, so if this process dies asleep the game soon stops waking it. Returns
+    // the new sequence, or the same one on timing out.
+    uint32_t waitForChange(uint32_t sequence, int timeoutMilliseconds, int spinMicroseconds = 100) const;
+};
+
+#endif  // SHAREDSTATEREADER_H_
@@ -0,0 +1,356 @@
+#include <SDL.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "Path.h"
+#include "Skin.h"
+
+namespace {
+    // Where info/outlines.svg places skin.jpg, in outline units. It's turned by ROTATION degrees about
+    // ROTATION_X, ROTATION_Y.
+    constexpr double SKIN_X = 17223.001;
+    constexpr double SKIN_Y = 42837.0;
+    constexpr double SKIN_WIDTH = 8380493.2;
+    constexpr double SKIN_HEIGHT = 6446823.1;
+    constexpr double ROTATION = -0.4788;
+    constexpr double ROTATION_X = 4207470.0;
+    constexpr double ROTATION_Y = 3266249.0;
+    constexpr double PI = 3.14159265358979323846;
+
+    // Each output pixel of a box filter is the weighted sum of the source pixels from first on.
+    struct Taps {
+        int first = 0;
+        std::vector<float> weights;
+        // How much of the output pixel the photo covers.
+        float coverage = 0.0f;
+    };
+
+    // Box filter the source's pixels 0 to sourceSize onto count output pixels, output pixel i covering source pixels
+    // (origin + i) * scale to (origin + i + 1) * scale. When scaling up the box is kept a source pixel wide, which
+    // makes it linear interpolation.
+    std::vector<Taps> boxFilter(int sourceSize, double origin, double scale, int count) {
+        std::vector<Taps> taps(count);
+        const double width = std::max(scale, 1.0);
+        for (int i = 0; i < count; ++i) {
+            const double centre = (origin + i + 0.5) * scale;
+            const double u0 = std::max(centre - width / 2, 0.0);
+            const double u1 = std::min(centre + width / 2, static_cast<double>(sourceSize));
+            if (u0 >= u1)
+                continue;
+            Taps& t = taps[i];
+            t.first = static_cast<int>(u0);
+            const int last = std::min(static_cast<int>(std::ceil(u1)), sourceSize);
+            for (int s = t.first; s < last; ++s) {
+                const double overlap = std::min(u1, s + 1.0) - std::max(u0, static_cast<double>(s));
+                t.weights.push_back(static_cast<float>(overlap / (u1 - u0)));
+            }
+            t.coverage = static_cast<float>((u1 - u0) / width);
+        }
+        return taps;
+    }
+
+    // How many sizes of each photo are cached, the one written longest ago making way for a new one.
+    constexpr int CACHE_SLOTS = 4;
+
+    uint32_t hashKey(const char* key) {
+        uint32_t hash = 2166136261u;
+        for (; *key != '\0'; ++key) hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+        return hash;
+    }
+
+    // Read the next number of a PPM header, keeping the first comment.
+    bool readPpmNumber(FILE* file, int& value, std::string& comment) {
+        int c = std::fgetc(file);
+        while (c == '#' || std::isspace(c)) {
+            if (c == '#') {
+                std::string line;
+                while ((c = std::fgetc(file)) != EOF && c != '\n') line += static_cast<char>(c);
+                if (comment.empty())
+                    comment = line;
+            }
+            c = std::fgetc(file);
+        }
+        if (!std::isdigit(c))
+            return false;
+        value = 0;
+        while (std::isdigit(c)) {
+            value = value * 10 + (c - '0');
+            if (value > 100000)
+                return false;
+            c = std::fgetc(file);
+        }
+        // A single whitespace character ends the header, anything else belongs to the pixels.
+        return std::isspace(c);
+    }
+}
+
+bool Skin::loadPpm(const char* path, Image& image, const char* expectedComment) {
+    FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        if (expectedComment == nullptr)
+            SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    char magic[2];
+    std::string comment;
+    int maximum = 0;
+    bool ok = std::fread(magic, 1, 2, file) == 2 && magic[0] == 'P' && magic[1] == '6' &&
+        readPpmNumber(file, image.width, comment) && readPpmNumber(file, image.height, comment) &&
+        readPpmNumber(file, maximum, comment) && maximum == 255 && image.width > 0 && image.height > 0;
+    if (ok && expectedComment != nullptr)
+        ok = comment == std::string(" ") + expectedComment;
+    if (ok) {
+        image.rgb.resize(static_cast<size_t>(image.width) * image.height * 3);
+        ok = std::fread(image.rgb.data(), 1, image.rgb.size(), file) == image.rgb.size();
+    }
+    std::fclose(file);
+    if (!ok && expectedComment == nullptr)
+        SDL_Log("%s is not a binary PPM with 8 bits per channel.", path);
+    return ok;
+}
+
+bool Skin::savePpm(const char* path, const Image& image, const char* comment) {
+    FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        SDL_Log("Could not create %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    bool ok = std::fprintf(file, "P6\n# %s\n%d %d\n255\n", comment, image.width, image.height) > 0 &&
+        std::fwrite(image.rgb.data(), 1, image.rgb.size(), file) == image.rgb.size();
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        SDL_Log("Could not write %s.", path);
+        std::remove(path);
+    }
+    return ok;
+}
+
+bool Skin::loadImage(const char* path, Image& image) {
+    const size_t length = std::strlen(path);
+    if (length < 4 || SDL_strcasecmp(path + length - 4, ".bmp") != 0)
+        return loadPpm(path, image);
+
+    SDL_Surface* bitmap = SDL_LoadBMP(path);
+    SDL_Surface* rgb = bitmap != nullptr ? SDL_ConvertSurfaceFormat(bitmap, SDL_PIXELFORMAT_RGB24, 0) : nullptr;
+    if (rgb == nullptr) {
+        SDL_Log("Could not load %s: %s", path, SDL_GetError());
+        SDL_FreeSurface(bitmap);
+        return false;
+    }
+    image.width = rgb->w;
+    image.height = rgb->h;
+    image.rgb.resize(static_cast<size_t>(image.width) * image.height * 3);
+    for (int y = 0; y < image.height; ++y)
+        std::memcpy(&image.rgb[static_cast<size_t>(y) * image.width * 3],
+            static_cast<const uint8_t*>(rgb->pixels) + y * rgb->pitch, image.width * 3);
+    SDL_FreeSurface(rgb);
+    SDL_FreeSurface(bitmap);
+    return true;
+}
+
+void Skin::scale(const Image& photo, const Bounds& bounds, uint32_t backgroundColour, Image& image) const {
+    // First the photo is box filtered to the screen's scale, unturned. Only the part that can turn onto the screen is
+    // needed.
+    const double left = bounds.pathXToPixel(SKIN_X);
+    const double top = bounds.pathYToPixel(SKIN_Y);
+    const double scaleX = photo.width / (bounds.pathXToPixel(SKIN_X + SKIN_WIDTH) - left);
+    const double scaleY = photo.height / (bounds.pathYToPixel(SKIN_Y + SKIN_HEIGHT) - top);
+    const double angle = ROTATION * PI / 180.0;
+    const double sine = std::sin(angle);
+    const double cosine = std::cos(angle);
+    const int margin = static_cast<int>(std::ceil(std::hypot(dest.w, dest.h) * std::fabs(sine))) + 2;
+    const int x0 = dest.x - margin;
+    const int y0 = dest.y - margin;
+    const int width = dest.w + 2 * margin;
+    const int height = dest.h + 2 * margin;
+    const std::vector<Taps> columns = boxFilter(photo.width, x0 - left, scaleX, width);
+    const std::vector<Taps> rows = boxFilter(photo.height, y0 - top, scaleY, height);
+
+    // Each screen row turns onto only a few rows of the scaled photo, so rather than scaling the whole photo first
+    // just those are kept, in a ring, each filtered as it's first needed. The rows a screen row needs only ever move
+    // down, as the turn is small.
+    const int ringRows = static_cast<int>(std::ceil(std::fabs(sine) * dest.w)) + 4;
+    // Premultiplied by coverage so that the photo's edges blend into the background when it's turned.
+    std::vector<float> ring(static_cast<size_t>(ringRows) * width * 4);
+    std::vector<float> row(static_cast<size_t>(photo.width) * 3);
+    int filteredRows = 0;
+    auto filterRow = [&](int y) {
+        float* out = &ring[static_cast<size_t>(y % ringRows) * width * 4];
+        const Taps& rowTaps = rows[y];
+        if (rowTaps.weights.empty()) {
+            std::fill_n(out, static_cast<size_t>(width) * 4, 0.0f);
+            return;
+        }
+
+        // Filtering down the columns a whole row at a time keeps the inner loop simple enough to vectorise.
+        std::fill(row.begin(), row.end(), 0.0f);
+        for (size_t tap = 0; tap < rowTaps.weights.size(); ++tap) {
+            const float weight = rowTaps.weights[tap];
+            const uint8_t* in = &photo.rgb[static_cast<size_t>(rowTaps.first + tap) * photo.width * 3];
+            for (size_t i = 0; i < row.size(); ++i) row[i] += weight * in[i];
+        }
+
+        for (int x = 0; x < width; ++x, out += 4) {
+            const Taps& columnTaps = columns[x];
+            float r = 0.0f;
+            float g = 0.0f;
+            float b = 0.0f;
+            const float* in = &row[static_cast<size_t>(columnTaps.first) * 3];
+            for (float weight : columnTaps.weights) {
+                r += weight * in[0];
+                g += weight * in[1];
+                b += weight * in[2];
+                in += 3;
+            }
+            const float coverage = columnTaps.coverage * rowTaps.coverage;
+            out[0] = r * coverage;
+            out[1] = g * coverage;
+            out[2] = b * coverage;
+            out[3] = coverage;
+        }
+    };
+
+    // Then each screen pixel is turned back into the scaled photo and interpolated from the four nearest pixels.
+    const double centreX = bounds.pathXToPixel(ROTATION_X);
+    const double centreY = bounds.pathYToPixel(ROTATION_Y);
+    const float background[3] = { static_cast<float>(backgroundColour & 0xFF),
+        static_cast<float>((backgroundColour >> 8) & 0xFF), static_cast<float>((backgroundColour >> 16) & 0xFF) };
+    image.width = dest.w;
+    image.height = dest.h;
+    image.rgb.resize(static_cast<size_t>(dest.w) * dest.h * 3);
+    uint8_t* out = image.rgb.data();
+    for (int y = 0; y < dest.h; ++y) {
+        const double py = dest.y + y + 0.5 - centreY;
+        // The lowest row this screen row reaches is at one end of it.
+        double lowest = -1.0;
+        for (int x : { 0, dest.w - 1 }) {
+            const double px = dest.x + x + 0.5 - centreX;
+            lowest = std::max(lowest, centreY - sine * px + cosine * py - y0 - 0.5);
+        }
+        const int last = std::min(height - 1, static_cast<int>(std::floor(lowest)) + 1);
+        for (; filteredRows <= last; ++filteredRows) filterRow(filteredRows);
+
+        for (int x = 0; x < dest.w; ++x, out += 3) {
+            const double px = dest.x + x + 0.5 - centreX;
+            const double sx = centreX + cosine * px + sine * py - x0 - 0.5;
+            const double sy = centreY - sine * px + cosine * py - y0 - 0.5;
+            const int ix = static_cast<int>(std::floor(sx));
+            const int iy = static_cast<int>(std::floor(sy));
+            const float fx = static_cast<float>(sx - ix);
+            const float fy = static_cast<float>(sy - iy);
+            float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            for (int j = 0; j < 2; ++j) {
+                for (int i = 0; i < 2; ++i) {
+                    if (ix + i < 0 || ix + i >= width || iy + j < 0 || iy + j >= height)
+                        continue;
+                    const float weight = (i == 0 ? 1.0f - fx : fx) * (j == 0 ? 1.0f - fy : fy);
+                    const float* in = &ring[(static_cast<size_t>((iy + j) % ringRows) * width + ix + i) * 4];
+                    for (int c = 0; c < 4; ++c) sum[c] += weight * in[c];
+                }
+            }
+            for (int c = 0; c < 3; ++c) {
+                const float value = sum[c] + background[c] * (1.0f - sum[3]);
+                out[c] = static_cast<uint8_t>(std::min(255.0f, std::max(0.0f, value + 0.5f)));
+            }
+        }
+    }
+}
+
+bool Skin::create(const char* path, const Bounds& bounds, int width, int height, uint32_t backgroundColour) {
+    dest = { -1, -1, width + 2, height + 2 };
+    this->path = path;
+    this->backgroundColour = backgroundColour;
+
+    // The cache is only used if it was made from this photo, unchanged, for the same size and placing of the frame.
+    struct stat status;
+    if (stat(path, &status) != 0) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        dest = { 0, 0, 0, 0 };
+        return false;
+    }
+    char key[1024];
+    std::snprintf(key, sizeof(key), "%s %lld %lld %dx%d %.6f %.3f %.3f %06X", path,
+        static_cast<long long>(status.st_size), static_cast<long long>(status.st_mtime), width, height,
+        bounds.pathUnitsPerPixel, bounds.xo, bounds.yo, backgroundColour);
+    std::vector<std::string> cachePaths;
+    char* prefPath = SDL_GetPrefPath("brianapps", "sdlTossup");
+    if (prefPath != nullptr) {
+        for (int slot = 0; slot < CACHE_SLOTS; ++slot) {
+            char name[64];
+            std::snprintf(name, sizeof(name), "skin-%08X-%d.ppm", hashKey(path), slot);
+            cachePaths.push_back(std::string(prefPath) + name);
+        }
+        SDL_free(prefPath);
+    }
+
+    Image image;
+    const auto cached = std::find_if(cachePaths.begin(), cachePaths.end(), [&](const std::string& cachePath) {
+        return loadPpm(cachePath.c_str(), image, key) && image.width == dest.w && image.height == dest.h;
+    });
+    if (cached != cachePaths.end()) {
+        SDL_Log("Loaded the skin from %s.", cached->c_str());
+    } else {
+        Image photo;
+        if (!loadImage(path, photo)) {
+            dest = { 0, 0, 0, 0 };
+            return false;
+        }
+        Uint32 start = SDL_GetTicks();
+        scale(photo, bounds, backgroundColour, image);
+        SDL_Log("Scaled the skin to %dx%d in %dms.", width, height, static_cast<int>(SDL_GetTicks() - start));
+
+        // An empty slot is used first, otherwise the one written longest ago, so the cache doesn't grow with every
+        // size the photo is used at.
+        const std::string* cachePath = nullptr;
+        time_t oldest = 0;
+        for (const std::string& slotPath : cachePaths) {
+            struct stat slotStatus;
+            if (stat(slotPath.c_str(), &slotStatus) != 0) {
+                cachePath = &slotPath;
+                break;
+            }
+            if (cachePath == nullptr || slotStatus.st_mtime < oldest) {
+                cachePath = &slotPath;
+                oldest = slotStatus.st_mtime;
+            }
+        }
+        if (cachePath != nullptr && savePpm(cachePath->c_str(), image, key))
+            SDL_Log("Cached the skin in %s.", cachePath->c_str());
+    }
+
+    pixels.resize(static_cast<size_t>(dest.w) * dest.h);
+    const uint8_t* in = image.rgb.data();
+    for (uint32_t& pixel : pixels) {
+        pixel = in[0] | (in[1] << 8) | (in[2] << 16);
+        in += 3;
+    }
+
+    Path frame;
+    bounds.outlineToPath(Outlines::FRAME, frame);
+    const int left = std::max(0, static_cast<int>(std::floor(frame.leftBound)) - dest.x);
+    const int right = std::min(dest.w, static_cast<int>(std::ceil(frame.rightBound)) - dest.x);
+    const int top = std::max(0, static_cast<int>(std::floor(frame.topBound)) - dest.y);
+    const int bottom = std::min(dest.h, static_cast<int>(std::ceil(frame.bottomBound)) - dest.y);
+    uint64_t sums[3] = { 0, 0, 0 };
+    for (int y = top; y < bottom; ++y) {
+        for (int x = left; x < right; ++x) {
+            const uint32_t pixel = pixels[static_cast<size_t>(y) * dest.w + x];
+            for (int c = 0; c < 3; ++c) sums[c] += (pixel >> (8 * c)) & 0xFF;
+        }
+    }
+    const uint64_t count = std::max<int64_t>(1, static_cast<int64_t>(right - left) * (bottom - top));
+    frameColour = static_cast<uint32_t>(sums[0] / count | (sums[1] / count) << 8 | (sums[2] / count) << 16);
+    return true;
+}
+
+bool Skin::resize(const Bounds& bounds) {
+    // create() is given the stored path, so it needs a copy.
+    const std::string photo = path;
+    return create(photo.c_str(), bounds, bounds.width, bounds.height, backgroundColour);
+}
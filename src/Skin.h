@@ -0,0 +1,67 @@
+#ifndef SKIN_H_
+#define SKIN_H_
+
+#include <SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "LcdElement.h"
+
+// A photo of the real game drawn in place of the flat frame, with the lit elements over it. The photo is placed as
+// info/outlines.svg places skin.jpg, so it lines up with the outlines. Scaling a large photo down to the screen is
+// slow on something like a Pi, so the result is cached on disk for the last few screen sizes and later runs just load
+// that.
+class Skin {
+protected:
+    // The photo for this screen as 0xBBGGRR. It overhangs the screen by a pixel all round, the screens leave the
+    // frame's outermost pixels showing the clear colour and this way those are off screen.
+    std::vector<uint32_t> pixels;
+    SDL_Rect dest = { 0, 0, 0, 0 };
+    uint32_t frameColour = 0;
+    // What create was given, for resize.
+    std::string path;
+    uint32_t backgroundColour = 0;
+
+    struct Image {
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> rgb;
+    };
+
+    static bool loadImage(const char* path, Image& image);
+    static bool loadPpm(const char* path, Image& image, const char* expectedComment = nullptr);
+    static bool savePpm(const char* path, const Image& image, const char* comment);
+
+    // Scale and turn the photo to the screen, filling dest.
+    void scale(const Image& photo, const Bounds& bounds, uint32_t backgroundColour, Image& image) const;
+
+public:
+    // Make the skin for a width by height screen from the BMP or binary PPM photo at path, or from the cache if this
+    // photo has been used at this size before. Anything the photo doesn't cover is the background colour. Returns
+    // false, having logged why, if the photo can't be loaded.
+    bool create(const char* path, const Bounds& bounds, int width, int height, uint32_t backgroundColour);
+
+    // Make the skin again from the same photo for the screen bounds was computed for.
+    bool resize(const Bounds& bounds);
+
+    bool isFor(const Bounds& bounds) const {
+        return dest.w == bounds.width + 2 && dest.h == bounds.height + 2;
+    }
+
+    const SDL_Rect& getDest() const {
+        return dest;
+    }
+
+    const uint32_t* getPixels() const {
+        return pixels.data();
+    }
+
+    // The average colour under the frame, as 0xBBGGRR. Partly covered pixels at the edges of the elements are blended
+    // with the off colour so this makes them blend into the photo.
+    uint32_t getFrameColour() const {
+        return frameColour;
+    }
+};
+
+#endif  // SKIN_H_
@@ -0,0 +1,366 @@
+#include <SDL.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "SoftwareScreen.h"
+
+namespace {
+    // Nearest neighbour is enough for the moment it takes to rasterise images for the new size.
+    template <typename Pixel>
+    void stretch(const Framebuffer& from, const Framebuffer& to) {
+        std::vector<int> columns(to.width);
+        for (int x = 0; x < to.width; ++x) columns[x] = x * from.width / to.width;
+        for (int y = 0; y < to.height; ++y) {
+            auto in = reinterpret_cast<const Pixel*>(from.pixels + (y * from.height / to.height) * from.pitch);
+            auto out = reinterpret_cast<Pixel*>(to.pixels + y * to.pitch);
+            for (int x = 0; x < to.width; ++x) out[x] = in[columns[x]];
+        }
+    }
+}
+
+SoftwareScreen::SoftwareScreen(uint32_t clearColour) : clearColour(clearColour) {
+}
+
+SoftwareScreen::~SoftwareScreen() {
+    closeDevice();
+}
+
+void SoftwareScreen::closeDevice() {
+#ifdef __linux__
+    if (mapping != nullptr)
+        munmap(mapping, mappingSize);
+    if (device >= 0)
+        close(device);
+#endif
+    mapping = nullptr;
+    device = -1;
+}
+
+bool SoftwareScreen::setFramebuffer(const Framebuffer& framebuffer) {
+    switch (framebuffer.format) {
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ABGR8888:
+    case SDL_PIXELFORMAT_BGR888:
+        bytesPerPixel = 4;
+        break;
+    case SDL_PIXELFORMAT_RGB565:
+        bytesPerPixel = 2;
+        break;
+    default:
+        SDL_Log("Framebuffer format %s is not supported.", SDL_GetPixelFormatName(framebuffer.format));
+        return false;
+    }
+    this->framebuffer = framebuffer;
+    clearPixel = convert(0xFF000000 | ((clearColour & 0xFF) << 16) | (clearColour & 0xFF00) | ((clearColour >> 16) & 0xFF));
+    redrawAll = true;
+    return true;
+}
+
+bool SoftwareScreen::getWindowFramebuffer(Framebuffer& surfaceFramebuffer) {
+    SDL_Surface* surface = SDL_GetWindowSurface(window);
+    if (surface == nullptr) {
+        SDL_Log("Could not get the window surface: %s", SDL_GetError());
+        return false;
+    }
+
+    surfaceFramebuffer.pixels = static_cast<uint8_t*>(surface->pixels);
+    surfaceFramebuffer.width = surface->w;
+    surfaceFramebuffer.height = surface->h;
+    surfaceFramebuffer.pitch = surface->pitch;
+    surfaceFramebuffer.format = surface->format->format;
+    return true;
+}
+
+bool SoftwareScreen::setWindow(SDL_Window* window) {
+    this->window = window;
+    Framebuffer surfaceFramebuffer;
+    if (!getWindowFramebuffer(surfaceFramebuffer) || !setFramebuffer(surfaceFramebuffer)) {
+        this->window = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void SoftwareScreen::resize(int width, int height, int imageWidth, int imageHeight) {
+    // Resizing the window frees its old surface.
+    Framebuffer surfaceFramebuffer;
+    if (window == nullptr || !getWindowFramebuffer(surfaceFramebuffer))
+        return;
+
+    if (surfaceFramebuffer.width == imageWidth && surfaceFramebuffer.height == imageHeight) {
+        stretchPixels.clear();
+        stretchPixels.shrink_to_fit();
+        setFramebuffer(surfaceFramebuffer);
+    } else {
+        windowFramebuffer = surfaceFramebuffer;
+        Framebuffer stretchFramebuffer = surfaceFramebuffer;
+        stretchFramebuffer.width = imageWidth;
+        stretchFramebuffer.height = imageHeight;
+        stretchFramebuffer.pitch = imageWidth * SDL_BYTESPERPIXEL(surfaceFramebuffer.format);
+        stretchPixels.resize(static_cast<size_t>(stretchFramebuffer.pitch) * imageHeight);
+        stretchFramebuffer.pixels = stretchPixels.data();
+        setFramebuffer(stretchFramebuffer);
+    }
+}
+
+bool SoftwareScreen::openDevice(const char* path) {
+#ifdef __linux__
+    closeDevice();
+    device = open(path, O_RDWR);
+    if (device < 0) {
+        SDL_Log("Could not open %s: %s", path, std::strerror(errno));
+        return false;
+    }
+
+    fb_var_screeninfo variableInfo;
+    fb_fix_screeninfo fixedInfo;
+    if (ioctl(device, FBIOGET_VSCREENINFO, &variableInfo) != 0 || ioctl(device, FBIOGET_FSCREENINFO, &fixedInfo) != 0) {
+        SDL_Log("Could not get the framebuffer info of %s: %s", path, std::strerror(errno));
+        closeDevice();
+        return false;
+    }
+
+    Framebuffer deviceFramebuffer;
+    deviceFramebuffer.width = variableInfo.xres;
+    deviceFramebuffer.height = variableInfo.yres;
+    deviceFramebuffer.pitch = fixedInfo.line_length;
+    if (variableInfo.bits_per_pixel == 16)
+        deviceFramebuffer.format = SDL_PIXELFORMAT_RGB565;
+    else if (variableInfo.bits_per_pixel == 32 && variableInfo.red.offset == 16)
+        deviceFramebuffer.format = SDL_PIXELFORMAT_ARGB8888;
+    else if (variableInfo.bits_per_pixel == 32 && variableInfo.red.offset == 0)
+        deviceFramebuffer.format = SDL_PIXELFORMAT_ABGR8888;
+    else
+        deviceFramebuffer.format = SDL_PIXELFORMAT_UNKNOWN;
+
+    mappingSize = fixedInfo.smem_len;
+    mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, device, 0);
+    if (mapping == MAP_FAILED) {
+        SDL_Log("Could not map %s: %s", path, std::strerror(errno));
+        mapping = nullptr;
+        closeDevice();
+        return false;
+    }
+    deviceFramebuffer.pixels = static_cast<uint8_t*>(mapping) + variableInfo.yoffset * fixedInfo.line_length +
+        variableInfo.xoffset * (variableInfo.bits_per_pixel / 8);
+    if (!setFramebuffer(deviceFramebuffer)) {
+        closeDevice();
+        return false;
+    }
+    SDL_Log("Drawing to %s, %dx%d %s.", path, deviceFramebuffer.width, deviceFramebuffer.height,
+        SDL_GetPixelFormatName(deviceFramebuffer.format));
+    return true;
+#else
+    SDL_Log("Framebuffer devices are only supported on Linux.");
+    return false;
+#endif
+}
+
+uint32_t SoftwareScreen::convert(uint32_t argb) const {
+    switch (framebuffer.format) {
+    case SDL_PIXELFORMAT_ABGR8888:
+    case SDL_PIXELFORMAT_BGR888:
+        return 0xFF000000 | ((argb & 0xFF) << 16) | (argb & 0xFF00) | ((argb >> 16) & 0xFF);
+    case SDL_PIXELFORMAT_RGB565:
+        return ((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F);
+    default:
+        return 0xFF000000 | argb;
+    }
+}
+
+Uint32 SoftwareScreen::choosePixelFormat(bool isOpaque) {
+    // The alpha is needed to find the pixels inside the outline, they're converted to the framebuffer's format after.
+    return SDL_PIXELFORMAT_ARGB8888;
+}
+
+void SoftwareScreen::setElementImage(size_t outlineID, const ElementImage& image) {
+    Element& element = elements[outlineID];
+    element.spans.clear();
+    element.pixels.clear();
+    redrawAll = true;
+    if (image.format != SDL_PIXELFORMAT_ARGB8888) {
+        SDL_Log("Element %d is not in ARGB8888 format.", static_cast<int>(outlineID));
+        return;
+    }
+
+    // The frame is opaque and like the other screens its outermost pixels are left showing the clear colour.
+    const bool isFrame = outlineID == Outlines::FRAME;
+    const int inset = isFrame ? 1 : 0;
+    const int x0 = std::max(inset, -image.dest.x);
+    const int x1 = std::min(image.dest.w - inset, framebuffer.width - image.dest.x);
+    const int y0 = std::max(inset, -image.dest.y);
+    const int y1 = std::min(image.dest.h - inset, framebuffer.height - image.dest.y);
+    int left = INT_MAX;
+    int right = INT_MIN;
+    int top = INT_MAX;
+    int bottom = INT_MIN;
+    for (int y = y0; y < y1; ++y) {
+        auto line = reinterpret_cast<const uint32_t*>(image.pixels.get() + y * image.pitch);
+        int x = x0;
+        while (x < x1) {
+            while (!isFrame && x < x1 && (line[x] >> 24) == 0) ++x;
+            const int start = x;
+            while (x < x1 && (isFrame || (line[x] >> 24) != 0)) ++x;
+            if (x == start)
+                continue;
+
+            Span span;
+            span.y = image.dest.y + y;
+            span.x = image.dest.x + start;
+            span.length = x - start;
+            span.offset = element.pixels.size();
+            element.pixels.resize(span.offset + span.length * bytesPerPixel);
+            uint8_t* out = &element.pixels[span.offset];
+            for (int i = 0; i < span.length; ++i) {
+                uint32_t pixel = convert(line[start + i]);
+                if (bytesPerPixel == 4) {
+                    std::memcpy(out + i * 4, &pixel, 4);
+                } else {
+                    uint16_t pixel16 = static_cast<uint16_t>(pixel);
+                    std::memcpy(out + i * 2, &pixel16, 2);
+                }
+            }
+            element.spans.push_back(span);
+
+            left = std::min(left, span.x);
+            right = std::max(right, span.x + span.length);
+            top = std::min(top, span.y);
+            bottom = span.y + 1;
+        }
+    }
+
+    if (element.spans.empty()) {
+        element.bounds = { 0, 0, 0, 0 };
+    } else {
+        element.bounds.x = left;
+        element.bounds.y = top;
+        element.bounds.w = right - left;
+        element.bounds.h = bottom - top;
+    }
+}
+
+void SoftwareScreen::drawElement(const Element& element, const SDL_Rect& rect) {
+    auto span = std::lower_bound(element.spans.begin(), element.spans.end(), rect.y,
+        [](const Span& s, int y) { return s.y < y; });
+    for (; span != element.spans.end() && span->y < rect.y + rect.h; ++span) {
+        const int x0 = std::max(span->x, rect.x);
+        const int x1 = std::min(span->x + span->length, rect.x + rect.w);
+        if (x0 >= x1)
+            continue;
+        std::memcpy(framebuffer.pixels + span->y * framebuffer.pitch + x0 * bytesPerPixel,
+            &element.pixels[span->offset + (x0 - span->x) * bytesPerPixel], (x1 - x0) * bytesPerPixel);
+    }
+}
+
+void SoftwareScreen::redraw(const DisplayState& state, const SDL_Rect& rect) {
+    for (int y = rect.y; y < rect.y + rect.h; ++y) {
+        uint8_t* line = framebuffer.pixels + y * framebuffer.pitch + rect.x * bytesPerPixel;
+        if (bytesPerPixel == 4)
+            std::fill_n(reinterpret_cast<uint32_t*>(line), rect.w, clearPixel);
+        else
+            std::fill_n(reinterpret_cast<uint16_t*>(line), rect.w, static_cast<uint16_t>(clearPixel));
+    }
+
+    if (state.isSet(Outlines::FRAME))
+        drawElement(elements[Outlines::FRAME], rect);
+    state.forEach([this, &rect](size_t outlineID) {
+        SDL_Rect overlap;
+        if (outlineID != Outlines::FRAME && SDL_IntersectRect(&elements[outlineID].bounds, &rect, &overlap))
+            drawElement(elements[outlineID], overlap);
+    });
+}
+
+void SoftwareScreen::compose(const DisplayState& state) {
+    for (const SDL_Rect& rect : dirtyRects) redraw(state, rect);
+}
+
+void SoftwareScreen::render(const DisplayState& state) {
+    dirtyRects.clear();
+    if (framebuffer.pixels == nullptr)
+        return;
+
+    // Only the elements that have been lit or cleared need drawing again. Being asked to draw the same state twice
+    // means the framebuffer has been disturbed so it is all redrawn.
+    DisplayState changed = state ^ lastState;
+    if (redrawAll || changed.isEmpty() || changed.isSet(Outlines::FRAME)) {
+        SDL_Rect all = { 0, 0, framebuffer.width, framebuffer.height };
+        dirtyRects.push_back(all);
+    } else {
+        changed.forEach([this](size_t outlineID) {
+            if (elements[outlineID].bounds.w > 0)
+                dirtyRects.push_back(elements[outlineID].bounds);
+        });
+    }
+
+    compose(state);
+    lastState = state;
+    redrawAll = false;
+}
+
+void SoftwareScreen::renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) {
+    dirtyRects.clear();
+    if (framebuffer.pixels == nullptr)
+        return;
+
+    // As with render, being asked to draw the same boards twice means the framebuffer has been disturbed.
+    bool drawAll = redrawAll || boardStates.size() != count || std::equal(states, states + count, boardStates.begin());
+    if (drawAll) {
+        SDL_Rect all = { 0, 0, framebuffer.width, framebuffer.height };
+        redraw(DisplayState(), all);
+        boardStates.assign(count, DisplayState());
+    }
+
+    // Each board that changed is drawn by render with the framebuffer narrowed to its viewport, so only the elements
+    // that changed on it are drawn again.
+    const Framebuffer screen = framebuffer;
+    boardDirtyRects.clear();
+    for (size_t i = 0; i < count; ++i) {
+        if (!drawAll && states[i] == boardStates[i])
+            continue;
+        const SDL_Rect& viewport = viewports[i];
+        framebuffer.pixels = screen.pixels + viewport.y * screen.pitch + viewport.x * bytesPerPixel;
+        framebuffer.width = viewport.w;
+        framebuffer.height = viewport.h;
+        lastState = boardStates[i];
+        redrawAll = drawAll;
+        render(states[i]);
+        boardStates[i] = states[i];
+        for (const SDL_Rect& rect : dirtyRects)
+            boardDirtyRects.push_back({ rect.x + viewport.x, rect.y + viewport.y, rect.w, rect.h });
+    }
+    framebuffer = screen;
+    redrawAll = false;
+
+    dirtyRects.clear();
+    if (drawAll)
+        dirtyRects.push_back({ 0, 0, framebuffer.width, framebuffer.height });
+    else
+        dirtyRects.swap(boardDirtyRects);
+}
+
+void SoftwareScreen::present() {
+    // Otherwise drawing goes straight into the framebuffer so there's nothing more to do.
+    if (window == nullptr || dirtyRects.empty())
+        return;
+
+    if (!stretchPixels.empty()) {
+        if (bytesPerPixel == 4)
+            stretch<uint32_t>(framebuffer, windowFramebuffer);
+        else
+            stretch<uint16_t>(framebuffer, windowFramebuffer);
+        SDL_UpdateWindowSurface(window);
+    } else {
+        SDL_UpdateWindowSurfaceRects(window, dirtyRects.data(), static_cast<int>(dirtyRects.size()));
+    }
+}
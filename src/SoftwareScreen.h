@@ -0,0 +1,106 @@
+#ifndef SOFTWARESCREEN_H_
+#define SOFTWARESCREEN_H_
+
+#include <SDL.h>
+#include <vector>
+
+#include "Screen.h"
+
+// Memory that SoftwareScreen draws into. Unless it comes from SoftwareScreen::openDevice the pixels belong to the
+// caller, which could have allocated them or mapped a DRM dumb buffer.
+struct Framebuffer {
+    uint8_t* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    int pitch = 0;
+    // ARGB8888, RGB888, ABGR8888, BGR888 or RGB565.
+    Uint32 format = SDL_PIXELFORMAT_ARGB8888;
+};
+
+// Composes the game on the CPU straight into a framebuffer, for when there's no GPU driver. Only the pixels inside an
+// element's outline are kept, as runs of pixels already converted to the framebuffer's format. Every pixel is either
+// inside or outside so drawing an element is a memcpy of each run. Only the areas of the elements that changed since
+// the last frame are drawn again.
+class SoftwareScreen : public Screen {
+protected:
+    // A run of pixels in framebuffer coordinates, offset is where its pixels start in Element::pixels.
+    struct Span {
+        int y;
+        int x;
+        int length;
+        size_t offset;
+    };
+
+    struct Element {
+        SDL_Rect bounds = { 0, 0, 0, 0 };
+        std::vector<Span> spans;  // in increasing y
+        std::vector<uint8_t> pixels;
+    };
+
+    uint32_t clearColour;
+    Framebuffer framebuffer;
+    int bytesPerPixel = 4;
+    uint32_t clearPixel = 0;
+    Element elements[Outlines::COUNT];
+    DisplayState lastState;
+    bool redrawAll = true;
+    std::vector<SDL_Rect> dirtyRects;
+    // What each board showed when renderBoards last drew it.
+    std::vector<DisplayState> boardStates;
+    std::vector<SDL_Rect> boardDirtyRects;
+
+    // Set when drawing into a window's surface.
+    SDL_Window* window = nullptr;
+
+    // While the element images are for another size of window they're drawn here at that size and present() stretches
+    // the result onto the window's surface.
+    std::vector<uint8_t> stretchPixels;
+    Framebuffer windowFramebuffer;
+
+    // Set when the framebuffer was mapped by openDevice.
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    int device = -1;
+
+    uint32_t convert(uint32_t argb) const;
+    bool getWindowFramebuffer(Framebuffer& surfaceFramebuffer);
+    void redraw(const DisplayState& state, const SDL_Rect& rect);
+    void drawElement(const Element& element, const SDL_Rect& rect);
+    // Draw state into each of the dirty rects.
+    virtual void compose(const DisplayState& state);
+    void closeDevice();
+
+public:
+    // The colour shows around the edge of the frame.
+    explicit SoftwareScreen(uint32_t clearColour);
+    ~SoftwareScreen() override;
+
+    // Draw into the given framebuffer, returns false if its pixel format isn't supported. The element images are
+    // converted to the framebuffer's format as they are set so this has to come first.
+    bool setFramebuffer(const Framebuffer& framebuffer);
+
+    // Draw into the window's surface, present() then copies the dirty rects to the window.
+    bool setWindow(SDL_Window* window);
+
+    // Map a Linux framebuffer device such as /dev/fb0 and draw into that.
+    bool openDevice(const char* path);
+
+    const Framebuffer& getFramebuffer() const {
+        return framebuffer;
+    }
+
+    // The areas of the framebuffer changed by the last call to render.
+    const std::vector<SDL_Rect>& getDirtyRects() const {
+        return dirtyRects;
+    }
+
+    Uint32 choosePixelFormat(bool isOpaque) override;
+    void setElementImage(size_t outlineID, const ElementImage& image) override;
+    // Only a window's surface changes size.
+    void resize(int width, int height, int imageWidth, int imageHeight) override;
+    void render(const DisplayState& state) override;
+    void renderBoards(const DisplayState* states, const SDL_Rect* viewports, size_t count) override;
+    void present() override;
+};
+
+#endif  // SOFTWARESCREEN_H_
@@ -0,0 +1,133 @@
+#include <SDL.h>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "StatePublisher.h"
+
+StatePublisher::~StatePublisher() {
+    close();
+}
+
+bool StatePublisher::open(const char* name) {
+#ifdef __linux__
+    close();
+    // Readers map it writable too, they set sleepDeadline.
+    descriptor = shm_open(name, O_CREAT | O_RDWR, 0666);
+    if (descriptor < 0) {
+        SDL_Log("Could not open the shared memory %s: %s", name, std::strerror(errno));
+        return false;
+    }
+    if (ftruncate(descriptor, sizeof(SharedState::Region)) != 0) {
+        SDL_Log("Could not size the shared memory %s: %s", name, std::strerror(errno));
+        close();
+        return false;
+    }
+    void* mapping = mmap(nullptr, sizeof(SharedState::Region), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        SDL_Log("Could not map the shared memory %s: %s", name, std::strerror(errno));
+        close();
+        return false;
+    }
+    region = static_cast<SharedState::Region*>(mapping);
+
+    // A region left by an earlier run is reused so its readers carry on. If that run stopped part way through a write
+    // the sequence is left odd, the next write has to start from even.
+    uint32_t sequence = region->sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) != 0)
+        region->sequence.store(sequence + 1, std::memory_order_relaxed);
+    if (region->magic != SharedState::MAGIC || region->version != SharedState::VERSION) {
+        region->version = SharedState::VERSION;
+        region->outlineCount = Outlines::COUNT;
+        region->maxBoards = SharedState::MAX_BOARDS;
+        region->sleepDeadline.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        region->magic = SharedState::MAGIC;
+    }
+    published.clear();
+    SDL_Log("Publishing the game's state in the shared memory %s.", name);
+    return true;
+#else
+    SDL_Log("Publishing the game's state is only supported on Linux.");
+    return false;
+#endif
+}
+
+void StatePublisher::close() {
+#ifdef __linux__
+    if (region != nullptr) {
+        uint32_t sequence = region->sequence.load(std::memory_order_relaxed);
+        region->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        region->boardCount.store(0, std::memory_order_relaxed);
+        region->sequence.store(sequence + 2, std::memory_order_release);
+        wakeReaders();
+        munmap(region, sizeof(SharedState::Region));
+        region = nullptr;
+    }
+    if (descriptor >= 0)
+        ::close(descriptor);
+    descriptor = -1;
+#endif
+}
+
+void StatePublisher::publish(const std::vector<Board>& boards, const std::vector<DisplayState>& states,
+    size_t focusedBoard) {
+    if (region == nullptr)
+        return;
+
+    const size_t count = std::min(boards.size(), SharedState::MAX_BOARDS);
+    const bool isResized = published.size() != count;
+    bool hasChanged = isResized || publishedFocus != focusedBoard;
+    for (size_t i = 0; i < count && !hasChanged; ++i) hasChanged = isChanged(i, boards[i], states[i]);
+    if (!hasChanged)
+        return;
+
+    // Only the publisher writes, so the sequence can't change under it. The fence keeps the board writes after the
+    // sequence is made odd, the release store keeps them before it's made even again.
+    uint32_t sequence = region->sequence.load(std::memory_order_relaxed);
+    region->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    region->boardCount.store(static_cast<uint32_t>(count), std::memory_order_relaxed);
+    region->focusedBoard.store(static_cast<uint32_t>(focusedBoard), std::memory_order_relaxed);
+    published.resize(count);
+    publishedFocus = focusedBoard;
+    for (size_t i = 0; i < count; ++i) {
+        if (!isResized && !isChanged(i, boards[i], states[i]))
+            continue;
+        published[i].state = states[i];
+        published[i].score = boards[i].getScore();
+        published[i].mode = boards[i].getMode();
+
+        SharedState::Board& board = region->boards[i];
+        for (size_t word = 0; word < SharedState::SEGMENT_WORDS; ++word) {
+            const uint64_t bits = states[i].bits[word / 2];
+            board.segments[word].store(static_cast<uint32_t>(bits >> (word % 2 * 32)), std::memory_order_relaxed);
+        }
+        board.score.store(published[i].score, std::memory_order_relaxed);
+        board.mode.store(static_cast<uint32_t>(published[i].mode), std::memory_order_relaxed);
+    }
+
+    region->sequence.store(sequence + 2, std::memory_order_release);
+    wakeReaders();
+}
+
+void StatePublisher::wakeReaders() {
+#ifdef __linux__
+    // Pairs with the fence between a reader setting sleepDeadline and checking the sequence, so either the reader
+    // sees the new sequence or this sees its deadline. A reader whose deadline has passed wakes by itself.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint32_t sleepDeadline = region->sleepDeadline.load(std::memory_order_relaxed);
+    if (SharedState::getTimeToDeadline(sleepDeadline, SharedState::getMilliseconds()) != 0)
+        syscall(SYS_futex, &region->sequence, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
@@ -0,0 +1,56 @@
+#ifndef STATEPUBLISHER_H_
+#define STATEPUBLISHER_H_
+
+#include <vector>
+
+#include "Board.h"
+#include "DisplayState.h"
+#include "SharedState.h"
+
+// Writes the boards' lit elements, scores and modes into a POSIX shared memory region, see SharedState.h, so other
+// local processes can follow the game without scraping pixels. Nothing is written if nothing has changed, and the
+// readers are only woken with a system call if one of them is asleep. Only supported on Linux.
+class StatePublisher {
+protected:
+    int descriptor = -1;
+    SharedState::Region* region = nullptr;
+
+    // What was last published, so unchanged boards aren't written.
+    struct Published {
+        DisplayState state;
+        uint32_t score;
+        Board::Mode mode;
+    };
+    std::vector<Published> published;
+    size_t publishedFocus = 0;
+
+    bool isChanged(size_t index, const Board& board, const DisplayState& state) const {
+        return published[index].state != state || published[index].score != board.getScore() ||
+            published[index].mode != board.getMode();
+    }
+
+    void wakeReaders();
+
+public:
+    StatePublisher() = default;
+    StatePublisher(const StatePublisher&) = delete;
+    StatePublisher& operator=(const StatePublisher&) = delete;
+    ~StatePublisher();
+
+    // Create or reuse the shared memory object name, e.g. /sdlTossup. Returns false, having logged why, if it can't
+    // be mapped.
+    bool open(const char* name);
+
+    // Tell the readers the game has stopped and unmap the region. It's left for the next run to reuse.
+    void close();
+
+    bool isOpen() const {
+        return region != nullptr;
+    }
+
+    // Publish the boards and the states they show if anything has changed since the last call. Only the first
+    // SharedState::MAX_BOARDS boards are published.
+    void publish(const std::vector<Board>& boards, const std::vector<DisplayState>& states, size_t focusedBoard);
+};
+
+#endif  // STATEPUBLISHER_H_
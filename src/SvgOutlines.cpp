@@ -0,0 +1,226 @@
+#include <SDL.h>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "SvgOutlines.h"
+
+namespace {
+    bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    bool isNameEnd(char c) {
+        return c == '\0' || c == '=' || c == '>' || c == '/' || isSpace(c);
+    }
+
+    bool isNamed(const char* name, const char* nameEnd, const char* expected) {
+        const size_t length = std::strlen(expected);
+        return static_cast<size_t>(nameEnd - name) == length && std::strncmp(name, expected, length) == 0;
+    }
+
+    int lineNumber(const char* text, const char* p) {
+        return 1 + static_cast<int>(std::count(text, p, '\n'));
+    }
+
+    // Read the next number of the path data as the script does, in 1/10000ths of a unit. Python's round() rounds
+    // halves to even as nearbyint does by default.
+    bool readNumber(const char*& p, const char* end, int& value) {
+        while (p < end && (isSpace(*p) || *p == ','))
+            ++p;
+        if (p >= end || !(std::isdigit(static_cast<unsigned char>(*p)) || *p == '.' || *p == '-' || *p == '+'))
+            return false;
+        char* numberEnd;
+        const double number = std::strtod(p, &numberEnd);
+        if (numberEnd == p || numberEnd > end)
+            return false;
+        value = static_cast<int>(std::nearbyint(10000 * number));
+        p = numberEnd;
+        return true;
+    }
+}
+
+bool SvgOutlines::parsePathData(const char* p, const char* end) {
+    char command = '\0';
+    int controlPoint = 0;
+    int lastX = 0;
+    int lastY = 0;
+    int firstX = 0;
+    int firstY = 0;
+    while (true) {
+        while (p < end && (isSpace(*p) || *p == ','))
+            ++p;
+        if (p >= end)
+            break;
+
+        if (std::isalpha(static_cast<unsigned char>(*p))) {
+            command = *p++;
+            controlPoint = 0;
+            if (command == 'Z' || command == 'z') {
+                // Close the path with a line back to its first point.
+                if (lastX != firstX || lastY != firstY) {
+                    lastX = firstX;
+                    lastY = firstY;
+                    nodes.push_back({ lastX, lastY, 'L' });
+                }
+            }
+            continue;
+        }
+
+        // Otherwise it's the next set of numbers for the current command.
+        const bool isRelative = std::islower(static_cast<unsigned char>(command)) != 0;
+        const int dx = isRelative ? lastX : 0;
+        const int dy = isRelative ? lastY : 0;
+        int x;
+        int y;
+        switch (std::toupper(static_cast<unsigned char>(command))) {
+        case 'M':
+            if (!readNumber(p, end, x) || !readNumber(p, end, y))
+                return false;
+            lastX = firstX = x + dx;
+            lastY = firstY = y + dy;
+            nodes.push_back({ lastX, lastY, 'M' });
+            // Any more points are lines.
+            command = isRelative ? 'l' : 'L';
+            break;
+        case 'L':
+            if (!readNumber(p, end, x) || !readNumber(p, end, y))
+                return false;
+            lastX = x + dx;
+            lastY = y + dy;
+            nodes.push_back({ lastX, lastY, 'L' });
+            break;
+        case 'H':
+            if (!readNumber(p, end, x))
+                return false;
+            lastX = x + dx;
+            nodes.push_back({ lastX, lastY, 'L' });
+            break;
+        case 'V':
+            if (!readNumber(p, end, y))
+                return false;
+            lastY = y + dy;
+            nodes.push_back({ lastX, lastY, 'L' });
+            break;
+        case 'C':
+            // Relative control points are all from the start of the curve, which only moves on at its end point.
+            if (!readNumber(p, end, x) || !readNumber(p, end, y))
+                return false;
+            nodes.push_back({ x + dx, y + dy, static_cast<char>('A' + controlPoint) });
+            controlPoint = (controlPoint + 1) % 3;
+            if (controlPoint == 0) {
+                lastX = x + dx;
+                lastY = y + dy;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+
+    // A curve that stops part way through would leave the nodes out of step.
+    if (controlPoint != 0)
+        return false;
+    nodes.push_back({ 0, 0, 'X' });
+    return true;
+}
+
+bool SvgOutlines::parse(const char* text, const char* name) {
+    outlines.clear();
+    nodes.clear();
+
+    // Elements are counted as they're opened and closed so that only the root's children are read.
+    int depth = 0;
+    const char* p = text;
+    while ((p = std::strchr(p, '<')) != nullptr) {
+        const char* tag = p;
+        if (std::strncmp(p, "<!--", 4) == 0 || std::strncmp(p, "<![CDATA[", 9) == 0) {
+            const char* close = p[2] == '-' ? "-->" : "]]>";
+            p = std::strstr(p + 4, close);
+            if (p == nullptr)
+                break;
+            p += 3;
+            continue;
+        }
+        if (p[1] == '?' || p[1] == '!' || p[1] == '/') {
+            if (p[1] == '/')
+                --depth;
+            p = std::strchr(p, '>');
+            if (p == nullptr)
+                break;
+            ++p;
+            continue;
+        }
+
+        // A start tag, pick out the attributes that matter as they go by.
+        const char* elementName = ++p;
+        while (!isNameEnd(*p))
+            ++p;
+        const bool isPath = isNamed(elementName, p, "path") || isNamed(elementName, p, "svg:path");
+        const char* label = nullptr;
+        const char* labelEnd = nullptr;
+        const char* data = nullptr;
+        const char* dataEnd = nullptr;
+        bool isEmpty = false;
+        bool isValid = false;
+        while (*p != '\0') {
+            while (isSpace(*p))
+                ++p;
+            if (*p == '>' || (p[0] == '/' && p[1] == '>')) {
+                isEmpty = *p == '/';
+                p += isEmpty ? 2 : 1;
+                isValid = true;
+                break;
+            }
+            const char* attribute = p;
+            while (!isNameEnd(*p))
+                ++p;
+            const char* attributeEnd = p;
+            while (isSpace(*p))
+                ++p;
+            if (attribute == attributeEnd || *p++ != '=')
+                break;
+            while (isSpace(*p))
+                ++p;
+            const char quote = *p;
+            const char* valueEnd = quote == '"' || quote == '\'' ? std::strchr(p + 1, quote) : nullptr;
+            if (valueEnd == nullptr)
+                break;
+            if (isNamed(attribute, attributeEnd, "d")) {
+                data = p + 1;
+                dataEnd = valueEnd;
+            } else if (isNamed(attribute, attributeEnd, "inkscape:label")) {
+                label = p + 1;
+                labelEnd = valueEnd;
+            }
+            p = valueEnd + 1;
+        }
+        if (!isValid) {
+            SDL_Log("%s line %d: the tag isn't valid.", name, lineNumber(text, tag));
+            return false;
+        }
+
+        if (isPath && depth == 1 && label != labelEnd && data != nullptr) {
+            Outline outline;
+            outline.label.assign(label, labelEnd);
+            outline.firstNode = nodes.size();
+            if (!parsePathData(data, dataEnd)) {
+                SDL_Log("%s line %d: the path %s uses something other than M, L, H, V, C and Z or is cut short.", name,
+                    lineNumber(text, tag), outline.label.c_str());
+                return false;
+            }
+            outline.nodeCount = nodes.size() - outline.firstNode;
+            outlines.push_back(outline);
+        }
+        if (!isEmpty)
+            ++depth;
+    }
+
+    if (depth != 0) {
+        SDL_Log("%s ends part way through.", name);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#ifndef SVGOUTLINES_H_
+#define SVGOUTLINES_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Outlines.h"
+
+// Reads outlines straight out of an Inkscape SVG like info/outlines.svg, giving the same nodes as
+// info/extractOutlines.py, so edits to the outlines can be tried without running the script or rebuilding. As with the
+// script only labelled <path> elements that are children of the root <svg> are read, and their d attributes may only
+// use the M, L, H, V, C and Z commands, absolute or relative. The text is scanned once in place.
+class SvgOutlines {
+public:
+    struct Outline {
+        std::string label;
+        // The outline's nodes in nodes, the last being its X.
+        size_t firstNode;
+        size_t nodeCount;
+    };
+
+protected:
+    std::vector<Outline> outlines;
+    std::vector<Outlines::Node> nodes;
+
+    bool parsePathData(const char* data, const char* end);
+
+public:
+    // Parse the NUL terminated SVG text, name is only used in messages. Returns false, having logged why, if the text
+    // isn't an SVG this can read.
+    bool parse(const char* text, const char* name);
+
+    const std::vector<Outline>& getOutlines() const {
+        return outlines;
+    }
+
+    const Outlines::Node* getNodes(const Outline& outline) const {
+        return nodes.data() + outline.firstNode;
+    }
+};
+
+#endif  // SVGOUTLINES_H_
@@ -0,0 +1,141 @@
+#include <SDL.h>
+#include <algorithm>
+#include <utility>
+
+#include "TextureBuilder.h"
+#include "Outlines.h"
+#include "Skin.h"
+
+// Defined as well as declared, std::min takes it by reference.
+constexpr size_t TextureBuilder::MAX_THREADS;
+
+TextureBuilder::TextureBuilder() {
+    SDL_AtomicSet(&nextIndex, Outlines::COUNT);
+    SDL_AtomicSet(&remaining, 0);
+    SDL_AtomicSet(&cancelled, 0);
+    mutex = SDL_CreateMutex();
+    finishedCondition = SDL_CreateCond();
+}
+
+TextureBuilder::~TextureBuilder() {
+    cancel();
+    freeFinished();
+    SDL_DestroyCond(finishedCondition);
+    SDL_DestroyMutex(mutex);
+}
+
+int TextureBuilder::run() {
+    while (SDL_AtomicGet(&cancelled) == 0) {
+        const size_t i = static_cast<size_t>(SDL_AtomicAdd(&nextIndex, 1));
+        if (i >= Outlines::COUNT)
+            return 0;
+        FinishedImage result;
+        result.outlineID = order[i];
+        // A skin made for another size is scaled again here so it doesn't hold up the game. If its photo can no
+        // longer be loaded the frame is rasterised from its outline.
+        Skin* skin = result.outlineID == Outlines::FRAME ? elementParameters.skin : nullptr;
+        if (skin != nullptr && !skin->isFor(elementParameters.bounds) && !skin->resize(elementParameters.bounds))
+            skin = nullptr;
+        if (skin != nullptr) {
+            LcdElementTexture::createImage(*skin, elementParameters, result.image);
+        } else if (elementParameters.useDistanceFields) {
+            DistanceField& field = distanceFields[result.outlineID];
+            if (!field.isCreated())
+                field.create(result.outlineID, elementParameters.bounds.getOutlinePack());
+            LcdElementTexture::createImage(field, result.outlineID, elementParameters, result.image);
+        } else {
+            LcdElementTexture::createImage(result.outlineID, elementParameters, result.image);
+        }
+        SDL_LockMutex(mutex);
+        finished.push_back(std::move(result));
+        SDL_CondSignal(finishedCondition);
+        SDL_UnlockMutex(mutex);
+    }
+    return 0;
+}
+
+void TextureBuilder::freeFinished() {
+    SDL_LockMutex(mutex);
+    finished.clear();
+    SDL_UnlockMutex(mutex);
+}
+
+void TextureBuilder::start(const ElementParameters& parameters, const size_t* priorityOrder, bool uploadTogether) {
+    cancel();
+    freeFinished();
+
+    elementParameters = parameters;
+    this->uploadTogether = uploadTogether;
+    for (size_t i = 0; i < Outlines::COUNT; ++i) {
+        order[i] = priorityOrder != nullptr ? priorityOrder[i] : i;
+        uploaded[i] = false;
+    }
+    SDL_AtomicSet(&cancelled, 0);
+    SDL_AtomicSet(&nextIndex, 0);
+    SDL_AtomicSet(&remaining, Outlines::COUNT);
+
+    // Only the threads that actually started are kept. If none did, everything is rasterised here and now rather
+    // than waiting for images that would never come.
+    const size_t wanted = std::min<size_t>(SDL_GetCPUCount(), MAX_THREADS);
+    numberOfThreads = 0;
+    for (size_t i = 0; i < wanted; ++i) {
+        SDL_Thread* thread = SDL_CreateThread(startThread, "textures", this);
+        if (thread == nullptr)
+            SDL_Log("Could not start a thread to rasterise with: %s", SDL_GetError());
+        else
+            threads[numberOfThreads++] = thread;
+    }
+    SDL_Log("Using %d threads.", static_cast<int>(numberOfThreads));
+    if (numberOfThreads == 0)
+        run();
+}
+
+void TextureBuilder::wait() {
+    for (size_t i = 0; i < numberOfThreads; ++i) SDL_WaitThread(threads[i], nullptr);
+    numberOfThreads = 0;
+}
+
+void TextureBuilder::cancel() {
+    SDL_AtomicSet(&cancelled, 1);
+    wait();
+    SDL_AtomicSet(&remaining, 0);
+}
+
+void TextureBuilder::waitFor(Screen& screen, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        while (!uploaded[order[i]] && !isComplete()) {
+            SDL_LockMutex(mutex);
+            if (finished.empty())
+                SDL_CondWait(finishedCondition, mutex);
+            SDL_UnlockMutex(mutex);
+            upload(screen);
+        }
+    }
+}
+
+bool TextureBuilder::isRasterised() {
+    SDL_LockMutex(mutex);
+    bool isRasterised = finished.size() == static_cast<size_t>(SDL_AtomicGet(&remaining));
+    SDL_UnlockMutex(mutex);
+    return isRasterised;
+}
+
+bool TextureBuilder::upload(Screen& screen) {
+    if (isComplete() || (uploadTogether && !isRasterised()))
+        return false;
+
+    std::vector<FinishedImage> ready;
+    SDL_LockMutex(mutex);
+    ready.swap(finished);
+    SDL_UnlockMutex(mutex);
+
+    for (auto& f : ready) {
+        screen.setElementImage(f.outlineID, f.image);
+        uploaded[f.outlineID] = true;
+    }
+    SDL_AtomicAdd(&remaining, -static_cast<int>(ready.size()));
+
+    if (isComplete())
+        wait();
+    return !ready.empty();
+}
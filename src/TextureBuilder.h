@@ -0,0 +1,81 @@
+#ifndef TEXTUREBUILDER_H_
+#define TEXTUREBUILDER_H_
+
+#include <SDL.h>
+#include <vector>
+
+#include "DistanceField.h"
+#include "LcdElement.h"
+#include "Screen.h"
+
+// Rasterises the element images on a pool of worker threads. Textures can only be created on the thread that owns
+// the screen, so finished images are queued and uploaded when upload() is called. This allows the rasterising
+// to carry on in the background while the game is running. Elements are rasterised in a given priority order so the
+// ones needed for the first frame can be made ready first.
+class TextureBuilder {
+protected:
+    static constexpr size_t MAX_THREADS = 8;
+
+    struct FinishedImage {
+        size_t outlineID;
+        ElementImage image;
+    };
+
+    ElementParameters elementParameters;
+    // Distance fields only depend on the outlines, not the element parameters, so are created once and kept for later
+    // builds.
+    DistanceField distanceFields[Outlines::COUNT];
+    size_t order[Outlines::COUNT];
+    bool uploaded[Outlines::COUNT];
+    bool uploadTogether = false;
+    SDL_atomic_t nextIndex;
+    SDL_atomic_t remaining;
+    SDL_atomic_t cancelled;
+    SDL_mutex* mutex;
+    SDL_cond* finishedCondition;
+    std::vector<FinishedImage> finished;
+    SDL_Thread* threads[MAX_THREADS];
+    size_t numberOfThreads = 0;
+
+    static int startThread(void* data) {
+        return reinterpret_cast<TextureBuilder*>(data)->run();
+    }
+
+    int run();
+
+    void freeFinished();
+
+public:
+    TextureBuilder();
+    ~TextureBuilder();
+
+    // Start rasterising all the elements in the background. Any build already in progress is abandoned. If given,
+    // priorityOrder lists every outline ID in the order they should be rasterised, otherwise index order is used. With
+    // uploadTogether set nothing is uploaded until every element is ready, so a set of images for a new size replaces
+    // the old set between two frames. If no worker thread can be started the elements are rasterised before this
+    // returns.
+    void start(const ElementParameters& parameters, const size_t* priorityOrder = nullptr, bool uploadTogether = false);
+
+    // Block until the worker threads have rasterised every element.
+    void wait();
+
+    // Upload textures as they are finished, blocking until the first count elements of the priority order are ready.
+    void waitFor(Screen& screen, size_t count);
+
+    // Abandon the current build and wait for the worker threads to exit.
+    void cancel();
+
+    // Upload any images that have been finished since the last call. Must be called on the thread that
+    // owns the screen. Returns true if any element was replaced.
+    bool upload(Screen& screen);
+
+    // True once every element has been rasterised and uploaded.
+    bool isComplete() {
+        return SDL_AtomicGet(&remaining) == 0;
+    }
+
+    // True once every element has been rasterised, though they may not have been uploaded yet.
+    bool isRasterised();
+};
+
+#endif  // TEXTUREBUILDER_H_
@@ -0,0 +1,258 @@
+#include <SDL.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "Skin.h"
+#include "VectorScreen.h"
+
+// Defined as well as declared, std::min takes it by reference.
+constexpr size_t VectorScreen::MAX_THREADS;
+
+namespace {
+    int greatestCommonDivisor(int a, int b) {
+        while (b != 0) {
+            int t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+}
+
+VectorScreen::VectorScreen(uint32_t clearColour) : SoftwareScreen(clearColour) {
+    SDL_AtomicSet(&nextBand, 0);
+    mutex = SDL_CreateMutex();
+    startCondition = SDL_CreateCond();
+    doneCondition = SDL_CreateCond();
+}
+
+VectorScreen::~VectorScreen() {
+    stopThreads();
+    SDL_DestroyCond(doneCondition);
+    SDL_DestroyCond(startCondition);
+    SDL_DestroyMutex(mutex);
+}
+
+void VectorScreen::stopThreads() {
+    SDL_LockMutex(mutex);
+    quitting = true;
+    SDL_CondBroadcast(startCondition);
+    SDL_UnlockMutex(mutex);
+    for (size_t i = 0; i < numberOfThreads; ++i) SDL_WaitThread(threads[i], nullptr);
+    numberOfThreads = 0;
+    quitting = false;
+    generation = 0;
+}
+
+void VectorScreen::setElementParameters(const ElementParameters& parameters) {
+    stopThreads();
+
+    const SDL_Rect screenRect = { 0, 0, framebuffer.width, framebuffer.height };
+    for (size_t outlineID = 0; outlineID < Outlines::COUNT; ++outlineID) {
+        Path& path = paths[outlineID];
+        path = Path();
+        parameters.bounds.outlineToPath(outlineID, path);
+
+        // The same pixels as LcdElementTexture::createImage would cover, less the frame's outermost pixels.
+        const int inset = outlineID == Outlines::FRAME ? 1 : 0;
+        SDL_Rect dest;
+        dest.x = static_cast<int>(std::floor(path.leftBound)) + inset;
+        dest.w = static_cast<int>(std::ceil(path.rightBound)) - inset - dest.x;
+        dest.y = static_cast<int>(std::floor(path.topBound)) + inset;
+        dest.h = static_cast<int>(std::ceil(path.bottomBound)) - inset - dest.y;
+        Element& element = elements[outlineID];
+        element.spans.clear();
+        element.pixels.clear();
+        if (!SDL_IntersectRect(&dest, &screenRect, &element.bounds))
+            element.bounds = { 0, 0, 0, 0 };
+    }
+
+    // A photo can't be rasterised from an outline, so the skin is kept as spans like SoftwareScreen's frame. After a
+    // resize it has to be scaled again first.
+    Skin* skin = parameters.skin;
+    hasSkin = skin != nullptr && (skin->isFor(parameters.bounds) || skin->resize(parameters.bounds));
+    if (hasSkin) {
+        ElementParameters skinParameters = parameters;
+        skinParameters.opaquePixelFormat = SDL_PIXELFORMAT_ARGB8888;
+        ElementImage image;
+        LcdElementTexture::createImage(*skin, skinParameters, image);
+        SoftwareScreen::setElementImage(Outlines::FRAME, image);
+    }
+
+    // Sample in the same places as LcdElementTexture::createImage.
+    const int subSamples = parameters.subSamples;
+    sampleLines.clear();
+    uint32_t samples;
+    if (!parameters.sparseSamples) {
+        for (int subY = 0; subY < subSamples; ++subY)
+            sampleLines.push_back({ static_cast<double>(subY) / subSamples, 0.0, subSamples });
+        samples = subSamples * subSamples;
+    } else {
+        int step = static_cast<int>(std::sqrt(subSamples) + 0.5);
+        while (step > 1 && greatestCommonDivisor(step, subSamples) != 1) ++step;
+        for (int subY = 0; subY < subSamples; ++subY)
+            sampleLines.push_back({ (subY + 0.5) / subSamples, -1 + ((subY * step) % subSamples + 0.5) / subSamples, 1 });
+        samples = subSamples;
+    }
+
+    colours.resize(samples + 1);
+    for (uint32_t i = 0; i <= samples; ++i) {
+        uint32_t blend1 = (0x100 * i) / samples;
+        uint32_t blend2 = 0x100 - blend1;
+        uint32_t cbr = ((parameters.onColour & 0xFF00FF) * blend1 + (parameters.offColour & 0xFF00FF) * blend2) >> 8;
+        uint32_t cg = ((parameters.onColour & 0xFF00) * blend1 + (parameters.offColour & 0xFF00) * blend2) >> 8;
+        colours[i] = convert(((cbr & 0xFF) << 16) | (cg & 0xFF00) | ((cbr >> 16) & 0xFF));
+    }
+
+    // The thread calling render() does its share of the work, so it has the first worker.
+    workers.clear();
+    workers.resize(std::max<size_t>(1, std::min<size_t>(SDL_GetCPUCount(), MAX_THREADS)));
+    for (Worker& worker : workers) {
+        std::copy(std::begin(paths), std::end(paths), worker.paths);
+        std::fill(std::begin(worker.lastRow), std::end(worker.lastRow), INT_MAX);
+        worker.coverage = std::make_unique<uint16_t[]>(std::max(framebuffer.width, 1));
+    }
+    // Only the threads that started are counted, compose() waits for that many. With none it draws every band itself.
+    for (size_t i = 1; i < workers.size(); ++i) {
+        threadStarts[numberOfThreads] = { this, i };
+        threads[numberOfThreads] = SDL_CreateThread(startThread, "vector", &threadStarts[numberOfThreads]);
+        if (threads[numberOfThreads] == nullptr)
+            SDL_Log("Could not start a thread to draw with: %s", SDL_GetError());
+        else
+            ++numberOfThreads;
+    }
+
+    redrawAll = true;
+}
+
+void VectorScreen::setElementImage(size_t outlineID, const ElementImage& image) {
+    // Nothing is kept, elements are rasterised from their outlines as they are drawn.
+}
+
+int VectorScreen::run(Worker& worker) {
+    SDL_LockMutex(mutex);
+    int started = 0;
+    while (true) {
+        while (!quitting && generation == started) SDL_CondWait(startCondition, mutex);
+        if (quitting)
+            break;
+        started = generation;
+        SDL_UnlockMutex(mutex);
+
+        drawBands(worker);
+
+        SDL_LockMutex(mutex);
+        if (--busyThreads == 0)
+            SDL_CondSignal(doneCondition);
+    }
+    SDL_UnlockMutex(mutex);
+    return 0;
+}
+
+void VectorScreen::compose(const DisplayState& state) {
+    if (workers.empty()) {
+        SoftwareScreen::compose(state);
+        return;
+    }
+
+    firstRow = INT_MAX;
+    int endRow = INT_MIN;
+    for (const SDL_Rect& rect : dirtyRects) {
+        firstRow = std::min(firstRow, rect.y);
+        endRow = std::max(endRow, rect.y + rect.h);
+    }
+    if (firstRow >= endRow)
+        return;
+    bandCount = (endRow - firstRow + BAND_HEIGHT - 1) / BAND_HEIGHT;
+    composeState = &state;
+    SDL_AtomicSet(&nextBand, 0);
+
+    // A single band isn't worth waking the other threads for.
+    const bool useThreads = numberOfThreads > 0 && bandCount > 1;
+    if (useThreads) {
+        SDL_LockMutex(mutex);
+        ++generation;
+        busyThreads = numberOfThreads;
+        SDL_CondBroadcast(startCondition);
+        SDL_UnlockMutex(mutex);
+    }
+
+    drawBands(workers[0]);
+
+    if (useThreads) {
+        SDL_LockMutex(mutex);
+        while (busyThreads > 0) SDL_CondWait(doneCondition, mutex);
+        SDL_UnlockMutex(mutex);
+    }
+    composeState = nullptr;
+}
+
+void VectorScreen::drawBands(Worker& worker) {
+    const DisplayState& state = *composeState;
+    int band;
+    while ((band = SDL_AtomicAdd(&nextBand, 1)) < bandCount) {
+        const int y0 = firstRow + band * BAND_HEIGHT;
+        for (int y = y0; y < y0 + BAND_HEIGHT; ++y) {
+            // Each band is drawn by one thread, so where dirty rects overlap their pixels are just drawn twice.
+            for (const SDL_Rect& rect : dirtyRects) {
+                if (y < rect.y || y >= rect.y + rect.h)
+                    continue;
+
+                uint8_t* line = framebuffer.pixels + y * framebuffer.pitch + rect.x * bytesPerPixel;
+                if (bytesPerPixel == 4)
+                    std::fill_n(reinterpret_cast<uint32_t*>(line), rect.w, clearPixel);
+                else
+                    std::fill_n(reinterpret_cast<uint16_t*>(line), rect.w, static_cast<uint16_t>(clearPixel));
+
+                if (state.isSet(Outlines::FRAME))
+                    drawRow(worker, Outlines::FRAME, y, rect.x, rect.x + rect.w);
+                state.forEach([&](size_t outlineID) {
+                    if (outlineID != Outlines::FRAME)
+                        drawRow(worker, outlineID, y, rect.x, rect.x + rect.w);
+                });
+            }
+        }
+    }
+}
+
+void VectorScreen::drawRow(Worker& worker, size_t outlineID, int y, int x0, int x1) {
+    const SDL_Rect& bounds = elements[outlineID].bounds;
+    if (y < bounds.y || y >= bounds.y + bounds.h)
+        return;
+    x0 = std::max(x0, bounds.x);
+    x1 = std::min(x1, bounds.x + bounds.w);
+    if (x0 >= x1)
+        return;
+    if (hasSkin && outlineID == Outlines::FRAME) {
+        drawElement(elements[outlineID], { x0, y, x1 - x0, 1 });
+        return;
+    }
+
+    // Each row is scanned at several heights, so coming back to a row in another dirty rect means starting again.
+    Path& path = worker.paths[outlineID];
+    if (y <= worker.lastRow[outlineID])
+        path.rewind();
+    worker.lastRow[outlineID] = y;
+
+    const int length = x1 - x0;
+    uint16_t* coverage = worker.coverage.get();
+    std::fill_n(coverage, length, 0);
+    for (const SampleLine& sampleLine : sampleLines)
+        path.scanLine(y + sampleLine.y, x0 + sampleLine.x, 1, length, sampleLine.subSamples, coverage);
+
+    // Like the element images the frame is opaque, any other element only covers the pixels it touches.
+    const bool isFrame = outlineID == Outlines::FRAME;
+    uint8_t* line = framebuffer.pixels + y * framebuffer.pitch + x0 * bytesPerPixel;
+    if (bytesPerPixel == 4) {
+        auto out = reinterpret_cast<uint32_t*>(line);
+        for (int x = 0; x < length; ++x)
+            if (isFrame || coverage[x] != 0)
+                out[x] = colours[coverage[x]];
+    } else {
+        auto out = reinterpret_cast<uint16_t*>(line);
+        for (int x = 0; x < length; ++x)
+            if (isFrame || coverage[x] != 0)
+                out[x] = static_cast<uint16_t>(colours[coverage[x]]);
+    }
+}
@@ -0,0 +1,86 @@
+#ifndef VECTORSCREEN_H_
+#define VECTORSCREEN_H_
+
+#include <SDL.h>
+#include <memory>
+#include <vector>
+
+#include "Path.h"
+#include "SoftwareScreen.h"
+
+// A SoftwareScreen that keeps no element images at all, only the flattened outlines. Each frame the lit elements are
+// rasterised again over the dirty rects, straight into the framebuffer, so memory use is about one framebuffer
+// whatever the resolution. The rows to draw are split into bands that a pool of threads rasterise in parallel.
+class VectorScreen : public SoftwareScreen {
+protected:
+    static constexpr size_t MAX_THREADS = 8;
+    static constexpr int BAND_HEIGHT = 8;
+
+    // A horizontal line through a pixel row that is sampled, x is relative to the pixel's left hand side.
+    struct SampleLine {
+        double y;
+        double x;
+        int subSamples;
+    };
+
+    // Paths are scanned in increasing y, so each thread has its own copies.
+    struct Worker {
+        Path paths[Outlines::COUNT];
+        int lastRow[Outlines::COUNT];
+        std::unique_ptr<uint16_t[]> coverage;
+    };
+
+    Path paths[Outlines::COUNT];
+    std::vector<SampleLine> sampleLines;
+    std::vector<uint32_t> colours;
+    std::vector<Worker> workers;
+    // Set when the frame is a skin, drawn from elements[Outlines::FRAME] rather than its outline.
+    bool hasSkin = false;
+
+    // What the current call to compose() is drawing.
+    const DisplayState* composeState = nullptr;
+    int firstRow = 0;
+    int bandCount = 0;
+    SDL_atomic_t nextBand;
+
+    SDL_mutex* mutex;
+    SDL_cond* startCondition;
+    SDL_cond* doneCondition;
+    int generation = 0;
+    size_t busyThreads = 0;
+    bool quitting = false;
+    SDL_Thread* threads[MAX_THREADS];
+    size_t numberOfThreads = 0;
+
+    struct ThreadStart {
+        VectorScreen* screen;
+        size_t worker;
+    };
+    ThreadStart threadStarts[MAX_THREADS];
+
+    static int startThread(void* data) {
+        auto start = reinterpret_cast<ThreadStart*>(data);
+        return start->screen->run(start->screen->workers[start->worker]);
+    }
+
+    int run(Worker& worker);
+    void stopThreads();
+    void drawBands(Worker& worker);
+    void drawRow(Worker& worker, size_t outlineID, int y, int x0, int x1);
+    void compose(const DisplayState& state) override;
+
+public:
+    // The colour shows around the edge of the frame.
+    explicit VectorScreen(uint32_t clearColour);
+    ~VectorScreen() override;
+
+    bool usesElementImages() const override {
+        return false;
+    }
+
+    // Flatten the outlines for the framebuffer's size, so this must come after it is set.
+    void setElementParameters(const ElementParameters& parameters) override;
+    void setElementImage(size_t outlineID, const ElementImage& image) override;
+};
+
+#endif  // VECTORSCREEN_H_
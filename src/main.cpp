@@ -1,14 +1,28 @@
 #include <SDL.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
 #include <cstring>
 #include <ctime>
 #include <iostream>
 #include <memory>
+#include <vector>
 
+#include "Board.h"
+#include "FrameWriter.h"
 #include "GameSounds.h"
 #include "GameState.h"
+#include "GlesScreen.h"
+#include "InputLog.h"
+#include "OutlinePack.h"
+#include "RasterBaseline.h"
+#include "RendererScreen.h"
+#include "Skin.h"
+#include "SoftwareScreen.h"
+#include "StatePublisher.h"
+#include "TextureBuilder.h"
+#include "VectorScreen.h"
 
 
 namespace o = Outlines;
@@ -77,9 +91,40 @@ public:
     int width = -1;
     int height = -1;
     int displayIndex = 0;
+    // Every -d given, a window is opened on each.
+    std::vector<int> displays;
+    bool split = false;
     uint32_t offColour = 0x708080;
     uint32_t onColour = 0x424242;
+    bool hasOffColour = false;
     bool showInfo = false;
+    bool progressive = false;
+    bool sparseSamples = false;
+    bool useDistanceFields = false;
+    bool useGles = false;
+    bool useVector = false;
+    const char* framebufferDevice = nullptr;
+    const char* outputPath = nullptr;
+    std::vector<DisplayState> states;
+    int frames = 1;
+    const char* recordPath = nullptr;
+#ifdef NO_BUILTIN_OUTLINES
+    const char* outlinesPath = "outlines.pack";
+#else
+    const char* outlinesPath = nullptr;
+#endif
+    const char* verifyPath = nullptr;
+    const char* timesPath = nullptr;
+    const char* skinPath = nullptr;
+    int boards = 1;
+    const char* publishName = nullptr;
+    const char* sessionPath = nullptr;
+    const char* replayPath = nullptr;
+    double replaySpeed = 1.0;
+    // 'a' or 'b' to have the game played perfectly for autoplayLength seconds.
+    char autoplayGame = 0;
+    int autoplayLength = 60;
+    const char* wavPath = nullptr;
 
     bool parse(int argc, char* argv[]) {
         int i = 1;
@@ -101,6 +146,8 @@ public:
                     char* end;
                     displayIndex = std::strtol(argv[i], &end, 10);
                     ok = *end == '\0';
+                    displays.push_back(displayIndex);
+                    displayIndex = displays.front();
                 }
             } else if (std::strcmp(argv[i], "-lcd") == 0 || std::strcmp(argv[i], "-back") == 0) {
                 bool isOn = std::strcmp(argv[i], "-lcd") == 0;
@@ -112,10 +159,103 @@ public:
                         onColour = colour;
                     else
                         offColour = colour;
+                    hasOffColour = hasOffColour || !isOn;
                     ok = *end == '\0';
                 }
             } else if (std::strcmp(argv[i], "-info") == 0) {
                 showInfo = true;
+            } else if (std::strcmp(argv[i], "-p") == 0) {
+                progressive = true;
+            } else if (std::strcmp(argv[i], "-sparse") == 0) {
+                sparseSamples = true;
+            } else if (std::strcmp(argv[i], "-sdf") == 0) {
+                useDistanceFields = true;
+            } else if (std::strcmp(argv[i], "-gles") == 0) {
+                useGles = true;
+            } else if (std::strcmp(argv[i], "-vector") == 0) {
+                useVector = true;
+            } else if (std::strcmp(argv[i], "-fb") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    framebufferDevice = argv[i];
+            } else if (std::strcmp(argv[i], "-out") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    outputPath = argv[i];
+            } else if (std::strcmp(argv[i], "-state") == 0) {
+                ok = ++i < argc;
+                if (ok) {
+                    DisplayState state;
+                    ok = state.fromHex(argv[i]);
+                    states.push_back(state);
+                }
+            } else if (std::strcmp(argv[i], "-record") == 0 || std::strcmp(argv[i], "-verify") == 0) {
+                const bool isRecord = std::strcmp(argv[i], "-record") == 0;
+                ok = ++i < argc;
+                if (ok)
+                    (isRecord ? recordPath : verifyPath) = argv[i];
+            } else if (std::strcmp(argv[i], "-times") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    timesPath = argv[i];
+            } else if (std::strcmp(argv[i], "-outlines") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    outlinesPath = argv[i];
+            } else if (std::strcmp(argv[i], "-skin") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    skinPath = argv[i];
+            } else if (std::strcmp(argv[i], "-boards") == 0) {
+                ok = ++i < argc;
+                if (ok) {
+                    char* end;
+                    boards = std::strtol(argv[i], &end, 10);
+                    ok = *end == '\0' && boards >= 1 && boards <= 256;
+                }
+            } else if (std::strcmp(argv[i], "-split") == 0) {
+                split = true;
+            } else if (std::strcmp(argv[i], "-publish") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    publishName = argv[i];
+            } else if (std::strcmp(argv[i], "-session") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    sessionPath = argv[i];
+            } else if (std::strcmp(argv[i], "-replay") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    replayPath = argv[i];
+            } else if (std::strcmp(argv[i], "-speed") == 0) {
+                ok = ++i < argc;
+                if (ok) {
+                    char* end;
+                    replaySpeed = std::strtod(argv[i], &end);
+                    ok = *end == '\0' && replaySpeed >= 0.0;
+                }
+            } else if (std::strcmp(argv[i], "-autoplay") == 0) {
+                ok = ++i < argc && (std::strcmp(argv[i], "a") == 0 || std::strcmp(argv[i], "b") == 0);
+                if (ok)
+                    autoplayGame = argv[i][0];
+            } else if (std::strcmp(argv[i], "-length") == 0) {
+                ok = ++i < argc;
+                if (ok) {
+                    char* end;
+                    autoplayLength = std::strtol(argv[i], &end, 10);
+                    ok = *end == '\0' && autoplayLength >= 1 && autoplayLength <= 24 * 60 * 60;
+                }
+            } else if (std::strcmp(argv[i], "-wav") == 0) {
+                ok = ++i < argc;
+                if (ok)
+                    wavPath = argv[i];
+            } else if (std::strcmp(argv[i], "-frames") == 0) {
+                ok = ++i < argc;
+                if (ok) {
+                    char* end;
+                    frames = std::strtol(argv[i], &end, 10);
+                    ok = *end == '\0' && frames >= 1;
+                }
             } else {
                 char* end;
                 int number = std::strtol(argv[i], &end, 10);
@@ -132,6 +272,16 @@ public:
             ++i;
         }
 
+        ok = ok && subsamples >= 1 && subsamples <= (sparseSamples ? 4096 : 64);
+        ok = ok && (sessionPath == nullptr || replayPath == nullptr);
+        ok = ok && (autoplayGame == 0 || (replayPath == nullptr && sessionPath == nullptr));
+        ok = ok && (wavPath == nullptr || replayPath != nullptr || autoplayGame != 0);
+        ok = ok && (wavPath == nullptr || autoplayGame == 0 || autoplayLength <= GameSounds::MAX_WAV_SECONDS);
+        // -out draws either the states given or a replay, and -wav doesn't draw at all.
+        ok = ok && (outputPath == nullptr || wavPath == nullptr);
+        ok = ok && (states.empty() || (replayPath == nullptr && autoplayGame == 0));
+        ok = ok && (timesPath == nullptr || recordPath != nullptr || verifyPath != nullptr);
+
         bool areBothDefault = (width == -1 && height == -1);
         bool areNeithDefault = (width != -1) && (height != -1);
 
@@ -139,17 +289,69 @@ public:
     }
 
     void showUsage() {
-        std::cout << "sdlTossup [-f] [-d <display_index>] [-s <subsamples>] [-lcd <hexcolour>] [-back <hexcolour>] "
+        std::cout << "sdlTossup [-f] [-p] [-d <display_index>] [-s <subsamples>] [-sparse] [-sdf] [-gles] [-fb <device>] [-vector] [-out <file> [-state <hexstate>]... [-frames <n>]] "
+                     "[-record <file> | -verify <file>] [-times <file>] [-outlines <file>] [-skin <file>] [-boards <n>] [-split] [-publish <name>] [-session <file> | -replay <file> [-speed <n>]] "
+                     "[-autoplay <a|b> [-length <seconds>]] [-wav <file>] [-lcd <hexcolour>] [-back <hexcolour>] "
                      "[<width> <height>]"
                   << std::endl;
         std::cout << std::endl;
         std::cout << "-f        run game in fullscreen mode." << std::endl;
-        std::cout << "-d        display game on the monitor given by <display_index>." << std::endl;
-        std::cout << "-s        size <subsamples> by <subsamples> grid used for anti-aliasing. Can be 1 to 15."
+        std::cout << "-p        progressive mode, start quickly with low quality graphics and refine them in the background."
+                  << std::endl;
+        std::cout << "-d        display game on the monitor given by <display_index>. Given more than once, each "
+                     "monitor has its own window made and drawn by its own thread, which needs the x11 or KMSDRM video "
+                     "driver." << std::endl;
+        std::cout << "-s        size <subsamples> by <subsamples> grid used for anti-aliasing. Can be 1 to 64."
+                  << std::endl;
+        std::cout << "-sparse   anti-alias with <subsamples> samples in an n-rooks pattern instead of a grid. Can be 1 to "
+                     "4096." << std::endl;
+        std::cout << "-sdf      build the graphics from distance fields of the outlines, ignores -s and -sparse."
+                  << std::endl;
+        std::cout << "-gles     draw with OpenGL ES 2 directly rather than an SDL renderer." << std::endl;
+        std::cout << "-fb       draw on the CPU straight into the Linux framebuffer <device> (e.g. /dev/fb0) rather than "
+                     "a window." << std::endl;
+        std::cout << "-vector   draw on the CPU, rasterising the lit outlines every frame rather than keeping images of "
+                     "them. Ignores -p and -sdf." << std::endl;
+        std::cout << "-out      don't open a window, draw frames in memory and write them to <file>: numbered PPM files "
+                     "if it contains %d, one PPM file with every frame if it ends .ppm, otherwise raw RGB (- for "
+                     "stdout). With -replay or -autoplay, a frame for the start and every move and input." << std::endl;
+        std::cout << "-state    with -out, draw the elements lit in <hexstate>, bit n being outline n. Can be given "
+                     "more than once." << std::endl;
+        std::cout << "-frames   with -out and no -state, draw <n> frames stepping through the game's poses, balls and "
+                     "scores. Defaults to 1." << std::endl;
+        std::cout << "-record   rasterise every outline at several sizes and sample counts, save the results to "
+                     "<file> and exit." << std::endl;
+        std::cout << "-verify   rasterise every outline as -record does, compare with the baseline in <file> and exit "
+                     "with 1 if the output differs or an outline is over its edge budget." << std::endl;
+        std::cout << "-times    with -record, save how long each outline took to <file> too. With -verify, also fail "
+                     "outlines well over the times in <file>. Only meaningful on the machine that recorded them."
+                  << std::endl;
+        std::cout << "-outlines draw the outlines in the pack <file> written by extractOutlines.py rather than the built "
+                     "in ones. If <file> ends .svg the outlines are read straight from an Inkscape SVG like outlines.svg."
                   << std::endl;
+        std::cout << "-skin     draw the photo of the game in the BMP or binary PPM <file> in place of the plain "
+                     "background. Scaled copies are cached for each screen size." << std::endl;
+        std::cout << "-boards   play <n> games side by side, Tab or a click picks the one the keys control. Can be 1 "
+                     "to 256." << std::endl;
+        std::cout << "-split    with more than one -d, deal the boards out between the monitors rather than showing "
+                     "them all on each." << std::endl;
+        std::cout << "-publish  write the boards' lit elements, scores and modes to the POSIX shared memory <name> (e.g. "
+                     "/sdlTossup) for other processes to follow. Linux only." << std::endl;
+        std::cout << "-session  record every key press, with when it was made, to <file> so the session can be "
+                     "replayed." << std::endl;
+        std::cout << "-replay   play the session recorded in <file> with -session instead of taking keys from the "
+                     "player, X still quits." << std::endl;
+        std::cout << "-speed    with -replay, play <n> times faster than real time, 0 for as fast as the frames can "
+                     "be drawn. Defaults to 1." << std::endl;
+        std::cout << "-autoplay play game A or B catching every ball, as a replay so -speed applies." << std::endl;
+        std::cout << "-length   with -autoplay, play for <seconds>, up to a day or 13 hours with -wav. Defaults to 60."
+                  << std::endl;
+        std::cout << "-wav      with -replay or -autoplay, don't open a window, write the beeps to the WAV <file> at "
+                     "the samples they're due on as fast as possible and exit." << std::endl;
         std::cout << "-lcd      the colour in as an BBGGRR hex string for the LCD elements. Defaults to 424242."
                   << std::endl;
-        std::cout << "-back     the colour in as an BBGGRR hex string for the screen background. Defaults to 708080."
+        std::cout << "-back     the colour in as an BBGGRR hex string for the screen background. Defaults to 708080, "
+                     "or with -skin the photo's colour under the frame."
                   << std::endl;
         std::cout << "-info     Show display and audio info and then exit." << std::endl;
         std::cout << "<width>   width of the game texture." << std::endl;
@@ -177,8 +379,7 @@ void showInfo() {
 
 
 bool GameSounds::WavBuffer::loadWav(const char* fileName) {
-    SDL_AudioSpec loadedSpec;
-    if (SDL_LoadWAV(fileName, &loadedSpec, &buffer, &length) == nullptr) {
+    if (SDL_LoadWAV(fileName, &spec, &buffer, &length) == nullptr) {
         SDL_Log("Failed to load file %s: %s", fileName, SDL_GetError());
         return false;
     }
@@ -188,16 +389,22 @@ bool GameSounds::WavBuffer::loadWav(const char* fileName) {
 GameSounds::~GameSounds() {
     if (audioDeviceID != 0)
         SDL_CloseAudioDevice(audioDeviceID);
+    if (wavFile != nullptr)
+        std::fclose(wavFile);
+}
+
+bool GameSounds::loadBuffers() {
+    return innerBuffer.loadWav("inner.wav") && midBuffer.loadWav("mid.wav") && outerBuffer.loadWav("outer.wav") &&
+        catchBuffer.loadWav("catch.wav") && dropBuffer.loadWav("drop.wav");
 }
 
 bool GameSounds::init() {
-    if (audioDeviceID != 0) {
+    if (audioDeviceID != 0 || wavFile != nullptr) {
         SDL_Log("Error, game sounds are already initialised.");
         return false;
     }
 
-    if (!innerBuffer.loadWav("inner.wav") || !midBuffer.loadWav("mid.wav") || !outerBuffer.loadWav("outer.wav") ||
-        !catchBuffer.loadWav("catch.wav") || !dropBuffer.loadWav("drop.wav"))
+    if (!loadBuffers())
         return false;
 
     SDL_AudioSpec desiredSpec = { 0 };
@@ -218,14 +425,330 @@ bool GameSounds::init() {
     return true;
 }
 
+namespace {
+    // The format the device is opened with, which the beeps are written in too.
+    const int WAV_RATE = 44100;
+    const int WAV_BYTES_PER_SAMPLE = 2;
+
+    void writeWavHeader(FILE* file, uint64_t samples) {
+        const uint32_t dataSize = static_cast<uint32_t>(samples * WAV_BYTES_PER_SAMPLE);
+        const uint32_t header[] = {
+            SDL_SwapLE32(0x46464952), SDL_SwapLE32(36 + dataSize), SDL_SwapLE32(0x45564157), SDL_SwapLE32(0x20746D66),
+            SDL_SwapLE32(16), SDL_SwapLE32(0x00010001), SDL_SwapLE32(WAV_RATE),
+            SDL_SwapLE32(WAV_RATE * WAV_BYTES_PER_SAMPLE), SDL_SwapLE32(0x00100000 | WAV_BYTES_PER_SAMPLE),
+            SDL_SwapLE32(0x61746164), SDL_SwapLE32(dataSize)
+        };
+        std::fwrite(header, sizeof(header), 1, file);
+    }
+}
+
+bool GameSounds::openWav(const char* path) {
+    if (audioDeviceID != 0 || wavFile != nullptr) {
+        SDL_Log("Error, game sounds are already initialised.");
+        return false;
+    }
+    if (!loadBuffers())
+        return false;
+    for (const WavBuffer* wav : { &innerBuffer, &midBuffer, &outerBuffer, &catchBuffer, &dropBuffer }) {
+        if (wav->spec.freq != WAV_RATE || wav->spec.format != AUDIO_S16LSB || wav->spec.channels != 1) {
+            SDL_Log("The beeps must be %dHz 16 bit mono to be written to a WAV file.", WAV_RATE);
+            return false;
+        }
+    }
+
+    wavFile = std::fopen(path, "wb");
+    if (wavFile == nullptr) {
+        SDL_Log("Could not create %s: %s", path, std::strerror(errno));
+        return false;
+    }
+    // The sizes are filled in once they're known.
+    writeWavHeader(wavFile, 0);
+    wavTick = 0;
+    wavSamples = 0;
+    return true;
+}
+
+void GameSounds::writeSilence(uint64_t samples) {
+    static const int16_t silence[1024] = {};
+    for (; samples > 0; samples -= std::min<uint64_t>(samples, 1024))
+        std::fwrite(silence, WAV_BYTES_PER_SAMPLE, static_cast<size_t>(std::min<uint64_t>(samples, 1024)), wavFile);
+}
+
+void GameSounds::writeWav(const WavBuffer& wav) {
+    const uint64_t start = static_cast<uint64_t>(wavTick) * WAV_RATE / 1000;
+    if (start > wavSamples) {
+        writeSilence(start - wavSamples);
+        wavSamples = start;
+    }
+    std::fwrite(wav.buffer, 1, wav.length, wavFile);
+    wavSamples += wav.length / WAV_BYTES_PER_SAMPLE;
+}
+
+bool GameSounds::closeWav(Uint32 endTick) {
+    const uint64_t end = static_cast<uint64_t>(endTick) * WAV_RATE / 1000;
+    // The header can't give the size of anything longer.
+    if (std::max(end, wavSamples) * WAV_BYTES_PER_SAMPLE > UINT32_MAX - 36) {
+        std::fclose(wavFile);
+        wavFile = nullptr;
+        SDL_Log("The beeps are too long for a WAV file, it can hold at most %d seconds.", MAX_WAV_SECONDS);
+        return false;
+    }
+    if (end > wavSamples) {
+        writeSilence(end - wavSamples);
+        wavSamples = end;
+    }
+    std::fseek(wavFile, 0, SEEK_SET);
+    writeWavHeader(wavFile, wavSamples);
+    const bool ok = std::ferror(wavFile) == 0;
+    std::fclose(wavFile);
+    wavFile = nullptr;
+    if (!ok)
+        SDL_Log("Could not write the WAV file: %s", std::strerror(errno));
+    return ok;
+}
+
 Uint32 playBeep(Uint32 interval, void* param) {
     reinterpret_cast<GameSounds*>(param)->playCatchBeep();
     return 300; 
 }
 
-int main(int argc, char* argv[]) {
-    SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO);
+// A repeatable sequence of frames like those seen in a game, for when -out is given without -state.
+DisplayState sweepState(int frame) {
+    DisplayState state = DisplayState::forPose(frame % 3);
+    state |= DisplayState::forScore(frame);
+    state |= DisplayState::forOuterBall(frame % 22);
+    state |= DisplayState::forMidBall(frame % 18);
+    state |= DisplayState::forInnerBall(frame % 14);
+    return state;
+}
+
+// Make the -skin photo for one board's share of a w by h screen. Unless -back was given the edges of the elements are
+// blended with the photo's colour under the frame rather than the default background.
+bool createSkin(CommandLineParameters& parameters, const OutlinePack* outlinePack, int w, int h, Skin& skin) {
+    std::vector<SDL_Rect> viewports;
+    Board::layout(w, h, parameters.boards, outlinePack, viewports);
+    Bounds bounds;
+    bounds.computeBounds(viewports[0].w, viewports[0].h, outlinePack);
+    if (!skin.create(parameters.skinPath, bounds, viewports[0].w, viewports[0].h, parameters.offColour))
+        return false;
+    if (!parameters.hasOffColour)
+        parameters.offColour = skin.getFrameColour();
+    return true;
+}
+
+// Returns false if the session can't be recorded.
+bool setUpGame(const CommandLineParameters& parameters, const OutlinePack* outlinePack, Skin* skin,
+    StatePublisher* publisher, const InputLog* replay, GameState& gameState) {
+    gameState.setGameColours(parameters.onColour, parameters.offColour);
+    gameState.setSparseSamples(parameters.sparseSamples);
+    gameState.setUseDistanceFields(parameters.useDistanceFields);
+    gameState.setOutlinePack(outlinePack);
+    gameState.setSkin(skin);
+    gameState.setBoardCount(parameters.boards);
+    gameState.setPublisher(publisher);
+    if (replay != nullptr) {
+        gameState.setReplay(replay, parameters.replaySpeed);
+        gameState.setAutoplay(parameters.autoplayGame != 0);
+    }
+    else if (parameters.sessionPath != nullptr && !gameState.recordInputs(parameters.sessionPath))
+        return false;
+    return true;
+}
+
+// Draw frames in memory rather than on a display and write them out, for regression tests and measuring throughput.
+// With a replay there's a frame for the start and each move or input, otherwise one for each -state or the sweep.
+int renderHeadless(const CommandLineParameters& parameters, const OutlinePack* outlinePack, Skin* skin,
+    const InputLog* replay, int w, int h) {
+    std::unique_ptr<SoftwareScreen> screen;
+    if (parameters.useVector)
+        screen = std::make_unique<VectorScreen>(parameters.onColour);
+    else
+        screen = std::make_unique<SoftwareScreen>(parameters.onColour);
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(w) * h * 4);
+    Framebuffer framebuffer;
+    framebuffer.pixels = pixels.data();
+    framebuffer.width = w;
+    framebuffer.height = h;
+    framebuffer.pitch = w * 4;
+    screen->setFramebuffer(framebuffer);
+
+    FrameWriter writer;
+    if (!writer.open(parameters.outputPath))
+        return 1;
 
+    std::vector<SDL_Rect> viewports;
+    Board::layout(w, h, parameters.boards, outlinePack, viewports);
+    ElementParameters elementParameters;
+    elementParameters.bounds.computeBounds(viewports[0].w, viewports[0].h, outlinePack);
+    elementParameters.onColour = parameters.onColour;
+    elementParameters.offColour = parameters.offColour;
+    elementParameters.subSamples = parameters.subsamples;
+    elementParameters.sparseSamples = parameters.sparseSamples;
+    elementParameters.useDistanceFields = parameters.useDistanceFields;
+    elementParameters.skin = skin;
+    TextureBuilder textureBuilder;
+    if (screen->usesElementImages()) {
+        elementParameters.pixelFormat = screen->choosePixelFormat(false);
+        elementParameters.opaquePixelFormat = screen->choosePixelFormat(true);
+        textureBuilder.start(elementParameters);
+        textureBuilder.waitFor(*screen, Outlines::COUNT);
+        screen->elementsComplete();
+    } else {
+        screen->setElementParameters(elementParameters);
+    }
+
+    std::chrono::high_resolution_clock::duration renderTime(0);
+    auto drawFrame = [&](const std::vector<DisplayState>& states) {
+        auto s = std::chrono::high_resolution_clock::now();
+        if (states.size() == 1)
+            screen->render(states[0]);
+        else
+            screen->renderBoards(states.data(), viewports.data(), states.size());
+        screen->present();
+        renderTime += std::chrono::high_resolution_clock::now() - s;
+        return writer.write(framebuffer);
+    };
+
+    if (replay != nullptr) {
+        GameState gameState;
+        setUpGame(parameters, outlinePack, skin, nullptr, replay, gameState);
+        if (!gameState.drawReplay(drawFrame))
+            return 1;
+    } else {
+        const int frames = parameters.states.empty() ? parameters.frames : static_cast<int>(parameters.states.size());
+        std::vector<DisplayState> states(viewports.size());
+        for (int frame = 0; frame < frames; ++frame) {
+            // Each board is a frame further through the sweep than the one before.
+            for (size_t i = 0; i < states.size(); ++i) {
+                states[i] = parameters.states.empty() ? sweepState(frame + static_cast<int>(i)) :
+                    parameters.states[frame];
+            }
+            if (!drawFrame(states))
+                return 1;
+        }
+    }
+
+    // stdout may be carrying the frames.
+    const int frames = writer.getFrameCount();
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(renderTime).count();
+    std::cerr << "rendered " << frames << " frames in " << microseconds / 1000.0 << "ms, "
+              << microseconds / 1000.0 / frames << "ms per frame." << std::endl;
+    return 0;
+}
+
+// The flags for a game window. If it's to be drawn with OpenGL ES the context is set up first.
+Uint32 getWindowFlags(const CommandLineParameters& parameters) {
+    Uint32 windowFlags = parameters.fullscreen ? SDL_WINDOW_FULLSCREEN : SDL_WINDOW_BORDERLESS;
+    if (parameters.useGles && !parameters.useVector) {
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
+        windowFlags |= SDL_WINDOW_OPENGL;
+    }
+    return windowFlags;
+}
+
+// Make the screen that draws in the window. renderer is set if an SDL renderer was created, it's destroyed after the
+// screen. Returns nullptr, having said why, if the screen can't be made.
+std::unique_ptr<Screen> createScreen(const CommandLineParameters& parameters, SDL_Window* window,
+    SDL_Renderer*& renderer) {
+    if (parameters.useVector) {
+        auto vectorScreen = std::make_unique<VectorScreen>(parameters.onColour);
+        if (!vectorScreen->setWindow(window)) {
+            std::cerr << "Error drawing to the window surface." << std::endl;
+            return nullptr;
+        }
+        return std::move(vectorScreen);
+    } else if (parameters.useGles) {
+        auto glesScreen = std::make_unique<GlesScreen>(window, parameters.onColour);
+        if (!glesScreen->init()) {
+            std::cerr << "Error initialising OpenGL ES." << std::endl;
+            return nullptr;
+        }
+        return std::move(glesScreen);
+    }
+
+    renderer = SDL_CreateRenderer(window, 0, SDL_RENDERER_ACCELERATED);  // | SDL_RENDERER_PRESENTVSYNC);
+    if (renderer == nullptr) {
+        std::cerr << "Error creating renderer:" << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+    return std::make_unique<RendererScreen>(renderer, parameters.onColour);
+}
+
+// Make a session for -autoplay that starts game A, or B, straight away and quits after seconds.
+void makeAutoplaySession(bool isGameA, int seconds, InputLog& session) {
+    Board board;
+    session.startTime = std::time(nullptr);
+    session.focusedBoard = 0;
+    session.boardValues.resize(Board::SAVED_VALUES);
+    board.save(SDL_GetTicks(), session.boardValues.data());
+
+    // As if the key had been pressed and released.
+    InputLog::Event event = { 0, isGameA ? InputLog::Action::START_GAME_A_HI_SCORE :
+        InputLog::Action::START_GAME_B_HI_SCORE, 0 };
+    session.events.push_back(event);
+    event.action = isGameA ? InputLog::Action::START_GAME_A : InputLog::Action::START_GAME_B;
+    session.events.push_back(event);
+    event.tick = static_cast<Uint32>(seconds) * 1000;
+    event.action = InputLog::Action::QUIT;
+    session.events.push_back(event);
+}
+
+// Open a window on each of the -d displays and play the game on all of them, each window made and drawn by its own
+// thread, which needs a video driver that allows it. Without -f the windows are w by h. They can't be resized, each
+// one's images are only rasterised once.
+int runOnDisplays(CommandLineParameters& parameters, const OutlinePack* outlinePack, StatePublisher* publisher,
+    const InputLog* replay, int w, int h) {
+    if (!Output::isThreadedWindowSupported()) {
+        const char* driver = SDL_GetCurrentVideoDriver();
+        std::cerr << "Several displays need the x11 or KMSDRM video driver, not "
+                  << (driver != nullptr ? driver : "none") << "." << std::endl;
+        return 1;
+    }
+
+    std::vector<SDL_Rect> placements;
+    for (int display : parameters.displays) {
+        SDL_Rect rect;
+        if (SDL_GetDisplayBounds(display, &rect) != 0) {
+            std::cerr << "Error obtaining the dimensions of display " << display << ":" << SDL_GetError() << std::endl;
+            return 1;
+        }
+        if (!parameters.fullscreen) {
+            rect.w = w;
+            rect.h = h;
+        }
+        placements.push_back(rect);
+    }
+
+    Skin skin;
+    if (parameters.skinPath != nullptr && !createSkin(parameters, outlinePack, w, h, skin)) {
+        std::cerr << "Error loading the skin " << parameters.skinPath << "." << std::endl;
+        return 1;
+    }
+
+    SDL_ShowCursor(SDL_FALSE);
+    GameState gameState;
+    if (!setUpGame(parameters, outlinePack, parameters.skinPath != nullptr ? &skin : nullptr, publisher, replay,
+            gameState)) {
+        std::cerr << "Error recording the session to " << parameters.sessionPath << "." << std::endl;
+        return 1;
+    }
+    Output::ScreenFactory factory = [&parameters](SDL_Window* window, SDL_Renderer*& renderer) {
+        return createScreen(parameters, window, renderer);
+    };
+    auto s = std::chrono::high_resolution_clock::now();
+    if (!gameState.createOutputs(placements, getWindowFlags(parameters), factory, parameters.split,
+            parameters.subsamples, parameters.progressive))
+        return 1;
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - s);
+    std::cout << "created textures in: " << delay.count() << "ms." << std::endl;
+    gameState.run();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
     CommandLineParameters parameters;
 
     if (!parameters.parse(argc, argv)) {
@@ -234,6 +757,52 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    OutlinePack outlinePack;
+    if (parameters.outlinesPath != nullptr && !outlinePack.open(parameters.outlinesPath)) {
+        std::cerr << "Error loading outlines from " << parameters.outlinesPath << "." << std::endl;
+        return 1;
+    }
+    const OutlinePack* outlines = parameters.outlinesPath != nullptr ? &outlinePack : nullptr;
+
+    // A replay has the boards that were recorded, the skin is sized to suit them.
+    InputLog replay;
+    if (parameters.replayPath != nullptr) {
+        if (!replay.load(parameters.replayPath)) {
+            std::cerr << "Error loading the session " << parameters.replayPath << "." << std::endl;
+            return 1;
+        }
+        parameters.boards = static_cast<int>(replay.getBoardCount());
+    }
+    if (parameters.autoplayGame != 0) {
+        makeAutoplaySession(parameters.autoplayGame == 'a', parameters.autoplayLength, replay);
+        parameters.boards = 1;
+    }
+    const InputLog* replayOrNull = parameters.replayPath != nullptr || parameters.autoplayGame != 0 ? &replay : nullptr;
+
+    if (parameters.recordPath != nullptr || parameters.verifyPath != nullptr) {
+        RasterBaseline baseline;
+        baseline.measure(outlines);
+        if (parameters.recordPath != nullptr) {
+            return baseline.save(parameters.recordPath) &&
+                (parameters.timesPath == nullptr || baseline.saveTimes(parameters.timesPath)) ? 0 : 1;
+        }
+        RasterBaseline reference;
+        return reference.load(parameters.verifyPath) &&
+            (parameters.timesPath == nullptr || reference.loadTimes(parameters.timesPath)) &&
+            baseline.compare(reference) ? 0 : 1;
+    }
+
+    // Without a window there may not be a video driver at all.
+    const bool needsVideo = parameters.framebufferDevice == nullptr && parameters.outputPath == nullptr &&
+        parameters.wavPath == nullptr;
+    SDL_Init((needsVideo ? SDL_INIT_VIDEO : SDL_INIT_EVENTS) | SDL_INIT_AUDIO);
+
+    if (parameters.wavPath != nullptr) {
+        GameState gameState;
+        setUpGame(parameters, outlines, nullptr, nullptr, replayOrNull, gameState);
+        return gameState.writeSounds(parameters.wavPath) ? 0 : 1;
+    }
+
     if (parameters.showInfo) {
         showInfo();
         return 0;
@@ -257,27 +826,77 @@ int main(int argc, char* argv[]) {
         w = parameters.width;
         h = parameters.height;
     }
-    // SDL_WINDOWPOS_CENTERED_DISPLAY(parameters.displayIndex), SDL_WINDOWPOS_CENTERED_DISPLAY(parameters.displayIndex)
-    SDL_Window* window =
-        SDL_CreateWindow("Test", 0, 0, w, h, (parameters.fullscreen ? SDL_WINDOW_FULLSCREEN : SDL_WINDOW_BORDERLESS));
-    if (window == nullptr) {
-        std::cerr << "Error creating window:" << SDL_GetError() << std::endl;
-        return 1;
+
+    Skin skin;
+    if (parameters.outputPath != nullptr) {
+        if (parameters.skinPath != nullptr && !createSkin(parameters, outlines, w, h, skin)) {
+            std::cerr << "Error loading the skin " << parameters.skinPath << "." << std::endl;
+            return 1;
+        }
+        return renderHeadless(parameters, outlines, parameters.skinPath != nullptr ? &skin : nullptr, replayOrNull, w,
+            h);
     }
 
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, 0, SDL_RENDERER_ACCELERATED);  // | SDL_RENDERER_PRESENTVSYNC);
-    if (renderer == nullptr) {
-        std::cerr << "Error creating renderer:" << SDL_GetError() << std::endl;
+    // Opened before the game starts so the readers see its very first state.
+    StatePublisher publisher;
+    if (parameters.publishName != nullptr && !publisher.open(parameters.publishName)) {
+        std::cerr << "Error publishing the game's state in " << parameters.publishName << "." << std::endl;
         return 1;
     }
+    StatePublisher* publisherOrNull = publisher.isOpen() ? &publisher : nullptr;
+
+    SDL_Window* window = nullptr;
+    SDL_Renderer* renderer = nullptr;
+    std::unique_ptr<Screen> screen;
+    if (parameters.framebufferDevice != nullptr) {
+        std::unique_ptr<SoftwareScreen> softwareScreen;
+        if (parameters.useVector)
+            softwareScreen = std::make_unique<VectorScreen>(parameters.onColour);
+        else
+            softwareScreen = std::make_unique<SoftwareScreen>(parameters.onColour);
+        if (!softwareScreen->openDevice(parameters.framebufferDevice)) {
+            std::cerr << "Error opening framebuffer " << parameters.framebufferDevice << "." << std::endl;
+            return 1;
+        }
+        w = softwareScreen->getFramebuffer().width;
+        h = softwareScreen->getFramebuffer().height;
+        screen = std::move(softwareScreen);
+    } else {
+        if (parameters.displays.size() > 1)
+            return runOnDisplays(parameters, outlines, publisherOrNull, replayOrNull, w, h);
 
-    SDL_ShowCursor(SDL_FALSE);
+        // Resizing is handled, the images are rasterised again for the new size.
+        Uint32 windowFlags = getWindowFlags(parameters) | SDL_WINDOW_RESIZABLE;
+
+        // SDL_WINDOWPOS_CENTERED_DISPLAY(parameters.displayIndex), SDL_WINDOWPOS_CENTERED_DISPLAY(parameters.displayIndex)
+        window = SDL_CreateWindow("Test", 0, 0, w, h, windowFlags);
+        if (window == nullptr) {
+            std::cerr << "Error creating window:" << SDL_GetError() << std::endl;
+            return 1;
+        }
+
+        screen = createScreen(parameters, window, renderer);
+        if (screen == nullptr)
+            return 1;
+
+        SDL_ShowCursor(SDL_FALSE);
+    }
+
+    // A framebuffer device decides the size itself, so this has to wait for the screen.
+    if (parameters.skinPath != nullptr && !createSkin(parameters, outlines, w, h, skin)) {
+        std::cerr << "Error loading the skin " << parameters.skinPath << "." << std::endl;
+        return 1;
+    }
 
     {
         GameState gameState;
-        gameState.setGameColours(parameters.onColour, parameters.offColour);
+        if (!setUpGame(parameters, outlines, parameters.skinPath != nullptr ? &skin : nullptr, publisherOrNull,
+                replayOrNull, gameState)) {
+            std::cerr << "Error recording the session to " << parameters.sessionPath << "." << std::endl;
+            return 1;
+        }
         auto s = std::chrono::high_resolution_clock::now();
-        gameState.createTextures(renderer, w, h, parameters.subsamples);
+        gameState.createTextures(*screen, w, h, parameters.subsamples, parameters.progressive);
         auto e = std::chrono::high_resolution_clock::now();
         auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(e - s);
         std::cout << "created textures in: " << delay.count() << "ms." << std::endl;
@@ -286,14 +905,17 @@ int main(int argc, char* argv[]) {
 
         bool finished = false;
 
-        gameState.run(renderer);
+        gameState.run();
         //SDL_RemoveTimer(timer);
     }
 
     
 
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
+    screen.reset();
+    if (renderer != nullptr)
+        SDL_DestroyRenderer(renderer);
+    if (window != nullptr)
+        SDL_DestroyWindow(window);
 
     return 0;
 }
\ No newline at end of file